@@ -1,2 +1,8 @@
+// stb_image only auto-enables its SSE2 decode loops; the NEON ones have to be
+// asked for explicitly, otherwise ARM builds decode everything scalar.
+#if defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON__)
+#define STBI_NEON
+#endif
+
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#include "bench.h"
+#include "common/timer.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+static const char* s_filter = nullptr;
+
+void Benchmark::SetFilter(const char* filter)
+{
+  s_filter = filter;
+}
+
+void Benchmark::Run(const char* name, u64 bytes_per_op, const std::function<void()>& fn)
+{
+  if (s_filter && !std::strstr(name, s_filter))
+    return;
+
+  // Warm caches and measure a single iteration to pick the iteration count.
+  Common::Timer timer;
+  fn();
+  const double single_time = timer.GetTimeSeconds();
+
+  // Aim for roughly half a second of measurement, but cap the count so pathologically slow
+  // benchmarks still terminate in reasonable time.
+  static constexpr double TARGET_TIME = 0.5;
+  static constexpr u64 MAX_ITERATIONS = 100000000;
+  u64 iterations = 1;
+  if (single_time > 0.0 && single_time < TARGET_TIME)
+    iterations = std::min<u64>(static_cast<u64>(TARGET_TIME / single_time) + 1, MAX_ITERATIONS);
+
+  timer.Reset();
+  for (u64 i = 0; i < iterations; i++)
+    fn();
+  const double total_time = timer.GetTimeSeconds();
+
+  const double ns_per_op = (total_time * 1e9) / static_cast<double>(iterations);
+  if (bytes_per_op > 0)
+  {
+    const double mb_per_sec =
+      (static_cast<double>(bytes_per_op) * static_cast<double>(iterations)) / (total_time * 1048576.0);
+    std::printf("%-40s %12.1f ns/op %10.1f MB/s (%llu iterations)\n", name, ns_per_op, mb_per_sec,
+                static_cast<unsigned long long>(iterations));
+  }
+  else
+  {
+    std::printf("%-40s %12.1f ns/op (%llu iterations)\n", name, ns_per_op,
+                static_cast<unsigned long long>(iterations));
+  }
+}
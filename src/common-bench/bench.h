@@ -0,0 +1,34 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#pragma once
+#include "common/types.h"
+#include <functional>
+
+namespace Benchmark {
+
+/// Restricts Run() to benchmarks whose name contains the given substring.
+void SetFilter(const char* filter);
+
+/// Times fn, automatically scaling the iteration count until enough wall time has accumulated for
+/// a stable figure, and prints ns/op. When bytes_per_op is nonzero, throughput is printed as well.
+void Run(const char* name, u64 bytes_per_op, const std::function<void()>& fn);
+
+/// Prevents the optimizer from discarding a computed value.
+template<typename T>
+ALWAYS_INLINE void DoNotOptimize(const T& value)
+{
+#ifdef _MSC_VER
+  volatile u8 sink = *reinterpret_cast<const volatile u8*>(&value);
+  static_cast<void>(sink);
+#else
+  asm volatile("" : : "g"(&value) : "memory");
+#endif
+}
+
+} // namespace Benchmark
+
+void BenchmarkFIFOQueue();
+void BenchmarkHashes();
+void BenchmarkImage();
+void BenchmarkStateWrapper();
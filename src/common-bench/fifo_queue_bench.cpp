@@ -0,0 +1,41 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#include "bench.h"
+#include "common/fifo_queue.h"
+
+#include <array>
+
+void BenchmarkFIFOQueue()
+{
+  static constexpr u32 CAPACITY = 4096;
+  static InlineFIFOQueue<u32, CAPACITY> fifo;
+
+  Benchmark::Run("FIFOQueue/Push+Pop", CAPACITY * sizeof(u32), []() {
+    for (u32 i = 0; i < CAPACITY; i++)
+      fifo.Push(i);
+    u32 sum = 0;
+    while (!fifo.IsEmpty())
+      sum += fifo.Pop();
+    Benchmark::DoNotOptimize(sum);
+  });
+
+  static std::array<u32, CAPACITY> buffer;
+  buffer.fill(0xDEADBEEFu);
+
+  Benchmark::Run("FIFOQueue/PushRange+PopRange", CAPACITY * sizeof(u32), []() {
+    fifo.PushRange(buffer.data(), CAPACITY);
+    fifo.PopRange(buffer.data(), CAPACITY);
+    Benchmark::DoNotOptimize(buffer[0]);
+  });
+
+  // Wrapped variant: keep the queue half-full so every range crosses the ring boundary region.
+  fifo.Clear();
+  fifo.PushRange(buffer.data(), CAPACITY / 2);
+  Benchmark::Run("FIFOQueue/PushRange+PopRange (wrapped)", (CAPACITY / 2) * sizeof(u32), []() {
+    fifo.PushRange(buffer.data(), CAPACITY / 2);
+    fifo.PopRange(buffer.data(), CAPACITY / 2);
+    Benchmark::DoNotOptimize(buffer[0]);
+  });
+  fifo.Clear();
+}
@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#include "bench.h"
+#include "common/md5_digest.h"
+#include "common/sha1_digest.h"
+
+#include "xxhash.h"
+
+#include <vector>
+
+void BenchmarkHashes()
+{
+  // Roughly the size of a raw memory card image; representative of the buffers we hash.
+  static constexpr u32 BUFFER_SIZE = 128 * 1024;
+  static std::vector<u8> buffer;
+  buffer.resize(BUFFER_SIZE);
+  for (u32 i = 0; i < BUFFER_SIZE; i++)
+    buffer[i] = static_cast<u8>(i * 2654435761u);
+
+  Benchmark::Run("Hash/MD5", BUFFER_SIZE, []() {
+    MD5Digest md5;
+    md5.Update(buffer.data(), BUFFER_SIZE);
+    u8 digest[16];
+    md5.Final(digest);
+    Benchmark::DoNotOptimize(digest);
+  });
+
+  Benchmark::Run("Hash/SHA1", BUFFER_SIZE, []() {
+    SHA1Digest sha1;
+    sha1.Update(buffer.data(), BUFFER_SIZE);
+    u8 digest[SHA1Digest::DIGEST_SIZE];
+    sha1.Final(digest);
+    Benchmark::DoNotOptimize(digest);
+  });
+
+  Benchmark::Run("Hash/XXH64", BUFFER_SIZE, []() {
+    const u64 hash = XXH64(buffer.data(), BUFFER_SIZE, 0x4242D00DULL);
+    Benchmark::DoNotOptimize(hash);
+  });
+
+  Benchmark::Run("Hash/XXH3_64", BUFFER_SIZE, []() {
+    const u64 hash = XXH3_64bits(buffer.data(), BUFFER_SIZE);
+    Benchmark::DoNotOptimize(hash);
+  });
+}
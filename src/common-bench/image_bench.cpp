@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#include "bench.h"
+#include "common/image.h"
+
+#include <vector>
+
+void BenchmarkImage()
+{
+  // VRAM-sized gradient, similar in content to a screenshot or texture dump.
+  static constexpr u32 WIDTH = 1024;
+  static constexpr u32 HEIGHT = 512;
+  static Common::RGBA8Image image;
+  image.SetSize(WIDTH, HEIGHT);
+  for (u32 y = 0; y < HEIGHT; y++)
+  {
+    for (u32 x = 0; x < WIDTH; x++)
+      image.SetPixel(x, y, 0xFF000000u | ((x & 0xFF) << 16) | ((y & 0xFF) << 8) | ((x ^ y) & 0xFF));
+  }
+
+  static std::vector<u8> png_buffer;
+
+  Benchmark::Run("Image/EncodePNG", WIDTH * HEIGHT * sizeof(u32), []() {
+    std::optional<std::vector<u8>> result = image.SaveToBuffer("bench.png");
+    if (result.has_value())
+      png_buffer = std::move(result.value());
+    Benchmark::DoNotOptimize(png_buffer);
+  });
+
+  Benchmark::Run("Image/DecodePNG", WIDTH * HEIGHT * sizeof(u32), []() {
+    Common::RGBA8Image decoded;
+    decoded.LoadFromBuffer("bench.png", png_buffer.data(), png_buffer.size());
+    Benchmark::DoNotOptimize(decoded.GetPixel(0, 0));
+  });
+
+  Benchmark::Run("Image/EncodeJPEG", WIDTH * HEIGHT * sizeof(u32), []() {
+    const std::optional<std::vector<u8>> result = image.SaveToBuffer("bench.jpg");
+    Benchmark::DoNotOptimize(result);
+  });
+
+  Benchmark::Run("Image/Resize", WIDTH * HEIGHT * sizeof(u32), []() {
+    Common::RGBA8Image resized(image);
+    resized.Resize(WIDTH / 2, HEIGHT / 2);
+    Benchmark::DoNotOptimize(resized.GetPixel(0, 0));
+  });
+}
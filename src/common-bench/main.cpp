@@ -0,0 +1,16 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#include "bench.h"
+
+int main(int argc, char* argv[])
+{
+  if (argc > 1)
+    Benchmark::SetFilter(argv[1]);
+
+  BenchmarkFIFOQueue();
+  BenchmarkHashes();
+  BenchmarkImage();
+  BenchmarkStateWrapper();
+  return 0;
+}
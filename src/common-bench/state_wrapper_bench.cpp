@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#include "bench.h"
+#include "common/fifo_queue.h"
+
+#include "util/state_wrapper.h"
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace {
+
+// A field mix resembling a real subsystem: a handful of scalars, a register file, a FIFO and a
+// bulk RAM-like blob, serialized field-by-field the way the subsystems' DoState() methods do.
+struct TestState
+{
+  u32 control = 0x12345678;
+  u32 status = 0x9ABCDEF0;
+  s32 counter = -12345;
+  bool enabled = true;
+  float rate = 44100.0f;
+  std::array<u32, 64> regs{};
+  InlineFIFOQueue<u8, 256> fifo;
+  std::array<u8, 4096> ram{};
+
+  void DoState(StateWrapper& sw)
+  {
+    sw.Do(&control);
+    sw.Do(&status);
+    sw.Do(&counter);
+    sw.Do(&enabled);
+    sw.Do(&rate);
+    sw.Do(&regs);
+    sw.Do(&fifo);
+    sw.DoBytes(ram.data(), ram.size());
+  }
+};
+
+} // namespace
+
+void BenchmarkStateWrapper()
+{
+  static constexpr u32 VERSION = 1;
+  static TestState state;
+  state.fifo.PushRange(state.ram.data(), 128);
+
+  // Generously-sized flat buffer; the serialized size is measured with one write pass.
+  static std::vector<u8> buffer;
+  buffer.resize(sizeof(TestState) + 1024);
+  u64 state_size;
+  {
+    StateWrapper sw(buffer.data(), buffer.size(), StateWrapper::Mode::Write, VERSION);
+    state.DoState(sw);
+    state_size = sw.GetPosition();
+  }
+
+  Benchmark::Run("StateWrapper/Write (buffer)", state_size, []() {
+    StateWrapper sw(buffer.data(), buffer.size(), StateWrapper::Mode::Write, VERSION);
+    state.DoState(sw);
+    Benchmark::DoNotOptimize(sw.HasError());
+  });
+
+  Benchmark::Run("StateWrapper/Read (buffer)", state_size, []() {
+    StateWrapper sw(buffer.data(), buffer.size(), StateWrapper::Mode::Read, VERSION);
+    state.DoState(sw);
+    Benchmark::DoNotOptimize(sw.HasError());
+  });
+
+  static std::unique_ptr<ByteStream> stream =
+    ByteStream::CreateGrowableMemoryStream(nullptr, static_cast<u32>(buffer.size()));
+  Benchmark::Run("StateWrapper/Write (stream)", state_size, []() {
+    stream->SeekAbsolute(0);
+    StateWrapper sw(stream.get(), StateWrapper::Mode::Write, VERSION);
+    state.DoState(sw);
+    Benchmark::DoNotOptimize(sw.HasError());
+  });
+}
@@ -21,6 +21,7 @@
 #include <io.h>
 #include <share.h>
 #else
+#include <fcntl.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #endif
@@ -33,6 +34,17 @@
 
 Log_SetChannel(ByteStream);
 
+// Stdio buffer size used for streams opened with BYTESTREAM_OPEN_SEQUENTIAL, so large writers
+// (save states, caches) hand data to the OS in big runs instead of the default ~4KB chunks.
+static constexpr size_t SEQUENTIAL_BUFFER_SIZE = 1024 * 1024;
+
+static void ApplyOpenHints(std::FILE* pFile, u32 openMode)
+{
+  // must be done before any I/O on the stream
+  if (openMode & BYTESTREAM_OPEN_SEQUENTIAL)
+    std::setvbuf(pFile, nullptr, _IOFBF, SEQUENTIAL_BUFFER_SIZE);
+}
+
 class FileByteStream : public ByteStream
 {
 public:
@@ -130,6 +142,22 @@ public:
     return true;
   }
 
+  void PreAllocate(u64 size) override
+  {
+#if defined(__linux__)
+    // KEEP_SIZE so the logical file size still reflects what was actually written.
+    fallocate(fileno(m_pFile), FALLOC_FL_KEEP_SIZE, 0, static_cast<off_t>(size));
+#elif defined(__APPLE__)
+    fstore_t store = {F_ALLOCATECONTIG, F_PEOFPOSMODE, 0, static_cast<off_t>(size), 0};
+    if (fcntl(fileno(m_pFile), F_PREALLOCATE, &store) < 0)
+    {
+      store.fst_flags = F_ALLOCATEALL;
+      fcntl(fileno(m_pFile), F_PREALLOCATE, &store);
+    }
+#endif
+    // no equivalent which preserves the end-of-file marker on other platforms
+  }
+
 #if defined(_WIN32)
 
   bool SeekAbsolute(u64 Offset) override
@@ -883,6 +911,11 @@ void GrowableMemoryByteStream::Grow(u32 MinimumGrowth)
   ResizeMemory(NewSize);
 }
 
+void ByteStream::PreAllocate(u64 size)
+{
+  // only a hint, memory-backed streams don't care
+}
+
 bool ByteStream::ReadU8(u8* dest)
 {
   return Read2(dest, sizeof(u8));
@@ -1071,6 +1104,8 @@ std::unique_ptr<ByteStream> ByteStream::OpenFile(const char* fileName, u32 openM
       return nullptr;
     }
 
+    ApplyOpenHints(pTemporaryFile, openMode);
+
     // create the stream pointer
     std::unique_ptr<AtomicUpdatedFileByteStream> pStream =
       std::make_unique<AtomicUpdatedFileByteStream>(pTemporaryFile, fileName, temporaryFileName);
@@ -1128,6 +1163,8 @@ std::unique_ptr<ByteStream> ByteStream::OpenFile(const char* fileName, u32 openM
     if (pTemporaryFile == nullptr)
       return nullptr;
 
+    ApplyOpenHints(pTemporaryFile, openMode);
+
     // create the stream pointer
     std::unique_ptr<AtomicUpdatedFileByteStream> pStream =
       std::make_unique<AtomicUpdatedFileByteStream>(pTemporaryFile, fileName, temporaryFileName);
@@ -1174,6 +1211,8 @@ std::unique_ptr<ByteStream> ByteStream::OpenFile(const char* fileName, u32 openM
     if (!pFile)
       return nullptr;
 
+    ApplyOpenHints(pFile, openMode);
+
     return std::make_unique<FileByteStream>(pFile);
   }
 }
@@ -19,6 +19,7 @@ enum BYTESTREAM_OPEN_MODE
   BYTESTREAM_OPEN_ATOMIC_UPDATE = 64, //
   BYTESTREAM_OPEN_SEEKABLE = 128,
   BYTESTREAM_OPEN_STREAMED = 256,
+  BYTESTREAM_OPEN_SEQUENTIAL = 512, // hint that the file will be read/written front to back in large runs
 };
 
 // forward declarations for implemented classes
@@ -75,6 +76,11 @@ public:
   // if the file was opened in atomic update mode, commits the file and replaces the temporary file
   virtual bool Commit() = 0;
 
+  // hints the expected final size of the stream, so file-backed streams can reserve contiguous disk
+  // space up front instead of growing an extent at a time. the logical file size is not changed, and
+  // failure is not an error, since this is only a hint.
+  virtual void PreAllocate(u64 size);
+
   // state accessors
   inline bool InErrorState() const { return m_errorState; }
   inline void SetErrorState() { m_errorState = true; }
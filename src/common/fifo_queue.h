@@ -110,11 +110,19 @@ public:
   void Remove(u32 count)
   {
     DebugAssert(m_size >= count);
-    for (u32 i = 0; i < count; i++)
+    if constexpr (std::is_trivially_destructible_v<T>)
     {
-      m_ptr[m_head].~T();
-      m_head = (m_head + 1) % CAPACITY;
-      m_size--;
+      m_head = (m_head + count) % CAPACITY;
+      m_size -= count;
+    }
+    else
+    {
+      for (u32 i = 0; i < count; i++)
+      {
+        m_ptr[m_head].~T();
+        m_head = (m_head + 1) % CAPACITY;
+        m_size--;
+      }
     }
   }
 
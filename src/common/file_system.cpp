@@ -25,6 +25,7 @@
 
 #if defined(_WIN32)
 #include "windows_headers.h"
+#include <io.h>
 #include <share.h>
 #include <shlobj.h>
 #include <winioctl.h>
@@ -33,6 +34,7 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <limits.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -718,6 +720,84 @@ s64 FileSystem::FTell64(std::FILE* fp)
 #endif
 }
 
+void FileSystem::HintSequentialAccess(std::FILE* fp)
+{
+#if defined(__linux__) || defined(__FreeBSD__)
+  posix_fadvise(fileno(fp), 0, 0, POSIX_FADV_SEQUENTIAL);
+#elif defined(__APPLE__)
+  fcntl(fileno(fp), F_RDAHEAD, 1);
+#else
+  static_cast<void>(fp);
+#endif
+}
+
+s64 FileSystem::ReadFileAtOffset(std::FILE* fp, void* buffer, size_t size, u64 offset)
+{
+#ifdef _WIN32
+  const HANDLE handle = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(fp)));
+  if (handle == INVALID_HANDLE_VALUE)
+    return -1;
+
+  u8* buffer_ptr = static_cast<u8*>(buffer);
+  size_t remaining = size;
+  while (remaining > 0)
+  {
+    const DWORD this_size =
+      static_cast<DWORD>(std::min<size_t>(remaining, std::numeric_limits<DWORD>::max()));
+    OVERLAPPED ov = {};
+    ov.Offset = static_cast<DWORD>(offset);
+    ov.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+    DWORD bytes_read;
+    if (!ReadFile(handle, buffer_ptr, this_size, &bytes_read, &ov))
+    {
+      if (GetLastError() == ERROR_HANDLE_EOF)
+        break;
+
+      return (remaining == size) ? -1 : static_cast<s64>(size - remaining);
+    }
+    else if (bytes_read == 0)
+    {
+      break;
+    }
+
+    buffer_ptr += bytes_read;
+    remaining -= bytes_read;
+    offset += bytes_read;
+  }
+
+  return static_cast<s64>(size - remaining);
+#else
+  const int fd = fileno(fp);
+  if (fd < 0)
+    return -1;
+
+  u8* buffer_ptr = static_cast<u8*>(buffer);
+  size_t remaining = size;
+  while (remaining > 0)
+  {
+    const ssize_t res = pread(fd, buffer_ptr, remaining, static_cast<off_t>(offset));
+    if (res < 0)
+    {
+      if (errno == EINTR)
+        continue;
+
+      return (remaining == size) ? -1 : static_cast<s64>(size - remaining);
+    }
+    else if (res == 0)
+    {
+      break;
+    }
+
+    buffer_ptr += res;
+    remaining -= static_cast<size_t>(res);
+    offset += static_cast<u64>(res);
+  }
+
+  return static_cast<s64>(size - remaining);
+#endif
+}
+
 s64 FileSystem::FSize64(std::FILE* fp)
 {
   const s64 pos = FTell64(fp);
@@ -743,6 +823,115 @@ s64 FileSystem::GetPathFileSize(const char* Path)
   return sd.Size;
 }
 
+FileSystem::MemoryMappedFile::MemoryMappedFile() = default;
+
+FileSystem::MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& mf)
+  : m_data(mf.m_data), m_size(mf.m_size)
+#ifdef _WIN32
+    ,
+    m_mapping_handle(mf.m_mapping_handle)
+#endif
+{
+  mf.m_data = nullptr;
+  mf.m_size = 0;
+#ifdef _WIN32
+  mf.m_mapping_handle = nullptr;
+#endif
+}
+
+FileSystem::MemoryMappedFile::~MemoryMappedFile()
+{
+  Close();
+}
+
+FileSystem::MemoryMappedFile& FileSystem::MemoryMappedFile::operator=(MemoryMappedFile&& mf)
+{
+  Close();
+  std::swap(m_data, mf.m_data);
+  std::swap(m_size, mf.m_size);
+#ifdef _WIN32
+  std::swap(m_mapping_handle, mf.m_mapping_handle);
+#endif
+  return *this;
+}
+
+bool FileSystem::MemoryMappedFile::Open(const char* path)
+{
+  Close();
+
+#ifdef _WIN32
+  const std::wstring wpath(StringUtil::UTF8StringToWideString(path));
+  const HANDLE file =
+    CreateFileW(wpath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+    return false;
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0 ||
+      static_cast<u64>(size.QuadPart) > std::numeric_limits<size_t>::max())
+  {
+    CloseHandle(file);
+    return false;
+  }
+
+  // The mapping object holds its own reference to the file, so the file handle can go away now.
+  const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  CloseHandle(file);
+  if (!mapping)
+    return false;
+
+  void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (!data)
+  {
+    CloseHandle(mapping);
+    return false;
+  }
+
+  m_mapping_handle = mapping;
+  m_data = data;
+  m_size = static_cast<size_t>(size.QuadPart);
+  return true;
+#else
+  const int fd = open(path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+    return false;
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size <= 0 || static_cast<u64>(st.st_size) > std::numeric_limits<size_t>::max())
+  {
+    close(fd);
+    return false;
+  }
+
+  // The mapping keeps the file alive after the descriptor is closed.
+  void* data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED)
+    return false;
+
+  m_data = data;
+  m_size = static_cast<size_t>(st.st_size);
+  return true;
+#endif
+}
+
+void FileSystem::MemoryMappedFile::Close()
+{
+  if (!m_data)
+    return;
+
+#ifdef _WIN32
+  UnmapViewOfFile(m_data);
+  CloseHandle(m_mapping_handle);
+  m_mapping_handle = nullptr;
+#else
+  munmap(m_data, m_size);
+#endif
+
+  m_data = nullptr;
+  m_size = 0;
+}
+
 std::optional<std::vector<u8>> FileSystem::ReadBinaryFile(const char* filename, Error* error)
 {
   ManagedCFilePtr fp = OpenManagedCFile(filename, "rb", error);
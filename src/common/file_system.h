@@ -109,6 +109,16 @@ int FSeek64(std::FILE* fp, s64 offset, int whence);
 s64 FTell64(std::FILE* fp);
 s64 FSize64(std::FILE* fp);
 
+/// Hints to the OS that the file will be read mostly sequentially, deepening kernel readahead.
+/// This keeps multiple requests in flight on high-latency (i.e. network) mounts. No-op on Windows,
+/// where readahead behaviour can only be set when the file is opened.
+void HintSequentialAccess(std::FILE* fp);
+
+/// Reads from the file at an explicit offset, bypassing stdio buffering and leaving the stream
+/// position untouched. Carries no seek state, so concurrent reads on the same handle are safe.
+/// Returns the number of bytes read (short at end-of-file), or -1 on error.
+s64 ReadFileAtOffset(std::FILE* fp, void* buffer, size_t size, u64 offset);
+
 int OpenFDFile(const char* filename, int flags, int mode, Error* error = nullptr);
 
 /// Sharing modes for OpenSharedCFile().
@@ -140,6 +150,35 @@ private:
 };
 #endif
 
+/// Read-only shared mapping of an entire file. The pages are backed by the file itself, so
+/// multiple processes mapping the same file share one copy in the page cache instead of each
+/// holding a private heap buffer.
+class MemoryMappedFile
+{
+public:
+  MemoryMappedFile();
+  MemoryMappedFile(MemoryMappedFile&& mf);
+  MemoryMappedFile(const MemoryMappedFile&) = delete;
+  ~MemoryMappedFile();
+
+  MemoryMappedFile& operator=(MemoryMappedFile&& mf);
+  MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+  ALWAYS_INLINE bool IsOpen() const { return (m_data != nullptr); }
+  ALWAYS_INLINE const u8* GetData() const { return static_cast<const u8*>(m_data); }
+  ALWAYS_INLINE size_t GetSize() const { return m_size; }
+
+  bool Open(const char* path);
+  void Close();
+
+private:
+  void* m_data = nullptr;
+  size_t m_size = 0;
+#ifdef _WIN32
+  void* m_mapping_handle = nullptr;
+#endif
+};
+
 std::optional<std::vector<u8>> ReadBinaryFile(const char* filename, Error* error = nullptr);
 std::optional<std::vector<u8>> ReadBinaryFile(std::FILE* fp);
 std::optional<std::string> ReadFileToString(const char* filename, Error* error = nullptr);
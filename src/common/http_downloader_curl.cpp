@@ -13,7 +13,14 @@ namespace Common {
 
 HTTPDownloaderCurl::HTTPDownloaderCurl() : HTTPDownloader() {}
 
-HTTPDownloaderCurl::~HTTPDownloaderCurl() = default;
+HTTPDownloaderCurl::~HTTPDownloaderCurl()
+{
+  // Join the workers before tearing down the share handle, otherwise an in-flight
+  // transfer could still be poking at it.
+  m_thread_pool.reset();
+  if (m_share)
+    curl_share_cleanup(m_share);
+}
 
 std::unique_ptr<HTTPDownloader> HTTPDownloader::Create(const char* user_agent)
 {
@@ -48,17 +55,59 @@ bool HTTPDownloaderCurl::Initialize(const char* user_agent)
     }
   }
 
+  // Connection reuse. Losing the share isn't fatal, each request just falls back to
+  // its own connection like before.
+  m_share = curl_share_init();
+  if (m_share)
+  {
+    curl_share_setopt(m_share, CURLSHOPT_LOCKFUNC, &HTTPDownloaderCurl::ShareLockCallback);
+    curl_share_setopt(m_share, CURLSHOPT_UNLOCKFUNC, &HTTPDownloaderCurl::ShareUnlockCallback);
+    curl_share_setopt(m_share, CURLSHOPT_USERDATA, this);
+    curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+    curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+  }
+  else
+  {
+    Log_WarningPrint("curl_share_init() failed, connections will not be reused");
+  }
+
   m_user_agent = user_agent;
   m_thread_pool = std::make_unique<cb::ThreadPool>(m_max_active_requests);
   return true;
 }
 
+void HTTPDownloaderCurl::ShareLockCallback(CURL* handle, curl_lock_data data, curl_lock_access access, void* userptr)
+{
+  HTTPDownloaderCurl* http = static_cast<HTTPDownloaderCurl*>(userptr);
+  http->m_share_mutexes[data].lock();
+}
+
+void HTTPDownloaderCurl::ShareUnlockCallback(CURL* handle, curl_lock_data data, void* userptr)
+{
+  HTTPDownloaderCurl* http = static_cast<HTTPDownloaderCurl*>(userptr);
+  http->m_share_mutexes[data].unlock();
+}
+
 size_t HTTPDownloaderCurl::WriteCallback(char* ptr, size_t size, size_t nmemb, void* userdata)
 {
   Request* req = static_cast<Request*>(userdata);
   const size_t current_size = req->data.size();
   const size_t transfer_size = size * nmemb;
   const size_t new_size = current_size + transfer_size;
+
+  // Size the buffer once off the response headers instead of growing it chunk by chunk.
+  if (current_size == 0)
+  {
+    curl_off_t content_length = 0;
+    if (curl_easy_getinfo(req->handle, CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &content_length) == CURLE_OK &&
+        content_length > 0)
+    {
+      req->content_length = static_cast<u32>(content_length);
+      req->data.reserve(static_cast<size_t>(content_length));
+    }
+  }
+
   req->data.resize(new_size);
   std::memcpy(&req->data[current_size], ptr, transfer_size);
   return nmemb;
@@ -140,6 +189,8 @@ bool HTTPDownloaderCurl::StartRequest(HTTPDownloader::Request* request)
   curl_easy_setopt(req->handle, CURLOPT_WRITEFUNCTION, &HTTPDownloaderCurl::WriteCallback);
   curl_easy_setopt(req->handle, CURLOPT_WRITEDATA, req);
   curl_easy_setopt(req->handle, CURLOPT_NOSIGNAL, 1);
+  if (m_share)
+    curl_easy_setopt(req->handle, CURLOPT_SHARE, m_share);
 
   if (request->type == Request::Type::Post)
   {
@@ -5,9 +5,13 @@
 #include "assert.h"
 #include "file_system.h"
 #include "string.h"
+#include "threading.h"
 #include "timer.h"
+#include <condition_variable>
 #include <cstdio>
+#include <deque>
 #include <mutex>
+#include <string>
 #include <vector>
 
 #if defined(_WIN32)
@@ -60,6 +64,39 @@ std::unique_ptr<std::FILE, void (*)(std::FILE*)> s_fileOutputHandle(nullptr, [](
   }
 });
 
+// File logging is asynchronous: callers enqueue the raw message and the sink thread formats and
+// writes it, so enabling file logging doesn't put disk I/O on the emulation/GPU threads. Channel
+// and function names come from compile-time literals, so records only copy the message itself.
+struct AsyncLogRecord
+{
+  const char* channel;
+  const char* function;
+  LOGLEVEL level;
+  Common::Timer::Value timestamp;
+  std::string message;
+};
+
+static void StartFileOutputThread();
+static void StopFileOutputThread();
+static void FileOutputThreadProc();
+
+static Threading::Thread s_file_output_thread;
+static std::mutex s_file_output_queue_mutex;
+static std::condition_variable s_file_output_queue_cv;
+static std::deque<AsyncLogRecord> s_file_output_queue;
+static bool s_file_output_thread_running = false;
+static bool s_file_output_thread_done = false;
+
+namespace {
+// Joins the sink thread at process exit for hosts which never turn file logging back off (e.g. the
+// updater). Declared after the queue/thread statics so it is destroyed before them.
+struct FileOutputThreadStopper
+{
+  ~FileOutputThreadStopper() { StopFileOutputThread(); }
+};
+} // namespace
+static FileOutputThreadStopper s_file_output_thread_stopper;
+
 void RegisterCallback(CallbackFunctionType callbackFunction, void* pUserParam)
 {
   RegisteredCallback Callback;
@@ -103,7 +140,7 @@ static void ExecuteCallbacks(const char* channelName, const char* functionName,
 
 static int FormatLogMessageForDisplay(char* buffer, size_t buffer_size, const char* channelName,
                                       const char* functionName, LOGLEVEL level, const char* message, bool timestamp,
-                                      bool ansi_color_code, bool newline)
+                                      bool ansi_color_code, bool newline, Common::Timer::Value timestamp_value)
 {
   static const char* s_ansi_color_codes[LOGLEVEL_COUNT] = {
     "\033[0m",    // NONE
@@ -126,7 +163,7 @@ static int FormatLogMessageForDisplay(char* buffer, size_t buffer_size, const ch
   {
     // find time since start of process
     const float message_time =
-      static_cast<float>(Common::Timer::ConvertValueToSeconds(Common::Timer::GetCurrentValue() - s_startTimeStamp));
+      static_cast<float>(Common::Timer::ConvertValueToSeconds(timestamp_value - s_startTimeStamp));
 
     if (level <= LOGLEVEL_PERF)
     {
@@ -157,18 +194,19 @@ static int FormatLogMessageForDisplay(char* buffer, size_t buffer_size, const ch
 template<typename T>
 static ALWAYS_INLINE void FormatLogMessageAndPrint(const char* channelName, const char* functionName, LOGLEVEL level,
                                                    const char* message, bool timestamp, bool ansi_color_code,
-                                                   bool newline, const T& callback)
+                                                   bool newline, Common::Timer::Value timestamp_value,
+                                                   const T& callback)
 {
   char buf[512];
   char* message_buf = buf;
   int message_len;
   if ((message_len = FormatLogMessageForDisplay(message_buf, sizeof(buf), channelName, functionName, level, message,
-                                                timestamp, ansi_color_code, newline)) >
+                                                timestamp, ansi_color_code, newline, timestamp_value)) >
       static_cast<int>(sizeof(buf) - 1))
   {
     message_buf = static_cast<char*>(std::malloc(message_len + 1));
     message_len = FormatLogMessageForDisplay(message_buf, message_len + 1, channelName, functionName, level, message,
-                                             timestamp, ansi_color_code, newline);
+                                             timestamp, ansi_color_code, newline, timestamp_value);
   }
 
   callback(message_buf, message_len);
@@ -182,18 +220,19 @@ static ALWAYS_INLINE void FormatLogMessageAndPrint(const char* channelName, cons
 template<typename T>
 static ALWAYS_INLINE void FormatLogMessageAndPrintW(const char* channelName, const char* functionName, LOGLEVEL level,
                                                     const char* message, bool timestamp, bool ansi_color_code,
-                                                    bool newline, const T& callback)
+                                                    bool newline, Common::Timer::Value timestamp_value,
+                                                    const T& callback)
 {
   char buf[512];
   char* message_buf = buf;
   int message_len;
   if ((message_len = FormatLogMessageForDisplay(message_buf, sizeof(buf), channelName, functionName, level, message,
-                                                timestamp, ansi_color_code, newline)) >
+                                                timestamp, ansi_color_code, newline, timestamp_value)) >
       static_cast<int>(sizeof(buf) - 1))
   {
     message_buf = static_cast<char*>(std::malloc(message_len + 1));
     message_len = FormatLogMessageForDisplay(message_buf, message_len + 1, channelName, functionName, level, message,
-                                             timestamp, ansi_color_code, newline);
+                                             timestamp, ansi_color_code, newline, timestamp_value);
   }
   if (message_len <= 0)
     return;
@@ -249,14 +288,14 @@ static void ConsoleOutputLogCallback(void* pUserParam, const char* channelName,
 
 #if defined(_WIN32)
   FormatLogMessageAndPrintW(channelName, functionName, level, message, true, true, true,
-                            [level](const wchar_t* message, int message_len) {
+                            Common::Timer::GetCurrentValue(), [level](const wchar_t* message, int message_len) {
                               HANDLE hOutput = (level <= LOGLEVEL_WARNING) ? s_hConsoleStdErr : s_hConsoleStdOut;
                               DWORD chars_written;
                               WriteConsoleW(hOutput, message, message_len, &chars_written, nullptr);
                             });
 #elif !defined(__ANDROID__)
   FormatLogMessageAndPrint(channelName, functionName, level, message, true, true, true,
-                           [level](const char* message, int message_len) {
+                           Common::Timer::GetCurrentValue(), [level](const char* message, int message_len) {
                              const int outputFd = (level <= LOGLEVEL_WARNING) ? STDERR_FILENO : STDOUT_FILENO;
                              write(outputFd, message, message_len);
                            });
@@ -274,6 +313,7 @@ static void DebugOutputLogCallback(void* pUserParam, const char* channelName, co
 
 #if defined(_WIN32)
   FormatLogMessageAndPrintW(channelName, functionName, level, message, true, false, true,
+                            Common::Timer::GetCurrentValue(),
                             [](const wchar_t* message, int message_len) { OutputDebugStringW(message); });
 #elif defined(__ANDROID__)
   static const int logPriority[LOGLEVEL_COUNT] = {
@@ -396,9 +436,71 @@ static void FileOutputLogCallback(void* pUserParam, const char* channelName, con
   if (level > s_file_output_level_filter || s_file_output_channel_filter.Find(channelName) >= 0)
     return;
 
-  FormatLogMessageAndPrint(
-    channelName, functionName, level, message, true, false, true,
-    [](const char* message, int message_len) { std::fwrite(message, 1, message_len, s_fileOutputHandle.get()); });
+  // The calling thread only pays for the message copy and a short lock; formatting and the write
+  // happen on the sink thread. The timestamp is captured here so the log reflects when the message
+  // was generated, not when it was flushed.
+  {
+    std::unique_lock lock(s_file_output_queue_mutex);
+    s_file_output_queue.push_back(
+      AsyncLogRecord{channelName, functionName, level, Common::Timer::GetCurrentValue(), message});
+  }
+  s_file_output_queue_cv.notify_one();
+}
+
+static void FileOutputThreadProc()
+{
+  std::deque<AsyncLogRecord> batch;
+  std::unique_lock lock(s_file_output_queue_mutex);
+  for (;;)
+  {
+    s_file_output_queue_cv.wait(lock, []() { return (!s_file_output_queue.empty() || s_file_output_thread_done); });
+    if (s_file_output_queue.empty())
+    {
+      if (s_file_output_thread_done)
+        break;
+
+      continue;
+    }
+
+    batch.swap(s_file_output_queue);
+    lock.unlock();
+
+    for (const AsyncLogRecord& record : batch)
+    {
+      FormatLogMessageAndPrint(record.channel, record.function, record.level, record.message.c_str(), true, false, true,
+                               record.timestamp, [](const char* message, int message_len) {
+                                 std::fwrite(message, 1, message_len, s_fileOutputHandle.get());
+                               });
+    }
+    std::fflush(s_fileOutputHandle.get());
+    batch.clear();
+
+    lock.lock();
+  }
+}
+
+static void StartFileOutputThread()
+{
+  if (s_file_output_thread_running)
+    return;
+
+  s_file_output_thread_done = false;
+  s_file_output_thread.Start(FileOutputThreadProc);
+  s_file_output_thread_running = true;
+}
+
+static void StopFileOutputThread()
+{
+  if (!s_file_output_thread_running)
+    return;
+
+  {
+    std::unique_lock lock(s_file_output_queue_mutex);
+    s_file_output_thread_done = true;
+  }
+  s_file_output_queue_cv.notify_one();
+  s_file_output_thread.Join();
+  s_file_output_thread_running = false;
 }
 
 void SetFileOutputParams(bool enabled, const char* filename, bool timestamps /* = true */,
@@ -415,11 +517,15 @@ void SetFileOutputParams(bool enabled, const char* filename, bool timestamps /*
         return;
       }
 
+      StartFileOutputThread();
       RegisterCallback(FileOutputLogCallback, nullptr);
     }
     else
     {
       UnregisterCallback(FileOutputLogCallback, nullptr);
+
+      // Drain anything still queued before the file goes away.
+      StopFileOutputThread();
       s_fileOutputHandle.reset();
     }
 
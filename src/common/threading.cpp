@@ -3,6 +3,9 @@
 
 #include "threading.h"
 #include "assert.h"
+#include "platform.h"
+#include "thirdparty/thread_pool.h"
+#include <algorithm>
 #include <memory>
 
 #if !defined(_WIN32) && !defined(__APPLE__)
@@ -20,6 +23,7 @@
 #if defined(__linux__)
 #include <sched.h>
 #include <sys/prctl.h>
+#include <sys/resource.h>
 #include <sys/types.h>
 
 // glibc < v2.30 doesn't define gettid...
@@ -270,6 +274,147 @@ bool Threading::ThreadHandle::SetAffinity(u64 processor_mask) const
 #endif
 }
 
+
+bool Threading::ThreadHandle::SetPriority(int priority) const
+{
+#if defined(_WIN32)
+  int value;
+  if (priority >= 2)
+    value = THREAD_PRIORITY_TIME_CRITICAL;
+  else if (priority == 1)
+    value = THREAD_PRIORITY_HIGHEST;
+  else
+    value = THREAD_PRIORITY_NORMAL;
+
+  return (SetThreadPriority((HANDLE)m_native_handle, value) != FALSE);
+#elif defined(__linux__)
+  if (priority >= 2)
+  {
+    // Realtime needs CAP_SYS_NICE or a suitable rtprio rlimit; fall back to a raised nice value
+    // when it isn't granted.
+    struct sched_param param = {};
+    param.sched_priority = sched_get_priority_min(SCHED_FIFO);
+    if (sched_setscheduler((pid_t)m_native_id, SCHED_FIFO, &param) == 0)
+      return true;
+  }
+
+  struct sched_param param = {};
+  if (sched_setscheduler((pid_t)m_native_id, SCHED_OTHER, &param) != 0)
+    return false;
+
+  return (setpriority(PRIO_PROCESS, (id_t)m_native_id, (priority > 0) ? -10 : 0) == 0);
+#else
+  return false;
+#endif
+}
+
+#if defined(CPU_X64) || defined(CPU_X86)
+
+static void ReadCPUID(u32 leaf, u32 subleaf, u32 regs[4])
+{
+#ifdef _MSC_VER
+  __cpuidex(reinterpret_cast<int*>(regs), static_cast<int>(leaf), static_cast<int>(subleaf));
+#else
+  asm volatile("cpuid" : "=a"(regs[0]), "=b"(regs[1]), "=c"(regs[2]), "=d"(regs[3]) : "a"(leaf), "c"(subleaf));
+#endif
+}
+
+#endif
+
+u64 Threading::GetPerformanceCoreMask()
+{
+  static u64 s_cached_mask = 0;
+  static bool s_cached = false;
+  if (s_cached)
+    return s_cached_mask;
+
+  u64 mask = 0;
+
+#if defined(CPU_X64) || defined(CPU_X86)
+  // CPUID.07H:EDX[15] is the hybrid flag; CPUID.1AH describes the core type, but only for the
+  // processor the instruction executes on, so each one has to be probed with the thread pinned
+  // to it.
+  u32 regs[4];
+  ReadCPUID(0, 0, regs);
+  const u32 max_leaf = regs[0];
+  bool hybrid = false;
+  if (max_leaf >= 0x7)
+  {
+    ReadCPUID(0x7, 0, regs);
+    hybrid = ((regs[3] >> 15) & 1u) != 0;
+  }
+
+  if (hybrid && max_leaf >= 0x1A)
+  {
+#if defined(_WIN32)
+    DWORD_PTR process_mask, system_mask;
+    if (GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask))
+    {
+      const u64 probe_set = static_cast<u64>(process_mask);
+      DWORD_PTR old_mask = 0;
+      u64 probed = 0;
+      for (u32 i = 0; i < 64; i++)
+      {
+        const u64 bit = (static_cast<u64>(1) << i);
+        if (!(probe_set & bit))
+          continue;
+
+        const DWORD_PTR prev = SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(bit));
+        if (prev == 0)
+          continue;
+        if (old_mask == 0)
+          old_mask = prev;
+
+        probed |= bit;
+        ReadCPUID(0x1A, 0, regs);
+        if ((regs[0] >> 24) == 0x40) // Core (performance)
+          mask |= bit;
+      }
+
+      if (old_mask != 0)
+        SetThreadAffinityMask(GetCurrentThread(), old_mask);
+
+      // A mask covering everything (or nothing) means there's no preference to express.
+      if (mask == probed)
+        mask = 0;
+    }
+#elif defined(__linux__)
+    cpu_set_t old_set;
+    if (sched_getaffinity(0, sizeof(old_set), &old_set) == 0)
+    {
+      const long num_processors = std::min<long>(sysconf(_SC_NPROCESSORS_CONF), 64);
+      u64 probed = 0;
+      for (long i = 0; i < num_processors; i++)
+      {
+        if (!CPU_ISSET(i, &old_set))
+          continue;
+
+        cpu_set_t probe_set;
+        CPU_ZERO(&probe_set);
+        CPU_SET(i, &probe_set);
+        if (sched_setaffinity(0, sizeof(probe_set), &probe_set) != 0)
+          continue;
+
+        probed |= (static_cast<u64>(1) << i);
+        ReadCPUID(0x1A, 0, regs);
+        if ((regs[0] >> 24) == 0x40) // Core (performance)
+          mask |= (static_cast<u64>(1) << i);
+      }
+
+      sched_setaffinity(0, sizeof(old_set), &old_set);
+
+      if (mask == probed)
+        mask = 0;
+    }
+#endif
+  }
+#endif
+
+  s_cached_mask = mask;
+  s_cached = true;
+  return mask;
+}
+
 Threading::Thread::Thread() = default;
 
 Threading::Thread::Thread(Thread&& thread) : ThreadHandle(thread), m_stack_size(thread.m_stack_size)
@@ -617,3 +762,11 @@ bool Threading::KernelSemaphore::TryWait()
   return sem_trywait(&m_sema) == 0;
 #endif
 }
+
+cb::ThreadPool& Threading::GetSharedThreadPool()
+{
+  // Lazily created so processes which never schedule work (e.g. the updater) don't spawn workers;
+  // the destructor joins them at exit after draining any outstanding tasks.
+  static cb::ThreadPool s_shared_pool(static_cast<int>(std::max(cb::ThreadPool::GetNumLogicalCores(), 1u)));
+  return s_shared_pool;
+}
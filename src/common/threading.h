@@ -13,6 +13,10 @@
 #include <atomic>
 #include <functional>
 
+namespace cb {
+class ThreadPool;
+}
+
 namespace Threading {
 extern u64 GetThreadCpuTime();
 extern u64 GetThreadTicksPerSecond();
@@ -23,6 +27,11 @@ extern void SetNameOfCurrentThread(const char* name);
 // Releases a timeslice to other threads.
 extern void Timeslice();
 
+/// Returns an affinity mask covering the performance cores on hybrid x86 parts (Alder-Lake-class
+/// P/E topologies, detected via the CPUID hybrid leaf), or 0 when the topology is uniform or
+/// unknown. The first call briefly pins the calling thread to each processor to probe it.
+extern u64 GetPerformanceCoreMask();
+
 // --------------------------------------------------------------------------------------
 //  ThreadHandle
 // --------------------------------------------------------------------------------------
@@ -53,6 +62,11 @@ public:
   /// Obviously, only works up to 64 processors.
   bool SetAffinity(u64 processor_mask) const;
 
+  /// Adjusts the scheduling priority of the thread. 0 restores the OS default, 1 raises the
+  /// thread above normal, and 2 requests realtime scheduling where the platform and the process's
+  /// permissions allow it (falling back to 1 otherwise).
+  bool SetPriority(int priority) const;
+
 protected:
   void* m_native_handle = nullptr;
 
@@ -121,4 +135,11 @@ public:
   bool TryWait();
 };
 
+/// Returns a process-wide thread pool, created on first use and sized to the number of logical
+/// cores. Use this for short-lived CPU-bound tasks instead of spawning per-subsystem workers, so
+/// concurrent subsystems share one right-sized worker set rather than oversubscribing cores.
+/// Tasks that block for long periods (prefetch, network I/O) should keep their own thread or pool,
+/// as they would starve everyone else's work.
+cb::ThreadPool& GetSharedThreadPool();
+
 } // namespace Threading
\ No newline at end of file
@@ -19,6 +19,8 @@
 #include "common/path.h"
 #include "common/platform.h"
 #include "common/string_util.h"
+#include "common/threading.h"
+#include "common/thirdparty/thread_pool.h"
 
 #include "util/cd_image.h"
 #include "util/imgui_fullscreen.h"
@@ -40,6 +42,7 @@
 #include <cstdlib>
 #include <ctime>
 #include <functional>
+#include <future>
 #include <string>
 #include <vector>
 
@@ -66,11 +69,26 @@ static constexpr const char* INFO_SOUND_NAME = "sounds/achievements/message.wav"
 static constexpr const char* UNLOCK_SOUND_NAME = "sounds/achievements/unlock.wav";
 static constexpr const char* LBSUBMIT_SOUND_NAME = "sounds/achievements/lbsubmit.wav";
 
+// Guest memory snapshot consumed by the worker-thread runtime evaluation. Indirect conditions
+// compute addresses at evaluation time, so the whole of RAM has to be captured rather than just
+// the activated address set.
+struct MemorySnapshot
+{
+  std::unique_ptr<u8[]> ram;
+  u32 ram_size = 0;
+  std::array<u8, CPU::DCACHE_SIZE> scratchpad;
+};
+
 static void FormattedError(const char* format, ...);
 static void LogFailedResponseJSON(const Common::HTTPDownloader::Request::Data& data);
 static void EnsureCacheDirectoriesExist();
 static void CheevosEventHandler(const rc_runtime_event_t* runtime_event);
+static void QueueCheevosEvent(const rc_runtime_event_t* runtime_event);
 static unsigned PeekMemory(unsigned address, unsigned num_bytes, void* ud);
+static unsigned PeekSnapshotMemory(unsigned address, unsigned num_bytes, void* ud);
+static void CaptureMemorySnapshot(MemorySnapshot* snapshot);
+static void EvaluateFrame(const MemorySnapshot* snapshot);
+static void FlushFrameEvaluation();
 static bool IsMastered();
 static void ActivateLockedAchievements();
 static bool ActivateAchievement(Achievement* achievement);
@@ -81,7 +99,7 @@ static void AchievementUnprimed(u32 achievement_id);
 static void SubmitLeaderboard(u32 leaderboard_id, int value);
 static void SendPing();
 static void SendPlaying();
-static void UpdateRichPresence();
+static void UpdateRichPresence(const MemorySnapshot* snapshot);
 static Achievement* GetMutableAchievementByID(u32 id);
 static void ClearGameInfo(bool clear_achievements = true, bool clear_leaderboards = true);
 static void ClearGameHash();
@@ -104,7 +122,7 @@ static void SetChallengeMode(bool enabled);
 static void SendGetGameId();
 static void GetGameIdCallback(s32 status_code, std::string content_type, Common::HTTPDownloader::Request::Data data);
 static void SendPlayingCallback(s32 status_code, std::string content_type, Common::HTTPDownloader::Request::Data data);
-static void UpdateRichPresence();
+static void UpdateRichPresence(const MemorySnapshot* snapshot);
 static void SendPingCallback(s32 status_code, std::string content_type, Common::HTTPDownloader::Request::Data data);
 static void UnlockAchievementCallback(s32 status_code, std::string content_type,
                                       Common::HTTPDownloader::Request::Data data);
@@ -122,6 +140,15 @@ static bool s_using_raintegration = false;
 
 static std::recursive_mutex s_achievements_mutex;
 static rc_runtime_t s_rcheevos_runtime;
+
+// Worker-thread frame evaluation. The emulation thread copies guest memory into the snapshot the
+// worker isn't reading each frame and schedules the evaluation on the shared thread pool. At most
+// one evaluation is in flight at any time, so frames are consumed in order; events are marshaled
+// back to the CPU thread. s_queued_runtime_events is only touched by the in-flight evaluation.
+static std::array<MemorySnapshot, 2> s_memory_snapshots;
+static u32 s_next_snapshot_index = 0;
+static std::future<void> s_pending_frame_evaluation;
+static std::vector<rc_runtime_event_t> s_queued_runtime_events;
 static std::string s_game_icon_cache_directory;
 static std::string s_achievement_icon_cache_directory;
 static std::unique_ptr<Common::HTTPDownloader> s_http_downloader;
@@ -620,6 +647,8 @@ bool Achievements::Shutdown()
   if (!s_active)
     return true;
 
+  FlushFrameEvaluation();
+
   std::unique_lock lock(s_achievements_mutex);
   s_http_downloader->WaitForAllRequests();
 
@@ -661,6 +690,9 @@ void Achievements::ResetRuntime()
   if (!s_active)
     return;
 
+  // An in-flight evaluation of the pre-reset frame shouldn't land on the freshly-reset runtime.
+  FlushFrameEvaluation();
+
   std::unique_lock lock(s_achievements_mutex);
   Log_DevPrint("Resetting rcheevos state...");
   rc_runtime_reset(&s_rcheevos_runtime);
@@ -691,10 +723,59 @@ void Achievements::FrameUpdate()
 
   if (HasActiveGame())
   {
-    std::unique_lock lock(s_achievements_mutex);
-    rc_runtime_do_frame(&s_rcheevos_runtime, &CheevosEventHandler, &PeekMemory, nullptr, nullptr);
-    UpdateRichPresence();
+    // Capture into the snapshot the worker isn't reading, wait out any still-running evaluation
+    // (normally long finished), then hand the new frame off.
+    MemorySnapshot& snapshot = s_memory_snapshots[s_next_snapshot_index];
+    s_next_snapshot_index ^= 1u;
+    CaptureMemorySnapshot(&snapshot);
+    FlushFrameEvaluation();
+    s_pending_frame_evaluation = Threading::GetSharedThreadPool().ScheduleAndGetFuture(&EvaluateFrame, &snapshot);
+  }
+}
+
+void Achievements::CaptureMemorySnapshot(MemorySnapshot* snapshot)
+{
+  if (!snapshot->ram || snapshot->ram_size != Bus::g_ram_size)
+  {
+    snapshot->ram = std::make_unique<u8[]>(Bus::g_ram_size);
+    snapshot->ram_size = Bus::g_ram_size;
   }
+
+  std::memcpy(snapshot->ram.get(), Bus::g_ram, Bus::g_ram_size);
+  std::memcpy(snapshot->scratchpad.data(), CPU::g_state.dcache.data(), CPU::DCACHE_SIZE);
+}
+
+void Achievements::EvaluateFrame(const MemorySnapshot* snapshot)
+{
+  std::unique_lock lock(s_achievements_mutex);
+  if (!s_active || !HasActiveGame())
+    return;
+
+  rc_runtime_do_frame(&s_rcheevos_runtime, &QueueCheevosEvent, &PeekSnapshotMemory,
+                      const_cast<MemorySnapshot*>(snapshot), nullptr);
+  UpdateRichPresence(snapshot);
+
+  if (!s_queued_runtime_events.empty())
+  {
+    // Unlocks, submissions and the attendant OSD/server traffic happen on the CPU thread, same as
+    // they always have.
+    Host::RunOnCPUThread([events = std::move(s_queued_runtime_events)]() {
+      for (const rc_runtime_event_t& evt : events)
+        CheevosEventHandler(&evt);
+    });
+    s_queued_runtime_events = {};
+  }
+}
+
+void Achievements::QueueCheevosEvent(const rc_runtime_event_t* runtime_event)
+{
+  s_queued_runtime_events.push_back(*runtime_event);
+}
+
+void Achievements::FlushFrameEvaluation()
+{
+  if (s_pending_frame_evaluation.valid())
+    s_pending_frame_evaluation.get();
 }
 
 void Achievements::ProcessPendingHTTPRequests()
@@ -731,6 +812,9 @@ bool Achievements::DoState(StateWrapper& sw)
     return !sw.HasError();
   }
 
+  // Don't let an in-flight evaluation interleave with (de)serializing the runtime.
+  FlushFrameEvaluation();
+
   std::unique_lock lock(s_achievements_mutex);
 
   if (sw.IsReading())
@@ -1079,7 +1163,7 @@ void Achievements::GetUserUnlocksCallback(s32 status_code, std::string content_t
   ActivateLockedAchievements();
   DisplayAchievementSummary();
   SendPlaying();
-  UpdateRichPresence();
+  UpdateRichPresence(nullptr);
   SendPing();
   Host::OnAchievementsRefreshed();
 }
@@ -1493,14 +1577,17 @@ void Achievements::SendPlaying()
   request.Send(SendPlayingCallback);
 }
 
-void Achievements::UpdateRichPresence()
+void Achievements::UpdateRichPresence(const MemorySnapshot* snapshot)
 {
   if (!s_has_rich_presence)
     return;
 
   char buffer[512];
-  const int res =
-    rc_runtime_get_richpresence(&s_rcheevos_runtime, buffer, sizeof(buffer), PeekMemory, nullptr, nullptr);
+  const int res = snapshot ? rc_runtime_get_richpresence(&s_rcheevos_runtime, buffer, sizeof(buffer),
+                                                         PeekSnapshotMemory, const_cast<MemorySnapshot*>(snapshot),
+                                                         nullptr) :
+                             rc_runtime_get_richpresence(&s_rcheevos_runtime, buffer, sizeof(buffer), PeekMemory,
+                                                         nullptr, nullptr);
   if (res <= 0)
   {
     const bool had_rich_presence = !s_rich_presence_string.empty();
@@ -2022,6 +2109,36 @@ unsigned Achievements::PeekMemory(unsigned address, unsigned num_bytes, void* ud
   }
 }
 
+// Mirrors the address decoding of the safe memory access path, against the captured snapshot.
+// BIOS is immutable once loaded, so it's read directly rather than captured.
+static u8 PeekSnapshotByte(const Achievements::MemorySnapshot* snapshot, u32 address)
+{
+  const u32 segment = (address >> 29);
+  if (segment != 0 && segment != 4 && segment != 5)
+    return 0;
+
+  const u32 phys = (address & CPU::PHYSICAL_MEMORY_ADDRESS_MASK);
+  if (segment != 5 && (phys & CPU::DCACHE_LOCATION_MASK) == CPU::DCACHE_LOCATION)
+    return snapshot->scratchpad[phys & CPU::DCACHE_OFFSET_MASK];
+  else if (phys < Bus::RAM_MIRROR_END)
+    return snapshot->ram[phys & (snapshot->ram_size - 1)];
+  else if (phys >= Bus::BIOS_BASE && phys < (Bus::BIOS_BASE + Bus::BIOS_SIZE))
+    return Bus::g_bios[phys - Bus::BIOS_BASE];
+  else
+    return 0;
+}
+
+unsigned Achievements::PeekSnapshotMemory(unsigned address, unsigned num_bytes, void* ud)
+{
+  const MemorySnapshot* snapshot = static_cast<const MemorySnapshot*>(ud);
+
+  unsigned value = 0;
+  for (unsigned i = 0; i < num_bytes; i++)
+    value |= ZeroExtend32(PeekSnapshotByte(snapshot, address + i)) << (i * 8);
+
+  return value;
+}
+
 #ifdef WITH_RAINTEGRATION
 
 #include "RA_Consoles.h"
@@ -112,81 +112,19 @@ void AnalogJoystick::SetBindState(u32 index, float value)
 
     m_half_axis_state[sub_index] = u8_value;
 
-#define MERGE(pos, neg)                                                                                                \
-  ((m_half_axis_state[static_cast<u32>(pos)] != 0) ? (127u + ((m_half_axis_state[static_cast<u32>(pos)] + 1u) / 2u)) : \
-                                                     (127u - (m_half_axis_state[static_cast<u32>(neg)] / 2u)))
-
-    switch (static_cast<HalfAxis>(sub_index))
+    // Re-derive both bytes of the affected stick in one pass, so leaving the deadzone also
+    // restores the other axis of the pair.
+    if (static_cast<HalfAxis>(sub_index) < HalfAxis::RLeft)
     {
-      case HalfAxis::LLeft:
-      case HalfAxis::LRight:
-        m_axis_state[static_cast<u8>(Axis::LeftX)] = ((m_invert_left_stick & 1u) != 0u) ?
-                                                       MERGE(HalfAxis::LLeft, HalfAxis::LRight) :
-                                                       MERGE(HalfAxis::LRight, HalfAxis::LLeft);
-        break;
-
-      case HalfAxis::LDown:
-      case HalfAxis::LUp:
-        m_axis_state[static_cast<u8>(Axis::LeftY)] = ((m_invert_left_stick & 2u) != 0u) ?
-                                                       MERGE(HalfAxis::LUp, HalfAxis::LDown) :
-                                                       MERGE(HalfAxis::LDown, HalfAxis::LUp);
-        break;
-
-      case HalfAxis::RLeft:
-      case HalfAxis::RRight:
-        m_axis_state[static_cast<u8>(Axis::RightX)] = ((m_invert_right_stick & 1u) != 0u) ?
-                                                        MERGE(HalfAxis::RLeft, HalfAxis::RRight) :
-                                                        MERGE(HalfAxis::RRight, HalfAxis::RLeft);
-        break;
-
-      case HalfAxis::RDown:
-      case HalfAxis::RUp:
-        m_axis_state[static_cast<u8>(Axis::RightY)] = ((m_invert_right_stick & 2u) != 0u) ?
-                                                        MERGE(HalfAxis::RUp, HalfAxis::RDown) :
-                                                        MERGE(HalfAxis::RDown, HalfAxis::RUp);
-        break;
-
-      default:
-        break;
+      ProcessStickAxes(&m_half_axis_state[static_cast<u32>(HalfAxis::LLeft)], m_invert_left_stick, m_analog_deadzone,
+                       &m_axis_state[static_cast<u8>(Axis::LeftX)], &m_axis_state[static_cast<u8>(Axis::LeftY)]);
     }
-
-    if (m_analog_deadzone > 0.0f)
+    else
     {
-#define MERGE_F(pos, neg)                                                                                              \
-  ((m_half_axis_state[static_cast<u32>(pos)] != 0) ?                                                                   \
-     (static_cast<float>(m_half_axis_state[static_cast<u32>(pos)]) / 255.0f) :                                         \
-     (static_cast<float>(m_half_axis_state[static_cast<u32>(neg)]) / -255.0f))
-
-      float pos_x, pos_y;
-      if (static_cast<HalfAxis>(sub_index) < HalfAxis::RLeft)
-      {
-        pos_x = ((m_invert_left_stick & 1u) != 0u) ? MERGE_F(HalfAxis::LLeft, HalfAxis::LRight) :
-                                                     MERGE_F(HalfAxis::LRight, HalfAxis::LLeft);
-        pos_y = ((m_invert_left_stick & 2u) != 0u) ? MERGE_F(HalfAxis::LUp, HalfAxis::LDown) :
-                                                     MERGE_F(HalfAxis::LDown, HalfAxis::LUp);
-      }
-      else
-      {
-        pos_x = ((m_invert_right_stick & 1u) != 0u) ? MERGE_F(HalfAxis::RLeft, HalfAxis::RRight) :
-                                                      MERGE_F(HalfAxis::RRight, HalfAxis::RLeft);
-        ;
-        pos_y = ((m_invert_right_stick & 2u) != 0u) ? MERGE_F(HalfAxis::RUp, HalfAxis::RDown) :
-                                                      MERGE_F(HalfAxis::RDown, HalfAxis::RUp);
-      }
-
-      if (InCircularDeadzone(m_analog_deadzone, pos_x, pos_y))
-      {
-        // Set to 127 (center).
-        if (static_cast<HalfAxis>(sub_index) < HalfAxis::RLeft)
-          m_axis_state[static_cast<u8>(Axis::LeftX)] = m_axis_state[static_cast<u8>(Axis::LeftY)] = 127;
-        else
-          m_axis_state[static_cast<u8>(Axis::RightX)] = m_axis_state[static_cast<u8>(Axis::RightY)] = 127;
-      }
-#undef MERGE_F
+      ProcessStickAxes(&m_half_axis_state[static_cast<u32>(HalfAxis::RLeft)], m_invert_right_stick, m_analog_deadzone,
+                       &m_axis_state[static_cast<u8>(Axis::RightX)], &m_axis_state[static_cast<u8>(Axis::RightY)]);
     }
 
-#undef MERGE
-
     return;
   }
 
@@ -5,6 +5,7 @@
 #include "cdrom.h"
 #include "common/align.h"
 #include "common/assert.h"
+#include "common/file_system.h"
 #include "common/log.h"
 #include "common/make_array.h"
 #include "cpu_code_cache.h"
@@ -14,6 +15,7 @@
 #include "dma.h"
 #include "gpu.h"
 #include "host.h"
+#include "imgui.h"
 #include "interrupt_controller.h"
 #include "mdec.h"
 #include "pad.h"
@@ -23,7 +25,9 @@
 #include "system.h"
 #include "timers.h"
 #include "timing_event.h"
+#include "util/imgui_manager.h"
 #include "util/state_wrapper.h"
+#include <cinttypes>
 #include <cstdio>
 #include <tuple>
 #include <utility>
@@ -78,6 +82,7 @@ union MEMCTRL
 };
 
 std::bitset<RAM_8MB_CODE_PAGE_COUNT> m_ram_code_bits{};
+static std::bitset<RAM_8MB_CODE_PAGE_COUNT> m_ram_watched_bits{};
 u32 m_ram_code_page_count = 0;
 u8* g_ram = nullptr; // 2MB RAM
 u32 g_ram_size = 0;
@@ -155,6 +160,7 @@ bool Initialize()
     return false;
   }
 
+  ResetMMIOProfilerStats();
   Reset();
   return true;
 }
@@ -318,7 +324,11 @@ void RecalculateMemoryTimings()
 
 bool AllocateMemory(bool enable_8mb_ram)
 {
-  if (!m_memory_arena.Create(MEMORY_ARENA_SIZE, true, false))
+  // Request huge page backing for the arena - the fastmem RAM mirrors alone map the same 2-8MB
+  // eleven times, so collapsing them to 2MB pages takes real pressure off the dTLB. Pages are
+  // faulted in by the emulation thread (Reset() zeroes RAM), so first-touch places them on the
+  // node the CPU thread runs on.
+  if (!m_memory_arena.Create(MEMORY_ARENA_SIZE, true, false, true))
   {
     Log_ErrorPrint("Failed to create memory arena");
     return false;
@@ -370,8 +380,13 @@ static ALWAYS_INLINE u32 FastmemAddressToLUTPageIndex(u32 address)
 
 static ALWAYS_INLINE_RELEASE void SetLUTFastmemPage(u32 address, u8* ptr, bool writable)
 {
+#ifdef CPU_AARCH32
   m_fastmem_lut[FastmemAddressToLUTPageIndex(address)] = ptr;
   m_fastmem_lut[FASTMEM_LUT_NUM_PAGES + FastmemAddressToLUTPageIndex(address)] = writable ? ptr : nullptr;
+#else
+  m_fastmem_lut[FastmemAddressToLUTPageIndex(address)] = reinterpret_cast<u8*>(
+    reinterpret_cast<uintptr_t>(ptr) | (writable ? 0 : static_cast<uintptr_t>(FASTMEM_LUT_WRITE_PROTECT_MASK)));
+#endif
 }
 
 CPUFastmemMode GetFastmemMode()
@@ -438,10 +453,10 @@ void UpdateFastmemViews(CPUFastmemMode mode)
         return;
       }
 
-      // mark all pages with code as non-writable
+      // mark all pages with code or watchpoints as non-writable
       for (u32 i = 0; i < m_ram_code_page_count; i++)
       {
-        if (m_ram_code_bits[i])
+        if (m_ram_code_bits[i] || m_ram_watched_bits[i])
         {
           u8* page_address = map_address + (i * HOST_PAGE_SIZE);
           if (!m_memory_arena.SetPageProtection(page_address, HOST_PAGE_SIZE, true, false, false))
@@ -503,8 +518,9 @@ void UpdateFastmemViews(CPUFastmemMode mode)
   auto MapRAM = [](u32 base_address) {
     for (u32 address = 0; address < g_ram_size; address += HOST_PAGE_SIZE)
     {
+      const u32 page_index = FastmemAddressToLUTPageIndex(address);
       SetLUTFastmemPage(base_address + address, &g_ram[address],
-                        !m_ram_code_bits[FastmemAddressToLUTPageIndex(address)]);
+                        !m_ram_code_bits[page_index] && !m_ram_watched_bits[page_index]);
     }
   };
 
@@ -571,9 +587,9 @@ void ClearRAMCodePage(u32 index)
   if (!m_ram_code_bits[index])
     return;
 
-  // unprotect fastmem pages
+  // unprotect fastmem pages, unless a watchpoint still needs the page protected
   m_ram_code_bits[index] = false;
-  SetCodePageFastmemProtection(index, true);
+  SetCodePageFastmemProtection(index, !m_ram_watched_bits[index]);
 }
 
 void SetCodePageFastmemProtection(u32 page_index, bool writable)
@@ -632,6 +648,51 @@ void ClearRAMCodePageFlags()
         SetLUTFastmemPage(mirror_start + addr, &g_ram[addr], true);
     }
   }
+
+  // watched pages have to stay write-protected across a code cache flush
+  for (u32 i = 0; i < m_ram_code_page_count; i++)
+  {
+    if (m_ram_watched_bits[i])
+      SetCodePageFastmemProtection(i, false);
+  }
+}
+
+bool IsRAMWatchedPage(u32 index)
+{
+  return m_ram_watched_bits[index];
+}
+
+void SetRAMWatchedPage(u32 index)
+{
+  if (m_ram_watched_bits[index])
+    return;
+
+  // protect fastmem pages so stores take the slow path; code pages are already protected
+  m_ram_watched_bits[index] = true;
+  if (!m_ram_code_bits[index])
+    SetCodePageFastmemProtection(index, false);
+}
+
+void ClearRAMWatchedPage(u32 index)
+{
+  if (!m_ram_watched_bits[index])
+    return;
+
+  m_ram_watched_bits[index] = false;
+  if (!m_ram_code_bits[index])
+    SetCodePageFastmemProtection(index, true);
+}
+
+void ClearRAMWatchedPageFlags()
+{
+  if (m_ram_watched_bits.none())
+    return;
+
+  for (u32 i = 0; i < m_ram_code_page_count; i++)
+  {
+    if (m_ram_watched_bits[i])
+      ClearRAMWatchedPage(i);
+  }
 }
 
 bool IsCodePageAddress(PhysicalMemoryAddress address)
@@ -890,6 +951,12 @@ ALWAYS_INLINE static TickCount DoRAMAccess(u32 offset, u32& value)
         std::memcpy(&g_ram[offset], &value, sizeof(u32));
       }
     }
+
+    if (m_ram_watched_bits[page_index]) [[unlikely]]
+    {
+      constexpr u32 num_bytes = (size == MemoryAccessSize::Byte) ? 1 : ((size == MemoryAccessSize::HalfWord) ? 2 : 4);
+      CPU::CheckWatchpoints(offset, num_bytes);
+    }
   }
 
   return (type == MemoryAccessType::Read) ? RAM_READ_TICKS : 0;
@@ -1368,6 +1435,106 @@ ALWAYS_INLINE static TickCount DoDMAAccess(u32 offset, u32& value)
   }
 }
 
+static std::array<MMIORegionStats, static_cast<size_t>(MMIORegion::Count)> s_mmio_stats = {};
+
+static constexpr std::array<const char*, static_cast<size_t>(MMIORegion::Count)> s_mmio_region_names = {
+  {"EXP1", "MEMCTRL", "PAD", "SIO", "MEMCTRL2", "IRQ", "DMA", "Timers", "CDROM", "GPU", "MDEC", "SPU", "EXP2",
+   "EXP3"}};
+
+template<MemoryAccessType type>
+ALWAYS_INLINE static TickCount ProfileMMIOAccess(MMIORegion region, TickCount cycles)
+{
+  if (g_settings.debugging.show_bus_profiler)
+  {
+    MMIORegionStats& stats = s_mmio_stats[static_cast<size_t>(region)];
+    if constexpr (type == MemoryAccessType::Read)
+      stats.reads++;
+    else
+      stats.writes++;
+
+    // Cycle count is negative when the access raised an exception.
+    if (cycles > 0)
+      stats.cycles += static_cast<u64>(cycles);
+  }
+
+  return cycles;
+}
+
+const char* GetMMIORegionName(MMIORegion region)
+{
+  return s_mmio_region_names[static_cast<size_t>(region)];
+}
+
+const MMIORegionStats& GetMMIORegionStats(MMIORegion region)
+{
+  return s_mmio_stats[static_cast<size_t>(region)];
+}
+
+void ResetMMIOProfilerStats()
+{
+  s_mmio_stats.fill({});
+}
+
+bool DumpMMIOProfilerStats(const char* filename)
+{
+  auto fp = FileSystem::OpenManagedCFile(filename, "wb");
+  if (!fp)
+    return false;
+
+  std::fprintf(fp.get(), "region,reads,writes,cycles\n");
+  for (u32 i = 0; i < static_cast<u32>(MMIORegion::Count); i++)
+  {
+    const MMIORegionStats& stats = s_mmio_stats[i];
+    std::fprintf(fp.get(), "%s,%" PRIu64 ",%" PRIu64 ",%" PRIu64 "\n", s_mmio_region_names[i], stats.reads,
+                 stats.writes, stats.cycles);
+  }
+
+  return true;
+}
+
+void DrawProfilerStateWindow()
+{
+  static constexpr u32 NUM_COLUMNS = 4;
+  static constexpr std::array<const char*, NUM_COLUMNS> column_names = {{"Region", "Reads", "Writes", "Cycles"}};
+
+  const float framebuffer_scale = Host::GetOSDScale();
+
+  ImGui::SetNextWindowSize(ImVec2(400.0f * framebuffer_scale, 350.0f * framebuffer_scale), ImGuiCond_FirstUseEver);
+  if (!ImGui::Begin("Bus Profiler", nullptr))
+  {
+    ImGui::End();
+    return;
+  }
+
+  if (ImGui::Button("Reset"))
+    ResetMMIOProfilerStats();
+
+  ImGui::Columns(NUM_COLUMNS);
+
+  for (const char* title : column_names)
+  {
+    ImGui::TextUnformatted(title);
+    ImGui::NextColumn();
+  }
+
+  for (u32 i = 0; i < static_cast<u32>(MMIORegion::Count); i++)
+  {
+    const MMIORegionStats& stats = s_mmio_stats[i];
+
+    ImGui::TextUnformatted(s_mmio_region_names[i]);
+    ImGui::NextColumn();
+    ImGui::Text("%" PRIu64, stats.reads);
+    ImGui::NextColumn();
+    ImGui::Text("%" PRIu64, stats.writes);
+    ImGui::NextColumn();
+    ImGui::Text("%" PRIu64, stats.cycles);
+    ImGui::NextColumn();
+  }
+
+  ImGui::Columns(1);
+  ImGui::End();
+}
+
 } // namespace Bus
 
 namespace CPU {
@@ -1658,7 +1825,7 @@ static ALWAYS_INLINE_RELEASE TickCount DoMemoryAccess(VirtualMemoryAddress addre
   }
   else if (address < (EXP1_BASE + EXP1_SIZE))
   {
-    return DoEXP1Access<type, size>(address & EXP1_MASK, value);
+    return ProfileMMIOAccess<type>(MMIORegion::EXP1, DoEXP1Access<type, size>(address & EXP1_MASK, value));
   }
   else if (address < MEMCTRL_BASE)
   {
@@ -1666,31 +1833,34 @@ static ALWAYS_INLINE_RELEASE TickCount DoMemoryAccess(VirtualMemoryAddress addre
   }
   else if (address < (MEMCTRL_BASE + MEMCTRL_SIZE))
   {
-    return DoMemoryControlAccess<type, size>(address & MEMCTRL_MASK, value);
+    return ProfileMMIOAccess<type>(MMIORegion::MemCtrl,
+                                   DoMemoryControlAccess<type, size>(address & MEMCTRL_MASK, value));
   }
   else if (address < (PAD_BASE + PAD_SIZE))
   {
-    return DoPadAccess<type, size>(address & PAD_MASK, value);
+    return ProfileMMIOAccess<type>(MMIORegion::Pad, DoPadAccess<type, size>(address & PAD_MASK, value));
   }
   else if (address < (SIO_BASE + SIO_SIZE))
   {
-    return DoSIOAccess<type, size>(address & SIO_MASK, value);
+    return ProfileMMIOAccess<type>(MMIORegion::SIO, DoSIOAccess<type, size>(address & SIO_MASK, value));
   }
   else if (address < (MEMCTRL2_BASE + MEMCTRL2_SIZE))
   {
-    return DoMemoryControl2Access<type, size>(address & MEMCTRL2_MASK, value);
+    return ProfileMMIOAccess<type>(MMIORegion::MemCtrl2,
+                                   DoMemoryControl2Access<type, size>(address & MEMCTRL2_MASK, value));
   }
   else if (address < (INTERRUPT_CONTROLLER_BASE + INTERRUPT_CONTROLLER_SIZE))
   {
-    return DoAccessInterruptController<type, size>(address & INTERRUPT_CONTROLLER_MASK, value);
+    return ProfileMMIOAccess<type>(MMIORegion::IRQ,
+                                   DoAccessInterruptController<type, size>(address & INTERRUPT_CONTROLLER_MASK, value));
   }
   else if (address < (DMA_BASE + DMA_SIZE))
   {
-    return DoDMAAccess<type, size>(address & DMA_MASK, value);
+    return ProfileMMIOAccess<type>(MMIORegion::DMA, DoDMAAccess<type, size>(address & DMA_MASK, value));
   }
   else if (address < (TIMERS_BASE + TIMERS_SIZE))
   {
-    return DoAccessTimers<type, size>(address & TIMERS_MASK, value);
+    return ProfileMMIOAccess<type>(MMIORegion::Timers, DoAccessTimers<type, size>(address & TIMERS_MASK, value));
   }
   else if (address < CDROM_BASE)
   {
@@ -1698,15 +1868,15 @@ static ALWAYS_INLINE_RELEASE TickCount DoMemoryAccess(VirtualMemoryAddress addre
   }
   else if (address < (CDROM_BASE + GPU_SIZE))
   {
-    return DoCDROMAccess<type, size>(address & CDROM_MASK, value);
+    return ProfileMMIOAccess<type>(MMIORegion::CDROM, DoCDROMAccess<type, size>(address & CDROM_MASK, value));
   }
   else if (address < (GPU_BASE + GPU_SIZE))
   {
-    return DoGPUAccess<type, size>(address & GPU_MASK, value);
+    return ProfileMMIOAccess<type>(MMIORegion::GPU, DoGPUAccess<type, size>(address & GPU_MASK, value));
   }
   else if (address < (MDEC_BASE + MDEC_SIZE))
   {
-    return DoMDECAccess<type, size>(address & MDEC_MASK, value);
+    return ProfileMMIOAccess<type>(MMIORegion::MDEC, DoMDECAccess<type, size>(address & MDEC_MASK, value));
   }
   else if (address < SPU_BASE)
   {
@@ -1714,7 +1884,7 @@ static ALWAYS_INLINE_RELEASE TickCount DoMemoryAccess(VirtualMemoryAddress addre
   }
   else if (address < (SPU_BASE + SPU_SIZE))
   {
-    return DoAccessSPU<type, size>(address & SPU_MASK, value);
+    return ProfileMMIOAccess<type>(MMIORegion::SPU, DoAccessSPU<type, size>(address & SPU_MASK, value));
   }
   else if (address < EXP2_BASE)
   {
@@ -1722,7 +1892,7 @@ static ALWAYS_INLINE_RELEASE TickCount DoMemoryAccess(VirtualMemoryAddress addre
   }
   else if (address < (EXP2_BASE + EXP2_SIZE))
   {
-    return DoEXP2Access<type, size>(address & EXP2_MASK, value);
+    return ProfileMMIOAccess<type>(MMIORegion::EXP2, DoEXP2Access<type, size>(address & EXP2_MASK, value));
   }
   else if (address < EXP3_BASE)
   {
@@ -1730,7 +1900,7 @@ static ALWAYS_INLINE_RELEASE TickCount DoMemoryAccess(VirtualMemoryAddress addre
   }
   else if (address < (EXP3_BASE + EXP3_SIZE))
   {
-    return DoEXP3Access<type>(address & EXP3_MASK, value);
+    return ProfileMMIOAccess<type>(MMIORegion::EXP3, DoEXP3Access<type>(address & EXP3_MASK, value));
   }
   else
   {
@@ -101,9 +101,25 @@ enum : u32
   RAM_8MB_CODE_PAGE_COUNT = (RAM_8MB_SIZE + (HOST_PAGE_SIZE + 1)) / HOST_PAGE_SIZE,
 
   FASTMEM_LUT_NUM_PAGES = 0x100000, // 0x100000000 >> 12
+
+#ifdef CPU_AARCH32
+  // 32-bit hosts can't steal bits from the page pointers, so the LUT keeps separate read/write tables.
   FASTMEM_LUT_NUM_SLOTS = FASTMEM_LUT_NUM_PAGES * 2,
+#else
+  FASTMEM_LUT_NUM_SLOTS = FASTMEM_LUT_NUM_PAGES,
+#endif
 };
 
+#ifndef CPU_AARCH32
+// 64-bit hosts use a single table, with the write-protect flag packed into bit 55 of the entry. A store through a
+// flagged pointer faults (the address is non-canonical on x64, and outside the user address space on AArch64 even
+// with top-byte-ignore), so protected stores hit the usual backpatch path for free, and loads only have to mask the
+// bit out. Bit 55 rather than a low bit because an unaligned store through a low-bit-tagged pointer would silently
+// succeed.
+constexpr u32 FASTMEM_LUT_WRITE_PROTECT_BIT = 55;
+constexpr u64 FASTMEM_LUT_WRITE_PROTECT_MASK = UINT64_C(1) << FASTMEM_LUT_WRITE_PROTECT_BIT;
+#endif
+
 bool Initialize();
 void Shutdown();
 void Reset();
@@ -116,6 +132,45 @@ bool CanUseFastmemForAddress(VirtualMemoryAddress address);
 
 void SetExpansionROM(std::vector<u8> data);
 
+/// MMIO access profiler. Counts accesses and accumulated cycles per hardware register region, so that
+/// underperforming titles can be attributed to the device traffic responsible. Collection only happens
+/// while the debug window is enabled (or regtest requests a dump), so the dispatch cost is a single
+/// predicted branch otherwise.
+enum class MMIORegion : u8
+{
+  EXP1,
+  MemCtrl,
+  Pad,
+  SIO,
+  MemCtrl2,
+  IRQ,
+  DMA,
+  Timers,
+  CDROM,
+  GPU,
+  MDEC,
+  SPU,
+  EXP2,
+  EXP3,
+  Count
+};
+
+struct MMIORegionStats
+{
+  u64 reads;
+  u64 writes;
+  u64 cycles;
+};
+
+const char* GetMMIORegionName(MMIORegion region);
+const MMIORegionStats& GetMMIORegionStats(MMIORegion region);
+void ResetMMIOProfilerStats();
+
+/// Writes the collected stats to a CSV file (region,reads,writes,cycles).
+bool DumpMMIOProfilerStats(const char* filename);
+
+void DrawProfilerStateWindow();
+
 extern std::bitset<RAM_8MB_CODE_PAGE_COUNT> m_ram_code_bits;
 extern u8* g_ram;            // 2MB-8MB RAM
 extern u32 g_ram_size;       // Active size of RAM.
@@ -146,6 +201,18 @@ void ClearRAMCodePage(u32 index);
 /// Clears all code bits for RAM regions.
 void ClearRAMCodePageFlags();
 
+/// Returns true if the specified page has a write watchpoint armed.
+bool IsRAMWatchedPage(u32 index);
+
+/// Flags a RAM page as watched, write-protecting it so stores take the slow path and check watchpoints.
+void SetRAMWatchedPage(u32 index);
+
+/// Unflags a RAM page as watched, restoring fast stores unless it also contains code.
+void ClearRAMWatchedPage(u32 index);
+
+/// Clears all watch bits for RAM pages.
+void ClearRAMWatchedPageFlags();
+
 /// Returns true if the specified address is in a code page.
 bool IsCodePageAddress(PhysicalMemoryAddress address);
 
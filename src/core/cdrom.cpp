@@ -791,7 +791,7 @@ bool CDROM::PrecacheMedia()
   }
 
   HostInterfaceProgressCallback callback;
-  if (!m_reader.Precache(&callback))
+  if (!m_reader.Precache(&callback, g_settings.cdrom_load_image_compressed))
   {
     Host::AddOSDMessage(TRANSLATE_STR("OSDMessage", "Precaching CD image failed, it may be unreliable."), 15.0f);
     return false;
@@ -800,6 +800,15 @@ bool CDROM::PrecacheMedia()
   return true;
 }
 
+void CDROM::StartStreamingMediaPrecache()
+{
+  if (!m_reader.HasMedia())
+    return;
+
+  if (!m_reader.StartStreamingPrecache())
+    Log_WarningPrintf("Streaming precache not started for '%s'", m_reader.GetMediaFileName().c_str());
+}
+
 TinyString CDROM::LBAToMSFString(CDImage::LBA lba)
 {
   const auto pos = CDImage::Position::FromLBA(lba);
@@ -2892,11 +2901,42 @@ static std::array<std::array<s16, 29>, 7> s_zigzag_table = {
     0x3C07,  0x53E0,  -0x16FA, 0x0AFA, -0x0548, 0x027B,  -0x00EB, 0x001A,  0x002B, -0x0023,
     0x0010,  -0x0008, 0x0002,  0x0,    0x0,     0x0,     0x0,     0x0,     0x0}}};
 
-static s16 ZigZagInterpolate(const s16* ringbuf, const s16* table, u8 p)
+#if defined(CPU_X64)
+
+ALWAYS_INLINE static __m128i ZigZagDiv32768(__m128i v)
 {
+  // Matches the scalar (x / 0x8000) truncating division toward zero, which differs from an arithmetic shift for
+  // negative products.
+  const __m128i bias = _mm_and_si128(_mm_srai_epi32(v, 31), _mm_set1_epi32(0x7FFF));
+  return _mm_srai_epi32(_mm_add_epi32(v, bias), 15);
+}
+
+#endif
+
+static s16 ZigZagInterpolate(const s16* samples, const s16* table)
+{
+#if defined(CPU_X64)
+  __m128i v_sum = _mm_setzero_si128();
+  for (u32 i = 0; i < 24; i += 8)
+  {
+    const __m128i v_samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(samples + i));
+    const __m128i v_table = _mm_loadu_si128(reinterpret_cast<const __m128i*>(table + i));
+    const __m128i v_lo = _mm_mullo_epi16(v_samples, v_table);
+    const __m128i v_hi = _mm_mulhi_epi16(v_samples, v_table);
+    v_sum = _mm_add_epi32(v_sum, ZigZagDiv32768(_mm_unpacklo_epi16(v_lo, v_hi)));
+    v_sum = _mm_add_epi32(v_sum, ZigZagDiv32768(_mm_unpackhi_epi16(v_lo, v_hi)));
+  }
+  v_sum = _mm_add_epi32(v_sum, _mm_shuffle_epi32(v_sum, _MM_SHUFFLE(1, 0, 3, 2)));
+  v_sum = _mm_add_epi32(v_sum, _mm_shuffle_epi32(v_sum, _MM_SHUFFLE(2, 3, 0, 1)));
+
+  s32 sum = _mm_cvtsi128_si32(v_sum);
+  for (u32 i = 24; i < 29; i++)
+    sum += (s32(samples[i]) * s32(table[i])) / 0x8000;
+#else
   s32 sum = 0;
-  for (u8 i = 0; i < 29; i++)
-    sum += (s32(ringbuf[(p - i) & 0x1F]) * s32(table[i])) / 0x8000;
+  for (u32 i = 0; i < 29; i++)
+    sum += (s32(samples[i]) * s32(table[i])) / 0x8000;
+#endif
 
   return static_cast<s16>(std::clamp<s32>(sum, -0x8000, 0x7FFF));
 }
@@ -2965,10 +3005,26 @@ void CDROM::ResampleXAADPCM(const s16* frames_in, u32 num_frames_in)
       if (sixstep == 0)
       {
         sixstep = 6;
+
+        // Unwrap the ring into a contiguous buffer once, all seven tables interpolate over the same window.
+        s16 left_samples[XA_RESAMPLE_ZIGZAG_TABLE_SIZE];
+        s16 right_samples[XA_RESAMPLE_ZIGZAG_TABLE_SIZE];
+        if constexpr (!STEREO)
+        {
+          UNREFERENCED_VARIABLE(right_samples);
+        }
+
+        for (u32 i = 0; i < XA_RESAMPLE_ZIGZAG_TABLE_SIZE; i++)
+        {
+          left_samples[i] = left_ringbuf[(p - i) & 0x1F];
+          if constexpr (STEREO)
+            right_samples[i] = right_ringbuf[(p - i) & 0x1F];
+        }
+
         for (u32 j = 0; j < 7; j++)
         {
-          const s16 left_interp = ZigZagInterpolate(left_ringbuf, s_zigzag_table[j].data(), p);
-          const s16 right_interp = STEREO ? ZigZagInterpolate(right_ringbuf, s_zigzag_table[j].data(), p) : left_interp;
+          const s16 left_interp = ZigZagInterpolate(left_samples, s_zigzag_table[j].data());
+          const s16 right_interp = STEREO ? ZigZagInterpolate(right_samples, s_zigzag_table[j].data()) : left_interp;
           AddCDAudioFrame(left_interp, right_interp);
         }
       }
@@ -28,6 +28,7 @@ bool DoesMediaRegionMatchConsole();
 void InsertMedia(std::unique_ptr<CDImage> media, DiscRegion region);
 std::unique_ptr<CDImage> RemoveMedia(bool for_disc_swap);
 bool PrecacheMedia();
+void StartStreamingMediaPrecache();
 
 void CPUClockChanged();
 
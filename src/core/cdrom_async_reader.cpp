@@ -5,6 +5,9 @@
 #include "common/assert.h"
 #include "common/log.h"
 #include "common/timer.h"
+#include "hitch_detector.h"
+#include "settings.h"
+#include <algorithm>
 Log_SetChannel(CDROMAsyncReader);
 
 CDROMAsyncReader::CDROMAsyncReader() = default;
@@ -23,6 +26,9 @@ void CDROMAsyncReader::StartThread(u32 readahead_count)
   m_buffers.resize(readahead_count);
   EmptyBuffers();
 
+  m_prefetch_buffers.resize(SEEK_PREFETCH_COUNT);
+  ResetSeekPrediction();
+
   m_shutdown_flag.store(false);
   m_read_thread = std::thread(&CDROMAsyncReader::WorkerThreadEntryPoint, this);
   Log_InfoPrintf("Read thread started with readahead of %u sectors", readahead_count);
@@ -42,10 +48,14 @@ void CDROMAsyncReader::StopThread()
   m_read_thread.join();
   EmptyBuffers();
   m_buffers.clear();
+  StopStreamingPrecache();
 }
 
 void CDROMAsyncReader::SetMedia(std::unique_ptr<CDImage> media)
 {
+  StopStreamingPrecache();
+  ResetSeekPrediction();
+
   if (IsUsingThread())
     CancelReadahead();
 
@@ -54,15 +64,19 @@ void CDROMAsyncReader::SetMedia(std::unique_ptr<CDImage> media)
 
 std::unique_ptr<CDImage> CDROMAsyncReader::RemoveMedia()
 {
+  StopStreamingPrecache();
+  ResetSeekPrediction();
+
   if (IsUsingThread())
     CancelReadahead();
 
   return std::move(m_media);
 }
 
-bool CDROMAsyncReader::Precache(ProgressCallback* callback)
+bool CDROMAsyncReader::Precache(ProgressCallback* callback, bool compress /* = false */)
 {
   WaitForIdle();
+  StopStreamingPrecache();
 
   std::unique_lock lock(m_mutex);
   if (!m_media)
@@ -76,7 +90,8 @@ bool CDROMAsyncReader::Precache(ProgressCallback* callback)
   if (res == CDImage::PrecacheResult::Unsupported)
   {
     // fall back to copy precaching
-    std::unique_ptr<CDImage> memory_image = CDImage::CreateMemoryImage(m_media.get(), callback);
+    std::unique_ptr<CDImage> memory_image = compress ? CDImage::CreateCompressedMemoryImage(m_media.get(), callback) :
+                                                       CDImage::CreateMemoryImage(m_media.get(), callback);
     if (memory_image)
     {
       const CDImage::LBA lba = m_media->GetPositionOnDisc();
@@ -99,6 +114,285 @@ bool CDROMAsyncReader::Precache(ProgressCallback* callback)
   return (res == CDImage::PrecacheResult::Success);
 }
 
+bool CDROMAsyncReader::StartStreamingPrecache()
+{
+  if (!m_media)
+    return false;
+  else if (m_media->IsPrecached())
+    return true;
+  else if (!IsUsingThread())
+    return false;
+
+  std::unique_lock lock(m_mutex);
+  if (m_streaming_precache_active.load())
+    return true;
+
+  const u32 lba_count = m_media->GetLBACount();
+  if (lba_count == 0)
+    return false;
+
+  const u32 num_ranges = (lba_count + (STREAMING_PRECACHE_RANGE_SIZE - 1)) / STREAMING_PRECACHE_RANGE_SIZE;
+  m_precache_sectors.resize(lba_count);
+  m_precache_range_complete.assign(num_ranges, false);
+  m_precache_next_range = 0;
+  m_precache_fill_lba = 0;
+  m_streaming_precache_active.store(true);
+  m_do_read_cv.notify_one();
+
+  Log_InfoPrintf("Streaming precache started: %u sectors in %u ranges (%.1f MB)", lba_count, num_ranges,
+                 static_cast<double>(static_cast<u64>(lba_count) * sizeof(PrecachedSector)) / 1048576.0);
+  return true;
+}
+
+void CDROMAsyncReader::StopStreamingPrecache()
+{
+  if (!m_streaming_precache_active.load())
+    return;
+
+  // the read thread bails out of any in-progress fill once the flag is clear
+  m_streaming_precache_active.store(false);
+
+  std::unique_lock lock(m_mutex);
+  m_notify_read_complete_cv.wait(lock, [this]() { return !m_is_reading.load(); });
+  m_precache_sectors = std::vector<PrecachedSector>();
+  m_precache_range_complete = std::vector<bool>();
+  m_precache_next_range = 0;
+  m_precache_fill_lba = 0;
+}
+
+bool CDROMAsyncReader::HasStreamingPrecacheWork() const
+{
+  return (m_streaming_precache_active.load() &&
+          m_precache_next_range < static_cast<u32>(m_precache_range_complete.size()));
+}
+
+bool CDROMAsyncReader::ReadSectorFromStreamingPrecache(CDImage::LBA lba, SectorBuffer* data, CDImage::SubChannelQ* subq)
+{
+  if (!m_streaming_precache_active.load())
+    return false;
+
+  const u32 range = lba / STREAMING_PRECACHE_RANGE_SIZE;
+  if (range >= static_cast<u32>(m_precache_range_complete.size()) || !m_precache_range_complete[range])
+    return false;
+
+  const PrecachedSector& sec = m_precache_sectors[lba];
+  if (data)
+    *data = sec.data;
+  if (subq)
+    *subq = sec.subq;
+  return true;
+}
+
+void CDROMAsyncReader::FillNextStreamingPrecacheRange(std::unique_lock<std::mutex>& lock)
+{
+  const u32 range = m_precache_next_range;
+  const CDImage::LBA end_lba =
+    std::min<CDImage::LBA>((range + 1) * STREAMING_PRECACHE_RANGE_SIZE, m_media->GetLBACount());
+  const CDImage::LBA prev_lba = m_media->GetPositionOnDisc();
+
+  m_is_reading.store(true);
+  lock.unlock();
+
+  bool result = m_media->Seek(m_precache_fill_lba);
+  while (result && m_precache_fill_lba < end_lba)
+  {
+    // seeks and readahead take priority over background filling; partial progress is kept
+    if (m_next_position_set.load() || m_can_readahead.load() || m_shutdown_flag.load() ||
+        !m_streaming_precache_active.load())
+    {
+      break;
+    }
+
+    PrecachedSector& sec = m_precache_sectors[m_precache_fill_lba];
+    result = m_media->ReadRawSector(sec.data.data(), &sec.subq);
+    if (result)
+      m_precache_fill_lba++;
+  }
+
+  if (!m_media->Seek(prev_lba))
+    Log_ErrorPrintf("Failed to re-seek to position %u after precache fill", prev_lba);
+
+  lock.lock();
+  m_is_reading.store(false);
+
+  if (!result)
+  {
+    Log_WarningPrintf("Streaming precache read failed at LBA %u, stopping", m_precache_fill_lba);
+    m_streaming_precache_active.store(false);
+  }
+  else if (m_precache_fill_lba == end_lba && m_streaming_precache_active.load())
+  {
+    m_precache_range_complete[range] = true;
+    m_precache_next_range++;
+    if (m_precache_next_range == static_cast<u32>(m_precache_range_complete.size()))
+      Log_InfoPrintf("Streaming precache complete, all reads will be served from memory");
+  }
+
+  m_notify_read_complete_cv.notify_all();
+}
+
+void CDROMAsyncReader::ResetSeekPrediction()
+{
+  std::unique_lock lock(m_mutex);
+  m_seek_streams = {};
+  m_seek_stream_use_counter = 0;
+  m_current_seek_stream = 0;
+  m_seek_source_valid = false;
+  m_last_queued_lba_valid.store(false);
+
+  // wait for any in-flight prefetch to finish before dropping the buffers
+  m_notify_read_complete_cv.wait(lock, [this]() { return !m_is_reading.load(); });
+  m_prefetch_count = 0;
+}
+
+void CDROMAsyncReader::RecordSeekTransition(CDImage::LBA from_next, CDImage::LBA to)
+{
+  // the stream we're leaving resumes just after the last sector the CDC requested from it
+  SeekStream& cur = m_seek_streams[m_current_seek_stream];
+  cur.next_lba = from_next;
+  cur.valid = true;
+  cur.last_use = ++m_seek_stream_use_counter;
+
+  s32 target = -1;
+  for (u32 i = 0; i < NUM_SEEK_STREAMS; i++)
+  {
+    const SeekStream& s = m_seek_streams[i];
+    if (!s.valid)
+      continue;
+
+    const u32 distance = (to >= s.next_lba) ? (to - s.next_lba) : (s.next_lba - to);
+    if (distance <= SEEK_STREAM_MATCH_DISTANCE)
+    {
+      target = static_cast<s32>(i);
+      break;
+    }
+  }
+
+  if (target < 0)
+  {
+    // allocate a new stream, evicting the least-recently-used entry
+    for (u32 i = 0; i < NUM_SEEK_STREAMS; i++)
+    {
+      if (!m_seek_streams[i].valid)
+      {
+        target = static_cast<s32>(i);
+        break;
+      }
+
+      if (target < 0 || m_seek_streams[i].last_use < m_seek_streams[target].last_use)
+        target = static_cast<s32>(i);
+    }
+  }
+
+  m_current_seek_stream = static_cast<u32>(target);
+
+  SeekStream& ns = m_seek_streams[m_current_seek_stream];
+  ns.next_lba = to;
+  ns.valid = true;
+  ns.last_use = ++m_seek_stream_use_counter;
+}
+
+s32 CDROMAsyncReader::SelectSeekPrefetchStream() const
+{
+  s32 best = -1;
+  for (u32 i = 0; i < NUM_SEEK_STREAMS; i++)
+  {
+    const SeekStream& s = m_seek_streams[i];
+    if (!s.valid || i == m_current_seek_stream)
+      continue;
+
+    if (best < 0 || s.last_use > m_seek_streams[best].last_use)
+      best = static_cast<s32>(i);
+  }
+
+  // don't refill if we already prefetched this target
+  if (best >= 0 && m_prefetch_count > 0 && m_prefetch_start_lba == m_seek_streams[best].next_lba)
+    return -1;
+
+  return best;
+}
+
+void CDROMAsyncReader::FillSeekPrefetchBuffers(std::unique_lock<std::mutex>& lock, u32 stream_index)
+{
+  const CDImage::LBA target = m_seek_streams[stream_index].next_lba;
+  const CDImage::LBA prev_lba = m_media->GetPositionOnDisc();
+
+  m_prefetch_count = 0;
+  m_is_reading.store(true);
+  lock.unlock();
+
+  u32 sectors_read = 0;
+  bool result = m_media->Seek(target);
+  while (result && sectors_read < SEEK_PREFETCH_COUNT)
+  {
+    // seeks and readahead take priority over speculative prefetching
+    if (m_next_position_set.load() || m_can_readahead.load() || m_shutdown_flag.load())
+      break;
+
+    BufferSlot& slot = m_prefetch_buffers[sectors_read];
+    slot.lba = target + sectors_read;
+    slot.result = m_media->ReadRawSector(slot.data.data(), &slot.subq);
+    result = slot.result;
+    if (result)
+      sectors_read++;
+  }
+
+  if (!m_media->Seek(prev_lba))
+    Log_ErrorPrintf("Failed to re-seek to position %u after seek prefetch", prev_lba);
+
+  lock.lock();
+  m_is_reading.store(false);
+
+  if (sectors_read > 0)
+  {
+    m_prefetch_start_lba = target;
+    m_prefetch_count = sectors_read;
+    Log_DebugPrintf("Prefetched %u sectors at predicted seek target %u", sectors_read, target);
+  }
+  else if (!result)
+  {
+    // unreadable target, don't keep trying it
+    m_seek_streams[stream_index].valid = false;
+  }
+
+  m_notify_read_complete_cv.notify_all();
+}
+
+bool CDROMAsyncReader::ConsumeSeekPrefetch(std::unique_lock<std::mutex>& lock, CDImage::LBA seek_location)
+{
+  if (m_prefetch_count == 0 || seek_location < m_prefetch_start_lba ||
+      seek_location >= (m_prefetch_start_lba + m_prefetch_count))
+  {
+    return false;
+  }
+
+  const u32 offset = seek_location - m_prefetch_start_lba;
+  const u32 copy_count = std::min(m_prefetch_count - offset, static_cast<u32>(m_buffers.size()));
+  for (u32 i = 0; i < copy_count; i++)
+    m_buffers[i] = m_prefetch_buffers[offset + i];
+
+  m_prefetch_count = 0;
+  m_buffer_front.store(0);
+  m_buffer_back.store(copy_count % static_cast<u32>(m_buffers.size()));
+  m_buffer_count.store(copy_count);
+
+  Log_DebugPrintf("Seek to LBA %u served from prefetch buffers (%u sectors)", seek_location, copy_count);
+  m_notify_read_complete_cv.notify_all();
+
+  // position the image after the prefetched range so readahead carries on from there
+  const CDImage::LBA next_lba = seek_location + copy_count;
+  m_is_reading.store(true);
+  lock.unlock();
+  const bool seek_result = m_media->Seek(next_lba);
+  lock.lock();
+  m_is_reading.store(false);
+  if (!seek_result)
+    Log_WarningPrintf("Seek to LBA %u after prefetch failed", next_lba);
+
+  m_can_readahead.store(seek_result && !m_next_position_set.load());
+  return true;
+}
+
 void CDROMAsyncReader::QueueReadSector(CDImage::LBA lba)
 {
   if (!IsUsingThread())
@@ -116,6 +410,8 @@ void CDROMAsyncReader::QueueReadSector(CDImage::LBA lba)
     if (m_buffers[buffer_front].lba == lba)
     {
       Log_DebugPrintf("Skipping re-reading same sector %u", lba);
+      m_last_queued_lba.store(lba);
+      m_last_queued_lba_valid.store(true);
       return;
     }
 
@@ -127,6 +423,8 @@ void CDROMAsyncReader::QueueReadSector(CDImage::LBA lba)
       Log_DebugPrintf("Readahead buffer hit for sector %u", lba);
       m_buffer_front.store(next_buffer);
       m_buffer_count.fetch_sub(1);
+      m_last_queued_lba.store(lba);
+      m_last_queued_lba_valid.store(true);
       m_can_readahead.store(true);
       m_do_read_cv.notify_one();
       return;
@@ -136,6 +434,10 @@ void CDROMAsyncReader::QueueReadSector(CDImage::LBA lba)
   // we need to toss away our readahead and start fresh
   Log_DebugPrintf("Readahead buffer miss, queueing seek to %u", lba);
   std::unique_lock<std::mutex> lock(m_mutex);
+  m_seek_source_lba = m_last_queued_lba.load();
+  m_seek_source_valid = m_last_queued_lba_valid.load();
+  m_last_queued_lba.store(lba);
+  m_last_queued_lba_valid.store(true);
   m_next_position_set.store(true);
   m_next_position = lba;
   m_do_read_cv.notify_one();
@@ -165,6 +467,9 @@ bool CDROMAsyncReader::ReadSectorUncached(CDImage::LBA lba, CDImage::SubChannelQ
 
 bool CDROMAsyncReader::InternalReadSectorUncached(CDImage::LBA lba, CDImage::SubChannelQ* subq, SectorBuffer* data)
 {
+  if (ReadSectorFromStreamingPrecache(lba, data, subq))
+    return true;
+
   if (m_media->GetPositionOnDisc() != lba && !m_media->Seek(lba))
   {
     Log_WarningPrintf("Seek to LBA %u failed", lba);
@@ -204,7 +509,14 @@ bool CDROMAsyncReader::WaitForReadToComplete()
   const u32 front = m_buffer_front.load();
   const double wait_time = wait_timer.GetTimeMilliseconds();
   if (wait_time > 1.0f)
+  {
     Log_WarningPrintf("Had to wait %.2f msec for LBA %u", wait_time, m_buffers[front].lba);
+    if (g_settings.hitch_detector_enable)
+    {
+      HitchDetector::AddEvent(HitchDetector::EventType::CDReadWait, m_buffers[front].lba,
+                              static_cast<float>(wait_time));
+    }
+  }
 
   Log_TracePrintf("Returning sector %u after waiting", m_buffers[front].lba);
   return m_buffers[front].result;
@@ -235,6 +547,18 @@ bool CDROMAsyncReader::ReadSectorIntoBuffer(std::unique_lock<std::mutex>& lock)
 
   BufferSlot& buffer = m_buffers[slot];
   buffer.lba = m_media->GetPositionOnDisc();
+
+  // Serve from the streaming precache if this range has been populated, advancing the image
+  // position so the next readahead carries on from the correct place.
+  if (ReadSectorFromStreamingPrecache(buffer.lba, &buffer.data, &buffer.subq) && m_media->Seek(buffer.lba + 1))
+  {
+    Log_TracePrintf("Serving LBA %u from streaming precache", buffer.lba);
+    buffer.result = true;
+    m_buffer_count.fetch_add(1);
+    m_notify_read_complete_cv.notify_all();
+    return true;
+  }
+
   m_is_reading.store(true);
   lock.unlock();
 
@@ -246,6 +570,8 @@ bool CDROMAsyncReader::ReadSectorIntoBuffer(std::unique_lock<std::mutex>& lock)
     const double read_time = timer.GetTimeMilliseconds();
     if (read_time > 1.0f)
       Log_DevPrintf("Read LBA %u took %.2f msec", buffer.lba, read_time);
+    if (g_settings.hitch_detector_enable && read_time > 1.0f)
+      HitchDetector::AddEvent(HitchDetector::EventType::CDSectorRead, buffer.lba, static_cast<float>(read_time));
   }
   else
   {
@@ -285,6 +611,8 @@ void CDROMAsyncReader::ReadSectorNonThreaded(CDImage::LBA lba)
     const double read_time = timer.GetTimeMilliseconds();
     if (read_time > 1.0f)
       Log_DevPrintf("Read LBA %u took %.2f msec", buffer.lba, read_time);
+    if (g_settings.hitch_detector_enable && read_time > 1.0f)
+      HitchDetector::AddEvent(HitchDetector::EventType::CDSectorRead, buffer.lba, static_cast<float>(read_time));
   }
   else
   {
@@ -314,8 +642,10 @@ void CDROMAsyncReader::WorkerThreadEntryPoint()
 
   for (;;)
   {
-    m_do_read_cv.wait(
-      lock, [this]() { return (m_shutdown_flag.load() || m_next_position_set.load() || m_can_readahead.load()); });
+    m_do_read_cv.wait(lock, [this]() {
+      return (m_shutdown_flag.load() || m_next_position_set.load() || m_can_readahead.load() ||
+              HasStreamingPrecacheWork());
+    });
     if (m_shutdown_flag.load())
       break;
 
@@ -328,32 +658,51 @@ void CDROMAsyncReader::WorkerThreadEntryPoint()
         EmptyBuffers();
         m_next_position_set.store(false);
         m_seek_error.store(false);
-        m_is_reading.store(true);
-        lock.unlock();
-
-        // seek without lock held in case it takes time
-        Log_DebugPrintf("Seeking to LBA %u...", seek_location);
-        const bool seek_result = (m_media->GetPositionOnDisc() == seek_location || m_media->Seek(seek_location));
-
-        lock.lock();
-        m_is_reading.store(false);
 
-        // did another request come in? abort if so
-        if (m_next_position_set.load())
-          continue;
-
-        // did we fail the seek?
-        if (!seek_result)
+        if (m_seek_source_valid)
         {
-          // add the error result, and don't try to read ahead
-          Log_WarningPrintf("Seek to LBA %u failed", seek_location);
-          m_seek_error.store(true);
-          m_notify_read_complete_cv.notify_all();
-          break;
+          RecordSeekTransition(m_seek_source_lba + 1, seek_location);
+          m_seek_source_valid = false;
         }
 
-        // go go read ahead!
-        m_can_readahead.store(true);
+        // did we prefetch the target of this seek already?
+        if (ConsumeSeekPrefetch(lock, seek_location))
+        {
+          // prefetch hit; the image is positioned after the copied sectors, keep reading ahead
+          if (m_next_position_set.load())
+            continue;
+          else if (!m_can_readahead.load())
+            break;
+        }
+        else
+        {
+          m_is_reading.store(true);
+          lock.unlock();
+
+          // seek without lock held in case it takes time
+          Log_DebugPrintf("Seeking to LBA %u...", seek_location);
+          const bool seek_result = (m_media->GetPositionOnDisc() == seek_location || m_media->Seek(seek_location));
+
+          lock.lock();
+          m_is_reading.store(false);
+
+          // did another request come in? abort if so
+          if (m_next_position_set.load())
+            continue;
+
+          // did we fail the seek?
+          if (!seek_result)
+          {
+            // add the error result, and don't try to read ahead
+            Log_WarningPrintf("Seek to LBA %u failed", seek_location);
+            m_seek_error.store(true);
+            m_notify_read_complete_cv.notify_all();
+            break;
+          }
+
+          // go go read ahead!
+          m_can_readahead.store(true);
+        }
       }
 
       if (!m_can_readahead.load())
@@ -378,5 +727,16 @@ void CDROMAsyncReader::WorkerThreadEntryPoint()
       m_can_readahead.store(false);
       break;
     }
+
+    // use idle time between readahead bursts to prefetch the predicted next seek target,
+    // then to fill the streaming precache
+    if (!m_next_position_set.load() && !m_can_readahead.load())
+    {
+      const s32 prefetch_stream = SelectSeekPrefetchStream();
+      if (prefetch_stream >= 0)
+        FillSeekPrefetchBuffers(lock, static_cast<u32>(prefetch_stream));
+      else if (HasStreamingPrecacheWork())
+        FillNextStreamingPrecacheRange(lock);
+    }
   }
 }
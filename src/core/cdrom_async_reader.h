@@ -46,7 +46,11 @@ public:
   std::unique_ptr<CDImage> RemoveMedia();
 
   /// Precaches image, either to memory, or using the underlying image precache.
-  bool Precache(ProgressCallback* callback);
+  bool Precache(ProgressCallback* callback, bool compress = false);
+
+  /// Begins filling an in-memory copy of the image in the background. Reads are served from disk
+  /// until their range has been populated, then switch over to the memory copy.
+  bool StartStreamingPrecache();
 
   void QueueReadSector(CDImage::LBA lba);
 
@@ -57,12 +61,45 @@ public:
   bool ReadSectorUncached(CDImage::LBA lba, CDImage::SubChannelQ* subq, SectorBuffer* data);
 
 private:
+  enum : u32
+  {
+    STREAMING_PRECACHE_RANGE_SIZE = 512, // sectors filled per idle burst, ~1.2MB raw
+
+    NUM_SEEK_STREAMS = 4,           // concurrent read positions tracked for seek prediction
+    SEEK_PREFETCH_COUNT = 4,        // sectors prefetched at the predicted seek target
+    SEEK_STREAM_MATCH_DISTANCE = 32 // max LBA delta for a seek to count as resuming a stream
+  };
+
+  struct PrecachedSector
+  {
+    SectorBuffer data;
+    CDImage::SubChannelQ subq;
+  };
+
+  struct SeekStream
+  {
+    CDImage::LBA next_lba;
+    u32 last_use;
+    bool valid;
+  };
+
   void EmptyBuffers();
   bool ReadSectorIntoBuffer(std::unique_lock<std::mutex>& lock);
   void ReadSectorNonThreaded(CDImage::LBA lba);
   bool InternalReadSectorUncached(CDImage::LBA lba, CDImage::SubChannelQ* subq, SectorBuffer* data);
   void CancelReadahead();
 
+  void StopStreamingPrecache();
+  bool HasStreamingPrecacheWork() const;
+  bool ReadSectorFromStreamingPrecache(CDImage::LBA lba, SectorBuffer* data, CDImage::SubChannelQ* subq);
+  void FillNextStreamingPrecacheRange(std::unique_lock<std::mutex>& lock);
+
+  void ResetSeekPrediction();
+  void RecordSeekTransition(CDImage::LBA from_next, CDImage::LBA to);
+  s32 SelectSeekPrefetchStream() const;
+  void FillSeekPrefetchBuffers(std::unique_lock<std::mutex>& lock, u32 stream_index);
+  bool ConsumeSeekPrefetch(std::unique_lock<std::mutex>& lock, CDImage::LBA seek_location);
+
   void WorkerThreadEntryPoint();
 
   std::unique_ptr<CDImage> m_media;
@@ -84,4 +121,27 @@ private:
   std::atomic<u32> m_buffer_front{0};
   std::atomic<u32> m_buffer_back{0};
   std::atomic<u32> m_buffer_count{0};
+
+  // Streaming precache state. The sector copies and completion flags are written by the read
+  // thread with the lock released, but a range is only published under the lock, so readers
+  // holding the lock never observe a partially-filled range.
+  std::vector<PrecachedSector> m_precache_sectors;
+  std::vector<bool> m_precache_range_complete;
+  u32 m_precache_next_range = 0;
+  CDImage::LBA m_precache_fill_lba = 0;
+  std::atomic_bool m_streaming_precache_active{false};
+
+  // Seek prediction state. Games which ping-pong between data and streaming-audio regions resume
+  // each region close to where they left off, so we track the tail of recent read streams and
+  // prefetch the most likely resume point into a secondary buffer set while the thread is idle.
+  std::array<SeekStream, NUM_SEEK_STREAMS> m_seek_streams{};
+  std::vector<BufferSlot> m_prefetch_buffers;
+  CDImage::LBA m_prefetch_start_lba = 0;
+  u32 m_prefetch_count = 0;
+  u32 m_seek_stream_use_counter = 0;
+  u32 m_current_seek_stream = 0;
+  CDImage::LBA m_seek_source_lba = 0;
+  bool m_seek_source_valid = false;
+  std::atomic<CDImage::LBA> m_last_queued_lba{0};
+  std::atomic_bool m_last_queued_lba_valid{false};
 };
@@ -14,7 +14,9 @@
 #include "cpu_core.h"
 #include "host.h"
 #include "system.h"
+#include <algorithm>
 #include <cctype>
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 #include <type_traits>
@@ -23,23 +25,37 @@ static std::array<u32, 256> cht_register; // Used for D7 ,51 & 52 cheat types
 
 using KeyValuePairVector = std::vector<std::pair<std::string, std::string>>;
 
-static bool IsValidScanAddress(PhysicalMemoryAddress address)
+// Returns a host pointer and contiguous byte count for the scannable memory containing address,
+// or nullptr when nothing the scanner can touch lives there. Scanning through the direct pointer
+// skips the per-address segment decode of the Safe* accessors, which is what makes full-RAM
+// searches on the UI thread tolerable.
+static const u8* GetScanMemoryPointer(PhysicalMemoryAddress address, u32* remaining_in_region)
 {
   if ((address & CPU::DCACHE_LOCATION_MASK) == CPU::DCACHE_LOCATION &&
       (address & CPU::DCACHE_OFFSET_MASK) < CPU::DCACHE_SIZE)
   {
-    return true;
+    const u32 offset = (address & CPU::DCACHE_OFFSET_MASK);
+    *remaining_in_region = CPU::DCACHE_SIZE - offset;
+    return &CPU::g_state.dcache[offset];
   }
 
-  address &= CPU::PHYSICAL_MEMORY_ADDRESS_MASK;
-
-  if (address < Bus::RAM_MIRROR_END)
-    return true;
+  const PhysicalMemoryAddress phys = (address & CPU::PHYSICAL_MEMORY_ADDRESS_MASK);
+  if (phys < Bus::RAM_MIRROR_END)
+  {
+    // Contiguity ends at the mirror boundary; the next mirror starts over at g_ram[0].
+    const u32 offset = (phys & Bus::g_ram_mask);
+    *remaining_in_region = Bus::g_ram_size - offset;
+    return &Bus::g_ram[offset];
+  }
 
-  if (address >= Bus::BIOS_BASE && address < (Bus::BIOS_BASE + Bus::BIOS_SIZE))
-    return true;
+  if (phys >= Bus::BIOS_BASE && phys < (Bus::BIOS_BASE + Bus::BIOS_SIZE))
+  {
+    const u32 offset = (phys - Bus::BIOS_BASE);
+    *remaining_in_region = Bus::BIOS_SIZE - offset;
+    return &Bus::g_bios[offset];
+  }
 
-  return false;
+  return nullptr;
 }
 
 template<typename T>
@@ -58,6 +74,23 @@ static T DoMemoryRead(VirtualMemoryAddress address)
     return CPU::SafeReadMemoryWord(address, &result) ? result : static_cast<T>(0);
 }
 
+// Direct-pointer variant for the memory scanner, where the per-address decode shows up during
+// repeated refinement passes over large result sets.
+template<typename T>
+static T DoScanMemoryRead(PhysicalMemoryAddress address)
+{
+  u32 remaining_in_region;
+  const u8* ptr = GetScanMemoryPointer(address, &remaining_in_region);
+  if (ptr && remaining_in_region >= sizeof(T))
+  {
+    T value;
+    std::memcpy(&value, ptr, sizeof(T));
+    return value;
+  }
+
+  return DoMemoryRead<T>(address);
+}
+
 template<typename T>
 static void DoMemoryWrite(PhysicalMemoryAddress address, T value)
 {
@@ -556,10 +589,13 @@ void CheatList::Apply()
   if (!m_master_enable)
     return;
 
-  for (const CheatCode& code : m_codes)
+  for (CheatCode& code : m_codes)
   {
     if (code.enabled)
+    {
+      code.CompileIfNeeded();
       code.Apply();
+    }
   }
 }
 
@@ -850,6 +886,7 @@ void CheatList::ApplyCode(u32 index)
   if (index >= m_codes.size())
     return;
 
+  m_codes[index].CompileIfNeeded();
   m_codes[index].Apply();
 }
 
@@ -948,6 +985,11 @@ bool CheatCode::SetInstructionsFromString(const std::string& str)
     return false;
 
   instructions = std::move(new_instructions);
+
+  // force recompilation on the next application
+  compiled_writes = {};
+  compile_attempted = false;
+  is_compiled = false;
   return true;
 }
 
@@ -990,8 +1032,96 @@ u32 CheatCode::GetNextNonConditionalInstruction(u32 index) const
   return index;
 }
 
+void CheatCode::CompileIfNeeded()
+{
+  if (compile_attempted)
+    return;
+
+  compile_attempted = true;
+  is_compiled = false;
+  compiled_writes.clear();
+
+  for (const Instruction& inst : instructions)
+  {
+    CompiledWrite cw;
+    switch (inst.code)
+    {
+      case InstructionCode::Nop:
+        continue;
+
+      case InstructionCode::ConstantWrite8:
+      {
+        cw.address = inst.address;
+        cw.value = inst.value8;
+        cw.size = 1;
+      }
+      break;
+
+      case InstructionCode::ConstantWrite16:
+      {
+        cw.address = inst.address;
+        cw.value = inst.value16;
+        cw.size = 2;
+      }
+      break;
+
+      case InstructionCode::ExtConstantWrite32:
+      {
+        cw.address = inst.address;
+        cw.value = inst.value32;
+        cw.size = 4;
+      }
+      break;
+
+      case InstructionCode::ScratchpadWrite16:
+      {
+        cw.address = CPU::DCACHE_LOCATION | (inst.address & CPU::DCACHE_OFFSET_MASK);
+        cw.value = inst.value16;
+        cw.size = 2;
+      }
+      break;
+
+      case InstructionCode::ExtScratchpadWrite32:
+      {
+        cw.address = CPU::DCACHE_LOCATION | (inst.address & CPU::DCACHE_OFFSET_MASK);
+        cw.value = inst.value32;
+        cw.size = 4;
+      }
+      break;
+
+      default:
+      {
+        // Conditionals, delays, slides and registers depend on runtime state, so the whole code
+        // stays on the interpreter.
+        compiled_writes = {};
+        return;
+      }
+    }
+
+    compiled_writes.push_back(cw);
+  }
+
+  is_compiled = true;
+  compiled_writes.shrink_to_fit();
+}
+
 void CheatCode::Apply() const
 {
+  if (is_compiled)
+  {
+    for (const CompiledWrite& cw : compiled_writes)
+    {
+      if (cw.size == 1)
+        DoMemoryWrite<u8>(cw.address, Truncate8(cw.value));
+      else if (cw.size == 2)
+        DoMemoryWrite<u16>(cw.address, Truncate16(cw.value));
+      else
+        DoMemoryWrite<u32>(cw.address, cw.value);
+    }
+
+    return;
+  }
+
   const u32 count = static_cast<u32>(instructions.size());
   u32 index = 0;
   for (; index < count;)
@@ -2831,15 +2961,15 @@ void MemoryScan::Search()
   switch (m_size)
   {
     case MemoryAccessSize::Byte:
-      SearchBytes();
+      SearchMemory<u8>();
       break;
 
     case MemoryAccessSize::HalfWord:
-      SearchHalfwords();
+      SearchMemory<u16>();
       break;
 
     case MemoryAccessSize::Word:
-      SearchWords();
+      SearchMemory<u32>();
       break;
 
     default:
@@ -2847,61 +2977,41 @@ void MemoryScan::Search()
   }
 }
 
-void MemoryScan::SearchBytes()
-{
-  for (PhysicalMemoryAddress address = m_start_address; address < m_end_address; address++)
-  {
-    if (!IsValidScanAddress(address))
-      continue;
-
-    const u8 bvalue = DoMemoryRead<u8>(address);
-
-    Result res;
-    res.address = address;
-    res.value = m_signed ? SignExtend32(bvalue) : ZeroExtend32(bvalue);
-    res.last_value = res.value;
-    res.value_changed = false;
-
-    if (res.Filter(m_operator, m_value, m_signed))
-      m_results.push_back(res);
-  }
-}
-
-void MemoryScan::SearchHalfwords()
+template<typename T>
+void MemoryScan::SearchMemory()
 {
-  for (PhysicalMemoryAddress address = m_start_address; address < m_end_address; address += 2)
+  // Resolve each contiguous region once and scan it with a linear loop over host memory, rather
+  // than paying the address validation and segment decode per element. SignExtend32 on a u32 is
+  // the identity, so the word search shares the same body.
+  PhysicalMemoryAddress address = m_start_address;
+  while (address < m_end_address)
   {
-    if (!IsValidScanAddress(address))
+    u32 remaining_in_region;
+    const u8* ptr = GetScanMemoryPointer(address, &remaining_in_region);
+    const u32 count =
+      ptr ? (std::min(remaining_in_region, m_end_address - address) / static_cast<u32>(sizeof(T))) : 0;
+    if (count == 0)
+    {
+      address += sizeof(T);
       continue;
+    }
 
-    const u16 bvalue = DoMemoryRead<u16>(address);
-
-    Result res;
-    res.address = address;
-    res.value = m_signed ? SignExtend32(bvalue) : ZeroExtend32(bvalue);
-    res.last_value = res.value;
-    res.value_changed = false;
-
-    if (res.Filter(m_operator, m_value, m_signed))
-      m_results.push_back(res);
-  }
-}
+    for (u32 i = 0; i < count; i++)
+    {
+      T bvalue;
+      std::memcpy(&bvalue, &ptr[i * sizeof(T)], sizeof(T));
 
-void MemoryScan::SearchWords()
-{
-  for (PhysicalMemoryAddress address = m_start_address; address < m_end_address; address += 4)
-  {
-    if (!IsValidScanAddress(address))
-      continue;
+      Result res;
+      res.address = address + (i * static_cast<u32>(sizeof(T)));
+      res.value = m_signed ? SignExtend32(bvalue) : ZeroExtend32(bvalue);
+      res.last_value = res.value;
+      res.value_changed = false;
 
-    Result res;
-    res.address = address;
-    res.value = DoMemoryRead<u32>(address);
-    res.last_value = res.value;
-    res.value_changed = false;
+      if (res.Filter(m_operator, m_value, m_signed))
+        m_results.push_back(res);
+    }
 
-    if (res.Filter(m_operator, m_value, m_signed))
-      m_results.push_back(res);
+    address += count * static_cast<u32>(sizeof(T));
   }
 }
 
@@ -3057,21 +3167,21 @@ void MemoryScan::Result::UpdateValue(MemoryAccessSize size, bool is_signed)
   {
     case MemoryAccessSize::Byte:
     {
-      u8 bvalue = DoMemoryRead<u8>(address);
+      u8 bvalue = DoScanMemoryRead<u8>(address);
       value = is_signed ? SignExtend32(bvalue) : ZeroExtend32(bvalue);
     }
     break;
 
     case MemoryAccessSize::HalfWord:
     {
-      u16 bvalue = DoMemoryRead<u16>(address);
+      u16 bvalue = DoScanMemoryRead<u16>(address);
       value = is_signed ? SignExtend32(bvalue) : ZeroExtend32(bvalue);
     }
     break;
 
     case MemoryAccessSize::Word:
     {
-      CPU::SafeReadMemoryWord(address, &value);
+      value = DoScanMemoryRead<u32>(address);
     }
     break;
   }
@@ -107,13 +107,27 @@ struct CheatCode
     BitField<u64, u8, 0, 8> value8;
   };
 
+  // Codes consisting solely of unconditional constant writes (the overwhelming majority of
+  // GameShark codes) are flattened into this program by CompileIfNeeded() and applied as a plain
+  // list of writes, skipping the per-instruction dispatch loop. Conditional, button-testing and
+  // stateful opcodes depend on runtime memory/pad state and stay on the interpreter.
+  struct CompiledWrite
+  {
+    u32 address;
+    u32 value;
+    u8 size;
+  };
+
   std::string group;
   std::string description;
   std::vector<Instruction> instructions;
+  std::vector<CompiledWrite> compiled_writes;
   std::string comments;
   Type type = Type::Gameshark;
   Activation activation = Activation::EndFrame;
   bool enabled = false;
+  bool compile_attempted = false;
+  bool is_compiled = false;
 
   ALWAYS_INLINE bool Valid() const { return !instructions.empty() && !description.empty(); }
   ALWAYS_INLINE bool IsManuallyActivated() const { return (activation == Activation::Manual); }
@@ -123,6 +137,7 @@ struct CheatCode
 
   u32 GetNextNonConditionalInstruction(u32 index) const;
 
+  void CompileIfNeeded();
   void Apply() const;
   void ApplyOnDisable() const;
 
@@ -263,9 +278,8 @@ public:
   void SetResultValue(u32 index, u32 value);
 
 private:
-  void SearchBytes();
-  void SearchHalfwords();
-  void SearchWords();
+  template<typename T>
+  void SearchMemory();
 
   u32 m_value = 0;
   MemoryAccessSize m_size = MemoryAccessSize::HalfWord;
@@ -252,3 +252,31 @@ bool Controller::InCircularDeadzone(float deadzone, float pos_x, float pos_y)
   const bool in_y = (pos_y < 0.0f) ? (pos_y > dz_y) : (pos_y <= dz_y);
   return (in_x && in_y);
 }
+
+void Controller::ProcessStickAxes(const u8* half_axes, u8 invert_bits, float deadzone, u8* out_x, u8* out_y)
+{
+  // Select the positive/negative direction for each axis with an index swap instead of a branch
+  // per direction; the selects below compile to conditional moves.
+  const u32 xsel = (invert_bits & 1u);
+  const u32 ysel = ((invert_bits >> 1) & 1u);
+  const u8 xpos = half_axes[1u - xsel];
+  const u8 xneg = half_axes[xsel];
+  const u8 ypos = half_axes[2u + ysel];
+  const u8 yneg = half_axes[3u - ysel];
+
+  if (deadzone > 0.0f)
+  {
+    // Signed stick position on the same positive-wins convention as the merge below.
+    const float pos_x = (xpos != 0) ? (static_cast<float>(xpos) / 255.0f) : (static_cast<float>(xneg) / -255.0f);
+    const float pos_y = (ypos != 0) ? (static_cast<float>(ypos) / 255.0f) : (static_cast<float>(yneg) / -255.0f);
+    if (InCircularDeadzone(deadzone, pos_x, pos_y))
+    {
+      *out_x = 127;
+      *out_y = 127;
+      return;
+    }
+  }
+
+  *out_x = (xpos != 0) ? static_cast<u8>(127u + ((xpos + 1u) / 2u)) : static_cast<u8>(127u - (xneg / 2u));
+  *out_y = (ypos != 0) ? static_cast<u8>(127u + ((ypos + 1u) / 2u)) : static_cast<u8>(127u - (yneg / 2u));
+}
@@ -135,6 +135,12 @@ public:
   /// Returns true if the specified coordinates are inside a circular deadzone.
   static bool InCircularDeadzone(float deadzone, float pos_x, float pos_y);
 
+  /// Merges a stick's four half-axis magnitudes ({left, right, down, up}, 0-255) into PS1-style
+  /// 0-255 X/Y bytes in one pass. Inversion is handled by an index swap (bit 0 horizontal, bit 1
+  /// vertical) rather than branching per direction, and the positive direction wins when both are
+  /// held. A non-zero deadzone recenters both bytes when the stick is inside the circle.
+  static void ProcessStickAxes(const u8* half_axes, u8 invert_bits, float deadzone, u8* out_x, u8* out_y);
+
 protected:
   u32 m_index;
 };
@@ -4,20 +4,33 @@
 #include "cpu_code_cache.h"
 #include "bus.h"
 #include "common/assert.h"
+#include "common/byte_stream.h"
+#include "common/file_system.h"
 #include "common/log.h"
+#include "common/path.h"
+#include "common/string.h"
+#include "fmt/format.h"
 #include "cpu_core.h"
 #include "cpu_core_private.h"
 #include "cpu_disasm.h"
 #include "cpu_recompiler_types.h"
+#include "guest_profiler.h"
+#include "hitch_detector.h"
+#include "host.h"
+#include "imgui.h"
 #include "settings.h"
 #include "system.h"
 #include "timing_event.h"
+#include "util/imgui_manager.h"
+#include "util/thread_sampler.h"
 Log_SetChannel(CPU::CodeCache);
 
 #ifdef WITH_RECOMPILER
 #include "cpu_recompiler_code_generator.h"
 #endif
 
+#include <algorithm>
+#include <unordered_set>
 #include <zlib.h>
 
 namespace CPU::CodeCache {
@@ -29,6 +42,17 @@ static constexpr u32 RECOMPILE_FRAMES_TO_FALL_BACK_TO_INTERPRETER = 100;
 static constexpr u32 RECOMPILE_COUNT_TO_FALL_BACK_TO_INTERPRETER = 20;
 static constexpr u32 INVALIDATE_THRESHOLD_TO_DISABLE_LINKING = 10;
 
+// With tiered compilation enabled, blocks are run through the cached interpreter until they have
+// executed this many times; only then do they get the full recompiler pass. Most blocks never make
+// it, which keeps codegen off the startup/load path.
+static constexpr u32 TIER_UP_EXECUTION_THRESHOLD = 32;
+
+// Cap the number of blocks recompiled per frame, interpreting the remainder uncached, so that
+// compile storms (level loads, overlay swaps thrashing InvalidateBlocksWithPageIndex) get spread
+// over several frames instead of stalling one. The budget is generous enough that steady-state
+// compilation never hits it.
+static constexpr u32 MAX_COMPILES_PER_FRAME = 256;
+
 #ifdef WITH_RECOMPILER
 
 // Currently remapping the code buffer doesn't work in macOS or Haiku.
@@ -63,6 +87,42 @@ static std::unique_ptr<CodeBlock::HostCodePointer[]> s_fast_map_pointers;
 DispatcherFunction s_asm_dispatcher;
 SingleBlockDispatcherFunction s_single_block_asm_dispatcher;
 
+static u32 s_compile_budget_frame_number = 0;
+static u32 s_compiles_this_frame = 0;
+
+// Per-game record of blocks which crossed the tier-up threshold in a previous session. Blocks in
+// this set skip the interpreter tier, so warm starts don't have to re-learn the hot set.
+static constexpr u32 WARM_BLOCK_PROFILE_SIGNATURE = 0x50424A44; // 'DJBP'
+static constexpr u32 WARM_BLOCK_PROFILE_VERSION = 1;
+static std::unordered_set<u32> s_warm_block_keys;
+static bool s_warm_block_profile_dirty = false;
+
+static std::string GetWarmBlockProfilePath();
+static void LoadWarmBlockProfile();
+static void SaveWarmBlockProfile();
+
+// Code quality telemetry. Fallbacks are aggregated per opcode (funct for SPECIAL encodings), with
+// the first instruction seen kept as a disassembly example.
+struct FallbackRecord
+{
+  u64 count;
+  u32 example_pc;
+  u32 example_bits;
+};
+
+static struct CodeQualityStats
+{
+  u64 blocks_compiled;
+  u64 blocks_recompiled;
+  u64 blocks_fallen_back_to_interpreter;
+  u64 buffer_flushes;
+  u64 guest_instructions_compiled;
+  u64 host_code_bytes_emitted;
+  u64 fallback_instructions_compiled;
+} s_code_quality_stats;
+
+static std::map<u32, FallbackRecord> s_fallback_records;
+
 static FastMapTable DecodeFastMapPointer(u32 slot, FastMapTable ptr)
 {
   if constexpr (sizeof(void*) == 8)
@@ -233,6 +293,8 @@ static HostCodeMap s_host_code_map;
 static void AddBlockToHostCodeMap(CodeBlock* block);
 static void RemoveBlockFromHostCodeMap(CodeBlock* block);
 
+static bool CompileBlockHostCode(CodeBlock* block, bool allow_flush);
+
 static bool InitializeFastmem();
 static void ShutdownFastmem();
 static Common::PageFaultHandler::HandlerResult LUTPageFaultHandler(void* exception_pc, void* fault_address,
@@ -247,6 +309,9 @@ void Initialize()
 {
   Assert(s_blocks.empty());
 
+  s_code_quality_stats = {};
+  s_fallback_records.clear();
+
 #ifdef WITH_RECOMPILER
   if (g_settings.IsUsingRecompiler())
   {
@@ -260,6 +325,8 @@ void Initialize()
     {
       Panic("Failed to initialize code space");
     }
+
+    ThreadSampler::RegisterCodeRange("CPU Recompiler", s_code_buffer.GetCodePointer(), s_code_buffer.GetTotalSize());
   }
 #endif
 
@@ -275,6 +342,9 @@ void Initialize()
     AllocateFastMap();
     CompileDispatcher();
     ResetFastMap();
+
+    if (g_settings.cpu_recompiler_tiered_compilation)
+      LoadWarmBlockProfile();
   }
 #endif
 }
@@ -300,8 +370,12 @@ void Shutdown()
 {
   ClearState();
 #ifdef WITH_RECOMPILER
+  SaveWarmBlockProfile();
+  s_warm_block_keys.clear();
   ShutdownFastmem();
   FreeFastMap();
+  if (s_code_buffer.IsValid())
+    ThreadSampler::UnregisterCodeRange(s_code_buffer.GetCodePointer());
   s_code_buffer.Destroy();
 #endif
 }
@@ -321,6 +395,9 @@ template<PGXPMode pgxp_mode>
       CodeBlock* block = LookupBlock(next_block_key, true);
       if (!block)
       {
+        if (GuestProfiler::IsCollecting())
+          GuestProfiler::AddBlockExecution(next_block_key.GetPC());
+
         InterpretUncachedBlock<pgxp_mode>();
         next_block_key = GetNextBlockKey();
         continue;
@@ -329,6 +406,9 @@ template<PGXPMode pgxp_mode>
     reexecute_block:
       Assert(!(HasPendingInterrupt()));
 
+      if (GuestProfiler::IsCollecting())
+        GuestProfiler::AddBlockExecution(block->GetPC());
+
 #if 0
       const u32 tick = TimingEvents::GetGlobalTickCounter() + CPU::GetPendingTicks();
       if (tick == 4188233674)
@@ -342,6 +422,10 @@ template<PGXPMode pgxp_mode>
       if (g_settings.cpu_recompiler_icache)
         CheckAndUpdateICacheTags(block->icache_line_count, block->uncached_fetch_ticks);
 
+      // Idle loops can't change any state until an event fires, so run out the timeslice.
+      if (block->is_idle_loop)
+        g_state.pending_ticks = g_state.downcount;
+
       InterpretCachedBlock<pgxp_mode>(*block);
 
       if (g_state.pending_ticks >= g_state.downcount)
@@ -360,12 +444,11 @@ template<PGXPMode pgxp_mode>
       else if (!block->invalidated)
       {
         // Try to find an already-linked block.
-        // TODO: Don't need to dereference the block, just store a pointer to the code.
         for (const CodeBlock::LinkInfo& li : block->link_successors)
         {
-          CodeBlock* linked_block = li.block;
-          if (linked_block->key.bits == next_block_key.bits)
+          if (li.key_bits == next_block_key.bits)
           {
+            CodeBlock* linked_block = li.block;
             if (linked_block->invalidated && !RevalidateBlock(linked_block, true))
             {
               // CanExecuteBlock can result in a block flush, so stop iterating here.
@@ -420,27 +503,33 @@ FastMapTable* GetFastMapPointer()
 
 [[noreturn]] static void ExecuteRecompiler()
 {
-#if 0
-  for (;;)
+  // The asm dispatcher has no per-block hook, so while the guest profiler is collecting, dispatch
+  // block-by-block from C++ instead. Slower, but only paid while profiling.
+  if (GuestProfiler::IsCollecting())
   {
-    if (HasPendingInterrupt())
-      DispatchInterrupt();
+    for (;;)
+    {
+      if (HasPendingInterrupt())
+        DispatchInterrupt();
 
-    TimingEvents::RunEvents();
+      TimingEvents::RunEvents();
 
-    while (g_state.pending_ticks < g_state.downcount)
-    {
+      while (g_state.pending_ticks < g_state.downcount)
+      {
 #if 0
-      LogCurrentState();
+        LogCurrentState();
 #endif
 
-      const u32 pc = g_state.pc;
-      s_single_block_asm_dispatcher(s_fast_map[pc >> 16][pc >> 2]);
+        const u32 pc = g_state.pc;
+        GuestProfiler::AddBlockExecution(pc);
+        s_single_block_asm_dispatcher(s_fast_map[pc >> 16][pc >> 2]);
+      }
     }
   }
-#else
-  s_asm_dispatcher();
-#endif
+  else
+  {
+    s_asm_dispatcher();
+  }
 }
 
 #endif
@@ -522,6 +611,9 @@ void Reinitialize()
 
 void Flush()
 {
+  s_code_quality_stats.buffer_flushes++;
+  if (g_settings.hitch_detector_enable)
+    HitchDetector::AddEvent(HitchDetector::EventType::CodeBufferFlush, 0);
   ClearState();
 #ifdef WITH_RECOMPILER
   if (g_settings.IsUsingRecompiler())
@@ -571,6 +663,8 @@ CodeBlockKey GetNextBlockKey()
 // assumes it has already been unlinked
 static void FallbackExistingBlockToInterpreter(CodeBlock* block)
 {
+  s_code_quality_stats.blocks_fallen_back_to_interpreter++;
+
   // Replace with null so we don't try to compile it again.
   s_blocks.emplace(block->key.bits, nullptr);
   delete block;
@@ -602,7 +696,8 @@ CodeBlock* LookupBlock(CodeBlockKey key, bool allow_flush)
     AddBlockToPageMap(block);
 
 #ifdef WITH_RECOMPILER
-    SetFastMap(block->GetPC(), block->host_code);
+    // cold-tier blocks have no host code yet; leave the compile trampoline in place
+    SetFastMap(block->GetPC(), block->host_code ? block->host_code : FastCompileBlockFunction);
     AddBlockToHostCodeMap(block);
 #endif
   }
@@ -621,6 +716,31 @@ CodeBlock* LookupBlock(CodeBlockKey key, bool allow_flush)
 
 bool RevalidateBlock(CodeBlock* block, bool allow_flush)
 {
+  // Fast path for RAM blocks: the source words are physically contiguous, so compare against RAM
+  // directly instead of decoding the address for every instruction. Games which keep code and data
+  // on the same page invalidate (and thus revalidate) blocks constantly, making this the hot path
+  // during streaming/overlay loads. Double-branch blocks take their delay slot from another
+  // location and stay on the slow path.
+  if (block->IsInRAM() && !block->contains_double_branches &&
+      (block->key.GetPCPhysicalAddress() + block->GetSizeInBytes()) <= Bus::g_ram_size)
+  {
+    const u8* ram_ptr = Bus::g_ram + (block->key.GetPCPhysicalAddress() & Bus::g_ram_mask);
+    for (const CodeBlockInstruction& cbi : block->instructions)
+    {
+      u32 new_code;
+      std::memcpy(&new_code, ram_ptr, sizeof(new_code));
+      ram_ptr += sizeof(new_code);
+      if (cbi.instruction.bits != new_code)
+      {
+        Log_DebugPrintf("Block 0x%08X changed at PC 0x%08X - %08X to %08X - recompiling.", block->GetPC(), cbi.pc,
+                        cbi.instruction.bits, new_code);
+        goto recompile;
+      }
+    }
+
+    goto revalidated;
+  }
+
   for (const CodeBlockInstruction& cbi : block->instructions)
   {
     u32 new_code = 0;
@@ -633,11 +753,13 @@ bool RevalidateBlock(CodeBlock* block, bool allow_flush)
     }
   }
 
+revalidated:
+
   // re-add it to the page map since it's still up-to-date
   block->invalidated = false;
   AddBlockToPageMap(block);
 #ifdef WITH_RECOMPILER
-  SetFastMap(block->GetPC(), block->host_code);
+  SetFastMap(block->GetPC(), block->host_code ? block->host_code : FastCompileBlockFunction);
 #endif
   return true;
 
@@ -686,7 +808,7 @@ recompile:
 
 #ifdef WITH_RECOMPILER
   // re-add to page map again
-  SetFastMap(block->GetPC(), block->host_code);
+  SetFastMap(block->GetPC(), block->host_code ? block->host_code : FastCompileBlockFunction);
   AddBlockToHostCodeMap(block);
 #endif
 
@@ -713,6 +835,7 @@ bool CompileBlock(CodeBlock* block, bool allow_flush)
   block->uncached_fetch_ticks = 0;
   block->contains_double_branches = false;
   block->contains_loadstore_instructions = false;
+  block->is_idle_loop = false;
 
   u32 last_cache_line = ICACHE_LINES;
 
@@ -792,6 +915,21 @@ bool CompileBlock(CodeBlock* block, bool allow_flush)
   {
     block->instructions.back().is_last_instruction = true;
 
+    // Detect pure idle loops, i.e. "self: j self / nop" (or a beq with equal registers), where the
+    // game just spins until an interrupt redirects the PC. Execution of such a block can skip
+    // straight to the next timing event instead of burning a host core on it. Only fully
+    // side-effect-free shapes are accepted; anything touching registers or memory is left alone.
+    if (block->instructions.size() == 2)
+    {
+      const Instruction branch = block->instructions[0].instruction;
+      const bool is_self_branch =
+        block->instructions[0].is_direct_branch_instruction &&
+        (branch.op == InstructionOp::j ||
+         (branch.op == InstructionOp::beq && branch.i.rs == branch.i.rt)) &&
+        GetDirectBranchTarget(branch, block->instructions[0].pc) == block->GetPC();
+      block->is_idle_loop = is_self_branch && (block->instructions[1].instruction.bits == 0);
+    }
+
 #ifdef _DEBUG
     SmallString disasm;
     Log_DebugPrintf("Block at 0x%08X", block->GetPC());
@@ -812,48 +950,204 @@ bool CompileBlock(CodeBlock* block, bool allow_flush)
 #ifdef WITH_RECOMPILER
   if (g_settings.IsUsingRecompiler())
   {
-    // Ensure we're not going to run out of space while compiling this block.
-    if (s_code_buffer.GetFreeCodeSpace() <
-          (block->instructions.size() * Recompiler::MAX_NEAR_HOST_BYTES_PER_INSTRUCTION) ||
-        s_code_buffer.GetFreeFarCodeSpace() <
-          (block->instructions.size() * Recompiler::MAX_FAR_HOST_BYTES_PER_INSTRUCTION))
-    {
-      if (allow_flush)
-      {
-        Log_WarningPrintf("Out of code space, flushing all blocks.");
-        Flush();
-      }
-      else
-      {
-        Log_ErrorPrintf("Out of code space and cannot flush while compiling %08X.", block->GetPC());
-        return false;
-      }
-    }
+    // With tiered compilation, blocks run through the cached interpreter until they prove hot.
+    // Blocks recorded as hot in a previous session skip the interpreter tier entirely.
+    if (g_settings.cpu_recompiler_tiered_compilation && block->execution_count < TIER_UP_EXECUTION_THRESHOLD &&
+        s_warm_block_keys.find(block->key.bits) == s_warm_block_keys.end())
+      return true;
 
-    s_code_buffer.WriteProtect(false);
-    Recompiler::CodeGenerator codegen(&s_code_buffer);
-    const bool compile_result = codegen.CompileBlock(block, &block->host_code, &block->host_code_size);
-    s_code_buffer.WriteProtect(true);
+    if (!CompileBlockHostCode(block, allow_flush))
+      return false;
+  }
+#endif
+
+  return true;
+}
 
-    if (!compile_result)
+#ifdef WITH_RECOMPILER
+
+bool CompileBlockHostCode(CodeBlock* block, bool allow_flush)
+{
+  // Ensure we're not going to run out of space while compiling this block.
+  if (s_code_buffer.GetFreeCodeSpace() <
+        (block->instructions.size() * Recompiler::MAX_NEAR_HOST_BYTES_PER_INSTRUCTION) ||
+      s_code_buffer.GetFreeFarCodeSpace() <
+        (block->instructions.size() * Recompiler::MAX_FAR_HOST_BYTES_PER_INSTRUCTION))
+  {
+    if (allow_flush)
+    {
+      Log_WarningPrintf("Out of code space, flushing all blocks.");
+      Flush();
+    }
+    else
     {
-      Log_ErrorPrintf("Failed to compile host code for block at 0x%08X", block->key.GetPC());
+      Log_ErrorPrintf("Out of code space and cannot flush while compiling %08X.", block->GetPC());
       return false;
     }
   }
-#endif
+
+  s_compiles_this_frame++;
+
+  s_code_buffer.WriteProtect(false);
+  Recompiler::CodeGenerator codegen(&s_code_buffer);
+  const bool compile_result = codegen.CompileBlock(block, &block->host_code, &block->host_code_size);
+  s_code_buffer.WriteProtect(true);
+
+  if (!compile_result)
+  {
+    Log_ErrorPrintf("Failed to compile host code for block at 0x%08X", block->key.GetPC());
+    return false;
+  }
+
+  s_code_quality_stats.blocks_compiled++;
+  if (block->recompile_count > 0)
+    s_code_quality_stats.blocks_recompiled++;
+  if (g_settings.hitch_detector_enable)
+    HitchDetector::AddEvent(HitchDetector::EventType::BlockCompile, block->key.GetPC());
+  s_code_quality_stats.guest_instructions_compiled += block->instructions.size();
+  s_code_quality_stats.host_code_bytes_emitted += block->host_code_size;
+
+  if (g_settings.cpu_recompiler_tiered_compilation)
+    s_warm_block_profile_dirty |= s_warm_block_keys.insert(block->key.bits).second;
 
   return true;
 }
 
-#ifdef WITH_RECOMPILER
+
+static bool CompileBudgetAvailable()
+{
+  const u32 frame_number = System::GetFrameNumber();
+  if (frame_number != s_compile_budget_frame_number)
+  {
+    s_compile_budget_frame_number = frame_number;
+    s_compiles_this_frame = 0;
+  }
+
+  return (s_compiles_this_frame < MAX_COMPILES_PER_FRAME);
+}
+
+std::string GetWarmBlockProfilePath()
+{
+  return Path::Combine(EmuFolders::Cache, fmt::format("jit_profile_{:016X}.cache", System::GetGameHash()));
+}
+
+void LoadWarmBlockProfile()
+{
+  s_warm_block_keys.clear();
+  s_warm_block_profile_dirty = false;
+
+  if (System::GetGameHash() == 0)
+    return;
+
+  std::unique_ptr<ByteStream> stream(
+    ByteStream::OpenFile(GetWarmBlockProfilePath().c_str(), BYTESTREAM_OPEN_READ | BYTESTREAM_OPEN_STREAMED));
+  if (!stream)
+    return;
+
+  u32 signature, version, count;
+  if (!stream->ReadU32(&signature) || !stream->ReadU32(&version) || !stream->ReadU32(&count) ||
+      signature != WARM_BLOCK_PROFILE_SIGNATURE || version != WARM_BLOCK_PROFILE_VERSION)
+  {
+    Log_DevPrintf("Warm block profile is corrupted or version mismatch, ignoring.");
+    return;
+  }
+
+  s_warm_block_keys.reserve(count);
+  for (u32 i = 0; i < count; i++)
+  {
+    u32 key_bits;
+    if (!stream->ReadU32(&key_bits))
+    {
+      s_warm_block_keys.clear();
+      return;
+    }
+
+    s_warm_block_keys.insert(key_bits);
+  }
+
+  Log_InfoPrintf("Loaded warm block profile with %u blocks.", count);
+}
+
+void SaveWarmBlockProfile()
+{
+  if (!s_warm_block_profile_dirty || System::GetGameHash() == 0)
+    return;
+
+  std::unique_ptr<ByteStream> stream(
+    ByteStream::OpenFile(GetWarmBlockProfilePath().c_str(), BYTESTREAM_OPEN_CREATE | BYTESTREAM_OPEN_WRITE |
+                                                             BYTESTREAM_OPEN_TRUNCATE | BYTESTREAM_OPEN_STREAMED));
+  if (!stream)
+  {
+    Log_WarningPrintf("Failed to open warm block profile for writing.");
+    return;
+  }
+
+  bool result = stream->WriteU32(WARM_BLOCK_PROFILE_SIGNATURE) && stream->WriteU32(WARM_BLOCK_PROFILE_VERSION) &&
+                stream->WriteU32(static_cast<u32>(s_warm_block_keys.size()));
+  for (const u32 key_bits : s_warm_block_keys)
+    result = result && stream->WriteU32(key_bits);
+
+  if (!result || !stream->Commit())
+  {
+    Log_WarningPrintf("Failed to write warm block profile.");
+    return;
+  }
+
+  s_warm_block_profile_dirty = false;
+  Log_InfoPrintf("Saved warm block profile with %zu blocks.", s_warm_block_keys.size());
+}
+
+template<PGXPMode pgxp_mode>
+static void InterpretColdBlock(CodeBlock* block)
+{
+  if (g_settings.cpu_recompiler_icache)
+    CheckAndUpdateICacheTags(block->icache_line_count, block->uncached_fetch_ticks);
+
+  if (block->is_idle_loop)
+    g_state.pending_ticks = g_state.downcount;
+
+  InterpretCachedBlock<pgxp_mode>(*block);
+}
 
 void FastCompileBlockFunction()
 {
-  CodeBlock* block = LookupBlock(GetNextBlockKey(), true);
+  CodeBlock* block = CompileBudgetAvailable() ? LookupBlock(GetNextBlockKey(), true) : nullptr;
   if (block)
   {
-    s_single_block_asm_dispatcher(block->host_code);
+    if (block->host_code)
+    {
+      s_single_block_asm_dispatcher(block->host_code);
+      return;
+    }
+
+    // Cold tier: interpret the block, and promote it to the recompiler once it gets hot.
+    if (++block->execution_count >= TIER_UP_EXECUTION_THRESHOLD)
+    {
+      // Can't flush here, the block is already in the map and would be freed under us.
+      if (CompileBlockHostCode(block, false))
+      {
+        AddBlockToHostCodeMap(block);
+        SetFastMap(block->GetPC(), block->host_code);
+        s_single_block_asm_dispatcher(block->host_code);
+        return;
+      }
+
+      // Out of code space - stay in the interpreter tier and retry after the next flush.
+      block->execution_count = 0;
+    }
+
+    if (g_settings.gpu_pgxp_enable)
+    {
+      if (g_settings.gpu_pgxp_cpu)
+        InterpretColdBlock<PGXPMode::CPU>(block);
+      else
+        InterpretColdBlock<PGXPMode::Memory>(block);
+    }
+    else
+    {
+      InterpretColdBlock<PGXPMode::Disabled>(block);
+    }
+
     return;
   }
 
@@ -1012,9 +1306,11 @@ void LinkBlock(CodeBlock* from, CodeBlock* to, void* host_pc, void* host_resolve
   li.host_pc = host_pc;
   li.host_resolve_pc = host_resolve_pc;
   li.host_pc_size = host_pc_size;
+  li.key_bits = to->key.bits;
   from->link_successors.push_back(li);
 
   li.block = from;
+  li.key_bits = from->key.bits;
   to->link_predecessors.push_back(li);
 
 #ifdef WITH_RECOMPILER
@@ -1089,7 +1385,7 @@ void UnlinkBlock(CodeBlock* block)
 
 void AddBlockToHostCodeMap(CodeBlock* block)
 {
-  if (!g_settings.IsUsingRecompiler())
+  if (!g_settings.IsUsingRecompiler() || !block->host_code)
     return;
 
   auto ir = s_host_code_map.emplace(block->host_code, block);
@@ -1098,7 +1394,7 @@ void AddBlockToHostCodeMap(CodeBlock* block)
 
 void RemoveBlockFromHostCodeMap(CodeBlock* block)
 {
-  if (!g_settings.IsUsingRecompiler())
+  if (!g_settings.IsUsingRecompiler() || !block->host_code)
     return;
 
   HostCodeMap::iterator hc_iter = s_host_code_map.find(block->host_code);
@@ -1258,6 +1554,143 @@ Common::PageFaultHandler::HandlerResult LUTPageFaultHandler(void* exception_pc,
 
 #endif // WITH_RECOMPILER
 
+void AddFallbackInstruction(u32 pc, u32 instruction_bits)
+{
+  const Instruction inst{instruction_bits};
+  u32 key = static_cast<u32>(inst.op.GetValue()) << 8;
+  if (inst.op == InstructionOp::funct)
+    key |= static_cast<u32>(inst.r.funct.GetValue());
+
+  s_code_quality_stats.fallback_instructions_compiled++;
+
+  auto iter = s_fallback_records.find(key);
+  if (iter != s_fallback_records.end())
+  {
+    iter->second.count++;
+  }
+  else
+  {
+    s_fallback_records.emplace(key, FallbackRecord{1, pc, instruction_bits});
+  }
+}
+
+u32 GetBlockInstructionCount(u32 pc)
+{
+  CodeBlockKey key = {};
+  key.SetPC(pc);
+  key.user_mode = false;
+
+  auto iter = s_blocks.find(key.bits);
+  if (iter == s_blocks.end())
+  {
+    key.user_mode = true;
+    iter = s_blocks.find(key.bits);
+  }
+
+  return (iter != s_blocks.end() && iter->second) ? static_cast<u32>(iter->second->instructions.size()) : 0;
+}
+
+std::string GetCodeQualityStatsJSON()
+{
+  const CodeQualityStats& stats = s_code_quality_stats;
+  const double native_bytes_per_guest_instruction =
+    (stats.guest_instructions_compiled > 0) ?
+      (static_cast<double>(stats.host_code_bytes_emitted) / static_cast<double>(stats.guest_instructions_compiled)) :
+      0.0;
+
+  std::string fallbacks;
+  for (const auto& [key, record] : s_fallback_records)
+  {
+    SmallString disasm;
+    DisassembleInstruction(&disasm, record.example_pc, record.example_bits);
+    fallbacks += fmt::format("{}    {{\"example\": \"{}\", \"count\": {}}}", fallbacks.empty() ? "" : ",\n",
+                             disasm.GetCharArray(), record.count);
+  }
+
+  return fmt::format("{{\n"
+                     "  \"blocks_compiled\": {},\n"
+                     "  \"blocks_recompiled\": {},\n"
+                     "  \"blocks_fallen_back_to_interpreter\": {},\n"
+                     "  \"buffer_flushes\": {},\n"
+                     "  \"guest_instructions_compiled\": {},\n"
+                     "  \"host_code_bytes_emitted\": {},\n"
+                     "  \"native_bytes_per_guest_instruction\": {:.2f},\n"
+                     "  \"fallback_instructions_compiled\": {},\n"
+                     "  \"fallback_instructions\": [\n{}\n  ]\n"
+                     "}}\n",
+                     stats.blocks_compiled, stats.blocks_recompiled, stats.blocks_fallen_back_to_interpreter,
+                     stats.buffer_flushes, stats.guest_instructions_compiled, stats.host_code_bytes_emitted,
+                     native_bytes_per_guest_instruction, stats.fallback_instructions_compiled, fallbacks);
+}
+
+void DrawCodeQualityStatsWindow()
+{
+  const float framebuffer_scale = Host::GetOSDScale();
+
+  ImGui::SetNextWindowSize(ImVec2(420.0f * framebuffer_scale, 400.0f * framebuffer_scale), ImGuiCond_FirstUseEver);
+  if (!ImGui::Begin("JIT Statistics", nullptr))
+  {
+    ImGui::End();
+    return;
+  }
+
+  const CodeQualityStats& stats = s_code_quality_stats;
+  ImGui::Text("Blocks Compiled: %llu (%llu recompiles, %llu fell back to interpreter)",
+              static_cast<unsigned long long>(stats.blocks_compiled),
+              static_cast<unsigned long long>(stats.blocks_recompiled),
+              static_cast<unsigned long long>(stats.blocks_fallen_back_to_interpreter));
+  ImGui::Text("Guest Instructions: %llu (%.2f native bytes each)",
+              static_cast<unsigned long long>(stats.guest_instructions_compiled),
+              (stats.guest_instructions_compiled > 0) ?
+                (static_cast<double>(stats.host_code_bytes_emitted) /
+                 static_cast<double>(stats.guest_instructions_compiled)) :
+                0.0);
+  ImGui::Text("Fallback Instructions: %llu (%.2f%% of compiled)",
+              static_cast<unsigned long long>(stats.fallback_instructions_compiled),
+              (stats.guest_instructions_compiled > 0) ?
+                ((static_cast<double>(stats.fallback_instructions_compiled) /
+                  static_cast<double>(stats.guest_instructions_compiled)) *
+                 100.0) :
+                0.0);
+
+#ifdef WITH_RECOMPILER
+  if (s_code_buffer.IsValid())
+  {
+    ImGui::Text("Code Buffer: %.1f%% near / %.1f%% far used, %llu flushes", s_code_buffer.GetUsedPct(),
+                s_code_buffer.GetFarUsedPct(), static_cast<unsigned long long>(stats.buffer_flushes));
+  }
+#endif
+
+  if (ImGui::Button("Dump To JSON"))
+  {
+    const std::string path = Path::Combine(EmuFolders::Dumps, "jit_stats.json");
+    if (FileSystem::WriteStringToFile(path.c_str(), GetCodeQualityStatsJSON()))
+      Log_InfoPrintf("Dumped JIT statistics to '%s'", path.c_str());
+    else
+      Log_ErrorPrintf("Failed to dump JIT statistics to '%s'", path.c_str());
+  }
+
+  ImGui::Separator();
+  ImGui::Text("Fallback Instructions By Opcode:");
+
+  std::vector<const FallbackRecord*> sorted_records;
+  sorted_records.reserve(s_fallback_records.size());
+  for (const auto& [key, record] : s_fallback_records)
+    sorted_records.push_back(&record);
+  std::sort(sorted_records.begin(), sorted_records.end(),
+            [](const FallbackRecord* lhs, const FallbackRecord* rhs) { return lhs->count > rhs->count; });
+
+  for (const FallbackRecord* record : sorted_records)
+  {
+    SmallString disasm;
+    DisassembleInstruction(&disasm, record->example_pc, record->example_bits);
+    ImGui::Text("%10llu  %s", static_cast<unsigned long long>(record->count), disasm.GetCharArray());
+  }
+
+  ImGui::End();
+}
+
+
 } // namespace CPU::CodeCache
 
 #ifdef WITH_RECOMPILER
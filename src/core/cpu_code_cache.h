@@ -10,6 +10,7 @@
 #include <array>
 #include <map>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -73,6 +74,9 @@ struct CodeBlock
     void* host_pc;
     void* host_resolve_pc;
     u32 host_pc_size;
+
+    // Copy of block->key, so the successor search doesn't have to dereference each candidate.
+    u32 key_bits;
   };
 
   CodeBlock(const CodeBlockKey key_) : key(key_) {}
@@ -96,11 +100,16 @@ struct CodeBlock
   bool contains_double_branches = false;
   bool invalidated = false;
   bool can_link = true;
+  bool is_idle_loop = false;
 
   u32 recompile_frame_number = 0;
   u32 recompile_count = 0;
   u32 invalidate_frame_number = 0;
 
+  // Number of times this block has executed in the interpreter tier. Only maintained when tiered
+  // compilation is enabled; blocks are promoted to the recompiler once this crosses the threshold.
+  u32 execution_count = 0;
+
   u32 GetPC() const { return key.GetPC(); }
   u32 GetSizeInBytes() const { return static_cast<u32>(instructions.size()) * sizeof(Instruction); }
   u32 GetStartPageIndex() const { return (key.GetPCPhysicalAddress() / HOST_PAGE_SIZE); }
@@ -141,6 +150,20 @@ JitCodeBuffer& GetCodeBuffer();
 /// Flushes the code cache, forcing all blocks to be recompiled.
 void Flush();
 
+/// Code quality telemetry. These counters only grow during compilation, never per executed
+/// instruction, so they are collected unconditionally.
+void AddFallbackInstruction(u32 pc, u32 instruction_bits);
+
+/// Serializes the telemetry counters to a JSON string.
+std::string GetCodeQualityStatsJSON();
+
+/// Draws the JIT statistics debug window (Debug/ShowJITStats).
+void DrawCodeQualityStatsWindow();
+
+/// Returns the number of guest instructions in the block starting at pc, or zero if no such block
+/// currently exists. Used by the guest profiler to weight samples.
+u32 GetBlockInstructionCount(u32 pc);
+
 /// Changes whether the recompiler is enabled.
 void Reinitialize();
 
@@ -22,6 +22,23 @@
 
 Log_SetChannel(CPU::Core);
 
+// GCC/Clang support threading the interpreter's opcode dispatch through a labels-as-values table,
+// which gives every handler its own indirect branch instead of the single shared branch a switch
+// compiles to, and lets the host branch predictor track per-opcode targets. MSVC has no
+// equivalent, so it keeps the switch.
+#if defined(__GNUC__) || defined(__clang__)
+#define CPU_THREADED_INTERPRETER_DISPATCH 1
+#endif
+
+// The label table makes ExecuteInstruction() uninlinable on GCC ("function can never be copied
+// because it saves address of local label in a static variable"), so the force-inline attribute
+// only applies to the switch-based dispatch.
+#ifdef CPU_THREADED_INTERPRETER_DISPATCH
+#define EXECUTE_INSTRUCTION_INLINE
+#else
+#define EXECUTE_INSTRUCTION_INLINE ALWAYS_INLINE_RELEASE
+#endif
+
 namespace CPU {
 
 static void SetPC(u32 new_pc);
@@ -38,6 +55,17 @@ static std::FILE* s_log_file = nullptr;
 static bool s_log_file_opened = false;
 static bool s_trace_to_log = false;
 
+// Components of the debug dispatcher which cost time per instruction. The active set is baked
+// into the execute loop as a template parameter, so e.g. a TTY-logging session doesn't pay for
+// breakpoint checks on every instruction; UpdateDebugDispatcherFlag() exits the current loop and
+// re-selects when the set changes.
+enum : u32
+{
+  DEBUG_DISPATCH_BREAKPOINTS = (1u << 0), // user breakpoints, cop0 breakpoints, single-stepping
+  DEBUG_DISPATCH_TRACING = (1u << 1),     // instruction trace logging, A0/B0 syscall interception
+};
+static u32 s_debug_dispatch_features = 0;
+
 static constexpr u32 INVALID_BREAKPOINT_PC = UINT32_C(0xFFFFFFFF);
 static std::vector<Breakpoint> s_breakpoints;
 static u32 s_breakpoint_counter = 1;
@@ -45,6 +73,11 @@ static u32 s_last_breakpoint_check_pc = INVALID_BREAKPOINT_PC;
 static bool s_single_step = false;
 static bool s_single_step_done = false;
 
+static constexpr PhysicalMemoryAddress INVALID_WATCHPOINT_OFFSET = UINT32_C(0xFFFFFFFF);
+static std::vector<Watchpoint> s_watchpoints;
+static u32 s_watchpoint_counter = 1;
+static PhysicalMemoryAddress s_last_watchpoint_hit_offset = INVALID_WATCHPOINT_OFFSET;
+
 bool IsTraceEnabled()
 {
   return s_trace_to_log;
@@ -104,6 +137,10 @@ void Initialize()
   s_last_breakpoint_check_pc = INVALID_BREAKPOINT_PC;
   s_single_step = false;
 
+  s_watchpoints.clear();
+  s_watchpoint_counter = 1;
+  s_last_watchpoint_hit_offset = INVALID_WATCHPOINT_OFFSET;
+
   UpdateFastmemBase();
 
   GTE::Initialize();
@@ -112,6 +149,7 @@ void Initialize()
 void Shutdown()
 {
   ClearBreakpoints();
+  ClearWatchpoints();
   StopTrace();
 }
 
@@ -225,13 +263,20 @@ ALWAYS_INLINE_RELEASE void SetPC(u32 new_pc)
   FlushPipeline();
 }
 
+NEVER_INLINE static void RaiseMisalignedBranchException(u32 target)
+{
+  // The BadVaddr and EPC must be set to the fetching address, not the instruction about to execute.
+  g_state.cop0_regs.BadVaddr = target;
+  RaiseException(Cop0Registers::CAUSE::MakeValueForException(Exception::AdEL, false, false, 0), target);
+}
+
 ALWAYS_INLINE_RELEASE void Branch(u32 target)
 {
-  if (!Common::IsAlignedPow2(target, 4))
+  // Keep the exception path out of line, otherwise it gets duplicated into every branch case of
+  // the interpreter switch and bloats the hot loop.
+  if (!Common::IsAlignedPow2(target, 4)) [[unlikely]]
   {
-    // The BadVaddr and EPC must be set to the fetching address, not the instruction about to execute.
-    g_state.cop0_regs.BadVaddr = target;
-    RaiseException(Cop0Registers::CAUSE::MakeValueForException(Exception::AdEL, false, false, 0), target);
+    RaiseMisalignedBranchException(target);
     return;
   }
 
@@ -299,12 +344,12 @@ ALWAYS_INLINE_RELEASE static void DispatchCop0Breakpoint()
                  g_state.current_instruction_pc, GetExceptionVector(true));
 }
 
-void RaiseException(u32 CAUSE_bits, u32 EPC)
+NEVER_INLINE void RaiseException(u32 CAUSE_bits, u32 EPC)
 {
   RaiseException(CAUSE_bits, EPC, GetExceptionVector());
 }
 
-void RaiseException(Exception excode)
+NEVER_INLINE void RaiseException(Exception excode)
 {
   RaiseException(Cop0Registers::CAUSE::MakeValueForException(excode, g_state.current_instruction_in_branch_delay_slot,
                                                              g_state.current_instruction_was_branch_taken,
@@ -312,12 +357,14 @@ void RaiseException(Exception excode)
                  g_state.current_instruction_pc, GetExceptionVector());
 }
 
-void RaiseBreakException(u32 CAUSE_bits, u32 EPC, u32 instruction_bits)
+NEVER_INLINE void RaiseBreakException(u32 CAUSE_bits, u32 EPC, u32 instruction_bits)
 {
-  if (PCDrv::HandleSyscall(instruction_bits, g_state.regs))
+  const PCDrv::SyscallResult pcdrv_result = PCDrv::HandleSyscall(instruction_bits, g_state.regs);
+  if (pcdrv_result != PCDrv::SyscallResult::NotHandled)
   {
-    // immediately return
-    g_state.npc = EPC + 4;
+    // immediately return. stalled requests park the guest on the break instruction until the host
+    // I/O completes, so timing events keep running instead of the emulation thread blocking.
+    g_state.npc = EPC + ((pcdrv_result == PCDrv::SyscallResult::Stalled) ? 0 : 4);
     FlushPipeline();
     return;
   }
@@ -825,7 +872,7 @@ void DisassembleAndPrint(u32 addr, u32 instructions_before /* = 0 */, u32 instru
 }
 
 template<PGXPMode pgxp_mode, bool debug>
-ALWAYS_INLINE_RELEASE static void ExecuteInstruction()
+EXECUTE_INSTRUCTION_INLINE static void ExecuteInstruction()
 {
 restart_instruction:
   const Instruction inst = g_state.current_instruction;
@@ -847,9 +894,38 @@ restart_instruction:
   if (inst.bits == 0)
     return;
 
+#ifdef CPU_THREADED_INTERPRETER_DISPATCH
+
+  // Handler table indexed by the 6-bit primary opcode. Unassigned opcodes go to the
+  // reserved-instruction handler, matching the switch's default case.
+  static const void* const dispatch_table[64] = {
+    &&op_funct,   &&op_b,       &&op_j,       &&op_jal,     &&op_beq,     &&op_bne,     &&op_blez,    &&op_bgtz,
+    &&op_addi,    &&op_addiu,   &&op_slti,    &&op_sltiu,   &&op_andi,    &&op_ori,     &&op_xori,    &&op_lui,
+    &&op_cop0,    &&op_cop1,    &&op_cop2,    &&op_cop3,    &&op_illegal, &&op_illegal, &&op_illegal, &&op_illegal,
+    &&op_illegal, &&op_illegal, &&op_illegal, &&op_illegal, &&op_illegal, &&op_illegal, &&op_illegal, &&op_illegal,
+    &&op_lb,      &&op_lh,      &&op_lwl,     &&op_lw,      &&op_lbu,     &&op_lhu,     &&op_lwr,     &&op_illegal,
+    &&op_sb,      &&op_sh,      &&op_swl,     &&op_sw,      &&op_illegal, &&op_illegal, &&op_swr,     &&op_illegal,
+    &&op_lwc0,    &&op_lwc1,    &&op_lwc2,    &&op_lwc3,    &&op_illegal, &&op_illegal, &&op_illegal, &&op_illegal,
+    &&op_swc0,    &&op_swc1,    &&op_swc2,    &&op_swc3,    &&op_illegal, &&op_illegal, &&op_illegal, &&op_illegal,
+  };
+
+#define OP_CASE(name) op_##name
+#define OP_DEFAULT op_illegal
+#define OP_END goto dispatch_exit
+
+  goto* dispatch_table[inst.bits >> 26];
+
+#else // CPU_THREADED_INTERPRETER_DISPATCH
+
+#define OP_CASE(name) case InstructionOp::name
+#define OP_DEFAULT default
+#define OP_END break
+
   switch (inst.op)
   {
-    case InstructionOp::funct:
+
+#endif // CPU_THREADED_INTERPRETER_DISPATCH
+    OP_CASE(funct):
     {
       switch (inst.r.funct)
       {
@@ -961,7 +1037,7 @@ restart_instruction:
           const u32 old_value = ReadReg(inst.r.rs);
           const u32 add_value = ReadReg(inst.r.rt);
           const u32 new_value = old_value + add_value;
-          if (AddOverflow(old_value, add_value, new_value))
+          if (AddOverflow(old_value, add_value, new_value)) [[unlikely]]
           {
             RaiseException(Exception::Ov);
             return;
@@ -1007,7 +1083,7 @@ restart_instruction:
           const u32 old_value = ReadReg(inst.r.rs);
           const u32 sub_value = ReadReg(inst.r.rt);
           const u32 new_value = old_value - sub_value;
-          if (SubOverflow(old_value, sub_value, new_value))
+          if (SubOverflow(old_value, sub_value, new_value)) [[unlikely]]
           {
             RaiseException(Exception::Ov);
             return;
@@ -1206,9 +1282,9 @@ restart_instruction:
         }
       }
     }
-    break;
+    OP_END;
 
-    case InstructionOp::lui:
+    OP_CASE(lui):
     {
       const u32 value = inst.i.imm_zext32() << 16;
       WriteReg(inst.i.rt, value);
@@ -1216,9 +1292,9 @@ restart_instruction:
       if constexpr (pgxp_mode >= PGXPMode::CPU)
         PGXP::CPU_LUI(inst.bits);
     }
-    break;
+    OP_END;
 
-    case InstructionOp::andi:
+    OP_CASE(andi):
     {
       const u32 new_value = ReadReg(inst.i.rs) & inst.i.imm_zext32();
 
@@ -1227,9 +1303,9 @@ restart_instruction:
 
       WriteReg(inst.i.rt, new_value);
     }
-    break;
+    OP_END;
 
-    case InstructionOp::ori:
+    OP_CASE(ori):
     {
       const u32 new_value = ReadReg(inst.i.rs) | inst.i.imm_zext32();
 
@@ -1238,9 +1314,9 @@ restart_instruction:
 
       WriteReg(inst.i.rt, new_value);
     }
-    break;
+    OP_END;
 
-    case InstructionOp::xori:
+    OP_CASE(xori):
     {
       const u32 new_value = ReadReg(inst.i.rs) ^ inst.i.imm_zext32();
 
@@ -1249,14 +1325,14 @@ restart_instruction:
 
       WriteReg(inst.i.rt, new_value);
     }
-    break;
+    OP_END;
 
-    case InstructionOp::addi:
+    OP_CASE(addi):
     {
       const u32 old_value = ReadReg(inst.i.rs);
       const u32 add_value = inst.i.imm_sext32();
       const u32 new_value = old_value + add_value;
-      if (AddOverflow(old_value, add_value, new_value))
+      if (AddOverflow(old_value, add_value, new_value)) [[unlikely]]
       {
         RaiseException(Exception::Ov);
         return;
@@ -1275,9 +1351,9 @@ restart_instruction:
 
       WriteReg(inst.i.rt, new_value);
     }
-    break;
+    OP_END;
 
-    case InstructionOp::addiu:
+    OP_CASE(addiu):
     {
       const u32 old_value = ReadReg(inst.i.rs);
       const u32 add_value = inst.i.imm_sext32();
@@ -1296,9 +1372,9 @@ restart_instruction:
 
       WriteReg(inst.i.rt, new_value);
     }
-    break;
+    OP_END;
 
-    case InstructionOp::slti:
+    OP_CASE(slti):
     {
       const u32 result = BoolToUInt32(static_cast<s32>(ReadReg(inst.i.rs)) < static_cast<s32>(inst.i.imm_sext32()));
 
@@ -1307,9 +1383,9 @@ restart_instruction:
 
       WriteReg(inst.i.rt, result);
     }
-    break;
+    OP_END;
 
-    case InstructionOp::sltiu:
+    OP_CASE(sltiu):
     {
       const u32 result = BoolToUInt32(ReadReg(inst.i.rs) < inst.i.imm_sext32());
 
@@ -1318,9 +1394,9 @@ restart_instruction:
 
       WriteReg(inst.i.rt, result);
     }
-    break;
+    OP_END;
 
-    case InstructionOp::lb:
+    OP_CASE(lb):
     {
       const VirtualMemoryAddress addr = ReadReg(inst.i.rs) + inst.i.imm_sext32();
       if constexpr (debug)
@@ -1337,9 +1413,9 @@ restart_instruction:
       if constexpr (pgxp_mode >= PGXPMode::Memory)
         PGXP::CPU_LBx(inst.bits, addr, sxvalue);
     }
-    break;
+    OP_END;
 
-    case InstructionOp::lh:
+    OP_CASE(lh):
     {
       const VirtualMemoryAddress addr = ReadReg(inst.i.rs) + inst.i.imm_sext32();
       if constexpr (debug)
@@ -1355,9 +1431,9 @@ restart_instruction:
       if constexpr (pgxp_mode >= PGXPMode::Memory)
         PGXP::CPU_LH(inst.bits, addr, sxvalue);
     }
-    break;
+    OP_END;
 
-    case InstructionOp::lw:
+    OP_CASE(lw):
     {
       const VirtualMemoryAddress addr = ReadReg(inst.i.rs) + inst.i.imm_sext32();
       if constexpr (debug)
@@ -1372,9 +1448,9 @@ restart_instruction:
       if constexpr (pgxp_mode >= PGXPMode::Memory)
         PGXP::CPU_LW(inst.bits, addr, value);
     }
-    break;
+    OP_END;
 
-    case InstructionOp::lbu:
+    OP_CASE(lbu):
     {
       const VirtualMemoryAddress addr = ReadReg(inst.i.rs) + inst.i.imm_sext32();
       if constexpr (debug)
@@ -1390,9 +1466,9 @@ restart_instruction:
       if constexpr (pgxp_mode >= PGXPMode::Memory)
         PGXP::CPU_LBx(inst.bits, addr, zxvalue);
     }
-    break;
+    OP_END;
 
-    case InstructionOp::lhu:
+    OP_CASE(lhu):
     {
       const VirtualMemoryAddress addr = ReadReg(inst.i.rs) + inst.i.imm_sext32();
       if constexpr (debug)
@@ -1408,10 +1484,10 @@ restart_instruction:
       if constexpr (pgxp_mode >= PGXPMode::Memory)
         PGXP::CPU_LHU(inst.bits, addr, zxvalue);
     }
-    break;
+    OP_END;
 
-    case InstructionOp::lwl:
-    case InstructionOp::lwr:
+    OP_CASE(lwl):
+    OP_CASE(lwr):
     {
       const VirtualMemoryAddress addr = ReadReg(inst.i.rs) + inst.i.imm_sext32();
       const VirtualMemoryAddress aligned_addr = addr & ~UINT32_C(3);
@@ -1442,9 +1518,9 @@ restart_instruction:
       if constexpr (pgxp_mode >= PGXPMode::Memory)
         PGXP::CPU_LW(inst.bits, addr, new_value);
     }
-    break;
+    OP_END;
 
-    case InstructionOp::sb:
+    OP_CASE(sb):
     {
       const VirtualMemoryAddress addr = ReadReg(inst.i.rs) + inst.i.imm_sext32();
       if constexpr (debug)
@@ -1456,9 +1532,9 @@ restart_instruction:
       if constexpr (pgxp_mode >= PGXPMode::Memory)
         PGXP::CPU_SB(inst.bits, addr, value);
     }
-    break;
+    OP_END;
 
-    case InstructionOp::sh:
+    OP_CASE(sh):
     {
       const VirtualMemoryAddress addr = ReadReg(inst.i.rs) + inst.i.imm_sext32();
       if constexpr (debug)
@@ -1470,9 +1546,9 @@ restart_instruction:
       if constexpr (pgxp_mode >= PGXPMode::Memory)
         PGXP::CPU_SH(inst.bits, addr, value);
     }
-    break;
+    OP_END;
 
-    case InstructionOp::sw:
+    OP_CASE(sw):
     {
       const VirtualMemoryAddress addr = ReadReg(inst.i.rs) + inst.i.imm_sext32();
       if constexpr (debug)
@@ -1484,10 +1560,10 @@ restart_instruction:
       if constexpr (pgxp_mode >= PGXPMode::Memory)
         PGXP::CPU_SW(inst.bits, addr, value);
     }
-    break;
+    OP_END;
 
-    case InstructionOp::swl:
-    case InstructionOp::swr:
+    OP_CASE(swl):
+    OP_CASE(swr):
     {
       const VirtualMemoryAddress addr = ReadReg(inst.i.rs) + inst.i.imm_sext32();
       const VirtualMemoryAddress aligned_addr = addr & ~UINT32_C(3);
@@ -1517,24 +1593,24 @@ restart_instruction:
       if constexpr (pgxp_mode >= PGXPMode::Memory)
         PGXP::CPU_SW(inst.bits, aligned_addr, new_value);
     }
-    break;
+    OP_END;
 
-    case InstructionOp::j:
+    OP_CASE(j):
     {
       g_state.next_instruction_is_branch_delay_slot = true;
       Branch((g_state.pc & UINT32_C(0xF0000000)) | (inst.j.target << 2));
     }
-    break;
+    OP_END;
 
-    case InstructionOp::jal:
+    OP_CASE(jal):
     {
       WriteReg(Reg::ra, g_state.npc);
       g_state.next_instruction_is_branch_delay_slot = true;
       Branch((g_state.pc & UINT32_C(0xF0000000)) | (inst.j.target << 2));
     }
-    break;
+    OP_END;
 
-    case InstructionOp::beq:
+    OP_CASE(beq):
     {
       // We're still flagged as a branch delay slot even if the branch isn't taken.
       g_state.next_instruction_is_branch_delay_slot = true;
@@ -1542,36 +1618,36 @@ restart_instruction:
       if (branch)
         Branch(g_state.pc + (inst.i.imm_sext32() << 2));
     }
-    break;
+    OP_END;
 
-    case InstructionOp::bne:
+    OP_CASE(bne):
     {
       g_state.next_instruction_is_branch_delay_slot = true;
       const bool branch = (ReadReg(inst.i.rs) != ReadReg(inst.i.rt));
       if (branch)
         Branch(g_state.pc + (inst.i.imm_sext32() << 2));
     }
-    break;
+    OP_END;
 
-    case InstructionOp::bgtz:
+    OP_CASE(bgtz):
     {
       g_state.next_instruction_is_branch_delay_slot = true;
       const bool branch = (static_cast<s32>(ReadReg(inst.i.rs)) > 0);
       if (branch)
         Branch(g_state.pc + (inst.i.imm_sext32() << 2));
     }
-    break;
+    OP_END;
 
-    case InstructionOp::blez:
+    OP_CASE(blez):
     {
       g_state.next_instruction_is_branch_delay_slot = true;
       const bool branch = (static_cast<s32>(ReadReg(inst.i.rs)) <= 0);
       if (branch)
         Branch(g_state.pc + (inst.i.imm_sext32() << 2));
     }
-    break;
+    OP_END;
 
-    case InstructionOp::b:
+    OP_CASE(b):
     {
       g_state.next_instruction_is_branch_delay_slot = true;
       const u8 rt = static_cast<u8>(inst.i.rt.GetValue());
@@ -1588,9 +1664,9 @@ restart_instruction:
       if (branch)
         Branch(g_state.pc + (inst.i.imm_sext32() << 2));
     }
-    break;
+    OP_END;
 
-    case InstructionOp::cop0:
+    OP_CASE(cop0):
     {
       if (InUserMode() && !g_state.cop0_regs.sr.CU0)
       {
@@ -1654,9 +1730,9 @@ restart_instruction:
         }
       }
     }
-    break;
+    OP_END;
 
-    case InstructionOp::cop2:
+    OP_CASE(cop2):
     {
       if (!g_state.cop0_regs.sr.CE2)
       {
@@ -1722,9 +1798,9 @@ restart_instruction:
         GTE::ExecuteInstruction(inst.bits);
       }
     }
-    break;
+    OP_END;
 
-    case InstructionOp::lwc2:
+    OP_CASE(lwc2):
     {
       if (!g_state.cop0_regs.sr.CE2)
       {
@@ -1744,9 +1820,9 @@ restart_instruction:
       if constexpr (pgxp_mode >= PGXPMode::Memory)
         PGXP::CPU_LWC2(inst.bits, addr, value);
     }
-    break;
+    OP_END;
 
-    case InstructionOp::swc2:
+    OP_CASE(swc2):
     {
       if (!g_state.cop0_regs.sr.CE2)
       {
@@ -1764,23 +1840,23 @@ restart_instruction:
       if constexpr (pgxp_mode >= PGXPMode::Memory)
         PGXP::CPU_SWC2(inst.bits, addr, value);
     }
-    break;
+    OP_END;
 
       // swc0/lwc0/cop1/cop3 are essentially no-ops
-    case InstructionOp::cop1:
-    case InstructionOp::cop3:
-    case InstructionOp::lwc0:
-    case InstructionOp::lwc1:
-    case InstructionOp::lwc3:
-    case InstructionOp::swc0:
-    case InstructionOp::swc1:
-    case InstructionOp::swc3:
+    OP_CASE(cop1):
+    OP_CASE(cop3):
+    OP_CASE(lwc0):
+    OP_CASE(lwc1):
+    OP_CASE(lwc3):
+    OP_CASE(swc0):
+    OP_CASE(swc1):
+    OP_CASE(swc3):
     {
     }
-    break;
+    OP_END;
 
       // everything else is reserved/invalid
-    default:
+    OP_DEFAULT:
     {
       u32 ram_value;
       if (SafeReadInstruction(g_state.current_instruction_pc, &ram_value) &&
@@ -1794,11 +1870,19 @@ restart_instruction:
 
       RaiseException(Exception::RI);
     }
-    break;
+    OP_END;
+#ifdef CPU_THREADED_INTERPRETER_DISPATCH
+dispatch_exit:;
+#else
   }
+#endif
+
+#undef OP_CASE
+#undef OP_DEFAULT
+#undef OP_END
 }
 
-void DispatchInterrupt()
+NEVER_INLINE void DispatchInterrupt()
 {
   // If the instruction we're about to execute is a GTE instruction, delay dispatching the interrupt until the next
   // instruction. For some reason, if we don't do this, we end up with incorrectly sorted polygons and flickering..
@@ -1823,18 +1907,23 @@ void UpdateDebugDispatcherFlag()
 {
   const bool has_any_breakpoints = !s_breakpoints.empty();
 
-  // TODO: cop0 breakpoints
   const auto& dcic = g_state.cop0_regs.dcic;
-  const bool has_cop0_breakpoints =
-    dcic.super_master_enable_1 && dcic.super_master_enable_2 && dcic.execution_breakpoint_enable;
+  const bool has_cop0_breakpoints = dcic.super_master_enable_1 && dcic.super_master_enable_2 &&
+                                    (dcic.execution_breakpoint_enable || dcic.data_access_breakpoint);
 
-  const bool use_debug_dispatcher =
-    has_any_breakpoints || has_cop0_breakpoints || s_trace_to_log ||
-    (g_settings.cpu_execution_mode == CPUExecutionMode::Interpreter && g_settings.bios_tty_logging);
-  if (use_debug_dispatcher == g_state.use_debug_dispatcher)
+  u32 features = 0;
+  if (has_any_breakpoints || has_cop0_breakpoints)
+    features |= DEBUG_DISPATCH_BREAKPOINTS;
+  if (s_trace_to_log || (g_settings.cpu_execution_mode == CPUExecutionMode::Interpreter && g_settings.bios_tty_logging))
+    features |= DEBUG_DISPATCH_TRACING;
+
+  const bool use_debug_dispatcher = (features != 0);
+  if (features == s_debug_dispatch_features && use_debug_dispatcher == g_state.use_debug_dispatcher)
     return;
 
-  Log_DevPrintf("%s debug dispatcher", use_debug_dispatcher ? "Now using" : "No longer using");
+  Log_DevPrintf("%s debug dispatcher (features 0x%X)", use_debug_dispatcher ? "Now using" : "No longer using",
+                features);
+  s_debug_dispatch_features = features;
   g_state.use_debug_dispatcher = use_debug_dispatcher;
   if (System::IsExecuting())
     ExitExecution();
@@ -2010,6 +2099,126 @@ bool AddStepOutBreakpoint(u32 max_instructions_to_search)
   return false;
 }
 
+static void UpdateWatchedPageFlags()
+{
+  Bus::ClearRAMWatchedPageFlags();
+
+  for (const Watchpoint& wp : s_watchpoints)
+  {
+    if (!wp.enabled)
+      continue;
+
+    const PhysicalMemoryAddress start_offset = (wp.address & PHYSICAL_MEMORY_ADDRESS_MASK) & Bus::g_ram_mask;
+    const u32 last_page = (start_offset + (wp.size - 1)) / HOST_PAGE_SIZE;
+    for (u32 page = start_offset / HOST_PAGE_SIZE; page <= last_page; page++)
+      Bus::SetRAMWatchedPage(page);
+  }
+}
+
+bool HasAnyWatchpoints()
+{
+  return !s_watchpoints.empty();
+}
+
+bool HasWatchpointAtAddress(VirtualMemoryAddress address)
+{
+  for (const Watchpoint& wp : s_watchpoints)
+  {
+    if (wp.address == address)
+      return true;
+  }
+
+  return false;
+}
+
+WatchpointList GetWatchpointList()
+{
+  return s_watchpoints;
+}
+
+bool AddWatchpoint(VirtualMemoryAddress address, u32 size, bool enabled)
+{
+  if (size == 0 || HasWatchpointAtAddress(address))
+    return false;
+
+  const PhysicalMemoryAddress paddr = address & PHYSICAL_MEMORY_ADDRESS_MASK;
+  if (!Bus::IsRAMAddress(paddr) || ((paddr & Bus::g_ram_mask) + size) > Bus::g_ram_size)
+  {
+    Host::ReportFormattedDebuggerMessage(
+      TRANSLATE("DebuggerMessage", "0x%08X is not a RAM address, not adding watchpoint."), address);
+    return false;
+  }
+
+  Log_InfoPrintf("Adding %u-byte watchpoint at %08X", size, address);
+
+  Watchpoint wp{address, size, s_watchpoint_counter++, 0, enabled};
+  s_watchpoints.push_back(std::move(wp));
+  UpdateWatchedPageFlags();
+
+  Host::ReportFormattedDebuggerMessage(TRANSLATE("DebuggerMessage", "Added watchpoint at 0x%08X."), address);
+  return true;
+}
+
+bool RemoveWatchpoint(VirtualMemoryAddress address)
+{
+  auto it = std::find_if(s_watchpoints.begin(), s_watchpoints.end(),
+                         [address](const Watchpoint& wp) { return wp.address == address; });
+  if (it == s_watchpoints.end())
+    return false;
+
+  Host::ReportFormattedDebuggerMessage(TRANSLATE("DebuggerMessage", "Removed watchpoint at 0x%08X."),
+                                       address);
+
+  s_watchpoints.erase(it);
+  s_last_watchpoint_hit_offset = INVALID_WATCHPOINT_OFFSET;
+  UpdateWatchedPageFlags();
+  return true;
+}
+
+void ClearWatchpoints()
+{
+  s_watchpoints.clear();
+  s_watchpoint_counter = 1;
+  s_last_watchpoint_hit_offset = INVALID_WATCHPOINT_OFFSET;
+  UpdateWatchedPageFlags();
+}
+
+void CheckWatchpoints(PhysicalMemoryAddress ram_offset, u32 size)
+{
+  // Safe memory writes from the host (debugger pokes, cheats) also land here, and we can't exit
+  // execution when we aren't executing.
+  if (!System::IsExecuting())
+    return;
+
+  // In the recompiler and cached interpreter the store which paused us re-executes when the block
+  // resumes, since the resume point is behind the store. Swallow exactly one repeat hit at the same
+  // offset so that resuming makes forward progress.
+  if (ram_offset == s_last_watchpoint_hit_offset)
+  {
+    s_last_watchpoint_hit_offset = INVALID_WATCHPOINT_OFFSET;
+    return;
+  }
+
+  for (Watchpoint& wp : s_watchpoints)
+  {
+    const PhysicalMemoryAddress wp_offset = (wp.address & PHYSICAL_MEMORY_ADDRESS_MASK) & Bus::g_ram_mask;
+    if (!wp.enabled || (ram_offset + size) <= wp_offset || (wp_offset + wp.size) <= ram_offset)
+      continue;
+
+    wp.hit_count++;
+
+    System::PauseSystem(true);
+    Host::ReportFormattedDebuggerMessage("Hit watchpoint %u with write to 0x%08X.", wp.number,
+                                         UINT32_C(0x80000000) | ram_offset);
+
+    const bool will_reexecute_store = !g_state.use_debug_dispatcher &&
+                                      g_settings.cpu_execution_mode != CPUExecutionMode::Interpreter &&
+                                      !TimingEvents::IsRunningEvents();
+    s_last_watchpoint_hit_offset = will_reexecute_store ? ram_offset : INVALID_WATCHPOINT_OFFSET;
+    ExitExecution();
+  }
+}
+
 ALWAYS_INLINE_RELEASE static bool BreakpointCheck()
 {
   const u32 pc = g_state.pc;
@@ -2084,7 +2293,7 @@ ALWAYS_INLINE_RELEASE static bool BreakpointCheck()
   return System::IsPaused();
 }
 
-template<PGXPMode pgxp_mode, bool debug>
+template<PGXPMode pgxp_mode, u32 debug_features>
 [[noreturn]] static void ExecuteImpl()
 {
   for (;;)
@@ -2093,7 +2302,7 @@ template<PGXPMode pgxp_mode, bool debug>
 
     while (g_state.pending_ticks < g_state.downcount)
     {
-      if constexpr (debug)
+      if constexpr ((debug_features & DEBUG_DISPATCH_BREAKPOINTS) != 0)
       {
         Cop0ExecutionBreakpointCheck();
 
@@ -2116,11 +2325,11 @@ template<PGXPMode pgxp_mode, bool debug>
       g_state.exception_raised = false;
 
       // fetch the next instruction - even if this fails, it'll still refetch on the flush so we can continue
-      if (!FetchInstruction())
+      if (!FetchInstruction()) [[unlikely]]
         continue;
 
       // trace functionality
-      if constexpr (debug)
+      if constexpr ((debug_features & DEBUG_DISPATCH_TRACING) != 0)
       {
         if (s_trace_to_log)
           LogInstruction(g_state.current_instruction.bits, g_state.current_instruction_pc, &g_state.regs);
@@ -2140,26 +2349,76 @@ template<PGXPMode pgxp_mode, bool debug>
 #endif
 
       // execute the instruction we previously fetched
-      ExecuteInstruction<pgxp_mode, debug>();
+      // the per-instruction debug checks (cop0 data breakpoints) are only needed when
+      // breakpoints are active, not for tracing/TTY interception
+      ExecuteInstruction<pgxp_mode, ((debug_features & DEBUG_DISPATCH_BREAKPOINTS) != 0)>();
 
       // next load delay
       UpdateLoadDelay();
+
+      if constexpr (debug_features == 0)
+      {
+        // If that was a taken branch, execute the delay slot in the same dispatch round-trip
+        // instead of going back through the loop header. The recompiler already treats a branch
+        // and its delay slot as one unit (they never straddle a block), so this matches its event
+        // granularity. A delay slot which is itself a branch leaves the flag set again and falls
+        // back to the outer loop.
+        if (g_state.next_instruction_is_branch_delay_slot)
+        {
+          g_state.pending_ticks++;
+
+          g_state.current_instruction.bits = g_state.next_instruction.bits;
+          g_state.current_instruction_pc = g_state.pc;
+          g_state.current_instruction_in_branch_delay_slot = true;
+          g_state.current_instruction_was_branch_taken = g_state.branch_was_taken;
+          g_state.next_instruction_is_branch_delay_slot = false;
+          g_state.branch_was_taken = false;
+          g_state.exception_raised = false;
+
+          if (!FetchInstruction()) [[unlikely]]
+            continue;
+
+          ExecuteInstruction<pgxp_mode, false>();
+          UpdateLoadDelay();
+        }
+      }
     }
   }
 }
 
+template<PGXPMode pgxp_mode>
+[[noreturn]] static void ExecuteDebugImpl()
+{
+  // Single-stepping stops after one instruction via the breakpoint check.
+  u32 features = s_debug_dispatch_features;
+  if (s_single_step)
+    features |= DEBUG_DISPATCH_BREAKPOINTS;
+
+  switch (features)
+  {
+    case DEBUG_DISPATCH_BREAKPOINTS:
+      ExecuteImpl<pgxp_mode, DEBUG_DISPATCH_BREAKPOINTS>();
+
+    case DEBUG_DISPATCH_TRACING:
+      ExecuteImpl<pgxp_mode, DEBUG_DISPATCH_TRACING>();
+
+    default:
+      ExecuteImpl<pgxp_mode, DEBUG_DISPATCH_BREAKPOINTS | DEBUG_DISPATCH_TRACING>();
+  }
+}
+
 static void ExecuteDebug()
 {
   if (g_settings.gpu_pgxp_enable)
   {
     if (g_settings.gpu_pgxp_cpu)
-      ExecuteImpl<PGXPMode::CPU, true>();
+      ExecuteDebugImpl<PGXPMode::CPU>();
     else
-      ExecuteImpl<PGXPMode::Memory, true>();
+      ExecuteDebugImpl<PGXPMode::Memory>();
   }
   else
   {
-    ExecuteImpl<PGXPMode::Disabled, true>();
+    ExecuteDebugImpl<PGXPMode::Disabled>();
   }
 }
 
@@ -2195,13 +2454,13 @@ void Execute()
       if (g_settings.gpu_pgxp_enable)
       {
         if (g_settings.gpu_pgxp_cpu)
-          ExecuteImpl<PGXPMode::CPU, false>();
+          ExecuteImpl<PGXPMode::CPU, 0>();
         else
-          ExecuteImpl<PGXPMode::Memory, false>();
+          ExecuteImpl<PGXPMode::Memory, 0>();
       }
       else
       {
-        ExecuteImpl<PGXPMode::Disabled, false>();
+        ExecuteImpl<PGXPMode::Disabled, 0>();
       }
     }
     break;
@@ -2226,17 +2485,24 @@ void InterpretCachedBlock(const CodeBlock& block)
   DebugAssert(g_state.pc == block.GetPC());
   g_state.npc = block.GetPC() + 4;
 
-  for (const CodeBlockInstruction& cbi : block.instructions)
-  {
-    g_state.pending_ticks++;
+  // within a block the flag can only be set by the instruction we just executed, so it's cleared
+  // once here rather than before every instruction
+  g_state.exception_raised = false;
+
+  // the base cycle total for the block is known up front, so count it with a single addition and
+  // trim the unexecuted remainder on an early exit, like the recompiler does
+  g_state.pending_ticks += static_cast<TickCount>(block.instructions.size());
 
+  const CodeBlockInstruction* cbi = block.instructions.data();
+  const CodeBlockInstruction* const end = cbi + block.instructions.size();
+  for (; cbi != end; cbi++)
+  {
     // now executing the instruction we previously fetched
-    g_state.current_instruction.bits = cbi.instruction.bits;
-    g_state.current_instruction_pc = cbi.pc;
-    g_state.current_instruction_in_branch_delay_slot = cbi.is_branch_delay_slot;
+    g_state.current_instruction.bits = cbi->instruction.bits;
+    g_state.current_instruction_pc = cbi->pc;
+    g_state.current_instruction_in_branch_delay_slot = cbi->is_branch_delay_slot;
     g_state.current_instruction_was_branch_taken = g_state.branch_was_taken;
     g_state.branch_was_taken = false;
-    g_state.exception_raised = false;
 
     // update pc
     g_state.pc = g_state.npc;
@@ -2248,8 +2514,13 @@ void InterpretCachedBlock(const CodeBlock& block)
     // next load delay
     UpdateLoadDelay();
 
-    if (g_state.exception_raised)
+    // only instructions the analysis flagged as able to trap need the per-pass exception check;
+    // the recompiler relies on the same flag for its exception exits
+    if (cbi->can_trap && g_state.exception_raised) [[unlikely]]
+    {
+      g_state.pending_ticks -= static_cast<TickCount>(end - (cbi + 1));
       break;
+    }
   }
 
   // cleanup so the interpreter can kick in if needed
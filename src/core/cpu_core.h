@@ -194,6 +194,30 @@ void ClearBreakpoints();
 bool AddStepOverBreakpoint();
 bool AddStepOutBreakpoint(u32 max_instructions_to_search = 1000);
 
+// Write watchpoints - built on the RAM code page protection machinery, so recompiled code keeps running at
+// full speed and only stores which hit a watched page take the slow path. Watchpoints can only be placed on
+// RAM addresses, and writes performed by DMA bypass the CPU and are not observed.
+struct Watchpoint
+{
+  VirtualMemoryAddress address;
+  u32 size;
+  u32 number;
+  u32 hit_count;
+  bool enabled;
+};
+
+using WatchpointList = std::vector<Watchpoint>;
+
+bool HasAnyWatchpoints();
+bool HasWatchpointAtAddress(VirtualMemoryAddress address);
+WatchpointList GetWatchpointList();
+bool AddWatchpoint(VirtualMemoryAddress address, u32 size, bool enabled = true);
+bool RemoveWatchpoint(VirtualMemoryAddress address);
+void ClearWatchpoints();
+
+// Called by the bus when a store lands in a watched RAM page, after the write has been performed.
+void CheckWatchpoints(PhysicalMemoryAddress ram_offset, u32 size);
+
 extern bool TRACE_EXECUTION;
 
 // Debug register introspection
@@ -9,6 +9,7 @@
 #include "gte.h"
 #include "pgxp.h"
 #include "settings.h"
+#include <cstring>
 Log_SetChannel(CPU::Recompiler);
 
 // TODO: Turn load+sext/zext into a single signed/unsigned load
@@ -34,6 +35,15 @@ bool CodeGenerator::CompileBlock(CodeBlock* block, CodeBlock::HostCodePointer* o
   EmitBeginBlock(true);
   BlockPrologue();
 
+  if (m_block->is_idle_loop)
+  {
+    // Idle loops can't change any state until an event fires, so run out the timeslice; the
+    // end-of-block downcount check then sends us straight back to the event loop.
+    Value downcount = m_register_cache.AllocateScratch(RegSize_32);
+    EmitLoadCPUStructField(downcount.GetHostRegister(), RegSize_32, offsetof(State, downcount));
+    EmitStoreCPUStructField(offsetof(State, pending_ticks), downcount);
+  }
+
   m_current_instruction = m_block_start;
   while (m_current_instruction != m_block_end)
   {
@@ -1173,6 +1183,8 @@ void CodeGenerator::WriteNewPC(const Value& value, bool commit)
 
 bool CodeGenerator::Compile_Fallback(const CodeBlockInstruction& cbi)
 {
+  CodeCache::AddFallbackInstruction(cbi.pc, cbi.instruction.bits);
+
   InstructionPrologue(cbi, 1, true);
 
   // flush and invalidate all guest registers, since the fallback could change any of them
@@ -1866,8 +1878,7 @@ bool CodeGenerator::Compile_Add(const CodeBlockInstruction& cbi)
   // detect register moves and handle them for pgxp
   if (g_settings.gpu_pgxp_enable && rhs.HasConstantValue(0))
   {
-    EmitFunctionCall(nullptr, &PGXP::CPU_MOVE,
-                     Value::FromConstantU32((static_cast<u32>(dest) << 8) | (static_cast<u32>(lhs_src))), lhs);
+    EmitPGXPShadowRegisterMove(dest, lhs_src, lhs);
   }
   else if (g_settings.UsingPGXPCPUMode())
   {
@@ -2553,11 +2564,22 @@ bool CodeGenerator::Compile_lui(const CodeBlockInstruction& cbi)
 {
   InstructionPrologue(cbi, 1);
 
-  if (g_settings.UsingPGXPCPUMode())
-    EmitFunctionCall(nullptr, &PGXP::CPU_LUI, Value::FromConstantU32(cbi.instruction.bits));
-
   // rt <- (imm << 16)
   const u32 value = cbi.instruction.i.imm_zext32() << 16;
+
+  if (g_settings.UsingPGXPCPUMode())
+  {
+    // Inline version of PGXP::CPU_LUI(): the entire shadow value is a compile-time constant.
+    u8* const shadow = PGXP::GetShadowCPURegisterPointer(static_cast<u32>(cbi.instruction.i.rt.GetValue()));
+    const float precise_y = static_cast<float>(static_cast<s16>(cbi.instruction.i.imm.GetValue()));
+    u32 y_bits;
+    std::memcpy(&y_bits, &precise_y, sizeof(y_bits));
+    EmitStoreGlobal(shadow + PGXP::SHADOW_VALUE_X_OFFSET, Value::FromConstantU32(0));
+    EmitStoreGlobal(shadow + PGXP::SHADOW_VALUE_Y_OFFSET, Value::FromConstantU32(y_bits));
+    EmitStoreGlobal(shadow + PGXP::SHADOW_VALUE_Z_OFFSET, Value::FromConstantU32(0));
+    EmitStoreGlobal(shadow + PGXP::SHADOW_VALUE_FLAGS_OFFSET, Value::FromConstantU32(PGXP::SHADOW_VALUE_VALID_01_FLAGS));
+    EmitStoreGlobal(shadow + PGXP::SHADOW_VALUE_VALUE_OFFSET, Value::FromConstantU32(value));
+  }
   m_register_cache.WriteGuestRegister(cbi.instruction.i.rt, Value::FromConstantU32(value));
   SpeculativeWriteReg(cbi.instruction.i.rt, value);
 
@@ -2834,6 +2856,7 @@ Value CodeGenerator::DoGTERegisterRead(u32 index)
   {
     case 28: // IRGB
     case 29: // ORGB
+    case 63: // FLAG - the master error bit is materialized on read
     {
       EmitFunctionCall(&value, &GTE::ReadRegister, Value::FromConstantU32(index));
     }
@@ -2931,6 +2954,40 @@ void CodeGenerator::DoGTERegisterWrite(u32 index, const Value& value)
   }
 }
 
+void CodeGenerator::EmitPGXPValidateShadowRegister(Reg guest_reg, const Value& current_value)
+{
+  // Inline version of PGXP::Validate(): drop the valid flags when the shadow value no longer
+  // matches the guest register, i.e. it was modified by something which wasn't tracked.
+  u8* const shadow = PGXP::GetShadowCPURegisterPointer(static_cast<u32>(guest_reg));
+  Value temp = m_register_cache.AllocateScratch(RegSize_32);
+
+  LabelType shadow_matches;
+  EmitLoadGlobal(temp.GetHostRegister(), RegSize_32, shadow + PGXP::SHADOW_VALUE_VALUE_OFFSET);
+  EmitConditionalBranch(Condition::Equal, false, temp.GetHostRegister(), current_value, &shadow_matches);
+  EmitLoadGlobal(temp.GetHostRegister(), RegSize_32, shadow + PGXP::SHADOW_VALUE_FLAGS_OFFSET);
+  EmitAnd(temp.GetHostRegister(), temp.GetHostRegister(),
+          Value::FromConstantU32(PGXP::SHADOW_VALUE_INVALIDATE_FLAGS_MASK));
+  EmitStoreGlobal(shadow + PGXP::SHADOW_VALUE_FLAGS_OFFSET, temp);
+  EmitBindLabel(&shadow_matches);
+}
+
+void CodeGenerator::EmitPGXPShadowRegisterMove(Reg dst, Reg src, const Value& src_value)
+{
+  // Inline version of PGXP::CPU_MOVE(): validate the source, then copy the whole shadow value
+  // across. Register moves are by far the most common PGXP operation in real code, and inlining
+  // them avoids a function call (and the associated register cache flush) per move.
+  EmitPGXPValidateShadowRegister(src, src_value);
+
+  u8* const src_shadow = PGXP::GetShadowCPURegisterPointer(static_cast<u32>(src));
+  u8* const dst_shadow = PGXP::GetShadowCPURegisterPointer(static_cast<u32>(dst));
+  Value temp = m_register_cache.AllocateScratch(RegSize_32);
+  for (u32 offset = 0; offset < PGXP::SHADOW_VALUE_SIZE; offset += sizeof(u32))
+  {
+    EmitLoadGlobal(temp.GetHostRegister(), RegSize_32, src_shadow + offset);
+    EmitStoreGlobal(dst_shadow + offset, temp);
+  }
+}
+
 bool CodeGenerator::Compile_cop2(const CodeBlockInstruction& cbi)
 {
   if (cbi.instruction.op == InstructionOp::lwc2 || cbi.instruction.op == InstructionOp::swc2)
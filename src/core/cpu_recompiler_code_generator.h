@@ -91,6 +91,8 @@ public:
   Value EmitLoadGuestMemory(const CodeBlockInstruction& cbi, const Value& address, const SpeculativeValue& address_spec,
                             RegSize size);
   void EmitLoadGuestRAMFastmem(const Value& address, RegSize size, Value& result);
+  void EmitLoadGuestScratchpad(const Value& address, RegSize size, Value& result);
+  void EmitStoreGuestScratchpad(const Value& address, RegSize size, const Value& value);
   void EmitLoadGuestMemoryFastmem(const CodeBlockInstruction& cbi, const Value& address, RegSize size, Value& result);
   void EmitLoadGuestMemorySlowmem(const CodeBlockInstruction& cbi, const Value& address, RegSize size, Value& result,
                                   bool in_far_code);
@@ -218,6 +220,11 @@ private:
   Value DoGTERegisterRead(u32 index);
   void DoGTERegisterWrite(u32 index, const Value& value);
 
+  // PGXP shadow propagation for trivially-forwardable operations, mirroring PGXP::Validate() and
+  // PGXP::CPU_MOVE() without leaving the generated code.
+  void EmitPGXPValidateShadowRegister(Reg guest_reg, const Value& current_value);
+  void EmitPGXPShadowRegisterMove(Reg dst, Reg src, const Value& src_value);
+
   //////////////////////////////////////////////////////////////////////////
   // Instruction Code Generators
   //////////////////////////////////////////////////////////////////////////
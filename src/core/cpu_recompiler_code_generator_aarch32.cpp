@@ -1234,6 +1234,89 @@ void CodeGenerator::EmitLoadGuestRAMFastmem(const Value& address, RegSize size,
   }
 }
 
+void CodeGenerator::EmitLoadGuestScratchpad(const Value& address, RegSize size, Value& result)
+{
+  HostReg address_reg;
+  if (address.IsConstant())
+  {
+    m_emit->Mov(GetHostReg32(RSCRATCH), static_cast<u32>(address.constant_value));
+    address_reg = RSCRATCH;
+  }
+  else
+  {
+    address_reg = address.host_reg;
+  }
+
+  m_emit->and_(GetHostReg32(RARG1), GetHostReg32(address_reg), DCACHE_OFFSET_MASK);
+  m_emit->add(GetHostReg32(RARG2), GetCPUPtrReg(), offsetof(State, dcache));
+
+  switch (size)
+  {
+    case RegSize_8:
+      m_emit->ldrb(GetHostReg32(result.host_reg), a32::MemOperand(GetHostReg32(RARG2), GetHostReg32(RARG1)));
+      break;
+
+    case RegSize_16:
+      m_emit->ldrh(GetHostReg32(result.host_reg), a32::MemOperand(GetHostReg32(RARG2), GetHostReg32(RARG1)));
+      break;
+
+    case RegSize_32:
+      m_emit->ldr(GetHostReg32(result.host_reg), a32::MemOperand(GetHostReg32(RARG2), GetHostReg32(RARG1)));
+      break;
+
+    default:
+      UnreachableCode();
+      break;
+  }
+}
+
+void CodeGenerator::EmitStoreGuestScratchpad(const Value& address, RegSize size, const Value& value)
+{
+  HostReg address_reg;
+  if (address.IsConstant())
+  {
+    m_emit->Mov(GetHostReg32(RARG1), static_cast<u32>(address.constant_value));
+    address_reg = RARG1;
+  }
+  else
+  {
+    address_reg = address.host_reg;
+  }
+
+  HostReg value_reg;
+  if (value.IsConstant())
+  {
+    m_emit->Mov(GetHostReg32(RSCRATCH), Truncate32(value.constant_value));
+    value_reg = RSCRATCH;
+  }
+  else
+  {
+    value_reg = value.host_reg;
+  }
+
+  m_emit->and_(GetHostReg32(RARG1), GetHostReg32(address_reg), DCACHE_OFFSET_MASK);
+  m_emit->add(GetHostReg32(RARG2), GetCPUPtrReg(), offsetof(State, dcache));
+
+  switch (size)
+  {
+    case RegSize_8:
+      m_emit->strb(GetHostReg32(value_reg), a32::MemOperand(GetHostReg32(RARG2), GetHostReg32(RARG1)));
+      break;
+
+    case RegSize_16:
+      m_emit->strh(GetHostReg32(value_reg), a32::MemOperand(GetHostReg32(RARG2), GetHostReg32(RARG1)));
+      break;
+
+    case RegSize_32:
+      m_emit->str(GetHostReg32(value_reg), a32::MemOperand(GetHostReg32(RARG2), GetHostReg32(RARG1)));
+      break;
+
+    default:
+      UnreachableCode();
+      break;
+  }
+}
+
 void CodeGenerator::EmitLoadGuestMemoryFastmem(const CodeBlockInstruction& cbi, const Value& address, RegSize size,
                                                Value& result)
 {
@@ -2065,6 +2148,9 @@ CodeCache::DispatcherFunction CodeGenerator::CompileDispatcher()
 
   EmitLoadGlobalAddress(RCPUPTR, &g_state);
 
+  // r5 <- s_fast_map, loaded once; blocks and RunEvents preserve callee-saved registers.
+  EmitLoadGlobalAddress(5, CodeCache::GetFastMapPointer());
+
   a32::Label event_test;
   m_emit->b(&event_test);
 
@@ -2077,9 +2163,8 @@ CodeCache::DispatcherFunction CodeGenerator::CompileDispatcher()
   m_emit->ldr(a32::r0, a32::MemOperand(GetHostReg32(RCPUPTR), offsetof(State, pc)));
 
   // r1 <- s_fast_map[pc >> 16]
-  EmitLoadGlobalAddress(2, CodeCache::GetFastMapPointer());
   m_emit->lsr(a32::r1, a32::r0, 16);
-  m_emit->ldr(a32::r1, a32::MemOperand(a32::r2, a32::r1, a32::LSL, 2));
+  m_emit->ldr(a32::r1, a32::MemOperand(a32::r5, a32::r1, a32::LSL, 2));
 
   // blr(r1[pc]) (fast_map[pc >> 2])
   m_emit->ldr(a32::r0, a32::MemOperand(a32::r1, a32::r0));
@@ -1377,6 +1377,7 @@ void CodeGenerator::EmitLoadGuestRAMFastmem(const Value& address, RegSize size,
     m_emit->lsr(GetHostReg32(RARG1), GetHostReg32(address_reg), 12);
     m_emit->and_(GetHostReg32(RARG2), GetHostReg32(address_reg), HOST_PAGE_OFFSET_MASK);
     m_emit->ldr(GetHostReg64(RARG1), a64::MemOperand(GetFastmemBasePtrReg(), GetHostReg32(RARG1), a64::LSL, 3));
+    m_emit->and_(GetHostReg64(RARG1), GetHostReg64(RARG1), ~Bus::FASTMEM_LUT_WRITE_PROTECT_MASK);
 
     switch (size)
     {
@@ -1399,6 +1400,89 @@ void CodeGenerator::EmitLoadGuestRAMFastmem(const Value& address, RegSize size,
   }
 }
 
+void CodeGenerator::EmitLoadGuestScratchpad(const Value& address, RegSize size, Value& result)
+{
+  HostReg address_reg;
+  if (address.IsConstant())
+  {
+    m_emit->Mov(GetHostReg32(RSCRATCH), address.constant_value);
+    address_reg = RSCRATCH;
+  }
+  else
+  {
+    address_reg = address.host_reg;
+  }
+
+  m_emit->and_(GetHostReg32(RARG1), GetHostReg32(address_reg), DCACHE_OFFSET_MASK);
+  m_emit->add(GetHostReg64(RARG2), GetCPUPtrReg(), offsetof(State, dcache));
+
+  switch (size)
+  {
+    case RegSize_8:
+      m_emit->ldrb(GetHostReg32(result.host_reg), a64::MemOperand(GetHostReg64(RARG2), GetHostReg32(RARG1)));
+      break;
+
+    case RegSize_16:
+      m_emit->ldrh(GetHostReg32(result.host_reg), a64::MemOperand(GetHostReg64(RARG2), GetHostReg32(RARG1)));
+      break;
+
+    case RegSize_32:
+      m_emit->ldr(GetHostReg32(result.host_reg), a64::MemOperand(GetHostReg64(RARG2), GetHostReg32(RARG1)));
+      break;
+
+    default:
+      UnreachableCode();
+      break;
+  }
+}
+
+void CodeGenerator::EmitStoreGuestScratchpad(const Value& address, RegSize size, const Value& value)
+{
+  HostReg address_reg;
+  if (address.IsConstant())
+  {
+    m_emit->Mov(GetHostReg32(RARG1), address.constant_value);
+    address_reg = RARG1;
+  }
+  else
+  {
+    address_reg = address.host_reg;
+  }
+
+  HostReg value_reg;
+  if (value.IsConstant())
+  {
+    m_emit->Mov(GetHostReg32(RSCRATCH), Truncate32(value.constant_value));
+    value_reg = RSCRATCH;
+  }
+  else
+  {
+    value_reg = value.host_reg;
+  }
+
+  m_emit->and_(GetHostReg32(RARG1), GetHostReg32(address_reg), DCACHE_OFFSET_MASK);
+  m_emit->add(GetHostReg64(RARG2), GetCPUPtrReg(), offsetof(State, dcache));
+
+  switch (size)
+  {
+    case RegSize_8:
+      m_emit->strb(GetHostReg32(value_reg), a64::MemOperand(GetHostReg64(RARG2), GetHostReg32(RARG1)));
+      break;
+
+    case RegSize_16:
+      m_emit->strh(GetHostReg32(value_reg), a64::MemOperand(GetHostReg64(RARG2), GetHostReg32(RARG1)));
+      break;
+
+    case RegSize_32:
+      m_emit->str(GetHostReg32(value_reg), a64::MemOperand(GetHostReg64(RARG2), GetHostReg32(RARG1)));
+      break;
+
+    default:
+      UnreachableCode();
+      break;
+  }
+}
+
 void CodeGenerator::EmitLoadGuestMemoryFastmem(const CodeBlockInstruction& cbi, const Value& address, RegSize size,
                                                Value& result)
 {
@@ -1450,6 +1534,7 @@ void CodeGenerator::EmitLoadGuestMemoryFastmem(const CodeBlockInstruction& cbi,
     m_emit->lsr(GetHostReg32(RARG1), GetHostReg32(address_reg), 12);
     m_emit->and_(GetHostReg32(RARG2), GetHostReg32(address_reg), HOST_PAGE_OFFSET_MASK);
     m_emit->ldr(GetHostReg64(RARG1), a64::MemOperand(GetFastmemBasePtrReg(), GetHostReg32(RARG1), a64::LSL, 3));
+    m_emit->and_(GetHostReg64(RARG1), GetHostReg64(RARG1), ~Bus::FASTMEM_LUT_WRITE_PROTECT_MASK);
 
     bpi.host_pc = GetCurrentNearCodePointer();
 
@@ -1624,8 +1709,7 @@ void CodeGenerator::EmitStoreGuestMemoryFastmem(const CodeBlockInstruction& cbi,
   {
     m_emit->lsr(GetHostReg32(RARG1), GetHostReg32(address_reg), 12);
     m_emit->and_(GetHostReg32(RARG2), GetHostReg32(address_reg), HOST_PAGE_OFFSET_MASK);
-    m_emit->add(GetHostReg64(RARG3), GetFastmemBasePtrReg(), Bus::FASTMEM_LUT_NUM_PAGES * sizeof(u32*));
-    m_emit->ldr(GetHostReg64(RARG1), a64::MemOperand(GetHostReg64(RARG3), GetHostReg32(RARG1), a64::LSL, 3));
+    m_emit->ldr(GetHostReg64(RARG1), a64::MemOperand(GetFastmemBasePtrReg(), GetHostReg32(RARG1), a64::LSL, 3));
 
     bpi.host_pc = GetCurrentNearCodePointer();
 
@@ -2095,69 +2179,72 @@ void CodeGenerator::EmitConditionalBranch(Condition condition, bool invert, Host
     case Condition::Negative:
     case Condition::PositiveOrZero:
     {
+      // Branch directly on the sign bit rather than going through a flag-setting tst.
+      const bool branch_on_set = ((condition == Condition::Negative) != invert);
+      u8 sign_bit;
       switch (size)
       {
         case RegSize_8:
-          m_emit->tst(GetHostReg8(value), GetHostReg8(value));
+          sign_bit = 7;
           break;
         case RegSize_16:
-          m_emit->tst(GetHostReg16(value), GetHostReg16(value));
+          sign_bit = 15;
           break;
         case RegSize_32:
-          m_emit->tst(GetHostReg32(value), GetHostReg32(value));
+          sign_bit = 31;
           break;
         case RegSize_64:
-          m_emit->tst(GetHostReg64(value), GetHostReg64(value));
+          sign_bit = 63;
           break;
         default:
           UnreachableCode();
-          break;
+          return;
       }
 
-      EmitConditionalBranch(condition, invert, label);
-      return;
-    }
-
-    case Condition::NotZero:
-    {
-      switch (size)
+      if (branch_on_set)
       {
-        case RegSize_8:
-          m_emit->cbnz(GetHostReg8(value), label);
-          break;
-        case RegSize_16:
-          m_emit->cbz(GetHostReg16(value), label);
-          break;
-        case RegSize_32:
-          m_emit->cbnz(GetHostReg32(value), label);
-          break;
-        case RegSize_64:
-          m_emit->cbnz(GetHostReg64(value), label);
-          break;
-        default:
-          UnreachableCode();
-          break;
+        if (size == RegSize_64)
+          m_emit->tbnz(GetHostReg64(value), sign_bit, label);
+        else
+          m_emit->tbnz(GetHostReg32(value), sign_bit, label);
+      }
+      else
+      {
+        if (size == RegSize_64)
+          m_emit->tbz(GetHostReg64(value), sign_bit, label);
+        else
+          m_emit->tbz(GetHostReg32(value), sign_bit, label);
       }
 
       return;
     }
 
+    case Condition::NotZero:
     case Condition::Zero:
     {
+      const bool branch_on_nonzero = ((condition == Condition::NotZero) != invert);
       switch (size)
       {
         case RegSize_8:
-          m_emit->cbz(GetHostReg8(value), label);
-          break;
         case RegSize_16:
-          m_emit->cbz(GetHostReg16(value), label);
-          break;
         case RegSize_32:
-          m_emit->cbz(GetHostReg32(value), label);
-          break;
+        {
+          if (branch_on_nonzero)
+            m_emit->cbnz(GetHostReg32(value), label);
+          else
+            m_emit->cbz(GetHostReg32(value), label);
+        }
+        break;
+
         case RegSize_64:
-          m_emit->cbz(GetHostReg64(value), label);
-          break;
+        {
+          if (branch_on_nonzero)
+            m_emit->cbnz(GetHostReg64(value), label);
+          else
+            m_emit->cbz(GetHostReg64(value), label);
+        }
+        break;
+
         default:
           UnreachableCode();
           break;
@@ -2274,6 +2361,9 @@ CodeCache::DispatcherFunction CodeGenerator::CompileDispatcher()
 
   EmitLoadGlobalAddress(RCPUPTR, &g_state);
 
+  // x20 <- s_fast_map, loaded once; blocks and RunEvents preserve callee-saved registers.
+  EmitLoadGlobalAddress(20, CodeCache::GetFastMapPointer());
+
   a64::Label event_test;
   m_emit->b(&event_test);
 
@@ -2286,10 +2376,9 @@ CodeCache::DispatcherFunction CodeGenerator::CompileDispatcher()
   m_emit->ldr(a64::w8, a64::MemOperand(GetHostReg64(RCPUPTR), offsetof(State, pc)));
 
   // x9 <- s_fast_map[pc >> 16]
-  EmitLoadGlobalAddress(10, CodeCache::GetFastMapPointer());
   m_emit->lsr(a64::w9, a64::w8, 16);
   m_emit->lsr(a64::w8, a64::w8, 2);
-  m_emit->ldr(a64::x9, a64::MemOperand(a64::x10, a64::x9, a64::LSL, 3));
+  m_emit->ldr(a64::x9, a64::MemOperand(a64::x20, a64::x9, a64::LSL, 3));
 
   // blr(x9[pc * 2]) (fast_map[pc >> 2])
   m_emit->ldr(a64::x8, a64::MemOperand(a64::x9, a64::x8, a64::LSL, 3));
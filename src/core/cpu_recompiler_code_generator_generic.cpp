@@ -62,11 +62,17 @@ Value CodeGenerator::EmitLoadGuestMemory(const CodeBlockInstruction& cbi, const
 
   Value result = m_register_cache.AllocateScratch(HostPointerSize);
 
-  const bool use_fastmem =
-    (address_spec ? Bus::CanUseFastmemForAddress(*address_spec) : true) && !SpeculativeIsCacheIsolated();
+  // Scratchpad accesses fall outside fastmem, but are among the hottest memory ops (games use it as their data
+  // stack), so speculated scratchpad addresses get a direct dcache access with a runtime range check.
+  const bool use_scratchpad = address_spec && !SpeculativeIsCacheIsolated() &&
+                              ((*address_spec & PHYSICAL_MEMORY_ADDRESS_MASK & DCACHE_LOCATION_MASK) ==
+                               DCACHE_LOCATION);
+  const bool use_fastmem = !use_scratchpad &&
+                           (address_spec ? Bus::CanUseFastmemForAddress(*address_spec) : true) &&
+                           !SpeculativeIsCacheIsolated();
   if (address_spec)
   {
-    if (!use_fastmem)
+    if (!use_fastmem && !use_scratchpad)
     {
       Log_ProfilePrintf("Non-constant load at 0x%08X, speculative address 0x%08X, using fastmem = %s", cbi.pc,
                         *address_spec, use_fastmem ? "yes" : "no");
@@ -78,7 +84,40 @@ Value CodeGenerator::EmitLoadGuestMemory(const CodeBlockInstruction& cbi, const
                       use_fastmem ? "yes" : "no");
   }
 
-  if (g_settings.IsUsingFastmem() && use_fastmem)
+  if (use_scratchpad)
+  {
+    Value masked_address = m_register_cache.AllocateScratch(RegSize_32);
+
+    m_register_cache.InhibitAllocation();
+
+    // The speculated address can be wrong, so check at runtime and fall back to the handlers when the access
+    // turns out to be somewhere else. Accepts the KUSEG and KSEG0 mirrors; KSEG1 still goes through the handlers.
+    EmitCopyValue(masked_address.GetHostRegister(), address);
+    EmitAnd(masked_address.GetHostRegister(), masked_address.GetHostRegister(),
+            Value::FromConstantU32(DCACHE_LOCATION_MASK & ~UINT32_C(0x80000000)));
+
+    LabelType is_scratchpad;
+    EmitConditionalBranch(Condition::Equal, false, masked_address.GetHostRegister(),
+                          Value::FromConstantU32(DCACHE_LOCATION), &is_scratchpad);
+    EmitBranch(GetCurrentFarCodePointer());
+    EmitBindLabel(&is_scratchpad);
+
+    EmitLoadGuestScratchpad(address, size, result);
+
+    // handler fallback for mis-speculated addresses
+    SwitchToFarCode();
+    DebugAssert(m_delayed_cycles_add > 0);
+    EmitAddCPUStructField(offsetof(State, pending_ticks),
+                          Value::FromConstantU32(static_cast<u32>(m_delayed_cycles_add)));
+    EmitLoadGuestMemorySlowmem(cbi, address, size, result, true);
+    EmitAddCPUStructField(offsetof(State, pending_ticks),
+                          Value::FromConstantU32(static_cast<u32>(-m_delayed_cycles_add)));
+    EmitBranch(GetCurrentNearCodePointer(), false);
+    SwitchToNearCode();
+
+    m_register_cache.UninhibitAllocation();
+  }
+  else if (g_settings.IsUsingFastmem() && use_fastmem)
   {
     EmitLoadGuestMemoryFastmem(cbi, address, size, result);
   }
@@ -135,11 +174,16 @@ void CodeGenerator::EmitStoreGuestMemory(const CodeBlockInstruction& cbi, const
     }
   }
 
-  const bool use_fastmem =
-    (address_spec ? Bus::CanUseFastmemForAddress(*address_spec) : true) && !SpeculativeIsCacheIsolated();
+  // See EmitLoadGuestMemory() - direct dcache access for speculated scratchpad stores.
+  const bool use_scratchpad = address_spec && !SpeculativeIsCacheIsolated() &&
+                              ((*address_spec & PHYSICAL_MEMORY_ADDRESS_MASK & DCACHE_LOCATION_MASK) ==
+                               DCACHE_LOCATION);
+  const bool use_fastmem = !use_scratchpad &&
+                           (address_spec ? Bus::CanUseFastmemForAddress(*address_spec) : true) &&
+                           !SpeculativeIsCacheIsolated();
   if (address_spec)
   {
-    if (!use_fastmem)
+    if (!use_fastmem && !use_scratchpad)
     {
       Log_ProfilePrintf("Non-constant store at 0x%08X, speculative address 0x%08X, using fastmem = %s", cbi.pc,
                         *address_spec, use_fastmem ? "yes" : "no");
@@ -151,7 +195,39 @@ void CodeGenerator::EmitStoreGuestMemory(const CodeBlockInstruction& cbi, const
                       use_fastmem ? "yes" : "no");
   }
 
-  if (g_settings.IsUsingFastmem() && use_fastmem)
+  if (use_scratchpad)
+  {
+    Value value_in_hr = GetValueInHostRegister(value);
+    Value masked_address = m_register_cache.AllocateScratch(RegSize_32);
+
+    m_register_cache.InhibitAllocation();
+
+    EmitCopyValue(masked_address.GetHostRegister(), address);
+    EmitAnd(masked_address.GetHostRegister(), masked_address.GetHostRegister(),
+            Value::FromConstantU32(DCACHE_LOCATION_MASK & ~UINT32_C(0x80000000)));
+
+    LabelType is_scratchpad;
+    EmitConditionalBranch(Condition::Equal, false, masked_address.GetHostRegister(),
+                          Value::FromConstantU32(DCACHE_LOCATION), &is_scratchpad);
+    EmitBranch(GetCurrentFarCodePointer());
+    EmitBindLabel(&is_scratchpad);
+
+    EmitStoreGuestScratchpad(address, size, value_in_hr);
+
+    // handler fallback for mis-speculated addresses
+    SwitchToFarCode();
+    DebugAssert(m_delayed_cycles_add > 0);
+    EmitAddCPUStructField(offsetof(State, pending_ticks),
+                          Value::FromConstantU32(static_cast<u32>(m_delayed_cycles_add)));
+    EmitStoreGuestMemorySlowmem(cbi, address, size, value_in_hr, true);
+    EmitAddCPUStructField(offsetof(State, pending_ticks),
+                          Value::FromConstantU32(static_cast<u32>(-m_delayed_cycles_add)));
+    EmitBranch(GetCurrentNearCodePointer(), false);
+    SwitchToNearCode();
+
+    m_register_cache.UninhibitAllocation();
+  }
+  else if (g_settings.IsUsingFastmem() && use_fastmem)
   {
     EmitStoreGuestMemoryFastmem(cbi, address, size, value);
   }
@@ -1880,6 +1880,7 @@ void CodeGenerator::EmitLoadGuestRAMFastmem(const Value& address, RegSize size,
     m_emit->shr(GetHostReg32(RARG1), 12);
     m_emit->and_(GetHostReg32(RARG2), HOST_PAGE_OFFSET_MASK);
     m_emit->mov(GetHostReg64(RARG1), m_emit->qword[GetFastmemBasePtrReg() + GetHostReg64(RARG1) * 8]);
+    m_emit->btr(GetHostReg64(RARG1), Bus::FASTMEM_LUT_WRITE_PROTECT_BIT);
 
     switch (size)
     {
@@ -1902,6 +1903,92 @@ void CodeGenerator::EmitLoadGuestRAMFastmem(const Value& address, RegSize size,
   }
 }
 
+void CodeGenerator::EmitLoadGuestScratchpad(const Value& address, RegSize size, Value& result)
+{
+  EmitCopyValue(RARG1, address);
+  m_emit->and_(GetHostReg32(RARG1), DCACHE_OFFSET_MASK);
+
+  switch (size)
+  {
+    case RegSize_8:
+      m_emit->mov(GetHostReg8(result.host_reg),
+                  m_emit->byte[GetCPUPtrReg() + GetHostReg64(RARG1) + offsetof(State, dcache)]);
+      break;
+
+    case RegSize_16:
+      m_emit->mov(GetHostReg16(result.host_reg),
+                  m_emit->word[GetCPUPtrReg() + GetHostReg64(RARG1) + offsetof(State, dcache)]);
+      break;
+
+    case RegSize_32:
+      m_emit->mov(GetHostReg32(result.host_reg),
+                  m_emit->dword[GetCPUPtrReg() + GetHostReg64(RARG1) + offsetof(State, dcache)]);
+      break;
+
+    default:
+      UnreachableCode();
+      break;
+  }
+}
+
+void CodeGenerator::EmitStoreGuestScratchpad(const Value& address, RegSize size, const Value& value)
+{
+  EmitCopyValue(RARG1, address);
+  m_emit->and_(GetHostReg32(RARG1), DCACHE_OFFSET_MASK);
+
+  switch (size)
+  {
+    case RegSize_8:
+    {
+      if (value.IsConstant())
+      {
+        m_emit->mov(m_emit->byte[GetCPUPtrReg() + GetHostReg64(RARG1) + offsetof(State, dcache)],
+                    value.constant_value & 0xFFu);
+      }
+      else
+      {
+        m_emit->mov(m_emit->byte[GetCPUPtrReg() + GetHostReg64(RARG1) + offsetof(State, dcache)],
+                    GetHostReg8(value.host_reg));
+      }
+    }
+    break;
+
+    case RegSize_16:
+    {
+      if (value.IsConstant())
+      {
+        m_emit->mov(m_emit->word[GetCPUPtrReg() + GetHostReg64(RARG1) + offsetof(State, dcache)],
+                    value.constant_value & 0xFFFFu);
+      }
+      else
+      {
+        m_emit->mov(m_emit->word[GetCPUPtrReg() + GetHostReg64(RARG1) + offsetof(State, dcache)],
+                    GetHostReg16(value.host_reg));
+      }
+    }
+    break;
+
+    case RegSize_32:
+    {
+      if (value.IsConstant())
+      {
+        m_emit->mov(m_emit->dword[GetCPUPtrReg() + GetHostReg64(RARG1) + offsetof(State, dcache)],
+                    value.constant_value);
+      }
+      else
+      {
+        m_emit->mov(m_emit->dword[GetCPUPtrReg() + GetHostReg64(RARG1) + offsetof(State, dcache)],
+                    GetHostReg32(value.host_reg));
+      }
+    }
+    break;
+
+    default:
+      UnreachableCode();
+      break;
+  }
+}
+
 void CodeGenerator::EmitLoadGuestMemoryFastmem(const CodeBlockInstruction& cbi, const Value& address, RegSize size,
                                                Value& result)
 {
@@ -1988,6 +2075,7 @@ void CodeGenerator::EmitLoadGuestMemoryFastmem(const CodeBlockInstruction& cbi,
     m_emit->shr(GetHostReg32(RARG1), 12);
     m_emit->and_(GetHostReg32(RARG2), HOST_PAGE_OFFSET_MASK);
     m_emit->mov(GetHostReg64(RARG1), m_emit->qword[GetFastmemBasePtrReg() + GetHostReg64(RARG1) * 8]);
+    m_emit->btr(GetHostReg64(RARG1), Bus::FASTMEM_LUT_WRITE_PROTECT_BIT);
     bpi.host_pc = GetCurrentNearCodePointer();
 
     switch (size)
@@ -2250,8 +2338,7 @@ void CodeGenerator::EmitStoreGuestMemoryFastmem(const CodeBlockInstruction& cbi,
     m_emit->mov(GetHostReg32(RARG2), GetHostReg32(RARG1));
     m_emit->shr(GetHostReg32(RARG1), 12);
     m_emit->and_(GetHostReg32(RARG2), HOST_PAGE_OFFSET_MASK);
-    m_emit->mov(GetHostReg64(RARG1),
-                m_emit->qword[GetFastmemBasePtrReg() + GetHostReg64(RARG1) * 8 + (Bus::FASTMEM_LUT_NUM_PAGES * 8)]);
+    m_emit->mov(GetHostReg64(RARG1), m_emit->qword[GetFastmemBasePtrReg() + GetHostReg64(RARG1) * 8]);
     bpi.host_pc = GetCurrentNearCodePointer();
 
     switch (size)
@@ -2713,28 +2800,54 @@ void CodeGenerator::EmitICacheCheckAndUpdate()
   {
     m_emit->add(m_emit->dword[GetCPUPtrReg() + offsetof(State, pending_ticks)],
                 static_cast<u32>(m_block->uncached_fetch_ticks));
+    return;
   }
-  else
+
+  VirtualMemoryAddress current_pc = m_pc & ICACHE_TAG_ADDRESS_MASK;
+
+  if (m_block->icache_line_count == 1)
   {
-    VirtualMemoryAddress current_pc = m_pc & ICACHE_TAG_ADDRESS_MASK;
-    for (u32 i = 0; i < m_block->icache_line_count; i++, current_pc += ICACHE_LINE_SIZE)
-    {
-      const VirtualMemoryAddress tag = GetICacheTagForAddress(current_pc);
-      const TickCount fill_ticks = GetICacheFillTicks(current_pc);
-      if (fill_ticks <= 0)
-        continue;
+    // Single-line block, so the fill penalty can go straight into pending_ticks on a miss.
+    const VirtualMemoryAddress tag = GetICacheTagForAddress(current_pc);
+    const TickCount fill_ticks = GetICacheFillTicks(current_pc);
+    if (fill_ticks <= 0)
+      return;
 
-      const u32 line = GetICacheLine(current_pc);
-      const u32 offset = offsetof(State, icache_tags) + (line * sizeof(u32));
-      Xbyak::Label cache_hit;
+    const u32 line = GetICacheLine(current_pc);
+    const u32 offset = offsetof(State, icache_tags) + (line * sizeof(u32));
+    Xbyak::Label cache_hit;
 
-      m_emit->cmp(m_emit->dword[GetCPUPtrReg() + offset], tag);
-      m_emit->je(cache_hit);
-      m_emit->mov(m_emit->dword[GetCPUPtrReg() + offset], tag);
-      m_emit->add(m_emit->dword[GetCPUPtrReg() + offsetof(State, pending_ticks)], static_cast<u32>(fill_ticks));
-      m_emit->L(cache_hit);
-    }
+    m_emit->cmp(m_emit->dword[GetCPUPtrReg() + offset], tag);
+    m_emit->je(cache_hit);
+    m_emit->mov(m_emit->dword[GetCPUPtrReg() + offset], tag);
+    m_emit->add(m_emit->dword[GetCPUPtrReg() + offsetof(State, pending_ticks)], static_cast<u32>(fill_ticks));
+    m_emit->L(cache_hit);
+    return;
+  }
+
+  // The line-crossing pattern (tags and per-line fill penalty) is known at compile time, so accumulate
+  // the penalty for the missing lines in a register and fold it into pending_ticks with one adjustment,
+  // instead of a read-modify-write of pending_ticks per line.
+  m_emit->xor_(GetHostReg32(RARG1), GetHostReg32(RARG1));
+  for (u32 i = 0; i < m_block->icache_line_count; i++, current_pc += ICACHE_LINE_SIZE)
+  {
+    const VirtualMemoryAddress tag = GetICacheTagForAddress(current_pc);
+    const TickCount fill_ticks = GetICacheFillTicks(current_pc);
+    if (fill_ticks <= 0)
+      continue;
+
+    const u32 line = GetICacheLine(current_pc);
+    const u32 offset = offsetof(State, icache_tags) + (line * sizeof(u32));
+    Xbyak::Label cache_hit;
+
+    m_emit->cmp(m_emit->dword[GetCPUPtrReg() + offset], tag);
+    m_emit->je(cache_hit);
+    m_emit->mov(m_emit->dword[GetCPUPtrReg() + offset], tag);
+    m_emit->add(GetHostReg32(RARG1), static_cast<u32>(fill_ticks));
+    m_emit->L(cache_hit);
   }
+
+  m_emit->add(m_emit->dword[GetCPUPtrReg() + offsetof(State, pending_ticks)], GetHostReg32(RARG1));
 }
 
 void CodeGenerator::EmitStallUntilGTEComplete()
@@ -3076,6 +3189,9 @@ CodeCache::DispatcherFunction CodeGenerator::CompileDispatcher()
 
   EmitLoadGlobalAddress(Xbyak::Operand::RBP, &g_state);
 
+  // rbx <- s_fast_map, loaded once; blocks and RunEvents preserve callee-saved registers.
+  EmitLoadGlobalAddress(Xbyak::Operand::RBX, CodeCache::GetFastMapPointer());
+
   Xbyak::Label event_test;
   m_emit->jmp(event_test);
 
@@ -3089,7 +3205,6 @@ CodeCache::DispatcherFunction CodeGenerator::CompileDispatcher()
   m_emit->mov(m_emit->eax, m_emit->dword[m_emit->rbp + offsetof(State, pc)]);
 
   // rcx <- s_fast_map[pc >> 16]
-  EmitLoadGlobalAddress(Xbyak::Operand::RBX, CodeCache::GetFastMapPointer());
   m_emit->mov(m_emit->ecx, m_emit->eax);
   m_emit->shr(m_emit->ecx, 16);
   m_emit->mov(m_emit->rcx, m_emit->qword[m_emit->rbx + m_emit->rcx * 8]);
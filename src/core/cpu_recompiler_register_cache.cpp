@@ -863,8 +863,22 @@ bool RegisterCache::EvictOneGuestRegister()
   if (m_state.guest_reg_order_count == 0)
     return false;
 
-  // evict the register used the longest time ago
+  // Evict the register used the longest time ago, but prefer a clean one, since those can be
+  // dropped without emitting a store. Loop bodies that cycle through more registers than we have
+  // host registers would otherwise spill/reload the same dirty value every iteration. The newest
+  // entries are skipped; like the plain LRU choice, we rely on recency to avoid evicting an
+  // operand of the instruction currently being compiled.
   Reg evict_reg = m_state.guest_reg_order[m_state.guest_reg_order_count - 1];
+  for (u32 i = m_state.guest_reg_order_count; i > 3; i--)
+  {
+    const Reg candidate = m_state.guest_reg_order[i - 1];
+    if (!m_state.guest_reg_state[static_cast<u8>(candidate)].IsDirty())
+    {
+      evict_reg = candidate;
+      break;
+    }
+  }
+
   Log_ProfilePrintf("Evicting guest register %s", GetRegName(evict_reg));
   FlushGuestRegister(evict_reg, true, true);
 
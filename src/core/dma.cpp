@@ -690,12 +690,20 @@ TickCount DMA::TransferMemoryToDevice(Channel channel, u32 address, u32 incremen
       if (g_gpu->BeginDMAWrite())
       {
         u8* ram_pointer = Bus::g_ram;
-        for (u32 i = 0; i < word_count; i++)
+        if (increment == UINT32_C(4) && ((address + (word_count << 2)) <= (mask + UINT32_C(4))))
         {
-          u32 value;
-          std::memcpy(&value, &ram_pointer[address], sizeof(u32));
-          g_gpu->DMAWrite(address, value);
-          address = (address + increment) & mask;
+          // Forward transfer which doesn't wrap around RAM; hand the whole block over at once.
+          g_gpu->DMAWrite(address, reinterpret_cast<const u32*>(&ram_pointer[address]), word_count);
+        }
+        else
+        {
+          for (u32 i = 0; i < word_count; i++)
+          {
+            u32 value;
+            std::memcpy(&value, &ram_pointer[address], sizeof(u32));
+            g_gpu->DMAWrite(address, value);
+            address = (address + increment) & mask;
+          }
         }
         g_gpu->EndDMAWrite();
       }
@@ -730,15 +738,29 @@ TickCount DMA::TransferDeviceToMemory(Channel channel, u32 address, u32 incremen
     // clear ordering table
     u8* ram_pointer = Bus::g_ram;
     const u32 word_count_less_1 = word_count - 1;
-    for (u32 i = 0; i < word_count_less_1; i++)
+    if ((word_count_less_1 << 2) <= address)
+    {
+      // Table doesn't wrap around the bottom of RAM, so the chain can be written without masking
+      // each entry, which lets the compiler vectorize the loop.
+      address -= (word_count_less_1 << 2);
+      u32* const table_pointer = reinterpret_cast<u32*>(&ram_pointer[address]);
+      for (u32 i = 0; i < word_count_less_1; i++)
+        table_pointer[i + 1] = address + (i << 2);
+      table_pointer[0] = UINT32_C(0xFFFFFF);
+    }
+    else
     {
-      u32 value = ((address - 4) & mask);
-      std::memcpy(&ram_pointer[address], &value, sizeof(value));
-      address = (address - 4) & mask;
+      for (u32 i = 0; i < word_count_less_1; i++)
+      {
+        u32 value = ((address - 4) & mask);
+        std::memcpy(&ram_pointer[address], &value, sizeof(value));
+        address = (address - 4) & mask;
+      }
+
+      const u32 terminator = UINT32_C(0xFFFFFF);
+      std::memcpy(&ram_pointer[address], &terminator, sizeof(terminator));
     }
 
-    const u32 terminator = UINT32_C(0xFFFFFF);
-    std::memcpy(&ram_pointer[address], &terminator, sizeof(terminator));
     CPU::CodeCache::InvalidateCodePages(address, word_count);
     return Bus::GetDMARAMTickCount(word_count);
   }
@@ -0,0 +1,177 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#include "frame_profiler.h"
+#include "host.h"
+#include "settings.h"
+
+#include "util/imgui_manager.h"
+
+#include "common/timer.h"
+
+#include "imgui.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
+
+namespace FrameProfiler {
+static constexpr size_t NUM_CATEGORIES = static_cast<size_t>(Category::Count);
+static constexpr u32 NUM_HISTORY_FRAMES = 128;
+
+static constexpr std::array<const char*, NUM_CATEGORIES> s_category_names = {
+  {"CPU", "GPU", "DMA", "SPU", "CDROM", "MDEC", "Events", "Present"}};
+
+static constexpr std::array<u32, NUM_CATEGORIES> s_category_colors = {{
+  IM_COL32(102, 153, 255, 255), // CPU
+  IM_COL32(255, 128, 64, 255),  // GPU
+  IM_COL32(255, 214, 102, 255), // DMA
+  IM_COL32(128, 255, 128, 255), // SPU
+  IM_COL32(190, 122, 255, 255), // CDROM
+  IM_COL32(255, 102, 178, 255), // MDEC
+  IM_COL32(160, 160, 160, 255), // OtherEvent
+  IM_COL32(64, 224, 208, 255),  // Present
+}};
+
+static std::array<u64, NUM_CATEGORIES> s_accumulators = {};
+static u64 s_frame_start_timestamp = 0;
+static Common::Timer::Value s_frame_start_time = 0;
+static bool s_was_active = false;
+
+// Per-category milliseconds, ring-buffered per frame. s_history_pos is the oldest column.
+static std::array<std::array<float, NUM_HISTORY_FRAMES>, NUM_CATEGORIES> s_history = {};
+static u32 s_history_pos = 0;
+} // namespace FrameProfiler
+
+const char* FrameProfiler::GetCategoryName(Category category)
+{
+  return s_category_names[static_cast<size_t>(category)];
+}
+
+FrameProfiler::Category FrameProfiler::GetCategoryForEventName(const std::string& name)
+{
+  static constexpr std::pair<const char*, Category> prefixes[] = {
+    {"GPU", Category::GPU},   {"DMA", Category::DMA},   {"SPU", Category::SPU},
+    {"CDROM", Category::CDROM}, {"MDEC", Category::MDEC},
+  };
+
+  for (const auto& [prefix, category] : prefixes)
+  {
+    if (name.compare(0, std::strlen(prefix), prefix) == 0)
+      return category;
+  }
+
+  return Category::OtherEvent;
+}
+
+void FrameProfiler::AddTime(Category category, u64 timestamp_delta)
+{
+  s_accumulators[static_cast<size_t>(category)] += timestamp_delta;
+}
+
+void FrameProfiler::EndFrame()
+{
+  if (!g_settings.debugging.show_frame_profiler)
+  {
+    s_was_active = false;
+    return;
+  }
+
+  const u64 now_timestamp = GetTimestamp();
+  const Common::Timer::Value now_time = Common::Timer::GetCurrentValue();
+
+  // The first frame after activation only seeds the timestamps. The cycle counter's rate isn't
+  // assumed, it's calibrated against the wall clock over the frame that was just measured.
+  if (s_was_active && now_timestamp > s_frame_start_timestamp)
+  {
+    const float frame_ms =
+      static_cast<float>(Common::Timer::ConvertValueToMilliseconds(now_time - s_frame_start_time));
+    const double ms_per_cycle =
+      static_cast<double>(frame_ms) / static_cast<double>(now_timestamp - s_frame_start_timestamp);
+
+    float attributed_ms = 0.0f;
+    for (size_t i = 1; i < NUM_CATEGORIES; i++)
+    {
+      const float ms = static_cast<float>(static_cast<double>(s_accumulators[i]) * ms_per_cycle);
+      s_history[i][s_history_pos] = ms;
+      attributed_ms += ms;
+    }
+
+    // Whatever wasn't spent in events or presentation is CPU execution (and host overhead).
+    s_history[static_cast<size_t>(Category::CPU)][s_history_pos] = std::max(frame_ms - attributed_ms, 0.0f);
+    s_history_pos = (s_history_pos + 1) % NUM_HISTORY_FRAMES;
+  }
+
+  s_accumulators.fill(0);
+  s_frame_start_timestamp = now_timestamp;
+  s_frame_start_time = now_time;
+  s_was_active = true;
+}
+
+void FrameProfiler::DrawDebugWindow()
+{
+  const float framebuffer_scale = Host::GetOSDScale();
+
+  ImGui::SetNextWindowSize(ImVec2(420.0f * framebuffer_scale, 260.0f * framebuffer_scale), ImGuiCond_FirstUseEver);
+  if (!ImGui::Begin("Frame Profiler", nullptr))
+  {
+    ImGui::End();
+    return;
+  }
+
+  // Legend with the most recent frame's numbers.
+  const u32 last_pos = (s_history_pos + NUM_HISTORY_FRAMES - 1) % NUM_HISTORY_FRAMES;
+  for (size_t i = 0; i < NUM_CATEGORIES; i++)
+  {
+    if ((i % 4) != 0)
+      ImGui::SameLine();
+
+    ImGui::PushStyleColor(ImGuiCol_Text, s_category_colors[i]);
+    ImGui::Text("%s %.2fms", s_category_names[i], s_history[i][last_pos]);
+    ImGui::PopStyleColor();
+  }
+
+  // Stacked per-frame breakdown, oldest frame on the left, scaled to the worst frame in history.
+  float max_total = 0.0f;
+  for (u32 frame = 0; frame < NUM_HISTORY_FRAMES; frame++)
+  {
+    float total = 0.0f;
+    for (size_t i = 0; i < NUM_CATEGORIES; i++)
+      total += s_history[i][frame];
+    max_total = std::max(max_total, total);
+  }
+
+  const ImVec2 avail = ImGui::GetContentRegionAvail();
+  const ImVec2 graph_size(std::max(avail.x, 50.0f), std::max(avail.y, 50.0f));
+  const ImVec2 origin = ImGui::GetCursorScreenPos();
+  ImDrawList* dl = ImGui::GetWindowDrawList();
+  dl->AddRectFilled(origin, ImVec2(origin.x + graph_size.x, origin.y + graph_size.y), IM_COL32(0, 0, 0, 128));
+
+  if (max_total > 0.0f)
+  {
+    const float column_width = graph_size.x / static_cast<float>(NUM_HISTORY_FRAMES);
+    for (u32 frame = 0; frame < NUM_HISTORY_FRAMES; frame++)
+    {
+      const u32 idx = (s_history_pos + frame) % NUM_HISTORY_FRAMES;
+      const float x0 = origin.x + (column_width * static_cast<float>(frame));
+      float y = origin.y + graph_size.y;
+      for (size_t i = 0; i < NUM_CATEGORIES; i++)
+      {
+        const float height = (s_history[i][idx] / max_total) * graph_size.y;
+        if (height <= 0.0f)
+          continue;
+
+        dl->AddRectFilled(ImVec2(x0, y - height), ImVec2(x0 + column_width, y), s_category_colors[i]);
+        y -= height;
+      }
+    }
+
+    char label[32];
+    std::snprintf(label, sizeof(label), "%.1f ms", max_total);
+    dl->AddText(origin, IM_COL32(255, 255, 255, 255), label);
+  }
+
+  ImGui::Dummy(graph_size);
+  ImGui::End();
+}
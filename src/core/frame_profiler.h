@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#pragma once
+#include "types.h"
+
+#include "common/platform.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#elif defined(CPU_X64) || defined(CPU_X86)
+#include <x86intrin.h>
+#endif
+
+#if !defined(CPU_X64) && !defined(CPU_X86) && !defined(CPU_AARCH64)
+#include "common/timer.h"
+#endif
+
+#include <string>
+
+// Compile-time guard for the per-subsystem frame time breakdown. When enabled but not shown, the
+// only cost is a predicted branch per event dispatch; set to 0 to strip the instrumentation from
+// the event loop entirely.
+#define ENABLE_FRAME_PROFILER 1
+
+namespace FrameProfiler {
+
+enum class Category : u8
+{
+  CPU, // derived: whatever part of the frame isn't attributed below
+  GPU,
+  DMA,
+  SPU,
+  CDROM,
+  MDEC,
+  OtherEvent,
+  Present,
+
+  Count
+};
+
+/// Raw cycle counter, cheap enough to wrap every event dispatch. Only meaningful as a delta; the
+/// accumulated cycles are calibrated against the wall clock once per frame.
+ALWAYS_INLINE static u64 GetTimestamp()
+{
+#if defined(CPU_X64) || defined(CPU_X86)
+  return __rdtsc();
+#elif defined(CPU_AARCH64)
+#ifdef _MSC_VER
+  return _ReadStatusReg(ARM64_SYSREG(3, 3, 14, 0, 2)); // CNTVCT_EL0
+#else
+  u64 value;
+  asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+  return value;
+#endif
+#else
+  return Common::Timer::GetCurrentValue();
+#endif
+}
+
+const char* GetCategoryName(Category category);
+
+/// Category for a timing event, resolved once at event creation from the event name.
+Category GetCategoryForEventName(const std::string& name);
+
+/// Accumulates time against a category for the current frame. Only call while the profiler is
+/// shown (g_settings.debugging.show_frame_profiler).
+void AddTime(Category category, u64 timestamp_delta);
+
+/// Closes out the current frame: calibrates the accumulated cycles against the wall clock and
+/// pushes the breakdown into the history. Cheap no-op while the profiler isn't shown.
+void EndFrame();
+
+void DrawDebugWindow();
+
+} // namespace FrameProfiler
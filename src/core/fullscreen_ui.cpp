@@ -59,18 +59,20 @@ template<size_t L>
 class IconStackString : public StackString<L>
 {
 public:
-  ALWAYS_INLINE IconStackString(const char* icon, const char* str)
+  ALWAYS_INLINE IconStackString(const char* icon, const std::string_view& str)
   {
-    StackString<L>::Fmt("{} {}", icon, Host::TranslateToStringView(TR_CONTEXT, str));
+    StackString<L>::Fmt("{} {}", icon, str);
   }
 };
 } // namespace
 
-#define FSUI_ICONSTR(icon, str) IconStackString<128>(icon, str).GetCharArray()
-#define FSUI_STR(str) Host::TranslateToString(TR_CONTEXT, str)
-#define FSUI_CSTR(str) Host::TranslateToCString(TR_CONTEXT, str)
-#define FSUI_VSTR(str) Host::TranslateToStringView(TR_CONTEXT, str)
-#define FSUI_FSTR(str) fmt::runtime(Host::TranslateToStringView(TR_CONTEXT, str))
+// Menus are rebuilt every frame, so translations are cached per call site (see TRANSLATE_CACHED)
+// rather than going through the hash lookup every time.
+#define FSUI_ICONSTR(icon, str) IconStackString<128>(icon, FSUI_VSTR(str)).GetCharArray()
+#define FSUI_STR(str) std::string(FSUI_VSTR(str))
+#define FSUI_CSTR(str) TRANSLATE_CACHED(TR_CONTEXT, str)
+#define FSUI_VSTR(str) TRANSLATE_CACHED_SV(TR_CONTEXT, str)
+#define FSUI_FSTR(str) fmt::runtime(FSUI_VSTR(str))
 #define FSUI_NSTR(str) str
 
 using ImGuiFullscreen::g_large_font;
@@ -5094,10 +5096,13 @@ void FullscreenUI::PopulateSaveStateScreenshot(SaveStateListEntry* li, const Ext
   }
   else
   {
-    li->preview_texture = g_gpu_device->CreateTexture(
-      Resources::PLACEHOLDER_ICON_WIDTH, Resources::PLACEHOLDER_ICON_HEIGHT, 1, 1, 1, GPUTexture::Type::Texture,
-      GPUTexture::Format::RGBA8, Resources::PLACEHOLDER_ICON_DATA, sizeof(u32) * Resources::PLACEHOLDER_ICON_WIDTH,
-      false);
+    const std::vector<u32> placeholder_data = Resources::GetPlaceholderIconData();
+    if (!placeholder_data.empty())
+    {
+      li->preview_texture = g_gpu_device->CreateTexture(
+        Resources::PLACEHOLDER_ICON_WIDTH, Resources::PLACEHOLDER_ICON_HEIGHT, 1, 1, 1, GPUTexture::Type::Texture,
+        GPUTexture::Format::RGBA8, placeholder_data.data(), sizeof(u32) * Resources::PLACEHOLDER_ICON_WIDTH, false);
+    }
   }
 
   if (!li->preview_texture)
@@ -10,6 +10,7 @@
 
 #include "common/assert.h"
 #include "common/byte_stream.h"
+#include "common/file_system.h"
 #include "common/heterogeneous_containers.h"
 #include "common/log.h"
 #include "common/path.h"
@@ -19,6 +20,8 @@
 #include "rapidjson/document.h"
 #include "rapidjson/error/en.h"
 
+#include <algorithm>
+#include <cstring>
 #include <iomanip>
 #include <memory>
 #include <optional>
@@ -35,10 +38,89 @@ namespace GameDatabase {
 enum : u32
 {
   GAME_DATABASE_CACHE_SIGNATURE = 0x45434C48,
-  GAME_DATABASE_CACHE_VERSION = 5,
+  GAME_DATABASE_CACHE_VERSION = 6,
+};
+
+// The cache is a flat binary image: a header, fixed-size entry records sorted by serial, code records sorted by
+// code, disc set serial references, and a string table. Lookups binary-search the records and compare against the
+// string table in place, so the common path (cache hit at startup) performs no per-entry deserialization; entries
+// are only expanded into the public struct when something actually asks for them.
+#pragma pack(push, 4)
+struct CacheString
+{
+  u32 offset;
+  u32 length;
+};
+
+struct CacheHeader
+{
+  u32 signature;
+  u32 version;
+  u64 gamedb_ts;
+  u32 num_entries;
+  u32 num_codes;
+  u32 num_disc_set_serials;
+  u32 string_table_size;
+};
+
+struct CacheEntry
+{
+  CacheString serial;
+  CacheString title;
+  CacheString genre;
+  CacheString developer;
+  CacheString publisher;
+  CacheString disc_set_name;
+  u64 release_date;
+  u32 traits;
+  u32 optional_mask;
+  u32 dma_max_slice_ticks;
+  u32 dma_halt_ticks;
+  u32 gpu_fifo_size;
+  u32 gpu_max_run_ahead;
+  float gpu_pgxp_tolerance;
+  float gpu_pgxp_depth_threshold;
+  u32 disc_set_serial_start;
+  u32 disc_set_serial_count;
+  s16 display_active_start_offset;
+  s16 display_active_end_offset;
+  s8 display_line_start_offset;
+  s8 display_line_end_offset;
+  u8 min_players;
+  u8 max_players;
+  u8 min_blocks;
+  u8 max_blocks;
+  u16 supported_controllers;
+  u8 compatibility;
+  u8 unused;
+};
+
+struct CacheCode
+{
+  CacheString code;
+  u32 entry_index;
+};
+#pragma pack(pop)
+
+static_assert(static_cast<u32>(Trait::Count) <= 32, "traits fit in cache bitmask");
+
+// bit positions in CacheEntry::optional_mask, in declaration order of the public struct
+enum : u32
+{
+  OPTIONAL_DISPLAY_ACTIVE_START_OFFSET,
+  OPTIONAL_DISPLAY_ACTIVE_END_OFFSET,
+  OPTIONAL_DISPLAY_LINE_START_OFFSET,
+  OPTIONAL_DISPLAY_LINE_END_OFFSET,
+  OPTIONAL_DMA_MAX_SLICE_TICKS,
+  OPTIONAL_DMA_HALT_TICKS,
+  OPTIONAL_GPU_FIFO_SIZE,
+  OPTIONAL_GPU_MAX_RUN_AHEAD,
+  OPTIONAL_GPU_PGXP_TOLERANCE,
+  OPTIONAL_GPU_PGXP_DEPTH_THRESHOLD,
 };
 
 static Entry* GetMutableEntry(const std::string_view& serial);
+static Entry* MaterializeCacheEntry(u32 index);
 
 static bool LoadFromCache();
 static bool SaveToCache();
@@ -77,7 +159,26 @@ static bool s_track_hashes_loaded = false;
 static std::vector<GameDatabase::Entry> s_entries;
 static UnorderedStringMap<u32> s_code_lookup;
 
+// cache image and pointers into it; when the image is loaded s_entries/s_code_lookup stay empty.
+// the image is normally a read-only file mapping, so multiple instances pointed at the same cache
+// directory share one copy of the database pages; s_cache_data is only the fallback when the file
+// can't be mapped.
+static FileSystem::MemoryMappedFile s_cache_file_map;
+static std::vector<u8> s_cache_data;
+static const GameDatabase::CacheEntry* s_cache_entries = nullptr;
+static const GameDatabase::CacheCode* s_cache_codes = nullptr;
+static const GameDatabase::CacheString* s_cache_disc_set_serials = nullptr;
+static const char* s_cache_string_table = nullptr;
+static u32 s_cache_entry_count = 0;
+static u32 s_cache_code_count = 0;
+static std::vector<std::unique_ptr<GameDatabase::Entry>> s_cache_materialized_entries;
+
 static TrackHashesMap s_track_hashes_map;
+
+ALWAYS_INLINE static std::string_view GetCacheString(const GameDatabase::CacheString& str)
+{
+  return std::string_view(s_cache_string_table + str.offset, str.length);
+}
 } // namespace GameDatabase
 
 void GameDatabase::EnsureLoaded()
@@ -105,6 +206,15 @@ void GameDatabase::Unload()
 {
   s_entries = {};
   s_code_lookup = {};
+  s_cache_file_map.Close();
+  s_cache_data = {};
+  s_cache_entries = nullptr;
+  s_cache_codes = nullptr;
+  s_cache_disc_set_serials = nullptr;
+  s_cache_string_table = nullptr;
+  s_cache_entry_count = 0;
+  s_cache_code_count = 0;
+  s_cache_materialized_entries = std::vector<std::unique_ptr<Entry>>();
   s_loaded = false;
 }
 
@@ -115,6 +225,15 @@ const GameDatabase::Entry* GameDatabase::GetEntryForId(const std::string_view& c
 
   EnsureLoaded();
 
+  if (s_cache_entries)
+  {
+    const CacheCode* const end = s_cache_codes + s_cache_code_count;
+    const CacheCode* it =
+      std::lower_bound(s_cache_codes, end, code,
+                       [](const CacheCode& lhs, const std::string_view& rhs) { return GetCacheString(lhs.code) < rhs; });
+    return (it != end && GetCacheString(it->code) == code) ? MaterializeCacheEntry(it->entry_index) : nullptr;
+  }
+
   auto iter = s_code_lookup.find(code);
   return (iter != s_code_lookup.end()) ? &s_entries[iter->second] : nullptr;
 }
@@ -168,6 +287,17 @@ const GameDatabase::Entry* GameDatabase::GetEntryForSerial(const std::string_vie
 
 GameDatabase::Entry* GameDatabase::GetMutableEntry(const std::string_view& serial)
 {
+  if (s_cache_entries)
+  {
+    const CacheEntry* const end = s_cache_entries + s_cache_entry_count;
+    const CacheEntry* it = std::lower_bound(
+      s_cache_entries, end, serial,
+      [](const CacheEntry& lhs, const std::string_view& rhs) { return GetCacheString(lhs.serial) < rhs; });
+    return (it != end && GetCacheString(it->serial) == serial) ?
+             MaterializeCacheEntry(static_cast<u32>(it - s_cache_entries)) :
+             nullptr;
+  }
+
   for (Entry& entry : s_entries)
   {
     if (entry.serial == serial)
@@ -177,6 +307,57 @@ GameDatabase::Entry* GameDatabase::GetMutableEntry(const std::string_view& seria
   return nullptr;
 }
 
+GameDatabase::Entry* GameDatabase::MaterializeCacheEntry(u32 index)
+{
+  std::unique_ptr<Entry>& slot = s_cache_materialized_entries[index];
+  if (slot)
+    return slot.get();
+
+  const CacheEntry& rec = s_cache_entries[index];
+  slot = std::make_unique<Entry>();
+
+  Entry* const entry = slot.get();
+  entry->serial = GetCacheString(rec.serial);
+  entry->title = GetCacheString(rec.title);
+  entry->genre = GetCacheString(rec.genre);
+  entry->developer = GetCacheString(rec.developer);
+  entry->publisher = GetCacheString(rec.publisher);
+  entry->release_date = rec.release_date;
+  entry->min_players = rec.min_players;
+  entry->max_players = rec.max_players;
+  entry->min_blocks = rec.min_blocks;
+  entry->max_blocks = rec.max_blocks;
+  entry->supported_controllers = rec.supported_controllers;
+  entry->compatibility = static_cast<CompatibilityRating>(rec.compatibility);
+
+  for (u32 i = 0; i < static_cast<u32>(Trait::Count); i++)
+    entry->traits[i] = ((rec.traits & (1u << i)) != 0);
+
+#define UNPACK_OPTIONAL(bit, field)                                                                                    \
+  if (rec.optional_mask & (1u << (bit)))                                                                               \
+  entry->field = rec.field
+
+  UNPACK_OPTIONAL(OPTIONAL_DISPLAY_ACTIVE_START_OFFSET, display_active_start_offset);
+  UNPACK_OPTIONAL(OPTIONAL_DISPLAY_ACTIVE_END_OFFSET, display_active_end_offset);
+  UNPACK_OPTIONAL(OPTIONAL_DISPLAY_LINE_START_OFFSET, display_line_start_offset);
+  UNPACK_OPTIONAL(OPTIONAL_DISPLAY_LINE_END_OFFSET, display_line_end_offset);
+  UNPACK_OPTIONAL(OPTIONAL_DMA_MAX_SLICE_TICKS, dma_max_slice_ticks);
+  UNPACK_OPTIONAL(OPTIONAL_DMA_HALT_TICKS, dma_halt_ticks);
+  UNPACK_OPTIONAL(OPTIONAL_GPU_FIFO_SIZE, gpu_fifo_size);
+  UNPACK_OPTIONAL(OPTIONAL_GPU_MAX_RUN_AHEAD, gpu_max_run_ahead);
+  UNPACK_OPTIONAL(OPTIONAL_GPU_PGXP_TOLERANCE, gpu_pgxp_tolerance);
+  UNPACK_OPTIONAL(OPTIONAL_GPU_PGXP_DEPTH_THRESHOLD, gpu_pgxp_depth_threshold);
+
+#undef UNPACK_OPTIONAL
+
+  entry->disc_set_name = GetCacheString(rec.disc_set_name);
+  entry->disc_set_serials.reserve(rec.disc_set_serial_count);
+  for (u32 i = 0; i < rec.disc_set_serial_count; i++)
+    entry->disc_set_serials.emplace_back(GetCacheString(s_cache_disc_set_serials[rec.disc_set_serial_start + i]));
+
+  return entry;
+}
+
 const char* GameDatabase::GetTraitName(Trait trait)
 {
   DebugAssert(trait < Trait::Count);
@@ -482,37 +663,6 @@ void GameDatabase::Entry::ApplySettings(Settings& settings, bool display_osd_mes
 #undef BIT_FOR
 }
 
-template<typename T>
-bool ReadOptionalFromStream(ByteStream* stream, std::optional<T>* dest)
-{
-  bool has_value;
-  if (!stream->Read2(&has_value, sizeof(has_value)))
-    return false;
-
-  if (!has_value)
-    return true;
-
-  T value;
-  if (!stream->Read2(&value, sizeof(T)))
-    return false;
-
-  *dest = value;
-  return true;
-}
-
-template<typename T>
-bool WriteOptionalToStream(ByteStream* stream, const std::optional<T>& src)
-{
-  const bool has_value = src.has_value();
-  if (!stream->Write2(&has_value, sizeof(has_value)))
-    return false;
-
-  if (!has_value)
-    return true;
-
-  return stream->Write2(&src.value(), sizeof(T));
-}
-
 static std::string GetCacheFile()
 {
   return Path::Combine(EmuFolders::Cache, "gamedb.cache");
@@ -520,103 +670,109 @@ static std::string GetCacheFile()
 
 bool GameDatabase::LoadFromCache()
 {
-  std::unique_ptr<ByteStream> stream(
-    ByteStream::OpenFile(GetCacheFile().c_str(), BYTESTREAM_OPEN_READ | BYTESTREAM_OPEN_STREAMED));
-  if (!stream)
+  const std::string cache_file = GetCacheFile();
+
+  // Map the cache read-only so instances sharing a cache directory share the pages; fall back to a
+  // heap read if the mapping fails. Held in a local until validation passes, so a corrupted image
+  // is unmapped again on the way out.
+  FileSystem::MemoryMappedFile file_map;
+  std::optional<std::vector<u8>> data;
+  if (!file_map.Open(cache_file.c_str()))
   {
-    Log_DevPrintf("Cache does not exist, loading full database.");
-    return false;
+    data = FileSystem::ReadBinaryFile(cache_file.c_str());
+    if (!data.has_value())
+    {
+      Log_DevPrintf("Cache does not exist, loading full database.");
+      return false;
+    }
   }
 
+  const u8* const data_ptr = file_map.IsOpen() ? file_map.GetData() : data->data();
+  const size_t data_size = file_map.IsOpen() ? file_map.GetSize() : data->size();
+
   const u64 gamedb_ts = Host::GetResourceFileTimestamp("gamedb.json").value_or(0);
 
-  u32 signature, version, num_entries, num_codes;
-  u64 file_gamedb_ts;
-  if (!stream->ReadU32(&signature) || !stream->ReadU32(&version) || !stream->ReadU64(&file_gamedb_ts) ||
-      !stream->ReadU32(&num_entries) || !stream->ReadU32(&num_codes) || signature != GAME_DATABASE_CACHE_SIGNATURE ||
-      version != GAME_DATABASE_CACHE_VERSION)
+  CacheHeader header;
+  if (data_size < sizeof(header))
   {
     Log_DevPrintf("Cache header is corrupted or version mismatch.");
     return false;
   }
 
-  if (gamedb_ts != file_gamedb_ts)
+  std::memcpy(&header, data_ptr, sizeof(header));
+  if (header.signature != GAME_DATABASE_CACHE_SIGNATURE || header.version != GAME_DATABASE_CACHE_VERSION)
   {
-    Log_DevPrintf("Cache is out of date, recreating.");
+    Log_DevPrintf("Cache header is corrupted or version mismatch.");
     return false;
   }
 
-  s_entries.reserve(num_entries);
+  if (gamedb_ts != header.gamedb_ts)
+  {
+    Log_DevPrintf("Cache is out of date, recreating.");
+    return false;
+  }
 
-  for (u32 i = 0; i < num_entries; i++)
+  const u64 expected_size = sizeof(CacheHeader) + (static_cast<u64>(header.num_entries) * sizeof(CacheEntry)) +
+                            (static_cast<u64>(header.num_codes) * sizeof(CacheCode)) +
+                            (static_cast<u64>(header.num_disc_set_serials) * sizeof(CacheString)) +
+                            header.string_table_size;
+  if (static_cast<u64>(data_size) != expected_size)
   {
-    Entry& entry = s_entries.emplace_back();
+    Log_DevPrintf("Cache is truncated.");
+    return false;
+  }
+
+  const CacheEntry* const entries = reinterpret_cast<const CacheEntry*>(data_ptr + sizeof(CacheHeader));
+  const CacheCode* const codes = reinterpret_cast<const CacheCode*>(entries + header.num_entries);
+  const CacheString* const disc_set_serials = reinterpret_cast<const CacheString*>(codes + header.num_codes);
+
+  // Validate every string reference up front, so lookups don't have to bounds-check the table.
+  const auto string_ok = [&header](const CacheString& str) {
+    return (str.offset <= header.string_table_size && str.length <= (header.string_table_size - str.offset));
+  };
 
-    constexpr u32 num_bytes = (static_cast<u32>(Trait::Count) + 7) / 8;
-    std::array<u8, num_bytes> bits;
-    u8 compatibility;
-    u32 num_disc_set_serials;
-
-    if (!stream->ReadSizePrefixedString(&entry.serial) || !stream->ReadSizePrefixedString(&entry.title) ||
-        !stream->ReadSizePrefixedString(&entry.genre) || !stream->ReadSizePrefixedString(&entry.developer) ||
-        !stream->ReadSizePrefixedString(&entry.publisher) || !stream->ReadU64(&entry.release_date) ||
-        !stream->ReadU8(&entry.min_players) || !stream->ReadU8(&entry.max_players) ||
-        !stream->ReadU8(&entry.min_blocks) || !stream->ReadU8(&entry.max_blocks) ||
-        !stream->ReadU16(&entry.supported_controllers) || !stream->ReadU8(&compatibility) ||
-        compatibility >= static_cast<u8>(GameDatabase::CompatibilityRating::Count) ||
-        !stream->Read2(bits.data(), num_bytes) ||
-        !ReadOptionalFromStream(stream.get(), &entry.display_active_start_offset) ||
-        !ReadOptionalFromStream(stream.get(), &entry.display_active_end_offset) ||
-        !ReadOptionalFromStream(stream.get(), &entry.display_line_start_offset) ||
-        !ReadOptionalFromStream(stream.get(), &entry.display_line_end_offset) ||
-        !ReadOptionalFromStream(stream.get(), &entry.dma_max_slice_ticks) ||
-        !ReadOptionalFromStream(stream.get(), &entry.dma_halt_ticks) ||
-        !ReadOptionalFromStream(stream.get(), &entry.gpu_fifo_size) ||
-        !ReadOptionalFromStream(stream.get(), &entry.gpu_max_run_ahead) ||
-        !ReadOptionalFromStream(stream.get(), &entry.gpu_pgxp_tolerance) ||
-        !ReadOptionalFromStream(stream.get(), &entry.gpu_pgxp_depth_threshold) ||
-        !stream->ReadSizePrefixedString(&entry.disc_set_name) || !stream->ReadU32(&num_disc_set_serials))
+  for (u32 i = 0; i < header.num_entries; i++)
+  {
+    const CacheEntry& entry = entries[i];
+    if (!string_ok(entry.serial) || !string_ok(entry.title) || !string_ok(entry.genre) ||
+        !string_ok(entry.developer) || !string_ok(entry.publisher) || !string_ok(entry.disc_set_name) ||
+        entry.compatibility >= static_cast<u8>(GameDatabase::CompatibilityRating::Count) ||
+        entry.disc_set_serial_start > header.num_disc_set_serials ||
+        entry.disc_set_serial_count > (header.num_disc_set_serials - entry.disc_set_serial_start))
     {
       Log_DevPrintf("Cache entry is corrupted.");
       return false;
     }
+  }
 
-    if (num_disc_set_serials > 0)
-    {
-      entry.disc_set_serials.reserve(num_disc_set_serials);
-      for (u32 j = 0; j < num_disc_set_serials; j++)
-      {
-        if (!stream->ReadSizePrefixedString(&entry.disc_set_serials.emplace_back()))
-        {
-          Log_DevPrintf("Cache entry is corrupted.");
-          return false;
-        }
-      }
-    }
-
-    entry.compatibility = static_cast<GameDatabase::CompatibilityRating>(compatibility);
-    entry.traits.reset();
-    for (u32 j = 0; j < static_cast<int>(Trait::Count); j++)
+  for (u32 i = 0; i < header.num_codes; i++)
+  {
+    if (!string_ok(codes[i].code) || codes[i].entry_index >= header.num_entries)
     {
-      if ((bits[j / 8] & (1u << (j % 8))) != 0)
-        entry.traits[j] = true;
+      Log_DevPrintf("Cache code entry is corrupted.");
+      return false;
     }
   }
 
-  for (u32 i = 0; i < num_codes; i++)
+  for (u32 i = 0; i < header.num_disc_set_serials; i++)
   {
-    std::string code;
-    u32 index;
-    if (!stream->ReadSizePrefixedString(&code) || !stream->ReadU32(&index) ||
-        index >= static_cast<u32>(s_entries.size()))
+    if (!string_ok(disc_set_serials[i]))
     {
-      Log_DevPrintf("Cache code entry is corrupted.");
+      Log_DevPrintf("Cache entry is corrupted.");
       return false;
     }
-
-    s_code_lookup.emplace(std::move(code), index);
   }
 
+  // Moving the mapping/vector preserves the buffer, so the record pointers stay valid.
+  s_cache_file_map = std::move(file_map);
+  s_cache_data = data.has_value() ? std::move(data.value()) : std::vector<u8>();
+  s_cache_entries = entries;
+  s_cache_codes = codes;
+  s_cache_disc_set_serials = disc_set_serials;
+  s_cache_string_table = reinterpret_cast<const char*>(disc_set_serials + header.num_disc_set_serials);
+  s_cache_entry_count = header.num_entries;
+  s_cache_code_count = header.num_codes;
+  s_cache_materialized_entries.resize(header.num_entries);
   return true;
 }
 
@@ -624,70 +780,144 @@ bool GameDatabase::SaveToCache()
 {
   const u64 gamedb_ts = Host::GetResourceFileTimestamp("gamedb.json").value_or(0);
 
-  std::unique_ptr<ByteStream> stream(
-    ByteStream::OpenFile(GetCacheFile().c_str(), BYTESTREAM_OPEN_CREATE | BYTESTREAM_OPEN_WRITE |
-                                                   BYTESTREAM_OPEN_TRUNCATE | BYTESTREAM_OPEN_STREAMED));
-  if (!stream)
-    return false;
-
-  bool result = stream->WriteU32(GAME_DATABASE_CACHE_SIGNATURE);
-  result = result && stream->WriteU32(GAME_DATABASE_CACHE_VERSION);
-  result = result && stream->WriteU64(static_cast<u64>(gamedb_ts));
+  // Deduplicated string table. Empty strings all reference offset zero with zero length.
+  std::vector<char> string_table;
+  UnorderedStringMap<u32> string_offsets;
+  const auto add_string = [&string_table, &string_offsets](const std::string& str) {
+    CacheString ret;
+    ret.length = static_cast<u32>(str.length());
+    if (str.empty())
+    {
+      ret.offset = 0;
+      return ret;
+    }
 
-  result = result && stream->WriteU32(static_cast<u32>(s_entries.size()));
-  result = result && stream->WriteU32(static_cast<u32>(s_code_lookup.size()));
+    const auto it = string_offsets.find(str);
+    if (it != string_offsets.end())
+    {
+      ret.offset = it->second;
+      return ret;
+    }
 
-  for (const Entry& entry : s_entries)
+    ret.offset = static_cast<u32>(string_table.size());
+    string_table.insert(string_table.end(), str.begin(), str.end());
+    string_offsets.emplace(str, ret.offset);
+    return ret;
+  };
+
+  // Entry records are sorted by serial so lookups can binary-search, which means the code records have to be
+  // remapped from the in-memory entry order.
+  std::vector<u32> entry_order(s_entries.size());
+  for (u32 i = 0; i < static_cast<u32>(entry_order.size()); i++)
+    entry_order[i] = i;
+  std::sort(entry_order.begin(), entry_order.end(),
+            [](u32 lhs, u32 rhs) { return s_entries[lhs].serial < s_entries[rhs].serial; });
+
+  std::vector<u32> entry_remap(s_entries.size());
+  for (u32 i = 0; i < static_cast<u32>(entry_order.size()); i++)
+    entry_remap[entry_order[i]] = i;
+
+  std::vector<CacheEntry> entries;
+  entries.reserve(s_entries.size());
+  std::vector<CacheString> disc_set_serials;
+
+  for (const u32 src_index : entry_order)
   {
-    result = result && stream->WriteSizePrefixedString(entry.serial);
-    result = result && stream->WriteSizePrefixedString(entry.title);
-    result = result && stream->WriteSizePrefixedString(entry.genre);
-    result = result && stream->WriteSizePrefixedString(entry.developer);
-    result = result && stream->WriteSizePrefixedString(entry.publisher);
-    result = result && stream->WriteU64(entry.release_date);
-    result = result && stream->WriteU8(entry.min_players);
-    result = result && stream->WriteU8(entry.max_players);
-    result = result && stream->WriteU8(entry.min_blocks);
-    result = result && stream->WriteU8(entry.max_blocks);
-    result = result && stream->WriteU16(entry.supported_controllers);
-    result = result && stream->WriteU8(static_cast<u8>(entry.compatibility));
-
-    constexpr u32 num_bytes = (static_cast<u32>(Trait::Count) + 7) / 8;
-    std::array<u8, num_bytes> bits;
-    bits.fill(0);
-    for (u32 j = 0; j < static_cast<int>(Trait::Count); j++)
+    const Entry& entry = s_entries[src_index];
+    CacheEntry rec = {};
+    rec.serial = add_string(entry.serial);
+    rec.title = add_string(entry.title);
+    rec.genre = add_string(entry.genre);
+    rec.developer = add_string(entry.developer);
+    rec.publisher = add_string(entry.publisher);
+    rec.disc_set_name = add_string(entry.disc_set_name);
+    rec.release_date = entry.release_date;
+    rec.min_players = entry.min_players;
+    rec.max_players = entry.max_players;
+    rec.min_blocks = entry.min_blocks;
+    rec.max_blocks = entry.max_blocks;
+    rec.supported_controllers = entry.supported_controllers;
+    rec.compatibility = static_cast<u8>(entry.compatibility);
+
+    for (u32 j = 0; j < static_cast<u32>(Trait::Count); j++)
     {
       if (entry.traits[j])
-        bits[j / 8] |= (1u << (j % 8));
+        rec.traits |= (1u << j);
     }
 
-    result = result && stream->Write2(bits.data(), num_bytes);
-
-    result = result && WriteOptionalToStream(stream.get(), entry.display_active_start_offset);
-    result = result && WriteOptionalToStream(stream.get(), entry.display_active_end_offset);
-    result = result && WriteOptionalToStream(stream.get(), entry.display_line_start_offset);
-    result = result && WriteOptionalToStream(stream.get(), entry.display_line_end_offset);
-    result = result && WriteOptionalToStream(stream.get(), entry.dma_max_slice_ticks);
-    result = result && WriteOptionalToStream(stream.get(), entry.dma_halt_ticks);
-    result = result && WriteOptionalToStream(stream.get(), entry.gpu_fifo_size);
-    result = result && WriteOptionalToStream(stream.get(), entry.gpu_max_run_ahead);
-    result = result && WriteOptionalToStream(stream.get(), entry.gpu_pgxp_tolerance);
-    result = result && WriteOptionalToStream(stream.get(), entry.gpu_pgxp_depth_threshold);
-
-    result = result && stream->WriteSizePrefixedString(entry.disc_set_name);
-    result = result && stream->WriteU32(static_cast<u32>(entry.disc_set_serials.size()));
+#define PACK_OPTIONAL(bit, field)                                                                                      \
+  if (entry.field.has_value())                                                                                         \
+  {                                                                                                                    \
+    rec.optional_mask |= (1u << (bit));                                                                                \
+    rec.field = entry.field.value();                                                                                   \
+  }
+
+    PACK_OPTIONAL(OPTIONAL_DISPLAY_ACTIVE_START_OFFSET, display_active_start_offset);
+    PACK_OPTIONAL(OPTIONAL_DISPLAY_ACTIVE_END_OFFSET, display_active_end_offset);
+    PACK_OPTIONAL(OPTIONAL_DISPLAY_LINE_START_OFFSET, display_line_start_offset);
+    PACK_OPTIONAL(OPTIONAL_DISPLAY_LINE_END_OFFSET, display_line_end_offset);
+    PACK_OPTIONAL(OPTIONAL_DMA_MAX_SLICE_TICKS, dma_max_slice_ticks);
+    PACK_OPTIONAL(OPTIONAL_DMA_HALT_TICKS, dma_halt_ticks);
+    PACK_OPTIONAL(OPTIONAL_GPU_FIFO_SIZE, gpu_fifo_size);
+    PACK_OPTIONAL(OPTIONAL_GPU_MAX_RUN_AHEAD, gpu_max_run_ahead);
+    PACK_OPTIONAL(OPTIONAL_GPU_PGXP_TOLERANCE, gpu_pgxp_tolerance);
+    PACK_OPTIONAL(OPTIONAL_GPU_PGXP_DEPTH_THRESHOLD, gpu_pgxp_depth_threshold);
+
+#undef PACK_OPTIONAL
+
+    rec.disc_set_serial_start = static_cast<u32>(disc_set_serials.size());
+    rec.disc_set_serial_count = static_cast<u32>(entry.disc_set_serials.size());
     for (const std::string& serial : entry.disc_set_serials)
-      result = result && stream->WriteSizePrefixedString(serial);
+      disc_set_serials.push_back(add_string(serial));
+
+    entries.push_back(rec);
   }
 
+  std::vector<CacheCode> codes;
+  codes.reserve(s_code_lookup.size());
   for (const auto& it : s_code_lookup)
   {
-    result = result && stream->WriteSizePrefixedString(it.first);
-    result = result && stream->WriteU32(it.second);
+    CacheCode rec;
+    rec.code = add_string(it.first);
+    rec.entry_index = entry_remap[it.second];
+    codes.push_back(rec);
   }
+  std::sort(codes.begin(), codes.end(), [&string_table](const CacheCode& lhs, const CacheCode& rhs) {
+    return (std::string_view(string_table.data() + lhs.code.offset, lhs.code.length) <
+            std::string_view(string_table.data() + rhs.code.offset, rhs.code.length));
+  });
+
+  CacheHeader header = {};
+  header.signature = GAME_DATABASE_CACHE_SIGNATURE;
+  header.version = GAME_DATABASE_CACHE_VERSION;
+  header.gamedb_ts = gamedb_ts;
+  header.num_entries = static_cast<u32>(entries.size());
+  header.num_codes = static_cast<u32>(codes.size());
+  header.num_disc_set_serials = static_cast<u32>(disc_set_serials.size());
+  header.string_table_size = static_cast<u32>(string_table.size());
+
+  // Atomic update (write to temporary + rename) rather than truncate-in-place, since other
+  // instances may have the old cache image mapped.
+  std::unique_ptr<ByteStream> stream(
+    ByteStream::OpenFile(GetCacheFile().c_str(), BYTESTREAM_OPEN_CREATE | BYTESTREAM_OPEN_WRITE |
+                                                   BYTESTREAM_OPEN_TRUNCATE | BYTESTREAM_OPEN_STREAMED |
+                                                   BYTESTREAM_OPEN_ATOMIC_UPDATE));
+  if (!stream)
+    return false;
 
+  bool result = stream->Write2(&header, sizeof(header));
+  result = result && (entries.empty() ||
+                      stream->Write2(entries.data(), static_cast<u32>(sizeof(CacheEntry) * entries.size())));
+  result =
+    result && (codes.empty() || stream->Write2(codes.data(), static_cast<u32>(sizeof(CacheCode) * codes.size())));
+  result = result && (disc_set_serials.empty() ||
+                      stream->Write2(disc_set_serials.data(),
+                                     static_cast<u32>(sizeof(CacheString) * disc_set_serials.size())));
+  result = result &&
+           (string_table.empty() || stream->Write2(string_table.data(), static_cast<u32>(string_table.size())));
   result = result && stream->Flush();
-  return true;
+  result = result && stream->Commit();
+  return result;
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -21,11 +21,17 @@
 #include "common/progress_callback.h"
 #include "common/string_util.h"
 
+#include "xxhash.h"
+
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cctype>
+#include <chrono>
 #include <ctime>
+#include <optional>
 #include <string_view>
+#include <thread>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -40,7 +46,14 @@ namespace GameList {
 enum : u32
 {
   GAME_LIST_CACHE_SIGNATURE = 0x45434C47,
-  GAME_LIST_CACHE_VERSION = 34,
+  GAME_LIST_CACHE_VERSION = 35,
+
+  // Record type byte for directory digest records in the cache file. Game entries store their EntryType here, so
+  // anything above EntryType::Count is free.
+  DIRECTORY_CACHE_RECORD_TYPE = 0xFF,
+
+  // Entry writes are batched up in memory and flushed to the cache file in chunks of this size.
+  CACHE_WRITE_BUFFER_FLUSH_SIZE = 65536,
 
   PLAYED_TIME_SERIAL_LENGTH = 32,
   PLAYED_TIME_LAST_TIME_LENGTH = 20,  // uint64
@@ -55,7 +68,17 @@ struct PlayedTimeEntry
   std::time_t total_played_time;
 };
 
+// Digest over a scanned directory, stored in the cache file so an unchanged directory can be served straight from
+// the cache without enumerating (and stat'ing) its files on the next refresh.
+struct DirectoryDigest
+{
+  u64 signature;      // hash of the directory (and for recursive scans, subdirectory) modification times
+  u64 content_digest; // hash of the sorted file name/size/mtime list from the last full enumeration
+  bool recursive;
+};
+
 using CacheMap = UnorderedStringMap<Entry>;
+using DirectoryDigestMap = UnorderedStringMap<DirectoryDigest>;
 using PlayedTimeMap = UnorderedStringMap<PlayedTimeEntry>;
 
 static_assert(std::is_same_v<decltype(Entry::hash), System::GameHash>);
@@ -69,14 +92,21 @@ static void ScanDirectory(const char* path, bool recursive, bool only_cache,
                           const std::vector<std::string>& excluded_paths, const PlayedTimeMap& played_time_map,
                           ProgressCallback* progress);
 static bool AddFileFromCache(const std::string& path, std::time_t timestamp, const PlayedTimeMap& played_time_map);
+static void AddDirectoryFromCache(const char* path, bool recursive, const std::vector<std::string>& excluded_paths,
+                                  const PlayedTimeMap& played_time_map);
 static bool ScanFile(std::string path, std::time_t timestamp, std::unique_lock<std::recursive_mutex>& lock,
                      const PlayedTimeMap& played_time_map);
 
+static std::optional<u64> GetDirectorySignature(const char* path, bool recursive);
+static u64 GetDirectoryContentDigest(const FileSystem::FindResultsArray& files);
+
 static std::string GetCacheFilename();
 static void LoadCache();
 static bool LoadEntriesFromCache(ByteStream* stream);
 static bool OpenCacheForWriting();
 static bool WriteEntryToCache(const Entry* entry);
+static bool WriteDirectoryRecordToCache(const std::string& path, bool recursive, u64 signature, u64 content_digest);
+static void FlushCacheWriteBuffer();
 static void CloseCacheFileStream();
 static void DeleteCacheFile();
 
@@ -91,7 +121,9 @@ static PlayedTimeEntry UpdatePlayedTimeFile(const std::string& path, const std::
 static std::vector<GameList::Entry> s_entries;
 static std::recursive_mutex s_mutex;
 static GameList::CacheMap s_cache_map;
+static GameList::DirectoryDigestMap s_directory_digest_map;
 static std::unique_ptr<ByteStream> s_cache_write_stream;
+static std::unique_ptr<GrowableMemoryByteStream> s_cache_write_buffer;
 
 static bool m_game_list_loaded = false;
 
@@ -313,7 +345,37 @@ bool GameList::LoadEntriesFromCache(ByteStream* stream)
     u8 region;
     u8 compatibility_rating;
 
-    if (!stream->ReadU8(&type) || !stream->ReadU8(&region) || !stream->ReadSizePrefixedString(&path) ||
+    if (!stream->ReadU8(&type))
+    {
+      Log_WarningPrintf("Game list cache entry is corrupted");
+      return false;
+    }
+
+    if (type == DIRECTORY_CACHE_RECORD_TYPE)
+    {
+      // Directory digest record. Later records override earlier ones, the same as entries.
+      std::string dir_path;
+      u8 dir_recursive;
+      DirectoryDigest digest;
+      if (!stream->ReadSizePrefixedString(&dir_path) || !stream->ReadU8(&dir_recursive) ||
+          !stream->ReadU64(&digest.signature) || !stream->ReadU64(&digest.content_digest) || dir_recursive > 1)
+      {
+        Log_WarningPrintf("Game list cache directory record is corrupted");
+        return false;
+      }
+
+      digest.recursive = (dir_recursive != 0);
+
+      auto iter = s_directory_digest_map.find(dir_path);
+      if (iter != s_directory_digest_map.end())
+        iter->second = digest;
+      else
+        s_directory_digest_map.emplace(std::move(dir_path), digest);
+
+      continue;
+    }
+
+    if (!stream->ReadU8(&region) || !stream->ReadSizePrefixedString(&path) ||
         !stream->ReadSizePrefixedString(&ge.serial) || !stream->ReadSizePrefixedString(&ge.title) ||
         !stream->ReadSizePrefixedString(&ge.genre) || !stream->ReadSizePrefixedString(&ge.publisher) ||
         !stream->ReadSizePrefixedString(&ge.developer) || !stream->ReadU64(&ge.hash) ||
@@ -345,28 +407,68 @@ bool GameList::LoadEntriesFromCache(ByteStream* stream)
 
 bool GameList::WriteEntryToCache(const Entry* entry)
 {
+  // Records are accumulated in memory and flushed in large chunks, rather than issuing dozens of small writes to
+  // the cache file per entry.
+  if (!s_cache_write_buffer)
+    s_cache_write_buffer = ByteStream::CreateGrowableMemoryStream();
+
   bool result = true;
-  result &= s_cache_write_stream->WriteU8(static_cast<u8>(entry->type));
-  result &= s_cache_write_stream->WriteU8(static_cast<u8>(entry->region));
-  result &= s_cache_write_stream->WriteSizePrefixedString(entry->path);
-  result &= s_cache_write_stream->WriteSizePrefixedString(entry->serial);
-  result &= s_cache_write_stream->WriteSizePrefixedString(entry->title);
-  result &= s_cache_write_stream->WriteSizePrefixedString(entry->genre);
-  result &= s_cache_write_stream->WriteSizePrefixedString(entry->publisher);
-  result &= s_cache_write_stream->WriteSizePrefixedString(entry->developer);
-  result &= s_cache_write_stream->WriteU64(entry->hash);
-  result &= s_cache_write_stream->WriteU64(entry->total_size);
-  result &= s_cache_write_stream->WriteU64(entry->last_modified_time);
-  result &= s_cache_write_stream->WriteU64(entry->release_date);
-  result &= s_cache_write_stream->WriteU16(entry->supported_controllers);
-  result &= s_cache_write_stream->WriteU8(entry->min_players);
-  result &= s_cache_write_stream->WriteU8(entry->max_players);
-  result &= s_cache_write_stream->WriteU8(entry->min_blocks);
-  result &= s_cache_write_stream->WriteU8(entry->max_blocks);
-  result &= s_cache_write_stream->WriteU8(static_cast<u8>(entry->compatibility));
+  result &= s_cache_write_buffer->WriteU8(static_cast<u8>(entry->type));
+  result &= s_cache_write_buffer->WriteU8(static_cast<u8>(entry->region));
+  result &= s_cache_write_buffer->WriteSizePrefixedString(entry->path);
+  result &= s_cache_write_buffer->WriteSizePrefixedString(entry->serial);
+  result &= s_cache_write_buffer->WriteSizePrefixedString(entry->title);
+  result &= s_cache_write_buffer->WriteSizePrefixedString(entry->genre);
+  result &= s_cache_write_buffer->WriteSizePrefixedString(entry->publisher);
+  result &= s_cache_write_buffer->WriteSizePrefixedString(entry->developer);
+  result &= s_cache_write_buffer->WriteU64(entry->hash);
+  result &= s_cache_write_buffer->WriteU64(entry->total_size);
+  result &= s_cache_write_buffer->WriteU64(entry->last_modified_time);
+  result &= s_cache_write_buffer->WriteU64(entry->release_date);
+  result &= s_cache_write_buffer->WriteU16(entry->supported_controllers);
+  result &= s_cache_write_buffer->WriteU8(entry->min_players);
+  result &= s_cache_write_buffer->WriteU8(entry->max_players);
+  result &= s_cache_write_buffer->WriteU8(entry->min_blocks);
+  result &= s_cache_write_buffer->WriteU8(entry->max_blocks);
+  result &= s_cache_write_buffer->WriteU8(static_cast<u8>(entry->compatibility));
+
+  if (s_cache_write_buffer->GetPosition() >= CACHE_WRITE_BUFFER_FLUSH_SIZE)
+    FlushCacheWriteBuffer();
+
   return result;
 }
 
+bool GameList::WriteDirectoryRecordToCache(const std::string& path, bool recursive, u64 signature, u64 content_digest)
+{
+  if (!s_cache_write_stream && !OpenCacheForWriting())
+    return false;
+
+  if (!s_cache_write_buffer)
+    s_cache_write_buffer = ByteStream::CreateGrowableMemoryStream();
+
+  bool result = true;
+  result &= s_cache_write_buffer->WriteU8(DIRECTORY_CACHE_RECORD_TYPE);
+  result &= s_cache_write_buffer->WriteSizePrefixedString(path);
+  result &= s_cache_write_buffer->WriteU8(BoolToUInt8(recursive));
+  result &= s_cache_write_buffer->WriteU64(signature);
+  result &= s_cache_write_buffer->WriteU64(content_digest);
+  return result;
+}
+
+void GameList::FlushCacheWriteBuffer()
+{
+  if (!s_cache_write_buffer || s_cache_write_buffer->GetPosition() == 0)
+    return;
+
+  if (!s_cache_write_stream->Write2(s_cache_write_buffer->GetMemoryPointer(),
+                                    static_cast<u32>(s_cache_write_buffer->GetPosition())))
+  {
+    Log_WarningPrintf("Failed to flush game list cache write buffer");
+  }
+
+  s_cache_write_buffer->SeekAbsolute(0);
+}
+
 static std::string GameList::GetCacheFilename()
 {
   return Path::Combine(EmuFolders::Cache, "gamelist.cache");
@@ -436,6 +538,8 @@ void GameList::CloseCacheFileStream()
   if (!s_cache_write_stream)
     return;
 
+  FlushCacheWriteBuffer();
+  s_cache_write_buffer.reset();
   s_cache_write_stream->Commit();
   s_cache_write_stream.reset();
 }
@@ -467,23 +571,46 @@ void GameList::ScanDirectory(const char* path, bool recursive, bool only_cache,
 
   progress->SetFormattedStatusText("Scanning directory '%s'%s...", path, recursive ? " (recursively)" : "");
 
+  // Creating/deleting/renaming anything in a directory bumps that directory's mtime, so if the directory (and for
+  // recursive scans, subdirectory) mtimes match the digest record from the last scan, the whole directory can be
+  // served from the cache without enumerating - and per-file stat'ing - its files. A file rewritten in place
+  // doesn't bump any directory mtime, so such a change is only picked up when the cache is invalidated, which is
+  // the trade-off that makes warm refreshes on network mounts cheap.
+  const std::optional<u64> directory_signature = GetDirectorySignature(path, recursive);
+  const auto digest_iter = s_directory_digest_map.find(path);
+  const bool have_digest = (digest_iter != s_directory_digest_map.end() && digest_iter->second.recursive == recursive);
+  if (directory_signature.has_value() && have_digest && digest_iter->second.signature == directory_signature.value())
+  {
+    AddDirectoryFromCache(path, recursive, excluded_paths, played_time_map);
+    return;
+  }
+
   FileSystem::FindResultsArray files;
   FileSystem::FindFiles(path, "*",
                         recursive ? (FILESYSTEM_FIND_FILES | FILESYSTEM_FIND_HIDDEN_FILES | FILESYSTEM_FIND_RECURSIVE) :
                                     (FILESYSTEM_FIND_FILES | FILESYSTEM_FIND_HIDDEN_FILES),
                         &files);
+
+  const u64 content_digest = GetDirectoryContentDigest(files);
   if (files.empty())
+  {
+    if (directory_signature.has_value() && !only_cache)
+    {
+      std::unique_lock lock(s_mutex);
+      WriteDirectoryRecordToCache(path, recursive, directory_signature.value(), content_digest);
+    }
     return;
+  }
 
   progress->PushState();
   progress->SetProgressRange(static_cast<u32>(files.size()));
   progress->SetProgressValue(0);
 
-  u32 files_scanned = 0;
+  // First pass: anything satisfied by the cache is handled inline, since it's only a map lookup. Files needing a
+  // full scan (opening the image, reading the executable, hashing) are queued up for the worker threads.
+  FileSystem::FindResultsArray files_to_scan;
   for (FILESYSTEM_FIND_DATA& ffd : files)
   {
-    files_scanned++;
-
     if (progress->IsCancelled() || !GameList::IsScannableFilename(ffd.FileName) ||
         IsPathExcluded(excluded_paths, ffd.FileName))
     {
@@ -497,15 +624,159 @@ void GameList::ScanDirectory(const char* path, bool recursive, bool only_cache,
       continue;
     }
 
-    progress->SetFormattedStatusText("Scanning '%s'...", FileSystem::GetDisplayNameFromPath(ffd.FileName).c_str());
-    ScanFile(std::move(ffd.FileName), ffd.ModificationTime, lock, played_time_map);
-    progress->SetProgressValue(files_scanned);
+    files_to_scan.push_back(std::move(ffd));
   }
 
-  progress->SetProgressValue(files_scanned);
+  const u32 cached_file_count = static_cast<u32>(files.size() - files_to_scan.size());
+  const u32 scan_file_count = static_cast<u32>(files_to_scan.size());
+  progress->SetProgressValue(cached_file_count);
+
+  if (scan_file_count > 0 && !progress->IsCancelled())
+  {
+    // Second pass: scan across a pool of worker threads, with the work handed out through a shared index so a
+    // slow file (e.g. a CHD on a network share) doesn't stall the others. Scans are the slow part, so there's no
+    // need for anything fancier than an atomic counter. The calling thread participates as well, and is the only
+    // one which touches the progress callback; cancellation is forwarded to the workers through a flag.
+    std::atomic<u32> next_file_index{0};
+    std::atomic<u32> files_completed{0};
+    std::atomic<bool> cancelled{false};
+
+    const auto scan_one_file = [&files_to_scan, &played_time_map](u32 index) {
+      FILESYSTEM_FIND_DATA& ffd = files_to_scan[index];
+      std::unique_lock lock(s_mutex);
+      ScanFile(std::move(ffd.FileName), ffd.ModificationTime, lock, played_time_map);
+    };
+
+    const u32 worker_count =
+      std::min(scan_file_count, std::max(std::thread::hardware_concurrency(), static_cast<u32>(1)));
+    std::vector<std::thread> workers;
+    workers.reserve(worker_count - 1);
+    for (u32 i = 1; i < worker_count; i++)
+    {
+      workers.emplace_back([&next_file_index, &files_completed, &cancelled, &scan_one_file, scan_file_count]() {
+        for (;;)
+        {
+          const u32 index = next_file_index.fetch_add(1);
+          if (index >= scan_file_count || cancelled.load())
+            break;
+
+          scan_one_file(index);
+          files_completed.fetch_add(1);
+        }
+      });
+    }
+
+    for (;;)
+    {
+      if (progress->IsCancelled())
+      {
+        cancelled.store(true);
+        break;
+      }
+
+      const u32 index = next_file_index.fetch_add(1);
+      if (index >= scan_file_count)
+        break;
+
+      progress->SetFormattedStatusText("Scanning '%s'...",
+                                       FileSystem::GetDisplayNameFromPath(files_to_scan[index].FileName).c_str());
+      scan_one_file(index);
+      files_completed.fetch_add(1);
+      progress->SetProgressValue(cached_file_count + files_completed.load());
+    }
+
+    // Keep the progress display and cancellation live while the stragglers finish up.
+    while (!cancelled.load() && files_completed.load() < std::min(next_file_index.load(), scan_file_count))
+    {
+      if (progress->IsCancelled())
+        cancelled.store(true);
+
+      progress->SetProgressValue(cached_file_count + files_completed.load());
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    for (std::thread& worker : workers)
+      worker.join();
+  }
+
+  // The digest record is only written once the directory has been fully scanned, otherwise a cancelled refresh
+  // would mark it as up to date with entries missing from the cache.
+  if (directory_signature.has_value() && !only_cache && !progress->IsCancelled())
+  {
+    std::unique_lock lock(s_mutex);
+    WriteDirectoryRecordToCache(path, recursive, directory_signature.value(), content_digest);
+  }
+
+  progress->SetProgressValue(static_cast<u32>(files.size()));
   progress->PopState();
 }
 
+std::optional<u64> GameList::GetDirectorySignature(const char* path, bool recursive)
+{
+  FILESYSTEM_STAT_DATA sd;
+  if (!FileSystem::StatFile(path, &sd) || !(sd.Attributes & FILESYSTEM_FILE_ATTRIBUTE_DIRECTORY))
+    return std::nullopt;
+
+  XXH64_state_t* state = XXH64_createState();
+  XXH64_reset(state, 0x474C5354);
+
+  u64 mtime = static_cast<u64>(sd.ModificationTime);
+  XXH64_update(state, &mtime, sizeof(mtime));
+
+  if (recursive)
+  {
+    // Stat'ing only the subdirectories covers the whole tree, and there are far fewer of those than files.
+    FileSystem::FindResultsArray dirs;
+    FileSystem::FindFiles(path, "*",
+                          FILESYSTEM_FIND_FOLDERS | FILESYSTEM_FIND_HIDDEN_FILES | FILESYSTEM_FIND_RECURSIVE, &dirs);
+    std::sort(dirs.begin(), dirs.end(), [](const FILESYSTEM_FIND_DATA& lhs, const FILESYSTEM_FIND_DATA& rhs) {
+      return (lhs.FileName < rhs.FileName);
+    });
+
+    for (const FILESYSTEM_FIND_DATA& dir : dirs)
+    {
+      XXH64_update(state, dir.FileName.data(), dir.FileName.length());
+      mtime = static_cast<u64>(dir.ModificationTime);
+      XXH64_update(state, &mtime, sizeof(mtime));
+    }
+  }
+
+  const u64 signature = XXH64_digest(state);
+  XXH64_freeState(state);
+  return signature;
+}
+
+u64 GameList::GetDirectoryContentDigest(const FileSystem::FindResultsArray& files)
+{
+  // Enumeration order is filesystem-dependent, so hash over a name-sorted view.
+  std::vector<const FILESYSTEM_FIND_DATA*> sorted_files;
+  sorted_files.reserve(files.size());
+  for (const FILESYSTEM_FIND_DATA& ffd : files)
+    sorted_files.push_back(&ffd);
+  std::sort(sorted_files.begin(), sorted_files.end(),
+            [](const FILESYSTEM_FIND_DATA* lhs, const FILESYSTEM_FIND_DATA* rhs) {
+              return (lhs->FileName < rhs->FileName);
+            });
+
+  XXH64_state_t* state = XXH64_createState();
+  XXH64_reset(state, 0x474C5354);
+
+  for (const FILESYSTEM_FIND_DATA* ffd : sorted_files)
+  {
+    XXH64_update(state, ffd->FileName.data(), ffd->FileName.length());
+
+    const u64 size = static_cast<u64>(ffd->Size);
+    XXH64_update(state, &size, sizeof(size));
+
+    const u64 mtime = static_cast<u64>(ffd->ModificationTime);
+    XXH64_update(state, &mtime, sizeof(mtime));
+  }
+
+  const u64 digest = XXH64_digest(state);
+  XXH64_freeState(state);
+  return digest;
+}
+
 bool GameList::AddFileFromCache(const std::string& path, std::time_t timestamp, const PlayedTimeMap& played_time_map)
 {
   Entry entry;
@@ -523,6 +794,47 @@ bool GameList::AddFileFromCache(const std::string& path, std::time_t timestamp,
   return true;
 }
 
+void GameList::AddDirectoryFromCache(const char* path, bool recursive, const std::vector<std::string>& excluded_paths,
+                                     const PlayedTimeMap& played_time_map)
+{
+  std::string_view dir_view(path);
+  while (!dir_view.empty() && (dir_view.back() == '/' || dir_view.back() == '\\'))
+    dir_view.remove_suffix(1);
+
+  std::unique_lock lock(s_mutex);
+  for (auto iter = s_cache_map.begin(); iter != s_cache_map.end();)
+  {
+    const std::string& entry_path = iter->first;
+    if (entry_path.length() <= (dir_view.length() + 1) || entry_path.compare(0, dir_view.length(), dir_view) != 0 ||
+        (entry_path[dir_view.length()] != '/' && entry_path[dir_view.length()] != '\\'))
+    {
+      ++iter;
+      continue;
+    }
+
+    const std::string_view remainder = std::string_view(entry_path).substr(dir_view.length() + 1);
+    if ((!recursive && remainder.find_first_of("/\\") != std::string_view::npos) ||
+        !IsScannableFilename(entry_path) || IsPathExcluded(excluded_paths, entry_path) ||
+        GetEntryForPath(entry_path.c_str()))
+    {
+      ++iter;
+      continue;
+    }
+
+    Entry entry = std::move(iter->second);
+    iter = s_cache_map.erase(iter);
+
+    auto played_iter = played_time_map.find(entry.serial);
+    if (played_iter != played_time_map.end())
+    {
+      entry.last_played_time = played_iter->second.last_played_time;
+      entry.total_played_time = played_iter->second.total_played_time;
+    }
+
+    s_entries.push_back(std::move(entry));
+  }
+}
+
 bool GameList::ScanFile(std::string path, std::time_t timestamp, std::unique_lock<std::recursive_mutex>& lock,
                         const PlayedTimeMap& played_time_map)
 {
@@ -538,12 +850,6 @@ bool GameList::ScanFile(std::string path, std::time_t timestamp, std::unique_loc
   entry.path = std::move(path);
   entry.last_modified_time = timestamp;
 
-  if (s_cache_write_stream || OpenCacheForWriting())
-  {
-    if (!WriteEntryToCache(&entry))
-      Log_WarningPrintf("Failed to write entry '%s' to cache", entry.path.c_str());
-  }
-
   auto iter = played_time_map.find(entry.serial);
   if (iter != played_time_map.end())
   {
@@ -551,7 +857,15 @@ bool GameList::ScanFile(std::string path, std::time_t timestamp, std::unique_loc
     entry.total_played_time = iter->second.total_played_time;
   }
 
+  // cache stream is shared between the scan threads, so the write has to happen under the lock
   lock.lock();
+
+  if (s_cache_write_stream || OpenCacheForWriting())
+  {
+    if (!WriteEntryToCache(&entry))
+      Log_WarningPrintf("Failed to write entry '%s' to cache", entry.path.c_str());
+  }
+
   s_entries.push_back(std::move(entry));
   return true;
 }
@@ -634,6 +948,9 @@ void GameList::Refresh(bool invalidate_cache, bool only_cache, ProgressCallback*
 
   if (!dirs.empty() || !recursive_dirs.empty())
   {
+    // the scan threads will all hit the game database, load it up front rather than racing to lazy-init it
+    GameDatabase::EnsureLoaded();
+
     progress->SetProgressRange(static_cast<u32>(dirs.size() + recursive_dirs.size()));
     progress->SetProgressValue(0);
 
@@ -660,6 +977,7 @@ void GameList::Refresh(bool invalidate_cache, bool only_cache, ProgressCallback*
   // don't need unused cache entries
   CloseCacheFileStream();
   s_cache_map.clear();
+  s_directory_digest_map.clear();
 }
 
 std::string GameList::GetCoverImagePathForEntry(const Entry* entry)
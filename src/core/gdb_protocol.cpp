@@ -3,6 +3,7 @@
 
 #include "gdb_protocol.h"
 #include "bus.h"
+#include "cpu_code_cache.h"
 #include "cpu_core_private.h"
 #include "cpu_core.h"
 #include "system.h"
@@ -16,6 +17,7 @@
 #include <optional>
 #include <sstream>
 #include <string>
+#include <vector>
 
 Log_SetChannel(GDBProtocol);
 
@@ -39,7 +41,8 @@ static u8 ComputeChecksum(const std::string_view& str)
 {
   u8 checksum = 0;
   for (char c : str) {
-    checksum = (checksum + c) % 256;
+    // Sum as unsigned bytes - binary payloads ('X' packets) contain characters above 0x7f.
+    checksum = static_cast<u8>(checksum + static_cast<u8>(c));
   }
   return checksum;
 }
@@ -181,6 +184,22 @@ static std::optional<std::string> Cmd$m(const std::string_view& data)
     if (ptr_data) {
       return { StringUtil::EncodeHex(ptr_data, phys_length) };
     }
+
+    // Not backed by a single region - serve what we can byte-wise (RAM mirrors, scratchpad,
+    // ranges crossing a region boundary). A partial reply is valid; only a completely unreadable
+    // range is an error.
+    std::vector<u8> buffer;
+    buffer.reserve(phys_length);
+    for (u32 i = 0; i < phys_length; i++) {
+      u8 value;
+      if (!CPU::SafeReadMemoryByte(phys_addr + i, &value)) {
+        break;
+      }
+      buffer.push_back(value);
+    }
+    if (!buffer.empty()) {
+      return { StringUtil::EncodeHex(buffer.data(), static_cast<u32>(buffer.size())) };
+    }
   }
   return { "E00" };
 }
@@ -206,6 +225,18 @@ static std::optional<std::string> Cmd$M(const std::string_view& data)
     u8* ptr_data = GetMemoryPointer(phys_addr, phys_length);
     if (ptr_data) {
       memcpy(ptr_data, payload->data(), phys_length);
+      // Keep recompiled code consistent with debugger-patched memory.
+      CPU::CodeCache::InvalidateCodePages(phys_addr, (phys_length + 3) / 4);
+      return { "OK" };
+    }
+
+    u32 i = 0;
+    for (; i < phys_length; i++) {
+      if (!CPU::SafeWriteMemoryByte(phys_addr + i, (*payload)[i])) {
+        break;
+      }
+    }
+    if (i == phys_length) {
       return { "OK" };
     }
   }
@@ -213,6 +244,67 @@ static std::optional<std::string> Cmd$M(const std::string_view& data)
   return { "E00" };
 }
 
+/// Set memory (binary). Clients probe with a zero-length write, then prefer this over 'M' for bulk
+/// downloads; the payload escapes '}', '$', '#' and '*' as 0x7d followed by the character XORed
+/// with 0x20.
+static std::optional<std::string> Cmd$X(const std::string_view& data)
+{
+  const size_t colon_pos = data.find(':');
+  if (colon_pos == std::string_view::npos) {
+    return { "E00" };
+  }
+
+  std::stringstream ss{std::string{data.substr(0, colon_pos)}};
+  std::string dataAddress, dataLength;
+
+  std::getline(ss, dataAddress, ',');
+  std::getline(ss, dataLength, '\0');
+
+  auto address = StringUtil::FromChars<VirtualMemoryAddress>(dataAddress, 16);
+  auto length = StringUtil::FromChars<u32>(dataLength, 16);
+  if (!address || !length) {
+    return { "E00" };
+  }
+
+  const std::string_view payload = data.substr(colon_pos + 1);
+  std::vector<u8> decoded;
+  decoded.reserve(payload.size());
+  for (size_t i = 0; i < payload.size(); i++) {
+    char c = payload[i];
+    if (c == 0x7d && (i + 1) < payload.size()) {
+      c = payload[++i] ^ 0x20;
+    }
+    decoded.push_back(static_cast<u8>(c));
+  }
+
+  if (decoded.size() != *length) {
+    return { "E00" };
+  }
+
+  if (*length == 0) {
+    // Binary write support probe.
+    return { "OK" };
+  }
+
+  PhysicalMemoryAddress phys_addr = *address & CPU::PHYSICAL_MEMORY_ADDRESS_MASK;
+  u32 phys_length = *length;
+
+  u8* ptr_data = GetMemoryPointer(phys_addr, phys_length);
+  if (ptr_data) {
+    memcpy(ptr_data, decoded.data(), phys_length);
+    CPU::CodeCache::InvalidateCodePages(phys_addr, (phys_length + 3) / 4);
+    return { "OK" };
+  }
+
+  u32 i = 0;
+  for (; i < phys_length; i++) {
+    if (!CPU::SafeWriteMemoryByte(phys_addr + i, decoded[i])) {
+      break;
+    }
+  }
+  return { (i == phys_length) ? std::string("OK") : std::string("E00") };
+}
+
 /// Remove hardware breakpoint.
 static std::optional<std::string> Cmd$z1(const std::string_view& data)
 {
@@ -246,7 +338,9 @@ static std::optional<std::string> Cmd$vMustReplyEmpty(const std::string_view& da
 
 static std::optional<std::string> Cmd$qSupported(const std::string_view& data)
 {
-  return { "" };
+  // Advertise a large packet size so clients batch memory transfers into few round trips rather
+  // than chunking them, and probe for binary 'X' writes.
+  return { "PacketSize=4000" };
 }
 
 /// List of all GDB remote protocol packets supported by us.
@@ -257,6 +351,7 @@ static const std::map<const char*, std::function<std::optional<std::string>(cons
   { "G", Cmd$G },
   { "m", Cmd$m },
   { "M", Cmd$M },
+  { "X", Cmd$X },
   { "z0,", Cmd$z1 },
   { "Z0,", Cmd$Z1 },
   { "z1,", Cmd$z1 },
@@ -22,12 +22,13 @@
 #include "common/heap_array.h"
 #include "common/log.h"
 #include "common/string_util.h"
+#include "common/threading.h"
+#include "common/thirdparty/thread_pool.h"
 
 #include "stb_image_resize.h"
 #include "stb_image_write.h"
 
 #include <cmath>
-#include <thread>
 
 Log_SetChannel(GPU);
 
@@ -66,7 +67,7 @@ bool GPU::Initialize()
     return false;
   }
 
-  g_gpu_device->SetGPUTimingEnabled(g_settings.display_show_gpu);
+  g_gpu_device->SetGPUTimingEnabled(g_settings.display_show_gpu || g_settings.gpu_dynamic_resolution_scale);
 
   return true;
 }
@@ -87,13 +88,16 @@ void GPU::UpdateSettings(const Settings& old_settings)
   // Crop mode calls this, so recalculate the display area
   UpdateCRTCDisplayParameters();
 
+  // Integer scaling/stretch settings feed the draw rect, so the cached pointer transform is stale.
+  m_pointer_transform_valid = false;
+
   if (g_settings.display_scaling != old_settings.display_scaling)
   {
     if (!CompileDisplayPipeline())
       Panic("Failed to compile display pipeline on settings change.");
   }
 
-  g_gpu_device->SetGPUTimingEnabled(g_settings.display_show_gpu);
+  g_gpu_device->SetGPUTimingEnabled(g_settings.display_show_gpu || g_settings.gpu_dynamic_resolution_scale);
 }
 
 void GPU::CPUClockChanged()
@@ -105,6 +109,10 @@ void GPU::UpdateResolutionScale()
 {
 }
 
+void GPU::UpdateDynamicResolutionScale()
+{
+}
+
 std::tuple<u32, u32> GPU::GetEffectiveDisplayResolution(bool scaled /* = true */)
 {
   return std::tie(m_crtc_state.display_vram_width, m_crtc_state.display_vram_height);
@@ -411,6 +419,13 @@ u32 GPU::ReadRegister(u32 offset)
       if (IsCommandCompletionPending())
         m_command_tick_event->InvokeEarly();
 
+      // Drain any write-combined GP0 words so the FIFO/idle bits are up to date.
+      if (m_gp0_write_buffered)
+      {
+        ExecuteCommands();
+        UpdateCommandTickEvent();
+      }
+
       return m_GPUSTAT.bits;
     }
 
@@ -425,10 +440,37 @@ void GPU::WriteRegister(u32 offset, u32 value)
   switch (offset)
   {
     case 0x00:
+    {
+      if (m_fifo.IsFull())
+        ExecuteCommands();
+
       m_fifo.Push(value);
+
+      // Write-combine parameter words. If the command at the FIFO head is still waiting on more words than have
+      // arrived, nothing can execute yet, so skip the dispatch and let the completing word (or a GPUSTAT read, or a
+      // DMA kick) drain the whole batch. The FIFO contents end up identical to dispatching per word; command cycles
+      // are unaffected since they are only charged when a command actually executes.
+      if (m_blitter_state == BlitterState::Idle)
+      {
+        if (m_fifo.GetSize() < m_command_total_words)
+        {
+          m_gp0_write_buffered = true;
+          return;
+        }
+      }
+      else if (m_blitter_state == BlitterState::WritingVRAM)
+      {
+        if (m_fifo.GetSize() < m_blit_remaining_words && !m_fifo.IsFull())
+        {
+          m_gp0_write_buffered = true;
+          return;
+        }
+      }
+
       ExecuteCommands();
       UpdateCommandTickEvent();
       return;
+    }
 
     case 0x04:
       WriteGP1(value);
@@ -453,6 +495,30 @@ void GPU::DMARead(u32* words, u32 word_count)
     words[i] = ReadGPUREAD();
 }
 
+void GPU::DMAWrite(u32 address, const u32* words, u32 word_count)
+{
+  // Widen the words into the 64-bit FIFO entries in place, rather than going through Push() and
+  // its wrap handling for every word. The address tags advance one word per entry, matching what
+  // the per-word path would have produced.
+  DebugAssert(m_fifo.GetSpace() >= word_count);
+
+  u32 remaining = word_count;
+  while (remaining > 0)
+  {
+    const u32 contiguous_words = std::min(remaining, m_fifo.GetContiguousSpace());
+    u64* out_ptr = m_fifo.GetWritePointer();
+    for (u32 i = 0; i < contiguous_words; i++)
+    {
+      out_ptr[i] = (ZeroExtend64(address) << 32) | ZeroExtend64(words[i]);
+      address += sizeof(u32);
+    }
+
+    m_fifo.AdvanceTail(contiguous_words);
+    words += contiguous_words;
+    remaining -= contiguous_words;
+  }
+}
+
 void GPU::EndDMAWrite()
 {
   m_fifo_pushed = true;
@@ -1013,17 +1079,25 @@ void GPU::UpdateCommandTickEvent()
 bool GPU::ConvertScreenCoordinatesToBeamTicksAndLines(s32 window_x, s32 window_y, float x_scale, u32* out_tick,
                                                       u32* out_line) const
 {
-  float left_padding, top_padding, scale;
-  CalculateDrawRect(g_gpu_device->GetWindowWidth(), g_gpu_device->GetWindowHeight(), &left_padding, &top_padding,
-                    &scale, nullptr);
+  const s32 window_width = g_gpu_device->GetWindowWidth();
+  const s32 window_height = g_gpu_device->GetWindowHeight();
+  if (!m_pointer_transform_valid || window_width != m_pointer_window_width ||
+      window_height != m_pointer_window_height)
+  {
+    CalculateDrawRect(window_width, window_height, &m_pointer_left_padding, &m_pointer_top_padding, &m_pointer_scale,
+                      nullptr);
+    m_pointer_window_width = window_width;
+    m_pointer_window_height = window_height;
+    m_pointer_transform_valid = true;
+  }
 
   // convert coordinates to active display region, then to full display region
-  const float scaled_display_x = static_cast<float>(window_x) - left_padding;
-  const float scaled_display_y = static_cast<float>(window_y) - top_padding;
+  const float scaled_display_x = static_cast<float>(window_x) - m_pointer_left_padding;
+  const float scaled_display_y = static_cast<float>(window_y) - m_pointer_top_padding;
 
   // scale back to internal resolution
-  float display_x = scaled_display_x / scale / x_scale;
-  float display_y = scaled_display_y / scale;
+  float display_x = scaled_display_x / m_pointer_scale / x_scale;
+  float display_y = scaled_display_y / m_pointer_scale;
 
   if (x_scale != 1.0f)
   {
@@ -1647,6 +1721,14 @@ void GPU::SetDisplayTextureRect(s32 view_x, s32 view_y, s32 view_width, s32 view
 void GPU::SetDisplayParameters(s32 display_width, s32 display_height, s32 active_left, s32 active_top, s32 active_width,
                                s32 active_height, float display_aspect_ratio)
 {
+  // This gets called every display update, so only drop the cached pointer transform when
+  // something actually changed.
+  m_pointer_transform_valid &=
+    (m_display_width == display_width && m_display_height == display_height &&
+     m_display_active_left == active_left && m_display_active_top == active_top &&
+     m_display_active_width == active_width && m_display_active_height == active_height &&
+     m_display_aspect_ratio == display_aspect_ratio);
+
   m_display_width = display_width;
   m_display_height = display_height;
   m_display_active_left = active_left;
@@ -1763,8 +1845,12 @@ bool GPU::RenderDisplay(GPUFramebuffer* target, const Common::Rectangle<s32>& dr
 
   if (really_postfx)
   {
-    return PostProcessing::Apply(target, draw_rect.left, draw_rect.top, draw_rect.GetWidth(), draw_rect.GetHeight(),
-                                 m_display_texture_view_width, m_display_texture_view_height);
+    g_gpu_device->BeginTimerScope("PostProcessing");
+    const bool result =
+      PostProcessing::Apply(target, draw_rect.left, draw_rect.top, draw_rect.GetWidth(), draw_rect.GetHeight(),
+                            m_display_texture_view_width, m_display_texture_view_height);
+    g_gpu_device->EndTimerScope();
+    return result;
   }
   else
   {
@@ -1965,6 +2051,25 @@ static bool CompressAndWriteTextureToFile(u32 width, u32 height, std::string fil
   return true;
 }
 
+// Queues the encode to the shared thread pool instead of spawning a detached thread per screenshot.
+// Periodic/automated captures get serialized through the pool's FIFO queue rather than piling up
+// threads, and the pool drains outstanding work before it is torn down, so a screenshot taken just
+// before exit still hits the disk.
+static void QueueCompressAndWriteTextureToFile(u32 width, u32 height, std::string filename,
+                                               FileSystem::ManagedCFilePtr fp, bool clear_alpha, bool flip_y,
+                                               u32 resize_width, u32 resize_height, std::vector<u32> texture_data,
+                                               u32 texture_data_stride, GPUTexture::Format texture_format)
+{
+  // std::function needs a copyable callable, so the file handle rides along as a raw pointer.
+  Threading::GetSharedThreadPool().Schedule(
+    [width, height, filename = std::move(filename), fp = fp.release(), clear_alpha, flip_y, resize_width,
+     resize_height, texture_data = std::move(texture_data), texture_data_stride, texture_format]() mutable {
+      CompressAndWriteTextureToFile(width, height, std::move(filename), FileSystem::ManagedCFilePtr(fp), clear_alpha,
+                                    flip_y, resize_width, resize_height, std::move(texture_data), texture_data_stride,
+                                    texture_format);
+    });
+}
+
 bool GPU::WriteDisplayTextureToFile(std::string filename, bool full_resolution /* = true */,
                                     bool apply_aspect_ratio /* = true */, bool compress_on_thread /* = false */)
 {
@@ -2037,10 +2142,9 @@ bool GPU::WriteDisplayTextureToFile(std::string filename, bool full_resolution /
                                          texture_data_stride, m_display_texture->GetFormat());
   }
 
-  std::thread compress_thread(CompressAndWriteTextureToFile, read_width, read_height, std::move(filename),
-                              std::move(fp), clear_alpha, flip_y, resize_width, resize_height, std::move(texture_data),
-                              texture_data_stride, m_display_texture->GetFormat());
-  compress_thread.detach();
+  QueueCompressAndWriteTextureToFile(read_width, read_height, std::move(filename), std::move(fp), clear_alpha, flip_y,
+                                     resize_width, resize_height, std::move(texture_data), texture_data_stride,
+                                     m_display_texture->GetFormat());
   return true;
 }
 
@@ -2051,7 +2155,7 @@ bool GPU::RenderScreenshotToBuffer(u32 width, u32 height, const Common::Rectangl
     g_gpu_device->HasSurface() ? g_gpu_device->GetWindowFormat() : GPUTexture::Format::RGBA8;
 
   std::unique_ptr<GPUTexture> render_texture =
-    g_gpu_device->CreateTexture(width, height, 1, 1, 1, GPUTexture::Type::RenderTarget, hdformat);
+    g_gpu_device->FetchTexture(width, height, 1, 1, 1, GPUTexture::Type::RenderTarget, hdformat);
   if (!render_texture)
     return false;
 
@@ -2068,7 +2172,14 @@ bool GPU::RenderScreenshotToBuffer(u32 width, u32 height, const Common::Rectangl
 
   const u32 stride = GPUTexture::GetPixelSize(hdformat) * width;
   out_pixels->resize(width * height);
-  if (!g_gpu_device->DownloadTexture(render_texture.get(), 0, 0, width, height, out_pixels->data(), stride))
+  const bool result =
+    g_gpu_device->DownloadTexture(render_texture.get(), 0, 0, width, height, out_pixels->data(), stride);
+
+  // Recycle the target, save state screenshots take this path repeatedly at the same size.
+  render_fb.reset();
+  g_gpu_device->RecycleTexture(std::move(render_texture));
+
+  if (!result)
   {
     RestoreDeviceContext();
     return false;
@@ -2157,10 +2268,9 @@ bool GPU::RenderScreenshotToFile(std::string filename, bool internal_resolution
                                          pixels_stride, pixels_format);
   }
 
-  std::thread compress_thread(CompressAndWriteTextureToFile, width, height, std::move(filename), std::move(fp), true,
-                              g_gpu_device->UsesLowerLeftOrigin(), width, height, std::move(pixels), pixels_stride,
-                              pixels_format);
-  compress_thread.detach();
+  QueueCompressAndWriteTextureToFile(width, height, std::move(filename), std::move(fp), true,
+                                     g_gpu_device->UsesLowerLeftOrigin(), width, height, std::move(pixels),
+                                     pixels_stride, pixels_format);
   return true;
 }
 
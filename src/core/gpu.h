@@ -115,6 +115,10 @@ public:
   {
     m_fifo.Push((ZeroExtend64(address) << 32) | ZeroExtend64(value));
   }
+
+  /// Bulk variant for block transfers which don't wrap around RAM.
+  void DMAWrite(u32 address, const u32* words, u32 word_count);
+
   void EndDMAWrite();
 
   /// Returns true if no data is being sent from VRAM to the DAC or that no portion of VRAM would be visible on screen.
@@ -157,6 +161,10 @@ public:
   /// Updates the resolution scale when it's set to automatic.
   virtual void UpdateResolutionScale();
 
+  /// Adjusts the dynamic resolution scale based on GPU frame-time telemetry. Called once per second
+  /// from the performance counter update when dynamic resolution scaling is enabled.
+  virtual void UpdateDynamicResolutionScale();
+
   /// Returns the effective display resolution of the GPU.
   virtual std::tuple<u32, u32> GetEffectiveDisplayResolution(bool scaled = true);
 
@@ -551,6 +559,10 @@ protected:
   bool m_syncing = false;
   bool m_fifo_pushed = false;
 
+  /// True if GP0 words have been write-combined into the FIFO without running ExecuteCommands(),
+  /// i.e. the FIFO/idle bits in GPUSTAT may be stale until the next execution.
+  bool m_gp0_write_buffered = false;
+
   struct VRAMTransfer
   {
     u16 x;
@@ -570,6 +582,11 @@ protected:
   ALWAYS_INLINE u32 FifoPeek() { return Truncate32(m_fifo.Peek()); }
   ALWAYS_INLINE u32 FifoPeek(u32 i) { return Truncate32(m_fifo.Peek(i)); }
 
+  /// Pops count words from the FIFO in bulk. The FIFO entries are 64-bit to carry the memory address
+  /// for PGXP, so this is a narrowing copy rather than a memcpy, but it still avoids the per-word
+  /// head/size updates in Pop(), which show up in large CPU->VRAM transfers (e.g. FMV streaming).
+  void FifoPopRange(u32* out_data, u32 count);
+
   TickCount m_max_run_ahead = 128;
   u32 m_fifo_size = 128;
 
@@ -593,6 +610,16 @@ protected:
   s32 m_display_active_height = 0;
   float m_display_aspect_ratio = 1.0f;
 
+  // Cached window-to-display mapping for pointer devices (lightguns/mouse). Pointer polls can
+  // arrive at high frequency, so the draw-rect math is only redone when the window size or the
+  // display parameters change.
+  mutable float m_pointer_left_padding = 0.0f;
+  mutable float m_pointer_top_padding = 0.0f;
+  mutable float m_pointer_scale = 1.0f;
+  mutable s32 m_pointer_window_width = 0;
+  mutable s32 m_pointer_window_height = 0;
+  mutable bool m_pointer_transform_valid = false;
+
   std::unique_ptr<GPUPipeline> m_display_pipeline;
   GPUTexture* m_display_texture = nullptr;
   s32 m_display_texture_view_x = 0;
@@ -3,12 +3,31 @@
 
 #include "gpu_backend.h"
 #include "common/align.h"
+#include "common/file_system.h"
 #include "common/log.h"
 #include "common/timer.h"
 #include "settings.h"
+#include "system.h"
 #include "util/state_wrapper.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
 Log_SetChannel(GPUBackend);
 
+namespace {
+struct CommandDumpHeader
+{
+  u32 magic;
+  u32 version;
+  u32 vram_width;
+  u32 vram_height;
+};
+} // namespace
+
+static constexpr u32 COMMAND_DUMP_MAGIC = 0x50444247; // "GBDP"
+static constexpr u32 COMMAND_DUMP_VERSION = 1;
+static constexpr u32 COMMAND_DUMP_VRAM_SIZE = VRAM_WIDTH * VRAM_HEIGHT * sizeof(u16);
+
 std::unique_ptr<GPUBackend> g_gpu_backend;
 
 GPUBackend::GPUBackend() = default;
@@ -44,9 +63,108 @@ void GPUBackend::UpdateSettings()
 
 void GPUBackend::Shutdown()
 {
+  StopCommandDump();
   StopGPUThread();
 }
 
+bool GPUBackend::StartCommandDump(const char* path)
+{
+  StopCommandDump();
+
+  // Drain the queue first, so the VRAM snapshot matches the point in the stream where recording begins.
+  Sync(true);
+
+  std::FILE* fp = FileSystem::OpenCFile(path, "wb");
+  if (!fp)
+  {
+    Log_ErrorPrintf("Failed to open command dump file '%s'", path);
+    return false;
+  }
+
+  const CommandDumpHeader header = {COMMAND_DUMP_MAGIC, COMMAND_DUMP_VERSION, VRAM_WIDTH, VRAM_HEIGHT};
+  if (std::fwrite(&header, sizeof(header), 1, fp) != 1 ||
+      std::fwrite(m_vram_ptr, COMMAND_DUMP_VRAM_SIZE, 1, fp) != 1)
+  {
+    Log_ErrorPrintf("Failed to write command dump header to '%s'", path);
+    std::fclose(fp);
+    return false;
+  }
+
+  Log_InfoPrintf("Dumping GPU commands to '%s'", path);
+  m_command_dump_file = fp;
+  return true;
+}
+
+void GPUBackend::StopCommandDump()
+{
+  if (!m_command_dump_file)
+    return;
+
+  std::fclose(m_command_dump_file);
+  m_command_dump_file = nullptr;
+  Log_InfoPrintf("Finished dumping GPU commands.");
+}
+
+bool GPUBackend::RunCommandDump(const char* path, u32 num_iterations)
+{
+  std::optional<std::vector<u8>> data = FileSystem::ReadBinaryFile(path);
+  if (!data.has_value() || data->size() < (sizeof(CommandDumpHeader) + COMMAND_DUMP_VRAM_SIZE))
+  {
+    Log_ErrorPrintf("Failed to read command dump '%s'", path);
+    return false;
+  }
+
+  CommandDumpHeader header;
+  std::memcpy(&header, data->data(), sizeof(header));
+  if (header.magic != COMMAND_DUMP_MAGIC || header.version != COMMAND_DUMP_VERSION ||
+      header.vram_width != VRAM_WIDTH || header.vram_height != VRAM_HEIGHT)
+  {
+    Log_ErrorPrintf("Invalid command dump '%s'", path);
+    return false;
+  }
+
+  const u8* vram_snapshot = data->data() + sizeof(CommandDumpHeader);
+  const u8* commands = vram_snapshot + COMMAND_DUMP_VRAM_SIZE;
+  const size_t commands_size = data->size() - sizeof(CommandDumpHeader) - COMMAND_DUMP_VRAM_SIZE;
+
+  Log_InfoPrintf("Replaying %zu bytes of GPU commands from '%s' for %u iterations...", commands_size, path,
+                 num_iterations);
+
+  double total_time = 0.0;
+  double min_time = std::numeric_limits<double>::max();
+  for (u32 iteration = 0; iteration < num_iterations; iteration++)
+  {
+    std::memcpy(m_vram_ptr, vram_snapshot, COMMAND_DUMP_VRAM_SIZE);
+
+    const Common::Timer::Value start_time = Common::Timer::GetCurrentValue();
+
+    size_t pos = 0;
+    while ((pos + sizeof(GPUBackendCommand)) <= commands_size)
+    {
+      const GPUBackendCommand* cmd = reinterpret_cast<const GPUBackendCommand*>(&commands[pos]);
+      if (cmd->size < sizeof(GPUBackendCommand) || (pos + cmd->size) > commands_size)
+      {
+        Log_ErrorPrintf("Malformed command at offset %zu in '%s'", pos, path);
+        return false;
+      }
+
+      HandleCommand(cmd);
+      pos += cmd->size;
+    }
+
+    FlushRender();
+
+    const double iteration_time =
+      Common::Timer::ConvertValueToMilliseconds(Common::Timer::GetCurrentValue() - start_time);
+    total_time += iteration_time;
+    min_time = std::min(min_time, iteration_time);
+  }
+
+  Log_InfoPrintf("Replay finished: %.3fms avg, %.3fms min over %u iterations.",
+                 total_time / static_cast<double>(num_iterations), min_time, num_iterations);
+  return true;
+}
+
 GPUBackendFillVRAMCommand* GPUBackend::NewFillVRAMCommand()
 {
   return static_cast<GPUBackendFillVRAMCommand*>(
@@ -104,15 +222,17 @@ void* GPUBackend::AllocateCommand(GPUBackendCommandType command, u32 size)
 
   for (;;)
   {
-    u32 read_ptr = m_command_fifo_read_ptr.load();
-    u32 write_ptr = m_command_fifo_write_ptr.load();
+    // Only the CPU thread moves the write pointer, so its own load can be relaxed; the read
+    // pointer is published by the GPU thread after it's done with the space.
+    u32 read_ptr = m_command_fifo_read_ptr.load(std::memory_order_acquire);
+    u32 write_ptr = m_command_fifo_write_ptr.load(std::memory_order_relaxed);
     if (read_ptr > write_ptr)
     {
       u32 available_size = read_ptr - write_ptr;
       while (available_size < (size + sizeof(GPUBackendCommandType)))
       {
         WakeGPUThread();
-        read_ptr = m_command_fifo_read_ptr.load();
+        read_ptr = m_command_fifo_read_ptr.load(std::memory_order_acquire);
         available_size = (read_ptr > write_ptr) ? (read_ptr - write_ptr) : (COMMAND_QUEUE_SIZE - write_ptr);
       }
     }
@@ -126,7 +246,7 @@ void* GPUBackend::AllocateCommand(GPUBackendCommandType command, u32 size)
         dummy_cmd->type = GPUBackendCommandType::Wraparound;
         dummy_cmd->size = available_size;
         dummy_cmd->params.bits = 0;
-        m_command_fifo_write_ptr.store(0);
+        m_command_fifo_write_ptr.store(0, std::memory_order_release);
         continue;
       }
     }
@@ -140,13 +260,16 @@ void* GPUBackend::AllocateCommand(GPUBackendCommandType command, u32 size)
 
 u32 GPUBackend::GetPendingCommandSize() const
 {
-  const u32 read_ptr = m_command_fifo_read_ptr.load();
-  const u32 write_ptr = m_command_fifo_write_ptr.load();
+  const u32 read_ptr = m_command_fifo_read_ptr.load(std::memory_order_acquire);
+  const u32 write_ptr = m_command_fifo_write_ptr.load(std::memory_order_acquire);
   return (write_ptr >= read_ptr) ? (write_ptr - read_ptr) : (COMMAND_QUEUE_SIZE - read_ptr + write_ptr);
 }
 
 void GPUBackend::PushCommand(GPUBackendCommand* cmd)
 {
+  if (m_command_dump_file && cmd->type != GPUBackendCommandType::Sync)
+    std::fwrite(cmd, cmd->size, 1, m_command_dump_file);
+
   if (!m_use_gpu_thread)
   {
     // single-thread mode
@@ -155,20 +278,41 @@ void GPUBackend::PushCommand(GPUBackendCommand* cmd)
   }
   else
   {
-    const u32 new_write_ptr = m_command_fifo_write_ptr.fetch_add(cmd->size) + cmd->size;
+    // Only the CPU thread writes the write pointer, so this doesn't need an atomic RMW; the
+    // release store is what publishes the command payload to the GPU thread.
+    const u32 new_write_ptr = m_command_fifo_write_ptr.load(std::memory_order_relaxed) + cmd->size;
     DebugAssert(new_write_ptr <= COMMAND_QUEUE_SIZE);
-    UNREFERENCED_VARIABLE(new_write_ptr);
-    if (GetPendingCommandSize() >= THRESHOLD_TO_WAKE_GPU)
+    m_command_fifo_write_ptr.store(new_write_ptr, std::memory_order_release);
+
+    // Only the CPU thread pushes commands, so the peak update doesn't need to be atomic.
+    const u32 pending_size = GetPendingCommandSize();
+    if (pending_size > m_peak_command_size.load(std::memory_order_relaxed))
+      m_peak_command_size.store(pending_size, std::memory_order_relaxed);
+
+    if (pending_size >= THRESHOLD_TO_WAKE_GPU)
       WakeGPUThread();
   }
 }
 
 void GPUBackend::WakeGPUThread()
 {
+  // When the thread is busy we can skip the mutex (and the kernel wakeup) entirely; it drains the
+  // FIFO before going back to sleep. Has to be re-checked under the lock before notifying, since
+  // the thread flags itself as sleeping while holding it.
+  //
+  // The fence pairs with the one before the sleep wait in RunGPULoop: it orders our write pointer
+  // store against the sleeping-flag load, so either the GPU thread's wakeup predicate sees the new
+  // command, or we see the sleeping flag and notify. The write pointer store itself is only
+  // release, which wouldn't give that guarantee on its own.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (!m_gpu_thread_sleeping.load())
+    return;
+
   std::unique_lock<std::mutex> lock(m_sync_mutex);
   if (!m_gpu_thread_sleeping.load())
     return;
 
+  m_num_wakeups.fetch_add(1, std::memory_order_relaxed);
   m_wake_gpu_thread_cv.notify_one();
 }
 
@@ -208,21 +352,34 @@ void GPUBackend::Sync(bool allow_sleep)
 
 void GPUBackend::RunGPULoop()
 {
+  System::ApplyThreadQoSToCallingThread();
+
   static constexpr double SPIN_TIME_NS = 1 * 1000000;
+  static constexpr u32 SPINS_BEFORE_YIELD = 128;
   Common::Timer::Value last_command_time = 0;
+  u32 idle_spins = 0;
 
   for (;;)
   {
-    u32 write_ptr = m_command_fifo_write_ptr.load();
-    u32 read_ptr = m_command_fifo_read_ptr.load();
+    u32 write_ptr = m_command_fifo_write_ptr.load(std::memory_order_acquire);
+    u32 read_ptr = m_command_fifo_read_ptr.load(std::memory_order_relaxed);
     if (read_ptr == write_ptr)
     {
       const Common::Timer::Value current_time = Common::Timer::GetCurrentValue();
       if (Common::Timer::ConvertValueToNanoseconds(current_time - last_command_time) < SPIN_TIME_NS)
+      {
+        // Back off to yielding once it's clear a command isn't coming immediately, so the spin
+        // doesn't starve the producer on low-core-count machines.
+        if (++idle_spins >= SPINS_BEFORE_YIELD)
+          Threading::Timeslice();
+
         continue;
+      }
 
       std::unique_lock<std::mutex> lock(m_sync_mutex);
       m_gpu_thread_sleeping.store(true);
+      // Pairs with the fence in WakeGPUThread, see there.
+      std::atomic_thread_fence(std::memory_order_seq_cst);
       m_wake_gpu_thread_cv.wait(lock, [this]() { return m_gpu_loop_done.load() || GetPendingCommandSize() > 0; });
       m_gpu_thread_sleeping.store(false);
 
@@ -232,6 +389,8 @@ void GPUBackend::RunGPULoop()
         continue;
     }
 
+    idle_spins = 0;
+
     if (write_ptr < read_ptr)
       write_ptr = COMMAND_QUEUE_SIZE;
 
@@ -246,7 +405,7 @@ void GPUBackend::RunGPULoop()
         case GPUBackendCommandType::Wraparound:
         {
           DebugAssert(read_ptr == COMMAND_QUEUE_SIZE);
-          write_ptr = m_command_fifo_write_ptr.load();
+          write_ptr = m_command_fifo_write_ptr.load(std::memory_order_acquire);
           read_ptr = 0;
         }
         break;
@@ -266,7 +425,7 @@ void GPUBackend::RunGPULoop()
     }
 
     last_command_time = allow_sleep ? 0 : Common::Timer::GetCurrentValue();
-    m_command_fifo_read_ptr.store(read_ptr);
+    m_command_fifo_read_ptr.store(read_ptr, std::memory_order_release);
   }
 }
 
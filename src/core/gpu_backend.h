@@ -7,6 +7,7 @@
 #include "gpu_types.h"
 #include <atomic>
 #include <condition_variable>
+#include <cstdio>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -41,9 +42,23 @@ public:
   void PushCommand(GPUBackendCommand* cmd);
   void Sync(bool allow_sleep);
 
+  /// Starts capturing the command stream to a file, beginning with a snapshot of current VRAM. Everything
+  /// which passes through PushCommand() except syncs is appended verbatim until StopCommandDump().
+  bool StartCommandDump(const char* path);
+  void StopCommandDump();
+
+  /// Executes a capture produced by StartCommandDump() against this backend, restoring the VRAM snapshot
+  /// before each iteration. Used by the regression test runner to benchmark rasterizer changes without a
+  /// full game repro.
+  bool RunCommandDump(const char* path, u32 num_iterations);
+
   /// Processes all pending GPU commands.
   void RunGPULoop();
 
+  /// GPU thread statistics for the debug overlay, cleared by the reader each frame.
+  ALWAYS_INLINE u32 GetAndClearWakeupCount() { return m_num_wakeups.exchange(0, std::memory_order_relaxed); }
+  ALWAYS_INLINE u32 GetAndClearPeakCommandSize() { return m_peak_command_size.exchange(0, std::memory_order_relaxed); }
+
 protected:
   void* AllocateCommand(GPUBackendCommandType command, u32 size);
   u32 GetPendingCommandSize() const;
@@ -88,6 +103,12 @@ protected:
   FixedHeapArray<u8, COMMAND_QUEUE_SIZE> m_command_fifo_data;
   alignas(64) std::atomic<u32> m_command_fifo_read_ptr{0};
   alignas(64) std::atomic<u32> m_command_fifo_write_ptr{0};
+
+  std::atomic<u32> m_num_wakeups{0};
+  std::atomic<u32> m_peak_command_size{0};
+
+  // Only touched on the CPU thread, which is the sole producer of commands.
+  std::FILE* m_command_dump_file = nullptr;
 };
 
 #ifdef _MSC_VER
@@ -25,9 +25,26 @@ static constexpr u32 ReplaceZero(u32 value, u32 value_for_zero)
   return value == 0 ? value_for_zero : value;
 }
 
+void GPU::FifoPopRange(u32* out_data, u32 count)
+{
+  u32 remaining = count;
+  while (remaining > 0)
+  {
+    const u32 contiguous_words = std::min(remaining, m_fifo.GetContiguousSize());
+    const u64* in_ptr = m_fifo.GetReadPointer();
+    for (u32 i = 0; i < contiguous_words; i++)
+      out_data[i] = Truncate32(in_ptr[i]);
+
+    m_fifo.Remove(contiguous_words);
+    out_data += contiguous_words;
+    remaining -= contiguous_words;
+  }
+}
+
 void GPU::ExecuteCommands()
 {
   m_syncing = true;
+  m_gp0_write_buffered = false;
 
   for (;;)
   {
@@ -48,9 +65,9 @@ void GPU::ExecuteCommands()
         {
           DebugAssert(m_blit_remaining_words > 0);
           const u32 words_to_copy = std::min(m_blit_remaining_words, m_fifo.GetSize());
-          m_blit_buffer.reserve(m_blit_buffer.size() + words_to_copy);
-          for (u32 i = 0; i < words_to_copy; i++)
-            m_blit_buffer.push_back(FifoPop());
+          const size_t old_size = m_blit_buffer.size();
+          m_blit_buffer.resize(old_size + words_to_copy);
+          FifoPopRange(&m_blit_buffer[old_size], words_to_copy);
           m_blit_remaining_words -= words_to_copy;
 
           Log_DebugPrintf("VRAM write burst of %u words, %u words remaining", words_to_copy, m_blit_remaining_words);
@@ -83,9 +100,9 @@ void GPU::ExecuteCommands()
           const u32 words_to_copy = std::min(terminator_index, m_fifo.GetSize());
           if (words_to_copy > 0)
           {
-            m_blit_buffer.reserve(m_blit_buffer.size() + words_to_copy);
-            for (u32 i = 0; i < words_to_copy; i++)
-              m_blit_buffer.push_back(FifoPop());
+            const size_t old_size = m_blit_buffer.size();
+            m_blit_buffer.resize(old_size + words_to_copy);
+            FifoPopRange(&m_blit_buffer[old_size], words_to_copy);
           }
 
           Log_DebugPrintf("Added %u words to polyline", words_to_copy);
@@ -435,11 +452,8 @@ bool GPU::HandleRenderPolyLineCommand()
   m_fifo.RemoveOne();
 
   const u32 words_to_pop = min_words - 1;
-  // m_blit_buffer.resize(words_to_pop);
-  // FifoPopRange(m_blit_buffer.data(), words_to_pop);
-  m_blit_buffer.reserve(words_to_pop);
-  for (u32 i = 0; i < words_to_pop; i++)
-    m_blit_buffer.push_back(Truncate32(FifoPop()));
+  m_blit_buffer.resize(words_to_pop);
+  FifoPopRange(m_blit_buffer.data(), words_to_pop);
 
   // polyline goes via a different path through the blit buffer
   m_blitter_state = BlitterState::DrawingPolyLine;
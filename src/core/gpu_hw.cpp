@@ -18,11 +18,13 @@
 #include "common/log.h"
 #include "common/scoped_guard.h"
 #include "common/string_util.h"
+#include "common/thirdparty/thread_pool.h"
 
 #include "IconsFontAwesome5.h"
 #include "imgui.h"
 
 #include <cmath>
+#include <future>
 #include <sstream>
 #include <tuple>
 
@@ -171,6 +173,7 @@ bool GPU_HW::Initialize()
   m_scaled_dithering = g_settings.gpu_scaled_dithering;
   m_texture_filtering = g_settings.gpu_texture_filter;
   m_using_uv_limits = ShouldUseUVLimits();
+  m_use_uber_shader = g_settings.gpu_uber_shader;
   m_chroma_smoothing = g_settings.gpu_24bit_chroma_smoothing;
   m_downsample_mode = GetDownsampleMode(m_resolution_scale);
   m_wireframe_mode = g_settings.gpu_wireframe_mode;
@@ -205,6 +208,9 @@ void GPU_HW::Reset(bool clear_vram)
   m_batch_current_vertex_ptr = m_batch_start_vertex_ptr;
 
   m_vram_shadow.fill(0);
+  m_predicted_readback_rect.SetInvalid();
+  m_predicted_readback_hit = false;
+  ClearVRAMCopyCache();
   if (m_sw_renderer)
     m_sw_renderer->Reset(clear_vram);
 
@@ -222,6 +228,9 @@ bool GPU_HW::DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_di
   if (!GPU::DoState(sw, host_texture, update_display))
     return false;
 
+  if (sw.IsReading())
+    ClearVRAMCopyCache();
+
   if (host_texture)
   {
     GPUTexture* tex = *host_texture;
@@ -241,12 +250,12 @@ bool GPU_HW::DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_di
       if (!tex || tex->GetWidth() != m_vram_texture->GetWidth() || tex->GetHeight() != m_vram_texture->GetHeight() ||
           tex->GetSamples() != m_vram_texture->GetSamples())
       {
-        delete tex;
+        g_gpu_device->RecycleTexture(std::unique_ptr<GPUTexture>(tex));
 
         tex =
           g_gpu_device
-            ->CreateTexture(m_vram_texture->GetWidth(), m_vram_texture->GetHeight(), 1, 1, m_vram_texture->GetSamples(),
-                            GPUTexture::Type::RenderTarget, GPUTexture::Format::RGBA8, nullptr, 0, false)
+            ->FetchTexture(m_vram_texture->GetWidth(), m_vram_texture->GetHeight(), 1, 1, m_vram_texture->GetSamples(),
+                           GPUTexture::Type::RenderTarget, GPUTexture::Format::RGBA8, nullptr, 0, false)
             .release();
         *host_texture = tex;
         if (!tex)
@@ -284,6 +293,12 @@ void GPU_HW::UpdateSettings(const Settings& old_settings)
 
   const GPUDevice::Features features = g_gpu_device->GetFeatures();
 
+  if (g_settings.gpu_dynamic_resolution_scale != old_settings.gpu_dynamic_resolution_scale)
+  {
+    m_dynamic_resolution_scale = 0;
+    m_dynamic_resolution_good_intervals = 0;
+  }
+
   const u32 resolution_scale = CalculateResolutionScale();
   const u32 multisamples = std::min(g_settings.gpu_multisamples, g_gpu_device->GetMaxMultisamples());
   const bool per_sample_shading = g_settings.gpu_per_sample_shading && features.noperspective_interpolation;
@@ -302,7 +317,8 @@ void GPU_HW::UpdateSettings(const Settings& old_settings)
     (m_resolution_scale != resolution_scale || m_multisamples != multisamples ||
      m_true_color != g_settings.gpu_true_color || m_per_sample_shading != per_sample_shading ||
      m_scaled_dithering != g_settings.gpu_scaled_dithering || m_texture_filtering != g_settings.gpu_texture_filter ||
-     m_using_uv_limits != use_uv_limits || m_chroma_smoothing != g_settings.gpu_24bit_chroma_smoothing ||
+     m_using_uv_limits != use_uv_limits || m_use_uber_shader != g_settings.gpu_uber_shader ||
+     m_chroma_smoothing != g_settings.gpu_24bit_chroma_smoothing ||
      m_downsample_mode != downsample_mode ||
      (m_downsample_mode == GPUDownsampleMode::Box &&
       g_settings.gpu_downsample_scale != old_settings.gpu_downsample_scale) ||
@@ -347,6 +363,7 @@ void GPU_HW::UpdateSettings(const Settings& old_settings)
   m_scaled_dithering = g_settings.gpu_scaled_dithering;
   m_texture_filtering = g_settings.gpu_texture_filter;
   m_using_uv_limits = use_uv_limits;
+  m_use_uber_shader = g_settings.gpu_uber_shader;
   m_chroma_smoothing = g_settings.gpu_24bit_chroma_smoothing;
   m_downsample_mode = downsample_mode;
   m_wireframe_mode = wireframe_mode;
@@ -476,6 +493,9 @@ u32 GPU_HW::CalculateResolutionScale() const
     scale = static_cast<u32>(std::clamp<s32>(preferred_scale, 1, max_resolution_scale));
   }
 
+  if (g_settings.gpu_dynamic_resolution_scale && m_dynamic_resolution_scale != 0)
+    scale = std::min(scale, m_dynamic_resolution_scale);
+
   if (g_settings.gpu_downsample_mode == GPUDownsampleMode::Adaptive && scale > 1 && !Common::IsPow2(scale))
   {
     const u32 new_scale = Common::PreviousPow2(scale);
@@ -502,6 +522,61 @@ void GPU_HW::UpdateResolutionScale()
     UpdateSettings(g_settings);
 }
 
+void GPU_HW::UpdateDynamicResolutionScale()
+{
+  // Fill rate scales with the square of the resolution scale, so predict the cost of the next scale up from the
+  // current average present time before committing to it, and require the prediction to hold for a few update
+  // intervals so a single quiet second doesn't cause a bounce straight back down.
+  static constexpr float STEP_DOWN_THRESHOLD = 0.85f;
+  static constexpr float STEP_UP_THRESHOLD = 0.80f;
+  static constexpr u32 STEP_UP_INTERVALS = 3;
+
+  const float frame_period_ms = 1000.0f / System::GetThrottleFrequency();
+  const float average_gpu_time = System::GetGPUAverageTime();
+  if (average_gpu_time <= 0.0f || frame_period_ms <= 0.0f)
+    return;
+
+  if (m_dynamic_resolution_scale == 0)
+    m_dynamic_resolution_scale = m_resolution_scale;
+
+  // Adaptive downsampling only supports power-of-two scales, so step by factors of two in that case.
+  const bool pow2_steps = (g_settings.gpu_downsample_mode == GPUDownsampleMode::Adaptive);
+  u32 new_scale = m_dynamic_resolution_scale;
+  if (average_gpu_time > (frame_period_ms * STEP_DOWN_THRESHOLD))
+  {
+    if (m_dynamic_resolution_scale > 1)
+      new_scale = pow2_steps ? (m_dynamic_resolution_scale / 2) : (m_dynamic_resolution_scale - 1);
+    m_dynamic_resolution_good_intervals = 0;
+  }
+  else
+  {
+    const u32 next_scale = pow2_steps ? (m_dynamic_resolution_scale * 2) : (m_dynamic_resolution_scale + 1);
+    const float scale_ratio = static_cast<float>(next_scale) / static_cast<float>(m_resolution_scale);
+    const float predicted_time = average_gpu_time * scale_ratio * scale_ratio;
+    if (next_scale <= GetMaxResolutionScale() && predicted_time < (frame_period_ms * STEP_UP_THRESHOLD))
+    {
+      if (++m_dynamic_resolution_good_intervals >= STEP_UP_INTERVALS)
+      {
+        new_scale = next_scale;
+        m_dynamic_resolution_good_intervals = 0;
+      }
+    }
+    else
+    {
+      m_dynamic_resolution_good_intervals = 0;
+    }
+  }
+
+  if (new_scale == m_dynamic_resolution_scale)
+    return;
+
+  Log_DevPrintf("Dynamic resolution scale %ux -> %ux (average GPU time %.2fms of %.2fms frame)",
+                m_dynamic_resolution_scale, new_scale, average_gpu_time, frame_period_ms);
+  m_dynamic_resolution_scale = new_scale;
+  if (CalculateResolutionScale() != m_resolution_scale)
+    UpdateSettings(g_settings);
+}
+
 GPUDownsampleMode GPU_HW::GetDownsampleMode(u32 resolution_scale) const
 {
   return (resolution_scale == 1) ? GPUDownsampleMode::Disabled : g_settings.gpu_downsample_mode;
@@ -521,6 +596,7 @@ void GPU_HW::SetFullVRAMDirtyRectangle()
 {
   m_vram_dirty_rect.Set(0, 0, VRAM_WIDTH, VRAM_HEIGHT);
   m_draw_mode.SetTexturePageChanged();
+  ClearVRAMCopyCache();
 }
 
 void GPU_HW::ClearVRAMDirtyRectangle()
@@ -550,6 +626,7 @@ void GPU_HW::PrintSettingsToLog()
   Log_InfoPrintf("Texture Filtering: %s", Settings::GetTextureFilterDisplayName(m_texture_filtering));
   Log_InfoPrintf("Dual-source blending: %s", m_supports_dual_source_blend ? "Supported" : "Not supported");
   Log_InfoPrintf("Using UV limits: %s", m_using_uv_limits ? "YES" : "NO");
+  Log_InfoPrintf("Uber shader: %s", m_use_uber_shader ? "YES" : "NO");
   Log_InfoPrintf("Depth buffer: %s", m_pgxp_depth_buffer ? "YES" : "NO");
   Log_InfoPrintf("Downsampling: %s", Settings::GetDownsampleModeDisplayName(m_downsample_mode));
   Log_InfoPrintf("Wireframe rendering: %s", Settings::GetGPUWireframeModeDisplayName(m_wireframe_mode));
@@ -565,18 +642,18 @@ bool GPU_HW::CreateBuffers()
   const u32 texture_height = VRAM_HEIGHT * m_resolution_scale;
   const u8 samples = static_cast<u8>(m_multisamples);
 
-  if (!(m_vram_texture = g_gpu_device->CreateTexture(texture_width, texture_height, 1, 1, samples,
-                                                     GPUTexture::Type::RenderTarget, VRAM_RT_FORMAT)) ||
-      !(m_vram_depth_texture = g_gpu_device->CreateTexture(texture_width, texture_height, 1, 1, samples,
-                                                           GPUTexture::Type::DepthStencil, VRAM_DS_FORMAT)) ||
-      !(m_vram_read_texture = g_gpu_device->CreateTexture(texture_width, texture_height, 1, 1, 1,
-                                                          GPUTexture::Type::Texture, VRAM_RT_FORMAT)) ||
-      !(m_display_private_texture = g_gpu_device->CreateTexture(
+  if (!(m_vram_texture = g_gpu_device->FetchTexture(texture_width, texture_height, 1, 1, samples,
+                                                    GPUTexture::Type::RenderTarget, VRAM_RT_FORMAT)) ||
+      !(m_vram_depth_texture = g_gpu_device->FetchTexture(texture_width, texture_height, 1, 1, samples,
+                                                          GPUTexture::Type::DepthStencil, VRAM_DS_FORMAT)) ||
+      !(m_vram_read_texture = g_gpu_device->FetchTexture(texture_width, texture_height, 1, 1, 1,
+                                                         GPUTexture::Type::Texture, VRAM_RT_FORMAT)) ||
+      !(m_display_private_texture = g_gpu_device->FetchTexture(
           ((m_downsample_mode == GPUDownsampleMode::Adaptive) ? VRAM_WIDTH : GPU_MAX_DISPLAY_WIDTH) *
             m_resolution_scale,
           GPU_MAX_DISPLAY_HEIGHT * m_resolution_scale, 1, 1, 1, GPUTexture::Type::RenderTarget, VRAM_RT_FORMAT)) ||
-      !(m_vram_readback_texture = g_gpu_device->CreateTexture(VRAM_WIDTH / 2, VRAM_HEIGHT, 1, 1, 1,
-                                                              GPUTexture::Type::RenderTarget, VRAM_RT_FORMAT)))
+      !(m_vram_readback_texture = g_gpu_device->FetchTexture(VRAM_WIDTH / 2, VRAM_HEIGHT, 1, 1, 1,
+                                                             GPUTexture::Type::RenderTarget, VRAM_RT_FORMAT)))
   {
     return false;
   }
@@ -613,14 +690,14 @@ bool GPU_HW::CreateBuffers()
   {
     const u32 levels = GetAdaptiveDownsamplingMipLevels();
 
-    if (!(m_downsample_texture = g_gpu_device->CreateTexture(texture_width, texture_height, 1, levels, 1,
-                                                             GPUTexture::Type::Texture, VRAM_RT_FORMAT)) ||
-        !(m_downsample_render_texture = g_gpu_device->CreateTexture(texture_width, texture_height, 1, 1, 1,
-                                                                    GPUTexture::Type::RenderTarget, VRAM_RT_FORMAT)) ||
+    if (!(m_downsample_texture = g_gpu_device->FetchTexture(texture_width, texture_height, 1, levels, 1,
+                                                            GPUTexture::Type::Texture, VRAM_RT_FORMAT)) ||
+        !(m_downsample_render_texture = g_gpu_device->FetchTexture(texture_width, texture_height, 1, 1, 1,
+                                                                   GPUTexture::Type::RenderTarget, VRAM_RT_FORMAT)) ||
         !(m_downsample_framebuffer = g_gpu_device->CreateFramebuffer(m_downsample_render_texture.get())) ||
         !(m_downsample_weight_texture =
-            g_gpu_device->CreateTexture(texture_width >> (levels - 1), texture_height >> (levels - 1), 1, 1, 1,
-                                        GPUTexture::Type::RenderTarget, GPUTexture::Format::R8)) ||
+            g_gpu_device->FetchTexture(texture_width >> (levels - 1), texture_height >> (levels - 1), 1, 1, 1,
+                                       GPUTexture::Type::RenderTarget, GPUTexture::Format::R8)) ||
         !(m_downsample_weight_framebuffer = g_gpu_device->CreateFramebuffer(m_downsample_weight_texture.get())))
     {
       return false;
@@ -630,8 +707,8 @@ bool GPU_HW::CreateBuffers()
   {
     const u32 downsample_scale = GetBoxDownsampleScale();
     if (!(m_downsample_render_texture =
-            g_gpu_device->CreateTexture(VRAM_WIDTH * downsample_scale, VRAM_HEIGHT * downsample_scale, 1, 1, 1,
-                                        GPUTexture::Type::RenderTarget, VRAM_RT_FORMAT)) ||
+            g_gpu_device->FetchTexture(VRAM_WIDTH * downsample_scale, VRAM_HEIGHT * downsample_scale, 1, 1, 1,
+                                       GPUTexture::Type::RenderTarget, VRAM_RT_FORMAT)) ||
         !(m_downsample_framebuffer = g_gpu_device->CreateFramebuffer(m_downsample_render_texture.get())))
     {
       return false;
@@ -658,20 +735,23 @@ void GPU_HW::DestroyBuffers()
 
   m_vram_upload_buffer.reset();
   m_downsample_weight_framebuffer.reset();
-  m_downsample_weight_texture.reset();
   m_downsample_framebuffer.reset();
-  m_downsample_render_texture.reset();
-  m_downsample_texture.reset();
   m_display_framebuffer.reset();
   m_vram_readback_framebuffer.reset();
   m_vram_update_depth_framebuffer.reset();
   m_vram_framebuffer.reset();
-  m_vram_read_texture.reset();
   m_vram_depth_view.reset();
-  m_vram_depth_texture.reset();
-  m_vram_texture.reset();
-  m_vram_readback_texture.reset();
-  m_display_private_texture.reset();
+
+  // Return the targets to the pool, a resolution/setting change that takes us back to the same
+  // size then reuses them instead of reallocating driver memory.
+  g_gpu_device->RecycleTexture(std::move(m_downsample_weight_texture));
+  g_gpu_device->RecycleTexture(std::move(m_downsample_render_texture));
+  g_gpu_device->RecycleTexture(std::move(m_downsample_texture));
+  g_gpu_device->RecycleTexture(std::move(m_vram_read_texture));
+  g_gpu_device->RecycleTexture(std::move(m_vram_depth_texture));
+  g_gpu_device->RecycleTexture(std::move(m_vram_texture));
+  g_gpu_device->RecycleTexture(std::move(m_vram_readback_texture));
+  g_gpu_device->RecycleTexture(std::move(m_display_private_texture));
 }
 
 bool GPU_HW::CompilePipelines()
@@ -694,15 +774,33 @@ bool GPU_HW::CompilePipelines()
     batch_fragment_shaders.enumerate(destroy_shader);
   });
 
+  // Vulkan and D3D12 allow pipeline creation from multiple threads, which substantially cuts down the
+  // first-boot compile time on a cold pipeline cache; backends whose shader compilers are free-threaded
+  // use the same pool for the front-end shader compilation as well. The pool is declared after the
+  // shader guard so that it drains before the shaders are released if we bail out early.
+  std::unique_ptr<cb::ThreadPool> compile_thread_pool;
+  if (features.parallel_pipeline_compilation || features.parallel_shader_compilation)
+  {
+    const u32 num_workers = std::min<u32>(cb::ThreadPool::GetNumLogicalCores(), 8);
+    if (num_workers > 1)
+      compile_thread_pool = std::make_unique<cb::ThreadPool>(static_cast<int>(num_workers));
+  }
+
   for (u8 textured = 0; textured < 2; textured++)
   {
-    const std::string vs = shadergen.GenerateBatchVertexShader(ConvertToBoolUnchecked(textured));
+    const std::string vs = shadergen.GenerateBatchVertexShader(ConvertToBoolUnchecked(textured), m_use_uber_shader);
     if (!(batch_vertex_shaders[textured] = g_gpu_device->CreateShader(GPUShaderStage::Vertex, vs)))
       return false;
 
     progress.Increment();
   }
 
+  // The fragment shader permutations are all independent, so when the backend's shader compiler is
+  // free-threaded they fan out across the pool too. The vertex shaders above compiled synchronously,
+  // which makes sure any one-time compiler setup has happened before the workers start.
+  const bool parallel_shader_compile = (compile_thread_pool && features.parallel_shader_compilation);
+  DimensionalArray<std::future<std::unique_ptr<GPUShader>>, 2, 2, 9, 4> batch_fragment_shader_futures{};
+
   for (u8 render_mode = 0; render_mode < 4; render_mode++)
   {
     for (u8 texture_mode = 0; texture_mode < 9; texture_mode++)
@@ -711,22 +809,69 @@ bool GPU_HW::CompilePipelines()
       {
         for (u8 interlacing = 0; interlacing < 2; interlacing++)
         {
-          const std::string fs = shadergen.GenerateBatchFragmentShader(
-            static_cast<BatchRenderMode>(render_mode), static_cast<GPUTextureMode>(texture_mode),
+          // With the uber shader, all textured modes share the shader compiled into the Palette4Bit slot.
+          if (m_use_uber_shader && static_cast<GPUTextureMode>(texture_mode) != GPUTextureMode::Disabled &&
+              static_cast<GPUTextureMode>(texture_mode) != GPUTextureMode::Palette4Bit)
+          {
+            progress.Increment();
+            continue;
+          }
+
+          std::string fs = shadergen.GenerateBatchFragmentShader(
+            static_cast<BatchRenderMode>(render_mode), static_cast<GPUTextureMode>(texture_mode), m_use_uber_shader,
             ConvertToBoolUnchecked(dithering), ConvertToBoolUnchecked(interlacing));
 
-          if (!(batch_fragment_shaders[render_mode][texture_mode][dithering][interlacing] =
-                  g_gpu_device->CreateShader(GPUShaderStage::Fragment, fs)))
+          if (parallel_shader_compile)
           {
-            return false;
+            batch_fragment_shader_futures[render_mode][texture_mode][dithering][interlacing] =
+              compile_thread_pool->ScheduleAndGetFuture(
+                [fs = std::move(fs)]() { return g_gpu_device->CreateShader(GPUShaderStage::Fragment, fs); });
           }
+          else
+          {
+            if (!(batch_fragment_shaders[render_mode][texture_mode][dithering][interlacing] =
+                    g_gpu_device->CreateShader(GPUShaderStage::Fragment, fs)))
+            {
+              return false;
+            }
 
-          progress.Increment();
+            progress.Increment();
+          }
         }
       }
     }
   }
 
+  if (parallel_shader_compile)
+  {
+    bool compile_failed = false;
+    for (u8 render_mode = 0; render_mode < 4; render_mode++)
+    {
+      for (u8 texture_mode = 0; texture_mode < 9; texture_mode++)
+      {
+        for (u8 dithering = 0; dithering < 2; dithering++)
+        {
+          for (u8 interlacing = 0; interlacing < 2; interlacing++)
+          {
+            std::future<std::unique_ptr<GPUShader>>& future =
+              batch_fragment_shader_futures[render_mode][texture_mode][dithering][interlacing];
+            if (!future.valid())
+              continue;
+
+            std::unique_ptr<GPUShader>& shader =
+              batch_fragment_shaders[render_mode][texture_mode][dithering][interlacing];
+            shader = future.get();
+            compile_failed |= !shader;
+            progress.Increment();
+          }
+        }
+      }
+    }
+
+    if (compile_failed)
+      return false;
+  }
+
   static constexpr GPUPipeline::VertexAttribute vertex_attributes[] = {
     GPUPipeline::VertexAttribute::Make(0, GPUPipeline::VertexAttribute::Semantic::Position, 0,
                                        GPUPipeline::VertexAttribute::Type::Float, 4, offsetof(BatchVertex, x)),
@@ -754,6 +899,12 @@ bool GPU_HW::CompilePipelines()
   plconfig.per_sample_shading = m_per_sample_shading;
   plconfig.geometry_shader = nullptr;
 
+  // The first pipeline is still created synchronously, so that any backend state shared between
+  // them (e.g. render pass objects) exists before the workers start.
+  const bool parallel_pipeline_compile = (compile_thread_pool && features.parallel_pipeline_compilation);
+  DimensionalArray<std::future<std::unique_ptr<GPUPipeline>>, 2, 2, 5, 9, 4, 3> batch_pipeline_futures{};
+  bool compiled_first_pipeline = false;
+
   // [depth_test][render_mode][texture_mode][transparency_mode][dithering][interlacing]
   for (u8 depth_test = 0; depth_test < 3; depth_test++)
   {
@@ -772,6 +923,13 @@ bool GPU_HW::CompilePipelines()
                 GPUPipeline::DepthFunc::LessEqual};
               const bool textured = (static_cast<GPUTextureMode>(texture_mode) != GPUTextureMode::Disabled);
 
+              if (m_use_uber_shader && textured &&
+                  static_cast<GPUTextureMode>(texture_mode) != GPUTextureMode::Palette4Bit)
+              {
+                progress.Increment();
+                continue;
+              }
+
               plconfig.input_layout.vertex_attributes =
                 textured ?
                   (m_using_uv_limits ? std::span<const GPUPipeline::VertexAttribute>(
@@ -829,18 +987,67 @@ bool GPU_HW::CompilePipelines()
                 }
               }
 
-              if (!(m_batch_pipelines[depth_test][render_mode][texture_mode][transparency_mode][dithering]
-                                     [interlacing] = g_gpu_device->CreatePipeline(plconfig)))
+              if (parallel_pipeline_compile && compiled_first_pipeline)
               {
-                return false;
+                batch_pipeline_futures[depth_test][render_mode][texture_mode][transparency_mode][dithering]
+                                      [interlacing] = compile_thread_pool->ScheduleAndGetFuture(
+                                        [plconfig]() { return g_gpu_device->CreatePipeline(plconfig); });
               }
+              else
+              {
+                if (!(m_batch_pipelines[depth_test][render_mode][texture_mode][transparency_mode][dithering]
+                                       [interlacing] = g_gpu_device->CreatePipeline(plconfig)))
+                {
+                  return false;
+                }
+
+                compiled_first_pipeline = true;
+                progress.Increment();
+              }
+            }
+          }
+        }
+      }
+    }
+  }
 
-              progress.Increment();
+  if (parallel_pipeline_compile)
+  {
+    // Collect all outstanding pipelines before checking for failure, otherwise the pool teardown would
+    // wait on workers whose results are then thrown away.
+    bool compile_failed = false;
+    for (u8 depth_test = 0; depth_test < 3; depth_test++)
+    {
+      for (u8 render_mode = 0; render_mode < 4; render_mode++)
+      {
+        for (u8 transparency_mode = 0; transparency_mode < 5; transparency_mode++)
+        {
+          for (u8 texture_mode = 0; texture_mode < 9; texture_mode++)
+          {
+            for (u8 dithering = 0; dithering < 2; dithering++)
+            {
+              for (u8 interlacing = 0; interlacing < 2; interlacing++)
+              {
+                std::future<std::unique_ptr<GPUPipeline>>& future =
+                  batch_pipeline_futures[depth_test][render_mode][texture_mode][transparency_mode][dithering]
+                                        [interlacing];
+                if (!future.valid())
+                  continue;
+
+                std::unique_ptr<GPUPipeline>& pipeline = m_batch_pipelines[depth_test][render_mode][texture_mode]
+                                                                          [transparency_mode][dithering][interlacing];
+                pipeline = future.get();
+                compile_failed |= !pipeline;
+                progress.Increment();
+              }
             }
           }
         }
       }
     }
+
+    if (compile_failed)
+      return false;
   }
 
   if (m_wireframe_mode != GPUWireframeMode::Disabled)
@@ -1247,10 +1454,12 @@ void GPU_HW::DrawBatchVertices(BatchRenderMode render_mode, u32 num_vertices, u3
 {
   // [depth_test][render_mode][texture_mode][transparency_mode][dithering][interlacing]
   const u8 depth_test = m_batch.use_depth_buffer ? static_cast<u8>(2) : BoolToUInt8(m_batch.check_mask_before_draw);
-  g_gpu_device->SetPipeline(
-    m_batch_pipelines[depth_test][static_cast<u8>(render_mode)][static_cast<u8>(m_batch.texture_mode)][static_cast<u8>(
-      m_batch.transparency_mode)][BoolToUInt8(m_batch.dithering)][BoolToUInt8(m_batch.interlacing)]
-      .get());
+  const u8 texture_mode = (m_use_uber_shader && m_batch.texture_mode != GPUTextureMode::Disabled) ?
+                            static_cast<u8>(GPUTextureMode::Palette4Bit) :
+                            static_cast<u8>(m_batch.texture_mode);
+  g_gpu_device->SetPipeline(m_batch_pipelines[depth_test][static_cast<u8>(render_mode)][texture_mode][static_cast<u8>(
+    m_batch.transparency_mode)][BoolToUInt8(m_batch.dithering)][BoolToUInt8(m_batch.interlacing)]
+                              .get());
   g_gpu_device->Draw(num_vertices, base_vertex);
 }
 
@@ -1515,7 +1724,11 @@ void GPU_HW::LoadVertices()
     m_current_depth++;
 
   const GPURenderCommand rc{m_render_command.bits};
-  const u32 texpage = ZeroExtend32(m_draw_mode.mode_reg.bits) | (ZeroExtend32(m_draw_mode.palette_reg) << 16);
+
+  // The uber shader reads the texture mode from the mode register bits in the vertex; the raw texture flag is
+  // per-command rather than per-page, so it rides in the unused mode register bit 15.
+  const u32 texpage = ZeroExtend32(m_draw_mode.mode_reg.bits) | (ZeroExtend32(m_draw_mode.palette_reg) << 16) |
+                      ((m_use_uber_shader && rc.raw_texture_enable) ? (1u << 15) : 0u);
   const float depth = GetCurrentNormalizedVertexDepth();
 
   switch (rc.primitive)
@@ -1964,6 +2177,50 @@ void GPU_HW::IncludeVRAMDirtyRectangle(const Common::Rectangle<u32>& rect)
   }
 }
 
+bool GPU_HW::IsVRAMCopyCached(u32 src_x, u32 src_y, u32 dst_x, u32 dst_y, u32 width, u32 height) const
+{
+  for (u32 i = 0; i < m_vram_copy_cache_size; i++)
+  {
+    const VRAMCopyCacheEntry& entry = m_vram_copy_cache[i];
+    if (entry.src_x == src_x && entry.src_y == src_y && entry.dst_x == dst_x && entry.dst_y == dst_y &&
+        entry.width == width && entry.height == height)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void GPU_HW::RecordVRAMCopy(u32 src_x, u32 src_y, u32 dst_x, u32 dst_y, u32 width, u32 height)
+{
+  // evict the oldest entry when full
+  if (m_vram_copy_cache_size == VRAM_COPY_CACHE_SIZE)
+  {
+    std::memmove(&m_vram_copy_cache[0], &m_vram_copy_cache[1], sizeof(VRAMCopyCacheEntry) * (VRAM_COPY_CACHE_SIZE - 1));
+    m_vram_copy_cache_size--;
+  }
+
+  m_vram_copy_cache[m_vram_copy_cache_size++] = {src_x, src_y, dst_x, dst_y, width, height};
+}
+
+void GPU_HW::InvalidateVRAMCopyCache(const Common::Rectangle<u32>& rect)
+{
+  for (u32 i = 0; i < m_vram_copy_cache_size;)
+  {
+    const VRAMCopyCacheEntry& entry = m_vram_copy_cache[i];
+    if (Common::Rectangle<u32>::FromExtents(entry.src_x, entry.src_y, entry.width, entry.height).Intersects(rect) ||
+        Common::Rectangle<u32>::FromExtents(entry.dst_x, entry.dst_y, entry.width, entry.height).Intersects(rect))
+    {
+      m_vram_copy_cache[i] = m_vram_copy_cache[--m_vram_copy_cache_size];
+    }
+    else
+    {
+      i++;
+    }
+  }
+}
+
 GPU_HW::InterlacedRenderMode GPU_HW::GetInterlacedRenderMode() const
 {
   if (IsInterlacedDisplayEnabled())
@@ -2108,6 +2365,7 @@ void GPU_HW::FillVRAM(u32 x, u32 y, u32 width, u32 height, u32 color)
 
   IncludeVRAMDirtyRectangle(
     Common::Rectangle<u32>::FromExtents(x, y, width, height).Clamped(0, 0, VRAM_WIDTH, VRAM_HEIGHT));
+  InvalidateVRAMCopyCache(GetVRAMTransferBounds(x, y, width, height));
 
   const bool is_oversized = (((x + width) > VRAM_WIDTH || (y + height) > VRAM_HEIGHT));
   g_gpu_device->SetPipeline(
@@ -2151,6 +2409,33 @@ void GPU_HW::ReadVRAM(u32 x, u32 y, u32 width, u32 height)
 
   // Get bounds with wrap-around handled.
   const Common::Rectangle<u32> copy_rect = GetVRAMTransferBounds(x, y, width, height);
+
+  // Full-VRAM readbacks (save states, VRAM dumps, renderer switches) must always be exact, so only
+  // game-sized transfers go through the prediction path.
+  if (g_settings.gpu_fast_vram_readbacks && copy_rect.GetWidth() < VRAM_WIDTH && copy_rect.GetHeight() < VRAM_HEIGHT)
+  {
+    // Prediction hit - the rectangle was refreshed from the GPU at the end of the previous frame, so the
+    // shadow already contains the previous frame's data and the stall can be skipped entirely.
+    if (m_predicted_readback_rect.Valid() && m_predicted_readback_rect.left <= copy_rect.left &&
+        m_predicted_readback_rect.top <= copy_rect.top && m_predicted_readback_rect.right >= copy_rect.right &&
+        m_predicted_readback_rect.bottom >= copy_rect.bottom)
+    {
+      m_predicted_readback_hit = true;
+      return;
+    }
+
+    // Miss - pay for a synchronous readback this time, and start predicting this rectangle.
+    m_predicted_readback_rect.Include(copy_rect);
+    m_predicted_readback_hit = true;
+  }
+
+  DownloadVRAMFromGPU(copy_rect);
+}
+
+void GPU_HW::DownloadVRAMFromGPU(const Common::Rectangle<u32>& copy_rect)
+{
+  g_gpu_device->BeginTimerScope("VRAM Readback");
+
   const u32 encoded_width = (copy_rect.GetWidth() + 1) / 2;
   const u32 encoded_height = copy_rect.GetHeight();
 
@@ -2169,6 +2454,7 @@ void GPU_HW::ReadVRAM(u32 x, u32 y, u32 width, u32 height)
                                 reinterpret_cast<u32*>(&m_vram_shadow[copy_rect.top * VRAM_WIDTH + copy_rect.left]),
                                 VRAM_WIDTH * sizeof(u16));
 
+  g_gpu_device->EndTimerScope();
   RestoreDeviceContext();
 }
 
@@ -2192,13 +2478,14 @@ void GPU_HW::UpdateVRAM(u32 x, u32 y, u32 width, u32 height, const void* data, b
   const Common::Rectangle<u32> bounds = GetVRAMTransferBounds(x, y, width, height);
   DebugAssert(bounds.right <= VRAM_WIDTH && bounds.bottom <= VRAM_HEIGHT);
   IncludeVRAMDirtyRectangle(bounds);
+  InvalidateVRAMCopyCache(bounds);
 
   if (check_mask)
   {
     // set new vertex counter since we want this to take into consideration previous masked pixels
     m_current_depth++;
   }
-  else
+  else if (g_settings.texture_replacements.enable_vram_write_replacements)
   {
     const TextureReplacementTexture* rtex = g_texture_replacements.GetVRAMWriteReplacement(width, height, data);
     if (rtex && BlitVRAMReplacementTexture(rtex, x * m_resolution_scale, y * m_resolution_scale,
@@ -2208,6 +2495,8 @@ void GPU_HW::UpdateVRAM(u32 x, u32 y, u32 width, u32 height, const void* data, b
     }
   }
 
+  g_gpu_device->BeginTimerScope("VRAM Write");
+
   const u32 num_pixels = width * height;
   void* map = m_vram_upload_buffer->Map(num_pixels);
   const u32 map_index = m_vram_upload_buffer->GetCurrentPosition();
@@ -2238,6 +2527,7 @@ void GPU_HW::UpdateVRAM(u32 x, u32 y, u32 width, u32 height, const void* data, b
   g_gpu_device->SetTextureBuffer(0, m_vram_upload_buffer.get());
   g_gpu_device->Draw(3, 0);
 
+  g_gpu_device->EndTimerScope();
   RestoreDeviceContext();
 }
 
@@ -2264,6 +2554,16 @@ void GPU_HW::CopyVRAM(u32 src_x, u32 src_y, u32 dst_x, u32 dst_y, u32 width, u32
      Common::Rectangle<u32>::FromExtents(src_x, src_y, width, height)
        .Intersects(Common::Rectangle<u32>::FromExtents(dst_x, dst_y, width, height)));
 
+  // Unmasked, non-overlapping copies are idempotent: if the same copy already executed and nothing has
+  // written to the source or destination since, VRAM already contains the result, so skip the GPU work.
+  // Shader copies are excluded since they refresh the depth buffer with the current batch depth.
+  const bool cacheable = !use_shader && !IsUsingMultisampling();
+  if (cacheable && IsVRAMCopyCached(src_x, src_y, dst_x, dst_y, width, height))
+  {
+    m_renderer_stats.num_elided_vram_copies++;
+    return;
+  }
+
   if (use_shader || IsUsingMultisampling())
   {
     const Common::Rectangle<u32> src_bounds = GetVRAMTransferBounds(src_x, src_y, width, height);
@@ -2271,6 +2571,7 @@ void GPU_HW::CopyVRAM(u32 src_x, u32 src_y, u32 dst_x, u32 dst_y, u32 width, u32
     if (m_vram_dirty_rect.Intersects(src_bounds))
       UpdateVRAMReadTexture();
     IncludeVRAMDirtyRectangle(dst_bounds);
+    InvalidateVRAMCopyCache(dst_bounds);
 
     struct VRAMCopyUBOData
     {
@@ -2323,6 +2624,7 @@ void GPU_HW::CopyVRAM(u32 src_x, u32 src_y, u32 dst_x, u32 dst_y, u32 width, u32
 
   IncludeVRAMDirtyRectangle(
     Common::Rectangle<u32>::FromExtents(dst_x, dst_y, width, height).Clamped(0, 0, VRAM_WIDTH, VRAM_HEIGHT));
+  InvalidateVRAMCopyCache(GetVRAMTransferBounds(dst_x, dst_y, width, height));
 
   if (m_GPUSTAT.check_mask_before_draw)
   {
@@ -2334,6 +2636,9 @@ void GPU_HW::CopyVRAM(u32 src_x, u32 src_y, u32 dst_x, u32 dst_y, u32 width, u32
                                   m_vram_read_texture.get(), src_x * m_resolution_scale, src_y * m_resolution_scale, 0,
                                   0, width * m_resolution_scale, height * m_resolution_scale);
   m_vram_read_texture->MakeReadyForSampling();
+
+  if (cacheable)
+    RecordVRAMCopy(src_x, src_y, dst_x, dst_y, width, height);
 }
 
 void GPU_HW::DispatchRenderCommand()
@@ -2375,7 +2680,13 @@ void GPU_HW::DispatchRenderCommand()
   const GPUTransparencyMode transparency_mode =
     rc.transparency_enable ? m_draw_mode.mode_reg.transparency_mode : GPUTransparencyMode::Disabled;
   const bool dithering_enable = (!m_true_color && rc.IsDitheringEnabled()) ? m_GPUSTAT.dither_enable : false;
-  if (texture_mode != m_batch.texture_mode || transparency_mode != m_batch.transparency_mode ||
+
+  // The uber shader selects the texture mode per-vertex, so only textured<->untextured transitions break the batch.
+  const bool texture_mode_changed =
+    m_use_uber_shader ?
+      ((texture_mode == GPUTextureMode::Disabled) != (m_batch.texture_mode == GPUTextureMode::Disabled)) :
+      (texture_mode != m_batch.texture_mode);
+  if (texture_mode_changed || transparency_mode != m_batch.transparency_mode ||
       transparency_mode == GPUTransparencyMode::BackgroundMinusForeground || dithering_enable != m_batch.dithering)
   {
     FlushRender();
@@ -2465,6 +2776,8 @@ void GPU_HW::FlushRender()
   GL_SCOPE("Hardware Draw %u", ++s_draw_number);
 #endif
 
+  g_gpu_device->BeginTimerScope("Batch Draws");
+
   if (m_batch_ubo_dirty)
   {
     g_gpu_device->UploadUniformBuffer(&m_batch_ubo_data, sizeof(m_batch_ubo_data));
@@ -2493,12 +2806,32 @@ void GPU_HW::FlushRender()
     g_gpu_device->SetPipeline(m_wireframe_pipeline.get());
     g_gpu_device->Draw(vertex_count, m_batch_base_vertex);
   }
+
+  g_gpu_device->EndTimerScope();
+
+  // Draw bounds aren't tracked per-batch, so any drawing conservatively drops the copy cache.
+  ClearVRAMCopyCache();
 }
 
 void GPU_HW::UpdateDisplay()
 {
   FlushRender();
 
+  if (m_predicted_readback_rect.Valid())
+  {
+    // Refresh the predicted rectangle now that the frame's draws have been submitted, and drop the
+    // prediction if nothing read it this frame.
+    if (m_predicted_readback_hit)
+    {
+      m_predicted_readback_hit = false;
+      DownloadVRAMFromGPU(m_predicted_readback_rect);
+    }
+    else
+    {
+      m_predicted_readback_rect.SetInvalid();
+    }
+  }
+
   if (g_settings.debugging.show_vram)
   {
     if (IsUsingMultisampling())
@@ -2786,6 +3119,11 @@ void GPU_HW::DrawRendererStats(bool is_idle_frame)
     ImGui::Text("%u", stats.num_uniform_buffer_updates);
     ImGui::NextColumn();
 
+    ImGui::TextUnformatted("Elided VRAM Copies: ");
+    ImGui::NextColumn();
+    ImGui::Text("%u", stats.num_elided_vram_copies);
+    ImGui::NextColumn();
+
     ImGui::Columns(1);
   }
 }
@@ -53,6 +53,7 @@ public:
 
   void UpdateSettings(const Settings& old_settings) override;
   void UpdateResolutionScale() override final;
+  void UpdateDynamicResolutionScale() override final;
   std::tuple<u32, u32> GetEffectiveDisplayResolution(bool scaled = true) override final;
   std::tuple<u32, u32> GetFullDisplayResolution(bool scaled = true) override final;
 
@@ -142,6 +143,7 @@ private:
     u32 num_batches;
     u32 num_vram_read_texture_updates;
     u32 num_uniform_buffer_updates;
+    u32 num_elided_vram_copies;
   };
 
   bool CreateBuffers();
@@ -152,6 +154,7 @@ private:
   void DestroyPipelines();
 
   void UpdateVRAMReadTexture();
+  void DownloadVRAMFromGPU(const Common::Rectangle<u32>& copy_rect);
   void UpdateDepthBufferFromMaskBit();
   void ClearDepthBuffer();
   void SetScissor();
@@ -171,6 +174,13 @@ private:
   void ClearVRAMDirtyRectangle();
   void IncludeVRAMDirtyRectangle(const Common::Rectangle<u32>& rect);
 
+  /// Redundant-copy elimination. Returns true if the same copy was executed with the source and
+  /// destination untouched since, in which case VRAM already contains the result and it can be skipped.
+  ALWAYS_INLINE void ClearVRAMCopyCache() { m_vram_copy_cache_size = 0; }
+  bool IsVRAMCopyCached(u32 src_x, u32 src_y, u32 dst_x, u32 dst_y, u32 width, u32 height) const;
+  void RecordVRAMCopy(u32 src_x, u32 src_y, u32 dst_x, u32 dst_y, u32 width, u32 height);
+  void InvalidateVRAMCopyCache(const Common::Rectangle<u32>& rect);
+
   ALWAYS_INLINE bool IsFlushed() const { return m_batch_current_vertex_ptr == m_batch_start_vertex_ptr; }
   ALWAYS_INLINE u32 GetBatchVertexSpace() const
   {
@@ -267,6 +277,10 @@ private:
   u32 m_resolution_scale = 1;
   u32 m_multisamples = 1;
 
+  // Upper bound applied by the dynamic resolution scaler, zero when no limit has been established yet.
+  u32 m_dynamic_resolution_scale = 0;
+  u32 m_dynamic_resolution_good_intervals = 0;
+
   union
   {
     BitField<u8, bool, 0, 1> m_supports_dual_source_blend;
@@ -284,6 +298,7 @@ private:
   bool m_true_color = true;
   bool m_using_uv_limits = false;
   bool m_pgxp_depth_buffer = false;
+  bool m_use_uber_shader = false;
 
   BatchConfig m_batch;
   BatchUBOData m_batch_ubo_data = {};
@@ -291,6 +306,26 @@ private:
   // Bounding box of VRAM area that the GPU has drawn into.
   Common::Rectangle<u32> m_vram_dirty_rect;
 
+  // Predicted readback rectangle for fast VRAM readbacks. Refreshed from the GPU at the end of each frame
+  // it was hit, so repeated reads of the same area return the previous frame's data without stalling.
+  Common::Rectangle<u32> m_predicted_readback_rect;
+  bool m_predicted_readback_hit = false;
+
+  // Recent unmasked, non-overlapping copies for redundant-copy elimination. Entries are dropped when
+  // anything writes to their source or destination, and the whole cache is dropped when a batch draws.
+  struct VRAMCopyCacheEntry
+  {
+    u32 src_x, src_y;
+    u32 dst_x, dst_y;
+    u32 width, height;
+  };
+  enum : u32
+  {
+    VRAM_COPY_CACHE_SIZE = 8
+  };
+  std::array<VRAMCopyCacheEntry, VRAM_COPY_CACHE_SIZE> m_vram_copy_cache = {};
+  u32 m_vram_copy_cache_size = 0;
+
   // Changed state
   bool m_batch_ubo_dirty = true;
 
@@ -58,11 +58,12 @@ void GPU_HW_ShaderGen::WriteBatchUniformBuffer(std::stringstream& ss)
                        false);
 }
 
-std::string GPU_HW_ShaderGen::GenerateBatchVertexShader(bool textured)
+std::string GPU_HW_ShaderGen::GenerateBatchVertexShader(bool textured, bool uber_shader)
 {
   std::stringstream ss;
   WriteHeader(ss);
   DefineMacro(ss, "TEXTURED", textured);
+  DefineMacro(ss, "TEXTURE_MODE_DYNAMIC", textured && uber_shader);
   DefineMacro(ss, "UV_LIMITS", m_uv_limits);
   DefineMacro(ss, "PGXP_DEPTH", m_pgxp_depth);
 
@@ -134,6 +135,13 @@ std::string GPU_HW_ShaderGen::GenerateBatchVertexShader(bool textured)
     v_texpage.z = ((a_texpage >> 16) & 63u) * 16u * RESOLUTION_SCALE;
     v_texpage.w = ((a_texpage >> 22) & 511u) * RESOLUTION_SCALE;
 
+    #if TEXTURE_MODE_DYNAMIC
+      // Texture mode rides in the unused high bits of v_texpage.x, so a single batch can mix modes.
+      // Bits 16-17 are the colour mode (reserved 16-bit direct aliases to 16-bit direct), bit 18 is
+      // the raw texture flag packed into mode register bit 15 by LoadVertices.
+      v_texpage.x |= (min((a_texpage >> 7) & 3u, 2u) << 16) | (((a_texpage >> 15) & 1u) << 18);
+    #endif
+
     #if UV_LIMITS
       v_uv_limits = a_uv_limits * float4(255.0, 255.0, 255.0, 255.0);
     #endif
@@ -630,7 +638,8 @@ void FilteredSampleFromVRAM(uint4 texpage, float2 coords, float4 uv_limits,
 }
 
 std::string GPU_HW_ShaderGen::GenerateBatchFragmentShader(GPU_HW::BatchRenderMode transparency,
-                                                          GPUTextureMode texture_mode, bool dithering, bool interlacing)
+                                                          GPUTextureMode texture_mode, bool uber_shader,
+                                                          bool dithering, bool interlacing)
 {
   const GPUTextureMode actual_texture_mode = texture_mode & ~GPUTextureMode::RawTextureBit;
   const bool raw_texture = (texture_mode & GPUTextureMode::RawTextureBit) == GPUTextureMode::RawTextureBit;
@@ -646,6 +655,7 @@ std::string GPU_HW_ShaderGen::GenerateBatchFragmentShader(GPU_HW::BatchRenderMod
   DefineMacro(ss, "TRANSPARENCY_ONLY_OPAQUE", transparency == GPU_HW::BatchRenderMode::OnlyOpaque);
   DefineMacro(ss, "TRANSPARENCY_ONLY_TRANSPARENT", transparency == GPU_HW::BatchRenderMode::OnlyTransparent);
   DefineMacro(ss, "TEXTURED", textured);
+  DefineMacro(ss, "TEXTURE_MODE_DYNAMIC", textured && uber_shader);
   DefineMacro(ss, "PALETTE",
               actual_texture_mode == GPUTextureMode::Palette4Bit || actual_texture_mode == GPUTextureMode::Palette8Bit);
   DefineMacro(ss, "PALETTE_4_BIT", actual_texture_mode == GPUTextureMode::Palette4Bit);
@@ -720,6 +730,47 @@ uint2 FloatToIntegerCoords(float2 coords)
   return uint2((RESOLUTION_SCALE == 1u) ? roundEven(coords) : floor(coords));
 }
 
+#if TEXTURE_MODE_DYNAMIC
+
+float4 SampleFromVRAM(uint4 texpage, float2 coords)
+{
+  uint texture_mode = (texpage.x >> 16) & 3u;
+  uint2 page_base = uint2(texpage.x & 0xFFFFu, texpage.y);
+  if (texture_mode < 2u)
+  {
+    uint2 icoord = ApplyTextureWindow(FloatToIntegerCoords(coords));
+    uint2 index_coord = icoord;
+
+    // 4 texels per VRAM word in 4-bit mode, 2 in 8-bit mode.
+    index_coord.x >>= (2u - texture_mode);
+
+    // fixup coords
+    uint2 vicoord = page_base + (index_coord * uint2(RESOLUTION_SCALE, RESOLUTION_SCALE));
+
+    // load colour/palette
+    float4 texel = SAMPLE_TEXTURE(samp0, float2(vicoord) * RCP_VRAM_SIZE);
+    uint vram_value = RGBA8ToRGBA5551(texel);
+
+    // apply palette
+    uint index_bits = 4u << texture_mode;
+    uint subpixel = icoord.x & (3u >> texture_mode);
+    uint palette_index = (vram_value >> (subpixel * index_bits)) & ((1u << index_bits) - 1u);
+
+    // sample palette
+    uint2 palette_icoord = uint2(texpage.z + (palette_index * RESOLUTION_SCALE), texpage.w);
+    return SAMPLE_TEXTURE(samp0, float2(palette_icoord) * RCP_VRAM_SIZE);
+  }
+  else
+  {
+    // Direct texturing. Render-to-texture effects. Use upscaled coordinates.
+    uint2 icoord = ApplyUpscaledTextureWindow(FloatToIntegerCoords(coords));
+    uint2 direct_icoord = page_base + icoord;
+    return SAMPLE_TEXTURE(samp0, float2(direct_icoord) * RCP_VRAM_SIZE);
+  }
+}
+
+#else
+
 float4 SampleFromVRAM(uint4 texpage, float2 coords)
 {
   #if PALETTE
@@ -752,12 +803,14 @@ float4 SampleFromVRAM(uint4 texpage, float2 coords)
     return SAMPLE_TEXTURE(samp0, float2(palette_icoord) * RCP_VRAM_SIZE);
   #else
     // Direct texturing. Render-to-texture effects. Use upscaled coordinates.
-    uint2 icoord = ApplyUpscaledTextureWindow(FloatToIntegerCoords(coords));    
+    uint2 icoord = ApplyUpscaledTextureWindow(FloatToIntegerCoords(coords));
     uint2 direct_icoord = texpage.xy + icoord;
     return SAMPLE_TEXTURE(samp0, float2(direct_icoord) * RCP_VRAM_SIZE);
   #endif
 }
 
+#endif
+
 #endif
 )";
 
@@ -804,19 +857,27 @@ float4 SampleFromVRAM(uint4 texpage, float2 coords)
 
     // We can't currently use upscaled coordinate for palettes because of how they're packed.
     // Not that it would be any benefit anyway, render-to-texture effects don't use palettes.
+    #if TEXTURE_MODE_DYNAMIC
+      bool palette = (((v_texpage.x >> 16) & 3u) < 2u);
+      bool raw_texture = (((v_texpage.x >> 18) & 1u) != 0u);
+    #else
+      bool palette = (PALETTE != 0);
+      bool raw_texture = (RAW_TEXTURE != 0);
+    #endif
+
     float2 coords = v_tex0;
-    #if PALETTE
+    if (palette)
       coords /= float2(RESOLUTION_SCALE, RESOLUTION_SCALE);
-    #endif
 
     #if UV_LIMITS
       float4 uv_limits = v_uv_limits;
-      #if !PALETTE
-        // Extend the UV range to all "upscaled" pixels. This means 1-pixel-high polygon-based 
+      if (!palette)
+      {
+        // Extend the UV range to all "upscaled" pixels. This means 1-pixel-high polygon-based
         // framebuffer effects won't be downsampled. (e.g. Mega Man Legends 2 haze effect)
         uv_limits *= float(RESOLUTION_SCALE);
         uv_limits.zw += float(RESOLUTION_SCALE - 1u);
-      #endif
+      }
     #endif
 
     float4 texcol;
@@ -841,24 +902,26 @@ float4 SampleFromVRAM(uint4 texpage, float2 coords)
     // If not using true color, truncate the framebuffer colors to 5-bit.
     #if !TRUE_COLOR
       icolor = uint3(texcol.rgb * float3(255.0, 255.0, 255.0)) >> 3;
-      #if !RAW_TEXTURE
+      if (!raw_texture)
+      {
         icolor = (icolor * vertcol) >> 4;
         #if DITHERING
           icolor = ApplyDithering(uint2(v_pos.xy), icolor);
         #else
           icolor = min(icolor >> 3, uint3(31u, 31u, 31u));
         #endif
-      #endif
+      }
     #else
       icolor = uint3(texcol.rgb * float3(255.0, 255.0, 255.0));
-      #if !RAW_TEXTURE
+      if (!raw_texture)
+      {
         icolor = (icolor * vertcol) >> 7;
         #if DITHERING
           icolor = ApplyDithering(uint2(v_pos.xy), icolor);
         #else
           icolor = min(icolor, uint3(255u, 255u, 255u));
         #endif
-      #endif
+      }
     #endif
 
     // Compute output alpha (mask bit)
@@ -13,9 +13,9 @@ public:
                    bool pgxp_depth, bool disable_color_perspective, bool supports_dual_source_blend);
   ~GPU_HW_ShaderGen();
 
-  std::string GenerateBatchVertexShader(bool textured);
+  std::string GenerateBatchVertexShader(bool textured, bool uber_shader);
   std::string GenerateBatchFragmentShader(GPU_HW::BatchRenderMode transparency, GPUTextureMode texture_mode,
-                                          bool dithering, bool interlacing);
+                                          bool uber_shader, bool dithering, bool interlacing);
   std::string GenerateDisplayFragmentShader(bool depth_24bit, GPU_HW::InterlacedRenderMode interlace_mode,
                                             bool smooth_chroma);
   std::string GenerateWireframeGeometryShader();
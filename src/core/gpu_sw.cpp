@@ -5,6 +5,7 @@
 #include "system.h"
 
 #include "util/gpu_device.h"
+#include "util/state_wrapper.h"
 
 #include "common/align.h"
 #include "common/assert.h"
@@ -12,6 +13,8 @@
 #include "common/make_array.h"
 #include "common/platform.h"
 
+#include "imgui.h"
+
 #include <algorithm>
 
 Log_SetChannel(GPU_SW);
@@ -87,7 +90,17 @@ bool GPU_SW::Initialize()
 bool GPU_SW::DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_display)
 {
   // ignore the host texture for software mode, since we want to save vram here
-  return GPU::DoState(sw, nullptr, update_display);
+  if (!GPU::DoState(sw, nullptr, update_display))
+    return false;
+
+  if (sw.IsReading())
+  {
+    // VRAM was just replaced wholesale, so any cached scanout is stale.
+    m_backend.SetFullVRAMDirtyRectangle();
+    m_last_scanout.valid = false;
+  }
+
+  return true;
 }
 
 void GPU_SW::Reset(bool clear_vram)
@@ -103,6 +116,21 @@ void GPU_SW::UpdateSettings(const Settings& old_settings)
   m_backend.UpdateSettings();
 }
 
+void GPU_SW::DrawRendererStats(bool is_idle_frame)
+{
+  if (!is_idle_frame)
+  {
+    m_last_wakeup_count = m_backend.GetAndClearWakeupCount();
+    m_last_peak_command_size = m_backend.GetAndClearPeakCommandSize();
+  }
+
+  if (ImGui::CollapsingHeader("GPU Thread", ImGuiTreeNodeFlags_DefaultOpen))
+  {
+    ImGui::Text("Wakeups: %u", m_last_wakeup_count);
+    ImGui::Text("Peak Queue Size: %u bytes", m_last_peak_command_size);
+  }
+}
+
 GPUTexture* GPU_SW::GetDisplayTexture(u32 width, u32 height, GPUTexture::Format format)
 {
   if (!m_private_display_texture || m_private_display_texture->GetWidth() != width ||
@@ -119,6 +147,46 @@ GPUTexture* GPU_SW::GetDisplayTexture(u32 width, u32 height, GPUTexture::Format
   return m_private_display_texture.get();
 }
 
+bool GPU_SW::IsScanoutDirty(u32 src_x, u32 src_y, u32 width, u32 height, bool depth_24, bool interlaced,
+                            bool interleaved, GPUTexture::Format format)
+{
+  const bool params_changed = !m_last_scanout.valid || m_last_scanout.src_x != src_x ||
+                              m_last_scanout.src_y != src_y || m_last_scanout.width != width ||
+                              m_last_scanout.height != height || m_last_scanout.depth_24 != depth_24 ||
+                              m_last_scanout.interlaced != interlaced || m_last_scanout.interleaved != interleaved ||
+                              m_last_scanout.format != format;
+  if (params_changed)
+    m_last_scanout = {src_x, src_y, width, height, depth_24, interlaced, interleaved, format, true};
+
+  // Treat sources which wrap around VRAM as covering all of it, rather than tracking the wrapped pieces.
+  Common::Rectangle<u32> src_rect = Common::Rectangle<u32>::FromExtents(src_x, src_y, width, height);
+  if (src_rect.right > VRAM_WIDTH || src_rect.bottom > VRAM_HEIGHT)
+    src_rect.Set(0, 0, VRAM_WIDTH, VRAM_HEIGHT);
+
+  const Common::Rectangle<u32>& dirty_rect = m_backend.GetVRAMDirtyRectangle();
+  const bool vram_dirty = dirty_rect.Valid() && dirty_rect.Intersects(src_rect);
+  if (params_changed || vram_dirty)
+  {
+    // Interlacing weaves the two fields into the same texture, so both have to be rewritten before the
+    // display is clean again.
+    m_remaining_scanout_copies = interlaced ? 2 : 1;
+  }
+
+  if (m_remaining_scanout_copies == 0 && m_private_display_texture)
+  {
+    SetDisplayTexture(m_private_display_texture.get(), 0, 0, m_private_display_texture->GetWidth(),
+                      m_private_display_texture->GetHeight());
+    return false;
+  }
+
+  // The dirty region can be cleared in full here; anything outside the current source which is later displayed
+  // will force a copy through the parameter comparison above.
+  m_backend.ClearVRAMDirtyRectangle();
+  if (m_remaining_scanout_copies > 0)
+    m_remaining_scanout_copies--;
+  return true;
+}
+
 template<GPUTexture::Format out_format, typename out_type>
 static void CopyOutRow16(const u16* src_ptr, out_type* dst_ptr, u32 width);
 
@@ -241,14 +309,96 @@ ALWAYS_INLINE void CopyOutRow16<GPUTexture::Format::RGB565, u16>(const u16* src_
 template<>
 ALWAYS_INLINE void CopyOutRow16<GPUTexture::Format::RGBA8, u32>(const u16* src_ptr, u32* dst_ptr, u32 width)
 {
-  for (u32 col = 0; col < width; col++)
+  u32 col = 0;
+
+#if defined(CPU_X64)
+  const u32 aligned_width = Common::AlignDownPow2(width, 8);
+  for (; col < aligned_width; col += 8)
+  {
+    const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_ptr));
+    src_ptr += 8;
+
+    // Build the low (r|g<<8) and high (b|a<<24) halves of each output pixel in 16-bit lanes, then interleave.
+    const __m128i rg =
+      _mm_or_si128(_mm_slli_epi16(_mm_and_si128(value, _mm_set1_epi16(0x1F)), 3),
+                   _mm_slli_epi16(_mm_and_si128(value, _mm_set1_epi16(static_cast<s16>(0x3E0))), 6));
+    const __m128i ba =
+      _mm_or_si128(_mm_srli_epi16(_mm_and_si128(value, _mm_set1_epi16(static_cast<s16>(0x7C00))), 7),
+                   _mm_and_si128(_mm_srai_epi16(value, 15), _mm_set1_epi16(static_cast<s16>(0xFF00))));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_ptr), _mm_unpacklo_epi16(rg, ba));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_ptr + 4), _mm_unpackhi_epi16(rg, ba));
+    dst_ptr += 8;
+  }
+#elif defined(CPU_AARCH64)
+  const u32 aligned_width = Common::AlignDownPow2(width, 8);
+  for (; col < aligned_width; col += 8)
+  {
+    const uint16x8_t value = vld1q_u16(src_ptr);
+    src_ptr += 8;
+
+    // Build the low (r|g<<8) and high (b|a<<24) halves of each output pixel in 16-bit lanes, then interleave.
+    const uint16x8_t rg = vorrq_u16(vshlq_n_u16(vandq_u16(value, vdupq_n_u16(0x1F)), 3),
+                                    vshlq_n_u16(vandq_u16(value, vdupq_n_u16(0x3E0)), 6));
+    const uint16x8_t ba =
+      vorrq_u16(vshrq_n_u16(vandq_u16(value, vdupq_n_u16(0x7C00)), 7),
+                vandq_u16(vreinterpretq_u16_s16(vshrq_n_s16(vreinterpretq_s16_u16(value), 15)), vdupq_n_u16(0xFF00)));
+
+    const uint16x8x2_t interleaved = vzipq_u16(rg, ba);
+    vst1q_u16(reinterpret_cast<u16*>(dst_ptr), interleaved.val[0]);
+    vst1q_u16(reinterpret_cast<u16*>(dst_ptr + 4), interleaved.val[1]);
+    dst_ptr += 8;
+  }
+#endif
+
+  for (; col < width; col++)
     *(dst_ptr++) = VRAM16ToOutput<GPUTexture::Format::RGBA8, u32>(*(src_ptr++));
 }
 
 template<>
 ALWAYS_INLINE void CopyOutRow16<GPUTexture::Format::BGRA8, u32>(const u16* src_ptr, u32* dst_ptr, u32 width)
 {
-  for (u32 col = 0; col < width; col++)
+  u32 col = 0;
+
+#if defined(CPU_X64)
+  const u32 aligned_width = Common::AlignDownPow2(width, 8);
+  for (; col < aligned_width; col += 8)
+  {
+    const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src_ptr));
+    src_ptr += 8;
+
+    // Build the low (b|g<<8) and high (r|0xFF<<24) halves of each output pixel in 16-bit lanes, then interleave.
+    const __m128i bg =
+      _mm_or_si128(_mm_srli_epi16(_mm_and_si128(value, _mm_set1_epi16(static_cast<s16>(0x7C00))), 7),
+                   _mm_slli_epi16(_mm_and_si128(value, _mm_set1_epi16(static_cast<s16>(0x3E0))), 6));
+    const __m128i ra = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(value, _mm_set1_epi16(0x1F)), 3),
+                                    _mm_set1_epi16(static_cast<s16>(0xFF00)));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_ptr), _mm_unpacklo_epi16(bg, ra));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst_ptr + 4), _mm_unpackhi_epi16(bg, ra));
+    dst_ptr += 8;
+  }
+#elif defined(CPU_AARCH64)
+  const u32 aligned_width = Common::AlignDownPow2(width, 8);
+  for (; col < aligned_width; col += 8)
+  {
+    const uint16x8_t value = vld1q_u16(src_ptr);
+    src_ptr += 8;
+
+    // Build the low (b|g<<8) and high (r|0xFF<<24) halves of each output pixel in 16-bit lanes, then interleave.
+    const uint16x8_t bg = vorrq_u16(vshrq_n_u16(vandq_u16(value, vdupq_n_u16(0x7C00)), 7),
+                                    vshlq_n_u16(vandq_u16(value, vdupq_n_u16(0x3E0)), 6));
+    const uint16x8_t ra =
+      vorrq_u16(vshlq_n_u16(vandq_u16(value, vdupq_n_u16(0x1F)), 3), vdupq_n_u16(0xFF00));
+
+    const uint16x8x2_t interleaved = vzipq_u16(bg, ra);
+    vst1q_u16(reinterpret_cast<u16*>(dst_ptr), interleaved.val[0]);
+    vst1q_u16(reinterpret_cast<u16*>(dst_ptr + 4), interleaved.val[1]);
+    dst_ptr += 8;
+  }
+#endif
+
+  for (; col < width; col++)
     *(dst_ptr++) = VRAM16ToOutput<GPUTexture::Format::BGRA8, u32>(*(src_ptr++));
 }
 
@@ -529,39 +679,59 @@ void GPU_SW::UpdateDisplay()
     const u32 display_width = m_crtc_state.display_vram_width;
     const u32 display_height = m_crtc_state.display_vram_height;
 
+    const u32 skip_x = m_crtc_state.display_vram_left - m_crtc_state.regs.X;
+
+    // Conservative source width in halfwords for the 24-bit format, rounding the packed pixels up.
+    const u32 vram_width_24 = ((skip_x + display_width) * 3 + 1) / 2;
+
     if (IsInterlacedDisplayEnabled())
     {
       const u32 field = GetInterlacedDisplayField();
       if (m_GPUSTAT.display_area_color_depth_24)
       {
-        CopyOut24Bit(m_24bit_display_format, m_crtc_state.regs.X, vram_offset_y + field,
-                     m_crtc_state.display_vram_left - m_crtc_state.regs.X, display_width, display_height, field, true,
-                     m_GPUSTAT.vertical_resolution);
+        if (IsScanoutDirty(m_crtc_state.regs.X, vram_offset_y, vram_width_24, display_height, true, true,
+                           m_GPUSTAT.vertical_resolution, m_24bit_display_format))
+        {
+          CopyOut24Bit(m_24bit_display_format, m_crtc_state.regs.X, vram_offset_y + field, skip_x, display_width,
+                       display_height, field, true, m_GPUSTAT.vertical_resolution);
+        }
       }
       else
       {
-        CopyOut15Bit(m_16bit_display_format, m_crtc_state.display_vram_left, vram_offset_y + field, display_width,
-                     display_height, field, true, m_GPUSTAT.vertical_resolution);
+        if (IsScanoutDirty(m_crtc_state.display_vram_left, vram_offset_y, display_width, display_height, false, true,
+                           m_GPUSTAT.vertical_resolution, m_16bit_display_format))
+        {
+          CopyOut15Bit(m_16bit_display_format, m_crtc_state.display_vram_left, vram_offset_y + field, display_width,
+                       display_height, field, true, m_GPUSTAT.vertical_resolution);
+        }
       }
     }
     else
     {
       if (m_GPUSTAT.display_area_color_depth_24)
       {
-        CopyOut24Bit(m_24bit_display_format, m_crtc_state.regs.X, vram_offset_y,
-                     m_crtc_state.display_vram_left - m_crtc_state.regs.X, display_width, display_height, 0, false,
-                     false);
+        if (IsScanoutDirty(m_crtc_state.regs.X, vram_offset_y, vram_width_24, display_height, true, false, false,
+                           m_24bit_display_format))
+        {
+          CopyOut24Bit(m_24bit_display_format, m_crtc_state.regs.X, vram_offset_y, skip_x, display_width,
+                       display_height, 0, false, false);
+        }
       }
       else
       {
-        CopyOut15Bit(m_16bit_display_format, m_crtc_state.display_vram_left, vram_offset_y, display_width,
-                     display_height, 0, false, false);
+        if (IsScanoutDirty(m_crtc_state.display_vram_left, vram_offset_y, display_width, display_height, false, false,
+                           false, m_16bit_display_format))
+        {
+          CopyOut15Bit(m_16bit_display_format, m_crtc_state.display_vram_left, vram_offset_y, display_width,
+                       display_height, 0, false, false);
+        }
       }
     }
   }
   else
   {
-    CopyOut15Bit(m_16bit_display_format, 0, 0, VRAM_WIDTH, VRAM_HEIGHT, 0, false, false);
+    if (IsScanoutDirty(0, 0, VRAM_WIDTH, VRAM_HEIGHT, false, false, false, m_16bit_display_format))
+      CopyOut15Bit(m_16bit_display_format, 0, 0, VRAM_WIDTH, VRAM_HEIGHT, 0, false, false);
     SetDisplayParameters(VRAM_WIDTH, VRAM_HEIGHT, 0, 0, VRAM_WIDTH, VRAM_HEIGHT,
                          static_cast<float>(VRAM_WIDTH) / static_cast<float>(VRAM_HEIGHT));
   }
@@ -26,6 +26,7 @@ public:
   ~GPU_SW() override;
 
   ALWAYS_INLINE const GPU_SW_Backend& GetBackend() const { return m_backend; }
+  ALWAYS_INLINE GPU_SW_Backend& GetBackend() { return m_backend; }
 
   const Threading::Thread* GetSWThread() const override;
   bool IsHardwareRenderer() const override;
@@ -57,15 +58,36 @@ protected:
 
   void DispatchRenderCommand() override;
 
+  void DrawRendererStats(bool is_idle_frame) override;
+
   void FillBackendCommandParameters(GPUBackendCommand* cmd) const;
   void FillDrawCommand(GPUBackendDrawCommand* cmd, GPURenderCommand rc) const;
 
   GPUTexture* GetDisplayTexture(u32 width, u32 height, GPUTexture::Format format);
 
+  /// Returns true if the scanout conversion has to be re-run, i.e. the source parameters changed or the backend
+  /// touched the source VRAM region since the last copy-out. When false, re-presents the cached display texture.
+  bool IsScanoutDirty(u32 src_x, u32 src_y, u32 width, u32 height, bool depth_24, bool interlaced, bool interleaved,
+                      GPUTexture::Format format);
+
   FixedHeapArray<u8, GPU_MAX_DISPLAY_WIDTH * GPU_MAX_DISPLAY_HEIGHT * sizeof(u32)> m_display_texture_buffer;
   GPUTexture::Format m_16bit_display_format = GPUTexture::Format::RGB565;
   GPUTexture::Format m_24bit_display_format = GPUTexture::Format::RGBA8;
   std::unique_ptr<GPUTexture> m_private_display_texture; // TODO: Move to base.
 
   GPU_SW_Backend m_backend;
+
+  // Source parameters of the last scanout, used together with the backend's VRAM dirty rectangle to skip the
+  // conversion entirely when nothing which affects the display has changed.
+  struct ScanoutSource
+  {
+    u32 src_x, src_y, width, height;
+    bool depth_24, interlaced, interleaved;
+    GPUTexture::Format format;
+    bool valid;
+  } m_last_scanout = {};
+  u32 m_remaining_scanout_copies = 0;
+
+  u32 m_last_wakeup_count = 0;
+  u32 m_last_peak_command_size = 0;
 };
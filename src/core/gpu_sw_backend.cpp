@@ -6,18 +6,55 @@
 
 #include "util/gpu_device.h"
 
+#include "common/align.h"
+
 #include <algorithm>
 
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#if defined(CPU_X64)
+#include <emmintrin.h>
+#elif defined(CPU_AARCH64)
+#ifdef _MSC_VER
+#include <arm64_neon.h>
+#else
+#include <arm_neon.h>
+#endif
+#endif
+
 GPU_SW_Backend::GPU_SW_Backend() : GPUBackend()
 {
-  m_vram.fill(0);
-  m_vram_ptr = m_vram.data();
+  // Size and align the framebuffer allocation to 2MB so the OS can back it with a single huge page, keeping
+  // texture fetches with high texcoord variance from thrashing the TLB. VRAM itself is only 1MB.
+  constexpr size_t VRAM_ALLOC_SIZE = 2 * 1024 * 1024;
+  static_assert(sizeof(u16) * VRAM_WIDTH * VRAM_HEIGHT <= VRAM_ALLOC_SIZE);
+  m_vram = static_cast<u16*>(Common::AlignedMalloc(VRAM_ALLOC_SIZE, VRAM_ALLOC_SIZE));
+#ifdef __linux__
+  madvise(m_vram, VRAM_ALLOC_SIZE, MADV_HUGEPAGE);
+#endif
+
+  std::fill_n(m_vram, VRAM_WIDTH * VRAM_HEIGHT, u16(0));
+  m_vram_ptr = m_vram;
 }
 
-GPU_SW_Backend::~GPU_SW_Backend() = default;
+GPU_SW_Backend::~GPU_SW_Backend()
+{
+  Common::AlignedFree(m_vram);
+}
 
 bool GPU_SW_Backend::Initialize(bool force_thread)
 {
+  // Shade large triangles across a worker pool on wider machines. Leave a couple of cores free for the
+  // CPU/SPU/GPU threads; on narrow machines the scheduling overhead isn't worth it.
+  const u32 num_cores = cb::ThreadPool::GetNumLogicalCores();
+  if (num_cores >= 6)
+  {
+    m_num_rasterizer_threads = std::min<u32>(num_cores - 2, 8);
+    m_rasterizer_thread_pool = std::make_unique<cb::ThreadPool>(static_cast<int>(m_num_rasterizer_threads));
+  }
+
   return GPUBackend::Initialize(force_thread);
 }
 
@@ -26,7 +63,37 @@ void GPU_SW_Backend::Reset(bool clear_vram)
   GPUBackend::Reset(clear_vram);
 
   if (clear_vram)
-    m_vram.fill(0);
+    std::fill_n(m_vram, VRAM_WIDTH * VRAM_HEIGHT, u16(0));
+
+  SetFullVRAMDirtyRectangle();
+}
+
+void GPU_SW_Backend::UpdateCLUTCache(const GPUBackendDrawCommand* cmd)
+{
+  const GPUTextureMode mode = cmd->draw_mode.texture_mode;
+  if (mode != GPUTextureMode::Palette4Bit && mode != GPUTextureMode::Palette8Bit)
+    return;
+
+  const u32 key = ZeroExtend32(cmd->palette.bits) | (static_cast<u32>(mode) << 16);
+  if (key == m_clut_key)
+    return;
+
+  const u32 count = (mode == GPUTextureMode::Palette4Bit) ? 16 : 256;
+  const u32 x_base = cmd->palette.GetXBase();
+  const u32 y_base = cmd->palette.GetYBase();
+  if ((x_base + count) <= VRAM_WIDTH)
+  {
+    std::copy_n(GetPixelPtr(x_base, y_base), count, m_clut.data());
+    m_clut_rect.Set(x_base, y_base, x_base + count, y_base + 1);
+  }
+  else
+  {
+    for (u32 i = 0; i < count; i++)
+      m_clut[i] = GetPixel((x_base + i) % VRAM_WIDTH, y_base);
+    m_clut_rect.Set(0, y_base, VRAM_WIDTH, y_base + 1);
+  }
+
+  m_clut_key = key;
 }
 
 void GPU_SW_Backend::DrawPolygon(const GPUBackendDrawPolygonCommand* cmd)
@@ -34,8 +101,30 @@ void GPU_SW_Backend::DrawPolygon(const GPUBackendDrawPolygonCommand* cmd)
   const GPURenderCommand rc{cmd->rc.bits};
   const bool dithering_enable = rc.IsDitheringEnabled() && cmd->draw_mode.dither_enable;
 
-  const DrawTriangleFunction DrawFunction = GetDrawTriangleFunction(
-    rc.shading_enable, rc.texture_enable, rc.raw_texture_enable, rc.transparency_enable, dithering_enable);
+  if (rc.texture_enable)
+    UpdateCLUTCache(cmd);
+
+  const DrawTriangleFunction DrawFunction =
+    GetDrawTriangleFunction(rc.shading_enable, rc.texture_enable, rc.raw_texture_enable, rc.transparency_enable,
+                            dithering_enable, cmd->params.interlaced_rendering);
+
+  // Bound the touched area for scanout dirty tracking. Only needs to be conservative, not exact.
+  const u32 num_vertices = rc.quad_polygon ? 4 : 3;
+  s32 min_x = cmd->vertices[0].x;
+  s32 max_x = cmd->vertices[0].x;
+  s32 min_y = cmd->vertices[0].y;
+  s32 max_y = cmd->vertices[0].y;
+  for (u32 i = 1; i < num_vertices; i++)
+  {
+    min_x = std::min<s32>(min_x, cmd->vertices[i].x);
+    max_x = std::max<s32>(max_x, cmd->vertices[i].x);
+    min_y = std::min<s32>(min_y, cmd->vertices[i].y);
+    max_y = std::max<s32>(max_y, cmd->vertices[i].y);
+  }
+  MarkVRAMWrite(static_cast<u32>(std::clamp<s32>(min_x, m_drawing_area.left, m_drawing_area.right)),
+                static_cast<u32>(std::clamp<s32>(max_x, m_drawing_area.left, m_drawing_area.right)) + 1u,
+                static_cast<u32>(std::clamp<s32>(min_y, m_drawing_area.top, m_drawing_area.bottom)),
+                static_cast<u32>(std::clamp<s32>(max_y, m_drawing_area.top, m_drawing_area.bottom)) + 1u);
 
   (this->*DrawFunction)(cmd, &cmd->vertices[0], &cmd->vertices[1], &cmd->vertices[2]);
   if (rc.quad_polygon)
@@ -49,14 +138,77 @@ void GPU_SW_Backend::DrawRectangle(const GPUBackendDrawRectangleCommand* cmd)
   const DrawRectangleFunction DrawFunction =
     GetDrawRectangleFunction(rc.texture_enable, rc.raw_texture_enable, rc.transparency_enable);
 
+  if (cmd->rc.texture_enable)
+    UpdateCLUTCache(cmd);
+
+  MarkVRAMWrite(
+    static_cast<u32>(std::clamp<s32>(cmd->x, m_drawing_area.left, m_drawing_area.right)),
+    static_cast<u32>(
+      std::clamp<s32>(cmd->x + static_cast<s32>(cmd->width) - 1, m_drawing_area.left, m_drawing_area.right)) +
+      1u,
+    static_cast<u32>(std::clamp<s32>(cmd->y, m_drawing_area.top, m_drawing_area.bottom)),
+    static_cast<u32>(
+      std::clamp<s32>(cmd->y + static_cast<s32>(cmd->height) - 1, m_drawing_area.top, m_drawing_area.bottom)) +
+      1u);
+
+  // Opaque untextured rectangles with no mask test write the same value to every covered pixel, so they
+  // reduce to row fills. 2D titles issue thousands of these per frame.
+  if (!cmd->rc.texture_enable && !cmd->rc.transparency_enable && !cmd->params.check_mask_before_draw)
+  {
+    FillRectangle(cmd);
+    return;
+  }
+
   (this->*DrawFunction)(cmd);
 }
 
+void GPU_SW_Backend::FillRectangle(const GPUBackendDrawRectangleCommand* cmd)
+{
+  const auto [r, g, b] = UnpackColorRGB24(cmd->color);
+
+  VRAMPixel color;
+  color.SetRGB24(r, g, b);
+  const u16 color16 = color.bits | cmd->params.GetMaskOR();
+
+  const s32 start_x = std::max(cmd->x, static_cast<s32>(m_drawing_area.left));
+  const s32 end_x = std::min(cmd->x + static_cast<s32>(cmd->width), static_cast<s32>(m_drawing_area.right) + 1);
+  if (start_x >= end_x)
+    return;
+
+  for (u32 offset_y = 0; offset_y < cmd->height; offset_y++)
+  {
+    const s32 y = cmd->y + static_cast<s32>(offset_y);
+    if (y < static_cast<s32>(m_drawing_area.top) || y > static_cast<s32>(m_drawing_area.bottom) ||
+        (cmd->params.interlaced_rendering && cmd->params.active_line_lsb == (Truncate8(static_cast<u32>(y)) & 1u)))
+    {
+      continue;
+    }
+
+    std::fill_n(GetPixelPtr(static_cast<u32>(start_x), static_cast<u32>(y)), end_x - start_x, color16);
+  }
+}
+
 void GPU_SW_Backend::DrawLine(const GPUBackendDrawLineCommand* cmd)
 {
   const DrawLineFunction DrawFunction =
     GetDrawLineFunction(cmd->rc.shading_enable, cmd->rc.transparency_enable, cmd->IsDitheringEnabled());
 
+  s32 min_x = cmd->vertices[0].x;
+  s32 max_x = cmd->vertices[0].x;
+  s32 min_y = cmd->vertices[0].y;
+  s32 max_y = cmd->vertices[0].y;
+  for (u16 i = 1; i < cmd->num_vertices; i++)
+  {
+    min_x = std::min<s32>(min_x, cmd->vertices[i].x);
+    max_x = std::max<s32>(max_x, cmd->vertices[i].x);
+    min_y = std::min<s32>(min_y, cmd->vertices[i].y);
+    max_y = std::max<s32>(max_y, cmd->vertices[i].y);
+  }
+  MarkVRAMWrite(static_cast<u32>(std::clamp<s32>(min_x, m_drawing_area.left, m_drawing_area.right)),
+                static_cast<u32>(std::clamp<s32>(max_x, m_drawing_area.left, m_drawing_area.right)) + 1u,
+                static_cast<u32>(std::clamp<s32>(min_y, m_drawing_area.top, m_drawing_area.bottom)),
+                static_cast<u32>(std::clamp<s32>(max_y, m_drawing_area.top, m_drawing_area.bottom)) + 1u);
+
   for (u16 i = 1; i < cmd->num_vertices; i++)
     (this->*DrawFunction)(cmd, &cmd->vertices[i - 1], &cmd->vertices[i]);
 }
@@ -101,8 +253,7 @@ void ALWAYS_INLINE_RELEASE GPU_SW_Backend::ShadePixel(const GPUBackendDrawComman
                    (cmd->draw_mode.GetTexturePageBaseY() + ZeroExtend32(texcoord_y)) % VRAM_HEIGHT);
         const u16 palette_index = (palette_value >> ((texcoord_x % 4) * 4)) & 0x0Fu;
 
-        texture_color.bits =
-          GetPixel((cmd->palette.GetXBase() + ZeroExtend32(palette_index)) % VRAM_WIDTH, cmd->palette.GetYBase());
+        texture_color.bits = m_clut[palette_index];
       }
       break;
 
@@ -112,8 +263,7 @@ void ALWAYS_INLINE_RELEASE GPU_SW_Backend::ShadePixel(const GPUBackendDrawComman
           GetPixel((cmd->draw_mode.GetTexturePageBaseX() + ZeroExtend32(texcoord_x / 2)) % VRAM_WIDTH,
                    (cmd->draw_mode.GetTexturePageBaseY() + ZeroExtend32(texcoord_y)) % VRAM_HEIGHT);
         const u16 palette_index = (palette_value >> ((texcoord_x % 2) * 8)) & 0xFFu;
-        texture_color.bits =
-          GetPixel((cmd->palette.GetXBase() + ZeroExtend32(palette_index)) % VRAM_WIDTH, cmd->palette.GetYBase());
+        texture_color.bits = m_clut[palette_index];
       }
       break;
 
@@ -362,14 +512,198 @@ void ALWAYS_INLINE_RELEASE GPU_SW_Backend::AddIDeltas_DY(i_group& ig, const i_de
   }
 }
 
+#if defined(CPU_X64) || defined(CPU_AARCH64)
+
+template<bool shading_enable, bool dithering_enable>
+void GPU_SW_Backend::ShadeSpanUntexturedOpaque(const GPUBackendDrawCommand* cmd, u32 x, u32 y, u32 width, i_group ig,
+                                               const i_deltas& idl)
+{
+  // The span has already been clipped to the drawing area, so the row never wraps around VRAM.
+  u16* row_ptr = GetPixelPtr(x, y);
+  const u16 mask_and = cmd->params.GetMaskAND();
+  const u16 mask_or = cmd->params.GetMaskOR();
+  const u32 start_x = x;
+
+  // Per-lane dither offsets. The matrix pattern repeats every four pixels and we step eight pixels per
+  // iteration, so this vector is constant for the whole span. Matches the non-dithered LUT slot otherwise.
+  s16 dither[8];
+  for (u32 i = 0; i < 8; i++)
+    dither[i] = static_cast<s16>(dithering_enable ? DITHER_MATRIX[y & 3u][(x + i) & 3u] : DITHER_MATRIX[2][3]);
+
+#if defined(CPU_X64)
+  const __m128i dither_vec = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dither));
+  const __m128i mask_and_vec = _mm_set1_epi16(static_cast<s16>(mask_and));
+  const __m128i mask_or_vec = _mm_set1_epi16(static_cast<s16>(mask_or));
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i max_color = _mm_set1_epi16(0x1F);
+
+  // Applies the dither offset and converts an 8-bit channel to a clamped 5-bit channel, as per the dither LUT.
+  const auto dither_channel = [&dither_vec, &zero, &max_color](__m128i value) {
+    value = _mm_max_epi16(_mm_add_epi16(value, dither_vec), zero);
+    return _mm_min_epi16(_mm_srli_epi16(value, 3), max_color);
+  };
+
+  // Fixed-point color accumulators for lanes 0-3 and 4-7, stepped by eight pixels per iteration.
+  const auto make_lanes = [](u32 base, u32 step, __m128i& lo, __m128i& hi) {
+    lo = _mm_setr_epi32(static_cast<int>(base), static_cast<int>(base + step), static_cast<int>(base + step * 2),
+                        static_cast<int>(base + step * 3));
+    hi = _mm_setr_epi32(static_cast<int>(base + step * 4), static_cast<int>(base + step * 5),
+                        static_cast<int>(base + step * 6), static_cast<int>(base + step * 7));
+  };
+  const auto pack_lanes = [](__m128i lo, __m128i hi) {
+    return _mm_packs_epi32(_mm_srli_epi32(lo, COORD_FBS + COORD_POST_PADDING),
+                           _mm_srli_epi32(hi, COORD_FBS + COORD_POST_PADDING));
+  };
+
+  __m128i r_lo, r_hi, g_lo, g_hi, b_lo, b_hi, r_step, g_step, b_step;
+  __m128i flat_fg = zero;
+  if constexpr (shading_enable)
+  {
+    make_lanes(ig.r, idl.dr_dx, r_lo, r_hi);
+    make_lanes(ig.g, idl.dg_dx, g_lo, g_hi);
+    make_lanes(ig.b, idl.db_dx, b_lo, b_hi);
+    r_step = _mm_set1_epi32(static_cast<int>(idl.dr_dx * 8));
+    g_step = _mm_set1_epi32(static_cast<int>(idl.dg_dx * 8));
+    b_step = _mm_set1_epi32(static_cast<int>(idl.db_dx * 8));
+  }
+  else
+  {
+    const __m128i r = dither_channel(_mm_set1_epi16(static_cast<s16>(ig.r >> (COORD_FBS + COORD_POST_PADDING))));
+    const __m128i g = dither_channel(_mm_set1_epi16(static_cast<s16>(ig.g >> (COORD_FBS + COORD_POST_PADDING))));
+    const __m128i b = dither_channel(_mm_set1_epi16(static_cast<s16>(ig.b >> (COORD_FBS + COORD_POST_PADDING))));
+    flat_fg = _mm_or_si128(_mm_or_si128(r, _mm_slli_epi16(g, 5)), _mm_slli_epi16(b, 10));
+  }
+
+  while (width >= 8)
+  {
+    __m128i fg;
+    if constexpr (shading_enable)
+    {
+      const __m128i r = dither_channel(pack_lanes(r_lo, r_hi));
+      const __m128i g = dither_channel(pack_lanes(g_lo, g_hi));
+      const __m128i b = dither_channel(pack_lanes(b_lo, b_hi));
+      fg = _mm_or_si128(_mm_or_si128(r, _mm_slli_epi16(g, 5)), _mm_slli_epi16(b, 10));
+      r_lo = _mm_add_epi32(r_lo, r_step);
+      r_hi = _mm_add_epi32(r_hi, r_step);
+      g_lo = _mm_add_epi32(g_lo, g_step);
+      g_hi = _mm_add_epi32(g_hi, g_step);
+      b_lo = _mm_add_epi32(b_lo, b_step);
+      b_hi = _mm_add_epi32(b_hi, b_step);
+    }
+    else
+    {
+      fg = flat_fg;
+    }
+
+    const __m128i bg = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row_ptr));
+    const __m128i writable = _mm_cmpeq_epi16(_mm_and_si128(bg, mask_and_vec), zero);
+    const __m128i result =
+      _mm_or_si128(_mm_and_si128(writable, _mm_or_si128(fg, mask_or_vec)), _mm_andnot_si128(writable, bg));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(row_ptr), result);
+
+    row_ptr += 8;
+    x += 8;
+    width -= 8;
+  }
+#elif defined(CPU_AARCH64)
+  const int16x8_t dither_vec = vld1q_s16(dither);
+  const uint16x8_t mask_and_vec = vdupq_n_u16(mask_and);
+  const uint16x8_t mask_or_vec = vdupq_n_u16(mask_or);
+  const int16x8_t max_color = vdupq_n_s16(0x1F);
+
+  // Applies the dither offset and converts an 8-bit channel to a clamped 5-bit channel, as per the dither LUT.
+  const auto dither_channel = [&dither_vec, &max_color](uint16x8_t value) {
+    int16x8_t sval = vmaxq_s16(vaddq_s16(vreinterpretq_s16_u16(value), dither_vec), vdupq_n_s16(0));
+    return vreinterpretq_u16_s16(vminq_s16(vshrq_n_s16(sval, 3), max_color));
+  };
+
+  // Fixed-point color accumulators for lanes 0-3 and 4-7, stepped by eight pixels per iteration.
+  const auto make_lanes = [](u32 base, u32 step, uint32x4_t& lo, uint32x4_t& hi) {
+    const u32 lo_vals[4] = {base, base + step, base + step * 2, base + step * 3};
+    const u32 hi_vals[4] = {base + step * 4, base + step * 5, base + step * 6, base + step * 7};
+    lo = vld1q_u32(lo_vals);
+    hi = vld1q_u32(hi_vals);
+  };
+  const auto pack_lanes = [](uint32x4_t lo, uint32x4_t hi) {
+    return vcombine_u16(vmovn_u32(vshrq_n_u32(lo, COORD_FBS + COORD_POST_PADDING)),
+                        vmovn_u32(vshrq_n_u32(hi, COORD_FBS + COORD_POST_PADDING)));
+  };
+
+  uint32x4_t r_lo, r_hi, g_lo, g_hi, b_lo, b_hi;
+  uint32x4_t r_step, g_step, b_step;
+  uint16x8_t flat_fg = vdupq_n_u16(0);
+  if constexpr (shading_enable)
+  {
+    make_lanes(ig.r, idl.dr_dx, r_lo, r_hi);
+    make_lanes(ig.g, idl.dg_dx, g_lo, g_hi);
+    make_lanes(ig.b, idl.db_dx, b_lo, b_hi);
+    r_step = vdupq_n_u32(idl.dr_dx * 8);
+    g_step = vdupq_n_u32(idl.dg_dx * 8);
+    b_step = vdupq_n_u32(idl.db_dx * 8);
+  }
+  else
+  {
+    const uint16x8_t r = dither_channel(vdupq_n_u16(Truncate16(ig.r >> (COORD_FBS + COORD_POST_PADDING))));
+    const uint16x8_t g = dither_channel(vdupq_n_u16(Truncate16(ig.g >> (COORD_FBS + COORD_POST_PADDING))));
+    const uint16x8_t b = dither_channel(vdupq_n_u16(Truncate16(ig.b >> (COORD_FBS + COORD_POST_PADDING))));
+    flat_fg = vorrq_u16(vorrq_u16(r, vshlq_n_u16(g, 5)), vshlq_n_u16(b, 10));
+  }
+
+  while (width >= 8)
+  {
+    uint16x8_t fg;
+    if constexpr (shading_enable)
+    {
+      const uint16x8_t r = dither_channel(pack_lanes(r_lo, r_hi));
+      const uint16x8_t g = dither_channel(pack_lanes(g_lo, g_hi));
+      const uint16x8_t b = dither_channel(pack_lanes(b_lo, b_hi));
+      fg = vorrq_u16(vorrq_u16(r, vshlq_n_u16(g, 5)), vshlq_n_u16(b, 10));
+      r_lo = vaddq_u32(r_lo, r_step);
+      r_hi = vaddq_u32(r_hi, r_step);
+      g_lo = vaddq_u32(g_lo, g_step);
+      g_hi = vaddq_u32(g_hi, g_step);
+      b_lo = vaddq_u32(b_lo, b_step);
+      b_hi = vaddq_u32(b_hi, b_step);
+    }
+    else
+    {
+      fg = flat_fg;
+    }
+
+    const uint16x8_t bg = vld1q_u16(row_ptr);
+    const uint16x8_t writable = vceqq_u16(vandq_u16(bg, mask_and_vec), vdupq_n_u16(0));
+    vst1q_u16(row_ptr, vbslq_u16(writable, vorrq_u16(fg, mask_or_vec), bg));
+
+    row_ptr += 8;
+    x += 8;
+    width -= 8;
+  }
+#endif
+
+  if (width == 0)
+    return;
+
+  AddIDeltas_DX<shading_enable, false>(ig, idl, x - start_x);
+  do
+  {
+    ShadePixel<false, false, false, dithering_enable>(
+      cmd, x, y, Truncate8(ig.r >> (COORD_FBS + COORD_POST_PADDING)),
+      Truncate8(ig.g >> (COORD_FBS + COORD_POST_PADDING)), Truncate8(ig.b >> (COORD_FBS + COORD_POST_PADDING)), 0, 0);
+
+    x++;
+    AddIDeltas_DX<shading_enable, false>(ig, idl);
+  } while (--width > 0);
+}
+
+#endif // defined(CPU_X64) || defined(CPU_AARCH64)
+
 template<bool shading_enable, bool texture_enable, bool raw_texture_enable, bool transparency_enable,
-         bool dithering_enable>
+         bool dithering_enable, bool interlacing_enable>
 void GPU_SW_Backend::DrawSpan(const GPUBackendDrawPolygonCommand* cmd, s32 y, s32 x_start, s32 x_bound, i_group ig,
                               const i_deltas& idl)
 {
-  if (cmd->params.interlaced_rendering && cmd->params.active_line_lsb == (Truncate8(static_cast<u32>(y)) & 1u))
-    return;
-
+  // Inactive-field rows are skipped in DrawTriangleHalf() when interlacing is enabled, so every span which
+  // reaches this point gets shaded.
   s32 x_ig_adjust = x_start;
   s32 w = x_bound - x_start;
   s32 x = TruncateGPUVertexPosition(x_start);
@@ -391,6 +725,16 @@ void GPU_SW_Backend::DrawSpan(const GPUBackendDrawPolygonCommand* cmd, s32 y, s3
   AddIDeltas_DX<shading_enable, texture_enable>(ig, idl, x_ig_adjust);
   AddIDeltas_DY<shading_enable, texture_enable>(ig, idl, y);
 
+#if defined(CPU_X64) || defined(CPU_AARCH64)
+  // Untextured opaque pixels have no texture fetch, semi-transparency or early-out, so shade them eight at a time.
+  if constexpr (!texture_enable && !transparency_enable)
+  {
+    ShadeSpanUntexturedOpaque<shading_enable, dithering_enable>(cmd, static_cast<u32>(x), static_cast<u32>(y),
+                                                                static_cast<u32>(w), ig, idl);
+    return;
+  }
+#endif
+
   do
   {
     const u32 r = ig.r >> (COORD_FBS + COORD_POST_PADDING);
@@ -409,7 +753,7 @@ void GPU_SW_Backend::DrawSpan(const GPUBackendDrawPolygonCommand* cmd, s32 y, s3
 }
 
 template<bool shading_enable, bool texture_enable, bool raw_texture_enable, bool transparency_enable,
-         bool dithering_enable>
+         bool dithering_enable, bool interlacing_enable>
 void GPU_SW_Backend::DrawTriangle(const GPUBackendDrawPolygonCommand* cmd,
                                   const GPUBackendDrawPolygonCommand::Vertex* v0,
                                   const GPUBackendDrawPolygonCommand::Vertex* v1,
@@ -549,55 +893,141 @@ void GPU_SW_Backend::DrawTriangle(const GPUBackendDrawPolygonCommand* cmd,
 
   for (u32 i = 0; i < 2; i++)
   {
-    s32 yi = tripart[i].y_coord;
-    s32 yb = tripart[i].y_bound;
+    const s32 yi = tripart[i].y_coord;
+    const s32 yb = tripart[i].y_bound;
+
+    const u64 lc = tripart[i].x_coord[0];
+    const u64 ls = tripart[i].x_step[0];
+
+    const u64 rc = tripart[i].x_coord[1];
+    const u64 rs = tripart[i].x_step[1];
+
+    const bool dec_mode = tripart[i].dec_mode;
+    const u32 rows = static_cast<u32>(dec_mode ? (yi - yb) : (yb - yi));
+
+    // Tall halves are split into row chunks and shaded across the worker pool, with the last chunk shaded on
+    // this thread. Each chunk rejects rows outside the drawing area itself, the same as the serial loop.
+    constexpr u32 MIN_PARALLEL_ROWS = 32;
+    if (m_rasterizer_thread_pool && rows >= MIN_PARALLEL_ROWS)
+    {
+      const u32 num_chunks = std::min(m_num_rasterizer_threads + 1, rows / (MIN_PARALLEL_ROWS / 2));
+      std::array<std::future<void>, 8> futures;
+      u32 num_futures = 0;
+
+      u32 start = 0;
+      for (u32 chunk = 0; chunk < num_chunks; chunk++)
+      {
+        const u32 end = (chunk == (num_chunks - 1)) ? rows : (start + (rows / num_chunks));
+        const s32 chunk_yi = dec_mode ? (yi - static_cast<s32>(start)) : (yi + static_cast<s32>(start));
+        const s32 chunk_yb = dec_mode ? (yi - static_cast<s32>(end)) : (yi + static_cast<s32>(end));
+        const u64 chunk_lc = dec_mode ? (lc - (ls * start)) : (lc + (ls * start));
+        const u64 chunk_rc = dec_mode ? (rc - (rs * start)) : (rc + (rs * start));
+
+        if (chunk == (num_chunks - 1))
+        {
+          DrawTriangleHalf<shading_enable, texture_enable, raw_texture_enable, transparency_enable, dithering_enable,
+                           interlacing_enable>(cmd, chunk_yi, chunk_yb, chunk_lc, ls, chunk_rc, rs, dec_mode, ig, idl);
+        }
+        else
+        {
+          futures[num_futures++] = m_rasterizer_thread_pool->ScheduleAndGetFuture(
+            [this, cmd, chunk_yi, chunk_yb, chunk_lc, ls, chunk_rc, rs, dec_mode, ig, idl]() {
+              DrawTriangleHalf<shading_enable, texture_enable, raw_texture_enable, transparency_enable,
+                               dithering_enable, interlacing_enable>(cmd, chunk_yi, chunk_yb, chunk_lc, ls, chunk_rc,
+                                                                    rs, dec_mode, ig, idl);
+            });
+        }
 
-    u64 lc = tripart[i].x_coord[0];
-    u64 ls = tripart[i].x_step[0];
+        start = end;
+      }
 
-    u64 rc = tripart[i].x_coord[1];
-    u64 rs = tripart[i].x_step[1];
+      // Draw commands must complete in order, so wait for the workers before returning.
+      for (u32 j = 0; j < num_futures; j++)
+        futures[j].wait();
+    }
+    else
+    {
+      DrawTriangleHalf<shading_enable, texture_enable, raw_texture_enable, transparency_enable, dithering_enable,
+                       interlacing_enable>(cmd, yi, yb, lc, ls, rc, rs, dec_mode, ig, idl);
+    }
+  }
+}
 
-    if (tripart[i].dec_mode)
+template<bool shading_enable, bool texture_enable, bool raw_texture_enable, bool transparency_enable,
+         bool dithering_enable, bool interlacing_enable>
+void GPU_SW_Backend::DrawTriangleHalf(const GPUBackendDrawPolygonCommand* cmd, s32 yi, s32 yb, u64 lc, u64 ls, u64 rc,
+                                      u64 rs, bool dec_mode, i_group ig, const i_deltas& idl)
+{
+  // Vertex position truncation preserves the low bit, so the displayed-field test can be made on yi directly.
+  // Align the first row to the inactive field and step two rows at a time, instead of rejecting every other
+  // span after setting it up.
+  if (dec_mode)
+  {
+    if constexpr (interlacing_enable)
     {
-      while (yi > yb)
+      if ((static_cast<u32>(yi - 1) & 1u) == ZeroExtend32(cmd->params.active_line_lsb.GetValue()))
       {
         yi--;
         lc -= ls;
         rc -= rs;
+      }
+    }
 
-        s32 y = TruncateGPUVertexPosition(yi);
+    while (yi > yb)
+    {
+      yi--;
+      lc -= ls;
+      rc -= rs;
 
-        if (y < static_cast<s32>(m_drawing_area.top))
-          break;
+      s32 y = TruncateGPUVertexPosition(yi);
 
-        if (y > static_cast<s32>(m_drawing_area.bottom))
-          continue;
+      if (y < static_cast<s32>(m_drawing_area.top))
+        break;
 
-        DrawSpan<shading_enable, texture_enable, raw_texture_enable, transparency_enable, dithering_enable>(
-          cmd, yi, GetPolyXFP_Int(lc), GetPolyXFP_Int(rc), ig, idl);
+      if (y <= static_cast<s32>(m_drawing_area.bottom))
+      {
+        DrawSpan<shading_enable, texture_enable, raw_texture_enable, transparency_enable, dithering_enable,
+                 interlacing_enable>(cmd, yi, GetPolyXFP_Int(lc), GetPolyXFP_Int(rc), ig, idl);
+      }
+
+      if constexpr (interlacing_enable)
+      {
+        yi--;
+        lc -= ls;
+        rc -= rs;
       }
     }
-    else
+  }
+  else
+  {
+    if constexpr (interlacing_enable)
     {
-      while (yi < yb)
+      if ((static_cast<u32>(yi) & 1u) == ZeroExtend32(cmd->params.active_line_lsb.GetValue()))
       {
-        s32 y = TruncateGPUVertexPosition(yi);
+        yi++;
+        lc += ls;
+        rc += rs;
+      }
+    }
 
-        if (y > static_cast<s32>(m_drawing_area.bottom))
-          break;
+    while (yi < yb)
+    {
+      s32 y = TruncateGPUVertexPosition(yi);
 
-        if (y >= static_cast<s32>(m_drawing_area.top))
-        {
+      if (y > static_cast<s32>(m_drawing_area.bottom))
+        break;
 
-          DrawSpan<shading_enable, texture_enable, raw_texture_enable, transparency_enable, dithering_enable>(
-            cmd, yi, GetPolyXFP_Int(lc), GetPolyXFP_Int(rc), ig, idl);
-        }
+      if (y >= static_cast<s32>(m_drawing_area.top))
+      {
 
-        yi++;
-        lc += ls;
-        rc += rs;
+        DrawSpan<shading_enable, texture_enable, raw_texture_enable, transparency_enable, dithering_enable,
+                 interlacing_enable>(cmd, yi, GetPolyXFP_Int(lc), GetPolyXFP_Int(rc), ig, idl);
       }
+
+      constexpr s32 y_step = interlacing_enable ? 2 : 1;
+      yi += y_step;
+      lc += ls * static_cast<u32>(y_step);
+      rc += rs * static_cast<u32>(y_step);
     }
   }
 }
@@ -722,6 +1152,11 @@ void GPU_SW_Backend::DrawLine(const GPUBackendDrawLineCommand* cmd, const GPUBac
 
 void GPU_SW_Backend::FillVRAM(u32 x, u32 y, u32 width, u32 height, u32 color, GPUBackendCommandParameters params)
 {
+  if ((x + width) > VRAM_WIDTH || (y + height) > VRAM_HEIGHT)
+    SetFullVRAMDirtyRectangle();
+  else
+    MarkVRAMWrite(x, x + width, y, y + height);
+
   const u16 color16 = VRAMRGBA8888ToRGBA5551(color);
   if ((x + width) <= VRAM_WIDTH && !params.interlaced_rendering)
   {
@@ -767,6 +1202,11 @@ void GPU_SW_Backend::FillVRAM(u32 x, u32 y, u32 width, u32 height, u32 color, GP
 void GPU_SW_Backend::UpdateVRAM(u32 x, u32 y, u32 width, u32 height, const void* data,
                                 GPUBackendCommandParameters params)
 {
+  if ((x + width) > VRAM_WIDTH || (y + height) > VRAM_HEIGHT)
+    SetFullVRAMDirtyRectangle();
+  else
+    MarkVRAMWrite(x, x + width, y, y + height);
+
   // Fast path when the copy is not oversized.
   if ((x + width) <= VRAM_WIDTH && (y + height) <= VRAM_HEIGHT && !params.IsMaskingEnabled())
   {
@@ -803,6 +1243,11 @@ void GPU_SW_Backend::UpdateVRAM(u32 x, u32 y, u32 width, u32 height, const void*
 void GPU_SW_Backend::CopyVRAM(u32 src_x, u32 src_y, u32 dst_x, u32 dst_y, u32 width, u32 height,
                               GPUBackendCommandParameters params)
 {
+  if ((dst_x + width) > VRAM_WIDTH || (dst_y + height) > VRAM_HEIGHT)
+    SetFullVRAMDirtyRectangle();
+  else
+    MarkVRAMWrite(dst_x, dst_x + width, dst_y, dst_y + height);
+
   // Break up oversized copies. This behavior has not been verified on console.
   if ((src_x + width) > VRAM_WIDTH || (dst_x + width) > VRAM_WIDTH)
   {
@@ -905,42 +1350,75 @@ GPU_SW_Backend::GetDrawRectangleFunction(bool texture_enable, bool raw_texture_e
 GPU_SW_Backend::DrawTriangleFunction GPU_SW_Backend::GetDrawTriangleFunction(bool shading_enable, bool texture_enable,
                                                                              bool raw_texture_enable,
                                                                              bool transparency_enable,
-                                                                             bool dithering_enable)
-{
-  static constexpr DrawTriangleFunction funcs[2][2][2][2][2] = {
-    {{{{&GPU_SW_Backend::DrawTriangle<false, false, false, false, false>,
-        &GPU_SW_Backend::DrawTriangle<false, false, false, false, true>},
-       {&GPU_SW_Backend::DrawTriangle<false, false, false, true, false>,
-        &GPU_SW_Backend::DrawTriangle<false, false, false, true, true>}},
-      {{&GPU_SW_Backend::DrawTriangle<false, false, false, false, false>,
-        &GPU_SW_Backend::DrawTriangle<false, false, false, false, false>},
-       {&GPU_SW_Backend::DrawTriangle<false, false, false, true, false>,
-        &GPU_SW_Backend::DrawTriangle<false, false, false, true, false>}}},
-     {{{&GPU_SW_Backend::DrawTriangle<false, true, false, false, false>,
-        &GPU_SW_Backend::DrawTriangle<false, true, false, false, true>},
-       {&GPU_SW_Backend::DrawTriangle<false, true, false, true, false>,
-        &GPU_SW_Backend::DrawTriangle<false, true, false, true, true>}},
-      {{&GPU_SW_Backend::DrawTriangle<false, true, true, false, false>,
-        &GPU_SW_Backend::DrawTriangle<false, true, true, false, false>},
-       {&GPU_SW_Backend::DrawTriangle<false, true, true, true, false>,
-        &GPU_SW_Backend::DrawTriangle<false, true, true, true, false>}}}},
-    {{{{&GPU_SW_Backend::DrawTriangle<true, false, false, false, false>,
-        &GPU_SW_Backend::DrawTriangle<true, false, false, false, true>},
-       {&GPU_SW_Backend::DrawTriangle<true, false, false, true, false>,
-        &GPU_SW_Backend::DrawTriangle<true, false, false, true, true>}},
-      {{&GPU_SW_Backend::DrawTriangle<true, false, false, false, false>,
-        &GPU_SW_Backend::DrawTriangle<true, false, false, false, false>},
-       {&GPU_SW_Backend::DrawTriangle<true, false, false, true, false>,
-        &GPU_SW_Backend::DrawTriangle<true, false, false, true, false>}}},
-     {{{&GPU_SW_Backend::DrawTriangle<true, true, false, false, false>,
-        &GPU_SW_Backend::DrawTriangle<true, true, false, false, true>},
-       {&GPU_SW_Backend::DrawTriangle<true, true, false, true, false>,
-        &GPU_SW_Backend::DrawTriangle<true, true, false, true, true>}},
-      {{&GPU_SW_Backend::DrawTriangle<true, true, true, false, false>,
-        &GPU_SW_Backend::DrawTriangle<true, true, true, false, false>},
-       {&GPU_SW_Backend::DrawTriangle<true, true, true, true, false>,
-        &GPU_SW_Backend::DrawTriangle<true, true, true, true, false>}}}}};
+                                                                             bool dithering_enable,
+                                                                             bool interlacing_enable)
+{
+  static constexpr DrawTriangleFunction funcs[2][2][2][2][2][2] = {
+    {{{{{&GPU_SW_Backend::DrawTriangle<false, false, false, false, false, false>,
+         &GPU_SW_Backend::DrawTriangle<false, false, false, false, false, true>},
+        {&GPU_SW_Backend::DrawTriangle<false, false, false, false, true, false>,
+         &GPU_SW_Backend::DrawTriangle<false, false, false, false, true, true>}},
+       {{&GPU_SW_Backend::DrawTriangle<false, false, false, true, false, false>,
+         &GPU_SW_Backend::DrawTriangle<false, false, false, true, false, true>},
+        {&GPU_SW_Backend::DrawTriangle<false, false, false, true, true, false>,
+         &GPU_SW_Backend::DrawTriangle<false, false, false, true, true, true>}}},
+      {{{&GPU_SW_Backend::DrawTriangle<false, false, false, false, false, false>,
+         &GPU_SW_Backend::DrawTriangle<false, false, false, false, false, true>},
+        {&GPU_SW_Backend::DrawTriangle<false, false, false, false, false, false>,
+         &GPU_SW_Backend::DrawTriangle<false, false, false, false, false, true>}},
+       {{&GPU_SW_Backend::DrawTriangle<false, false, false, true, false, false>,
+         &GPU_SW_Backend::DrawTriangle<false, false, false, true, false, true>},
+        {&GPU_SW_Backend::DrawTriangle<false, false, false, true, false, false>,
+         &GPU_SW_Backend::DrawTriangle<false, false, false, true, false, true>}}}},
+     {{{{&GPU_SW_Backend::DrawTriangle<false, true, false, false, false, false>,
+         &GPU_SW_Backend::DrawTriangle<false, true, false, false, false, true>},
+        {&GPU_SW_Backend::DrawTriangle<false, true, false, false, true, false>,
+         &GPU_SW_Backend::DrawTriangle<false, true, false, false, true, true>}},
+       {{&GPU_SW_Backend::DrawTriangle<false, true, false, true, false, false>,
+         &GPU_SW_Backend::DrawTriangle<false, true, false, true, false, true>},
+        {&GPU_SW_Backend::DrawTriangle<false, true, false, true, true, false>,
+         &GPU_SW_Backend::DrawTriangle<false, true, false, true, true, true>}}},
+      {{{&GPU_SW_Backend::DrawTriangle<false, true, true, false, false, false>,
+         &GPU_SW_Backend::DrawTriangle<false, true, true, false, false, true>},
+        {&GPU_SW_Backend::DrawTriangle<false, true, true, false, false, false>,
+         &GPU_SW_Backend::DrawTriangle<false, true, true, false, false, true>}},
+       {{&GPU_SW_Backend::DrawTriangle<false, true, true, true, false, false>,
+         &GPU_SW_Backend::DrawTriangle<false, true, true, true, false, true>},
+        {&GPU_SW_Backend::DrawTriangle<false, true, true, true, false, false>,
+         &GPU_SW_Backend::DrawTriangle<false, true, true, true, false, true>}}}}},
+    {{{{{&GPU_SW_Backend::DrawTriangle<true, false, false, false, false, false>,
+         &GPU_SW_Backend::DrawTriangle<true, false, false, false, false, true>},
+        {&GPU_SW_Backend::DrawTriangle<true, false, false, false, true, false>,
+         &GPU_SW_Backend::DrawTriangle<true, false, false, false, true, true>}},
+       {{&GPU_SW_Backend::DrawTriangle<true, false, false, true, false, false>,
+         &GPU_SW_Backend::DrawTriangle<true, false, false, true, false, true>},
+        {&GPU_SW_Backend::DrawTriangle<true, false, false, true, true, false>,
+         &GPU_SW_Backend::DrawTriangle<true, false, false, true, true, true>}}},
+      {{{&GPU_SW_Backend::DrawTriangle<true, false, false, false, false, false>,
+         &GPU_SW_Backend::DrawTriangle<true, false, false, false, false, true>},
+        {&GPU_SW_Backend::DrawTriangle<true, false, false, false, false, false>,
+         &GPU_SW_Backend::DrawTriangle<true, false, false, false, false, true>}},
+       {{&GPU_SW_Backend::DrawTriangle<true, false, false, true, false, false>,
+         &GPU_SW_Backend::DrawTriangle<true, false, false, true, false, true>},
+        {&GPU_SW_Backend::DrawTriangle<true, false, false, true, false, false>,
+         &GPU_SW_Backend::DrawTriangle<true, false, false, true, false, true>}}}},
+     {{{{&GPU_SW_Backend::DrawTriangle<true, true, false, false, false, false>,
+         &GPU_SW_Backend::DrawTriangle<true, true, false, false, false, true>},
+        {&GPU_SW_Backend::DrawTriangle<true, true, false, false, true, false>,
+         &GPU_SW_Backend::DrawTriangle<true, true, false, false, true, true>}},
+       {{&GPU_SW_Backend::DrawTriangle<true, true, false, true, false, false>,
+         &GPU_SW_Backend::DrawTriangle<true, true, false, true, false, true>},
+        {&GPU_SW_Backend::DrawTriangle<true, true, false, true, true, false>,
+         &GPU_SW_Backend::DrawTriangle<true, true, false, true, true, true>}}},
+      {{{&GPU_SW_Backend::DrawTriangle<true, true, true, false, false, false>,
+         &GPU_SW_Backend::DrawTriangle<true, true, true, false, false, true>},
+        {&GPU_SW_Backend::DrawTriangle<true, true, true, false, false, false>,
+         &GPU_SW_Backend::DrawTriangle<true, true, true, false, false, true>}},
+       {{&GPU_SW_Backend::DrawTriangle<true, true, true, true, false, false>,
+         &GPU_SW_Backend::DrawTriangle<true, true, true, true, false, true>},
+        {&GPU_SW_Backend::DrawTriangle<true, true, true, true, false, false>,
+         &GPU_SW_Backend::DrawTriangle<true, true, true, true, false, true>}}}}}};
 
   return funcs[u8(shading_enable)][u8(texture_enable)][u8(raw_texture_enable)][u8(transparency_enable)]
-              [u8(dithering_enable)];
+              [u8(dithering_enable)][u8(interlacing_enable)];
 }
\ No newline at end of file
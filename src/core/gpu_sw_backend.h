@@ -2,8 +2,10 @@
 // SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
 
 #pragma once
+#include "common/thirdparty/thread_pool.h"
 #include "gpu_backend.h"
 #include <array>
+#include <future>
 #include <memory>
 #include <vector>
 
@@ -21,6 +23,16 @@ public:
   ALWAYS_INLINE_RELEASE u16* GetPixelPtr(const u32 x, const u32 y) { return &m_vram[VRAM_WIDTH * y + x]; }
   ALWAYS_INLINE_RELEASE void SetPixel(const u32 x, const u32 y, const u16 value) { m_vram[VRAM_WIDTH * y + x] = value; }
 
+  // Conservative bounding rectangle of all VRAM modified since the last clear. Read by GPU_SW after a sync
+  // to skip the scanout conversion when the display source is unchanged.
+  ALWAYS_INLINE const Common::Rectangle<u32>& GetVRAMDirtyRectangle() const { return m_vram_dirty_rect; }
+  ALWAYS_INLINE void ClearVRAMDirtyRectangle() { m_vram_dirty_rect.SetInvalid(); }
+  ALWAYS_INLINE void SetFullVRAMDirtyRectangle()
+  {
+    m_vram_dirty_rect.Set(0, 0, VRAM_WIDTH, VRAM_HEIGHT);
+    m_clut_key = INVALID_CLUT_KEY;
+  }
+
   // this is actually (31 * 255) >> 4) == 494, but to simplify addressing we use the next power of two (512)
   static constexpr u32 DITHER_LUT_SIZE = 512;
   using DitherLUT = std::array<std::array<std::array<u8, 512>, DITHER_MATRIX_SIZE>, DITHER_MATRIX_SIZE>;
@@ -95,6 +107,18 @@ protected:
   void DrawPolygon(const GPUBackendDrawPolygonCommand* cmd) override;
   void DrawLine(const GPUBackendDrawLineCommand* cmd) override;
   void DrawRectangle(const GPUBackendDrawRectangleCommand* cmd) override;
+
+  /// Expands the VRAM dirty rectangle, and drops the palette snapshot when the write overlaps its source.
+  ALWAYS_INLINE void MarkVRAMWrite(u32 left, u32 right, u32 top, u32 bottom)
+  {
+    m_vram_dirty_rect.Include(left, right, top, bottom);
+    if (m_clut_key != INVALID_CLUT_KEY && m_clut_rect.Intersects(Common::Rectangle<u32>(left, top, right, bottom)))
+      m_clut_key = INVALID_CLUT_KEY;
+  }
+
+  /// Snapshots the active palette for 4-bit/8-bit textured draws, so texel fetches index a local table
+  /// instead of going through VRAM twice. Skipped when the palette and its backing pixels are unchanged.
+  void UpdateCLUTCache(const GPUBackendDrawCommand* cmd);
   void FlushRender() override;
   void DrawingAreaChanged() override;
 
@@ -108,6 +132,9 @@ protected:
   template<bool texture_enable, bool raw_texture_enable, bool transparency_enable>
   void DrawRectangle(const GPUBackendDrawRectangleCommand* cmd);
 
+  /// Fast path for untextured, opaque rectangles without a mask test, which reduce to constant row fills.
+  void FillRectangle(const GPUBackendDrawRectangleCommand* cmd);
+
   using DrawRectangleFunction = void (GPU_SW_Backend::*)(const GPUBackendDrawRectangleCommand* cmd);
   DrawRectangleFunction GetDrawRectangleFunction(bool texture_enable, bool raw_texture_enable,
                                                  bool transparency_enable);
@@ -141,21 +168,39 @@ protected:
   void AddIDeltas_DY(i_group& ig, const i_deltas& idl, u32 count = 1);
 
   template<bool shading_enable, bool texture_enable, bool raw_texture_enable, bool transparency_enable,
-           bool dithering_enable>
+           bool dithering_enable, bool interlacing_enable>
   void DrawSpan(const GPUBackendDrawPolygonCommand* cmd, s32 y, s32 x_start, s32 x_bound, i_group ig,
                 const i_deltas& idl);
 
+#if defined(CPU_X64) || defined(CPU_AARCH64)
+  // Vectorized fast path for untextured opaque spans, which have no per-pixel memory fetches or blending.
+  // Processes eight pixels per iteration with a scalar tail.
+  template<bool shading_enable, bool dithering_enable>
+  void ShadeSpanUntexturedOpaque(const GPUBackendDrawCommand* cmd, u32 x, u32 y, u32 width, i_group ig,
+                                 const i_deltas& idl);
+#endif
+
   template<bool shading_enable, bool texture_enable, bool raw_texture_enable, bool transparency_enable,
-           bool dithering_enable>
+           bool dithering_enable, bool interlacing_enable>
   void DrawTriangle(const GPUBackendDrawPolygonCommand* cmd, const GPUBackendDrawPolygonCommand::Vertex* v0,
                     const GPUBackendDrawPolygonCommand::Vertex* v1, const GPUBackendDrawPolygonCommand::Vertex* v2);
 
+  // Draws the rows [yi, yb) (or (yb, yi] when dec_mode is set) of one triangle half. Each row derives its
+  // state from the absolute x/y position, so disjoint row ranges can be shaded concurrently. When interlacing
+  // is enabled, the loop starts on the first row of the inactive field and steps two rows at a time, instead
+  // of testing and rejecting every other row in DrawSpan().
+  template<bool shading_enable, bool texture_enable, bool raw_texture_enable, bool transparency_enable,
+           bool dithering_enable, bool interlacing_enable>
+  void DrawTriangleHalf(const GPUBackendDrawPolygonCommand* cmd, s32 yi, s32 yb, u64 lc, u64 ls, u64 rc, u64 rs,
+                        bool dec_mode, i_group ig, const i_deltas& idl);
+
   using DrawTriangleFunction = void (GPU_SW_Backend::*)(const GPUBackendDrawPolygonCommand* cmd,
                                                         const GPUBackendDrawPolygonCommand::Vertex* v0,
                                                         const GPUBackendDrawPolygonCommand::Vertex* v1,
                                                         const GPUBackendDrawPolygonCommand::Vertex* v2);
   DrawTriangleFunction GetDrawTriangleFunction(bool shading_enable, bool texture_enable, bool raw_texture_enable,
-                                               bool transparency_enable, bool dithering_enable);
+                                               bool transparency_enable, bool dithering_enable,
+                                               bool interlacing_enable);
 
   template<bool shading_enable, bool transparency_enable, bool dithering_enable>
   void DrawLine(const GPUBackendDrawLineCommand* cmd, const GPUBackendDrawLineCommand::Vertex* p0,
@@ -166,5 +211,22 @@ protected:
                                                     const GPUBackendDrawLineCommand::Vertex* p1);
   DrawLineFunction GetDrawLineFunction(bool shading_enable, bool transparency_enable, bool dithering_enable);
 
-  std::array<u16, VRAM_WIDTH * VRAM_HEIGHT> m_vram;
+  // Allocated 2MB-aligned so the OS can back the framebuffer with a huge page; see the constructor.
+  u16* m_vram = nullptr;
+
+  Common::Rectangle<u32> m_vram_dirty_rect = Common::Rectangle<u32>::FromExtents(0, 0, VRAM_WIDTH, VRAM_HEIGHT);
+
+  static constexpr u32 INVALID_CLUT_KEY = 0xFFFFFFFFu;
+
+  // Decoded palette for the current draw, fitting in eight cache lines. m_clut_key combines the palette
+  // register with the texture mode, and is invalidated by VRAM writes which touch m_clut_rect.
+  alignas(64) std::array<u16, 256> m_clut{};
+  u32 m_clut_key = INVALID_CLUT_KEY;
+  Common::Rectangle<u32> m_clut_rect;
+
+  // Worker pool for shading large triangles across multiple threads. Draw commands are still processed in
+  // order; workers are joined before each DrawPolygon() returns, so only rows within a single triangle half
+  // are ever in flight concurrently.
+  std::unique_ptr<cb::ThreadPool> m_rasterizer_thread_pool;
+  u32 m_num_rasterizer_threads = 1;
 };
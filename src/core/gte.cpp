@@ -14,11 +14,22 @@
 
 #include "common/assert.h"
 #include "common/bitutils.h"
+#include "common/platform.h"
 
 #include <algorithm>
 #include <array>
 #include <numeric>
 
+#if defined(CPU_X64)
+#include <emmintrin.h>
+#elif defined(CPU_AARCH64)
+#ifdef _MSC_VER
+#include <arm64_neon.h>
+#else
+#include <arm_neon.h>
+#endif
+#endif
+
 namespace GTE {
 
 static constexpr s64 MAC0_MIN_VALUE = -(INT64_C(1) << 31);
@@ -175,6 +186,9 @@ void Reset()
 
 bool DoState(StateWrapper& sw)
 {
+  // Materialize the derived error bit so savestates always contain the canonical FLAG value.
+  REGS.FLAG.UpdateError();
+
   sw.DoArray(REGS.r32, NUM_DATA_REGS + NUM_CONTROL_REGS);
   return !sw.HasError();
 }
@@ -249,6 +263,14 @@ u32 ReadRegister(u32 index)
       return ZeroExtend32(r) | (ZeroExtend32(g) << 5) | (ZeroExtend32(b) << 10);
     }
 
+    case 63: // FLAG
+    {
+      // The master error bit is derived from the other bits, and materialized when the register
+      // is actually read instead of at the end of every operation.
+      REGS.FLAG.UpdateError();
+      return REGS.FLAG.bits;
+    }
+
     default:
       return REGS.r32[index];
   }
@@ -475,7 +497,140 @@ ALWAYS_INLINE static u32 UNRDivide(u32 lhs, u32 rhs)
   return std::min<u32>(0x1FFFF, result);
 }
 
-static void MulMatVec(const s16* M_, const s16 Vx, const s16 Vy, const s16 Vz, u8 shift, bool lm)
+#if defined(CPU_X64) || defined(CPU_AARCH64)
+
+// Vectorized core for the translation dot products (RTPS/RTPT and MVMVA with TR/BK). The three MAC
+// lanes run through the 44-bit wrap/flag chain in parallel with branchless overflow detection,
+// instead of six data-dependent range-check branches per vector. Lanes {1,2} share one vector and
+// lane 3 rides in a second with a duplicated (ignored) slot. Flag bits are accumulated directly in
+// FLAG register positions (mac1..3 overflow = bits 30..28, underflow = bits 27..25) and returned
+// for the caller to OR in. The final MAC range check, shift and IR saturation are left to the
+// scalar helpers, which also remain the reference implementation for other architectures.
+
+#if defined(CPU_X64)
+
+// SSE2 lacks 64-bit signed compares; compare the high dwords, and where they are equal, take the
+// borrow of (b - a). Returns a full-width per-lane mask.
+ALWAYS_INLINE static __m128i CmpGt64(const __m128i a, const __m128i b)
+{
+  __m128i m = _mm_and_si128(_mm_cmpeq_epi32(a, b), _mm_sub_epi64(b, a));
+  m = _mm_or_si128(m, _mm_cmpgt_epi32(a, b));
+  m = _mm_shuffle_epi32(m, _MM_SHUFFLE(3, 3, 1, 1));
+  return _mm_srai_epi32(m, 31);
+}
+
+// SSE2 also lacks 64-bit arithmetic shifts; shift in the sign bits manually.
+template<int amount>
+ALWAYS_INLINE static __m128i ShiftRightArithmetic64(const __m128i v)
+{
+  const __m128i sign = _mm_srai_epi32(_mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 1, 1)), 31);
+  return _mm_or_si128(_mm_srli_epi64(v, amount), _mm_slli_epi64(sign, 64 - amount));
+}
+
+ALWAYS_INLINE static void CheckMAC44SIMD(__m128i& flags, const __m128i v01, const __m128i v22)
+{
+  const __m128i max44 = _mm_set1_epi64x(MAC123_MAX_VALUE);
+  const __m128i min44 = _mm_set1_epi64x(MAC123_MIN_VALUE);
+  flags = _mm_or_si128(flags, _mm_and_si128(CmpGt64(v01, max44),
+                                            _mm_set_epi64x(s64(u64(1) << 29), s64(u64(1) << 30))));
+  flags = _mm_or_si128(flags, _mm_and_si128(CmpGt64(min44, v01),
+                                            _mm_set_epi64x(s64(u64(1) << 26), s64(u64(1) << 27))));
+  flags = _mm_or_si128(flags, _mm_and_si128(CmpGt64(v22, max44), _mm_set1_epi64x(s64(u64(1) << 28))));
+  flags = _mm_or_si128(flags, _mm_and_si128(CmpGt64(min44, v22), _mm_set1_epi64x(s64(u64(1) << 25))));
+}
+
+ALWAYS_INLINE static u32 DotProductWithTranslationSIMD(const s16* M_, const s32 T[3], const s16 Vx, const s16 Vy,
+                                                       const s16 Vz, s64 out[3])
+{
+#define M(i, j) M_[((i)*3) + (j)]
+
+  // The products themselves are single scalar multiplies; the vector work is the wrap/flag chain.
+  __m128i v01 =
+    _mm_set_epi64x((s64(T[1]) << 12) + (s64(M(1, 0)) * s64(Vx)), (s64(T[0]) << 12) + (s64(M(0, 0)) * s64(Vx)));
+  __m128i v22 = _mm_set1_epi64x((s64(T[2]) << 12) + (s64(M(2, 0)) * s64(Vx)));
+  __m128i flags = _mm_setzero_si128();
+
+  CheckMAC44SIMD(flags, v01, v22);
+  v01 = ShiftRightArithmetic64<20>(_mm_slli_epi64(v01, 20));
+  v22 = ShiftRightArithmetic64<20>(_mm_slli_epi64(v22, 20));
+
+  v01 = _mm_add_epi64(v01, _mm_set_epi64x(s64(M(1, 1)) * s64(Vy), s64(M(0, 1)) * s64(Vy)));
+  v22 = _mm_add_epi64(v22, _mm_set1_epi64x(s64(M(2, 1)) * s64(Vy)));
+
+  CheckMAC44SIMD(flags, v01, v22);
+  v01 = ShiftRightArithmetic64<20>(_mm_slli_epi64(v01, 20));
+  v22 = ShiftRightArithmetic64<20>(_mm_slli_epi64(v22, 20));
+
+  v01 = _mm_add_epi64(v01, _mm_set_epi64x(s64(M(1, 2)) * s64(Vz), s64(M(0, 2)) * s64(Vz)));
+  v22 = _mm_add_epi64(v22, _mm_set1_epi64x(s64(M(2, 2)) * s64(Vz)));
+
+  alignas(16) s64 lanes01[2];
+  _mm_store_si128(reinterpret_cast<__m128i*>(lanes01), v01);
+  out[0] = lanes01[0];
+  out[1] = lanes01[1];
+  out[2] = _mm_cvtsi128_si64(v22);
+
+  const __m128i folded = _mm_or_si128(flags, _mm_unpackhi_epi64(flags, flags));
+  return static_cast<u32>(_mm_cvtsi128_si32(folded));
+
+#undef M
+}
+
+#elif defined(CPU_AARCH64)
+
+ALWAYS_INLINE static void CheckMAC44SIMD(uint64x2_t& flags, const int64x2_t v01, const int64x2_t v22)
+{
+  const int64x2_t max44 = vdupq_n_s64(MAC123_MAX_VALUE);
+  const int64x2_t min44 = vdupq_n_s64(MAC123_MIN_VALUE);
+  flags = vorrq_u64(flags, vandq_u64(vcgtq_s64(v01, max44),
+                                     vcombine_u64(vcreate_u64(u64(1) << 30), vcreate_u64(u64(1) << 29))));
+  flags = vorrq_u64(flags, vandq_u64(vcgtq_s64(min44, v01),
+                                     vcombine_u64(vcreate_u64(u64(1) << 27), vcreate_u64(u64(1) << 26))));
+  flags = vorrq_u64(flags, vandq_u64(vcgtq_s64(v22, max44), vdupq_n_u64(u64(1) << 28)));
+  flags = vorrq_u64(flags, vandq_u64(vcgtq_s64(min44, v22), vdupq_n_u64(u64(1) << 25)));
+}
+
+ALWAYS_INLINE static u32 DotProductWithTranslationSIMD(const s16* M_, const s32 T[3], const s16 Vx, const s16 Vy,
+                                                       const s16 Vz, s64 out[3])
+{
+#define M(i, j) M_[((i)*3) + (j)]
+
+  int64x2_t v01 = vcombine_s64(vcreate_s64(u64((s64(T[0]) << 12) + (s64(M(0, 0)) * s64(Vx)))),
+                               vcreate_s64(u64((s64(T[1]) << 12) + (s64(M(1, 0)) * s64(Vx)))));
+  int64x2_t v22 = vdupq_n_s64((s64(T[2]) << 12) + (s64(M(2, 0)) * s64(Vx)));
+  uint64x2_t flags = vdupq_n_u64(0);
+
+  CheckMAC44SIMD(flags, v01, v22);
+  v01 = vshrq_n_s64(vshlq_n_s64(v01, 20), 20);
+  v22 = vshrq_n_s64(vshlq_n_s64(v22, 20), 20);
+
+  v01 = vaddq_s64(v01, vcombine_s64(vcreate_s64(u64(s64(M(0, 1)) * s64(Vy))), vcreate_s64(u64(s64(M(1, 1)) * s64(Vy)))));
+  v22 = vaddq_s64(v22, vdupq_n_s64(s64(M(2, 1)) * s64(Vy)));
+
+  CheckMAC44SIMD(flags, v01, v22);
+  v01 = vshrq_n_s64(vshlq_n_s64(v01, 20), 20);
+  v22 = vshrq_n_s64(vshlq_n_s64(v22, 20), 20);
+
+  v01 = vaddq_s64(v01, vcombine_s64(vcreate_s64(u64(s64(M(0, 2)) * s64(Vz))), vcreate_s64(u64(s64(M(1, 2)) * s64(Vz)))));
+  v22 = vaddq_s64(v22, vdupq_n_s64(s64(M(2, 2)) * s64(Vz)));
+
+  out[0] = vgetq_lane_s64(v01, 0);
+  out[1] = vgetq_lane_s64(v01, 1);
+  out[2] = vgetq_lane_s64(v22, 0);
+
+  return static_cast<u32>(vgetq_lane_u64(flags, 0) | vgetq_lane_u64(flags, 1));
+
+#undef M
+}
+
+#endif
+
+#define GTE_HAVE_SIMD_KERNELS 1
+
+#endif // defined(CPU_X64) || defined(CPU_AARCH64)
+
+template<u8 shift, bool lm>
+static void MulMatVec(const s16* M_, const s16 Vx, const s16 Vy, const s16 Vz)
 {
 #define M(i, j) M_[((i)*3) + (j)]
 #define dot3(i)                                                                                                        \
@@ -491,8 +646,26 @@ static void MulMatVec(const s16* M_, const s16 Vx, const s16 Vy, const s16 Vz, u
 #undef M
 }
 
-static void MulMatVec(const s16* M_, const s32 T[3], const s16 Vx, const s16 Vy, const s16 Vz, u8 shift, bool lm)
+// sf/lm come from constant instruction bits, so dispatch once here and let the compiler fold the
+// shift and saturation bounds inside the kernels instead of carrying them as runtime arguments.
+static void MulMatVec(const s16* M_, const s16 Vx, const s16 Vy, const s16 Vz, u8 shift, bool lm)
+{
+  if (shift != 0)
+    lm ? MulMatVec<12, true>(M_, Vx, Vy, Vz) : MulMatVec<12, false>(M_, Vx, Vy, Vz);
+  else
+    lm ? MulMatVec<0, true>(M_, Vx, Vy, Vz) : MulMatVec<0, false>(M_, Vx, Vy, Vz);
+}
+
+template<u8 shift, bool lm>
+static void MulMatVec(const s16* M_, const s32 T[3], const s16 Vx, const s16 Vy, const s16 Vz)
 {
+#ifdef GTE_HAVE_SIMD_KERNELS
+  s64 out[3];
+  REGS.FLAG.bits |= DotProductWithTranslationSIMD(M_, T, Vx, Vy, Vz, out);
+  TruncateAndSetMACAndIR<1>(out[0], shift, lm);
+  TruncateAndSetMACAndIR<2>(out[1], shift, lm);
+  TruncateAndSetMACAndIR<3>(out[2], shift, lm);
+#else
 #define M(i, j) M_[((i)*3) + (j)]
 #define dot3(i)                                                                                                        \
   TruncateAndSetMACAndIR<i + 1>(                                                                                       \
@@ -507,9 +680,19 @@ static void MulMatVec(const s16* M_, const s32 T[3], const s16 Vx, const s16 Vy,
 
 #undef dot3
 #undef M
+#endif
 }
 
-static void MulMatVecBuggy(const s16* M_, const s32 T[3], const s16 Vx, const s16 Vy, const s16 Vz, u8 shift, bool lm)
+static void MulMatVec(const s16* M_, const s32 T[3], const s16 Vx, const s16 Vy, const s16 Vz, u8 shift, bool lm)
+{
+  if (shift != 0)
+    lm ? MulMatVec<12, true>(M_, T, Vx, Vy, Vz) : MulMatVec<12, false>(M_, T, Vx, Vy, Vz);
+  else
+    lm ? MulMatVec<0, true>(M_, T, Vx, Vy, Vz) : MulMatVec<0, false>(M_, T, Vx, Vy, Vz);
+}
+
+template<u8 shift, bool lm>
+static void MulMatVecBuggy(const s16* M_, const s32 T[3], const s16 Vx, const s16 Vy, const s16 Vz)
 {
 #define M(i, j) M_[((i)*3) + (j)]
 #define dot3(i)                                                                                                        \
@@ -531,6 +714,14 @@ static void MulMatVecBuggy(const s16* M_, const s32 T[3], const s16 Vx, const s1
 #undef M
 }
 
+static void MulMatVecBuggy(const s16* M_, const s32 T[3], const s16 Vx, const s16 Vy, const s16 Vz, u8 shift, bool lm)
+{
+  if (shift != 0)
+    lm ? MulMatVecBuggy<12, true>(M_, T, Vx, Vy, Vz) : MulMatVecBuggy<12, false>(M_, T, Vx, Vy, Vz);
+  else
+    lm ? MulMatVecBuggy<0, true>(M_, T, Vx, Vy, Vz) : MulMatVecBuggy<0, false>(M_, T, Vx, Vy, Vz);
+}
+
 static void Execute_MVMVA(Instruction inst)
 {
   REGS.FLAG.Clear();
@@ -572,8 +763,6 @@ static void Execute_MVMVA(Instruction inst)
     MulMatVec(M, T, Vx, Vy, Vz, inst.GetShift(), inst.lm);
   else
     MulMatVecBuggy(M, T, Vx, Vy, Vz, inst.GetShift(), inst.lm);
-
-  REGS.FLAG.UpdateError();
 }
 
 static void Execute_SQR(Instruction inst)
@@ -590,8 +779,6 @@ static void Execute_SQR(Instruction inst)
   TruncateAndSetIR<1>(REGS.MAC1, lm);
   TruncateAndSetIR<2>(REGS.MAC2, lm);
   TruncateAndSetIR<3>(REGS.MAC3, lm);
-
-  REGS.FLAG.UpdateError();
 }
 
 static void Execute_OP(Instruction inst)
@@ -613,8 +800,6 @@ static void Execute_OP(Instruction inst)
   TruncateAndSetMACAndIR<1>(s64(IR3 * D2) - s64(IR2 * D3), shift, lm);
   TruncateAndSetMACAndIR<2>(s64(IR1 * D3) - s64(IR3 * D1), shift, lm);
   TruncateAndSetMACAndIR<3>(s64(IR2 * D1) - s64(IR1 * D2), shift, lm);
-
-  REGS.FLAG.UpdateError();
 }
 
 static void RTPS(const s16 V[3], u8 shift, bool lm, bool last)
@@ -627,9 +812,17 @@ static void RTPS(const s16 V[3], u8 shift, bool lm, bool last)
   // IR1 = MAC1 = (TRX*1000h + RT11*VX0 + RT12*VY0 + RT13*VZ0) SAR (sf*12)
   // IR2 = MAC2 = (TRY*1000h + RT21*VX0 + RT22*VY0 + RT23*VZ0) SAR (sf*12)
   // IR3 = MAC3 = (TRZ*1000h + RT31*VX0 + RT32*VY0 + RT33*VZ0) SAR (sf*12)
+#ifdef GTE_HAVE_SIMD_KERNELS
+  s64 xyz[3];
+  REGS.FLAG.bits |= DotProductWithTranslationSIMD(&REGS.RT[0][0], REGS.TR, V[0], V[1], V[2], xyz);
+  const s64 x = xyz[0];
+  const s64 y = xyz[1];
+  const s64 z = xyz[2];
+#else
   const s64 x = dot3(0);
   const s64 y = dot3(1);
   const s64 z = dot3(2);
+#endif
   TruncateAndSetMAC<1>(x, shift);
   TruncateAndSetMAC<2>(y, shift);
   TruncateAndSetMAC<3>(z, shift);
@@ -767,7 +960,6 @@ static void Execute_RTPS(Instruction inst)
 {
   REGS.FLAG.Clear();
   RTPS(REGS.V0, inst.GetShift(), inst.lm, true);
-  REGS.FLAG.UpdateError();
 }
 
 static void Execute_RTPT(Instruction inst)
@@ -780,8 +972,6 @@ static void Execute_RTPT(Instruction inst)
   RTPS(REGS.V0, shift, lm, false);
   RTPS(REGS.V1, shift, lm, false);
   RTPS(REGS.V2, shift, lm, true);
-
-  REGS.FLAG.UpdateError();
 }
 
 static void Execute_NCLIP(Instruction inst)
@@ -793,8 +983,6 @@ static void Execute_NCLIP(Instruction inst)
                          s64(REGS.SXY2[0]) * s64(REGS.SXY0[1]) - s64(REGS.SXY0[0]) * s64(REGS.SXY2[1]) -
                          s64(REGS.SXY1[0]) * s64(REGS.SXY0[1]) - s64(REGS.SXY2[0]) * s64(REGS.SXY1[1]),
                        0);
-
-  REGS.FLAG.UpdateError();
 }
 
 static void Execute_NCLIP_PGXP(Instruction inst)
@@ -817,8 +1005,6 @@ static void Execute_AVSZ3(Instruction inst)
   const s64 result = s64(REGS.ZSF3) * s32(u32(REGS.SZ1) + u32(REGS.SZ2) + u32(REGS.SZ3));
   TruncateAndSetMAC<0>(result, 0);
   SetOTZ(s32(result >> 12));
-
-  REGS.FLAG.UpdateError();
 }
 
 static void Execute_AVSZ4(Instruction inst)
@@ -828,8 +1014,6 @@ static void Execute_AVSZ4(Instruction inst)
   const s64 result = s64(REGS.ZSF4) * s32(u32(REGS.SZ0) + u32(REGS.SZ1) + u32(REGS.SZ2) + u32(REGS.SZ3));
   TruncateAndSetMAC<0>(result, 0);
   SetOTZ(s32(result >> 12));
-
-  REGS.FLAG.UpdateError();
 }
 
 static ALWAYS_INLINE void InterpolateColor(s64 in_MAC1, s64 in_MAC2, s64 in_MAC3, u8 shift, bool lm)
@@ -864,8 +1048,6 @@ static void Execute_NCS(Instruction inst)
   REGS.FLAG.Clear();
 
   NCS(REGS.V0, inst.GetShift(), inst.lm);
-
-  REGS.FLAG.UpdateError();
 }
 
 static void Execute_NCT(Instruction inst)
@@ -878,8 +1060,6 @@ static void Execute_NCT(Instruction inst)
   NCS(REGS.V0, shift, lm);
   NCS(REGS.V1, shift, lm);
   NCS(REGS.V2, shift, lm);
-
-  REGS.FLAG.UpdateError();
 }
 
 static void NCCS(const s16 V[3], u8 shift, bool lm)
@@ -905,8 +1085,6 @@ static void Execute_NCCS(Instruction inst)
   REGS.FLAG.Clear();
 
   NCCS(REGS.V0, inst.GetShift(), inst.lm);
-
-  REGS.FLAG.UpdateError();
 }
 
 static void Execute_NCCT(Instruction inst)
@@ -919,8 +1097,6 @@ static void Execute_NCCT(Instruction inst)
   NCCS(REGS.V0, shift, lm);
   NCCS(REGS.V1, shift, lm);
   NCCS(REGS.V2, shift, lm);
-
-  REGS.FLAG.UpdateError();
 }
 
 static void NCDS(const s16 V[3], u8 shift, bool lm)
@@ -949,8 +1125,6 @@ static void Execute_NCDS(Instruction inst)
   REGS.FLAG.Clear();
 
   NCDS(REGS.V0, inst.GetShift(), inst.lm);
-
-  REGS.FLAG.UpdateError();
 }
 
 static void Execute_NCDT(Instruction inst)
@@ -963,8 +1137,6 @@ static void Execute_NCDT(Instruction inst)
   NCDS(REGS.V0, shift, lm);
   NCDS(REGS.V1, shift, lm);
   NCDS(REGS.V2, shift, lm);
-
-  REGS.FLAG.UpdateError();
 }
 
 static void Execute_CC(Instruction inst)
@@ -985,8 +1157,6 @@ static void Execute_CC(Instruction inst)
 
   // Color FIFO = [MAC1/16,MAC2/16,MAC3/16,CODE], [IR1,IR2,IR3] = [MAC1,MAC2,MAC3]
   PushRGBFromMAC();
-
-  REGS.FLAG.UpdateError();
 }
 
 static void Execute_CDP(Instruction inst)
@@ -1011,8 +1181,6 @@ static void Execute_CDP(Instruction inst)
 
   // Color FIFO = [MAC1/16,MAC2/16,MAC3/16,CODE], [IR1,IR2,IR3] = [MAC1,MAC2,MAC3]
   PushRGBFromMAC();
-
-  REGS.FLAG.UpdateError();
 }
 
 static void DPCS(const u8 color[3], u8 shift, bool lm)
@@ -1035,8 +1203,6 @@ static void Execute_DPCS(Instruction inst)
   REGS.FLAG.Clear();
 
   DPCS(REGS.RGBC, inst.GetShift(), inst.lm);
-
-  REGS.FLAG.UpdateError();
 }
 
 static void Execute_DPCT(Instruction inst)
@@ -1048,8 +1214,6 @@ static void Execute_DPCT(Instruction inst)
 
   for (u32 i = 0; i < 3; i++)
     DPCS(REGS.RGB0, shift, lm);
-
-  REGS.FLAG.UpdateError();
 }
 
 static void Execute_DCPL(Instruction inst)
@@ -1070,8 +1234,6 @@ static void Execute_DCPL(Instruction inst)
 
   // Color FIFO = [MAC1/16,MAC2/16,MAC3/16,CODE], [IR1,IR2,IR3] = [MAC1,MAC2,MAC3]
   PushRGBFromMAC();
-
-  REGS.FLAG.UpdateError();
 }
 
 static void Execute_INTPL(Instruction inst)
@@ -1088,8 +1250,6 @@ static void Execute_INTPL(Instruction inst)
 
   // Color FIFO = [MAC1/16,MAC2/16,MAC3/16,CODE], [IR1,IR2,IR3] = [MAC1,MAC2,MAC3]
   PushRGBFromMAC();
-
-  REGS.FLAG.UpdateError();
 }
 
 static void Execute_GPL(Instruction inst)
@@ -1107,8 +1267,6 @@ static void Execute_GPL(Instruction inst)
 
   // Color FIFO = [MAC1/16,MAC2/16,MAC3/16,CODE], [IR1,IR2,IR3] = [MAC1,MAC2,MAC3]
   PushRGBFromMAC();
-
-  REGS.FLAG.UpdateError();
 }
 
 static void Execute_GPF(Instruction inst)
@@ -1126,8 +1284,6 @@ static void Execute_GPF(Instruction inst)
 
   // Color FIFO = [MAC1/16,MAC2/16,MAC3/16,CODE], [IR1,IR2,IR3] = [MAC1,MAC2,MAC3]
   PushRGBFromMAC();
-
-  REGS.FLAG.UpdateError();
 }
 
 void ExecuteInstruction(u32 inst_bits)
@@ -1358,5 +1514,4 @@ InstructionImpl GetInstructionImpl(u32 inst_bits, TickCount* ticks)
       Panic("Missing handler");
   }
 }
-
 } // namespace GTE
@@ -0,0 +1,273 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#include "guest_profiler.h"
+#include "common/file_system.h"
+#include "common/log.h"
+#include "common/path.h"
+#include "common/string_util.h"
+#include "common/timer.h"
+#include "cpu_code_cache.h"
+#include "host.h"
+#include "settings.h"
+#include "system.h"
+#include "util/imgui_manager.h"
+#include "imgui.h"
+#include "fmt/chrono.h"
+#include "fmt/format.h"
+#include <algorithm>
+#include <cctype>
+#include <ctime>
+#include <map>
+#include <unordered_map>
+#include <vector>
+Log_SetChannel(GuestProfiler);
+
+namespace GuestProfiler {
+
+bool g_collecting = false;
+
+// A symbol is assumed to cover at most this many bytes; PCs further from the nearest symbol start
+// are reported by address instead of being misattributed to an unrelated function.
+static constexpr u32 MAX_SYMBOL_SIZE = 0x100000;
+
+// Block execution counts, keyed by block start PC. Only touched from the CPU thread.
+static std::unordered_map<u32, u64> s_block_counts;
+
+// Symbol starts from the loaded map file, sorted by address.
+static std::map<u32, std::string> s_symbols;
+static std::string s_symbol_map_path;
+
+static const std::string* LookupSymbol(u32 pc, u32* offset);
+static u64 GetBlockWeight(u32 pc, u64 count);
+
+void Start()
+{
+  if (g_collecting)
+    return;
+
+  g_collecting = true;
+  Log_InfoPrintf("Guest profiler started.");
+
+  // The recompiler's asm dispatcher has no per-block hook; kick it out so Execute() restarts with
+  // the block-granular loop.
+  if (System::IsValid() && g_settings.cpu_execution_mode == CPUExecutionMode::Recompiler)
+    System::InterruptExecution();
+}
+
+void Stop()
+{
+  if (!g_collecting)
+    return;
+
+  g_collecting = false;
+  Log_InfoPrintf("Guest profiler stopped with %zu blocks sampled.", s_block_counts.size());
+
+  if (System::IsValid() && g_settings.cpu_execution_mode == CPUExecutionMode::Recompiler)
+    System::InterruptExecution();
+}
+
+void Reset()
+{
+  s_block_counts.clear();
+}
+
+void AddBlockExecution(u32 pc)
+{
+  s_block_counts[pc]++;
+}
+
+bool LoadSymbolMap(const char* path)
+{
+  const std::optional<std::string> data = FileSystem::ReadFileToString(path);
+  if (!data.has_value())
+  {
+    Log_ErrorPrintf("Failed to read symbol map '%s'", path);
+    return false;
+  }
+
+  std::map<u32, std::string> symbols;
+  for (const std::string_view& line : StringUtil::SplitString(data.value(), '\n', true))
+  {
+    // Accept any line of the form "<hex address> ... <name>"; this covers psylink map files and
+    // most text dumps of SYM files. The address may carry a "0x" or "$" prefix.
+    std::string normalized_line(line);
+    std::replace_if(
+      normalized_line.begin(), normalized_line.end(),
+      [](char ch) { return (ch == '\t' || ch == '\r'); }, ' ');
+    const std::vector<std::string_view> tokens = StringUtil::SplitString(normalized_line, ' ', true);
+    if (tokens.size() < 2)
+      continue;
+
+    std::string_view addr_token = tokens.front();
+    if (addr_token.size() >= 2 && addr_token[0] == '0' && (addr_token[1] == 'x' || addr_token[1] == 'X'))
+      addr_token = addr_token.substr(2);
+    else if (!addr_token.empty() && addr_token[0] == '$')
+      addr_token = addr_token.substr(1);
+
+    const std::optional<u32> address = StringUtil::FromChars<u32>(addr_token, 16);
+    if (!address.has_value())
+      continue;
+
+    const std::string_view name = tokens.back();
+    if (name.empty() || (!std::isalpha(static_cast<unsigned char>(name[0])) && name[0] != '_'))
+      continue;
+
+    symbols.emplace(address.value(), std::string(name));
+  }
+
+  if (symbols.empty())
+  {
+    Log_ErrorPrintf("No symbols found in '%s'", path);
+    return false;
+  }
+
+  s_symbols = std::move(symbols);
+  s_symbol_map_path = path;
+  Log_InfoPrintf("Loaded %zu symbols from '%s'", s_symbols.size(), path);
+  return true;
+}
+
+const std::string* LookupSymbol(u32 pc, u32* offset)
+{
+  if (s_symbols.empty())
+    return nullptr;
+
+  auto it = s_symbols.upper_bound(pc);
+  if (it == s_symbols.begin())
+  {
+    // Map addresses are usually KSEG0 (0x80xxxxxx); retry there if the PC came from KUSEG/KSEG1.
+    const u32 kseg0_pc = (pc & CPU::PHYSICAL_MEMORY_ADDRESS_MASK) | UINT32_C(0x80000000);
+    if (kseg0_pc == pc)
+      return nullptr;
+    return LookupSymbol(kseg0_pc, offset);
+  }
+
+  --it;
+  if ((pc - it->first) >= MAX_SYMBOL_SIZE)
+    return nullptr;
+
+  *offset = pc - it->first;
+  return &it->second;
+}
+
+u64 GetBlockWeight(u32 pc, u64 count)
+{
+  // Weight by guest instructions executed where the block still exists; a flat execution count
+  // would over-represent short blocks.
+  const u32 instruction_count = CPU::CodeCache::GetBlockInstructionCount(pc);
+  return count * std::max<u64>(instruction_count, 1);
+}
+
+std::string ExportFolded()
+{
+  if (s_block_counts.empty())
+    return {};
+
+  // Aggregate blocks by symbol, falling back to the block address for unsymbolized PCs.
+  std::map<std::string, u64> folded;
+  for (const auto& [pc, count] : s_block_counts)
+  {
+    u32 offset;
+    const std::string* symbol = LookupSymbol(pc, &offset);
+    std::string name = symbol ? *symbol : fmt::format("0x{:08X}", pc);
+    folded[std::move(name)] += GetBlockWeight(pc, count);
+  }
+
+  std::string data;
+  data.reserve(folded.size() * 32);
+  for (const auto& [name, weight] : folded)
+    data += fmt::format("{} {}\n", name, weight);
+
+  const std::string path = Path::Combine(
+    EmuFolders::Dumps,
+    fmt::format("profiles" FS_OSPATH_SEPARATOR_STR "{}_{:%Y-%m-%d_%H-%M-%S}.folded", System::GetGameSerial(),
+                fmt::localtime(std::time(nullptr))));
+  if (!FileSystem::EnsureDirectoryExists(std::string(Path::GetDirectory(path)).c_str(), false) ||
+      !FileSystem::WriteStringToFile(path.c_str(), data))
+  {
+    Log_ErrorPrintf("Failed to write profile to '%s'", path.c_str());
+    return {};
+  }
+
+  Log_InfoPrintf("Exported %zu profile entries to '%s'", folded.size(), path.c_str());
+  return path;
+}
+
+void DrawDebugWindow()
+{
+  const float framebuffer_scale = Host::GetOSDScale();
+
+  ImGui::SetNextWindowSize(ImVec2(420.0f * framebuffer_scale, 400.0f * framebuffer_scale), ImGuiCond_FirstUseEver);
+  if (!ImGui::Begin("Guest Profiler", nullptr))
+  {
+    ImGui::End();
+    return;
+  }
+
+  u64 total_executions = 0;
+  for (const auto& [pc, count] : s_block_counts)
+    total_executions += count;
+
+  ImGui::Text("%s - %zu blocks, %llu executions", g_collecting ? "Collecting" : "Stopped", s_block_counts.size(),
+              static_cast<unsigned long long>(total_executions));
+
+  if (ImGui::Button(g_collecting ? "Stop" : "Start"))
+  {
+    if (g_collecting)
+      Stop();
+    else
+      Start();
+  }
+  ImGui::SameLine();
+  if (ImGui::Button("Reset"))
+    Reset();
+  ImGui::SameLine();
+  if (ImGui::Button("Export Flamegraph"))
+    ExportFolded();
+
+  static char symbol_map_path[256] = {};
+  ImGui::InputText("##symbol_map", symbol_map_path, sizeof(symbol_map_path));
+  ImGui::SameLine();
+  if (ImGui::Button("Load Symbols"))
+    LoadSymbolMap(symbol_map_path);
+  if (!s_symbols.empty())
+    ImGui::Text("%zu symbols loaded from %s", s_symbols.size(), s_symbol_map_path.c_str());
+
+  ImGui::Separator();
+  ImGui::Text("Hottest Blocks:");
+
+  // Refresh the displayed top blocks once a second; sorting every frame while collecting from a
+  // large game would cost more than the profiler itself.
+  static std::vector<std::pair<u64, u32>> top_blocks;
+  static Common::Timer refresh_timer;
+  if (refresh_timer.GetTimeSeconds() >= 1.0 || top_blocks.empty())
+  {
+    refresh_timer.Reset();
+    top_blocks.clear();
+    top_blocks.reserve(s_block_counts.size());
+    for (const auto& [pc, count] : s_block_counts)
+      top_blocks.emplace_back(GetBlockWeight(pc, count), pc);
+    std::sort(top_blocks.begin(), top_blocks.end(), std::greater<>());
+    if (top_blocks.size() > 20)
+      top_blocks.resize(20);
+  }
+
+  for (const auto& [weight, pc] : top_blocks)
+  {
+    u32 offset = 0;
+    const std::string* symbol = LookupSymbol(pc, &offset);
+    if (symbol)
+    {
+      ImGui::Text("%12llu  0x%08X  %s+0x%X", static_cast<unsigned long long>(weight), pc, symbol->c_str(), offset);
+    }
+    else
+    {
+      ImGui::Text("%12llu  0x%08X", static_cast<unsigned long long>(weight), pc);
+    }
+  }
+
+  ImGui::End();
+}
+
+} // namespace GuestProfiler
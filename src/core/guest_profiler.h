@@ -0,0 +1,44 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#pragma once
+#include "types.h"
+#include <string>
+
+// Samples the *guest* program counter at block granularity so slow spots in the emulated game can
+// be found without host-side tooling. The dispatch loops record each block execution while
+// collection is active; the result can be symbolized against a linker map and exported in
+// flamegraph folded format.
+namespace GuestProfiler {
+
+/// Hot-path flag, read by the CPU dispatch loops once per block execution.
+extern bool g_collecting;
+
+ALWAYS_INLINE bool IsCollecting()
+{
+  return g_collecting;
+}
+
+/// Starts/stops collection. Starting under the recompiler interrupts execution so the dispatcher
+/// restarts in its block-granular form.
+void Start();
+void Stop();
+
+/// Discards all collected samples.
+void Reset();
+
+/// Records one execution of the block starting at pc. Only call while IsCollecting().
+void AddBlockExecution(u32 pc);
+
+/// Loads function symbols from a text linker map (e.g. PSYQ/psylink output, or any file with
+/// "<hex address> ... <name>" lines). Replaces any previously-loaded symbols.
+bool LoadSymbolMap(const char* path);
+
+/// Writes the collected profile in flamegraph folded format ("name weight" per line), weighted by
+/// block executions times block length. Returns the written path, or an empty string on failure.
+std::string ExportFolded();
+
+/// Draws the guest profiler debug window (Debug/ShowGuestProfiler).
+void DrawDebugWindow();
+
+} // namespace GuestProfiler
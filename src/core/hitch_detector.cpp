@@ -0,0 +1,179 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#include "hitch_detector.h"
+#include "common/file_system.h"
+#include "common/log.h"
+#include "common/path.h"
+#include "common/string.h"
+#include "common/timer.h"
+#include "host.h"
+#include "settings.h"
+#include "system.h"
+#include "fmt/chrono.h"
+#include "fmt/format.h"
+#include <algorithm>
+#include <array>
+#include <ctime>
+#include <mutex>
+Log_SetChannel(HitchDetector);
+
+namespace HitchDetector {
+
+struct EventRecord
+{
+  Common::Timer::Value timestamp;
+  float duration_ms;
+  u32 param;
+  EventType type;
+};
+
+// ~4K records covers several seconds of history at typical event rates; events are cheap enough
+// that overflow just means older history is overwritten.
+static constexpr u32 RING_SIZE = 4096;
+
+// Median tracking window and dump policy.
+static constexpr u32 MEDIAN_WINDOW_SIZE = 128;
+static constexpr u32 MEDIAN_RECOMPUTE_INTERVAL = 64;
+static constexpr float HITCH_MEDIAN_MULTIPLIER = 4.0f;
+static constexpr float HITCH_ABSOLUTE_THRESHOLD_MS = 20.0f;
+static constexpr float DUMP_HISTORY_SECONDS = 5.0f;
+static constexpr float MIN_SECONDS_BETWEEN_DUMPS = 5.0f;
+
+static const std::array<const char*, static_cast<u32>(EventType::Count)> s_event_type_names = {
+  {"Frame", "BlockCompile", "CodeBufferFlush", "CDSectorRead", "CDReadWait"}};
+
+static std::mutex s_ring_mutex;
+static std::array<EventRecord, RING_SIZE> s_ring;
+static u32 s_ring_pos = 0;
+static u32 s_ring_count = 0;
+
+// Frame time history, only touched from the CPU thread.
+static std::array<float, MEDIAN_WINDOW_SIZE> s_frame_times;
+static u32 s_frame_time_pos = 0;
+static u32 s_frame_time_count = 0;
+static u32 s_frames_since_median_update = 0;
+static float s_median_frame_time_ms = 0.0f;
+static u32 s_frame_number = 0;
+static Common::Timer s_frame_timer;
+static Common::Timer::Value s_last_dump_time = 0;
+
+static void UpdateMedianFrameTime();
+static void DumpHitch(float frame_time_ms);
+
+void AddEvent(EventType type, u32 param, float duration_ms /* = 0.0f */)
+{
+  EventRecord rec;
+  rec.timestamp = Common::Timer::GetCurrentValue();
+  rec.duration_ms = duration_ms;
+  rec.param = param;
+  rec.type = type;
+
+  std::unique_lock lock(s_ring_mutex);
+  s_ring[s_ring_pos] = rec;
+  s_ring_pos = (s_ring_pos + 1) % RING_SIZE;
+  s_ring_count = std::min(s_ring_count + 1, RING_SIZE);
+}
+
+void UpdateMedianFrameTime()
+{
+  std::array<float, MEDIAN_WINDOW_SIZE> sorted;
+  std::copy_n(s_frame_times.begin(), s_frame_time_count, sorted.begin());
+  std::nth_element(sorted.begin(), sorted.begin() + (s_frame_time_count / 2), sorted.begin() + s_frame_time_count);
+  s_median_frame_time_ms = sorted[s_frame_time_count / 2];
+}
+
+void EndFrame()
+{
+  const float frame_time_ms = static_cast<float>(s_frame_timer.GetTimeMillisecondsAndReset());
+  s_frame_number++;
+
+  AddEvent(EventType::Frame, s_frame_number, frame_time_ms);
+
+  s_frame_times[s_frame_time_pos] = frame_time_ms;
+  s_frame_time_pos = (s_frame_time_pos + 1) % MEDIAN_WINDOW_SIZE;
+  s_frame_time_count = std::min(s_frame_time_count + 1, MEDIAN_WINDOW_SIZE);
+  if ((++s_frames_since_median_update) >= MEDIAN_RECOMPUTE_INTERVAL)
+  {
+    s_frames_since_median_update = 0;
+    UpdateMedianFrameTime();
+  }
+
+  // Don't classify anything as a hitch until the median has warmed up, otherwise the loading
+  // screen at boot generates a stack of useless dumps.
+  if (s_frame_time_count < MEDIAN_WINDOW_SIZE || s_median_frame_time_ms <= 0.0f)
+    return;
+
+  if (frame_time_ms < HITCH_ABSOLUTE_THRESHOLD_MS ||
+      frame_time_ms < (s_median_frame_time_ms * HITCH_MEDIAN_MULTIPLIER))
+  {
+    return;
+  }
+
+  const Common::Timer::Value now = Common::Timer::GetCurrentValue();
+  if (s_last_dump_time != 0 &&
+      Common::Timer::ConvertValueToSeconds(now - s_last_dump_time) < MIN_SECONDS_BETWEEN_DUMPS)
+  {
+    return;
+  }
+
+  s_last_dump_time = now;
+  DumpHitch(frame_time_ms);
+}
+
+void DumpHitch(float frame_time_ms)
+{
+  const Common::Timer::Value now = Common::Timer::GetCurrentValue();
+
+  std::string dump;
+  dump.reserve(32768);
+  dump += fmt::format("Hitch detected in {} ({})\n", System::GetGameSerial(), System::GetGameTitle());
+  dump += fmt::format("Frame {}: {:.2f} ms (median {:.2f} ms, threshold {:.2f} ms)\n\n", s_frame_number,
+                      frame_time_ms, s_median_frame_time_ms, s_median_frame_time_ms * HITCH_MEDIAN_MULTIPLIER);
+  dump += fmt::format("{:>12} | {:>15} | {:>10} | {:>10}\n", "Age (ms)", "Event", "Param", "Time (ms)");
+
+  {
+    std::unique_lock lock(s_ring_mutex);
+    const u32 start = (s_ring_count < RING_SIZE) ? 0 : s_ring_pos;
+    for (u32 i = 0; i < s_ring_count; i++)
+    {
+      const EventRecord& rec = s_ring[(start + i) % RING_SIZE];
+      const double age_seconds = Common::Timer::ConvertValueToSeconds(now - rec.timestamp);
+      if (age_seconds > DUMP_HISTORY_SECONDS)
+        continue;
+
+      dump += fmt::format("{:>12.2f} | {:>15} | 0x{:08X} | {:>10.2f}\n", age_seconds * 1000.0,
+                          s_event_type_names[static_cast<u32>(rec.type)], rec.param, rec.duration_ms);
+    }
+  }
+
+  const std::string path = Path::Combine(
+    EmuFolders::Dumps, fmt::format("hitches" FS_OSPATH_SEPARATOR_STR "{}_{}_frame{}.txt", System::GetGameSerial(),
+                                   TinyString::FromFmt("{:%Y-%m-%d_%H-%M-%S}", fmt::localtime(std::time(nullptr))),
+                                   s_frame_number));
+  if (!FileSystem::EnsureDirectoryExists(std::string(Path::GetDirectory(path)).c_str(), false) ||
+      !FileSystem::WriteStringToFile(path.c_str(), dump))
+  {
+    Log_ErrorPrintf("Failed to write hitch dump to '%s'", path.c_str());
+    return;
+  }
+
+  Log_WarningPrintf("Frame %u took %.2f ms (median %.2f ms), dumped event history to '%s'", s_frame_number,
+                    frame_time_ms, s_median_frame_time_ms, path.c_str());
+}
+
+void Reset()
+{
+  std::unique_lock lock(s_ring_mutex);
+  s_ring_pos = 0;
+  s_ring_count = 0;
+  s_frame_time_pos = 0;
+  s_frame_time_count = 0;
+  s_frames_since_median_update = 0;
+  s_median_frame_time_ms = 0.0f;
+  s_frame_number = 0;
+  s_frame_timer.Reset();
+  s_last_dump_time = 0;
+}
+
+} // namespace HitchDetector
@@ -0,0 +1,34 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#pragma once
+#include "types.h"
+
+// Always-on observability for rare stutters: subsystems push coarse events (JIT compiles, disc
+// reads, ...) into a small ring buffer, and when a frame blows past a multiple of the rolling
+// median frame time, the recent history is dumped to a file for post-hoc attribution. Call sites
+// are expected to check g_settings.hitch_detector_enable first.
+namespace HitchDetector {
+
+enum class EventType : u8
+{
+  Frame,           // param = frame number
+  BlockCompile,    // param = block PC
+  CodeBufferFlush, // param = unused
+  CDSectorRead,    // param = LBA, duration = media read time
+  CDReadWait,      // param = LBA, duration = CPU thread stall waiting for the reader
+
+  Count
+};
+
+/// Records an event into the ring buffer. Safe to call from any thread.
+void AddEvent(EventType type, u32 param, float duration_ms = 0.0f);
+
+/// Per-frame hook on the CPU thread: records the frame, updates the rolling median, and dumps the
+/// recent event history when the frame qualifies as a hitch.
+void EndFrame();
+
+/// Drops buffered history, e.g. when a new system starts.
+void Reset();
+
+} // namespace HitchDetector
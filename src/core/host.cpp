@@ -330,7 +330,8 @@ std::unique_ptr<AudioStream> Host::CreateAudioStream(AudioBackend backend, u32 s
 #endif
 
     case AudioBackend::Null:
-      return AudioStream::CreateNullStream(sample_rate, channels, buffer_ms);
+      // nothing ever consumes from the null backend, so don't bother buffering either
+      return AudioStream::CreateNullSinkStream(sample_rate, channels);
 
     default:
       return nullptr;
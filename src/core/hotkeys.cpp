@@ -7,6 +7,7 @@
 #include "gpu.h"
 #include "host.h"
 #include "imgui_overlays.h"
+#include "input_movie.h"
 #include "pgxp.h"
 #include "settings.h"
 #include "spu.h"
@@ -16,8 +17,10 @@
 #include "util/gpu_device.h"
 #include "util/input_manager.h"
 #include "util/postprocessing.h"
+#include "util/thread_sampler.h"
 
 #include "common/file_system.h"
+#include "common/path.h"
 
 #include "IconsFontAwesome5.h"
 
@@ -160,6 +163,41 @@ DEFINE_HOTKEY("Screenshot", TRANSLATE_NOOP("Hotkeys", "General"), TRANSLATE_NOOP
                   System::SaveScreenshot();
               })
 
+DEFINE_HOTKEY("ToggleInputMovieRecord", TRANSLATE_NOOP("Hotkeys", "General"),
+              TRANSLATE_NOOP("Hotkeys", "Toggle Input Movie Recording"), [](s32 pressed) {
+                if (pressed || !System::IsValid())
+                  return;
+
+                if (InputMovie::IsActive())
+                  InputMovie::Stop();
+                else
+                  System::StartRecordingInputMovie();
+              })
+
+DEFINE_HOTKEY("ToggleSamplingProfiler", TRANSLATE_NOOP("Hotkeys", "General"),
+              TRANSLATE_NOOP("Hotkeys", "Toggle Sampling Profiler"), [](s32 pressed) {
+                if (pressed)
+                  return;
+
+                if (ThreadSampler::IsActive())
+                {
+                  ThreadSampler::Stop();
+
+                  const std::string path = Path::Combine(EmuFolders::DataRoot, "sampler.txt");
+                  if (ThreadSampler::WriteSummaryToFile(path.c_str()))
+                  {
+                    Host::AddKeyedOSDMessage(
+                      "ToggleSamplingProfiler",
+                      fmt::format(TRANSLATE_FS("OSDMessage", "Sample summary written to '{}'."), path), 10.0f);
+                  }
+                }
+                else if (ThreadSampler::Start(1000))
+                {
+                  Host::AddKeyedOSDMessage("ToggleSamplingProfiler",
+                                           TRANSLATE_STR("OSDMessage", "Sampling profiler started."), 5.0f);
+                }
+              })
+
 #if !defined(__ANDROID__) && defined(WITH_CHEEVOS)
 DEFINE_HOTKEY("OpenAchievements", TRANSLATE_NOOP("Hotkeys", "General"),
               TRANSLATE_NOOP("Hotkeys", "Open Achievement List"), [](s32 pressed) {
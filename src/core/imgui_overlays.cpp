@@ -2,11 +2,15 @@
 // SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
 
 #include "imgui_overlays.h"
+#include "bus.h"
 #include "cdrom.h"
 #include "controller.h"
+#include "cpu_code_cache.h"
 #include "dma.h"
+#include "frame_profiler.h"
 #include "fullscreen_ui.h"
 #include "gpu.h"
+#include "guest_profiler.h"
 #include "host.h"
 #include "mdec.h"
 #include "resources.h"
@@ -19,6 +23,7 @@
 #include "util/imgui_fullscreen.h"
 #include "util/imgui_manager.h"
 #include "util/input_manager.h"
+#include "util/thread_sampler.h"
 
 #include "common/align.h"
 #include "common/assert.h"
@@ -34,6 +39,7 @@
 #include "imgui_internal.h"
 
 #include <atomic>
+#include <bit>
 #include <chrono>
 #include <cmath>
 #include <deque>
@@ -76,8 +82,8 @@ static std::tuple<float, float> GetMinMax(std::span<const float> values)
   for (; i < aligned_count; i += 4)
   {
     const __m128 v(_mm_loadu_ps(&values[i]));
-    vmin = _mm_min_ps(v);
-    vmax = _mm_max_ps(v);
+    vmin = _mm_min_ps(vmin, v);
+    vmax = _mm_max_ps(vmax, v);
   }
 
 #ifdef _MSC_VER
@@ -104,8 +110,8 @@ static std::tuple<float, float> GetMinMax(std::span<const float> values)
   for (; i < aligned_count; i += 4)
   {
     const float32x4_t v(vld1q_f32(&values[i]));
-    vmin = vminq_f32(v);
-    vmax = vmaxq_f32(v);
+    vmin = vminq_f32(vmin, v);
+    vmax = vmaxq_f32(vmax, v);
   }
 
   float min = vminvq_f32(vmin);
@@ -231,6 +237,14 @@ void ImGuiManager::RenderDebugWindows()
       MDEC::DrawDebugStateWindow();
     if (g_settings.debugging.show_dma_state)
       DMA::DrawDebugStateWindow();
+    if (g_settings.debugging.show_bus_profiler)
+      Bus::DrawProfilerStateWindow();
+    if (g_settings.debugging.show_frame_profiler)
+      FrameProfiler::DrawDebugWindow();
+    if (g_settings.debugging.show_jit_stats)
+      CPU::CodeCache::DrawCodeQualityStatsWindow();
+    if (g_settings.debugging.show_guest_profiler)
+      GuestProfiler::DrawDebugWindow();
   }
 }
 
@@ -273,7 +287,7 @@ void ImGuiManager::FormatProcessorStat(String& text, double usage, double time)
 void ImGuiManager::DrawPerformanceOverlay()
 {
   if (!(g_settings.display_show_fps || g_settings.display_show_speed || g_settings.display_show_resolution ||
-        g_settings.display_show_cpu ||
+        g_settings.display_show_cpu || ThreadSampler::IsActive() ||
         (g_settings.display_show_status_indicators &&
          (System::IsPaused() || System::IsFastForwardEnabled() || System::IsTurboEnabled()))))
   {
@@ -410,15 +424,38 @@ void ImGuiManager::DrawPerformanceOverlay()
         DRAW_LINE(fixed_font, text, IM_COL32(255, 255, 255, 255));
       }
 
-#if 0
       {
-        AudioStream* stream = g_spu.GetOutputStream();
+        const u32 voice_mask = SPU::GetActiveVoiceMask();
+        text.Fmt("SPU: {:<2d} voices [{:06X}]", std::popcount(voice_mask), voice_mask);
+        DRAW_LINE(fixed_font, text, IM_COL32(255, 255, 255, 255));
+      }
+
+      {
+        AudioStream* stream = SPU::GetOutputStream();
         const u32 frames = stream->GetBufferedFramesRelaxed();
-        text.Clear();
-        text.Fmt("Audio: {:<4u}f/{:<3u}ms", frames, AudioStream::GetMSForBufferSize(stream->GetSampleRate(), frames));
+        text.Fmt("Audio: {:<4}f/{:<3}ms W{} U{}", frames,
+                 AudioStream::GetMSForBufferSize(stream->GetSampleRate(), frames), stream->GetWakeupCount(),
+                 stream->GetUnderrunCount());
+        DRAW_LINE(fixed_font, text, IM_COL32(255, 255, 255, 255));
+      }
+
+      if (g_settings.rewind_enable || g_settings.runahead_frames > 0)
+      {
+        const auto& sections = System::GetStateSerializationStats();
+        u32 total_bytes = 0;
+        float total_time = 0.0f;
+        const System::StateSectionStats* top = &sections[0];
+        for (const System::StateSectionStats& section : sections)
+        {
+          total_bytes += section.bytes;
+          total_time += section.time_ms;
+          if (section.bytes > top->bytes)
+            top = &section;
+        }
+        text.Fmt("State: {}KB/{:.2f}ms (top: {} {}KB/{:.2f}ms)", total_bytes / 1024, total_time, top->name,
+                 top->bytes / 1024, top->time_ms);
         DRAW_LINE(fixed_font, text, IM_COL32(255, 255, 255, 255));
       }
-#endif
     }
 
     if (g_settings.display_show_gpu && g_gpu_device->IsGPUTimingEnabled())
@@ -426,6 +463,26 @@ void ImGuiManager::DrawPerformanceOverlay()
       text.Assign("GPU: ");
       FormatProcessorStat(text, System::GetGPUUsage(), System::GetGPUAverageTime());
       DRAW_LINE(fixed_font, text, IM_COL32(255, 255, 255, 255));
+
+      for (const System::GPUTimerScope& scope : System::GetGPUTimerScopes())
+      {
+        text.Fmt("  {}: {:.2f}ms", scope.name, scope.time_ms);
+        DRAW_LINE(fixed_font, text, IM_COL32(255, 255, 255, 255));
+      }
+    }
+
+    if (ThreadSampler::IsActive())
+    {
+      const ThreadSampler::Stats stats = ThreadSampler::GetStats();
+      if (stats.total_samples > 0)
+      {
+        const double to_percent = 100.0 / static_cast<double>(stats.total_samples);
+        text.Fmt("Samples[{}]:", stats.total_samples);
+        for (const ThreadSampler::RangeStats& range : stats.ranges)
+          text.AppendFmtString(" {} {:.1f}%", range.name, static_cast<double>(range.samples) * to_percent);
+        text.AppendFmtString(" Host {:.1f}%", static_cast<double>(stats.host_samples) * to_percent);
+        DRAW_LINE(fixed_font, text, IM_COL32(255, 255, 255, 255));
+      }
     }
 
     if (g_settings.display_show_status_indicators)
@@ -499,6 +556,62 @@ void ImGuiManager::DrawPerformanceOverlay()
         ImGui::PopFont();
       }
       ImGui::End();
+
+      // Present cadence underneath, i.e. the intervals the display actually sees. A flat line here
+      // with a jittery frame time graph above means pacing is absorbing the emulation jitter.
+      ImGui::SetNextWindowSize(ImVec2(history_size.x, history_size.y));
+      ImGui::SetNextWindowPos(
+        ImVec2(ImGui::GetIO().DisplaySize.x - margin - history_size.x, position_y + history_size.y + spacing));
+      ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(0.5f, 1.0f, 0.5f, 1.0f));
+      if (ImGui::Begin("##present_times", nullptr, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoInputs))
+      {
+        ImGui::PushFont(fixed_font);
+
+        auto [min, max] = GetMinMax(System::GetPresentTimeHistory());
+        if ((max - min) < 4.0f)
+        {
+          min = min - std::fmod(min, 1.0f);
+          max = max - std::fmod(max, 1.0f) + 1.0f;
+          min = std::max(min - 2.0f, 0.0f);
+          max += 2.0f;
+        }
+
+        ImGui::PlotEx(
+          ImGuiPlotType_Lines, "##present_times",
+          [](void*, int idx) -> float {
+            return System::GetPresentTimeHistory()[((System::GetPresentTimeHistoryPos() + idx) %
+                                                    System::NUM_FRAME_TIME_SAMPLES)];
+          },
+          nullptr, System::NUM_FRAME_TIME_SAMPLES, 0, nullptr, min, max, history_size);
+
+        ImDrawList* win_dl = ImGui::GetCurrentWindow()->DrawList;
+        const ImVec2 wpos(ImGui::GetCurrentWindow()->Pos);
+
+        text.Clear();
+        text.AppendFmtString("{:.1f} ms", max);
+        text_size = fixed_font->CalcTextSizeA(fixed_font->FontSize, FLT_MAX, 0.0f, text.GetCharArray(),
+                                              text.GetCharArray() + text.GetLength());
+        win_dl->AddText(ImVec2(wpos.x + history_size.x - text_size.x - spacing + shadow_offset, wpos.y + shadow_offset),
+                        IM_COL32(0, 0, 0, 100), text.GetCharArray(), text.GetCharArray() + text.GetLength());
+        win_dl->AddText(ImVec2(wpos.x + history_size.x - text_size.x - spacing, wpos.y), IM_COL32(255, 255, 255, 255),
+                        text.GetCharArray(), text.GetCharArray() + text.GetLength());
+
+        text.Clear();
+        text.AppendFmtString("{:.1f} ms", min);
+        text_size = fixed_font->CalcTextSizeA(fixed_font->FontSize, FLT_MAX, 0.0f, text.GetCharArray(),
+                                              text.GetCharArray() + text.GetLength());
+        win_dl->AddText(ImVec2(wpos.x + history_size.x - text_size.x - spacing + shadow_offset,
+                               wpos.y + history_size.y - fixed_font->FontSize + shadow_offset),
+                        IM_COL32(0, 0, 0, 100), text.GetCharArray(), text.GetCharArray() + text.GetLength());
+        win_dl->AddText(
+          ImVec2(wpos.x + history_size.x - text_size.x - spacing, wpos.y + history_size.y - fixed_font->FontSize),
+          IM_COL32(255, 255, 255, 255), text.GetCharArray(), text.GetCharArray() + text.GetLength());
+
+        ImGui::PopFont();
+      }
+      ImGui::End();
+      ImGui::PopStyleColor();
+
       ImGui::PopStyleVar(5);
       ImGui::PopStyleColor(3);
     }
@@ -838,10 +951,13 @@ void SaveStateSelectorUI::InitializeListEntry(ListEntry* li, ExtendedSaveStateIn
     }
     else
     {
-      li->preview_texture = g_gpu_device->CreateTexture(
-        Resources::PLACEHOLDER_ICON_WIDTH, Resources::PLACEHOLDER_ICON_HEIGHT, 1, 1, 1, GPUTexture::Type::Texture,
-        GPUTexture::Format::RGBA8, Resources::PLACEHOLDER_ICON_DATA, sizeof(u32) * Resources::PLACEHOLDER_ICON_WIDTH,
-        false);
+      const std::vector<u32> placeholder_data = Resources::GetPlaceholderIconData();
+      if (!placeholder_data.empty())
+      {
+        li->preview_texture = g_gpu_device->CreateTexture(
+          Resources::PLACEHOLDER_ICON_WIDTH, Resources::PLACEHOLDER_ICON_HEIGHT, 1, 1, 1, GPUTexture::Type::Texture,
+          GPUTexture::Format::RGBA8, placeholder_data.data(), sizeof(u32) * Resources::PLACEHOLDER_ICON_WIDTH, false);
+      }
     }
 
     if (!li->preview_texture)
@@ -860,10 +976,13 @@ void SaveStateSelectorUI::InitializePlaceholderListEntry(ListEntry* li, std::str
 
   if (g_gpu_device)
   {
-    li->preview_texture = g_gpu_device->CreateTexture(
-      Resources::PLACEHOLDER_ICON_WIDTH, Resources::PLACEHOLDER_ICON_HEIGHT, 1, 1, 1, GPUTexture::Type::Texture,
-      GPUTexture::Format::RGBA8, Resources::PLACEHOLDER_ICON_DATA, sizeof(u32) * Resources::PLACEHOLDER_ICON_WIDTH,
-      false);
+    const std::vector<u32> placeholder_data = Resources::GetPlaceholderIconData();
+    if (!placeholder_data.empty())
+    {
+      li->preview_texture = g_gpu_device->CreateTexture(
+        Resources::PLACEHOLDER_ICON_WIDTH, Resources::PLACEHOLDER_ICON_HEIGHT, 1, 1, 1, GPUTexture::Type::Texture,
+        GPUTexture::Format::RGBA8, placeholder_data.data(), sizeof(u32) * Resources::PLACEHOLDER_ICON_WIDTH, false);
+    }
     if (!li->preview_texture)
       Log_ErrorPrintf("Failed to upload save state image to GPU");
   }
@@ -0,0 +1,280 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#include "input_movie.h"
+#include "controller.h"
+#include "host.h"
+#include "pad.h"
+#include "save_state_version.h"
+#include "settings.h"
+#include "system.h"
+
+#include "util/imgui_manager.h"
+#include "util/state_wrapper.h"
+
+#include "common/byte_stream.h"
+#include "common/log.h"
+
+#include <vector>
+
+Log_SetChannel(InputMovie);
+
+namespace InputMovie {
+enum class Mode
+{
+  None,
+  Record,
+  Play
+};
+
+// File layout: header, then the initial save state, then one size-prefixed input record per frame.
+// The frame count lives at a fixed offset so it can be patched in when recording finishes.
+static constexpr u32 MOVIE_SIGNATURE = 0x564D5344; // 'DSMV'
+static constexpr u32 MOVIE_VERSION = 1;
+static constexpr u32 FRAME_COUNT_OFFSET = 8;
+
+// Controller input state is a handful of buttons/axes plus transfer state, well under this.
+static constexpr u32 MAX_FRAME_RECORD_SIZE = 1024;
+
+static bool DoFrameState(StateWrapper& sw, bool apply_input_state);
+
+static Mode s_mode = Mode::None;
+static std::unique_ptr<ByteStream> s_stream;
+static u32 s_frame_number = 0;
+static u32 s_frame_count = 0;
+} // namespace InputMovie
+
+bool InputMovie::IsRecording()
+{
+  return (s_mode == Mode::Record);
+}
+
+bool InputMovie::IsPlaying()
+{
+  return (s_mode == Mode::Play);
+}
+
+bool InputMovie::IsActive()
+{
+  return (s_mode != Mode::None);
+}
+
+u32 InputMovie::GetFrameNumber()
+{
+  return s_frame_number;
+}
+
+bool InputMovie::DoFrameState(StateWrapper& sw, bool apply_input_state)
+{
+  // Controller presence/types are fixed by the header check at open, so only the input state of
+  // connected pads needs to travel per frame.
+  for (u32 i = 0; i < NUM_CONTROLLER_AND_CARD_PORTS; i++)
+  {
+    Controller* controller = Pad::GetController(i);
+    if (!controller)
+      continue;
+
+    if (!controller->DoState(sw, apply_input_state) || sw.HasError())
+      return false;
+  }
+
+  return true;
+}
+
+bool InputMovie::BeginRecording(const std::string& path)
+{
+  if (!System::IsValid())
+    return false;
+
+  if (s_mode != Mode::None)
+    Stop();
+
+  if (g_settings.rewind_enable || g_settings.runahead_frames > 0)
+    Log_WarningPrint("Rewind/runahead are enabled, the recorded movie may not replay deterministically.");
+
+  std::unique_ptr<ByteStream> stream = ByteStream::OpenFile(
+    path.c_str(), BYTESTREAM_OPEN_CREATE | BYTESTREAM_OPEN_TRUNCATE | BYTESTREAM_OPEN_WRITE | BYTESTREAM_OPEN_SEEKABLE);
+  if (!stream)
+  {
+    Log_ErrorPrintf("Failed to open movie file '%s'.", path.c_str());
+    return false;
+  }
+
+  std::unique_ptr<GrowableMemoryByteStream> state_stream = ByteStream::CreateGrowableMemoryStream();
+  if (!System::SaveStateToStream(state_stream.get(), 0, SAVE_STATE_HEADER::COMPRESSION_TYPE_NONE))
+  {
+    Log_ErrorPrint("Failed to save initial state for movie.");
+    return false;
+  }
+
+  u8 controller_types[NUM_CONTROLLER_AND_CARD_PORTS];
+  for (u32 i = 0; i < NUM_CONTROLLER_AND_CARD_PORTS; i++)
+  {
+    const Controller* controller = Pad::GetController(i);
+    controller_types[i] = static_cast<u8>(controller ? controller->GetType() : ControllerType::None);
+  }
+
+  const u32 state_size = static_cast<u32>(state_stream->GetSize());
+  if (!stream->WriteU32(MOVIE_SIGNATURE) || !stream->WriteU32(MOVIE_VERSION) ||
+      !stream->WriteU32(0) /* frame count, patched in Stop() */ ||
+      !stream->Write2(controller_types, sizeof(controller_types)) || !stream->WriteU32(state_size) ||
+      !stream->Write2(state_stream->GetMemoryPointer(), state_size))
+  {
+    Log_ErrorPrintf("Failed to write movie header to '%s'.", path.c_str());
+    return false;
+  }
+
+  s_stream = std::move(stream);
+  s_mode = Mode::Record;
+  s_frame_number = 0;
+  s_frame_count = 0;
+
+  Log_InfoPrintf("Recording input movie to '%s'.", path.c_str());
+  Host::AddFormattedOSDMessage(5.0f, TRANSLATE("OSDMessage", "Started recording input movie to '%s'."), path.c_str());
+  return true;
+}
+
+bool InputMovie::BeginPlayback(const std::string& path)
+{
+  if (!System::IsValid())
+    return false;
+
+  if (s_mode != Mode::None)
+    Stop();
+
+  std::unique_ptr<ByteStream> stream = ByteStream::OpenFile(path.c_str(), BYTESTREAM_OPEN_READ);
+  if (!stream)
+  {
+    Log_ErrorPrintf("Failed to open movie file '%s'.", path.c_str());
+    return false;
+  }
+
+  u32 signature, version, frame_count, state_size;
+  u8 controller_types[NUM_CONTROLLER_AND_CARD_PORTS];
+  if (!stream->ReadU32(&signature) || signature != MOVIE_SIGNATURE || !stream->ReadU32(&version) ||
+      version != MOVIE_VERSION || !stream->ReadU32(&frame_count) ||
+      !stream->Read2(controller_types, sizeof(controller_types)) || !stream->ReadU32(&state_size))
+  {
+    Log_ErrorPrintf("'%s' is not a valid movie file.", path.c_str());
+    return false;
+  }
+
+  for (u32 i = 0; i < NUM_CONTROLLER_AND_CARD_PORTS; i++)
+  {
+    const Controller* controller = Pad::GetController(i);
+    const ControllerType current_type = controller ? controller->GetType() : ControllerType::None;
+    if (static_cast<ControllerType>(controller_types[i]) != current_type)
+    {
+      Log_ErrorPrintf("Controller type mismatch in port %u: movie has %s, currently %s.", i + 1u,
+                      Settings::GetControllerTypeName(static_cast<ControllerType>(controller_types[i])),
+                      Settings::GetControllerTypeName(current_type));
+      return false;
+    }
+  }
+
+  // Pull the state into memory rather than letting the loader read from the file, so a short read
+  // can't leave the stream misaligned with the first frame record.
+  std::vector<u8> state_data(state_size);
+  if (state_size == 0 || !stream->Read2(state_data.data(), state_size))
+  {
+    Log_ErrorPrintf("'%s' is not a valid movie file.", path.c_str());
+    return false;
+  }
+
+  const std::unique_ptr<ReadOnlyMemoryByteStream> state_stream =
+    ByteStream::CreateReadOnlyMemoryStream(state_data.data(), state_size);
+  if (!System::LoadStateFromStream(state_stream.get(), true))
+  {
+    Log_ErrorPrintf("Failed to load initial state from movie '%s'.", path.c_str());
+    return false;
+  }
+
+  s_stream = std::move(stream);
+  s_mode = Mode::Play;
+  s_frame_number = 0;
+  s_frame_count = frame_count;
+
+  Log_InfoPrintf("Playing back %u frame input movie from '%s'.", frame_count, path.c_str());
+  Host::AddFormattedOSDMessage(5.0f, TRANSLATE("OSDMessage", "Started input movie playback from '%s'."), path.c_str());
+  return true;
+}
+
+void InputMovie::Stop()
+{
+  if (s_mode == Mode::None)
+    return;
+
+  if (s_mode == Mode::Record)
+  {
+    if (!s_stream->SeekAbsolute(FRAME_COUNT_OFFSET) || !s_stream->WriteU32(s_frame_number) || !s_stream->Flush())
+      Log_ErrorPrint("Failed to finalize movie frame count.");
+    else
+      Log_InfoPrintf("Finished recording %u frame input movie.", s_frame_number);
+  }
+  else
+  {
+    Log_InfoPrintf("Stopped input movie playback at frame %u/%u.", s_frame_number, s_frame_count);
+  }
+
+  s_stream.reset();
+  s_mode = Mode::None;
+  s_frame_number = 0;
+  s_frame_count = 0;
+}
+
+void InputMovie::ProcessFrame()
+{
+  if (s_mode == Mode::None)
+    return;
+
+  u8 buffer[MAX_FRAME_RECORD_SIZE];
+  if (s_mode == Mode::Record)
+  {
+    StateWrapper sw(buffer, sizeof(buffer), StateWrapper::Mode::Write, SAVE_STATE_VERSION);
+    if (!DoFrameState(sw, false))
+    {
+      Log_ErrorPrintf("Failed to serialize inputs for frame %u, stopping recording.", s_frame_number);
+      Stop();
+      return;
+    }
+
+    const u32 record_size = static_cast<u32>(sw.GetPosition());
+    if (!s_stream->WriteU32(record_size) || !s_stream->Write2(buffer, record_size))
+    {
+      Log_ErrorPrintf("Failed to write movie frame %u, stopping recording.", s_frame_number);
+      Stop();
+      return;
+    }
+
+    s_frame_number++;
+  }
+  else
+  {
+    if (s_frame_number >= s_frame_count)
+    {
+      Host::AddFormattedOSDMessage(10.0f, TRANSLATE("OSDMessage", "Input movie finished after %u frames."),
+                                   s_frame_number);
+      Stop();
+      return;
+    }
+
+    u32 record_size;
+    if (!s_stream->ReadU32(&record_size) || record_size > MAX_FRAME_RECORD_SIZE ||
+        !s_stream->Read2(buffer, record_size))
+    {
+      Log_ErrorPrintf("Failed to read movie frame %u, stopping playback.", s_frame_number);
+      Stop();
+      return;
+    }
+
+    StateWrapper sw(buffer, record_size, StateWrapper::Mode::Read, SAVE_STATE_VERSION);
+    if (!DoFrameState(sw, true))
+    {
+      Log_ErrorPrintf("Failed to apply inputs for frame %u, stopping playback.", s_frame_number);
+      Stop();
+      return;
+    }
+
+    s_frame_number++;
+  }
+}
@@ -0,0 +1,35 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#pragma once
+#include "types.h"
+#include <string>
+
+// Input movies capture the initial system state plus each controller's input state at every frame
+// boundary, giving a byte-identical workload across runs. Used for deterministic benchmarking and
+// A/B comparisons of recompiler/rasterizer changes.
+namespace InputMovie {
+
+bool IsRecording();
+bool IsPlaying();
+bool IsActive();
+
+/// Frame counter within the movie, for OSD/logging.
+u32 GetFrameNumber();
+
+/// Starts recording to the given file. The system must be valid; the current state is embedded in
+/// the movie so playback always starts from the same point.
+bool BeginRecording(const std::string& path);
+
+/// Loads the state embedded in the movie and applies its recorded inputs each frame until the
+/// movie runs out. Controller types must match those at record time.
+bool BeginPlayback(const std::string& path);
+
+/// Finalizes a recording, or stops playback early. Called automatically on system shutdown.
+void Stop();
+
+/// Called once per frame by the system after host input has been polled, either capturing the
+/// polled state (recording) or overriding it with the recorded state (playback).
+void ProcessFrame();
+
+} // namespace InputMovie
@@ -14,12 +14,23 @@
 #include "common/bitfield.h"
 #include "common/fifo_queue.h"
 #include "common/log.h"
+#include "common/platform.h"
 
 #include "imgui.h"
 
 #include <array>
 #include <memory>
 
+#if defined(CPU_X64)
+#include <emmintrin.h>
+#elif defined(CPU_AARCH64)
+#ifdef _MSC_VER
+#include <arm64_neon.h>
+#else
+#include <arm_neon.h>
+#endif
+#endif
+
 Log_SetChannel(MDEC);
 
 namespace MDEC {
@@ -113,6 +124,7 @@ static bool rl_decode_block(s16* blk, const u8* qt);
 static void IDCT(s16* blk);
 static void IDCT_New(s16* blk);
 static void IDCT_Old(s16* blk);
+static void UpdateIDCTMatrix();
 static void yuv_to_rgb(u32 xx, u32 yy, const std::array<s16, 64>& Crblk, const std::array<s16, 64>& Cbblk,
                        const std::array<s16, 64>& Yblk);
 static void y_to_mono(const std::array<s16, 64>& Yblk);
@@ -132,6 +144,10 @@ static std::array<u8, 64> s_iq_y{};
 
 static std::array<s16, 64> s_scale_table{};
 
+// Derived from s_scale_table for the vectorized IDCT: pre-divided by 8, and laid out for the target's
+// multiply-accumulate instructions. Not serialized, rebuilt when the scale table changes.
+alignas(16) static std::array<s16, 64> s_idct_matrix{};
+
 // blocks, for colour: 0 - Crblk, 1 - Cbblk, 2-5 - Y 1-4
 static std::array<std::array<s16, 64>, NUM_BLOCKS> s_blocks;
 static u32 s_current_block = 0;        // block (0-5)
@@ -184,7 +200,10 @@ bool MDEC::DoState(StateWrapper& sw)
   bool block_copy_out_pending = HasPendingBlockCopyOut();
   sw.Do(&block_copy_out_pending);
   if (sw.IsReading())
+  {
     s_block_copy_out_event->SetState(block_copy_out_pending);
+    UpdateIDCTMatrix();
+  }
 
   return !sw.HasError();
 }
@@ -775,15 +794,110 @@ void MDEC::IDCT(s16* blk)
     IDCT_New(blk);
 }
 
+void MDEC::UpdateIDCTMatrix()
+{
+#if defined(CPU_X64)
+  // z-pairs interleaved so PMADDWD accumulates two coefficients per lane: [p * 16 + x * 2 + j] holds
+  // s_scale_table[x + (p * 2 + j) * 8] / 8.
+  for (u32 p = 0; p < 4; p++)
+  {
+    for (u32 x = 0; x < 8; x++)
+    {
+      for (u32 j = 0; j < 2; j++)
+        s_idct_matrix[p * 16 + x * 2 + j] = static_cast<s16>(s_scale_table[x + (p * 2 + j) * 8] / 8);
+    }
+  }
+#elif defined(CPU_AARCH64)
+  // Transposed to row-major so each z row is contiguous in x: [z * 8 + x] holds s_scale_table[x + z * 8] / 8.
+  for (u32 z = 0; z < 8; z++)
+  {
+    for (u32 x = 0; x < 8; x++)
+      s_idct_matrix[z * 8 + x] = static_cast<s16>(s_scale_table[x + z * 8] / 8);
+  }
+#endif
+}
+
+#if defined(CPU_X64) || defined(CPU_AARCH64)
+
+namespace MDEC {
+
+// One pass of the separable IDCT: out[x + y*8] = TruncDiv(sum_z(in[y + z*8] * (scale[x + z*8] / 8)) + 0xfff, 0x2000).
+// Intermediate values fit in 16 bits (coefficients are clamped to [-0x400, 0x3FF] and the scale entries to
+// +/-0x1000 after the divide), so both passes run on 16-bit lanes with 32-bit accumulation.
+template<bool clamp_output>
+static void IDCTPass(s16* out, const s16* in)
+{
+#if defined(CPU_X64)
+  for (u32 y = 0; y < 8; y++)
+  {
+    __m128i sum_lo = _mm_setzero_si128();
+    __m128i sum_hi = _mm_setzero_si128();
+    for (u32 p = 0; p < 4; p++)
+    {
+      const u32 pair = ZeroExtend32(static_cast<u16>(in[y + (p * 2) * 8])) |
+                       (ZeroExtend32(static_cast<u16>(in[y + (p * 2 + 1) * 8])) << 16);
+      const __m128i in_pair = _mm_set1_epi32(static_cast<int>(pair));
+      sum_lo = _mm_add_epi32(
+        sum_lo, _mm_madd_epi16(in_pair, _mm_load_si128(reinterpret_cast<const __m128i*>(&s_idct_matrix[p * 16]))));
+      sum_hi = _mm_add_epi32(
+        sum_hi, _mm_madd_epi16(in_pair, _mm_load_si128(reinterpret_cast<const __m128i*>(&s_idct_matrix[p * 16 + 8]))));
+    }
+
+    // (sum + 0xfff) / 0x2000 with truncation towards zero, as per the scalar division.
+    const auto divide = [](__m128i sum) {
+      __m128i value = _mm_add_epi32(sum, _mm_set1_epi32(0xfff));
+      value = _mm_add_epi32(value, _mm_and_si128(_mm_srai_epi32(value, 31), _mm_set1_epi32(0x1fff)));
+      return _mm_srai_epi32(value, 13);
+    };
+
+    __m128i result = _mm_packs_epi32(divide(sum_lo), divide(sum_hi));
+    if constexpr (clamp_output)
+      result = _mm_min_epi16(_mm_max_epi16(result, _mm_set1_epi16(-128)), _mm_set1_epi16(127));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&out[y * 8]), result);
+  }
+#elif defined(CPU_AARCH64)
+  for (u32 y = 0; y < 8; y++)
+  {
+    int32x4_t sum_lo = vdupq_n_s32(0);
+    int32x4_t sum_hi = vdupq_n_s32(0);
+    for (u32 z = 0; z < 8; z++)
+    {
+      const int16x4_t coeff = vdup_n_s16(in[y + z * 8]);
+      sum_lo = vmlal_s16(sum_lo, coeff, vld1_s16(&s_idct_matrix[z * 8]));
+      sum_hi = vmlal_s16(sum_hi, coeff, vld1_s16(&s_idct_matrix[z * 8 + 4]));
+    }
+
+    // (sum + 0xfff) / 0x2000 with truncation towards zero, as per the scalar division.
+    const auto divide = [](int32x4_t sum) {
+      int32x4_t value = vaddq_s32(sum, vdupq_n_s32(0xfff));
+      value = vaddq_s32(value, vandq_s32(vshrq_n_s32(value, 31), vdupq_n_s32(0x1fff)));
+      return vshrq_n_s32(value, 13);
+    };
+
+    int16x8_t result = vcombine_s16(vqmovn_s32(divide(sum_lo)), vqmovn_s32(divide(sum_hi)));
+    if constexpr (clamp_output)
+      result = vminq_s16(vmaxq_s16(result, vdupq_n_s16(-128)), vdupq_n_s16(127));
+    vst1q_s16(&out[y * 8], result);
+  }
+#endif
+}
+
+} // namespace MDEC
+
+#endif // defined(CPU_X64) || defined(CPU_AARCH64)
+
 void MDEC::IDCT_New(s16* blk)
 {
+#if defined(CPU_X64) || defined(CPU_AARCH64)
+  alignas(16) std::array<s16, 64> temp;
+  IDCTPass<false>(temp.data(), blk);
+  IDCTPass<true>(blk, temp.data());
+#else
   std::array<s32, 64> temp;
   for (u32 x = 0; x < 8; x++)
   {
     for (u32 y = 0; y < 8; y++)
     {
-      // TODO: We could alter zigzag and invert scale_table to get these in row-major order,
-      // in which case we could do optimize this to a vector multiply.
       s32 sum = 0;
       for (u32 z = 0; z < 8; z++)
         sum += s32(blk[y + z * 8]) * s32(s_scale_table[x + z * 8] / 8);
@@ -800,6 +914,7 @@ void MDEC::IDCT_New(s16* blk)
       blk[x + y * 8] = static_cast<s16>(std::clamp<s32>((sum + 0xfff) / 0x2000, -128, 127));
     }
   }
+#endif
 }
 
 void MDEC::IDCT_Old(s16* blk)
@@ -833,6 +948,107 @@ void MDEC::yuv_to_rgb(u32 xx, u32 yy, const std::array<s16, 64>& Crblk, const st
                       const std::array<s16, 64>& Yblk)
 {
   const s16 addval = s_status.data_output_signed ? 0 : 0x80;
+
+#if defined(CPU_X64)
+  // Same math as the scalar path below, eight pixels per row: the chroma samples are duplicated for the 2x2
+  // subsampling, scaled in single-precision floats with truncating conversions to match the scalar casts, and
+  // the overlapping 16-bit fields are OR'd together in 32-bit lanes.
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i addval_vec = _mm_set1_epi16(addval);
+  const auto widen_lo = [&zero](__m128i value) { return _mm_srai_epi32(_mm_unpacklo_epi16(zero, value), 16); };
+  const auto widen_hi = [&zero](__m128i value) { return _mm_srai_epi32(_mm_unpackhi_epi16(zero, value), 16); };
+  const auto clamp_and_offset = [&addval_vec](__m128i lo, __m128i hi) {
+    const __m128i value = _mm_min_epi16(_mm_max_epi16(_mm_packs_epi32(lo, hi), _mm_set1_epi16(-128)),
+                                        _mm_set1_epi16(127));
+    return _mm_add_epi16(value, addval_vec);
+  };
+
+  for (u32 y = 0; y < 8; y++)
+  {
+    const u32 chroma_offset = (xx / 2) + (((y + yy) / 2) * 8);
+    const __m128i cr4 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&Crblk[chroma_offset]));
+    const __m128i cb4 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&Cbblk[chroma_offset]));
+    const __m128i cr8 = _mm_unpacklo_epi16(cr4, cr4);
+    const __m128i cb8 = _mm_unpacklo_epi16(cb4, cb4);
+    const __m128i yv = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&Yblk[y * 8]));
+
+    const __m128 cr_lo = _mm_cvtepi32_ps(widen_lo(cr8));
+    const __m128 cr_hi = _mm_cvtepi32_ps(widen_hi(cr8));
+    const __m128 cb_lo = _mm_cvtepi32_ps(widen_lo(cb8));
+    const __m128 cb_hi = _mm_cvtepi32_ps(widen_hi(cb8));
+
+    const __m128i r_lo = _mm_cvttps_epi32(_mm_mul_ps(cr_lo, _mm_set1_ps(1.402f)));
+    const __m128i r_hi = _mm_cvttps_epi32(_mm_mul_ps(cr_hi, _mm_set1_ps(1.402f)));
+    const __m128i g_lo = _mm_cvttps_epi32(
+      _mm_add_ps(_mm_mul_ps(cb_lo, _mm_set1_ps(-0.3437f)), _mm_mul_ps(cr_lo, _mm_set1_ps(-0.7143f))));
+    const __m128i g_hi = _mm_cvttps_epi32(
+      _mm_add_ps(_mm_mul_ps(cb_hi, _mm_set1_ps(-0.3437f)), _mm_mul_ps(cr_hi, _mm_set1_ps(-0.7143f))));
+    const __m128i b_lo = _mm_cvttps_epi32(_mm_mul_ps(cb_lo, _mm_set1_ps(1.772f)));
+    const __m128i b_hi = _mm_cvttps_epi32(_mm_mul_ps(cb_hi, _mm_set1_ps(1.772f)));
+
+    const __m128i y_lo = widen_lo(yv);
+    const __m128i y_hi = widen_hi(yv);
+
+    const __m128i r16 = clamp_and_offset(_mm_add_epi32(y_lo, r_lo), _mm_add_epi32(y_hi, r_hi));
+    const __m128i g16 = clamp_and_offset(_mm_add_epi32(y_lo, g_lo), _mm_add_epi32(y_hi, g_hi));
+    const __m128i b16 = clamp_and_offset(_mm_add_epi32(y_lo, b_lo), _mm_add_epi32(y_hi, b_hi));
+
+    u32* out_ptr = &s_block_rgb[xx + ((y + yy) * 16)];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out_ptr),
+                     _mm_or_si128(_mm_unpacklo_epi16(r16, zero),
+                                  _mm_or_si128(_mm_slli_epi32(_mm_unpacklo_epi16(g16, zero), 8),
+                                               _mm_slli_epi32(_mm_unpacklo_epi16(b16, zero), 16))));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out_ptr + 4),
+                     _mm_or_si128(_mm_unpackhi_epi16(r16, zero),
+                                  _mm_or_si128(_mm_slli_epi32(_mm_unpackhi_epi16(g16, zero), 8),
+                                               _mm_slli_epi32(_mm_unpackhi_epi16(b16, zero), 16))));
+  }
+#elif defined(CPU_AARCH64)
+  // Same math as the scalar path below, eight pixels per row: the chroma samples are duplicated for the 2x2
+  // subsampling, scaled in single-precision floats with truncating conversions to match the scalar casts, and
+  // the overlapping 16-bit fields are OR'd together in 32-bit lanes.
+  const int16x8_t addval_vec = vdupq_n_s16(addval);
+  const auto clamp_and_offset = [&addval_vec](int32x4_t lo, int32x4_t hi) {
+    const int16x8_t value =
+      vminq_s16(vmaxq_s16(vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi)), vdupq_n_s16(-128)), vdupq_n_s16(127));
+    return vaddq_s16(value, addval_vec);
+  };
+
+  for (u32 y = 0; y < 8; y++)
+  {
+    const u32 chroma_offset = (xx / 2) + (((y + yy) / 2) * 8);
+    const int16x4x2_t cr8 = vzip_s16(vld1_s16(&Crblk[chroma_offset]), vld1_s16(&Crblk[chroma_offset]));
+    const int16x4x2_t cb8 = vzip_s16(vld1_s16(&Cbblk[chroma_offset]), vld1_s16(&Cbblk[chroma_offset]));
+    const int16x8_t yv = vld1q_s16(&Yblk[y * 8]);
+
+    const float32x4_t cr_lo = vcvtq_f32_s32(vmovl_s16(cr8.val[0]));
+    const float32x4_t cr_hi = vcvtq_f32_s32(vmovl_s16(cr8.val[1]));
+    const float32x4_t cb_lo = vcvtq_f32_s32(vmovl_s16(cb8.val[0]));
+    const float32x4_t cb_hi = vcvtq_f32_s32(vmovl_s16(cb8.val[1]));
+
+    const int32x4_t r_lo = vcvtq_s32_f32(vmulq_n_f32(cr_lo, 1.402f));
+    const int32x4_t r_hi = vcvtq_s32_f32(vmulq_n_f32(cr_hi, 1.402f));
+    const int32x4_t g_lo = vcvtq_s32_f32(vaddq_f32(vmulq_n_f32(cb_lo, -0.3437f), vmulq_n_f32(cr_lo, -0.7143f)));
+    const int32x4_t g_hi = vcvtq_s32_f32(vaddq_f32(vmulq_n_f32(cb_hi, -0.3437f), vmulq_n_f32(cr_hi, -0.7143f)));
+    const int32x4_t b_lo = vcvtq_s32_f32(vmulq_n_f32(cb_lo, 1.772f));
+    const int32x4_t b_hi = vcvtq_s32_f32(vmulq_n_f32(cb_hi, 1.772f));
+
+    const int32x4_t y_lo = vmovl_s16(vget_low_s16(yv));
+    const int32x4_t y_hi = vmovl_s16(vget_high_s16(yv));
+
+    const uint16x8_t r16 = vreinterpretq_u16_s16(clamp_and_offset(vaddq_s32(y_lo, r_lo), vaddq_s32(y_hi, r_hi)));
+    const uint16x8_t g16 = vreinterpretq_u16_s16(clamp_and_offset(vaddq_s32(y_lo, g_lo), vaddq_s32(y_hi, g_hi)));
+    const uint16x8_t b16 = vreinterpretq_u16_s16(clamp_and_offset(vaddq_s32(y_lo, b_lo), vaddq_s32(y_hi, b_hi)));
+
+    u32* out_ptr = &s_block_rgb[xx + ((y + yy) * 16)];
+    vst1q_u32(out_ptr, vorrq_u32(vmovl_u16(vget_low_u16(r16)),
+                                 vorrq_u32(vshlq_n_u32(vmovl_u16(vget_low_u16(g16)), 8),
+                                           vshlq_n_u32(vmovl_u16(vget_low_u16(b16)), 16))));
+    vst1q_u32(out_ptr + 4, vorrq_u32(vmovl_u16(vget_high_u16(r16)),
+                                     vorrq_u32(vshlq_n_u32(vmovl_u16(vget_high_u16(g16)), 8),
+                                               vshlq_n_u32(vmovl_u16(vget_high_u16(b16)), 16))));
+  }
+#else
   for (u32 y = 0; y < 8; y++)
   {
     for (u32 x = 0; x < 8; x++)
@@ -854,6 +1070,7 @@ void MDEC::yuv_to_rgb(u32 xx, u32 yy, const std::array<s16, 64>& Crblk, const st
                                                 (ZeroExtend32(static_cast<u16>(B)) << 16);
     }
   }
+#endif
 }
 
 void MDEC::y_to_mono(const std::array<s16, 64>& Yblk)
@@ -896,6 +1113,7 @@ void MDEC::HandleSetScaleCommand()
   s_data_in_fifo.PopRange(packed_data.data(), static_cast<u32>(packed_data.size()));
   s_remaining_halfwords -= 32;
   std::memcpy(s_scale_table.data(), packed_data.data(), s_scale_table.size() * sizeof(s16));
+  UpdateIDCTMatrix();
 }
 
 void MDEC::DrawDebugStateWindow()
@@ -33,6 +33,7 @@ MemoryCard::MemoryCard()
 MemoryCard::~MemoryCard()
 {
   SaveIfChanged(false);
+  WaitForFlush();
 }
 
 std::string MemoryCard::SanitizeGameTitleForFileName(const std::string_view& name)
@@ -307,6 +308,9 @@ bool MemoryCard::SaveIfChanged(bool display_osd_message)
 {
   m_save_event->Deactivate();
 
+  // wait for the previous flush first, so writes to the same file keep their order
+  WaitForFlush();
+
   if (!m_changed)
     return true;
 
@@ -323,29 +327,40 @@ bool MemoryCard::SaveIfChanged(bool display_osd_message)
     display_name = FileSystem::GetDisplayNameFromPath(m_filename);
   }
 
-  if (!MemoryCardImage::SaveToFile(m_data, m_filename.c_str()))
-  {
+  // snapshot the image and write it out on a worker thread. SaveToFile() goes through an
+  // atomic update (temp file + rename), so a crash mid-flush leaves the previous image intact.
+  m_flush_thread = std::thread([data = m_data, filename = m_filename, display_osd_message,
+                                osd_key = std::move(osd_key), display_name = std::move(display_name)]() mutable {
+    if (!MemoryCardImage::SaveToFile(data, filename.c_str()))
+    {
+      if (display_osd_message)
+      {
+        Host::AddIconOSDMessage(std::move(osd_key), ICON_FA_SD_CARD,
+                                fmt::format(TRANSLATE_FS("OSDMessage", "Failed to save memory card to '{}'."),
+                                            Path::GetFileName(display_name)),
+                                20.0f);
+      }
+
+      return;
+    }
+
     if (display_osd_message)
     {
       Host::AddIconOSDMessage(
         std::move(osd_key), ICON_FA_SD_CARD,
-        fmt::format(TRANSLATE_FS("OSDMessage", "Failed to save memory card to '{}'."), Path::GetFileName(display_name)),
-        20.0f);
+        fmt::format(TRANSLATE_FS("OSDMessage", "Saved memory card to '{}'."), Path::GetFileName(display_name)), 5.0f);
     }
-
-    return false;
-  }
-
-  if (display_osd_message)
-  {
-    Host::AddIconOSDMessage(
-      std::move(osd_key), ICON_FA_SD_CARD,
-      fmt::format(TRANSLATE_FS("OSDMessage", "Saved memory card to '{}'."), Path::GetFileName(display_name)), 5.0f);
-  }
+  });
 
   return true;
 }
 
+void MemoryCard::WaitForFlush()
+{
+  if (m_flush_thread.joinable())
+    m_flush_thread.join();
+}
+
 void MemoryCard::QueueFileSave()
 {
   // skip if the event is already pending, or we don't have a backing file
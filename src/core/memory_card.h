@@ -9,6 +9,7 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <thread>
 
 class TimingEvent;
 
@@ -86,6 +87,7 @@ private:
   bool LoadFromFile();
   bool SaveIfChanged(bool display_osd_message);
   void QueueFileSave();
+  void WaitForFlush();
 
   std::unique_ptr<TimingEvent> m_save_event;
 
@@ -100,4 +102,8 @@ private:
   MemoryCardImage::DataArray m_data{};
 
   std::string m_filename;
+
+  // flushes happen on a worker thread with a snapshot of the image, so a slow disk (or network
+  // home directory) never stalls the emulation thread. at most one flush is in flight per card.
+  std::thread m_flush_thread;
 };
@@ -84,6 +84,7 @@ static bool ShouldAvoidSavingToState();
 static u32 GetMaximumRollbackFrames();
 
 static TickCount GetTransferTicks();
+static TickCount GetPredictedACKTicks();
 
 // From @JaCzekanski
 // ACK lasts ~96 ticks or approximately 2.84us at master clock (not implemented).
@@ -123,6 +124,8 @@ static JOY_MODE s_JOY_MODE = {};
 static u16 s_JOY_BAUD = 0;
 
 static ActiveDevice s_active_device = ActiveDevice::None;
+static bool s_transfer_batched = false;
+static TickCount s_batched_ack_ticks = 0;
 static u8 s_receive_buffer = 0;
 static u8 s_transmit_buffer = 0;
 static u8 s_transmit_value = 0;
@@ -520,6 +523,19 @@ bool Pad::DoState(StateWrapper& sw, bool is_memory_state)
   sw.Do(&s_receive_buffer_full);
   sw.Do(&s_transmit_buffer_full);
 
+  if (sw.GetVersion() >= 60)
+  {
+    sw.Do(&s_transfer_batched);
+    sw.Do(&s_batched_ack_ticks);
+  }
+  else if (sw.IsReading())
+  {
+    // Old state with a transfer in flight: the event fires at the transfer deadline and the ACK is scheduled
+    // separately, so the unbatched values are the correct ones.
+    s_transfer_batched = false;
+    s_batched_ack_ticks = 0;
+  }
+
   if (sw.IsReading() && IsTransmitting())
     s_transfer_event->Activate();
 
@@ -693,6 +709,26 @@ TickCount Pad::GetTransferTicks()
   return static_cast<TickCount>(ZeroExtend32(s_JOY_BAUD) * 8);
 }
 
+TickCount Pad::GetPredictedACKTicks()
+{
+  // Predict which device will respond to this byte, so the ACK delay can be folded into the same event as the
+  // transfer itself. Mid-exchange the responding device is already known; for a new exchange the address byte
+  // selects it (0x81 for the memory card, anything else responds at controller speed or not at all).
+  switch (s_active_device)
+  {
+    case ActiveDevice::MemoryCard:
+      return GetACKTicks(true);
+
+    case ActiveDevice::Multitap:
+      return GetACKTicks(s_multitaps[s_JOY_CTRL.SLOT].IsReadingMemoryCard());
+
+    case ActiveDevice::Controller:
+    case ActiveDevice::None:
+    default:
+      return GetACKTicks(s_active_device == ActiveDevice::None && s_transmit_value == 0x81);
+  }
+}
+
 void Pad::SoftReset()
 {
   if (IsTransmitting())
@@ -749,7 +785,21 @@ void Pad::BeginTransfer()
   // until after (4) and (5) have been completed.
 
   s_state = State::Transmitting;
-  s_transfer_event->SetPeriodAndSchedule(GetTransferTicks());
+
+  // Standard libpad polling raises ACKINTEN and sleeps on IRQ7, so nothing observes the window between the byte
+  // completing and the ACK arriving. Fold the predicted ACK delay into the transfer event, which costs one event
+  // per byte instead of two; DoTransfer() corrects the rare misprediction. This matters with multitaps, where a
+  // single frame's polling is several hundred byte exchanges.
+  s_transfer_batched = s_JOY_CTRL.ACKINTEN;
+  if (s_transfer_batched)
+  {
+    s_batched_ack_ticks = GetPredictedACKTicks();
+    s_transfer_event->SetPeriodAndSchedule(GetTransferTicks() + s_batched_ack_ticks);
+  }
+  else
+  {
+    s_transfer_event->SetPeriodAndSchedule(GetTransferTicks());
+  }
 }
 
 void Pad::DoTransfer(TickCount ticks_late)
@@ -866,9 +916,20 @@ void Pad::DoTransfer(TickCount ticks_late)
       (s_active_device == ActiveDevice::Multitap && s_multitaps[s_JOY_CTRL.SLOT].IsReadingMemoryCard());
 
     const TickCount ack_timer = GetACKTicks(memcard_transfer);
-    Log_DebugPrintf("Delaying ACK for %d ticks", ack_timer);
-    s_state = State::WaitingForACK;
-    s_transfer_event->SetPeriodAndSchedule(ack_timer);
+    if (s_transfer_batched && ack_timer <= s_batched_ack_ticks)
+    {
+      // ACK delay was already folded into this event, raise the interrupt now. If the prediction was too long
+      // (a memory card answering a controller-addressed exchange), the ACK slips by the difference, which only
+      // non-standard polling sequences can hit.
+      DoACK();
+    }
+    else
+    {
+      const TickCount remaining_ticks = s_transfer_batched ? (ack_timer - s_batched_ack_ticks) : ack_timer;
+      Log_DebugPrintf("Delaying ACK for %d ticks", remaining_ticks);
+      s_state = State::WaitingForACK;
+      s_transfer_event->SetPeriodAndSchedule(remaining_ticks);
+    }
   }
 
   UpdateJoyStat();
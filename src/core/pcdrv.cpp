@@ -6,14 +6,34 @@
 #include "common/log.h"
 #include "common/path.h"
 #include "common/string_util.h"
+#include "common/threading.h"
+#include "common/thirdparty/thread_pool.h"
 #include "cpu_core.h"
 #include "settings.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
 Log_SetChannel(PCDrv);
 
 static constexpr u32 MAX_FILES = 100;
 
 static std::vector<FileSystem::ManagedCFilePtr> s_files;
 
+// Blocking host I/O (opens and bulk transfers) runs on the shared thread pool while the guest
+// re-executes the break instruction, so a slow host filesystem (e.g. a network path) stalls the
+// guest the way real hardware latency would instead of freezing the whole emulation thread. Only
+// one request can be in flight, since the guest is parked on the syscall until it completes.
+static bool s_async_pending = false;
+static std::atomic_bool s_async_done{false};
+static bool s_async_error = false;
+static s32 s_async_handle = -1;
+static std::string s_async_filename;
+static FileSystem::ManagedCFilePtr s_async_file(nullptr, FileSystem::FileDeleter());
+static std::vector<u8> s_async_buffer;
+
 enum PCDrvAttribute : u32
 {
   PCDRV_ATTRIBUTE_READ_ONLY = (1 << 0),
@@ -75,6 +95,20 @@ static bool CloseFileHandle(u32 handle)
   return true;
 }
 
+static void WaitForAsyncOp()
+{
+  if (!s_async_pending)
+    return;
+
+  // The files the worker touches are about to go away, so there's no option but to block here.
+  while (!s_async_done.load(std::memory_order_acquire))
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+  s_async_pending = false;
+  s_async_file.reset();
+  s_async_buffer = {};
+}
+
 static std::string ResolveHostPath(const std::string& path)
 {
   // Double-check that it falls within the directory of the elf.
@@ -105,15 +139,17 @@ void PCDrv::Initialize()
 
 void PCDrv::Reset()
 {
+  WaitForAsyncOp();
   CloseAllFiles();
 }
 
 void PCDrv::Shutdown()
 {
+  WaitForAsyncOp();
   CloseAllFiles();
 }
 
-bool PCDrv::HandleSyscall(u32 instruction_bits, CPU::Registers& regs)
+PCDrv::SyscallResult PCDrv::HandleSyscall(u32 instruction_bits, CPU::Registers& regs)
 {
   // Based on https://problemkaputt.de/psxspx-bios-pc-file-server.htm
 
@@ -122,9 +158,79 @@ bool PCDrv::HandleSyscall(u32 instruction_bits, CPU::Registers& regs)
   regs.v1 = 0xffffffff; // error code
 
   if (!g_settings.pcdrv_enable)
-    return false;
+    return SyscallResult::NotHandled;
 
   const u32 code = (instruction_bits >> 6) & 0xfffff; // 20 bits, funct = 0
+
+  // Completion of an in-flight request. The guest has been re-executing the same break instruction
+  // while the worker ran, so the arguments in the registers are unchanged.
+  if (s_async_pending)
+  {
+    if (!s_async_done.load(std::memory_order_acquire))
+      return SyscallResult::Stalled;
+
+    s_async_pending = false;
+    switch (code)
+    {
+      case 0x102: // PCcreat
+      case 0x103: // PCopen
+      {
+        if (!s_async_file)
+        {
+          Log_ErrorPrintf("%s: Failed to open '%s'", (code == 0x102) ? "PCcreat" : "PCopen", s_async_filename.c_str());
+          RETURN_ERROR();
+          return SyscallResult::Completed;
+        }
+
+        Log_DebugPrintf("PCDrv: Opened '%s' => %d", s_async_filename.c_str(), s_async_handle);
+        s_files[s_async_handle] = std::move(s_async_file);
+        regs.v0 = 0;
+        regs.v1 = static_cast<u32>(s_async_handle);
+        return SyscallResult::Completed;
+      }
+
+      case 0x105: // PCread
+      {
+        if (s_async_error)
+        {
+          RETURN_ERROR();
+          return SyscallResult::Completed;
+        }
+
+        u32 dstaddr = regs.a3;
+        for (const u8 val : s_async_buffer)
+        {
+          CPU::SafeWriteMemoryByte(dstaddr, val);
+          dstaddr++;
+        }
+
+        regs.v0 = 0;
+        regs.v1 = static_cast<u32>(s_async_buffer.size());
+        return SyscallResult::Completed;
+      }
+
+      case 0x106: // PCwrite
+      {
+        if (s_async_error)
+        {
+          RETURN_ERROR();
+          return SyscallResult::Completed;
+        }
+
+        regs.v0 = 0;
+        regs.v1 = static_cast<u32>(s_async_buffer.size());
+        return SyscallResult::Completed;
+      }
+
+      default:
+      {
+        Log_ErrorPrintf("Unexpected completion for syscall 0x%x", code);
+        RETURN_ERROR();
+        return SyscallResult::Completed;
+      }
+    }
+  }
+
   switch (code)
   {
     case 0x101: // PCinit
@@ -133,7 +239,7 @@ bool PCDrv::HandleSyscall(u32 instruction_bits, CPU::Registers& regs)
       CloseAllFiles();
       regs.v0 = 0;
       regs.v1 = 0;
-      return true;
+      return SyscallResult::Completed;
     }
 
     case 0x102: // PCcreat
@@ -146,21 +252,21 @@ bool PCDrv::HandleSyscall(u32 instruction_bits, CPU::Registers& regs)
       if (!CPU::SafeReadMemoryCString(regs.a1, &filename))
       {
         Log_ErrorPrintf("%s: Invalid string", func);
-        return false;
+        return SyscallResult::NotHandled;
       }
 
       Log_DebugPrintf("%s: '%s' mode %u", func, filename.c_str(), mode);
       if ((filename = ResolveHostPath(filename)).empty())
       {
         RETURN_ERROR();
-        return true;
+        return SyscallResult::Completed;
       }
 
       if (!is_open && !g_settings.pcdrv_enable_writes)
       {
         Log_ErrorPrintf("%s: Writes are not enabled", func);
         RETURN_ERROR();
-        return true;
+        return SyscallResult::Completed;
       }
 
       // Directories are unsupported for now, ignore other attributes
@@ -168,7 +274,7 @@ bool PCDrv::HandleSyscall(u32 instruction_bits, CPU::Registers& regs)
       {
         Log_ErrorPrintf("%s: Directories are unsupported", func);
         RETURN_ERROR();
-        return true;
+        return SyscallResult::Completed;
       }
 
       // Create empty file, truncate if exists.
@@ -176,22 +282,21 @@ bool PCDrv::HandleSyscall(u32 instruction_bits, CPU::Registers& regs)
       if (handle < 0)
       {
         RETURN_ERROR();
-        return true;
-      }
-
-      s_files[handle] = FileSystem::OpenManagedCFile(filename.c_str(),
-                                                     is_open ? (g_settings.pcdrv_enable_writes ? "r+b" : "rb") : "w+b");
-      if (!s_files[handle])
-      {
-        Log_ErrorPrintf("%s: Failed to open '%s'", func, filename.c_str());
-        RETURN_ERROR();
-        return true;
+        return SyscallResult::Completed;
       }
 
-      Log_DebugPrintf("PCDrv: Opened '%s' => %d", filename.c_str(), handle);
-      regs.v0 = 0;
-      regs.v1 = static_cast<u32>(handle);
-      return true;
+      // The open itself happens on a worker thread, since it's the operation most likely to block
+      // for a long time on a network filesystem.
+      const char* fmode = is_open ? (g_settings.pcdrv_enable_writes ? "r+b" : "rb") : "w+b";
+      s_async_handle = handle;
+      s_async_filename = std::move(filename);
+      s_async_pending = true;
+      s_async_done.store(false, std::memory_order_relaxed);
+      Threading::GetSharedThreadPool().Schedule([fmode]() {
+        s_async_file = FileSystem::OpenManagedCFile(s_async_filename.c_str(), fmode);
+        s_async_done.store(true, std::memory_order_release);
+      });
+      return SyscallResult::Stalled;
     }
 
     case 0x104: // PCclose
@@ -201,12 +306,12 @@ bool PCDrv::HandleSyscall(u32 instruction_bits, CPU::Registers& regs)
       if (!CloseFileHandle(regs.a1))
       {
         RETURN_ERROR();
-        return true;
+        return SyscallResult::Completed;
       }
 
       regs.v0 = 0;
       regs.v1 = 0;
-      return true;
+      return SyscallResult::Completed;
     }
 
     case 0x105: // PCread
@@ -217,34 +322,36 @@ bool PCDrv::HandleSyscall(u32 instruction_bits, CPU::Registers& regs)
       if (!fp)
       {
         RETURN_ERROR();
-        return true;
+        return SyscallResult::Completed;
       }
 
       const u32 count = regs.a2;
-      u32 dstaddr = regs.a3;
-      for (u32 i = 0; i < count; i++)
+      if (count == 0)
       {
-        // Certainly less than optimal, but it's not like you're going to be reading megabytes of data here.
-        u8 val;
-        if (std::fread(&val, 1, 1, fp) != 1)
+        regs.v0 = 0;
+        regs.v1 = 0;
+        return SyscallResult::Completed;
+      }
+
+      // Read into a host buffer on the worker; the copy into guest memory happens on completion,
+      // back on the CPU thread.
+      s_async_error = false;
+      s_async_buffer.resize(count);
+      s_async_pending = true;
+      s_async_done.store(false, std::memory_order_relaxed);
+      Threading::GetSharedThreadPool().Schedule([fp, count]() {
+        const size_t nread = std::fread(s_async_buffer.data(), 1, count, fp);
+        if (nread != count)
         {
-          // Does not stop at EOF according to psx-spx.
+          // Does not stop at EOF according to psx-spx, the remainder reads as zeros.
           if (std::ferror(fp) != 0)
-          {
-            RETURN_ERROR();
-            return true;
-          }
-
-          val = 0;
+            s_async_error = true;
+          else
+            std::memset(s_async_buffer.data() + nread, 0, count - nread);
         }
-
-        CPU::SafeWriteMemoryByte(dstaddr, val);
-        dstaddr++;
-      }
-
-      regs.v0 = 0;
-      regs.v1 = count;
-      return true;
+        s_async_done.store(true, std::memory_order_release);
+      });
+      return SyscallResult::Stalled;
     }
 
     case 0x106: // PCwrite
@@ -255,31 +362,40 @@ bool PCDrv::HandleSyscall(u32 instruction_bits, CPU::Registers& regs)
       if (!fp)
       {
         RETURN_ERROR();
-        return true;
+        return SyscallResult::Completed;
       }
 
+      // Gather the guest bytes on the CPU thread, then hand the host write to the worker.
       const u32 count = regs.a2;
       u32 srcaddr = regs.a3;
-      u32 written = 0;
+      s_async_buffer.clear();
+      s_async_buffer.reserve(count);
       for (u32 i = 0; i < count; i++)
       {
         u8 val;
         if (!CPU::SafeReadMemoryByte(srcaddr, &val))
           break;
 
-        if (std::fwrite(&val, 1, 1, fp) != 1)
-        {
-          RETURN_ERROR();
-          return true;
-        }
-
+        s_async_buffer.push_back(val);
         srcaddr++;
-        written++;
       }
 
-      regs.v0 = 0;
-      regs.v1 = written;
-      return true;
+      if (s_async_buffer.empty())
+      {
+        regs.v0 = 0;
+        regs.v1 = 0;
+        return SyscallResult::Completed;
+      }
+
+      s_async_error = false;
+      s_async_pending = true;
+      s_async_done.store(false, std::memory_order_relaxed);
+      Threading::GetSharedThreadPool().Schedule([fp]() {
+        if (std::fwrite(s_async_buffer.data(), 1, s_async_buffer.size(), fp) != s_async_buffer.size())
+          s_async_error = true;
+        s_async_done.store(true, std::memory_order_release);
+      });
+      return SyscallResult::Stalled;
     }
 
     case 0x107: // PClseek
@@ -290,7 +406,7 @@ bool PCDrv::HandleSyscall(u32 instruction_bits, CPU::Registers& regs)
       if (!fp)
       {
         RETURN_ERROR();
-        return true;
+        return SyscallResult::Completed;
       }
 
       const s32 offset = static_cast<s32>(regs.a2);
@@ -309,22 +425,22 @@ bool PCDrv::HandleSyscall(u32 instruction_bits, CPU::Registers& regs)
           break;
         default:
           RETURN_ERROR();
-          return true;
+          return SyscallResult::Completed;
       }
 
       if (FileSystem::FSeek64(fp, offset, hmode) != 0)
       {
         Log_ErrorPrintf("FSeek for PCDrv failed: %d %u", offset, hmode);
         RETURN_ERROR();
-        return true;
+        return SyscallResult::Completed;
       }
 
       regs.v0 = 0;
       regs.v1 = static_cast<u32>(static_cast<s32>(FileSystem::FTell64(fp)));
-      return true;
+      return SyscallResult::Completed;
     }
 
     default:
-      return false;
+      return SyscallResult::NotHandled;
   }
 }
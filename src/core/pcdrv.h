@@ -10,9 +10,16 @@
 //////////////////////////////////////////////////////////////////////////
 
 namespace PCDrv {
+enum class SyscallResult : u8
+{
+  NotHandled, // not a PCDrv syscall, raise the break exception as normal
+  Completed,  // handled, results are in v0/v1, resume after the break
+  Stalled,    // handled, but host I/O is still in flight; re-execute the break
+};
+
 void Initialize();
 void Reset();
 void Shutdown();
 
-bool HandleSyscall(u32 instruction_bits, CPU::Registers& regs);
+SyscallResult HandleSyscall(u32 instruction_bits, CPU::Registers& regs);
 }
@@ -0,0 +1,273 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#include "performance_tuner.h"
+#include "common/log.h"
+#include "common/path.h"
+#include "host.h"
+#include "settings.h"
+#include "system.h"
+#include "util/imgui_manager.h"
+#include "util/ini_settings_interface.h"
+#include "fmt/format.h"
+#include <algorithm>
+#include <memory>
+Log_SetChannel(PerformanceTuner);
+
+namespace PerformanceTuner {
+
+// Tier 0 is the user's configuration; each following tier trades accuracy/quality for speed.
+enum : u32
+{
+  NUM_TIERS = 4
+};
+
+// A tier's record only counts as "holds full speed" once it has this many measurements averaging
+// above the threshold. Measurements arrive roughly once a second.
+static constexpr u32 MIN_SAMPLES_FOR_DECISION = 10;
+static constexpr float FULL_SPEED_THRESHOLD = 97.0f;
+
+// Ignore the first few measurements after a tier switch; shader compilation and cache warming
+// would otherwise condemn a tier that is actually fine.
+static constexpr u32 WARMUP_SAMPLES = 5;
+
+// Cap the persisted history so old hardware/driver behaviour eventually ages out.
+static constexpr u32 MAX_PERSISTED_SAMPLES = 600;
+
+// The baseline fields the tiers modify; everything else is left alone.
+struct BaselineSettings
+{
+  u32 resolution_scale;
+  bool sw_renderer_readbacks;
+  bool fast_vram_readbacks;
+  CPUExecutionMode execution_mode;
+};
+
+struct TierRecord
+{
+  u32 samples = 0;
+  float speed_sum = 0.0f;
+
+  float GetAverage() const { return (samples > 0) ? (speed_sum / static_cast<float>(samples)) : 0.0f; }
+};
+
+static std::unique_ptr<INISettingsInterface> s_store;
+static std::string s_serial;
+static BaselineSettings s_baseline = {};
+static u32 s_baseline_hash = 0;
+static u32 s_current_tier = 0;
+static u32 s_warmup_remaining = 0;
+static TierRecord s_session_records[NUM_TIERS];
+static bool s_active = false;
+
+static u32 ComputeBaselineHash(const BaselineSettings& baseline);
+static BaselineSettings GetTierSettings(u32 tier);
+static void ApplyTier(u32 tier, bool osd_message);
+static void LoadRecords();
+static void FlushRecords();
+
+u32 ComputeBaselineHash(const BaselineSettings& baseline)
+{
+  // FNV-1a over the fields the tiers control, so stored records are discarded when the user
+  // changes their base configuration.
+  u32 hash = UINT32_C(2166136261);
+  const auto mix = [&hash](u32 value) {
+    hash ^= value;
+    hash *= UINT32_C(16777619);
+  };
+  mix(baseline.resolution_scale);
+  mix(static_cast<u32>(baseline.sw_renderer_readbacks));
+  mix(static_cast<u32>(baseline.fast_vram_readbacks));
+  mix(static_cast<u32>(baseline.execution_mode));
+  return hash;
+}
+
+BaselineSettings GetTierSettings(u32 tier)
+{
+  BaselineSettings ret = s_baseline;
+  if (tier >= 1)
+  {
+    // Cheaper readbacks first; this helps titles bottlenecked on VRAM transfers without touching
+    // image quality.
+    ret.sw_renderer_readbacks = false;
+    ret.fast_vram_readbacks = true;
+  }
+  if (tier >= 2)
+    ret.resolution_scale = std::max<u32>(s_baseline.resolution_scale / 2, 1);
+  if (tier >= 3)
+  {
+    ret.resolution_scale = 1;
+    ret.execution_mode = CPUExecutionMode::Recompiler;
+  }
+  return ret;
+}
+
+void ApplyTier(u32 tier, bool osd_message)
+{
+  const BaselineSettings ts = GetTierSettings(tier);
+
+  const Settings old_settings = g_settings;
+  g_settings.gpu_resolution_scale = ts.resolution_scale;
+  g_settings.gpu_use_software_renderer_for_readbacks = ts.sw_renderer_readbacks;
+  g_settings.gpu_fast_vram_readbacks = ts.fast_vram_readbacks;
+  g_settings.cpu_execution_mode = ts.execution_mode;
+
+  s_current_tier = tier;
+  s_warmup_remaining = WARMUP_SAMPLES;
+
+  // During boot the components haven't been created yet and will pick the values up when they
+  // initialize; afterwards they have to be told, like any other runtime settings change.
+  if (System::IsValid())
+    System::CheckForSettingsChanges(old_settings);
+
+  if (osd_message && tier > 0)
+  {
+    Host::AddKeyedOSDMessage("PerformanceTuner",
+                             fmt::format(TRANSLATE_FS("OSDMessage", "Auto-tune: applying performance tier {}."), tier),
+                             5.0f);
+  }
+
+  Log_InfoPrintf("Applied tier %u: %ux scale, %s readbacks, execution mode %u", tier, ts.resolution_scale,
+                 ts.fast_vram_readbacks ? "fast" : "accurate", static_cast<u32>(ts.execution_mode));
+}
+
+void LoadRecords()
+{
+  if (!s_store)
+  {
+    s_store = std::make_unique<INISettingsInterface>(Path::Combine(EmuFolders::Cache, "performance_profiles.ini"));
+    s_store->Load();
+  }
+
+  u32 stored_hash = 0;
+  if (!s_store->GetUIntValue(s_serial.c_str(), "Hash", &stored_hash) || stored_hash != s_baseline_hash)
+  {
+    // Different base configuration (or first time) - start over for this title.
+    s_store->ClearSection(s_serial.c_str());
+    s_store->SetUIntValue(s_serial.c_str(), "Hash", s_baseline_hash);
+    return;
+  }
+
+  for (u32 i = 0; i < NUM_TIERS; i++)
+  {
+    s_session_records[i].samples = s_store->GetUIntValue(s_serial.c_str(), fmt::format("Tier{}Samples", i).c_str(), 0u);
+    s_session_records[i].speed_sum =
+      s_store->GetFloatValue(s_serial.c_str(), fmt::format("Tier{}SpeedSum", i).c_str(), 0.0f);
+  }
+}
+
+void FlushRecords()
+{
+  if (!s_store || s_serial.empty())
+    return;
+
+  s_store->SetUIntValue(s_serial.c_str(), "Hash", s_baseline_hash);
+  for (u32 i = 0; i < NUM_TIERS; i++)
+  {
+    TierRecord& record = s_session_records[i];
+    while (record.samples > MAX_PERSISTED_SAMPLES)
+    {
+      record.samples /= 2;
+      record.speed_sum /= 2.0f;
+    }
+
+    s_store->SetUIntValue(s_serial.c_str(), fmt::format("Tier{}Samples", i).c_str(), record.samples);
+    s_store->SetFloatValue(s_serial.c_str(), fmt::format("Tier{}SpeedSum", i).c_str(), record.speed_sum);
+  }
+
+  s_store->Save();
+}
+
+void OnGameChanged(const std::string& serial)
+{
+  if (!g_settings.auto_tune_performance || serial.empty())
+  {
+    s_active = false;
+    return;
+  }
+
+  if (s_active && serial == s_serial)
+    return;
+
+  if (s_active)
+    FlushRecords();
+
+  s_serial = serial;
+  s_baseline.resolution_scale = g_settings.gpu_resolution_scale;
+  s_baseline.sw_renderer_readbacks = g_settings.gpu_use_software_renderer_for_readbacks;
+  s_baseline.fast_vram_readbacks = g_settings.gpu_fast_vram_readbacks;
+  s_baseline.execution_mode = g_settings.cpu_execution_mode;
+  s_baseline_hash = ComputeBaselineHash(s_baseline);
+  s_session_records[0] = TierRecord();
+  s_session_records[1] = TierRecord();
+  s_session_records[2] = TierRecord();
+  s_session_records[3] = TierRecord();
+  s_active = true;
+
+  LoadRecords();
+
+  // Pick the highest-quality tier known to hold full speed. Unknown tiers are tried
+  // optimistically, so the baseline gets re-probed after e.g. a hardware upgrade resets the store.
+  u32 chosen_tier = NUM_TIERS - 1;
+  for (u32 i = 0; i < NUM_TIERS; i++)
+  {
+    const TierRecord& record = s_session_records[i];
+    if (record.samples < MIN_SAMPLES_FOR_DECISION || record.GetAverage() >= FULL_SPEED_THRESHOLD)
+    {
+      chosen_tier = i;
+      break;
+    }
+  }
+
+  ApplyTier(chosen_tier, chosen_tier > 0);
+}
+
+void UpdateMetrics(float speed_percent)
+{
+  if (!s_active)
+    return;
+
+  // A settings reload from the frontend wipes our changes; treat whatever is now configured as a
+  // fresh baseline rather than fighting the user.
+  const BaselineSettings expected = GetTierSettings(s_current_tier);
+  if (g_settings.gpu_resolution_scale != expected.resolution_scale ||
+      g_settings.gpu_use_software_renderer_for_readbacks != expected.sw_renderer_readbacks ||
+      g_settings.gpu_fast_vram_readbacks != expected.fast_vram_readbacks ||
+      g_settings.cpu_execution_mode != expected.execution_mode)
+  {
+    FlushRecords();
+    s_active = false;
+    OnGameChanged(std::string(s_serial));
+    return;
+  }
+
+  if (s_warmup_remaining > 0)
+  {
+    s_warmup_remaining--;
+    return;
+  }
+
+  TierRecord& record = s_session_records[s_current_tier];
+  record.samples++;
+  record.speed_sum += speed_percent;
+
+  // Step down once this tier has demonstrably failed to hold speed.
+  if (record.samples >= MIN_SAMPLES_FOR_DECISION && record.GetAverage() < FULL_SPEED_THRESHOLD &&
+      s_current_tier < (NUM_TIERS - 1))
+  {
+    Log_WarningPrintf("Tier %u only reached %.1f%% speed, stepping down.", s_current_tier, record.GetAverage());
+    ApplyTier(s_current_tier + 1, true);
+  }
+}
+
+void Shutdown()
+{
+  if (s_active)
+    FlushRecords();
+
+  s_active = false;
+  s_serial.clear();
+  s_store.reset();
+}
+
+} // namespace PerformanceTuner
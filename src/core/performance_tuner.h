@@ -0,0 +1,26 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#pragma once
+#include "types.h"
+#include <string>
+
+// Learns, per title, which settings hold full speed on this machine. Achieved-speed statistics are
+// recorded per tier (baseline plus progressively cheaper variants of resolution scale, readback
+// accuracy and execution mode) into an on-disk store keyed by serial and a hash of the baseline
+// settings. On boot the best-known tier is applied; during play, the tuner steps down a tier when
+// speed drops below full. Enabled with Main/AutoTunePerformance.
+namespace PerformanceTuner {
+
+/// Captures the baseline settings and applies the best tier known for this title. Call after game
+/// settings have been applied, i.e. at the end of UpdateRunningGame().
+void OnGameChanged(const std::string& serial);
+
+/// Feeds one achieved-speed measurement (percentage, 100 = full speed) from the performance
+/// counters. Only call while running at standard speed with the throttler active.
+void UpdateMetrics(float speed_percent);
+
+/// Flushes learned statistics to disk and resets the session state.
+void Shutdown();
+
+} // namespace PerformanceTuner
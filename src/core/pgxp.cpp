@@ -10,6 +10,7 @@
 
 #include <climits>
 #include <cmath>
+#include <cstddef>
 
 Log_SetChannel(PGXP);
 
@@ -50,6 +51,15 @@ struct PGXP_value
   u32 value;
 };
 
+static_assert(sizeof(PGXP_value) == SHADOW_VALUE_SIZE, "shadow value layout matches pgxp.h");
+static_assert(offsetof(PGXP_value, x) == SHADOW_VALUE_X_OFFSET, "shadow value layout matches pgxp.h");
+static_assert(offsetof(PGXP_value, y) == SHADOW_VALUE_Y_OFFSET, "shadow value layout matches pgxp.h");
+static_assert(offsetof(PGXP_value, z) == SHADOW_VALUE_Z_OFFSET, "shadow value layout matches pgxp.h");
+static_assert(offsetof(PGXP_value, flags) == SHADOW_VALUE_FLAGS_OFFSET, "shadow value layout matches pgxp.h");
+static_assert(offsetof(PGXP_value, value) == SHADOW_VALUE_VALUE_OFFSET, "shadow value layout matches pgxp.h");
+static_assert(SHADOW_VALUE_VALID_01_FLAGS == VALID_01, "shadow value flags match pgxp.h");
+static_assert(SHADOW_VALUE_INVALIDATE_FLAGS_MASK == INV_VALID_ALL, "shadow value flags match pgxp.h");
+
 typedef union
 {
   struct
@@ -99,6 +109,17 @@ static PGXP_value GTE_regs[64];
 static PGXP_value* Mem = nullptr;
 static PGXP_value* vertexCache = nullptr;
 
+// Generation counters for the shadow tables. An entry is only current when its counter matches
+// s_generation; bumping the global counter on reset therefore invalidates every entry at once,
+// instead of clearing tens of megabytes of backing store. Stale entries are lazily reinitialized
+// the first time they are touched afterwards. Counter value 0 is reserved for freshly-allocated
+// (zeroed) tables, so s_generation starts at 1.
+static u16* MemGen = nullptr;
+static u16* vertexCacheGen = nullptr;
+static u16 s_generation = 1;
+
+static void InvalidateShadowMemory();
+
 ALWAYS_INLINE_RELEASE void MakeValid(PGXP_value* pV, u32 psxV)
 {
   if (VALID_01 != (pV->flags & VALID_01))
@@ -142,14 +163,30 @@ ALWAYS_INLINE_RELEASE double f16Overflow(double in)
 
 ALWAYS_INLINE_RELEASE PGXP_value* GetPtr(u32 addr)
 {
+  u32 index;
   if ((addr & CPU::DCACHE_LOCATION_MASK) == CPU::DCACHE_LOCATION)
-    return &Mem[PGXP_MEM_SCRATCH_OFFSET + ((addr & CPU::DCACHE_OFFSET_MASK) >> 2)];
-
-  const u32 paddr = (addr & CPU::PHYSICAL_MEMORY_ADDRESS_MASK);
-  if (paddr < Bus::RAM_MIRROR_END)
-    return &Mem[(paddr & Bus::g_ram_mask) >> 2];
+  {
+    index = PGXP_MEM_SCRATCH_OFFSET + ((addr & CPU::DCACHE_OFFSET_MASK) >> 2);
+  }
   else
-    return nullptr;
+  {
+    const u32 paddr = (addr & CPU::PHYSICAL_MEMORY_ADDRESS_MASK);
+    if (paddr >= Bus::RAM_MIRROR_END)
+      return nullptr;
+
+    index = (paddr & Bus::g_ram_mask) >> 2;
+  }
+
+  // Entries written before the last invalidation are logically invalid; refresh them the first
+  // time they are touched rather than clearing the whole table up front.
+  PGXP_value* entry = &Mem[index];
+  if (MemGen[index] != s_generation)
+  {
+    *entry = PGXP_value_invalid;
+    MemGen[index] = s_generation;
+  }
+
+  return entry;
 }
 
 ALWAYS_INLINE_RELEASE PGXP_value* ReadMem(u32 addr)
@@ -264,7 +301,8 @@ void Initialize()
   if (!Mem)
   {
     Mem = static_cast<PGXP_value*>(std::calloc(PGXP_MEM_SIZE, sizeof(PGXP_value)));
-    if (!Mem)
+    MemGen = static_cast<u16*>(std::calloc(PGXP_MEM_SIZE, sizeof(u16)));
+    if (!Mem || !MemGen)
     {
       std::fprintf(stderr, "Failed to allocate PGXP memory\n");
       std::abort();
@@ -274,15 +312,19 @@ void Initialize()
   if (g_settings.gpu_pgxp_vertex_cache && !vertexCache)
   {
     vertexCache = static_cast<PGXP_value*>(std::calloc(VERTEX_CACHE_SIZE, sizeof(PGXP_value)));
-    if (!vertexCache)
+    vertexCacheGen = static_cast<u16*>(std::calloc(VERTEX_CACHE_SIZE, sizeof(u16)));
+    if (!vertexCache || !vertexCacheGen)
     {
       Log_ErrorPrint("Failed to allocate memory for vertex cache, disabling.");
+      std::free(vertexCache);
+      vertexCache = nullptr;
+      std::free(vertexCacheGen);
+      vertexCacheGen = nullptr;
       g_settings.gpu_pgxp_vertex_cache = false;
     }
   }
 
-  if (vertexCache)
-    std::memset(vertexCache, 0, sizeof(PGXP_value) * VERTEX_CACHE_SIZE);
+  InvalidateShadowMemory();
 }
 
 void Reset()
@@ -292,11 +334,28 @@ void Reset()
 
   std::memset(GTE_regs, 0, sizeof(GTE_regs));
 
+  InvalidateShadowMemory();
+}
+
+void InvalidateShadowMemory()
+{
+  s_generation++;
+  if (s_generation != 0)
+    return;
+
+  // The counter wrapped, so entries from 65535 invalidations ago could alias the new generation.
+  // Flush the tables for real and start over.
   if (Mem)
+  {
     std::memset(Mem, 0, sizeof(PGXP_value) * PGXP_MEM_SIZE);
-
+    std::memset(MemGen, 0, sizeof(u16) * PGXP_MEM_SIZE);
+  }
   if (vertexCache)
+  {
     std::memset(vertexCache, 0, sizeof(PGXP_value) * VERTEX_CACHE_SIZE);
+    std::memset(vertexCacheGen, 0, sizeof(u16) * VERTEX_CACHE_SIZE);
+  }
+  s_generation = 1;
 }
 
 void Shutdown()
@@ -305,11 +364,15 @@ void Shutdown()
   {
     std::free(vertexCache);
     vertexCache = nullptr;
+    std::free(vertexCacheGen);
+    vertexCacheGen = nullptr;
   }
   if (Mem)
   {
     std::free(Mem);
     Mem = nullptr;
+    std::free(MemGen);
+    MemGen = nullptr;
   }
 
   std::memset(GTE_regs, 0, sizeof(GTE_regs));
@@ -318,6 +381,11 @@ void Shutdown()
   std::memset(CP0_reg, 0, sizeof(CP0_reg));
 }
 
+u8* GetShadowCPURegisterPointer(u32 reg)
+{
+  return reinterpret_cast<u8*>(&CPU_reg[reg]);
+}
+
 // Instruction register decoding
 #define op(_instr) (_instr >> 26)          // The op part of the instruction register
 #define func(_instr) ((_instr)&0x3F)       // The funct part of the instruction register
@@ -459,7 +527,9 @@ ALWAYS_INLINE_RELEASE void PGXP_CacheVertex(s16 sx, s16 sy, const PGXP_value& ve
   if (sx >= -0x800 && sx <= 0x7ff && sy >= -0x800 && sy <= 0x7ff)
   {
     // Write vertex into cache
-    vertexCache[(sy + 0x800) * VERTEX_CACHE_WIDTH + (sx + 0x800)] = vertex;
+    const u32 index = (sy + 0x800) * VERTEX_CACHE_WIDTH + (sx + 0x800);
+    vertexCache[index] = vertex;
+    vertexCacheGen[index] = s_generation;
   }
 }
 
@@ -467,8 +537,16 @@ static ALWAYS_INLINE_RELEASE PGXP_value* PGXP_GetCachedVertex(short sx, short sy
 {
   if (sx >= -0x800 && sx <= 0x7ff && sy >= -0x800 && sy <= 0x7ff)
   {
-    // Return pointer to cache entry
-    return &vertexCache[(sy + 0x800) * VERTEX_CACHE_WIDTH + (sx + 0x800)];
+    // Return pointer to cache entry, refreshing it if it predates the last invalidation.
+    const u32 index = (sy + 0x800) * VERTEX_CACHE_WIDTH + (sx + 0x800);
+    PGXP_value* entry = &vertexCache[index];
+    if (vertexCacheGen[index] != s_generation)
+    {
+      *entry = PGXP_value_invalid;
+      vertexCacheGen[index] = s_generation;
+    }
+
+    return entry;
   }
 
   return nullptr;
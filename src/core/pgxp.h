@@ -26,6 +26,25 @@ void CPU_SWC2(u32 instr, u32 addr, u32 rtVal); // copy GTE reg to memory
 bool GetPreciseVertex(u32 addr, u32 value, int x, int y, int xOffs, int yOffs, float* out_x, float* out_y,
                       float* out_w);
 
+// -- Recompiler inlining support
+// Layout of one shadow register value, so the recompiler can emit inline shadow propagation for
+// trivially-forwardable operations (register moves, LUI) instead of calling the functions below.
+// The offsets/masks are asserted against the real structure in pgxp.cpp.
+enum : u32
+{
+  SHADOW_VALUE_X_OFFSET = 0,
+  SHADOW_VALUE_Y_OFFSET = 4,
+  SHADOW_VALUE_Z_OFFSET = 8,
+  SHADOW_VALUE_FLAGS_OFFSET = 12,
+  SHADOW_VALUE_VALUE_OFFSET = 16,
+  SHADOW_VALUE_SIZE = 20,
+  SHADOW_VALUE_VALID_01_FLAGS = 0x00000101u,
+  SHADOW_VALUE_INVALIDATE_FLAGS_MASK = 0xFEFEFEFEu
+};
+
+// Returns the address of the shadow value for the specified CPU register.
+u8* GetShadowCPURegisterPointer(u32 reg);
+
 // -- CPU functions
 void CPU_LW(u32 instr, u32 addr, u32 rtVal);
 void CPU_LH(u32 instr, u32 addr, u32 rtVal);
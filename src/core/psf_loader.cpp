@@ -11,10 +11,64 @@
 #include "zlib.h"
 #include <cctype>
 #include <cstring>
+#include <memory>
 Log_SetChannel(PSFLoader);
 
 namespace PSFLoader {
 
+namespace {
+struct CachedFile
+{
+  std::shared_ptr<File> file;
+  s64 modification_time;
+};
+} // namespace
+
+enum : u32
+{
+  MAX_CACHED_FILES = 8
+};
+
+// Parsed-file cache. Minipsf sets reference the same driver library from every track, so keeping
+// the decompressed program around turns the bulk of a track transition into a map lookup instead
+// of a re-read and re-inflate of a multi-megabyte file.
+static std::map<std::string, CachedFile> s_file_cache;
+
+static std::shared_ptr<File> GetOrLoadFile(const char* path)
+{
+  FILESYSTEM_STAT_DATA sd;
+  const bool has_stat = FileSystem::StatFile(path, &sd);
+  if (has_stat)
+  {
+    const auto it = s_file_cache.find(path);
+    if (it != s_file_cache.end())
+    {
+      if (it->second.modification_time == sd.ModificationTime)
+      {
+        Log_DevPrintf("Using cached PSF '%s'", path);
+        return it->second.file;
+      }
+
+      // changed on disk, reload below
+      s_file_cache.erase(it);
+    }
+  }
+
+  std::shared_ptr<File> file = std::make_shared<File>();
+  if (!file->Load(path))
+    return {};
+
+  if (has_stat)
+  {
+    if (s_file_cache.size() >= MAX_CACHED_FILES)
+      s_file_cache.erase(s_file_cache.begin());
+
+    s_file_cache.emplace(path, CachedFile{file, sd.ModificationTime});
+  }
+
+  return file;
+}
+
 std::optional<std::string> File::GetTagString(const char* tag_name) const
 {
   auto it = m_tags.find(tag_name);
@@ -175,15 +229,15 @@ static bool LoadLibraryPSF(const char* path, bool use_pc_sp, u32 depth = 0)
     return false;
   }
 
-  File file;
-  if (!file.Load(path))
+  const std::shared_ptr<File> file = GetOrLoadFile(path);
+  if (!file)
   {
     Log_ErrorPrintf("Failed to load main PSF '%s'", path);
     return false;
   }
 
   // load the main parent library - this has to be done first so the specified PSF takes precedence
-  std::optional<std::string> lib_name(file.GetTagString("_lib"));
+  std::optional<std::string> lib_name(file->GetTagString("_lib"));
   if (lib_name.has_value())
   {
     const std::string lib_path(Path::BuildRelativePath(path, lib_name.value()));
@@ -203,7 +257,7 @@ static bool LoadLibraryPSF(const char* path, bool use_pc_sp, u32 depth = 0)
   }
 
   // apply the main psf
-  if (!System::InjectEXEFromBuffer(file.GetProgramData().data(), static_cast<u32>(file.GetProgramData().size()),
+  if (!System::InjectEXEFromBuffer(file->GetProgramData().data(), static_cast<u32>(file->GetProgramData().size()),
                                    use_pc_sp))
   {
     Log_ErrorPrintf("Failed to parse EXE from PSF '%s'", path);
@@ -214,7 +268,7 @@ static bool LoadLibraryPSF(const char* path, bool use_pc_sp, u32 depth = 0)
   u32 lib_counter = 2;
   for (;;)
   {
-    lib_name = file.GetTagString(TinyString::FromFormat("_lib%u", lib_counter++));
+    lib_name = file->GetTagString(TinyString::FromFormat("_lib%u", lib_counter++));
     if (!lib_name.has_value())
       break;
 
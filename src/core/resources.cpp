@@ -3,1832 +3,385 @@
 
 #include "resources.h"
 
-namespace Resources {
+#include "common/log.h"
 
-unsigned int WINDOW_ICON_DATA[WINDOW_ICON_WIDTH * WINDOW_ICON_HEIGHT] = {
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000C2FF, 0x0500C2FF,
-  0x0A00C2FF, 0x0000C0FF, 0x0000CCFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000C3FF, 0x0000C8FF, 0x2300C2FF,
-  0x8B00C2FF, 0xAE00C2FF, 0x4600C2FF, 0x0600C1FF, 0x0000C1FF, 0x0000CEFF, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000C1FF, 0x0100C1FF, 0x0600C2FF, 0x0100C2FF, 0x0000C1FF,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000C3FF, 0x0000C1FF, 0x1300C2FF, 0x6C00C2FF,
-  0xD700C2FF, 0xFE00C2FF, 0xFF00C2FF, 0xEF00C2FF, 0x9A00C2FF, 0x2D00C2FF, 0x0100C1FF, 0x0000C1FF, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x0000C0FF, 0x0000C2FF, 0x0C00C2FF, 0x5C00C2FF, 0xAD00C2FF, 0x5D00C2FF,
-  0x0C00C2FF, 0x0000C2FF, 0x0000C0FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000C2FF, 0x0800C3FF, 0x4E00C2FF, 0xBF00C2FF,
-  0xFA00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xE000C2FF, 0x7A00C2FF, 0x1900C2FF,
-  0x0000C2FF, 0x0000C2FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x0000C2FF, 0x0400C3FF, 0x3E00C2FF, 0xAF00C2FF, 0xF700C2FF, 0xFF00C2FF,
-  0xF700C2FF, 0xB000C2FF, 0x3F00C2FF, 0x0400C3FF, 0x0000C2FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000C2FF, 0x0200C3FF, 0x3300C2FF, 0xA300C2FF, 0xF200C2FF,
-  0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFD00C2FF,
-  0xCB00C2FF, 0x5B00C2FF, 0x0C00C2FF, 0x0000C2FF, 0x0000CFFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00009FF8, 0x0000FFFF, 0x2600C1FE, 0x9200C2FF, 0xEC00C1FF, 0xFF00C1FF, 0xFF00C1FF,
-  0xFF00C1FF, 0xFF00C1FF, 0xFF00C1FF, 0xEC00C1FF, 0x9200C1FF, 0x2600BEFF, 0x0000FFFF, 0x0000BEFF, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x0000C1FF, 0x0000C9FF, 0x1E00C2FF, 0x8300C2FF, 0xE500C2FF, 0xFF00C2FF,
-  0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF,
-  0xFF00C2FF, 0xFF00C2FF, 0xF700C2FF, 0xB000C2FF, 0x3F00C2FF, 0x0400C2FF, 0x0000C2FF, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x000072FC, 0x0A0065FD, 0xB30089F5, 0xFF00A8FA, 0xFF00B5FF, 0xFF00B5FF,
-  0xFF00B4FF, 0xFF00B4FF, 0xFF00B4FF, 0xFF00B4FF, 0xFF00B5FF, 0xFF00B5FF, 0xB000BBFF, 0x0A00CEFF, 0x0000C9FF,
-  0x00000000, 0x00000000, 0x0000E0FF, 0x0000C2FF, 0x0F00C2FF, 0x6300C2FF, 0xD100C2FF, 0xFE00C2FF, 0xFF00C2FF,
-  0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF,
-  0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xEC00C2FF, 0x9100C2FF, 0x2700C2FF, 0x0100C1FF,
-  0x0000C2FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000067FF, 0x0D0068FF, 0xC70064F6, 0xFF006BE6, 0xFD008DF0,
-  0xFE00AAFD, 0xFF00B1FF, 0xFF00B0FF, 0xFF00B0FF, 0xFE00B0FF, 0xFD00B1FF, 0xFF00B4FF, 0xC300C6FF, 0x0D00D4FF,
-  0x0000CEFF, 0x00000000, 0x0000C2FF, 0x0600C2FF, 0x4600C2FF, 0xB700C2FF, 0xF900C2FF, 0xFF00C2FF, 0xFF00C2FF,
-  0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF,
-  0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xDB00C2FF,
-  0x7200C2FF, 0x1500C2FF, 0x0000C3FF, 0x0000C0FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000067FF, 0x0D0067FF, 0xC70067FF, 0xFF0061EC,
-  0xFF005FDD, 0xFE0072E5, 0xFD0097F5, 0xFE00AEFE, 0xFD00B1FF, 0xFE00B1FF, 0xFF00B0FF, 0xFF00BEFF, 0xC300CEFF,
-  0x0D00CFFF, 0x0000D0FF, 0x0100F6FF, 0x2D00C6FF, 0x9A00C2FF, 0xEF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF,
-  0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF,
-  0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF,
-  0xFF00C2FF, 0xFB00C2FF, 0xC400C2FF, 0x5300C3FF, 0x0900C7FF, 0x0000C3FF, 0x0000FFFF, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000067FF, 0x0D0067FF, 0xC70067FF,
-  0xFF0066FA, 0xFF005FE2, 0xFF005DDC, 0xFE0061DE, 0xFD008FF2, 0xFE00B1FF, 0xFF00B0FF, 0xFF00B5FF, 0xFF00CAFF,
-  0xC300CEFF, 0x0D00CEFF, 0x00009FF7, 0x410088F7, 0xDE00AAFA, 0xFF00B9FF, 0xFF00B9FF, 0xFF00B8FF, 0xFF00B8FF,
-  0xFF00B8FF, 0xFF00B8FF, 0xFF00B8FF, 0xFF00B8FF, 0xFF00B8FF, 0xFF00B8FF, 0xFF00B8FF, 0xFF00B8FF, 0xFF00B8FF,
-  0xFF00B8FF, 0xFF00B8FF, 0xFF00B8FF, 0xFF00B8FF, 0xFF00B8FF, 0xFF00B8FF, 0xFF00B8FF, 0xFF00B8FF, 0xFF00B8FF,
-  0xFF00B8FF, 0xFF00B8FF, 0xFF00B8FF, 0xFF00B9FF, 0xF500B7FF, 0x8500B2FF, 0x0200ABFF, 0x0000B1FF, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000067FF, 0x0D0067FF,
-  0xC70067FF, 0xFF0067FF, 0xFF0063F0, 0xFF005EDD, 0xFF005CDC, 0xFE0084EE, 0xFF00B1FF, 0xFF00B0FF, 0xFF00C1FF,
-  0xFF00CEFF, 0xC300CEFF, 0x0C00CFFF, 0x0B00E5FF, 0x8B0081FB, 0xFF006EEC, 0xFF008DF0, 0xFF00AAFD, 0xFF00B1FF,
-  0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF,
-  0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF,
-  0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFD00ABFF, 0xFF00A5FF, 0xB400AAFF, 0x0600B9FF, 0x0000B2FF,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000067FF,
-  0x0D0067FF, 0xC70067FF, 0xFF0067FF, 0xFF0066FC, 0xFF0060E4, 0xFF005DDC, 0xFE0085EE, 0xFF00B1FF, 0xFF00B7FF,
-  0xFF00CBFF, 0xFF00CEFF, 0xC600CEFF, 0x4D00C4FF, 0xB200C4FF, 0xF7009EFF, 0xFF0064F5, 0xFF005FDF, 0xFF0072E5,
-  0xFF0097F5, 0xFF00AEFE, 0xFF00B1FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF,
-  0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF,
-  0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFE00AEFF, 0xFD00A5FF, 0xFE009EFF, 0xFF00A5FF, 0xB400B0FF, 0x0600B3FF,
-  0x0000B2FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x000067FF, 0x090067FF, 0xAA0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0064F3, 0xFF005DDD, 0xFE0085EE, 0xFF00B2FF,
-  0xFF00C3FF, 0xFF00CEFF, 0xFF00CEFF, 0xF300CAFF, 0xEF00C2FF, 0xFF00C4FF, 0xFF009FFF, 0xFF0067FE, 0xFF0061E9,
-  0xFF005DDC, 0xFF0062DF, 0xFF007CE9, 0xFF009FF8, 0xFF00B0FF, 0xFF00B1FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF,
-  0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF,
-  0xFF00B0FF, 0xFF00B0FF, 0xFE00AFFF, 0xFD00A8FF, 0xFE00A0FF, 0xFF009DFF, 0xFF009FFF, 0xFF00ADFF, 0xB400B0FF,
-  0x0600B2FF, 0x0000B2FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x000069FF, 0x000064FF, 0x1A0067FF, 0x7B0067FF, 0xE00067FF, 0xFF0067FD, 0xFF005FE6, 0xFE0084EE,
-  0xFF00BAFF, 0xFF00CDFF, 0xFF00CDFF, 0xFF00C8FF, 0xFF00C3FF, 0xFF00C2FF, 0xFF00C4FF, 0xFF009FFF, 0xFF0067FF,
-  0xFF0065F8, 0xFF005FE0, 0xFF005EDD, 0xFF005DDD, 0xFF0066E0, 0xFF0085ED, 0xFF00A6FB, 0xFF00B1FF, 0xFF00B0FF,
-  0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF,
-  0xFF00B0FF, 0xFE00B0FF, 0xFD00AAFF, 0xFE00A2FF, 0xFF009DFF, 0xFF009DFF, 0xFF009DFF, 0xFF00A7FF, 0xFF00B0FF,
-  0xB400B0FF, 0x0600B2FF, 0x0000B2FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000067FF, 0x010067FF, 0x2D0067FF, 0x9A0067FF, 0xED0062F4,
-  0xFE0086F0, 0xFF00C6FF, 0xFF00CAFF, 0xFF00C4FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C4FF, 0xFF009FFF,
-  0xFF0067FF, 0xFF0067FF, 0xFF0062EC, 0xFF005EDD, 0xFF005EDD, 0xFF005DDD, 0xFF005EDD, 0xFF006CE3, 0xFF0090F2,
-  0xFF00ABFD, 0xFF00B1FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF,
-  0xFF00B0FF, 0xFD00ACFF, 0xFD00A4FF, 0xFF009EFF, 0xFF009DFF, 0xFF009DFF, 0xFF009DFF, 0xFF00A0FF, 0xFF00AEFF,
-  0xFF00B0FF, 0xB400B0FF, 0x0600B2FF, 0x0000B2FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00008CFF, 0x0A008AFF,
-  0x80008CFC, 0xF900A3FA, 0xFF00C5FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C4FF,
-  0xFF009FFF, 0xFF0067FF, 0xFF0067FF, 0xFF0066FA, 0xFF005FE2, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005DDD,
-  0xFF005FDE, 0xFF0075E6, 0xFF0099F6, 0xFF00AFFE, 0xFF00B1FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF,
-  0xFE00AEFF, 0xFD00A6FF, 0xFE009FFF, 0xFF009DFF, 0xFF009DFF, 0xFF009DFF, 0xFF009DFF, 0xFF009DFF, 0xFF00A8FF,
-  0xFF00B0FF, 0xFF00B0FF, 0xB400B0FF, 0x0600B2FF, 0x0000B2FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000C2FF, 0x0000C3FF, 0x2400C2FF,
-  0x8C00C2FF, 0xE700C3FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF,
-  0xFF00C4FF, 0xFF009FFF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0063EF, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD,
-  0xFF005EDD, 0xFF005EDD, 0xFF005DDD, 0xFF0063DF, 0xFF007EEA, 0xFF00A1F9, 0xFF00B0FF, 0xFF00B1FF, 0xFF00AFFF,
-  0xFF00A9FF, 0xFF00A0FF, 0xFF009DFF, 0xFF009DFF, 0xFF009DFF, 0xFF009DFF, 0xFF009DFF, 0xFF009DFF, 0xFF00A2FF,
-  0xFF00AFFF, 0xFF00B1FF, 0xFF00B0FF, 0xB400B0FF, 0x0600B2FF, 0x0000B2FF, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000D2FF, 0x0000BDFF, 0x1300C4FF, 0x6D00C3FF,
-  0xD700C2FF, 0xFE00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF, 0xFF00C2FF,
-  0xFF00C2FF, 0xFF00C4FF, 0xFF009FFF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0066FB, 0xFF0060E4, 0xFF005EDD,
-  0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005DDD, 0xFF0068E1, 0xFF0089EF, 0xFF00A7FD,
-  0xFF00A3FF, 0xFF009DFF, 0xFF009DFF, 0xFF009DFF, 0xFF009DFF, 0xFF009DFF, 0xFF009DFF, 0xFF009DFF, 0xFF009EFF,
-  0xFF00ACFF, 0xFF00ADF9, 0xFF029DE3, 0xFF00AEFD, 0xB400B0FF, 0x0600B2FF, 0x0000B2FF, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000086F9, 0x010038EE, 0x4900B0FC, 0xC000BFFF,
-  0xFB00BFFF, 0xFF00BFFF, 0xFF00BFFF, 0xFF00BFFF, 0xFF00BFFF, 0xFF00BFFF, 0xFF00BFFF, 0xFF00BFFF, 0xFF00BFFF,
-  0xFF00BFFF, 0xFF00BFFF, 0xFF00C0FF, 0xFF009DFF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0064F2,
-  0xFF005EDE, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005DDD, 0xFF0060DE,
-  0xFF008FF7, 0xFF009EFF, 0xFF009DFF, 0xFF009DFF, 0xFF009DFF, 0xFF009DFF, 0xFF009DFF, 0xFF009DFF, 0xFF009DFF,
-  0xFF00A3FE, 0xFF0196DA, 0xFF065071, 0xFF15536F, 0xFF02ACF9, 0xB400B0FF, 0x0600B2FF, 0x0000B2FF, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00006BFD, 0x090063FF, 0xBA0079F3,
-  0xFF0096F4, 0xFF00AFFE, 0xFF00B2FF, 0xFF00B1FF, 0xFF00B1FF, 0xFF00B1FF, 0xFF00B1FF, 0xFF00B1FF, 0xFF00B1FF,
-  0xFF00B1FF, 0xFF00B1FF, 0xFF00B1FF, 0xFF00B3FF, 0xFF0094FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF,
-  0xFF0066FD, 0xFF0060E6, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD,
-  0xFF0060DE, 0xFF008EF7, 0xFF009EFF, 0xFF009DFF, 0xFF009DFF, 0xFF009DFF, 0xFF009DFF, 0xFF009DFF, 0xFF009DFF,
-  0xFF00A0FF, 0xFF0282C2, 0xFF051F2C, 0xFF161111, 0xFF235166, 0xFF01ACF9, 0xB400B0FF, 0x0600B2FF, 0x0000B2FF,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000067FF, 0x090068FF,
-  0xBD0065FA, 0xFF0062E5, 0xFD0079E8, 0xFD009EF8, 0xFF00B0FF, 0xFF00B1FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF,
-  0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B1FF, 0xFF0093FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF,
-  0xFF0067FF, 0xFF0067FF, 0xFF0064F5, 0xFF005EDF, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD,
-  0xFF005EDD, 0xFF0060DE, 0xFF008EF7, 0xFF009EFF, 0xFF009DFF, 0xFF009DFF, 0xFF009DFF, 0xFF009DFF, 0xFF009DFF,
-  0xFF009DFF, 0xFF00A8FF, 0xFF026D9D, 0xFF0A090A, 0xFF292524, 0xFF255266, 0xFF01ABF8, 0xB400B1FF, 0x0600B2FF,
-  0x0000B2FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000067FF,
-  0x090067FF, 0xBD0067FF, 0xFF0063F2, 0xFF005DDD, 0xFE0065E0, 0xFD0083EC, 0xFE00A5FA, 0xFF00B1FF, 0xFF00B0FF,
-  0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B1FF, 0xFF0093FF, 0xFF0067FF, 0xFF0067FF,
-  0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FE, 0xFF0061E9, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD,
-  0xFF005EDD, 0xFF005EDD, 0xFF0060DE, 0xFF008EF7, 0xFF009EFF, 0xFF009DFF, 0xFF009EFF, 0xFF009DFC, 0xFF009AFB,
-  0xFF009DFF, 0xFF009FFF, 0xFF00AFFF, 0xFF026E9E, 0xFF1B1919, 0xFF2B3E48, 0xFF1479A7, 0xFF00AFFD, 0xB400B0FF,
-  0x0600B2FF, 0x0000B2FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x000067FF, 0x090067FF, 0xBD0067FF, 0xFF0066FD, 0xFF0060E6, 0xFF005DDC, 0xFF005DDD, 0xFE006BE2, 0xFD008DF1,
-  0xFE00AAFD, 0xFF00B1FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B1FF, 0xFF0093FF, 0xFF0067FF,
-  0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0065F7, 0xFF005FE0, 0xFF005EDD, 0xFF005EDD,
-  0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF0060DE, 0xFF008EF7, 0xFF009EFF, 0xFF009EFF, 0xFF008BE1, 0xFF095687,
-  0xFF097BC3, 0xFF009FFF, 0xFF00A6FF, 0xFF00B2FF, 0xFF067BB0, 0xFF175B7A, 0xFF0998D8, 0xFF00B0FE, 0xFF00B0FF,
-  0xB400B0FF, 0x0600B2FF, 0x0000B2FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x000067FF, 0x090067FF, 0xBD0067FF, 0xFF0067FF, 0xFF0064F5, 0xFF005EDF, 0xFF005EDD, 0xFF005DDD,
-  0xFF005FDD, 0xFE0072E6, 0xFD0097F5, 0xFE00AEFE, 0xFF00B1FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B1FF, 0xFF0093FF,
-  0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0062EC, 0xFF005EDD,
-  0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF0060DE, 0xFF008EF7, 0xFF009DFD, 0xFF0267A7, 0xFF052134,
-  0xFF1E1E1F, 0xFF1075B4, 0xFF00A2FF, 0xFF00AEFF, 0xFF00B0FF, 0xFF01A9F5, 0xFF01AEF9, 0xFF00ADFF, 0xFF00A7FF,
-  0xFF00B0FF, 0xB400B1FF, 0x0600B1FF, 0x0000B2FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x000067FF, 0x090067FF, 0xBD0067FF, 0xFF0067FF, 0xFF0067FE, 0xFF0061E9, 0xFF005EDD,
-  0xFF005EDD, 0xFF005EDD, 0xFF005DDD, 0xFE0062DF, 0xFD007CE9, 0xFE00A0F8, 0xFF00B0FF, 0xFF00B1FF, 0xFF00B1FF,
-  0xFF0093FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0066FA,
-  0xFF005FE2, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF0060DE, 0xFF008EF8, 0xFF0097F4, 0xFF04263C,
-  0xFF100D0C, 0xFF2E2E2E, 0xFF1175B4, 0xFF00AAFF, 0xFF00B0FF, 0xFF00B1FF, 0xFF00AFFF, 0xFF009BFF, 0xFF007AFF,
-  0xFF0072FF, 0xFF008FFF, 0xB400A7FF, 0x0600B7FF, 0x0000AEFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x000067FF, 0x090067FF, 0xBD0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0065F7,
-  0xFF005FE0, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005DDD, 0xFE0066E0, 0xFD0086EE, 0xFE00A7FB,
-  0xFF00B2FF, 0xFF0094FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF,
-  0xFF0067FF, 0xFF0063EF, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF0060DE, 0xFF008EF8, 0xFF0097F3,
-  0xFF07283E, 0xFF24201F, 0xFF2D3A44, 0xFF0C83C7, 0xFF00B1FF, 0xFF00B0FF, 0xFF00A2FF, 0xFF0083FF, 0xFF006BFF,
-  0xFF0066FF, 0xFF0066FF, 0xFF0068FF, 0xE10070FF, 0x580069FF, 0x0A0066FF, 0x000066FF, 0x00006BFF, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000067FF, 0x090067FF, 0xBD0067FF, 0xFF0067FF, 0xFF0067FF,
-  0xFF0067FF, 0xFF0062EC, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005DDD, 0xFF005EDD,
-  0xFE006DE3, 0xFD0091F2, 0xFE008FFD, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF,
-  0xFF0067FF, 0xFF0067FF, 0xFF0066FB, 0xFF0060E4, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF0060DE, 0xFF008EF8,
-  0xFF0096F3, 0xFF113953, 0xFF1F5070, 0xFF0A84CF, 0xFF00A9FC, 0xFF00A9FF, 0xFF008CFF, 0xFF006FFF, 0xFF0066FF,
-  0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xF50067FF, 0xAB0067FF, 0x3A0067FF, 0x030066FF,
-  0x000066FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000067FF, 0x090067FF, 0xBD0067FF, 0xFF0067FF,
-  0xFF0067FF, 0xFF0067FF, 0xFF0066FA, 0xFF005FE2, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD,
-  0xFF005EDD, 0xFF005DDD, 0xFF0060DE, 0xFE0069E7, 0xFF0067F7, 0xFF0068FE, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF,
-  0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0064F2, 0xFF005EDE, 0xFF005EDD, 0xFF005EDD, 0xFF0060DE,
-  0xFF008EF7, 0xFF009BFA, 0xFF0783D1, 0xFF0298F5, 0xFF00A2FF, 0xFF0095FF, 0xFF0076FF, 0xFF0067FF, 0xFF0067FF,
-  0xFF0068FF, 0xFF0068FF, 0xFF0068FF, 0xFF0068FF, 0xFF0068FF, 0xFF0068FF, 0xFF0068FF, 0xFF0068FF, 0xE90068FF,
-  0x8C0068FF, 0x24006BFF, 0x0000B3FF, 0x00007BFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000067FF, 0x090067FF, 0xBD0067FF,
-  0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0063EF, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD,
-  0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005DDD, 0xFF0060DF, 0xFE0064EB, 0xFF0068FA, 0xFF0067FF,
-  0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0066FD, 0xFF0060E6, 0xFF005EDD, 0xFF005EDD,
-  0xFF0060DE, 0xFF008EF7, 0xFF009EFF, 0xFF009FFF, 0xFF008FFA, 0xFF006EFB, 0xFF005FFF, 0xFF005CFF, 0xFF005DFF,
-  0xFF005DFF, 0xFF005DFF, 0xFF005DFF, 0xFF005DFF, 0xFF005DFF, 0xFF005DFF, 0xFF005DFF, 0xFF005DFF, 0xFF005DFF,
-  0xFF005DFF, 0xFE005DFF, 0xD8005BFF, 0x5F0060FF, 0x020097FF, 0x000077FF, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000067FF, 0x090067FF,
-  0xBD0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0066FB, 0xFF0060E4, 0xFF005EDD, 0xFF005EDD,
-  0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF0061E2,
-  0xFE0067F0, 0xFF006BFE, 0xFF0066FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0064F5, 0xFF005EDF,
-  0xFF005EDD, 0xFF0060DE, 0xFF008EF7, 0xFF009EFF, 0xFF009FFF, 0xFF0072E5, 0xFF0033CE, 0xFF003EED, 0xFF0043FE,
-  0xFF0043FF, 0xFF0043FF, 0xFF0043FF, 0xFF0043FF, 0xFF0043FF, 0xFF0043FF, 0xFF0043FF, 0xFF0043FF, 0xFF0043FF,
-  0xFF0043FF, 0xFF0043FF, 0xFE0046FF, 0xFF005DFF, 0xBC007CFF, 0x090092FF, 0x000088FF, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000067FF,
-  0x090067FF, 0xBD0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0064F2, 0xFF005EDE,
-  0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD,
-  0xFF005EDD, 0xFF0064E0, 0xFF0094FA, 0xFF0083FF, 0xFF006AFF, 0xFF0066FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FE,
-  0xFF0061E9, 0xFF005EDC, 0xFF0060DE, 0xFF008EF7, 0xFF009EFF, 0xFF00A1FF, 0xFF0077E3, 0xFF002BB9, 0xFF002EBE,
-  0xFF0036D6, 0xFF003FF3, 0xFF0042FF, 0xFF0042FF, 0xFF0042FF, 0xFF0042FF, 0xFF0042FF, 0xFF0042FF, 0xFF0042FF,
-  0xFF0041FF, 0xFE0044FF, 0xFD004FFF, 0xFE0067FF, 0xFF0084FF, 0xBD008CFF, 0x09008BFF, 0x00008BFF, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x000067FF, 0x090067FF, 0xBD0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0066FD,
-  0xFF0060E6, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD,
-  0xFF005EDD, 0xFF005EDD, 0xFF0064E0, 0xFF00A3F9, 0xFF00AFFF, 0xFF009AFF, 0xFF007AFF, 0xFF0068FF, 0xFF0066FF,
-  0xFF0067FF, 0xFF0065F7, 0xFF005FE0, 0xFF0060DE, 0xFF008EF7, 0xFF009EFF, 0xFF00A9FF, 0xFF007CE4, 0xFF002BB9,
-  0xFF002BB9, 0xFF002CB9, 0xFF002FC3, 0xFF0039DF, 0xFF0040F9, 0xFF0042FF, 0xFF0042FF, 0xFF0042FF, 0xFF0042FF,
-  0xFF0042FF, 0xFE004BFF, 0xFD005CFF, 0xFF006EFF, 0xFF0085FF, 0xFF008BFF, 0xBA008BFF, 0x09008BFF, 0x00008BFF,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x000067FF, 0x090067FF, 0xBD0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF,
-  0xFF0067FF, 0xFF0064F5, 0xFF005EDF, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD,
-  0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF0064E0, 0xFF00A2F9, 0xFF00B1FF, 0xFF00B1FF, 0xFF00ABFF, 0xFF0092FF,
-  0xFF0073FF, 0xFF0067FF, 0xFF0066FF, 0xFF0062EC, 0xFF0060DE, 0xFF008EF7, 0xFF00A1FF, 0xFF00AEFF, 0xFF00A0F7,
-  0xFF0065D7, 0xFF0037BF, 0xFF002AB9, 0xFF002BB9, 0xFF002CBA, 0xFE0031C8, 0xFE003BE7, 0xFF0041FC, 0xFF0042FF,
-  0xFE0048FF, 0xFD0058FF, 0xFE0064FF, 0xFF0070FF, 0xFF0085FF, 0xFB008BFF, 0xC2008BFF, 0x49008BFF, 0x01008CFF,
-  0x00008BFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x000067FF, 0x090067FF, 0xBD0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF,
-  0xFF0067FF, 0xFF0067FF, 0xFF0067FE, 0xFF0061E9, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD,
-  0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF0064E0, 0xFF00A2F9, 0xFF00B1FF, 0xFF00B0FF, 0xFF00B0FF,
-  0xFF00B1FF, 0xFF00A6FF, 0xFF0089FF, 0xFF006EFF, 0xFF0065F9, 0xFF0061E3, 0xFF008EF7, 0xFF00A9FF, 0xFF00B1FF,
-  0xFF00BAFF, 0xFF00C4FE, 0xFF00A4ED, 0xFF005CCF, 0xFF0030BC, 0xFF002AB9, 0xFF002CB9, 0xFF002DBC, 0xFE0033D0,
-  0xFD004EF7, 0xFE0062FF, 0xFF0067FF, 0xFF0071FF, 0xFF0086FF, 0xD9008BFF, 0x6F008BFF, 0x14008BFF, 0x00008AFF,
-  0x00008EFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x000067FF, 0x090067FF, 0xBD0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF,
-  0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0065F7, 0xFF005FE0, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD,
-  0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF0064E0, 0xFF00A2F9, 0xFF00B1FF, 0xFF00B0FF,
-  0xFF00B0FF, 0xFF00B0FF, 0xFF00B1FF, 0xFF00B0FF, 0xFF00A0FF, 0xFF0080FF, 0xFF0067F0, 0xFF0092F7, 0xFF00B5FF,
-  0xFF00C3FF, 0xFF00CCFF, 0xFF00CFFF, 0xFF00D0FF, 0xFF00C6FB, 0xFF0092E6, 0xFE004BC7, 0xFE002CBA, 0xFF002CBA,
-  0xFF002DBB, 0xFF0057EB, 0xFF0068FF, 0xFF0072FF, 0xEB0086FF, 0x8F008CFF, 0x25008BFF, 0x000089FF, 0x00008BFF,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000067FF, 0x090067FF, 0xBD0067FF, 0xFF0067FF, 0xFF0067FF,
-  0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0062EC, 0xFF005EDD, 0xFF005EDD,
-  0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF0064E0, 0xFF00A2F9, 0xFF00B1FF,
-  0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B1FF, 0xFF00ADFF, 0xFF009EFC, 0xFF00B3FC,
-  0xFF00CBFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CFFF, 0xFF00D0FF, 0xE100BBF7, 0x900042C3,
-  0xE0002BBA, 0xFF002DBB, 0xFF0057EC, 0xF60072FF, 0xAE0085FF, 0x3D008DFF, 0x04008BFF, 0x00008BFF, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000067FF, 0x090067FF, 0xBD0067FF, 0xFF0067FF,
-  0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0066F9, 0xFF005FE1,
-  0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF0064E0, 0xFF00A2F9,
-  0xFF00B1FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B2FF, 0xFF00C7FF,
-  0xFF00CFFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xD600CFFF,
-  0x1A00C7FB, 0x2D0026B7, 0x9E002EBD, 0xC3005AE9, 0x590083FF, 0x0B0094FF, 0x00008EFF, 0x000091FF, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000067FF, 0x090067FF, 0xBD0067FF,
-  0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF,
-  0xFF0063EF, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF0064E0,
-  0xFF00A2F9, 0xFF00B1FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00BCFF,
-  0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF,
-  0xD600CEFF, 0x1800CDFF, 0x0000ADF2, 0x090038C6, 0x110059E1, 0x0000FFFF, 0x0000AEFF, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000067FF, 0x090067FF,
-  0xBD0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF,
-  0xFF0067FF, 0xFF0066FB, 0xFF0060E4, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD,
-  0xFF0064E0, 0xFF00A2F9, 0xFF00B1FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B3FF,
-  0xFF00C8FF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF,
-  0xFF00CEFF, 0xD600CEFF, 0x1800CDFF, 0x0000CDFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000067FF,
-  0x090067FF, 0xBD0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF,
-  0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0063F2, 0xFF005EDE, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD,
-  0xFF005EDD, 0xFF0064E0, 0xFF00A2F9, 0xFF00B1FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF,
-  0xFF00BFFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF,
-  0xFF00CEFF, 0xFF00CEFF, 0xD600CEFF, 0x1800CDFF, 0x0000CDFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x000067FF, 0x090067FF, 0xBD0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF,
-  0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0066FD, 0xFF0060E6, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD,
-  0xFF005EDD, 0xFF005EDD, 0xFF0064E0, 0xFF00A2F9, 0xFF00B1FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF,
-  0xFF00B5FF, 0xFF00CAFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF,
-  0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xD600CEFF, 0x1900CDFF, 0x0000CDFF, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x000067FF, 0x080067FF, 0xB70067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF,
-  0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0064F5, 0xFF005EDE, 0xFF005EDD,
-  0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF0064E0, 0xFF00A2F9, 0xFF00B1FF, 0xFF00B0FF, 0xFF00B0FF, 0xFF00B0FF,
-  0xFF00B0FF, 0xFF00C1FF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF,
-  0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xD100CEFF, 0x1600CDFF, 0x0000CDFF, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x000067FF, 0x000068FF, 0x3C0067FF, 0xB30067FF, 0xF70067FF, 0xFF0067FF, 0xFF0067FF,
-  0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FE, 0xFF0061E9,
-  0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF0064E0, 0xFF00A2F9, 0xFF00B1FF, 0xFF00B0FF, 0xFF00B0FF,
-  0xFF00B0FF, 0xFF00B7FF, 0xFF00CCFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF,
-  0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFB00CEFF, 0xC400CEFF, 0x5000CEFF, 0x0300CEFF, 0x0000CEFF, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000068FF, 0x000067FF, 0x0D0067FF, 0x5E0067FF, 0xCD0067FF,
-  0xFD0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF,
-  0xFF0065F7, 0xFF005FE0, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF0064E0, 0xFF00A2F9, 0xFF00B1FF, 0xFF00B0FF,
-  0xFF00B0FF, 0xFF00B1FF, 0xFF00C4FF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF,
-  0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xDA00CEFF, 0x7100CEFF, 0x1500CEFF, 0x0000CEFF, 0x0000CEFF, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000067FF, 0x000067FF,
-  0x1B0067FF, 0x7D0067FF, 0xE20067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF,
-  0xFF0067FF, 0xFF0067FF, 0xFF0062EC, 0xFF005EDD, 0xFF005EDD, 0xFF005EDD, 0xFF0064E0, 0xFF00A2F9, 0xFF00B1FF,
-  0xFF00B0FF, 0xFF00B0FF, 0xFF00B9FF, 0xFF00CDFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF,
-  0xFF00CEFF, 0xFF00CEFF, 0xEB00CEFF, 0x9100CEFF, 0x2700CEFF, 0x0100CFFF, 0x0000CFFF, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x000066FF, 0x020065FF, 0x2F0067FF, 0x9D0067FF, 0xF00067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF,
-  0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0066F9, 0xFF005FE1, 0xFF005EDD, 0xFF005EDD, 0xFF0064E0, 0xFF00A2F9,
-  0xFF00B1FF, 0xFF00B0FF, 0xFF00B2FF, 0xFF00C6FF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF,
-  0xFF00CFFF, 0xF900CDFF, 0xB000CDFF, 0x3E00CEFF, 0x0400CEFF, 0x0000CEFF, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000067FF, 0x070067FF, 0x490067FF, 0xBA0067FF, 0xF90067FF,
-  0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0063EF, 0xFF005EDD, 0xFF005EDD, 0xFF0064E0,
-  0xFF00A2F9, 0xFF00B1FF, 0xFF00B0FF, 0xFF00BCFF, 0xFF00CDFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CFFF,
-  0xFF00CEFF, 0xFF00B0FF, 0xD1007FFF, 0x190086FF, 0x00007EFF, 0x0000CFFF, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000067FF, 0x000067FF, 0x100067FF,
-  0x660067FF, 0xD20067FF, 0xFE0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0066FB, 0xFF0060E3, 0xFF005EDC,
-  0xFF0064E0, 0xFF00A2F9, 0xFF00B1FF, 0xFF00B3FF, 0xFF00C8FF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00CFFF, 0xFF00D0FF,
-  0xFE00BDFE, 0xFF0085FF, 0xFF0050FF, 0xCA0040FF, 0x0F003FFF, 0x000040FF, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x000066FF, 0x000081FF, 0x1F0067FF, 0x850067FF, 0xE60067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0067FF, 0xFF0063F2,
-  0xFF005EDD, 0xFF0064E0, 0xFF00A2F9, 0xFF00B1FF, 0xFF00BEFF, 0xFF00CEFF, 0xFF00CEFF, 0xFF00D0FF, 0xFF00C4FB,
-  0xFD008EE3, 0xF60055EB, 0xFF0042FF, 0xFF0041FF, 0xCD0044FF, 0x150050FF, 0x00004DFF, 0x00006BFF, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x000067FF, 0x020068FF, 0x350067FF, 0xBC0161FB, 0xFF0065FD, 0xFF0068FF,
-  0xFF0066FD, 0xFF0060E6, 0xFF0064DF, 0xFF00A2F9, 0xFF00B6FF, 0xFF00CAFF, 0xFF00CEFF, 0xFC00CCFE, 0xFC00A2EC,
-  0xF9005ACD, 0xFB002FBB, 0xF30037E1, 0xFC0043FF, 0xF7004DFF, 0xF0005EFF, 0xA10067FF, 0x300067FF, 0x010068FF,
-  0x000068FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000542EA, 0x75043CE0, 0xFF0348EB,
-  0xFF015CF8, 0xFF0067FE, 0xFF0064F4, 0xFF0064E1, 0xFF00A2F9, 0xFF00C2FF, 0xFD00CEFF, 0xCE00D0FF, 0x8500A4ED,
-  0xEB0036BE, 0xFC002AB9, 0xF4002BB9, 0xEC013EE0, 0xF5005BFF, 0xFB0066FF, 0xFF0067FF, 0xFF0067FF, 0xE20067FF,
-  0x790067FE, 0x10015AF7, 0x00015EF9, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00063BE6, 0x730438DE,
-  0xFF0539E2, 0xFF0338D6, 0xFD0046DA, 0xFD0060FA, 0xFF0067EC, 0xFF00AAF9, 0xE900CAFF, 0x8200CEFF, 0x1B00DEFF,
-  0x2B012CC6, 0xE9012DC0, 0xFF002CBA, 0xFE002CB9, 0xF90235C3, 0xF90352E3, 0xFD0165FB, 0xFF0068FF, 0xFE0068FF,
-  0xFB0162FC, 0xF0034FF0, 0x490441E6, 0x000442E7, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00063BE6,
-  0x720439DF, 0xFF0438DD, 0xFF012EC0, 0xF9002DBE, 0xF90044F4, 0xFF005AFA, 0xFF0084FC, 0x920075FF, 0x0100FFFF,
-  0x000F48D9, 0x36204AD1, 0xEE083ADB, 0xFF0132CF, 0xFF002DBE, 0xFF002BB9, 0xFE012DBB, 0xFB033ECC, 0xFA0358EB,
-  0xF60256F4, 0xF90442E7, 0xF9053AE2, 0x50053AE2, 0x00053AE2, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00053BE4, 0x700439DE, 0xFF0233CD, 0xFF002CBA, 0xF9002DBF, 0xF9003EF4, 0xFF0043FF, 0xFF0043FF, 0x89003FFF,
-  0x02FFFF00, 0x3FA6A59F, 0xB59E9FA1, 0xFC6A7DB6, 0xFF244ED4, 0xFF0437DA, 0xFF0130CA, 0xFF002DBC, 0xFF002BB8,
-  0xFD0534C3, 0xFD063BE0, 0xFF053AE2, 0xFB0438DD, 0x540336D6, 0x000336D7, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x000231CA, 0x6C0233CD, 0xFF012DBE, 0xFF002CB9, 0xF9002DBF, 0xF9003EF4, 0xFF0042FF, 0xFF0041FF,
-  0xA81854F1, 0x90A7A69E, 0xECA6A49E, 0xFFA5A49F, 0xFFA7A59E, 0xFF9499A5, 0xFF566FBF, 0xFF1745D9, 0xFF0235D7,
-  0xFF002FC4, 0xFF0632C2, 0xFF0639DD, 0xFF0334D3, 0xFB022FC2, 0x550330BF, 0x00032FBF, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00002CBA, 0x62002CBB, 0xF6002CBA, 0xFA002CBA, 0xF8002DBF, 0xF9003EF4, 0xFD0246FF,
-  0xFA0355FD, 0xF80F69F6, 0xFE5586CE, 0xFF959EA8, 0xFFA7A59E, 0xFFA5A49F, 0xFFA6A59F, 0xFFA6A49F, 0xFF8790AA,
-  0xFF4262C7, 0xFF0D3EDB, 0xFF0435D3, 0xFF0331C5, 0xE4022EBC, 0x7F0832BB, 0x14113ABF, 0x000F38BE, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00002CB9, 0x64002CBA, 0xFE002CBA, 0xF9002CBA, 0xF2012EBE, 0xF5054BF0,
-  0xFB0361FF, 0xFE0167FF, 0xFF0067FF, 0xFF0167FE, 0xFF2274EB, 0xFF6F8FBE, 0xFFA3A3A0, 0xFFA5A49F, 0xFFA5A49F,
-  0xFFA7A59E, 0xFFA2A2A0, 0xFF7886B1, 0xEF2B51C9, 0xA10430BE, 0x310B35BC, 0x022B4EC3, 0x001D43C0, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00012FC4, 0x680130C6, 0xFF012DBE, 0xFF002CB9, 0xFD012CBA,
-  0xFD063FCB, 0xFF065BEB, 0xFF0267FD, 0xFF0068FF, 0xFF0167FE, 0xFF035EF7, 0xFF225BDD, 0xFF969AA5, 0xFFA6A59F,
-  0xFFA5A49F, 0xFFA5A49F, 0xF7A5A49F, 0xB0A8A69E, 0x418C92A6, 0x070533C9, 0x002046C1, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00063AE1, 0x670539DE, 0xFE0437DA, 0xFF0231C9,
-  0xFF002DBC, 0xFF002BB9, 0xFF0331BD, 0xFF0647D4, 0xFF065DF0, 0xFF0952EC, 0xFF063EE4, 0xFF1D49D8, 0xFF9599A6,
-  0xFFA6A59F, 0xFDA5A49F, 0xCAA5A49F, 0x5BA5A49F, 0x0CA5A49F, 0x00A5A49F, 0x00A5A59F, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000C3EDC, 0x180C3DD9, 0x850A3DDE,
-  0xE6063ADF, 0xFF0436D6, 0xFF0130C4, 0xFF002CBA, 0xFF012CB8, 0xFF0738CD, 0xFF063BE2, 0xFF0339E2, 0xFF1A46D2,
-  0xFF9398A5, 0xE0A6A59F, 0x7BA5A49F, 0x19A5A49F, 0x00A4A6A0, 0x00A5A39F, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001842D0,
-  0x022348C5, 0x350E3EDA, 0xA5093CDF, 0xF30639DE, 0xFF0334D1, 0xFF012EC0, 0xFF0534CC, 0xFF0438DD, 0xFF0132CC,
-  0xF3123ABC, 0x9C888FA5, 0x2DACA99D, 0x01A5A49F, 0x00A5A49F, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x000D3DD8, 0x081743CF, 0x4F0C3EDB, 0xC1083CDF, 0xFB0538DC, 0xFF0434CE, 0xFC012FC1,
-  0xC8022EBB, 0x540A34BC, 0x075269B3, 0x003151B9, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x003C55B2, 0x000033EF, 0x131341D4, 0x6E0B3DDE, 0xC30635CE,
-  0x78032FBC, 0x170A35C0, 0x000018B3, 0x004365D1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00244BC4, 0x02214AC7,
-  0x11123EC9, 0x03103CC9, 0x000E3AC8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000};
+#include <zstd.h>
 
-unsigned int PLACEHOLDER_ICON_DATA[PLACEHOLDER_ICON_WIDTH * PLACEHOLDER_ICON_HEIGHT] = {
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xA2787878,
-  0x0C090909, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x0E0A0A0A, 0xA87D7D7D, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x5E464646,
-  0xF3B4B4B4, 0xFFBDBDBD, 0xD79F9F9F, 0x2D212121, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x35272727, 0xDCA3A3A3, 0xFFBDBDBD, 0xF2B3B3B3, 0x5A434343, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0x00000000, 0x281E1E1E, 0xD29C9C9C, 0xFFBDBDBD, 0xF6B6B6B6, 0x654B4B4B, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x01010101, 0x72545454, 0xF9B9B9B9, 0xFFBDBDBD, 0xCC979797, 0x241B1B1B, 0x00000000, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x09070707, 0x9A727272, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xA67B7B7B, 0x0D0A0A0A, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x140F0F0F, 0xB4858585, 0xFFBDBDBD, 0xFEBCBCBC, 0x906B6B6B, 0x07050505, 0x00000000,
-  0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x59424242, 0xF2B3B3B3, 0xFFBDBDBD, 0xDAA2A2A2, 0x31242424, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x3F2F2F2F, 0xE4A9A9A9, 0xFFBDBDBD, 0xECAFAFAF, 0x4E3A3A3A, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x251B1B1B, 0xCF999999, 0xFFBDBDBD, 0xF7B7B7B7, 0x6A4F4F4F, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x03020202, 0x7E5D5D5D, 0xFCBBBBBB, 0xFFBDBDBD, 0xC2909090, 0x1D151515,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08060606, 0x966F6F6F, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xAA7E7E7E, 0x0F0B0B0B, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1A131313, 0xBE8D8D8D, 0xFFBDBDBD, 0xFDBCBCBC, 0x83616161,
-  0x04030303, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x553F3F3F, 0xF0B2B2B2, 0xFFBDBDBD, 0xDCA3A3A3, 0x33262626, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x49363636, 0xEAADADAD, 0xFFBDBDBD, 0xE6AAAAAA,
-  0x43323232, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x231A1A1A, 0xCC979797, 0xFFBDBDBD, 0xF8B8B8B8, 0x6D515151,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05040404, 0x8A666666, 0xFEBCBCBC, 0xFFBDBDBD,
-  0xB9898989, 0x16101010, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x07050505, 0x926C6C6C,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xAD808080, 0x100C0C0C, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x21181818, 0xC8949494, 0xFFBDBDBD,
-  0xFBBABABA, 0x77585858, 0x02010101, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x523D3D3D, 0xEFB1B1B1, 0xFFBDBDBD, 0xDEA5A5A5, 0x36282828, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x543E3E3E, 0xEFB1B1B1,
-  0xFFBDBDBD, 0xE0A6A6A6, 0x392A2A2A, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x21181818, 0xC9959595, 0xFFBDBDBD, 0xF9B9B9B9,
-  0x71545454, 0x01010101, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08060606, 0x966F6F6F,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xAD808080, 0x110D0D0D, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x06040404,
-  0x8E696969, 0xFEBCBCBC, 0xFFBDBDBD, 0xB1838383, 0x120D0D0D, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x281E1E1E,
-  0xD19B9B9B, 0xFFBDBDBD, 0xF7B7B7B7, 0x6B4F4F4F, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x4E3A3A3A, 0xEDB0B0B0, 0xFFBDBDBD, 0xE1A7A7A7, 0x392A2A2A, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x5F464646, 0xF4B5B5B5, 0xFFBDBDBD, 0xD9A1A1A1, 0x30242424, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1E161616, 0xC6939393, 0xFFBDBDBD,
-  0xFAB9B9B9, 0x75575757, 0x01010101, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x0C090909, 0xA2787878, 0xFFBDBDBD, 0xFFBDBDBD, 0xA2787878, 0x0C090909, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x05040404, 0x8A666666, 0xFEBCBCBC, 0xFFBDBDBD, 0xB4858585, 0x140F0F0F, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x30242424, 0xD9A1A1A1, 0xFFBDBDBD, 0xF4B5B5B5, 0x5F464646, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4B383838, 0xEBAEAEAE, 0xFFBDBDBD, 0xE3A8A8A8, 0x3C2C2C2C,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x6B4F4F4F, 0xF7B7B7B7, 0xFFBDBDBD, 0xD19B9B9B, 0x281E1E1E, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1C151515, 0xC3919191,
-  0xFFBDBDBD, 0xFBBABABA, 0x795A5A5A, 0x02010101, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x110D0D0D, 0xAD808080, 0xFFBDBDBD, 0xFFBDBDBD, 0x966F6F6F, 0x08060606, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x04030303, 0x86636363, 0xFDBCBCBC, 0xFFBDBDBD, 0xB8888888, 0x16101010, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x392A2A2A, 0xE0A6A6A6, 0xFFBDBDBD, 0xEFB1B1B1, 0x543E3E3E, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x47353535, 0xEAADADAD, 0xFFBDBDBD, 0xE5AAAAAA,
-  0x402F2F2F, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x02010101, 0x77585858, 0xFBBABABA, 0xFFBDBDBD, 0xC8949494, 0x21181818,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1A131313,
-  0xC08E8E8E, 0xFFBDBDBD, 0xFCBBBBBB, 0x7E5D5D5D, 0x02010101, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x15101010, 0xB6878787, 0xFFBDBDBD, 0xFEBCBCBC, 0x916B6B6B,
-  0x06040404, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x03020202, 0x82606060, 0xFDBCBCBC, 0xFFBDBDBD, 0xBC8B8B8B, 0x18121212, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x43323232, 0xE7ABABAB, 0xFFBDBDBD, 0xEAADADAD,
-  0x49363636, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x43323232, 0xE7ABABAB, 0xFFBDBDBD,
-  0xE8ACACAC, 0x43323232, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x04030303, 0x84626262, 0xFDBCBCBC, 0xFFBDBDBD,
-  0xBE8D8D8D, 0x1A131313, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x18121212, 0xBC8B8B8B, 0xFFBDBDBD, 0xFDBCBCBC, 0x82606060, 0x03020202, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1C151515, 0xC2909090, 0xFFBDBDBD,
-  0xFCBBBBBB, 0x805F5F5F, 0x03020202, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x02010101, 0x7D5D5D5D, 0xFCBBBBBB, 0xFFBDBDBD, 0xBF8E8E8E, 0x1A131313,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4E3A3A3A, 0xECAFAFAF,
-  0xFFBDBDBD, 0xE3A8A8A8, 0x3E2E2E2E, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x402F2F2F, 0xE5AAAAAA,
-  0xFFBDBDBD, 0xE9ADADAD, 0x47353535, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x07050505, 0x906B6B6B,
-  0xFEBCBCBC, 0xFFBDBDBD, 0xB3858585, 0x140F0F0F, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x16101010, 0xB9898989, 0xFFBDBDBD, 0xFDBCBCBC, 0x86636363, 0x04030303, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20181818,
-  0xC7939393, 0xFFBDBDBD, 0xFBBABABA, 0x805F5F5F, 0x02010101, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02010101, 0x7A5A5A5A, 0xFBBABABA, 0xFFBDBDBD, 0xC3919191,
-  0x1C151515, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x59424242, 0xF1B3B3B3, 0xFFBDBDBD, 0xDDA4A4A4, 0x35272727, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3D2D2D2D,
-  0xE3A8A8A8, 0xFFBDBDBD, 0xEBAEAEAE, 0x4A373737, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x0A070707, 0x9C747474, 0xFFBDBDBD, 0xFFBDBDBD, 0xA87D7D7D, 0x0E0A0A0A, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x140F0F0F, 0xB5868686, 0xFFBDBDBD, 0xFEBCBCBC, 0x8A666666, 0x05040404, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x2C212121, 0xD59E9E9E, 0xFFBDBDBD, 0xF6B6B6B6, 0x654B4B4B, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01010101, 0x6F525252, 0xF9B9B9B9, 0xFFBDBDBD,
-  0xCA969696, 0x21181818, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x664C4C4C, 0xF6B6B6B6, 0xFFBDBDBD, 0xD59E9E9E, 0x2C212121, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x3A2B2B2B, 0xE1A7A7A7, 0xFFBDBDBD, 0xEDB0B0B0, 0x4D393939, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x0E0A0A0A, 0xA87D7D7D, 0xFFBDBDBD, 0xFFBDBDBD, 0x9C747474, 0x0A070707, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x120D0D0D, 0xB2848484, 0xFFBDBDBD, 0xFEBCBCBC, 0x8D696969, 0x06040404,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x35272727, 0xDCA3A3A3, 0xFFBDBDBD, 0xF1B3B3B3, 0x59424242, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01010101, 0x6F525252, 0xF9B9B9B9,
-  0xFFBDBDBD, 0xCB969696, 0x231A1A1A, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x01010101, 0x6F525252, 0xF9B9B9B9, 0xFFBDBDBD, 0xCD989898, 0x241B1B1B,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x37292929, 0xDFA5A5A5, 0xFFBDBDBD, 0xEFB1B1B1, 0x513C3C3C, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x140F0F0F, 0xB3858585, 0xFFBDBDBD, 0xFEBCBCBC, 0x906B6B6B,
-  0x07050505, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x110D0D0D, 0xAE818181, 0xFFBDBDBD, 0xFEBCBCBC, 0x926C6C6C,
-  0x07050505, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3E2E2E2E, 0xE3A8A8A8, 0xFFBDBDBD, 0xEDB0B0B0,
-  0x4E3A3A3A, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01010101, 0x6E525252,
-  0xF8B8B8B8, 0xFFBDBDBD, 0xCC979797, 0x231A1A1A, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01010101, 0x6F525252, 0xFAB9B9B9, 0xFFBDBDBD,
-  0xC9959595, 0x21181818, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x32252525, 0xDBA2A2A2, 0xFFBDBDBD, 0xF2B3B3B3, 0x58414141, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1A131313, 0xBE8D8D8D, 0xFFBDBDBD,
-  0xFDBCBCBC, 0x84626262, 0x04030303, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0F0B0B0B, 0xAA7E7E7E, 0xFFBDBDBD, 0xFFBDBDBD,
-  0x966F6F6F, 0x08060606, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x49363636, 0xEAADADAD,
-  0xFFBDBDBD, 0xE6AAAAAA, 0x43323232, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x694E4E4E, 0xF7B7B7B7, 0xFFBDBDBD, 0xCF999999, 0x261C1C1C, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05040404, 0x8A666666,
-  0xFEBCBCBC, 0xFFBDBDBD, 0xB8888888, 0x16101010, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x2B202020, 0xD59E9E9E, 0xFFBDBDBD, 0xF2B3B3B3, 0x5B434343, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1E161616,
-  0xC4919191, 0xFFBDBDBD, 0xFBBABABA, 0x805F5F5F, 0x02010101, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0D0A0A0A, 0xA67B7B7B, 0xFFBDBDBD,
-  0xFFBDBDBD, 0x9A727272, 0x09070707, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x533E3E3E, 0xEFB1B1B1, 0xFFBDBDBD, 0xE0A6A6A6, 0x392A2A2A, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x654B4B4B, 0xF6B6B6B6, 0xFFBDBDBD, 0xD29C9C9C, 0x281E1E1E, 0x00000000, 0x00000000, 0x00000000,
-  0x08060606, 0x966F6F6F, 0xFFBDBDBD, 0xFFBDBDBD, 0xAE818181, 0x110D0D0D, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2D212121, 0xD79F9F9F, 0xFFBDBDBD, 0xF3B4B4B4, 0x5D454545,
-  0x00000000, 0x271D1D1D, 0xCF999999, 0xFFBDBDBD, 0xF8B8B8B8, 0x6F525252, 0x01010101, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x09070707, 0x9A727272,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xC4929292, 0xF4B4B4B4, 0xFFBDBDBD, 0xD9A1A1A1, 0x31242424, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x664C4C4C, 0xFBBABABA, 0xFFBDBDBD, 0xFFBDBDBD, 0xB2848484, 0x0C090909, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x2B202020, 0xD49D9D9D, 0xFFBDBDBD, 0xFDBCBCBC, 0xFFBDBDBD, 0xF7B7B7B7,
-  0x6F525252, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x5E464646, 0xF6B6B6B6, 0xFFBDBDBD, 0xD59E9E9E, 0x33262626,
-  0x916B6B6B, 0xFFBDBDBD, 0xFFBDBDBD, 0xA2787878, 0x0C090909, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x110D0D0D, 0xAE818181, 0xFFBDBDBD, 0xFFBDBDBD, 0x966F6F6F,
-  0x08060606, 0x00000000, 0x00000000, 0x5D454545, 0xF3B4B4B4, 0xFFBDBDBD, 0xD79F9F9F, 0x2D212121, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x392A2A2A, 0xE0A6A6A6, 0xFFBDBDBD, 0xEFB1B1B1,
-  0x533E3E3E, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x281E1E1E, 0xD29C9C9C, 0xFFBDBDBD,
-  0xF6B6B6B6, 0x654B4B4B, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01010101, 0x6F525252, 0xFAB9B9B9, 0xFFBDBDBD,
-  0xCA969696, 0x231A1A1A, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x09070707, 0x9A727272, 0xFFBDBDBD, 0xFFBDBDBD, 0xA67B7B7B, 0x0D0A0A0A, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16101010, 0xB8888888, 0xFFBDBDBD,
-  0xFEBCBCBC, 0x8A666666, 0x05040404, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x533E3E3E, 0xEFB1B1B1, 0xFFBDBDBD, 0xDAA2A2A2, 0x30242424,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x43323232, 0xE6AAAAAA,
-  0xFFBDBDBD, 0xEAADADAD, 0x49363636, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x261C1C1C, 0xCF999999,
-  0xFFBDBDBD, 0xF7B7B7B7, 0x694E4E4E, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x04030303, 0x84626262,
-  0xFDBCBCBC, 0xFFBDBDBD, 0xBE8D8D8D, 0x1A131313, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x08060606, 0x966F6F6F, 0xFFBDBDBD, 0xFFBDBDBD, 0xAA7E7E7E, 0x0F0B0B0B, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1D151515,
-  0xC2909090, 0xFFBDBDBD, 0xFCBBBBBB, 0x805F5F5F, 0x03020202, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x513C3C3C, 0xEEB0B0B0, 0xFFBDBDBD, 0xE0A6A6A6,
-  0x382A2A2A, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x4E3A3A3A, 0xEDB0B0B0, 0xFFBDBDBD, 0xE3A8A8A8, 0x3E2E2E2E, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x231A1A1A,
-  0xCC979797, 0xFFBDBDBD, 0xF8B8B8B8, 0x6E525252, 0x01010101, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x07050505, 0x906B6B6B, 0xFEBCBCBC, 0xFFBDBDBD, 0xB3858585, 0x140F0F0F, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x07050505, 0x926C6C6C, 0xFEBCBCBC, 0xFFBDBDBD, 0xAE818181, 0x110D0D0D, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x20181818, 0xC7939393, 0xFFBDBDBD, 0xFBBABABA, 0x805F5F5F, 0x02010101, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x513C3C3C, 0xEFB1B1B1, 0xFFBDBDBD,
-  0xDFA5A5A5, 0x37292929, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x59424242, 0xF1B3B3B3, 0xFFBDBDBD, 0xDCA3A3A3, 0x35272727, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x1E161616, 0xC5929292, 0xFFBDBDBD, 0xFBBABABA, 0x805F5F5F, 0x02010101, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x0A070707, 0x9C747474, 0xFFBDBDBD, 0xFFBDBDBD, 0xA87D7D7D, 0x0E0A0A0A, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x06040404, 0x8D696969, 0xFEBCBCBC, 0xFFBDBDBD, 0xB2848484, 0x120D0D0D,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x2C212121, 0xD59E9E9E, 0xFFBDBDBD, 0xF6B6B6B6, 0x664C4C4C, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4D393939, 0xEDB0B0B0,
-  0xFFBDBDBD, 0xE1A7A7A7, 0x3A2B2B2B, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x654B4B4B, 0xF6B6B6B6, 0xFFBDBDBD, 0xD59E9E9E, 0x2C212121,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x1D151515, 0xC4919191, 0xFFBDBDBD, 0xFBBABABA, 0x805F5F5F, 0x02010101, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0E0A0A0A, 0xA87D7D7D, 0xFFBDBDBD, 0xFFBDBDBD, 0x9C747474,
-  0x0A070707, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05040404, 0x8A666666, 0xFEBCBCBC, 0xFFBDBDBD, 0xB5868686,
-  0x140F0F0F, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x35272727, 0xDDA4A4A4, 0xFFBDBDBD, 0xF1B3B3B3,
-  0x59424242, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4A373737,
-  0xEBAEAEAE, 0xFFBDBDBD, 0xE3A8A8A8, 0x3D2D2D2D, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01010101, 0x6F525252, 0xF9B9B9B9, 0xFFBDBDBD,
-  0xCD989898, 0x251B1B1B, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x1C151515, 0xC3919191, 0xFFBDBDBD, 0xFBBABABA, 0x7A5A5A5A, 0x02010101, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x140F0F0F, 0xB3858585, 0xFFBDBDBD,
-  0xFEBCBCBC, 0x906B6B6B, 0x07050505, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x04030303, 0x86636363, 0xFDBCBCBC, 0xFFBDBDBD,
-  0xB9898989, 0x16101010, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3E2E2E2E, 0xE3A8A8A8,
-  0xFFBDBDBD, 0xECAFAFAF, 0x4E3A3A3A, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x47353535, 0xE9ADADAD, 0xFFBDBDBD, 0xE5AAAAAA, 0x402F2F2F, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01010101, 0x6F525252,
-  0xFAB9B9B9, 0xFFBDBDBD, 0xC8949494, 0x21181818, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x1A131313, 0xBF8E8E8E, 0xFFBDBDBD, 0xFCBBBBBB, 0x7D5D5D5D, 0x02010101,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1A131313,
-  0xBE8D8D8D, 0xFFBDBDBD, 0xFDBCBCBC, 0x84626262, 0x04030303, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03020202, 0x82606060, 0xFDBCBCBC,
-  0xFFBDBDBD, 0xBC8B8B8B, 0x18121212, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x49363636, 0xEAADADAD, 0xFFBDBDBD, 0xE7ABABAB, 0x43323232, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x43323232, 0xE8ACACAC, 0xFFBDBDBD, 0xE7ABABAB, 0x43323232, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x04030303, 0x805F5F5F, 0xFDBCBCBC, 0xFFBDBDBD, 0xBC8B8B8B, 0x19131313, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x18121212, 0xBC8B8B8B, 0xFFBDBDBD, 0xFDBCBCBC, 0x82606060,
-  0x03020202, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x21181818, 0xC8949494, 0xFFBDBDBD, 0xFBBABABA, 0x77585858, 0x02010101, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02010101, 0x7E5D5D5D,
-  0xFCBBBBBB, 0xFFBDBDBD, 0xC08E8E8E, 0x1A131313, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x543E3E3E, 0xEFB1B1B1, 0xFFBDBDBD, 0xE0A6A6A6, 0x392A2A2A, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x402F2F2F, 0xE5AAAAAA, 0xFFBDBDBD, 0xEAADADAD, 0x47353535, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x08060606, 0x966F6F6F, 0xFFBDBDBD, 0xFFBDBDBD, 0xAD808080, 0x110D0D0D, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16101010, 0xB8888888, 0xFFBDBDBD, 0xFDBCBCBC,
-  0x86636363, 0x04030303, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x281E1E1E, 0xD19B9B9B, 0xFFBDBDBD, 0xF7B7B7B7, 0x6B4F4F4F, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02010101,
-  0x795A5A5A, 0xFBBABABA, 0xFFBDBDBD, 0xC3919191, 0x1C151515, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x5F464646, 0xF4B5B5B5, 0xFFBDBDBD, 0xD9A1A1A1, 0x30242424,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x3C2C2C2C, 0xE3A8A8A8, 0xFFBDBDBD, 0xEBAEAEAE, 0x4B383838, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0C090909, 0xA2787878, 0xFFBDBDBD, 0xFFBDBDBD, 0xA2787878,
-  0x0C090909, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x140F0F0F, 0xB4858585, 0xFFBDBDBD,
-  0xFEBCBCBC, 0x8A666666, 0x05040404, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x30242424, 0xD9A1A1A1, 0xFFBDBDBD, 0xF4B5B5B5,
-  0x5F464646, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x01010101, 0x75575757, 0xFAB9B9B9, 0xFFBDBDBD, 0xC6939393, 0x1E161616, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6B4F4F4F, 0xF7B7B7B7, 0xFFBDBDBD,
-  0xD19B9B9B, 0x281E1E1E, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x392A2A2A, 0xE1A7A7A7, 0xFFBDBDBD, 0xEDB0B0B0, 0x4E3A3A3A,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x110D0D0D, 0xAD808080, 0xFFBDBDBD,
-  0xFFBDBDBD, 0x966F6F6F, 0x08060606, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x120D0D0D, 0xB1838383,
-  0xFFBDBDBD, 0xFEBCBCBC, 0x8E696969, 0x06040404, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x392A2A2A, 0xE0A6A6A6,
-  0xFFBDBDBD, 0xEFB1B1B1, 0x543E3E3E, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x01010101, 0x71545454, 0xF9B9B9B9, 0xFFBDBDBD, 0xC9959595, 0x21181818, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02010101, 0x77585858,
-  0xFBBABABA, 0xFFBDBDBD, 0xC8949494, 0x21181818, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x36282828, 0xDEA5A5A5, 0xFFBDBDBD, 0xEFB1B1B1,
-  0x523D3D3D, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16101010,
-  0xB9898989, 0xFFBDBDBD, 0xFEBCBCBC, 0x8A666666, 0x05040404, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x100C0C0C,
-  0xAD808080, 0xFFBDBDBD, 0xFFBDBDBD, 0x926C6C6C, 0x07050505, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x43323232, 0xE6AAAAAA, 0xFFBDBDBD, 0xEAADADAD, 0x49363636, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x6D515151, 0xF8B8B8B8, 0xFFBDBDBD, 0xCC979797, 0x231A1A1A, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x04030303, 0x83616161, 0xFDBCBCBC, 0xFFBDBDBD, 0xBE8D8D8D, 0x1A131313, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x33262626, 0xDCA3A3A3, 0xFFBDBDBD,
-  0xF0B2B2B2, 0x553F3F3F, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x1D151515, 0xC2909090, 0xFFBDBDBD, 0xFCBBBBBB, 0x7E5D5D5D, 0x03020202, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x0F0B0B0B, 0xAA7E7E7E, 0xFFBDBDBD, 0xFFBDBDBD, 0x966F6F6F, 0x08060606, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x4E3A3A3A, 0xECAFAFAF, 0xFFBDBDBD, 0xE4A9A9A9, 0x3F2F2F2F, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6A4F4F4F, 0xF7B7B7B7, 0xFFBDBDBD, 0xCF999999, 0x251B1B1B,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0x00000000, 0x00000000, 0x07050505, 0x906B6B6B, 0xFEBCBCBC, 0xFFBDBDBD, 0xB4858585, 0x140F0F0F, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x31242424, 0xDAA2A2A2,
-  0xFFBDBDBD, 0xF2B3B3B3, 0x59424242, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0x00000000, 0x241B1B1B, 0xCC979797, 0xFFBDBDBD, 0xF9B9B9B9, 0x72545454, 0x01010101,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x0D0A0A0A, 0xA67B7B7B, 0xFFBDBDBD, 0xFFBDBDBD, 0x9A727272, 0x09070707, 0x00000000, 0x00000000,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0x5A434343, 0xF2B3B3B3, 0xFFBDBDBD, 0xDCA3A3A3, 0x35272727,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x654B4B4B, 0xF6B6B6B6, 0xFFBDBDBD, 0xD29C9C9C,
-  0x281E1E1E, 0x00000000, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xA87D7D7D,
-  0x0E0A0A0A, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2D212121,
-  0xD79F9F9F, 0xFFBDBDBD, 0xF3B4B4B4, 0x5E464646, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xF6B6B6B6,
-  0x654B4B4B, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-  0x00000000, 0x00000000, 0x0C090909, 0xA2787878, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD,
-  0xFFBDBDBD, 0xFFBDBDBD, 0xFFBDBDBD};
+Log_SetChannel(Resources);
 
-} // namespace Resources
\ No newline at end of file
+// Icon pixel data is stored zstd-compressed, and only decompressed while the caller needs it, i.e.
+// until the pixels have been uploaded to a texture. Keeps the data segment small and the pixels
+// out of the resident set.
+
+static constexpr u8 WINDOW_ICON_COMPRESSED[3210] = {
+  0x28, 0xB5, 0x2F, 0xFD, 0x04, 0x68, 0xED, 0x63, 0x00, 0xAA, 0x7F, 0x14, 0x1D, 0x35, 0x20, 0xE4,
+  0xCE, 0x18, 0x22, 0xBB, 0x6F, 0x13, 0xF2, 0xF6, 0xD0, 0xB8, 0xA5, 0xA1, 0x5B, 0x12, 0x73, 0xB6,
+  0x24, 0xBB, 0x10, 0xB7, 0x13, 0x4B, 0x71, 0x70, 0x98, 0x35, 0x6F, 0x79, 0x48, 0x89, 0xCE, 0x3A,
+  0x0E, 0xB0, 0x16, 0xCD, 0xC5, 0x5B, 0x5C, 0x9C, 0xB2, 0xF6, 0x05, 0xD8, 0x7B, 0xBA, 0x83, 0x96,
+  0x6C, 0x29, 0x53, 0xB0, 0x01, 0xC1, 0x01, 0xC6, 0x01, 0x3F, 0xD1, 0xD6, 0x2F, 0xDC, 0x5B, 0x8F,
+  0xBA, 0xD7, 0xB8, 0x77, 0xF2, 0xE3, 0x37, 0x39, 0xDC, 0x53, 0xDF, 0xE6, 0xEA, 0xB6, 0x9C, 0x45,
+  0x7A, 0x85, 0x14, 0x68, 0xEC, 0x1D, 0x3E, 0xCF, 0xC3, 0x93, 0x7B, 0x8B, 0xB3, 0xC3, 0x6B, 0x36,
+  0xDC, 0xF7, 0x94, 0x46, 0x8F, 0x3D, 0x20, 0x5D, 0x11, 0xDB, 0x53, 0x5B, 0xDD, 0xC0, 0xD1, 0xDD,
+  0xE1, 0xA1, 0x51, 0x32, 0xE9, 0xD8, 0x78, 0xCE, 0xED, 0xB9, 0x6E, 0x95, 0x66, 0xFB, 0x2E, 0x35,
+  0x17, 0xB6, 0xDF, 0xC5, 0x51, 0xDB, 0xC4, 0x81, 0x23, 0xBF, 0xC1, 0x58, 0xBE, 0x83, 0x1C, 0x12,
+  0xEB, 0x31, 0xED, 0x0B, 0xB1, 0x8A, 0x86, 0x6B, 0x95, 0x8E, 0x7A, 0x0C, 0x33, 0x8D, 0x14, 0xDC,
+  0xD6, 0xBA, 0xCB, 0x5D, 0x9E, 0xE9, 0xBC, 0x6F, 0x35, 0x47, 0x90, 0x3A, 0xC8, 0x36, 0x5F, 0x78,
+  0x45, 0x64, 0xF4, 0xC3, 0xA2, 0x63, 0x52, 0x86, 0x84, 0xC2, 0xA0, 0xDB, 0xC7, 0x0F, 0x3D, 0x39,
+  0x70, 0x6F, 0x71, 0x6E, 0xF0, 0xAC, 0x70, 0x9B, 0xEF, 0x28, 0x63, 0x8F, 0x3C, 0x18, 0xC1, 0x61,
+  0x2F, 0x5B, 0x31, 0x7B, 0xD5, 0x33, 0x74, 0xF9, 0xBF, 0x91, 0xEE, 0x51, 0xAB, 0x77, 0xFF, 0x1F,
+  0xDF, 0x3E, 0x32, 0xB7, 0x4D, 0xBD, 0x9E, 0x8A, 0xC6, 0xDE, 0x30, 0x0F, 0x9F, 0x5A, 0xEF, 0x40,
+  0xF4, 0xD5, 0xEB, 0xFB, 0x9C, 0x7E, 0x53, 0x85, 0xF3, 0x0F, 0xD1, 0x76, 0x69, 0x2B, 0x5E, 0x00,
+  0x9D, 0xE8, 0x4C, 0x59, 0x42, 0x2C, 0x8F, 0xDE, 0x38, 0x72, 0xF4, 0xA8, 0x7C, 0xDE, 0xE3, 0x86,
+  0x73, 0xB5, 0xD6, 0x7B, 0x66, 0xF3, 0xF5, 0xD9, 0xF9, 0xDF, 0x7D, 0x77, 0xEC, 0x37, 0x5D, 0x10,
+  0xAD, 0x65, 0xBB, 0x6D, 0x52, 0xA4, 0xD3, 0x66, 0x39, 0x37, 0x0F, 0xC7, 0xB7, 0x58, 0x21, 0xC9,
+  0x77, 0x59, 0xF7, 0xD2, 0x3E, 0x3C, 0x0C, 0xAC, 0xF7, 0x90, 0xD2, 0x48, 0xC1, 0xAD, 0xA9, 0xA7,
+  0x31, 0x1B, 0x38, 0xDF, 0xCD, 0x72, 0x9B, 0xC9, 0x9C, 0xFB, 0x48, 0xA2, 0xB7, 0x0E, 0x43, 0x6F,
+  0x1E, 0xDA, 0xC3, 0x26, 0xB3, 0x0F, 0x1E, 0x38, 0x42, 0xE8, 0x5C, 0x3E, 0xB0, 0x68, 0xF6, 0x4D,
+  0xED, 0xE7, 0xD7, 0x36, 0x94, 0x67, 0xEB, 0xDF, 0x79, 0x9F, 0xFB, 0x8D, 0x2C, 0xB7, 0x97, 0xCA,
+  0x37, 0xDA, 0xE4, 0x61, 0xFB, 0xD0, 0x6C, 0xEA, 0x33, 0xB3, 0x5F, 0x08, 0xA3, 0xFD, 0xBC, 0xA7,
+  0x87, 0x80, 0x42, 0xC8, 0xC4, 0xEC, 0x1F, 0x9D, 0x39, 0x74, 0xFE, 0x76, 0xD3, 0xDD, 0xEB, 0x2D,
+  0x99, 0x4B, 0x4D, 0x26, 0x77, 0x1F, 0xF9, 0xF6, 0x13, 0xA5, 0x3D, 0xE8, 0x4E, 0x0C, 0x7C, 0xE0,
+  0xDD, 0xB4, 0xD7, 0xBA, 0x59, 0x68, 0xC2, 0xB9, 0xFB, 0x70, 0x9B, 0x8D, 0x61, 0x79, 0xE4, 0x5B,
+  0xCE, 0x5D, 0xC5, 0x5F, 0xD6, 0xED, 0x16, 0x6F, 0xFA, 0xEC, 0x05, 0x4F, 0x20, 0xDF, 0x15, 0x5C,
+  0xA1, 0xD4, 0x57, 0x26, 0x31, 0x39, 0x38, 0x98, 0x06, 0x09, 0xA5, 0xD2, 0x40, 0xFA, 0x0C, 0x28,
+  0x48, 0x01, 0x42, 0x38, 0x0A, 0x13, 0x3E, 0xFB, 0x8E, 0x36, 0xE1, 0xC1, 0xEE, 0xBA, 0x50, 0x40,
+  0xBC, 0xBE, 0x17, 0x07, 0xBF, 0x04, 0x2D, 0x7C, 0x07, 0x5C, 0x6E, 0x80, 0x88, 0xA0, 0xF7, 0x9A,
+  0x11, 0xB3, 0xB1, 0x15, 0x57, 0x7A, 0xDE, 0x52, 0x51, 0x55, 0x80, 0x6F, 0x1C, 0x8D, 0xEF, 0x36,
+  0x58, 0x3F, 0x3B, 0x1E, 0x64, 0x43, 0xB6, 0xD0, 0xC1, 0x27, 0x0A, 0xBD, 0x45, 0x7C, 0xD4, 0x30,
+  0x01, 0xE2, 0x3B, 0x77, 0x07, 0x45, 0x73, 0x5B, 0x21, 0xFA, 0x69, 0xE0, 0x20, 0x08, 0xE8, 0x8E,
+  0x0D, 0x12, 0x37, 0x38, 0x79, 0x72, 0x7E, 0x7F, 0xAB, 0x0D, 0xC1, 0x91, 0xE2, 0x03, 0x17, 0x55,
+  0x54, 0x14, 0xBB, 0xB2, 0xB3, 0x27, 0x69, 0xF0, 0xE6, 0xB8, 0x5D, 0xBA, 0xB0, 0x61, 0x39, 0x8B,
+  0x11, 0x20, 0x42, 0x7C, 0x5D, 0xBE, 0xB5, 0xFE, 0xBC, 0xA7, 0x02, 0xDF, 0x50, 0x7D, 0x6F, 0x26,
+  0x6C, 0x0A, 0x95, 0x01, 0x49, 0x1B, 0xD3, 0x85, 0xD4, 0xE2, 0x76, 0xC0, 0x8E, 0x22, 0x06, 0x26,
+  0x62, 0x7E, 0x4F, 0x1D, 0xBD, 0xAF, 0xB2, 0x6F, 0xB4, 0x79, 0x6E, 0xB3, 0x4A, 0x49, 0x26, 0x8F,
+  0xDB, 0xCC, 0x75, 0xF4, 0x8E, 0x07, 0xEA, 0xB0, 0xCF, 0x62, 0x38, 0x74, 0x0C, 0x69, 0x83, 0x7B,
+  0x77, 0x6E, 0x1F, 0x94, 0x50, 0xDE, 0x4F, 0x6C, 0x8C, 0xCE, 0x96, 0x90, 0x91, 0xFB, 0xE3, 0x33,
+  0x99, 0x4F, 0x4A, 0xDB, 0xD3, 0xDD, 0xFE, 0x6C, 0xDE, 0xCE, 0xFD, 0x43, 0x91, 0xB3, 0x0B, 0x4E,
+  0x66, 0x19, 0x11, 0x36, 0x3B, 0xBB, 0xEF, 0x97, 0xB0, 0x34, 0x1E, 0x42, 0x8B, 0x22, 0x77, 0xE2,
+  0x82, 0xD1, 0x16, 0x46, 0x08, 0xDA, 0x7B, 0xA9, 0x46, 0xFF, 0x78, 0x64, 0x17, 0x39, 0x2B, 0x43,
+  0x4B, 0x93, 0xCB, 0xFB, 0x99, 0xD2, 0x0E, 0x2F, 0xD5, 0x35, 0xE2, 0x4F, 0x11, 0x20, 0x3C, 0x09,
+  0xC3, 0xF4, 0x72, 0x4C, 0x9D, 0x57, 0xEE, 0xB5, 0x47, 0xF3, 0x1D, 0x5F, 0x5D, 0xDB, 0x91, 0x27,
+  0x6A, 0x9C, 0xA6, 0xA6, 0xA6, 0x3E, 0xA0, 0x89, 0xE9, 0x4F, 0x0B, 0x5E, 0x98, 0x9B, 0x73, 0xC7,
+  0x6D, 0xCA, 0x73, 0x5E, 0x9E, 0x9C, 0x1F, 0xBE, 0xE3, 0x1E, 0xB6, 0xCB, 0xBC, 0x93, 0xFB, 0x07,
+  0x28, 0x99, 0xF3, 0x07, 0x0F, 0x20, 0x1C, 0x2A, 0x01, 0xEB, 0xB1, 0x59, 0x9D, 0x3C, 0x29, 0xD6,
+  0xD6, 0xF9, 0xD2, 0x33, 0x81, 0x9E, 0x20, 0xEC, 0xC9, 0xA3, 0x50, 0xAC, 0x74, 0x52, 0x28, 0xD7,
+  0x4B, 0x67, 0x64, 0x79, 0x77, 0x89, 0xDC, 0x3E, 0xD2, 0xDC, 0x68, 0x92, 0x56, 0x3C, 0xF9, 0x06,
+  0x9C, 0xD4, 0x1D, 0x6A, 0x6A, 0xE2, 0x0D, 0x16, 0x2C, 0x78, 0x3C, 0x84, 0x0A, 0x97, 0xC6, 0xFB,
+  0xFD, 0xDC, 0xD5, 0xAE, 0xDC, 0x69, 0xDA, 0xB9, 0xC9, 0x7A, 0x58, 0xDE, 0x91, 0xE6, 0xC1, 0xD9,
+  0x7C, 0x85, 0x17, 0x65, 0xCF, 0x50, 0xE1, 0xE9, 0x4B, 0xD2, 0xA5, 0xC7, 0x42, 0xDE, 0x7E, 0x31,
+  0x79, 0x72, 0x53, 0x37, 0xE5, 0x76, 0xB2, 0xE8, 0x3D, 0x96, 0xE8, 0x4E, 0x93, 0x75, 0xA5, 0x30,
+  0x05, 0x17, 0x65, 0x47, 0xE0, 0xE4, 0x74, 0x28, 0x84, 0xA8, 0xC7, 0x57, 0x0A, 0xBF, 0xE4, 0x98,
+  0x94, 0xC7, 0xEC, 0xE5, 0xE9, 0x95, 0xC1, 0xF4, 0x6B, 0x27, 0x97, 0xD2, 0xEE, 0xF1, 0x6E, 0x34,
+  0x39, 0x8E, 0xC3, 0xFD, 0x01, 0x18, 0x44, 0x1E, 0x6D, 0x61, 0xE4, 0x70, 0x99, 0x41, 0x33, 0xB5,
+  0x6D, 0xEB, 0x68, 0xF9, 0x36, 0x78, 0xEF, 0x60, 0x0B, 0x06, 0x70, 0x95, 0xE2, 0x9F, 0x1C, 0x06,
+  0xFD, 0x69, 0x85, 0x9F, 0x2F, 0x10, 0x29, 0x75, 0xE8, 0x50, 0xE1, 0xD8, 0x7C, 0xD1, 0x55, 0xE1,
+  0xE2, 0x2D, 0xFD, 0xC5, 0xED, 0xA9, 0x60, 0x7C, 0xC5, 0x58, 0xE4, 0xC9, 0xE5, 0xD8, 0xD0, 0x0E,
+  0x88, 0xBA, 0x05, 0x17, 0xDA, 0x25, 0xC9, 0xD5, 0x8C, 0x67, 0x60, 0x76, 0x9D, 0x35, 0x28, 0xBD,
+  0xCE, 0xE9, 0xE2, 0x0C, 0x7F, 0x43, 0xE3, 0x23, 0xA5, 0x2E, 0x42, 0x5A, 0x11, 0x50, 0xEC, 0x69,
+  0x01, 0x26, 0x04, 0xC1, 0xFD, 0xBB, 0xB5, 0x12, 0x2C, 0xDF, 0xF7, 0x8D, 0x2E, 0xB7, 0x47, 0x60,
+  0x72, 0x5B, 0x2A, 0xF0, 0xF0, 0xD4, 0xE0, 0x9F, 0x5B, 0x86, 0x8E, 0x3C, 0xB9, 0x1E, 0x9F, 0x21,
+  0x14, 0x9D, 0x78, 0x82, 0x98, 0xAC, 0x74, 0xB2, 0xA8, 0xF4, 0xC2, 0x63, 0xDF, 0xF9, 0x32, 0x4C,
+  0xE6, 0xE5, 0x3A, 0x5F, 0x1C, 0xE2, 0xC6, 0x59, 0xD7, 0x39, 0xCA, 0x8F, 0x11, 0x2C, 0x35, 0x08,
+  0x05, 0x47, 0x19, 0x36, 0x68, 0xC7, 0x5F, 0x61, 0xF4, 0x86, 0xAB, 0x95, 0x7B, 0x47, 0x57, 0x6E,
+  0xB0, 0x41, 0x77, 0x6E, 0xFD, 0x39, 0x94, 0x4B, 0x12, 0xC9, 0x73, 0xCB, 0xB1, 0xA3, 0x1D, 0x26,
+  0x1B, 0xCE, 0xC1, 0x1D, 0x00, 0xDF, 0xD8, 0x3A, 0x91, 0xF4, 0x76, 0xD9, 0x33, 0x3B, 0xEC, 0x5A,
+  0x78, 0x0A, 0x89, 0xF9, 0xA5, 0x6C, 0xAD, 0x40, 0xB5, 0xAC, 0x5C, 0x18, 0x89, 0x09, 0xE3, 0xD8,
+  0xBC, 0xD3, 0x04, 0xA5, 0x92, 0xA7, 0x17, 0x64, 0x43, 0x43, 0x34, 0x82, 0xAB, 0xD8, 0xE4, 0xF8,
+  0xF6, 0xDB, 0x22, 0x7E, 0xD9, 0x1C, 0x22, 0xBD, 0x4D, 0xF5, 0xC7, 0xED, 0x1B, 0x8C, 0xDF, 0x96,
+  0xD3, 0x7E, 0x7B, 0x71, 0x56, 0xAC, 0xF3, 0xF8, 0x26, 0x93, 0x01, 0x61, 0x1E, 0xDE, 0xAC, 0xB8,
+  0xD1, 0xDE, 0xAD, 0xE2, 0x07, 0x18, 0x35, 0x5B, 0x06, 0xA5, 0xDC, 0x5F, 0xB0, 0xD9, 0x6C, 0xE0,
+  0xA4, 0x1A, 0x84, 0x6E, 0x2B, 0x02, 0xFA, 0xEB, 0x8A, 0xFD, 0xA1, 0x85, 0xDA, 0x9D, 0x19, 0x71,
+  0xAF, 0xD0, 0xA1, 0x99, 0x4F, 0xD9, 0x80, 0xEE, 0x29, 0x6B, 0x54, 0xAC, 0x8D, 0x80, 0x5C, 0xBF,
+  0x13, 0x49, 0xCF, 0xA9, 0x95, 0xDB, 0x68, 0xA8, 0xF7, 0x57, 0xBE, 0x51, 0xC5, 0x4D, 0x56, 0x76,
+  0xF8, 0x42, 0x18, 0x4A, 0xC6, 0x3E, 0x49, 0x29, 0x0D, 0xBA, 0xFB, 0x80, 0x91, 0x41, 0x59, 0x6C,
+  0xDE, 0x65, 0xC6, 0x1C, 0x4D, 0xED, 0x6C, 0x81, 0xF5, 0x2E, 0xF2, 0x6D, 0xF7, 0xBC, 0xCE, 0x10,
+  0xEC, 0xC9, 0x12, 0xF2, 0x29, 0x2D, 0x50, 0xA4, 0x93, 0x15, 0x74, 0xB4, 0x3C, 0xE2, 0x5E, 0xF7,
+  0xEF, 0xD4, 0x36, 0x22, 0xA5, 0xBD, 0x65, 0xD8, 0x2D, 0xC7, 0x52, 0x41, 0x33, 0xFE, 0x4F, 0x16,
+  0x30, 0xCC, 0x97, 0x03, 0xE8, 0x31, 0xB7, 0xD1, 0x69, 0xBF, 0xF6, 0x0D, 0x46, 0xD4, 0x9E, 0xBA,
+  0x23, 0xD5, 0x16, 0xF8, 0x18, 0xF4, 0xA1, 0xF7, 0x4F, 0x37, 0x66, 0x1B, 0x0F, 0xF5, 0xAC, 0x3A,
+  0x22, 0xB9, 0x4F, 0x0F, 0xED, 0xE5, 0x77, 0x9A, 0xDA, 0x43, 0x36, 0x94, 0x1F, 0x98, 0x0E, 0x71,
+  0x8D, 0xEC, 0xBF, 0x6D, 0x36, 0xCF, 0x1E, 0xF5, 0xDB, 0x15, 0xDA, 0x28, 0x8F, 0x9C, 0xD1, 0xA0,
+  0xFC, 0xFB, 0x7C, 0x68, 0xA8, 0xA7, 0x71, 0xF1, 0x4A, 0xC7, 0xCD, 0xAC, 0x4A, 0xDC, 0xBF, 0x04,
+  0x1D, 0xA0, 0x0B, 0xD1, 0x39, 0xC0, 0x2B, 0xD1, 0x89, 0xC0, 0x34, 0x31, 0x96, 0x80, 0xE2, 0xB0,
+  0x9F, 0x52, 0x60, 0x5B, 0x04, 0xD9, 0x9E, 0x6E, 0x05, 0x7B, 0x09, 0x96, 0xB2, 0x06, 0x9B, 0x38,
+  0xA9, 0x00, 0xAF, 0xD1, 0xAC, 0xEC, 0x10, 0x00, 0x1E, 0x1C, 0x0B, 0x14, 0x00, 0xE1, 0xA7, 0xFB,
+  0x0A, 0x52, 0x7B, 0xC9, 0xD0, 0x6B, 0x2B, 0x17, 0x7D, 0x49, 0x2F, 0x7E, 0xEC, 0xC5, 0x58, 0xC2,
+  0x02, 0x44, 0x8C, 0xA7, 0xFE, 0xBE, 0x30, 0x15, 0xE1, 0x9F, 0x58, 0x59, 0x2F, 0x74, 0xAB, 0x10,
+  0xA1, 0x92, 0xD7, 0x23, 0x0B, 0xA6, 0x29, 0x21, 0xA5, 0x04, 0x22, 0x1A, 0xBB, 0xC9, 0x43, 0xA0,
+  0x86, 0xA5, 0xE2, 0xD8, 0xBD, 0xAD, 0xD1, 0xD2, 0x56, 0xBD, 0x24, 0xD0, 0xB5, 0x61, 0xF1, 0x58,
+  0x8B, 0x4E, 0xAC, 0x3D, 0x97, 0x51, 0x2E, 0xC7, 0xAA, 0xD4, 0xEB, 0x31, 0x2B, 0xC0, 0x74, 0x50,
+  0x4C, 0xC1, 0x04, 0x9E, 0x56, 0x10, 0x42, 0x4F, 0x57, 0xE7, 0xE0, 0xBA, 0x0D, 0x5D, 0xDC, 0x02,
+  0x28, 0x90, 0x17, 0x73, 0xA6, 0x7A, 0x06, 0x60, 0x7C, 0xEE, 0xE4, 0x92, 0x7C, 0xB4, 0x83, 0xE4,
+  0x93, 0xB6, 0x18, 0x0F, 0x47, 0xC1, 0x55, 0xD8, 0x3F, 0xB5, 0xFE, 0x4C, 0x46, 0xBB, 0x1E, 0xD5,
+  0x96, 0x3C, 0x38, 0x2A, 0x60, 0xF2, 0x20, 0xA8, 0x99, 0xA6, 0x85, 0xBA, 0x5A, 0x85, 0x6B, 0xA6,
+  0x30, 0x45, 0xF9, 0x64, 0xD0, 0xD0, 0xDD, 0xC1, 0x89, 0x40, 0x8F, 0x4E, 0x11, 0x5D, 0xFA, 0x42,
+  0xFB, 0xA8, 0x58, 0xE5, 0xA3, 0x25, 0xFC, 0xDC, 0xE9, 0x8B, 0xAD, 0x12, 0x67, 0x33, 0x68, 0xB4,
+  0x2B, 0xB2, 0x23, 0x80, 0x11, 0x26, 0x41, 0xAF, 0x12, 0x41, 0xB0, 0xB9, 0xD1, 0x59, 0xDD, 0xD0,
+  0x51, 0xB7, 0x65, 0xD2, 0x54, 0x3F, 0x21, 0xCC, 0xD0, 0x9D, 0x39, 0xB6, 0x67, 0x7F, 0x6C, 0x26,
+  0x3F, 0x1A, 0x46, 0x29, 0x47, 0xBF, 0xF2, 0xC8, 0xF0, 0x19, 0x5C, 0x65, 0xD8, 0x30, 0x15, 0xB6,
+  0x1D, 0x88, 0x18, 0x8C, 0xA1, 0x56, 0x5C, 0xAD, 0x00, 0x64, 0x01, 0xB2, 0x79, 0x56, 0x05, 0x42,
+  0x82, 0x72, 0x91, 0xF8, 0x26, 0x6B, 0x79, 0x97, 0x93, 0x8B, 0x9B, 0x9B, 0x8B, 0x3B, 0x91, 0xB6,
+  0xC0, 0x4F, 0x48, 0x42, 0x79, 0x78, 0x86, 0x9D, 0x3C, 0x9E, 0x09, 0x4D, 0x51, 0x69, 0x09, 0x4F,
+  0x05, 0x72, 0x67, 0x1F, 0xDD, 0x02, 0xB6, 0x02, 0x0D, 0x38, 0x75, 0x09, 0x52, 0x51, 0xDA, 0xF0,
+  0x87, 0x28, 0x9E, 0x02, 0xBC, 0xD3, 0x0A, 0xCF, 0x9F, 0x59, 0x7D, 0xDE, 0x34, 0x25, 0xF4, 0x10,
+  0x63, 0x87, 0xCF, 0x02, 0xE6, 0xCD, 0xE9, 0x4E, 0x86, 0xEA, 0x66, 0x96, 0xB1, 0x96, 0xDD, 0x14,
+  0xF0, 0x43, 0xB3, 0xEB, 0x94, 0x21, 0xCB, 0x31, 0xD8, 0x66, 0x57, 0x73, 0xAC, 0xA3, 0xFE, 0x9A,
+  0x4A, 0x50, 0x86, 0xB3, 0x4A, 0xD0, 0x1B, 0x53, 0x15, 0xDE, 0x89, 0xD5, 0xE7, 0x51, 0x2E, 0x43,
+  0x8F, 0x6E, 0x28, 0x7C, 0x53, 0x61, 0x1F, 0x67, 0x01, 0x7A, 0x02, 0x12, 0x82, 0x3E, 0x83, 0x88,
+  0xE0, 0xC7, 0xA0, 0xA9, 0xBE, 0xAE, 0x4A, 0x7D, 0xB5, 0x0D, 0x9C, 0x96, 0xAE, 0x0D, 0x15, 0x4C,
+  0x1D, 0x1D, 0xD5, 0x8D, 0x82, 0x18, 0x91, 0xDE, 0x77, 0x58, 0x2A, 0x30, 0x48, 0xC7, 0x56, 0x8A,
+  0xED, 0xD4, 0x02, 0x14, 0xC3, 0xA9, 0xF5, 0xC7, 0x7B, 0x39, 0xDA, 0x01, 0x52, 0x86, 0x62, 0x5D,
+  0xED, 0x04, 0x83, 0x4F, 0xA8, 0xA2, 0xF1, 0x9E, 0x22, 0x24, 0x22, 0x22, 0x22, 0x22, 0x49, 0x92,
+  0xA4, 0x03, 0x42, 0x8B, 0x96, 0x21, 0xC6, 0x38, 0x4E, 0x5D, 0x0F, 0x22, 0x14, 0x0C, 0x72, 0x44,
+  0x09, 0x88, 0x80, 0x10, 0x42, 0x10, 0x21, 0x82, 0x25, 0x20, 0x02, 0x21, 0x81, 0x50, 0x20, 0x81,
+  0xCC, 0x88, 0x88, 0x48, 0x51, 0x07, 0x0A, 0xCE, 0x8E, 0x61, 0xED, 0xC0, 0x2A, 0x6B, 0x92, 0xD0,
+  0xD7, 0xDA, 0xBF, 0xEC, 0xBB, 0x96, 0x97, 0x69, 0x27, 0x83, 0x4E, 0xA0, 0xCC, 0x91, 0xE3, 0x3E,
+  0xAC, 0x03, 0xB4, 0xDB, 0xB1, 0xDB, 0x05, 0x0C, 0xAE, 0x45, 0xCE, 0xFB, 0xB2, 0x3B, 0x03, 0xF6,
+  0xB3, 0xA1, 0x3C, 0xB0, 0xD3, 0x40, 0x66, 0x20, 0x8E, 0xBF, 0x29, 0xFC, 0xBA, 0x14, 0xE1, 0x0F,
+  0xB8, 0x62, 0x37, 0x10, 0x3B, 0x20, 0xB1, 0x38, 0x30, 0xEE, 0x3E, 0x21, 0x78, 0x3C, 0x68, 0x65,
+  0x7D, 0x90, 0xB9, 0x10, 0x6C, 0x32, 0xD7, 0x95, 0x3B, 0xDF, 0x8B, 0xEF, 0x15, 0x17, 0xDD, 0xE1,
+  0xFB, 0xEE, 0x07, 0xEE, 0x41, 0x70, 0xA4, 0xFF, 0x8C, 0x1C, 0x90, 0x7F, 0xDF, 0x8E, 0xEF, 0x33,
+  0x14, 0xFE, 0xA1, 0x7D, 0x3B, 0xB8, 0x77, 0x06, 0xE2, 0xF5, 0x5F, 0x6D, 0xD1, 0x81, 0x3D, 0xDD,
+  0xDE, 0x7D, 0x5D, 0x08, 0xCA, 0x99, 0xEB, 0x69, 0x85, 0x28, 0xAA, 0x5C, 0x9E, 0x5A, 0x0E, 0x04,
+  0x23, 0x5D, 0xA5, 0x36, 0x75, 0x98, 0x8D, 0x2E, 0xC2, 0xBD, 0xF6, 0xE9, 0xE8, 0x0E, 0x2C, 0x95,
+  0x71, 0xBD, 0xB3, 0x6E, 0x98, 0x68, 0x20, 0xEE, 0x10, 0xF3, 0xD9, 0xE4, 0x4C, 0x47, 0x12, 0xCA,
+  0x7F, 0x98, 0xF7, 0x2C, 0x15, 0xEE, 0xC0, 0x74, 0x58, 0xAA, 0x77, 0x84, 0x68, 0x3B, 0xDA, 0x6F,
+  0x1A, 0x5A, 0xAF, 0xA1, 0xEF, 0xD7, 0xF2, 0x77, 0x40, 0xFB, 0x7F, 0x27, 0x9E, 0xC0, 0xB3, 0x22,
+  0xC2, 0x57, 0x17, 0xFB, 0xEB, 0x5F, 0x58, 0x38, 0xEE, 0x61, 0x5C, 0xD5, 0x80, 0x40, 0x2E, 0xE2,
+  0xD8, 0x9D, 0x15, 0xD2, 0xCC, 0x24, 0x75, 0x0F, 0xEE, 0x42, 0x66, 0x3D, 0x1F, 0x47, 0x5B, 0xE9,
+  0xBE, 0xDD, 0x8E, 0x8E, 0x0E, 0xA0, 0x80, 0x8B, 0xAC, 0xB7, 0xBD, 0x5E, 0xAC, 0x1E, 0x06, 0xB9,
+  0x6F, 0xDA, 0x6F, 0x0F, 0x26, 0xB2, 0x3D, 0xBB, 0x74, 0x80, 0xCC, 0x7A, 0x91, 0xE7, 0xF6, 0x74,
+  0xB1, 0x42, 0x10, 0xC8, 0x8A, 0xED, 0xCE, 0x83, 0x9C, 0xA3, 0x12, 0xEF, 0xFF, 0xD1, 0x1D, 0xF8,
+  0x99, 0x8B, 0x08, 0xE0, 0xBF, 0xEB, 0xC1, 0x45, 0x18, 0x98, 0x19, 0x79, 0x64, 0x1B, 0x91, 0xDD,
+  0x2B, 0x8A, 0xD1, 0x5C, 0xC4, 0xE3, 0xC0, 0x7C, 0x5E, 0x45, 0x2A, 0xCE, 0x12, 0xBE, 0xED, 0xBF,
+  0x61, 0x09, 0x1C, 0x59, 0x9E, 0x00, 0xEC, 0x75, 0x1A, 0x08, 0x84, 0x0D, 0x02, 0xC4, 0xB8, 0x17,
+  0x41, 0xD6, 0xB9, 0x66, 0x80, 0xC9, 0x8A, 0x34, 0xBF, 0x93, 0x02, 0x38, 0xF9, 0x0A, 0xD8, 0x5C,
+  0x42, 0xC9, 0x77, 0xB7, 0x47, 0xC8, 0x39, 0x19, 0x40, 0x31, 0x09, 0x80, 0x56, 0x40, 0x13, 0xD6,
+  0x17, 0x89, 0xD9, 0x3A, 0x6B, 0xD7, 0x07, 0x50, 0x14, 0x7C, 0xE7, 0x0C, 0xE2, 0x51, 0x97, 0xA1,
+  0x3F, 0xA9, 0x17, 0x79, 0x63, 0xD2, 0x61, 0x63, 0x9F, 0x7F, 0xBB, 0x37, 0xBD, 0x03, 0xC0, 0xC1,
+  0xF3, 0x4A, 0xF5, 0x00, 0x4D, 0xDD, 0x41, 0x2C, 0x19, 0xA5, 0x36, 0x14, 0x7E, 0xF7, 0xE6, 0x07,
+  0x32, 0x12, 0xE8, 0x20, 0xBA, 0x17, 0xF2, 0xD7, 0x43, 0x73, 0xC0, 0x3A, 0x58, 0x86, 0xA2, 0x92,
+  0x37, 0xA8, 0x62, 0xA1, 0x62, 0x3E, 0xA0, 0x89, 0xCF, 0xC3, 0xB5, 0x18, 0x40, 0x78, 0xC7, 0x56,
+  0xC2, 0xFB, 0xA4, 0xFF, 0x98, 0xFE, 0x76, 0xD0, 0x4E, 0x39, 0xB0, 0xCF, 0xF5, 0xFF, 0xED, 0x5D,
+  0x6A, 0xAF, 0x32, 0xA3, 0xC8, 0xCD, 0x4A, 0x61, 0xA2, 0x27, 0x4F, 0x6C, 0x80, 0x17, 0x7E, 0x5E,
+  0x50, 0x37, 0xE0, 0x50, 0xCF, 0xFD, 0x08, 0x30, 0x33, 0xEC, 0x4B, 0x59, 0xD3, 0xF6, 0x07, 0x42,
+  0x0B, 0xD9, 0x00, 0xD0, 0x6B, 0xD4, 0x8E, 0x07, 0xE4, 0x79, 0xC4, 0x91, 0x5C, 0xFD, 0x8A, 0x38,
+  0x5A, 0xF1, 0x22, 0x9C, 0xF7, 0x77, 0x60, 0x06, 0xEA, 0xFF, 0x8F, 0xDD, 0x3F, 0x8E, 0x84, 0xB0,
+  0x40, 0x70, 0x20, 0x7D, 0x80, 0xDE, 0x59, 0x7D, 0x7C, 0x89, 0x9D, 0x5F, 0xAE, 0x0B, 0xBC, 0x10,
+  0x83, 0x2B, 0x42, 0xBA, 0xDB, 0xC5, 0x56, 0x03, 0x60, 0xF2, 0xA1, 0x57, 0xFD, 0x91, 0x7B, 0xBB,
+  0x03, 0xEA, 0x93, 0xBD, 0x38, 0x14, 0x2F, 0x87, 0x67, 0x89, 0xD6, 0xE4, 0x02, 0x6A, 0x5F, 0x4A,
+  0xCD, 0x3E, 0x89, 0xB9, 0x67, 0x97, 0x07, 0x32, 0x10, 0x3D, 0xCB, 0xA3, 0x0E, 0x7A, 0xE7, 0x5E,
+  0x55, 0xEC, 0xE1, 0x14, 0x33, 0x3B, 0x9E, 0x62, 0xEA, 0x01, 0xDB, 0xBA, 0xC8, 0x8E, 0xC2, 0xE9,
+  0x39, 0x1F, 0x26, 0xF5, 0xAE, 0x51, 0x7F, 0xC2, 0x9E, 0xFD, 0x46, 0x0D, 0x7B, 0x85, 0xD9, 0x3F,
+  0xD2, 0xFF, 0x40, 0x03, 0x5E, 0x64, 0x00, 0x41, 0x3B, 0x91, 0x98, 0x2E, 0xEC, 0xA2, 0x03, 0xCC,
+  0x00, 0x21, 0xF7, 0x9D, 0x77, 0xB5, 0x22, 0x2E, 0x50, 0xEF, 0x01, 0x19, 0xBC, 0x88, 0x79, 0x39,
+  0x38, 0x3D, 0x77, 0x91, 0x1F, 0xF0, 0xD6, 0xF3, 0xBC, 0x7C, 0x0C, 0x5C, 0x93, 0x28, 0x0E, 0xC0,
+  0x28, 0x2F, 0xBC, 0x8B, 0x7F, 0x56, 0xFD, 0x26, 0x0D, 0x66, 0x5D, 0x24, 0x88, 0x60, 0xA3, 0xC4,
+  0x31, 0x6A, 0xB5, 0x8B, 0xCE, 0x32, 0xB0, 0x2C, 0x77, 0x52, 0xD0, 0xC0, 0x5B, 0xA1, 0x0A, 0x9C,
+  0xDF, 0x0D, 0x66, 0x00, 0x2E, 0x72, 0x8C, 0x01, 0xAD, 0x3F, 0xE0, 0x7C, 0x44, 0x8F, 0x6D, 0xAF,
+  0xAC, 0xBB, 0x88, 0x1F, 0x96, 0x04, 0x5D, 0x93, 0x02, 0xF7, 0x49, 0xB3, 0x88, 0x53, 0x09, 0x5F,
+  0xA4, 0x2E, 0x03, 0xFE, 0x97, 0x8D, 0x96, 0x77, 0x7B, 0x26, 0xDE, 0x55, 0xE1, 0xA1, 0x46, 0x00,
+  0xA8, 0x1B, 0xC1, 0x39, 0xDE, 0x3B, 0x91, 0x66, 0x5A, 0x9E, 0x49, 0x5F, 0x44, 0xB3, 0xAE, 0x29,
+  0x7E, 0xB3, 0x3D, 0xAF, 0x77, 0xD5, 0x10, 0xC7, 0x1B, 0xAB, 0x01, 0xF9, 0x4E, 0x3C, 0xD0, 0x7B,
+  0xA6, 0x00, 0xBE, 0xC8, 0x29, 0x0F, 0xC0, 0xF5, 0xC3, 0x0B, 0x43, 0x7A, 0xB7, 0x5D, 0x17, 0xBA,
+  0x81, 0xF4, 0x91, 0xB6, 0xB8, 0x60, 0xB2, 0xFF, 0x7B, 0xC4, 0x8A, 0x5D, 0x24, 0xE9, 0x3F, 0xD0,
+  0xC4, 0x7A, 0xF8, 0x62, 0x9A, 0x5E, 0x0E, 0xD9, 0xBB, 0x74, 0x1B, 0x5C, 0x4C, 0x3C, 0x82, 0x92,
+  0xC5, 0xE5, 0x1C, 0xFD, 0xBE, 0x8B, 0x20, 0x7D, 0xD4, 0x74, 0xC7, 0xFE, 0xCE, 0xAB, 0xD3, 0xBB,
+  0x70, 0x04, 0xEE, 0x09, 0x85, 0x72, 0x76, 0x91, 0x65, 0x92, 0xCF, 0x7F, 0xA2, 0xDF, 0xFF, 0xF6,
+  0xCF, 0x7A, 0xC5, 0x99, 0xE1, 0x45, 0xB4, 0xB1, 0xFE, 0xFB, 0x81, 0xF8, 0x7C, 0x97, 0x7A, 0x7B,
+  0xF7, 0x68, 0xDC, 0xB7, 0x42, 0x23, 0xB7, 0x01, 0x55, 0x9E, 0x3C, 0xE4, 0xA2, 0xAC, 0xC8, 0x8F,
+  0xFF, 0x6F, 0x8B, 0xAB, 0x21, 0x88, 0x1F, 0xD4, 0x1D, 0xC8, 0xF8, 0xB4, 0x84, 0x99, 0x8D, 0x07,
+  0x17, 0xA9, 0xAD, 0x40, 0xCD, 0x82, 0xCF, 0xF8, 0xE3, 0xA8, 0x60, 0xBB, 0x51, 0x0F, 0x03, 0x35,
+  0xCC, 0x4C, 0x3C, 0x29, 0xF3, 0x90, 0x53, 0x0E, 0x86, 0xF8, 0x32, 0x2F, 0x3C, 0x20, 0xE0, 0xBC,
+  0xA8, 0xFB, 0xFB, 0x9C, 0x2A, 0xB7, 0x1B, 0xB9, 0x03, 0xF4, 0xEE, 0x6F, 0x73, 0xAA, 0x3D, 0x5C,
+  0x7B, 0xBD, 0x60, 0xBF, 0x8C, 0xEF, 0xB2, 0x9D, 0x6B, 0xFB, 0x42, 0x44, 0xC0, 0x1F, 0x47, 0x14,
+  0xE3, 0x73, 0xDC, 0xF4, 0xAD, 0x0E, 0xAC, 0x86, 0x30, 0xEA, 0x7C, 0x2F, 0x40, 0xD5, 0x82, 0xD4,
+  0x9F, 0xE2, 0x8A, 0x79, 0x47, 0x76, 0x1E, 0x40, 0xE7, 0xA8, 0x0D, 0x25, 0x52, 0x1F, 0xD0, 0xB6,
+  0x53, 0xF2, 0xFB, 0xED, 0x1C, 0x6E, 0x06, 0x1D, 0xF0, 0x47, 0xEE, 0xBC, 0x13, 0x79, 0x67, 0x31,
+  0x0C, 0x0E, 0x39, 0x40, 0x28, 0xEE, 0x0A, 0x08, 0x70, 0x1D, 0x42, 0x90, 0x86, 0x2F, 0x03, 0x4C,
+  0x90, 0xED, 0x37, 0xFE, 0x3C, 0xE2, 0x82, 0x30, 0x53, 0x7F, 0xE9, 0x9C, 0xD1, 0x77, 0x42, 0xF3,
+  0x58, 0xC1, 0xEF, 0x71, 0x41, 0x8E, 0xA2, 0xBA, 0x8E, 0xFC, 0x8A, 0xCF, 0x06, 0x24, 0xB9, 0x6E,
+  0x99, 0xEA, 0x8F, 0x1D, 0x6A, 0x3F, 0xAD, 0x0E, 0x80, 0xBA, 0xA9, 0xC7, 0x05, 0x7A, 0x27, 0xFB,
+  0x1E, 0xC8, 0x62, 0x06, 0x88, 0x9F, 0x8B, 0xC3, 0xC7, 0x49, 0xD3, 0x37, 0xA1, 0xEA, 0xB9, 0x49,
+  0x69, 0x40, 0x44, 0x2F, 0x5A, 0xC8, 0x07, 0x30, 0x1E, 0xA8, 0x48, 0x91, 0xBF, 0xE8, 0x63, 0x1B,
+  0x25, 0xDE, 0x21, 0x75, 0x6A, 0x59, 0x55, 0xEC, 0xDF, 0xC1, 0xE6, 0xA1, 0x96, 0x85, 0xA2, 0x18,
+  0xD1, 0xF1, 0x32, 0xF5, 0x84, 0xC1, 0x26, 0x0E, 0x1C, 0xC8, 0x17, 0x1E, 0xDE, 0xFA, 0x3D, 0x5C,
+  0xEB, 0xCA, 0xBB, 0x09, 0x4F, 0x85, 0x5E, 0x04, 0x83, 0x63, 0x80, 0x89, 0x69, 0x23, 0x2C, 0xE8,
+  0x9F, 0x97, 0x55, 0x85, 0xD7, 0x11, 0x28, 0x7C, 0x64, 0xE2, 0xA1, 0x98, 0x0F, 0xEB, 0x0D, 0xF2,
+  0x3D, 0xF7, 0x9B, 0xFD, 0xA9, 0x29, 0x1D, 0xA9, 0x9A, 0x42, 0xA1, 0x1F, 0x0A, 0xE7, 0x6C, 0x57,
+  0x9F, 0x80, 0x10, 0xED, 0x54, 0xDF, 0xE1, 0x5D, 0xA8, 0x2D, 0x98, 0x3C, 0xB4, 0x07, 0x05, 0xB1,
+  0xDF, 0xDF, 0x9D, 0x8B, 0xEF, 0x3A, 0xEE, 0x00, 0x36, 0x3F, 0x96, 0x8E, 0x45, 0x89, 0x20, 0xF4,
+  0x7B, 0x01, 0xBB, 0x4B, 0x46, 0x0A, 0xFD, 0x32, 0x11, 0x2F, 0xDE, 0x11, 0x1B, 0xAB, 0x10, 0xF3,
+  0xC4, 0xA8, 0x0C, 0xF1, 0x2F, 0x35, 0x03, 0x0D, 0x0B, 0xCA, 0x51, 0xAE, 0xED, 0xA1, 0x24, 0x19,
+  0x55, 0xC7, 0xCD, 0x79, 0x60, 0xF9, 0x85, 0xCA, 0xFE, 0x9B, 0x79, 0xA7, 0x38, 0x07, 0x7C, 0x36,
+  0x11, 0x89, 0xA0, 0x25, 0x66, 0x03, 0xC1, 0xAE, 0xF0, 0xC8
+};
+
+static constexpr u8 PLACEHOLDER_ICON_COMPRESSED[2252] = {
+  0x28, 0xB5, 0x2F, 0xFD, 0x04, 0x68, 0xFD, 0x45, 0x00, 0x14, 0x26, 0xBD, 0xBD, 0xBD, 0xFF, 0x78,
+  0x78, 0x78, 0xA2, 0x09, 0x09, 0x09, 0x0C, 0x00, 0x0A, 0x0A, 0x0A, 0x0E, 0x7D, 0x7D, 0x7D, 0xA8,
+  0x46, 0x46, 0x46, 0x5E, 0xB4, 0xB4, 0xB4, 0xF3, 0x9F, 0x9F, 0x9F, 0xD7, 0x21, 0x21, 0x21, 0x2D,
+  0x27, 0x27, 0x27, 0x35, 0xA3, 0xA3, 0xA3, 0xDC, 0xB3, 0xB3, 0xB3, 0xF2, 0x43, 0x43, 0x43, 0x5A,
+  0x1E, 0x1E, 0x1E, 0x28, 0x9C, 0x9C, 0x9C, 0xD2, 0xB6, 0xB6, 0xB6, 0xF6, 0x4B, 0x4B, 0x4B, 0x65,
+  0x01, 0x54, 0x54, 0x54, 0x72, 0xB9, 0xB9, 0xB9, 0xF9, 0x97, 0x97, 0x97, 0xCC, 0x1B, 0x1B, 0x1B,
+  0x24, 0x07, 0x07, 0x07, 0x09, 0x72, 0x72, 0x72, 0x9A, 0x7B, 0x7B, 0x7B, 0xA6, 0x0D, 0x0F, 0x0F,
+  0x0F, 0x14, 0x85, 0x85, 0x85, 0xB4, 0xBC, 0xBC, 0xBC, 0xFE, 0x6B, 0x6B, 0x6B, 0x90, 0x05, 0x05,
+  0x05, 0x07, 0x42, 0x42, 0x42, 0x59, 0xA2, 0xA2, 0xA2, 0xDA, 0x24, 0x24, 0x24, 0x31, 0x2F, 0x2F,
+  0x2F, 0x3F, 0xA9, 0xA9, 0xA9, 0xE4, 0xAF, 0xAF, 0xAF, 0xEC, 0x3A, 0x3A, 0x3A, 0x4E, 0x25, 0x99,
+  0x99, 0x99, 0xCF, 0xB7, 0xB7, 0xB7, 0xF7, 0x4F, 0x4F, 0x4F, 0x6A, 0x02, 0x02, 0x02, 0x03, 0x5D,
+  0x5D, 0x5D, 0x7E, 0xBB, 0xBB, 0xBB, 0xFC, 0x90, 0x90, 0x90, 0xC2, 0x15, 0x15, 0x15, 0x1D, 0x06,
+  0x06, 0x06, 0x08, 0x6F, 0x6F, 0x6F, 0x96, 0x7E, 0x7E, 0x7E, 0xAA, 0x0B, 0x0B, 0x0B, 0x0F, 0x13,
+  0x13, 0x13, 0x1A, 0x8D, 0x8D, 0x8D, 0xBE, 0xFD, 0x61, 0x61, 0x61, 0x83, 0x03, 0x03, 0x03, 0x04,
+  0x3F, 0x3F, 0x3F, 0x55, 0xB2, 0xB2, 0xB2, 0xF0, 0x26, 0x26, 0x26, 0x33, 0x36, 0x36, 0x36, 0x49,
+  0xAD, 0xAD, 0xAD, 0xEA, 0xAA, 0xAA, 0xAA, 0xE6, 0x32, 0x32, 0x32, 0x43, 0x1A, 0x1A, 0x1A, 0x23,
+  0xB8, 0xB8, 0xB8, 0xF8, 0x51, 0x51, 0x51, 0x6D, 0x04, 0x04, 0x04, 0x05, 0x66, 0x66, 0x66, 0x8A,
+  0x89, 0x89, 0x89, 0xB9, 0x10, 0x10, 0x10, 0x16, 0x6C, 0x6C, 0x6C, 0x92, 0x80, 0x80, 0x80, 0xAD,
+  0x0C, 0x0C, 0x0C, 0x10, 0x18, 0x18, 0x18, 0x21, 0x94, 0x94, 0x94, 0xC8, 0xBA, 0xBA, 0xBA, 0xFB,
+  0x58, 0x58, 0x58, 0x77, 0x02, 0x3D, 0x3D, 0x3D, 0x52, 0xB1, 0xB1, 0xB1, 0xEF, 0xA5, 0xA5, 0xA5,
+  0xDE, 0x28, 0x28, 0x28, 0x36, 0x3E, 0x3E, 0x3E, 0x54, 0xA6, 0xA6, 0xA6, 0xE0, 0x2A, 0x2A, 0x2A,
+  0x39, 0x95, 0x95, 0x95, 0xC9, 0x71, 0x0D, 0x0D, 0x0D, 0x11, 0x06, 0x69, 0x69, 0x69, 0x8E, 0x83,
+  0x83, 0x83, 0xB1, 0x12, 0x9B, 0x9B, 0x9B, 0xD1, 0x6B, 0xB0, 0xB0, 0xB0, 0xED, 0xA7, 0xA7, 0xA7,
+  0xE1, 0x5F, 0xB5, 0xB5, 0xB5, 0xF4, 0xA1, 0xA1, 0xA1, 0xD9, 0x30, 0x16, 0x16, 0x16, 0x1E, 0x93,
+  0x93, 0x93, 0xC6, 0xFA, 0x57, 0x57, 0x57, 0x75, 0x38, 0x38, 0x38, 0x4B, 0xAE, 0xAE, 0xAE, 0xEB,
+  0xA8, 0xA8, 0xA8, 0xE3, 0x2C, 0x2C, 0x2C, 0x3C, 0x1C, 0x91, 0x91, 0x91, 0xC3, 0x5A, 0x5A, 0x5A,
+  0x79, 0x63, 0x63, 0x63, 0x86, 0x88, 0x88, 0x88, 0xB8, 0x35, 0x35, 0x35, 0x47, 0xE5, 0x40, 0x8E,
+  0x8E, 0x8E, 0xC0, 0x15, 0x87, 0x87, 0x87, 0xB6, 0x91, 0x60, 0x60, 0x60, 0x82, 0x8B, 0x8B, 0x8B,
+  0xBC, 0x12, 0x12, 0x12, 0x18, 0xAB, 0xAB, 0xAB, 0xE7, 0xAC, 0xAC, 0xAC, 0xE8, 0x62, 0x62, 0x62,
+  0x84, 0x00, 0x5F, 0x5F, 0x5F, 0x80, 0x7D, 0xBF, 0x2E, 0x2E, 0x2E, 0x3E, 0xE9, 0xB3, 0x20, 0xC7,
+  0x7A, 0x00, 0xF1, 0xA4, 0xA4, 0xA4, 0xDD, 0x2D, 0x2D, 0x2D, 0x3D, 0x37, 0x37, 0x37, 0x4A, 0x0A,
+  0x74, 0x74, 0x74, 0x9C, 0x86, 0x86, 0x86, 0xB5, 0x2C, 0x9E, 0x9E, 0x9E, 0xD5, 0x52, 0x52, 0x52,
+  0x6F, 0x96, 0x96, 0x96, 0xCA, 0x4C, 0x4C, 0x4C, 0x66, 0x00, 0x2B, 0x2B, 0x2B, 0x3A, 0x39, 0x39,
+  0x39, 0x4D, 0x00, 0x84, 0x84, 0x84, 0xB2, 0x8D, 0xF1, 0x00, 0xCB, 0x98, 0x98, 0x98, 0xCD, 0x29,
+  0x29, 0x29, 0x37, 0xDF, 0x3C, 0x3C, 0x3C, 0x51, 0xB3, 0x81, 0x81, 0x81, 0xAE, 0x6E, 0xFA, 0x25,
+  0x25, 0x25, 0x32, 0xDB, 0x41, 0x41, 0x41, 0x58, 0x4E, 0x4E, 0x4E, 0x69, 0x1C, 0x1C, 0x1C, 0x26,
+  0x20, 0x20, 0x20, 0x2B, 0x5B, 0xC4, 0x53, 0x45, 0x45, 0x45, 0x5D, 0x1D, 0x1D, 0x1D, 0x27, 0x92,
+  0x92, 0x92, 0xC4, 0x31, 0x9D, 0x9D, 0x9D, 0xD4, 0x53, 0x30, 0xEE, 0x38, 0xDF, 0xC5, 0x8D, 0x25,
+  0x7A, 0xE9, 0xBF, 0x7D, 0x00, 0x19, 0x7E, 0xC0, 0xEA, 0x79, 0x8E, 0x72, 0x82, 0xB3, 0xA8, 0x52,
+  0x5E, 0x51, 0x2E, 0x9D, 0x35, 0x82, 0x51, 0x86, 0x00, 0x41, 0x10, 0x86, 0x23, 0x4A, 0x12, 0x28,
+  0xEE, 0x03, 0x52, 0x40, 0x05, 0x09, 0x92, 0x10, 0x30, 0x10, 0x42, 0x40, 0x38, 0x42, 0x42, 0x84,
+  0x04, 0x11, 0x21, 0x11, 0x12, 0x27, 0x8C, 0x08, 0x08, 0x21, 0xC4, 0x18, 0x84, 0xBD, 0x18, 0x0D,
+  0xCC, 0xEF, 0xDE, 0x9F, 0xCF, 0x7E, 0x8A, 0xE7, 0x63, 0x9D, 0xE0, 0x85, 0xAB, 0xF2, 0x7F, 0xAF,
+  0x1A, 0xFC, 0xBF, 0x44, 0xDE, 0x00, 0xEF, 0xBF, 0xB7, 0x81, 0xC5, 0xEE, 0x13, 0xDD, 0xEA, 0xEE,
+  0x45, 0xF7, 0xC2, 0x55, 0x34, 0x00, 0xF5, 0xDF, 0xB3, 0xCE, 0x79, 0xB3, 0x44, 0x38, 0x9D, 0xE9,
+  0x8E, 0xB0, 0x1C, 0xB3, 0x92, 0x01, 0xD8, 0x50, 0x8C, 0xFD, 0x7B, 0x6B, 0x17, 0x91, 0xCB, 0x56,
+  0x92, 0x55, 0xD5, 0xF4, 0x0C, 0x3F, 0x44, 0xB6, 0xBA, 0xFD, 0x00, 0xDE, 0x50, 0xB3, 0xF8, 0xF7,
+  0x02, 0xA7, 0x23, 0x7D, 0x44, 0xE4, 0xFE, 0xF2, 0x4A, 0x44, 0xFF, 0x24, 0x6A, 0xCD, 0xEA, 0xFA,
+  0x66, 0x00, 0xEE, 0xBF, 0xA7, 0x4B, 0xFC, 0x8F, 0xDE, 0xAB, 0xBA, 0xB6, 0x7A, 0xBE, 0x31, 0xE0,
+  0xF5, 0xBA, 0x69, 0x9D, 0x6E, 0x5A, 0x8B, 0xA8, 0x2C, 0x2B, 0x7A, 0x71, 0xE0, 0x7F, 0xC3, 0x56,
+  0x3F, 0x3F, 0x69, 0xFA, 0x21, 0xF5, 0x9C, 0x01, 0xD7, 0xFF, 0x9E, 0xEA, 0xF0, 0xD2, 0x92, 0x1B,
+  0xB7, 0x5F, 0x61, 0xAB, 0xBF, 0x8B, 0x01, 0xB1, 0x7F, 0x6F, 0xEC, 0xDF, 0xDA, 0xBB, 0xC9, 0x7E,
+  0x4F, 0xFB, 0x47, 0x71, 0x29, 0x77, 0xF4, 0xED, 0x1E, 0x06, 0xEC, 0x8F, 0x0F, 0xD1, 0x5F, 0xEE,
+  0xDD, 0x83, 0xF6, 0xED, 0xD1, 0x97, 0xE8, 0xFA, 0x6F, 0x30, 0xAB, 0xEF, 0xE9, 0x01, 0x81, 0x45,
+  0x6C, 0x1F, 0x09, 0xE7, 0xB3, 0x45, 0xD3, 0x84, 0x8A, 0x51, 0xFB, 0xB3, 0x67, 0x75, 0xF4, 0x38,
+  0xA0, 0x6B, 0x1E, 0xF3, 0xEB, 0xC0, 0xFF, 0xDF, 0xDB, 0x49, 0xFA, 0xC7, 0xCC, 0xEA, 0xDD, 0xCA,
+  0x80, 0xE5, 0x3D, 0xAB, 0x6C, 0x11, 0x75, 0xA6, 0x1E, 0x13, 0x3D, 0xFF, 0x09, 0x67, 0x75, 0x57,
+  0x62, 0x00, 0xDD, 0x33, 0xFB, 0xEB, 0x37, 0xD8, 0xD1, 0x3F, 0x67, 0x4F, 0x9A, 0xC5, 0xEC, 0x47,
+  0x98, 0xD5, 0xDD, 0x81, 0x01, 0xF4, 0xC7, 0x72, 0x62, 0x38, 0xA2, 0x35, 0xE8, 0x09, 0xC3, 0xCE,
+  0xEA, 0x4B, 0x68, 0x80, 0xF1, 0x74, 0x8F, 0xFD, 0x7B, 0xF2, 0xE5, 0x8E, 0xA7, 0xD6, 0xF1, 0x4F,
+  0x87, 0x2A, 0x32, 0x40, 0x2A, 0xD6, 0xFF, 0x5E, 0x95, 0x10, 0xB1, 0x9F, 0x31, 0xAB, 0x1B, 0x42,
+  0x03, 0x18, 0xFE, 0x3D, 0x8B, 0x5B, 0x36, 0x97, 0xF0, 0x5F, 0x61, 0x56, 0x1F, 0x72, 0x03, 0xA2,
+  0xCA, 0xFA, 0xF7, 0xC2, 0x86, 0x0F, 0x1B, 0x6C, 0x56, 0x3F, 0x36, 0x07, 0xC8, 0x29, 0xAB, 0xFD,
+  0xEF, 0x85, 0x7C, 0x07, 0x32, 0xAB, 0x83, 0x3B, 0x07, 0x88, 0xFE, 0xBD, 0x57, 0x97, 0xFE, 0x2F,
+  0xB2, 0x80, 0xC0, 0xC0, 0x63, 0x23, 0xFC, 0x78, 0xAC, 0x39, 0x00, 0xF0, 0xC0, 0xBC, 0xF7, 0x20,
+  0xCF, 0xFF, 0x0D, 0x0D, 0xFC, 0x0F, 0x3C, 0x46, 0x65, 0x2A, 0x45, 0x80, 0x3F, 0x63, 0xAB, 0x57,
+  0xC5, 0x06, 0x2C, 0x88, 0x32, 0xB7, 0x18, 0x7F, 0x32, 0x12, 0x3B, 0xA7, 0x01, 0x3A, 0x60, 0x00,
+  0x57, 0x18, 0xFE, 0xBD, 0xD7, 0x8E, 0x80, 0x60, 0x56, 0x47, 0xB6, 0x3A, 0xBF, 0x61, 0x40, 0xCB,
+  0x68, 0x0C, 0xFB, 0xF7, 0x5E, 0xC7, 0x01, 0x31, 0x70, 0x15, 0x54, 0x41, 0xF7, 0xEF, 0x61, 0x46,
+  0xFD, 0xBA, 0xD5, 0x71, 0x21, 0x03, 0xCC, 0xB3, 0xB1, 0xF5, 0xDF, 0xD3, 0x57, 0x23, 0x16, 0xC6,
+  0xB6, 0xBA, 0xDE, 0x1C, 0xC5, 0xEB, 0xD0, 0x1A, 0x03, 0x42, 0xFB, 0x92, 0xFB, 0x57, 0xD0, 0xDA,
+  0x71, 0xC1, 0xD0, 0x56, 0x07, 0x3C, 0x06, 0xF8, 0xCD, 0x8E, 0xC2, 0x0F, 0x2D, 0x09, 0x6D, 0x75,
+  0x58, 0xBC, 0x49, 0x93, 0x01, 0x61, 0xC7, 0x7A, 0xD5, 0x0B, 0xFC, 0x7B, 0xFE, 0xA8, 0x95, 0x09,
+  0x36, 0xDC, 0xA3, 0xAD, 0x6E, 0x68, 0x1A, 0x00, 0x16, 0x5B, 0xE2, 0x7A, 0xFB, 0xDF, 0x3B, 0x42,
+  0xB6, 0x3A, 0x5F, 0x35, 0xE0, 0xF2, 0x14, 0xD6, 0x10, 0xCF, 0x15, 0x62, 0xA5, 0xE2, 0xBF, 0x09,
+  0xBF, 0xD5, 0x8F, 0x65, 0x03, 0xEC, 0xF6, 0xE8, 0xA2, 0xFB, 0xF7, 0xD6, 0x84, 0xF9, 0xFB, 0x56,
+  0xFF, 0x6C, 0x1B, 0x30, 0x5C, 0xE1, 0x21, 0xDE, 0xCC, 0xBF, 0xA7, 0x1B, 0xB7, 0x7A, 0xAE, 0x6E,
+  0x00, 0xD9, 0x33, 0xE9, 0x3B, 0x03, 0xFA, 0xEF, 0x09, 0xEB, 0xAD, 0xEE, 0xED, 0x51, 0x99, 0x2D,
+  0x1C, 0xB0, 0x1D, 0xB8, 0xA1, 0xD1, 0xF3, 0x85, 0xBE, 0x10, 0x25, 0xB9, 0xD5, 0xF9, 0x39, 0xF8,
+  0x68, 0x04, 0xF4, 0xDF, 0xC3, 0x93, 0x5B, 0x9D, 0xC8, 0x1C, 0x00, 0xFD, 0x4A, 0xB1, 0xFF, 0x3D,
+  0xE3, 0x8D, 0xE6, 0xD3, 0xAD, 0x3E, 0x5F, 0xF7, 0x3C, 0xDD, 0x0F, 0x4A, 0x07, 0x5C, 0xC1, 0xBF,
+  0xC7, 0xB6, 0x40, 0xF8, 0x1D, 0xA6, 0xDE, 0x9E, 0xBD, 0x9E, 0x71, 0xEB, 0x00, 0xE9, 0xFE, 0xBD,
+  0xD5, 0x0D, 0x36, 0x77, 0x50, 0xD0, 0xED, 0x72, 0x73, 0x6D, 0x25, 0x85, 0x16, 0x6C, 0x75, 0x4B,
+  0xF1, 0x00, 0xF2, 0xFE, 0xBD, 0xFB, 0x83, 0xD0, 0x36, 0x28, 0x5A, 0xD1, 0xAB, 0xE6, 0x01, 0xAB,
+  0xC7, 0x82, 0x7F, 0x57, 0xD9, 0x31, 0xF4, 0x79, 0x1A, 0xA8, 0x73, 0xEE, 0xEE, 0x1E, 0xA0, 0xEE,
+  0xE7, 0x9D, 0x1A, 0x80, 0x9F, 0x8E, 0x6B, 0x83, 0x36, 0xFF, 0x80, 0x21, 0xF9, 0x5E, 0x6B, 0x57,
+  0x1A, 0xE4, 0x6D, 0x8C, 0x00, 0xBD, 0xF6, 0x6C, 0xEF, 0x80, 0x1E, 0x08, 0x6B, 0xAB, 0x0F, 0xFC,
+  0x83, 0xCC, 0x6F, 0xC9, 0x29, 0x08, 0xBB, 0xCF, 0x00, 0x71, 0x83, 0x5B, 0xFD, 0x58, 0xAF, 0x7A,
+  0x6D, 0xAC, 0x7B, 0x02, 0xA1, 0xC6, 0x3A, 0xC5, 0xFD, 0xAD, 0xB6, 0xA9, 0x9F, 0xA6, 0xBE, 0xB8,
+  0x7C, 0x00, 0x10, 0x6A, 0x31, 0xE8, 0x2B, 0xF7, 0xDF, 0xEA, 0xAB, 0xA9, 0x29, 0xE3, 0x50, 0xFD,
+  0xF3, 0xCC, 0x62, 0xFA, 0x63, 0xEC, 0x00, 0x0B, 0x50, 0xB6, 0xBA, 0x0C, 0xF4, 0x71, 0xC6, 0xDF,
+  0x66, 0x9C, 0x9E, 0x75, 0x98, 0x39, 0x76, 0x99, 0x93, 0x4C, 0x1D, 0x00, 0xA1, 0x6E, 0xD7, 0xE4,
+  0x9D, 0xDA, 0x94, 0xC7, 0x34, 0xAE, 0x7B, 0x86, 0x7E, 0x71, 0xDA, 0x17, 0x3A, 0xA0, 0xE8, 0x56,
+  0xD1, 0x8A, 0x3A, 0x0F, 0x13, 0x51, 0x0E, 0xB5, 0x5A, 0x14, 0x39, 0x20, 0xBE, 0xD5, 0x55, 0x8B,
+  0xA1, 0x14, 0x46, 0x01, 0xB2, 0x09, 0x90, 0x9F, 0x38, 0xA0, 0x99, 0x7E, 0xDB, 0x9E, 0xC7, 0x56,
+  0x8F, 0xF5, 0xDC, 0xA0, 0xA5, 0x55, 0x01, 0xFB, 0x9C, 0x03, 0xEA, 0xC1, 0x6C, 0xDC, 0x21, 0xA9,
+  0x7B, 0x39, 0xA6, 0x32, 0xCD, 0x67, 0x4E, 0x68, 0x9D, 0x0B, 0x08, 0x93, 0x98, 0xF1, 0x63, 0xDE,
+  0xE2, 0x80, 0xD1, 0x2C, 0x9D, 0x76, 0x5D, 0xCE, 0x87, 0xD8, 0x97, 0x1E, 0x6F, 0x2B, 0x3D, 0xE9,
+  0x26, 0xD5, 0xA2, 0xC7, 0xFE, 0xCC, 0x78, 0xA8, 0x06, 0xC4, 0xE9, 0x60, 0xD4, 0x56, 0xA7, 0x2E,
+  0x2C, 0x7A, 0xE6, 0x73, 0x7F, 0x0F, 0x12, 0x30, 0xA5, 0x61, 0x00, 0xAC, 0x24, 0x64, 0xAB, 0xCF,
+  0x70, 0x3E, 0x9C, 0x6C, 0x4A, 0x2D, 0x4C, 0xD8, 0xE6, 0x06, 0xA8, 0x4E, 0x1B, 0x80, 0xEE, 0x73,
+  0x79, 0xAB, 0xFB, 0xA2, 0x42, 0xCF, 0x9C, 0xCA, 0x1E, 0xEA, 0xC9, 0x84, 0xE0, 0x16, 0xB2, 0xB3,
+  0x6D, 0x80, 0x80, 0x32, 0x61, 0x1C, 0x98, 0xFD, 0x2F, 0xB3, 0xD5, 0xDF, 0x35, 0x60, 0x5D, 0x23,
+  0xA0, 0x97, 0xA2, 0x2D, 0xC2, 0xA5, 0xBB, 0x06, 0x40, 0xD4, 0x83, 0xE1, 0xC1, 0x1F, 0x40, 0x3F,
+  0xC9, 0xF7, 0xDE, 0xA3, 0xA1, 0xF9, 0x48, 0xFD, 0x69, 0x8F, 0xAD, 0x3F, 0x66, 0x40, 0x85, 0xCA,
+  0xD0, 0x3D, 0xB9, 0xC9, 0x77, 0x45, 0x81, 0x3B, 0xC6, 0x74, 0x8B, 0xE7, 0x1D, 0x1C, 0xCB, 0x25,
+  0x65, 0x40, 0xD0, 0xFE, 0xEE, 0xBC, 0xBB, 0x03, 0x6C, 0x86, 0xE6, 0x0B, 0x20, 0x03, 0xC1, 0x12,
+  0xBA, 0x7C, 0x64, 0xAE, 0x7C, 0x8F, 0x33, 0x06, 0x68, 0x0C, 0x87, 0x13, 0x26, 0x36, 0xF4, 0x16,
+  0xF0, 0x8A, 0x79, 0xE7, 0x30, 0x44, 0x43, 0x9A, 0x78, 0xD2, 0x0A, 0x09, 0x27, 0x34, 0x45, 0x0C,
+  0x98, 0xDF, 0xF9, 0x66, 0x18, 0x18, 0x13, 0x4E, 0xA4, 0x3F, 0xF2, 0x46, 0x9A, 0x6E, 0x66, 0x6E,
+  0x07, 0x3E, 0x13, 0xB2, 0x63, 0x21, 0x36, 0xC0, 0xFE, 0x84, 0x01, 0x0E, 0xAB, 0x9F, 0xA8, 0xFB,
+  0xB7, 0xF4, 0x4C, 0xC8, 0x17, 0xD4, 0x33, 0xC3, 0x22, 0x9F, 0x98, 0xDB, 0x60, 0x31, 0xC1, 0xEA,
+  0xCF, 0x0F, 0xF8, 0x29, 0x3C, 0x11, 0xF1, 0xF1, 0xCC, 0xC8, 0x9D, 0x35, 0x0D, 0x24, 0x4F, 0x4C,
+  0x7A, 0x04, 0x25, 0xB7, 0x64, 0xA9, 0x05, 0x54, 0x06, 0x52, 0x8D, 0x0F, 0x10, 0xB4, 0x73, 0x89,
+  0x81, 0xFF, 0x72, 0x18, 0x27, 0x1A, 0x71, 0xA8, 0xC0, 0x23, 0x18, 0x1B, 0xD8, 0xB7, 0xA0, 0x36,
+  0x80, 0xEF, 0x9F, 0x2F, 0xE9, 0x01, 0x57, 0xB3, 0x11, 0x75, 0xFB, 0x3B, 0xCA, 0x44, 0xC2, 0x87,
+  0x05, 0xD5, 0xB1, 0x1E, 0x60, 0x69, 0x0E, 0x68, 0xEC, 0xE3, 0x6D, 0x6C, 0x34, 0xD9, 0xC1, 0x9E,
+  0xEE, 0x0E, 0xB5, 0x51, 0x37, 0xE1, 0x72, 0xEA, 0xBE, 0xE8, 0x00, 0x26, 0x34, 0x15, 0xA3, 0x88,
+  0xD3, 0xE0, 0x7A, 0xA1, 0x43, 0x7E, 0x42, 0xF0, 0x95, 0xF5, 0x94, 0xF7, 0xE2, 0x4E, 0xB5, 0x9D,
+  0x1C, 0x70, 0x34, 0x5B, 0xF1, 0xAF, 0xE7, 0x7D, 0x50, 0x46, 0xC2, 0xBF, 0xA3, 0x4D, 0x04, 0x41,
+  0x80, 0x81, 0xF2, 0x3F, 0xE5, 0x01, 0x7B, 0x6A, 0x92, 0x20, 0x37, 0x20, 0x57, 0x9C, 0xDF, 0xF5,
+  0x7D, 0xEF, 0xA4, 0x7A, 0xFE, 0x7E, 0x66, 0x43, 0x83, 0x01, 0x30, 0xA7, 0x52, 0x73, 0x25, 0x70,
+  0x69, 0xFD, 0xD0, 0x18, 0x34, 0x35, 0x40, 0x3F, 0x72, 0xDC, 0xEF, 0xBD, 0x0F, 0xF7, 0xD2, 0x7D,
+  0x3D, 0xEA, 0x79, 0x6B, 0x85, 0x02, 0xB0, 0xDD, 0x3E, 0xF5, 0xE9, 0x9F, 0xA5, 0xE2, 0xD4, 0x80,
+  0x08, 0xF1, 0xFF, 0x78, 0xFF, 0xE8, 0x67, 0x9F, 0x0F, 0x7E, 0x0F, 0xF8, 0x25, 0x75, 0xDD, 0x47,
+  0xF5, 0x99, 0x01, 0x74, 0xC7, 0x01, 0xD6, 0xFF, 0xE1, 0xA8, 0x79, 0x9F, 0xCF, 0x07, 0x2D, 0x06,
+  0xC2, 0x47, 0xB3, 0x43, 0x2B, 0xFE, 0x92, 0xEA, 0xC0, 0x80, 0xFB, 0xCF, 0xAE, 0xC9, 0x26, 0x16,
+  0x7B, 0xA2, 0x72, 0x46, 0x5B, 0x13, 0x52, 0x71, 0x62, 0x40, 0x0B, 0x84, 0x1F, 0x87, 0x6C, 0xB3,
+  0xCF, 0xDC, 0x16, 0x19, 0xE8, 0xFF, 0x92, 0x5C, 0xF3, 0xD0, 0x33, 0xC8, 0xBC, 0x67, 0x0F, 0x3C,
+  0xB4, 0x8F, 0xA7, 0xCF, 0xF2, 0xC7, 0xA6, 0x94, 0x93, 0x8B, 0x18, 0x83, 0x87, 0x6E, 0x84, 0x03,
+  0x78, 0xCC, 0xBF, 0xE0, 0x3D, 0x2E, 0x55, 0xA5, 0xA0, 0x77, 0x07, 0xAA, 0xDF, 0x00, 0x3A, 0x83,
+  0x78, 0xE4, 0xD0, 0x61, 0x11, 0xD5, 0x48, 0x7F, 0xE1, 0x54, 0xF6, 0xCC, 0xFD, 0x04, 0xF6, 0x1C,
+  0x70, 0x52, 0x8B, 0x22, 0xDF, 0xD2, 0x0F, 0xA9, 0xCC, 0x7E, 0x08, 0xBA, 0xE5, 0x3B, 0x3D, 0x12,
+  0x12, 0xF6, 0x80, 0x43, 0x90, 0xE5, 0x54, 0x60, 0x3C, 0xE5, 0xE6, 0x75, 0x63, 0x66, 0x76, 0x24,
+  0x8C, 0x61, 0x0D, 0x18, 0xF5, 0x24, 0xC4, 0xC2, 0xC5, 0x93, 0x7C, 0xFF, 0xDC, 0x36, 0x03, 0x56,
+  0xF3, 0x4C, 0x3D, 0x1F, 0xE2, 0x5A, 0xB9, 0x88, 0x23, 0x04, 0xA7, 0x1E, 0x10, 0xCA, 0x75, 0xDC,
+  0x62, 0x90, 0xD4, 0xDE, 0x05, 0xC7, 0xAF, 0x17, 0xD0, 0xD8, 0x01, 0xA2, 0x83, 0xFB, 0x0B, 0x8A,
+  0xE6, 0xAD, 0x2D, 0xE5, 0xB7, 0xF1, 0x02, 0x5F, 0x75, 0x40, 0xEB, 0x04, 0x7D, 0x4C, 0xF7, 0x33,
+  0x0A, 0xBB, 0xA8, 0x1F, 0xCC, 0xB3, 0x2B, 0x6F, 0x03, 0x56, 0xC9, 0xFD, 0xBA, 0x4C, 0xC4, 0x78,
+  0x73, 0x3F, 0x4D, 0x5B, 0xF9, 0x86, 0xAF, 0x16, 0x15, 0x1B, 0x08, 0xF7, 0x41, 0xEF, 0xA5, 0xD0,
+  0xCC, 0x16, 0xAD, 0x09, 0x68, 0x35, 0xDE, 0x01, 0x1A, 0x0A, 0xBF, 0x7E
+};
+
+static std::vector<u32> DecompressIcon(const u8* data, size_t data_size, size_t num_pixels)
+{
+  std::vector<u32> ret(num_pixels);
+  const size_t result = ZSTD_decompress(ret.data(), num_pixels * sizeof(u32), data, data_size);
+  if (ZSTD_isError(result) || result != (num_pixels * sizeof(u32)))
+  {
+    Log_ErrorPrintf("Failed to decompress icon: %s", ZSTD_getErrorName(result));
+    ret = {};
+  }
+
+  return ret;
+}
+
+std::vector<u32> Resources::GetWindowIconData()
+{
+  return DecompressIcon(WINDOW_ICON_COMPRESSED, sizeof(WINDOW_ICON_COMPRESSED),
+                        WINDOW_ICON_WIDTH * WINDOW_ICON_HEIGHT);
+}
+
+std::vector<u32> Resources::GetPlaceholderIconData()
+{
+  return DecompressIcon(PLACEHOLDER_ICON_COMPRESSED, sizeof(PLACEHOLDER_ICON_COMPRESSED),
+                        PLACEHOLDER_ICON_WIDTH * PLACEHOLDER_ICON_HEIGHT);
+}
@@ -3,16 +3,21 @@
 
 #pragma once
 #include "types.h"
-#include <array>
+#include <vector>
 
 namespace Resources {
 
 constexpr int WINDOW_ICON_WIDTH = 64;
 constexpr int WINDOW_ICON_HEIGHT = 64;
-extern unsigned int WINDOW_ICON_DATA[WINDOW_ICON_WIDTH * WINDOW_ICON_HEIGHT];
 
 constexpr int PLACEHOLDER_ICON_WIDTH = 128;
 constexpr int PLACEHOLDER_ICON_HEIGHT = 96;
-extern unsigned int PLACEHOLDER_ICON_DATA[PLACEHOLDER_ICON_WIDTH * PLACEHOLDER_ICON_HEIGHT];
+
+/// Decompresses the embedded window icon to RGBA8 pixels. Returns an empty vector on failure.
+std::vector<u32> GetWindowIconData();
+
+/// Decompresses the embedded placeholder/save-state icon to RGBA8 pixels. Returns an empty vector
+/// on failure.
+std::vector<u32> GetPlaceholderIconData();
 
 } // namespace Resources
@@ -5,7 +5,7 @@
 #include "types.h"
 
 static constexpr u32 SAVE_STATE_MAGIC = 0x43435544;
-static constexpr u32 SAVE_STATE_VERSION = 59;
+static constexpr u32 SAVE_STATE_VERSION = 60;
 static constexpr u32 SAVE_STATE_MINIMUM_VERSION = 42;
 
 static_assert(SAVE_STATE_VERSION >= SAVE_STATE_MINIMUM_VERSION);
@@ -43,4 +43,30 @@ struct SAVE_STATE_HEADER
   u32 data_uncompressed_size;
   u32 offset_to_data;
 };
+
+// Delta states store the XOR of their data section against a previously-saved full state,
+// zstd-compressed, which collapses to almost nothing for session-chained states. The header,
+// media filename and screenshot are stored verbatim as an opaque prefix. The base state is
+// located by filename next to the delta, and guarded by a hash of its data section.
+static constexpr u32 SAVE_STATE_DELTA_MAGIC = 0x44435544;
+
+struct SAVE_STATE_DELTA_HEADER
+{
+  enum : u32
+  {
+    MAX_BASE_FILENAME_LENGTH = 256,
+  };
+
+  u32 magic;
+  u32 version;
+  char serial[SAVE_STATE_HEADER::MAX_SERIAL_LENGTH];
+  char base_filename[MAX_BASE_FILENAME_LENGTH];
+
+  u64 base_data_hash;
+  u32 base_data_uncompressed_size;
+
+  u32 prefix_size;
+  u32 data_uncompressed_size;
+  u32 data_compressed_size;
+};
 #pragma pack(pop)
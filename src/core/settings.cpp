@@ -169,6 +169,10 @@ void Settings::Load(SettingsInterface& si)
   turbo_speed = si.GetFloatValue("Main", "TurboSpeed", 0.0f);
   sync_to_host_refresh_rate = si.GetBoolValue("Main", "SyncToHostRefreshRate", false);
   increase_timer_resolution = si.GetBoolValue("Main", "IncreaseTimerResolution", true);
+  pin_threads_to_performance_cores = si.GetBoolValue("Main", "PinThreadsToPerformanceCores", false);
+  emulation_thread_realtime_priority = si.GetBoolValue("Main", "EmulationThreadRealtimePriority", false);
+  hitch_detector_enable = si.GetBoolValue("Main", "EnableHitchDetector", false);
+  auto_tune_performance = si.GetBoolValue("Main", "AutoTunePerformance", false);
   inhibit_screensaver = si.GetBoolValue("Main", "InhibitScreensaver", true);
   start_paused = si.GetBoolValue("Main", "StartPaused", false);
   start_fullscreen = si.GetBoolValue("Main", "StartFullscreen", false);
@@ -200,6 +204,7 @@ void Settings::Load(SettingsInterface& si)
   cpu_recompiler_memory_exceptions = si.GetBoolValue("CPU", "RecompilerMemoryExceptions", false);
   cpu_recompiler_block_linking = si.GetBoolValue("CPU", "RecompilerBlockLinking", true);
   cpu_recompiler_icache = si.GetBoolValue("CPU", "RecompilerICache", false);
+  cpu_recompiler_tiered_compilation = si.GetBoolValue("CPU", "RecompilerTieredCompilation", false);
   cpu_fastmem_mode = ParseCPUFastmemMode(
                        si.GetStringValue("CPU", "FastmemMode", GetCPUFastmemModeName(DEFAULT_CPU_FASTMEM_MODE)).c_str())
                        .value_or(DEFAULT_CPU_FASTMEM_MODE);
@@ -208,15 +213,18 @@ void Settings::Load(SettingsInterface& si)
                    .value_or(DEFAULT_GPU_RENDERER);
   gpu_adapter = si.GetStringValue("GPU", "Adapter", "");
   gpu_resolution_scale = static_cast<u32>(si.GetIntValue("GPU", "ResolutionScale", 1));
+  gpu_dynamic_resolution_scale = si.GetBoolValue("GPU", "DynamicResolutionScale", false);
   gpu_multisamples = static_cast<u32>(si.GetIntValue("GPU", "Multisamples", 1));
   gpu_use_debug_device = si.GetBoolValue("GPU", "UseDebugDevice", false);
   gpu_disable_shader_cache = si.GetBoolValue("GPU", "DisableShaderCache", false);
   gpu_per_sample_shading = si.GetBoolValue("GPU", "PerSampleShading", false);
   gpu_use_thread = si.GetBoolValue("GPU", "UseThread", true);
   gpu_use_software_renderer_for_readbacks = si.GetBoolValue("GPU", "UseSoftwareRendererForReadbacks", false);
+  gpu_fast_vram_readbacks = si.GetBoolValue("GPU", "FastVRAMReadbacks", false);
   gpu_threaded_presentation = si.GetBoolValue("GPU", "ThreadedPresentation", true);
   gpu_true_color = si.GetBoolValue("GPU", "TrueColor", true);
   gpu_scaled_dithering = si.GetBoolValue("GPU", "ScaledDithering", true);
+  gpu_uber_shader = si.GetBoolValue("GPU", "UberShader", false);
   gpu_texture_filter =
     ParseTextureFilterName(
       si.GetStringValue("GPU", "TextureFilter", GetTextureFilterName(DEFAULT_GPU_TEXTURE_FILTER)).c_str())
@@ -290,6 +298,8 @@ void Settings::Load(SettingsInterface& si)
     static_cast<u8>(si.GetIntValue("CDROM", "ReadaheadSectors", DEFAULT_CDROM_READAHEAD_SECTORS));
   cdrom_region_check = si.GetBoolValue("CDROM", "RegionCheck", false);
   cdrom_load_image_to_ram = si.GetBoolValue("CDROM", "LoadImageToRAM", false);
+  cdrom_load_image_compressed = si.GetBoolValue("CDROM", "LoadImageCompressed", false);
+  cdrom_streaming_precache = si.GetBoolValue("CDROM", "StreamingPrecache", false);
   cdrom_load_image_patches = si.GetBoolValue("CDROM", "LoadImagePatches", false);
   cdrom_mute_cd_audio = si.GetBoolValue("CDROM", "MuteCDAudio", false);
   cdrom_read_speedup = si.GetIntValue("CDROM", "ReadSpeedup", 1);
@@ -311,6 +321,8 @@ void Settings::Load(SettingsInterface& si)
 
   audio_output_muted = si.GetBoolValue("Audio", "OutputMuted", false);
   audio_dump_on_boot = si.GetBoolValue("Audio", "DumpOnBoot", false);
+  audio_fast_reverb = si.GetBoolValue("Audio", "FastReverb", false);
+  audio_batch_periods = si.GetBoolValue("Audio", "BatchPeriods", false);
 
   use_old_mdec_routines = si.GetBoolValue("Hacks", "UseOldMDECRoutines", false);
   pcdrv_enable = si.GetBoolValue("PCDrv", "Enabled", false);
@@ -395,6 +407,10 @@ void Settings::Load(SettingsInterface& si)
   debugging.show_timers_state = si.GetBoolValue("Debug", "ShowTimersState");
   debugging.show_mdec_state = si.GetBoolValue("Debug", "ShowMDECState");
   debugging.show_dma_state = si.GetBoolValue("Debug", "ShowDMAState");
+  debugging.show_bus_profiler = si.GetBoolValue("Debug", "ShowBusProfiler");
+  debugging.show_frame_profiler = si.GetBoolValue("Debug", "ShowFrameProfiler");
+  debugging.show_jit_stats = si.GetBoolValue("Debug", "ShowJITStats");
+  debugging.show_guest_profiler = si.GetBoolValue("Debug", "ShowGuestProfiler");
 
   texture_replacements.enable_vram_write_replacements =
     si.GetBoolValue("TextureReplacements", "EnableVRAMWriteReplacements", false);
@@ -424,6 +440,10 @@ void Settings::Save(SettingsInterface& si) const
   si.SetFloatValue("Main", "TurboSpeed", turbo_speed);
   si.SetBoolValue("Main", "SyncToHostRefreshRate", sync_to_host_refresh_rate);
   si.SetBoolValue("Main", "IncreaseTimerResolution", increase_timer_resolution);
+  si.SetBoolValue("Main", "PinThreadsToPerformanceCores", pin_threads_to_performance_cores);
+  si.SetBoolValue("Main", "EmulationThreadRealtimePriority", emulation_thread_realtime_priority);
+  si.SetBoolValue("Main", "EnableHitchDetector", hitch_detector_enable);
+  si.SetBoolValue("Main", "AutoTunePerformance", auto_tune_performance);
   si.SetBoolValue("Main", "InhibitScreensaver", inhibit_screensaver);
   si.SetBoolValue("Main", "StartPaused", start_paused);
   si.SetBoolValue("Main", "StartFullscreen", start_fullscreen);
@@ -451,11 +471,13 @@ void Settings::Save(SettingsInterface& si) const
   si.SetBoolValue("CPU", "RecompilerMemoryExceptions", cpu_recompiler_memory_exceptions);
   si.SetBoolValue("CPU", "RecompilerBlockLinking", cpu_recompiler_block_linking);
   si.SetBoolValue("CPU", "RecompilerICache", cpu_recompiler_icache);
+  si.SetBoolValue("CPU", "RecompilerTieredCompilation", cpu_recompiler_tiered_compilation);
   si.SetStringValue("CPU", "FastmemMode", GetCPUFastmemModeName(cpu_fastmem_mode));
 
   si.SetStringValue("GPU", "Renderer", GetRendererName(gpu_renderer));
   si.SetStringValue("GPU", "Adapter", gpu_adapter.c_str());
   si.SetIntValue("GPU", "ResolutionScale", static_cast<long>(gpu_resolution_scale));
+  si.SetBoolValue("GPU", "DynamicResolutionScale", gpu_dynamic_resolution_scale);
   si.SetIntValue("GPU", "Multisamples", static_cast<long>(gpu_multisamples));
   si.SetBoolValue("GPU", "UseDebugDevice", gpu_use_debug_device);
   si.SetBoolValue("GPU", "DisableShaderCache", gpu_disable_shader_cache);
@@ -463,8 +485,10 @@ void Settings::Save(SettingsInterface& si) const
   si.SetBoolValue("GPU", "UseThread", gpu_use_thread);
   si.SetBoolValue("GPU", "ThreadedPresentation", gpu_threaded_presentation);
   si.SetBoolValue("GPU", "UseSoftwareRendererForReadbacks", gpu_use_software_renderer_for_readbacks);
+  si.SetBoolValue("GPU", "FastVRAMReadbacks", gpu_fast_vram_readbacks);
   si.SetBoolValue("GPU", "TrueColor", gpu_true_color);
   si.SetBoolValue("GPU", "ScaledDithering", gpu_scaled_dithering);
+  si.SetBoolValue("GPU", "UberShader", gpu_uber_shader);
   si.SetStringValue("GPU", "TextureFilter", GetTextureFilterName(gpu_texture_filter));
   si.SetStringValue("GPU", "DownsampleMode", GetDownsampleModeName(gpu_downsample_mode));
   si.SetUIntValue("GPU", "DownsampleScale", gpu_downsample_scale);
@@ -515,6 +539,8 @@ void Settings::Save(SettingsInterface& si) const
   si.SetIntValue("CDROM", "ReadaheadSectors", cdrom_readahead_sectors);
   si.SetBoolValue("CDROM", "RegionCheck", cdrom_region_check);
   si.SetBoolValue("CDROM", "LoadImageToRAM", cdrom_load_image_to_ram);
+  si.SetBoolValue("CDROM", "LoadImageCompressed", cdrom_load_image_compressed);
+  si.SetBoolValue("CDROM", "StreamingPrecache", cdrom_streaming_precache);
   si.SetBoolValue("CDROM", "LoadImagePatches", cdrom_load_image_patches);
   si.SetBoolValue("CDROM", "MuteCDAudio", cdrom_mute_cd_audio);
   si.SetIntValue("CDROM", "ReadSpeedup", cdrom_read_speedup);
@@ -530,6 +556,8 @@ void Settings::Save(SettingsInterface& si) const
   si.SetUIntValue("Audio", "FastForwardVolume", audio_fast_forward_volume);
   si.SetBoolValue("Audio", "OutputMuted", audio_output_muted);
   si.SetBoolValue("Audio", "DumpOnBoot", audio_dump_on_boot);
+  si.SetBoolValue("Audio", "FastReverb", audio_fast_reverb);
+  si.SetBoolValue("Audio", "BatchPeriods", audio_batch_periods);
 
   si.SetBoolValue("Hacks", "UseOldMDECRoutines", use_old_mdec_routines);
   si.SetIntValue("Hacks", "DMAMaxSliceTicks", dma_max_slice_ticks);
@@ -591,6 +619,10 @@ void Settings::Save(SettingsInterface& si) const
   si.SetBoolValue("Debug", "ShowTimersState", debugging.show_timers_state);
   si.SetBoolValue("Debug", "ShowMDECState", debugging.show_mdec_state);
   si.SetBoolValue("Debug", "ShowDMAState", debugging.show_dma_state);
+  si.SetBoolValue("Debug", "ShowBusProfiler", debugging.show_bus_profiler);
+  si.SetBoolValue("Debug", "ShowFrameProfiler", debugging.show_frame_profiler);
+  si.SetBoolValue("Debug", "ShowJITStats", debugging.show_jit_stats);
+  si.SetBoolValue("Debug", "ShowGuestProfiler", debugging.show_guest_profiler);
 
   si.SetBoolValue("TextureReplacements", "EnableVRAMWriteReplacements",
                   texture_replacements.enable_vram_write_replacements);
@@ -718,6 +750,10 @@ void Settings::FixIncompatibleSettings(bool display_osd_messages)
     g_settings.debugging.show_timers_state = false;
     g_settings.debugging.show_mdec_state = false;
     g_settings.debugging.show_dma_state = false;
+    g_settings.debugging.show_bus_profiler = false;
+    g_settings.debugging.show_frame_profiler = false;
+    g_settings.debugging.show_jit_stats = false;
+    g_settings.debugging.show_guest_profiler = false;
     g_settings.debugging.dump_cpu_to_vram_copies = false;
     g_settings.debugging.dump_vram_to_cpu_copies = false;
   }
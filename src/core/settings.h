@@ -64,6 +64,7 @@ struct Settings
   bool cpu_recompiler_memory_exceptions = false;
   bool cpu_recompiler_block_linking = true;
   bool cpu_recompiler_icache = false;
+  bool cpu_recompiler_tiered_compilation = false;
   CPUFastmemMode cpu_fastmem_mode = DEFAULT_CPU_FASTMEM_MODE;
 
   float emulation_speed = 1.0f;
@@ -71,6 +72,10 @@ struct Settings
   float turbo_speed = 0.0f;
   bool sync_to_host_refresh_rate = false;
   bool increase_timer_resolution = true;
+  bool pin_threads_to_performance_cores = false;
+  bool emulation_thread_realtime_priority = false;
+  bool hitch_detector_enable = false;
+  bool auto_tune_performance = false;
   bool inhibit_screensaver = true;
   bool start_paused = false;
   bool start_fullscreen = false;
@@ -95,15 +100,18 @@ struct Settings
   GPURenderer gpu_renderer = DEFAULT_GPU_RENDERER;
   std::string gpu_adapter;
   u32 gpu_resolution_scale = 1;
+  bool gpu_dynamic_resolution_scale = false;
   u32 gpu_multisamples = 1;
   bool gpu_use_thread = true;
   bool gpu_use_software_renderer_for_readbacks = false;
+  bool gpu_fast_vram_readbacks = false;
   bool gpu_threaded_presentation = true;
   bool gpu_use_debug_device = false;
   bool gpu_disable_shader_cache = false;
   bool gpu_per_sample_shading = false;
   bool gpu_true_color = true;
   bool gpu_scaled_dithering = true;
+  bool gpu_uber_shader = false;
   GPUTextureFilter gpu_texture_filter = DEFAULT_GPU_TEXTURE_FILTER;
   GPUDownsampleMode gpu_downsample_mode = DEFAULT_GPU_DOWNSAMPLE_MODE;
   u8 gpu_downsample_scale = 1;
@@ -153,6 +161,8 @@ struct Settings
   u8 cdrom_readahead_sectors = DEFAULT_CDROM_READAHEAD_SECTORS;
   bool cdrom_region_check = false;
   bool cdrom_load_image_to_ram = false;
+  bool cdrom_load_image_compressed = false;
+  bool cdrom_streaming_precache = false;
   bool cdrom_load_image_patches = false;
   bool cdrom_mute_cd_audio = false;
   u32 cdrom_read_speedup = 1;
@@ -168,6 +178,8 @@ struct Settings
   u32 audio_fast_forward_volume = 100;
   bool audio_output_muted = false;
   bool audio_dump_on_boot = false;
+  bool audio_fast_reverb = false;
+  bool audio_batch_periods = false;
 
   bool use_old_mdec_routines = false;
   bool pcdrv_enable = false;
@@ -207,6 +219,10 @@ struct Settings
     mutable bool show_timers_state = false;
     mutable bool show_mdec_state = false;
     mutable bool show_dma_state = false;
+    mutable bool show_bus_profiler = false;
+    mutable bool show_frame_profiler = false;
+    mutable bool show_jit_stats = false;
+    mutable bool show_guest_profiler = false;
   } debugging;
 
   // texture replacements
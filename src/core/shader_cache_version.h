@@ -4,4 +4,5 @@
 #pragma once
 #include "common/types.h"
 
-static constexpr u32 SHADER_CACHE_VERSION = 10;
\ No newline at end of file
+// 11: cache keys switched from MD5 to XXH3.
+static constexpr u32 SHADER_CACHE_VERSION = 11;
\ No newline at end of file
@@ -15,12 +15,24 @@
 #include "util/wav_writer.h"
 
 #include "common/bitfield.h"
+#include "common/bitutils.h"
 #include "common/fifo_queue.h"
 #include "common/log.h"
 #include "common/path.h"
+#include "common/platform.h"
 
 #include <memory>
 
+#if defined(CPU_X64)
+#include <emmintrin.h>
+#elif defined(CPU_AARCH64)
+#ifdef _MSC_VER
+#include <arm64_neon.h>
+#else
+#include <arm_neon.h>
+#endif
+#endif
+
 Log_SetChannel(SPU);
 
 // Enable to dump all voices of the SPU audio individually.
@@ -48,6 +60,8 @@ enum : u32
   NUM_SAMPLES_FROM_LAST_ADPCM_BLOCK = 3,
   SYSCLK_TICKS_PER_SPU_TICK = static_cast<u32>(System::MASTER_CLOCK) / static_cast<u32>(SAMPLE_RATE), // 0x300
   CAPTURE_BUFFER_SIZE_PER_CHANNEL = 0x400,
+  NUM_CAPTURE_BUFFERS = 4,
+  IRQ_EVENT_BATCH_FRAMES = 32,
   MINIMUM_TICKS_BETWEEN_KEY_ON_OFF = 2,
   NUM_REVERB_REGS = 32,
   FIFO_SIZE_IN_HALFWORDS = 32
@@ -204,6 +218,19 @@ struct ADPCMBlock
   u8 GetNibble(u32 index) const { return (data[index / 2] >> ((index % 2) * 4)) & 0x0F; }
 };
 
+// Decoded output for one 16-byte ADPCM block. The filter feeds the previous block's last two
+// samples into the next one, so the entry also records the decoder state it was produced from;
+// a lookup only hits when that state matches, which makes stale entries impossible even when a
+// voice's start address is repointed at the same RAM.
+struct DecodedBlockCacheEntry
+{
+  std::array<s16, NUM_SAMPLES_PER_ADPCM_BLOCK> samples;
+  std::array<s16, 2> last_samples_in;
+  std::array<s16, 2> last_samples_out;
+  ADPCMFlags flags;
+  bool valid;
+};
+
 struct VolumeEnvelope
 {
   s32 counter;
@@ -261,6 +288,7 @@ struct Voice
   void ForceOff();
 
   void DecodeBlock(const ADPCMBlock& block);
+  void UseDecodedBlock(const DecodedBlockCacheEntry& block);
   s32 Interpolate() const;
 
   // Switches to the specified phase, filling in target.
@@ -326,6 +354,7 @@ static void WriteToCaptureBuffer(u32 index, s16 value);
 static void IncrementCaptureBufferPosition();
 
 static void ReadADPCMBlock(u16 address, ADPCMBlock* block);
+static void InvalidateDecodedBlocks(u32 start_address, u32 size);
 static std::tuple<s32, s32> SampleVoice(u32 voice_index);
 
 static void UpdateNoise();
@@ -398,10 +427,19 @@ static s32 s_reverb_resample_buffer_position = 0;
 
 static std::array<Voice, NUM_VOICES> s_voices{};
 
+// Bitmask of voices which can contribute to the mix. Set on key on, and cleared by the voice's own
+// skip path in SampleVoice() one frame after the envelope turns off, so last_volume is zeroed for
+// the capture buffers/pitch modulation before the voice stops being sampled.
+static u32 s_voice_active_mask = 0;
+
 static InlineFIFOQueue<u16, FIFO_SIZE_IN_HALFWORDS> s_transfer_fifo;
 
 static std::array<u8, RAM_SIZE> s_ram{};
 
+// One entry per 16-byte-aligned block of SPU RAM, invalidated by any write to the block. Looping
+// voices in their steady state then skip the nibble unpack/filter entirely and only interpolate.
+static std::array<DecodedBlockCacheEntry, RAM_SIZE / sizeof(ADPCMBlock)> s_decoded_block_cache{};
+
 #ifdef SPU_DUMP_ALL_VOICES
 // +1 for reverb output
 static std::array<std::unique_ptr<Common::WAVWriter>, NUM_VOICES + 1> s_voice_dump_writers;
@@ -417,7 +455,7 @@ void SPU::Initialize()
                                                  &SPU::Execute, nullptr, false);
   s_transfer_event = TimingEvents::CreateTimingEvent(
     "SPU Transfer", TRANSFER_TICKS_PER_HALFWORD, TRANSFER_TICKS_PER_HALFWORD, &SPU::ExecuteTransfer, nullptr, false);
-  s_null_audio_stream = AudioStream::CreateNullStream(SAMPLE_RATE, NUM_CHANNELS, g_settings.audio_buffer_ms);
+  s_null_audio_stream = AudioStream::CreateNullSinkStream(SAMPLE_RATE, NUM_CHANNELS);
 
   CreateOutputStream();
   Reset();
@@ -437,7 +475,7 @@ void SPU::CreateOutputStream()
   {
     Host::ReportErrorAsync("Error", "Failed to create or configure audio stream, falling back to null output.");
     s_audio_stream.reset();
-    s_audio_stream = AudioStream::CreateNullStream(SAMPLE_RATE, NUM_CHANNELS, g_settings.audio_buffer_ms);
+    s_audio_stream = AudioStream::CreateNullSinkStream(SAMPLE_RATE, NUM_CHANNELS);
   }
 
   s_audio_stream->SetOutputVolume(System::GetAudioOutputVolume());
@@ -522,6 +560,11 @@ void SPU::Reset()
   s_transfer_fifo.Clear();
   s_transfer_event->Deactivate();
   s_ram.fill(0);
+  InvalidateDecodedBlocks(0, RAM_SIZE);
+
+  // let the skip path in SampleVoice() settle the mask, it also zeroes last_volume
+  s_voice_active_mask = (u32(1) << NUM_VOICES) - 1u;
+
   UpdateEventInterval();
 }
 
@@ -588,6 +631,8 @@ bool SPU::DoState(StateWrapper& sw)
 
   if (sw.IsReading())
   {
+    InvalidateDecodedBlocks(0, RAM_SIZE);
+    s_voice_active_mask = (u32(1) << NUM_VOICES) - 1u;
     UpdateEventInterval();
     UpdateTransferEvent();
   }
@@ -857,6 +902,8 @@ void SPU::WriteRegister(u32 offset, u16 value)
       if (IsRAMIRQTriggerable())
         CheckForLateRAMIRQs();
 
+      // the event interval depends on where the IRQ address points
+      UpdateEventInterval();
       return;
     }
 
@@ -1186,6 +1233,7 @@ void SPU::WriteToCaptureBuffer(u32 index, s16 value)
   const u32 ram_address = (index * CAPTURE_BUFFER_SIZE_PER_CHANNEL) | ZeroExtend16(s_capture_buffer_position);
   // Log_DebugPrintf("write to capture buffer %u (0x%08X) <- 0x%04X", index, ram_address, u16(value));
   std::memcpy(&s_ram[ram_address], &value, sizeof(value));
+  InvalidateDecodedBlocks(ram_address, sizeof(value));
   if (IsRAMIRQTriggerable() && CheckRAMIRQ(ram_address))
   {
     Log_DebugPrintf("Trigger IRQ @ %08X %04X from capture buffer", ram_address, ram_address / 8);
@@ -1224,6 +1272,7 @@ ALWAYS_INLINE_RELEASE void SPU::ExecuteFIFOWriteToRAM(TickCount& ticks)
   {
     u16 value = s_transfer_fifo.Pop();
     std::memcpy(&s_ram[s_transfer_address], &value, sizeof(u16));
+    InvalidateDecodedBlocks(s_transfer_address, sizeof(u16));
     s_transfer_address = (s_transfer_address + sizeof(u16)) & RAM_MASK;
     ticks -= TRANSFER_TICKS_PER_HALFWORD;
 
@@ -1299,6 +1348,7 @@ void SPU::ManualTransferWrite(u16 value)
   }
 
   std::memcpy(&s_ram[s_transfer_address], &value, sizeof(u16));
+  InvalidateDecodedBlocks(s_transfer_address, sizeof(u16));
   s_transfer_address = (s_transfer_address + sizeof(u16)) & RAM_MASK;
 
   if (IsRAMIRQTriggerable() && CheckRAMIRQ(s_transfer_address))
@@ -1532,9 +1582,16 @@ const std::array<u8, SPU::RAM_SIZE>& SPU::GetRAM()
 
 std::array<u8, SPU::RAM_SIZE>& SPU::GetWritableRAM()
 {
+  // No way of knowing what the caller will scribble on.
+  InvalidateDecodedBlocks(0, RAM_SIZE);
   return s_ram;
 }
 
+u32 SPU::GetActiveVoiceMask()
+{
+  return s_voice_active_mask;
+}
+
 bool SPU::IsAudioOutputMuted()
 {
   return s_audio_output_muted;
@@ -1795,22 +1852,85 @@ void SPU::Voice::DecodeBlock(const ADPCMBlock& block)
   const s32 filter_neg = filter_table_neg[filter_index];
   s16 last_samples[2] = {adpcm_last_samples[0], adpcm_last_samples[1]};
 
-  // samples
+  // Extend the 4-bit nibbles to 16-bit and apply the shift from the header up-front; the filter
+  // below has a serial dependency through the previous two samples, but the unpack doesn't.
+  s16 unpacked[32];
+#if defined(CPU_X64)
+  u8 data_buf[16] = {};
+  std::memcpy(data_buf, block.data, sizeof(block.data));
+  const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data_buf));
+  const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+  const __m128i lo_nibbles = _mm_and_si128(bytes, nibble_mask);
+  const __m128i hi_nibbles = _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble_mask);
+  const __m128i even_odd_lo = _mm_unpacklo_epi8(lo_nibbles, hi_nibbles);
+  const __m128i even_odd_hi = _mm_unpackhi_epi8(lo_nibbles, hi_nibbles);
+  const __m128i shift_count = _mm_cvtsi32_si128(shift);
+  const __m128i zero = _mm_setzero_si128();
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(&unpacked[0]),
+                   _mm_sra_epi16(_mm_slli_epi16(_mm_unpacklo_epi8(even_odd_lo, zero), 12), shift_count));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(&unpacked[8]),
+                   _mm_sra_epi16(_mm_slli_epi16(_mm_unpackhi_epi8(even_odd_lo, zero), 12), shift_count));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(&unpacked[16]),
+                   _mm_sra_epi16(_mm_slli_epi16(_mm_unpacklo_epi8(even_odd_hi, zero), 12), shift_count));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(&unpacked[24]),
+                   _mm_sra_epi16(_mm_slli_epi16(_mm_unpackhi_epi8(even_odd_hi, zero), 12), shift_count));
+#elif defined(CPU_AARCH64)
+  u8 data_buf[16] = {};
+  std::memcpy(data_buf, block.data, sizeof(block.data));
+  const uint8x16_t bytes = vld1q_u8(data_buf);
+  const uint8x16x2_t even_odd = vzipq_u8(vandq_u8(bytes, vdupq_n_u8(0x0F)), vshrq_n_u8(bytes, 4));
+  const int16x8_t neg_shift = vdupq_n_s16(-static_cast<s16>(shift));
+  vst1q_s16(&unpacked[0],
+            vshlq_s16(vshlq_n_s16(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(even_odd.val[0]))), 12), neg_shift));
+  vst1q_s16(&unpacked[8],
+            vshlq_s16(vshlq_n_s16(vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(even_odd.val[0]))), 12), neg_shift));
+  vst1q_s16(&unpacked[16],
+            vshlq_s16(vshlq_n_s16(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(even_odd.val[1]))), 12), neg_shift));
+  vst1q_s16(&unpacked[24],
+            vshlq_s16(vshlq_n_s16(vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(even_odd.val[1]))), 12), neg_shift));
+#else
   for (u32 i = 0; i < NUM_SAMPLES_PER_ADPCM_BLOCK; i++)
-  {
-    // extend 4-bit to 16-bit, apply shift from header and mix in previous samples
-    s32 sample = s32(static_cast<s16>(ZeroExtend16(block.GetNibble(i)) << 12) >> shift);
-    sample += (last_samples[0] * filter_pos) >> 6;
-    sample += (last_samples[1] * filter_neg) >> 6;
+    unpacked[i] = static_cast<s16>(ZeroExtend16(block.GetNibble(i)) << 12) >> shift;
+#endif
 
-    last_samples[1] = last_samples[0];
-    current_block_samples[NUM_SAMPLES_FROM_LAST_ADPCM_BLOCK + i] = last_samples[0] = static_cast<s16>(Clamp16(sample));
+  if (filter_pos == 0 && filter_neg == 0)
+  {
+    // No feedback from previous samples, the unpacked values are the output.
+    std::copy_n(unpacked, NUM_SAMPLES_PER_ADPCM_BLOCK, &current_block_samples[NUM_SAMPLES_FROM_LAST_ADPCM_BLOCK]);
+    last_samples[1] = unpacked[NUM_SAMPLES_PER_ADPCM_BLOCK - 2];
+    last_samples[0] = unpacked[NUM_SAMPLES_PER_ADPCM_BLOCK - 1];
+  }
+  else
+  {
+    for (u32 i = 0; i < NUM_SAMPLES_PER_ADPCM_BLOCK; i++)
+    {
+      // mix in previous samples
+      s32 sample = s32(unpacked[i]);
+      sample += (last_samples[0] * filter_pos) >> 6;
+      sample += (last_samples[1] * filter_neg) >> 6;
+
+      last_samples[1] = last_samples[0];
+      current_block_samples[NUM_SAMPLES_FROM_LAST_ADPCM_BLOCK + i] = last_samples[0] =
+        static_cast<s16>(Clamp16(sample));
+    }
   }
 
   std::copy(last_samples, last_samples + countof(last_samples), adpcm_last_samples.begin());
   current_block_flags.bits = block.flags.bits;
 }
 
+void SPU::Voice::UseDecodedBlock(const DecodedBlockCacheEntry& block)
+{
+  // store samples needed for interpolation
+  current_block_samples[2] = current_block_samples[NUM_SAMPLES_FROM_LAST_ADPCM_BLOCK + NUM_SAMPLES_PER_ADPCM_BLOCK - 1];
+  current_block_samples[1] = current_block_samples[NUM_SAMPLES_FROM_LAST_ADPCM_BLOCK + NUM_SAMPLES_PER_ADPCM_BLOCK - 2];
+  current_block_samples[0] = current_block_samples[NUM_SAMPLES_FROM_LAST_ADPCM_BLOCK + NUM_SAMPLES_PER_ADPCM_BLOCK - 3];
+
+  std::copy(block.samples.begin(), block.samples.end(), current_block_samples.begin() + NUM_SAMPLES_FROM_LAST_ADPCM_BLOCK);
+  adpcm_last_samples = block.last_samples_out;
+  current_block_flags.bits = block.flags.bits;
+}
+
 s32 SPU::Voice::Interpolate() const
 {
   static constexpr std::array<s16, 0x200> gauss = {{
@@ -1883,11 +2003,25 @@ s32 SPU::Voice::Interpolate() const
   const u8 i = counter.interpolation_index;
   const u32 s = NUM_SAMPLES_FROM_LAST_ADPCM_BLOCK + ZeroExtend32(counter.sample_index.GetValue());
 
+  // 4-tap dot product, computed in one go where we have SIMD. Partial sums are identical to the
+  // scalar version, so the output is bit-exact.
+#if defined(CPU_X64)
+  const __m128i coef =
+    _mm_set_epi16(0, 0, 0, 0, gauss[0x000 + i], gauss[0x100 + i], gauss[0x1FF - i], gauss[0x0FF - i]);
+  const __m128i samp = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&current_block_samples[s - 3]));
+  const __m128i prod = _mm_madd_epi16(coef, samp);
+  return (_mm_cvtsi128_si32(prod) + _mm_cvtsi128_si32(_mm_shuffle_epi32(prod, _MM_SHUFFLE(1, 1, 1, 1)))) >> 15;
+#elif defined(CPU_AARCH64)
+  const s16 coef[4] = {gauss[0x0FF - i], gauss[0x1FF - i], gauss[0x100 + i], gauss[0x000 + i]};
+  const int32x4_t prod = vmull_s16(vld1_s16(coef), vld1_s16(&current_block_samples[s - 3]));
+  return vaddvq_s32(prod) >> 15;
+#else
   s32 out = s32(gauss[0x0FF - i]) * s32(current_block_samples[s - 3]);
   out += s32(gauss[0x1FF - i]) * s32(current_block_samples[s - 2]);
   out += s32(gauss[0x100 + i]) * s32(current_block_samples[s - 1]);
   out += s32(gauss[0x000 + i]) * s32(current_block_samples[s - 0]);
   return out >> 15;
+#endif
 }
 
 void SPU::ReadADPCMBlock(u16 address, ADPCMBlock* block)
@@ -1917,12 +2051,21 @@ void SPU::ReadADPCMBlock(u16 address, ADPCMBlock* block)
   }
 }
 
+ALWAYS_INLINE_RELEASE void SPU::InvalidateDecodedBlocks(u32 start_address, u32 size)
+{
+  const u32 first_block = (start_address & RAM_MASK) / sizeof(ADPCMBlock);
+  const u32 num_blocks = ((start_address % sizeof(ADPCMBlock)) + size + sizeof(ADPCMBlock) - 1) / sizeof(ADPCMBlock);
+  for (u32 i = 0; i < num_blocks; i++)
+    s_decoded_block_cache[(first_block + i) % s_decoded_block_cache.size()].valid = false;
+}
+
 ALWAYS_INLINE_RELEASE std::tuple<s32, s32> SPU::SampleVoice(u32 voice_index)
 {
   Voice& voice = s_voices[voice_index];
   if (!voice.IsOn() && !s_SPUCNT.irq9_enable)
   {
     voice.last_volume = 0;
+    s_voice_active_mask &= ~(u32(1) << voice_index);
 
 #ifdef SPU_DUMP_ALL_VOICES
     if (s_voice_dump_writers[voice_index])
@@ -1937,9 +2080,39 @@ ALWAYS_INLINE_RELEASE std::tuple<s32, s32> SPU::SampleVoice(u32 voice_index)
 
   if (!voice.has_samples)
   {
-    ADPCMBlock block;
-    ReadADPCMBlock(voice.current_address, &block);
-    voice.DecodeBlock(block);
+    const u32 ram_address = (ZeroExtend32(voice.current_address) * 8) & RAM_MASK;
+    DecodedBlockCacheEntry& entry = s_decoded_block_cache[ram_address / sizeof(ADPCMBlock)];
+    const bool cacheable = ((ram_address % sizeof(ADPCMBlock)) == 0);
+    if (cacheable && entry.valid && entry.last_samples_in == voice.adpcm_last_samples)
+    {
+      // The IRQ check from ReadADPCMBlock still has to happen on a hit, the hardware snoops the
+      // fetch regardless of what it does with the data.
+      if (IsRAMIRQTriggerable() && (CheckRAMIRQ(ram_address) || CheckRAMIRQ((ram_address + 8) & RAM_MASK)))
+      {
+        Log_DebugPrintf("Trigger IRQ @ %08X %04X from ADPCM reader", ram_address, ram_address / 8);
+        TriggerRAMIRQ();
+      }
+
+      voice.UseDecodedBlock(entry);
+    }
+    else
+    {
+      const std::array<s16, 2> last_samples_in = voice.adpcm_last_samples;
+      ADPCMBlock block;
+      ReadADPCMBlock(voice.current_address, &block);
+      voice.DecodeBlock(block);
+
+      if (cacheable)
+      {
+        std::copy_n(voice.current_block_samples.begin() + NUM_SAMPLES_FROM_LAST_ADPCM_BLOCK,
+                    NUM_SAMPLES_PER_ADPCM_BLOCK, entry.samples.begin());
+        entry.last_samples_in = last_samples_in;
+        entry.last_samples_out = voice.adpcm_last_samples;
+        entry.flags.bits = voice.current_block_flags.bits;
+        entry.valid = true;
+      }
+    }
+
     voice.has_samples = true;
 
     if (voice.current_block_flags.loop_start && !voice.ignore_loop_address)
@@ -2085,6 +2258,7 @@ void SPU::ReverbWrite(u32 address, s16 data)
   // TODO: This should check interrupts.
   const u32 real_address = ReverbMemoryAddress(address << 2);
   std::memcpy(&s_ram[real_address], &data, sizeof(data));
+  InvalidateDecodedBlocks(real_address, sizeof(data));
 }
 
 // Zeroes optimized out; middle removed too(it's 16384)
@@ -2094,11 +2268,46 @@ static constexpr std::array<s16, 20> s_reverb_resample_coefficients = {
 static s16 s_last_reverb_input[2];
 static s32 s_last_reverb_output[2];
 
+#if defined(CPU_X64) || defined(CPU_AARCH64)
+// Same coefficients with zeroes interleaved, so the strided 44->22khz dot product can run on
+// contiguous 8-lane loads with the odd taps multiplied out by zero.
+static constexpr std::array<s16, 40> s_reverb_resample_coefficients_x2 = []() {
+  std::array<s16, 40> ret = {};
+  for (size_t i = 0; i < s_reverb_resample_coefficients.size(); i++)
+    ret[i * 2] = s_reverb_resample_coefficients[i];
+  return ret;
+}();
+#endif
+
 ALWAYS_INLINE static s32 Reverb4422(const s16* src)
 {
-  s32 out = 0; // 32-bits is adequate(it won't overflow)
+  s32 out; // 32-bits is adequate(it won't overflow)
+#if defined(CPU_X64)
+  __m128i acc = _mm_setzero_si128();
+  for (u32 i = 0; i < 40; i += 8)
+  {
+    const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i]));
+    const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&s_reverb_resample_coefficients_x2[i]));
+    acc = _mm_add_epi32(acc, _mm_madd_epi16(c, s));
+  }
+  acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+  acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+  out = _mm_cvtsi128_si32(acc);
+#elif defined(CPU_AARCH64)
+  int32x4_t acc = vdupq_n_s32(0);
+  for (u32 i = 0; i < 40; i += 8)
+  {
+    const int16x8_t s = vld1q_s16(&src[i]);
+    const int16x8_t c = vld1q_s16(&s_reverb_resample_coefficients_x2[i]);
+    acc = vmlal_s16(acc, vget_low_s16(c), vget_low_s16(s));
+    acc = vmlal_s16(acc, vget_high_s16(c), vget_high_s16(s));
+  }
+  out = vaddvq_s32(acc);
+#else
+  out = 0;
   for (u32 i = 0; i < 20; i++)
     out += s_reverb_resample_coefficients[i] * src[i * 2];
+#endif
 
   // Middle non-zero
   out += 0x4000 * src[19];
@@ -2117,9 +2326,34 @@ ALWAYS_INLINE static s32 Reverb2244(const s16* src)
   }
   else
   {
+#if defined(CPU_X64)
+    __m128i acc = _mm_madd_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[0])),
+                                 _mm_loadu_si128(reinterpret_cast<const __m128i*>(&s_reverb_resample_coefficients[0])));
+    acc = _mm_add_epi32(
+      acc, _mm_madd_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[8])),
+                          _mm_loadu_si128(reinterpret_cast<const __m128i*>(&s_reverb_resample_coefficients[8]))));
+    acc = _mm_add_epi32(
+      acc, _mm_madd_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(&src[16])),
+                          _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&s_reverb_resample_coefficients[16]))));
+    acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+    acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+    out = _mm_cvtsi128_si32(acc);
+#elif defined(CPU_AARCH64)
+    int32x4_t acc = vdupq_n_s32(0);
+    for (u32 i = 0; i < 16; i += 8)
+    {
+      const int16x8_t s = vld1q_s16(&src[i]);
+      const int16x8_t c = vld1q_s16(&s_reverb_resample_coefficients[i]);
+      acc = vmlal_s16(acc, vget_low_s16(c), vget_low_s16(s));
+      acc = vmlal_s16(acc, vget_high_s16(c), vget_high_s16(s));
+    }
+    acc = vmlal_s16(acc, vld1_s16(&s_reverb_resample_coefficients[16]), vld1_s16(&src[16]));
+    out = vaddvq_s32(acc);
+#else
     out = 0;
     for (u32 i = 0; i < 20; i++)
       out += s_reverb_resample_coefficients[i] * src[i];
+#endif
 
     out >>= 14;
     out = std::clamp<s32>(out, -32768, 32767);
@@ -2164,11 +2398,23 @@ void SPU::ProcessReverb(s16 left_in, s16 right_in, s32* left_out, s32* right_out
   s_reverb_downsample_buffer[1][s_reverb_resample_buffer_position | 0x40] = right_in;
 
   s32 out[2];
+  // Fast tier skips the 39-tap resampling FIRs and uses the nearest sample instead; the reverb
+  // core itself still runs at the correct half rate.
+  const bool fast_reverb = g_settings.audio_fast_reverb;
+
   if (s_reverb_resample_buffer_position & 1u)
   {
     std::array<s32, 2> downsampled;
-    for (unsigned lr = 0; lr < 2; lr++)
-      downsampled[lr] = Reverb4422(&s_reverb_downsample_buffer[lr][(s_reverb_resample_buffer_position - 38) & 0x3F]);
+    if (fast_reverb)
+    {
+      downsampled[0] = left_in;
+      downsampled[1] = right_in;
+    }
+    else
+    {
+      for (unsigned lr = 0; lr < 2; lr++)
+        downsampled[lr] = Reverb4422(&s_reverb_downsample_buffer[lr][(s_reverb_resample_buffer_position - 38) & 0x3F]);
+    }
 
     for (unsigned lr = 0; lr < 2; lr++)
     {
@@ -2223,8 +2469,10 @@ void SPU::ProcessReverb(s16 left_in, s16 right_in, s32* left_out, s32* right_out
       s_reverb_current_address = s_reverb_base_address;
 
     for (unsigned lr = 0; lr < 2; lr++)
-      out[lr] =
-        Reverb2244<false>(&s_reverb_upsample_buffer[lr][((s_reverb_resample_buffer_position >> 1) - 19) & 0x1F]);
+    {
+      const s16* up_src = &s_reverb_upsample_buffer[lr][((s_reverb_resample_buffer_position >> 1) - 19) & 0x1F];
+      out[lr] = fast_reverb ? Reverb2244<true>(up_src) : Reverb2244<false>(up_src);
+    }
   }
   else
   {
@@ -2280,20 +2528,26 @@ void SPU::Execute(void* param, TickCount ticks, TickCount ticks_late)
       s32 reverb_in_left = 0;
       s32 reverb_in_right = 0;
 
-      u32 reverb_on_register = s_reverb_on_register;
-
-      for (u32 voice = 0; voice < NUM_VOICES; voice++)
+      // Voices which are off and have flushed their tail contribute nothing, so only walk the set
+      // bits. When the IRQ is enabled every voice still has to be sampled, because block fetches
+      // from "off" voices can trigger it.
+#ifndef SPU_DUMP_ALL_VOICES
+      u32 active_voices = s_SPUCNT.irq9_enable ? ((u32(1) << NUM_VOICES) - 1u) : s_voice_active_mask;
+#else
+      u32 active_voices = (u32(1) << NUM_VOICES) - 1u;
+#endif
+      for (; active_voices != 0u; active_voices &= (active_voices - 1u))
       {
+        const u32 voice = CountTrailingZeros(active_voices);
         const auto [left, right] = SampleVoice(voice);
         left_sum += left;
         right_sum += right;
 
-        if (reverb_on_register & 1u)
+        if (s_reverb_on_register & (u32(1) << voice))
         {
           reverb_in_left += left;
           reverb_in_right += right;
         }
-        reverb_on_register >>= 1;
       }
 
       if (!s_SPUCNT.mute_n)
@@ -2363,6 +2617,7 @@ void SPU::Execute(void* param, TickCount ticks, TickCount ticks_late)
           {
             s_endx_register &= ~(1u << voice);
             s_voices[voice].KeyOn();
+            s_voice_active_mask |= (u32(1) << voice);
           }
           key_on_register >>= 1;
         }
@@ -2385,7 +2640,21 @@ void SPU::UpdateEventInterval()
   const u32 max_slice_frames = s_audio_stream->GetBufferSize();
 
   // TODO: Make this predict how long until the interrupt will be hit instead...
-  const u32 interval = (s_SPUCNT.enable && s_SPUCNT.irq9_enable) ? 1 : max_slice_frames;
+  u32 interval;
+  if (s_SPUCNT.enable && s_SPUCNT.irq9_enable)
+  {
+    // Batch in small blocks while the IRQ is armed instead of dropping to one sample per event.
+    // Voice fetches still raise the IRQ mid-batch (ReadADPCMBlock checks every block), its timing
+    // just coarsens by at most the batch length. IRQ addresses inside the capture buffers are hit
+    // by the per-frame capture writes, so those keep per-sample precision.
+    const u32 irq_ram_address = ZeroExtend32(s_irq_address) * 8;
+    interval =
+      (irq_ram_address < (NUM_CAPTURE_BUFFERS * CAPTURE_BUFFER_SIZE_PER_CHANNEL)) ? 1 : IRQ_EVENT_BATCH_FRAMES;
+  }
+  else
+  {
+    interval = max_slice_frames;
+  }
   const TickCount interval_ticks = static_cast<TickCount>(interval) * s_cpu_ticks_per_spu_tick;
   if (s_tick_event->IsActive() && s_tick_event->GetInterval() == interval_ticks)
     return;
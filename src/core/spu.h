@@ -49,6 +49,9 @@ bool StopDumpingAudio();
 const std::array<u8, RAM_SIZE>& GetRAM();
 std::array<u8, RAM_SIZE>& GetWritableRAM();
 
+/// Bitmask of voices currently contributing to the mix. For debugging.
+u32 GetActiveVoiceMask();
+
 /// Change output stream - used for runahead.
 // TODO: Make it use system "running ahead" flag
 bool IsAudioOutputMuted();
@@ -12,20 +12,24 @@
 #include "cpu_code_cache.h"
 #include "cpu_core.h"
 #include "dma.h"
+#include "frame_profiler.h"
 #include "fullscreen_ui.h"
 #include "game_database.h"
 #include "game_list.h"
 #include "gpu.h"
 #include "gte.h"
+#include "hitch_detector.h"
 #include "host.h"
 #include "host_interface_progress_callback.h"
 #include "imgui_overlays.h"
+#include "input_movie.h"
 #include "interrupt_controller.h"
 #include "mdec.h"
 #include "memory_card.h"
 #include "multitap.h"
 #include "pad.h"
 #include "pcdrv.h"
+#include "performance_tuner.h"
 #include "pgxp.h"
 #include "psf_loader.h"
 #include "save_state_version.h"
@@ -44,6 +48,7 @@
 #include "util/platform_misc.h"
 #include "util/postprocessing.h"
 #include "util/state_wrapper.h"
+#include "util/thread_sampler.h"
 
 #include "common/error.h"
 #include "common/file_system.h"
@@ -61,10 +66,12 @@
 #include <cctype>
 #include <cinttypes>
 #include <cmath>
+#include <condition_variable>
 #include <cstdio>
 #include <deque>
 #include <fstream>
 #include <limits>
+#include <mutex>
 #include <thread>
 
 Log_SetChannel(System);
@@ -109,12 +116,23 @@ static std::string GetMediaPathFromSaveState(const char* path);
 static bool DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_display, bool is_memory_state);
 static bool CreateGPU(GPURenderer renderer, bool is_switching);
 static bool SaveUndoLoadState();
+static void SaveStateThreadEntry(std::string filename, std::unique_ptr<GrowableMemoryByteStream> state_buffer,
+                                 bool compress);
+static void JoinSaveStateThread();
+static bool ReadStateDataSection(ByteStream* state, const SAVE_STATE_HEADER& header, std::unique_ptr<u8[]>* data);
+static std::unique_ptr<ByteStream> ReconstructDeltaState(ByteStream* stream, const char* filename);
 
 /// Throttles the system, i.e. sleeps until it's time to execute the next frame.
 static void Throttle();
 
 static void SetRewinding(bool enabled);
 static bool SaveRewindState();
+static void PopRewindSnapshot();
+static void StartRewindWorkerThread();
+static void StopRewindWorkerThread();
+static void WaitForRewindWorker();
+static void RewindWorkerThread();
+static void CommitRewindJob();
 static void DoRewind();
 
 static void SaveRunaheadState();
@@ -198,8 +216,14 @@ static float s_sw_thread_time = 0.0f;
 static float s_average_gpu_time = 0.0f;
 static float s_accumulated_gpu_time = 0.0f;
 static float s_gpu_usage = 0.0f;
+static std::vector<System::GPUTimerScope> s_accumulated_gpu_timer_scopes;
+static std::vector<System::GPUTimerScope> s_gpu_timer_scopes;
 static System::FrameTimeHistory s_frame_time_history;
 static u32 s_frame_time_history_pos = 0;
+static System::FrameTimeHistory s_present_time_history;
+static u32 s_present_time_history_pos = 0;
+static Common::Timer::Value s_last_present_time = 0;
+static float s_present_duration_estimate_ms = 0.0f;
 static u32 s_last_frame_number = 0;
 static u32 s_last_internal_frame_number = 0;
 static u32 s_last_global_tick_counter = 0;
@@ -215,9 +239,44 @@ static std::unique_ptr<CheatList> s_cheat_list;
 // temporary save state, created when loading, used to undo load state
 static std::unique_ptr<ByteStream> m_undo_load_state;
 
+// background thread which compresses and writes on-disk save states
+static std::thread s_save_state_thread;
+
 static bool s_memory_saves_enabled = false;
 
-static std::deque<System::MemorySaveState> s_rewind_states;
+// Rewind snapshots are stored as backwards deltas: the newest snapshot's full serialized image
+// lives in s_rewind_tip_state, and each older snapshot holds only the 4K pages needed to turn the
+// next-newer snapshot's image back into its own. Stepping back patches the tip in place, and
+// evicting the oldest snapshot just drops its pages, so memory scales with what actually changed.
+enum : u32
+{
+  REWIND_DELTA_PAGE_SIZE = 4096,
+};
+
+struct RewindSnapshot
+{
+  std::unique_ptr<GPUTexture> vram_texture;
+  u32 state_size;
+  std::vector<u32> delta_page_numbers;
+  std::vector<u8> delta_page_data;
+};
+
+static std::deque<RewindSnapshot> s_rewind_snapshots;
+static std::vector<u8> s_rewind_tip_state;
+static std::unique_ptr<u8[]> s_rewind_scratch_buffer;
+
+// worker which diffs freshly-serialized snapshots against the tip, so the emulation thread only
+// pays for the serialize itself. the buffers ping-pong: while the worker walks one, the next
+// frame serializes into the other. everything the worker touches is guarded by the mutex, and
+// consumers of the snapshot deque wait for the pending job to drain first.
+static std::thread s_rewind_worker_thread;
+static std::mutex s_rewind_worker_mutex;
+static std::condition_variable s_rewind_worker_cv;
+static bool s_rewind_worker_shutdown = false;
+static bool s_rewind_job_pending = false;
+static std::unique_ptr<u8[]> s_rewind_job_buffer;
+static u32 s_rewind_job_state_size = 0;
+static std::unique_ptr<GPUTexture> s_rewind_job_texture;
 static s32 s_rewind_load_frequency = -1;
 static s32 s_rewind_load_counter = -1;
 static s32 s_rewind_save_frequency = -1;
@@ -225,7 +284,27 @@ static s32 s_rewind_save_counter = -1;
 static bool s_rewinding_first_save = false;
 
 static std::deque<System::MemorySaveState> s_runahead_states;
+
+// stale states which are kept around after a rollback, so the replay frames can reuse their
+// streams/textures instead of reallocating them. never loaded from, only overwritten.
+static std::deque<System::MemorySaveState> s_runahead_free_states;
 static bool s_runahead_replay_pending = false;
+
+static std::array<System::StateSectionStats, System::NUM_STATE_SECTIONS> s_state_section_stats = {
+  {{"System", 0, 0.0f},
+   {"CPU", 0, 0.0f},
+   {"Bus", 0, 0.0f},
+   {"DMA", 0, 0.0f},
+   {"IRQ", 0, 0.0f},
+   {"GPU", 0, 0.0f},
+   {"CDROM", 0, 0.0f},
+   {"Pad", 0, 0.0f},
+   {"Timers", 0, 0.0f},
+   {"SPU", 0, 0.0f},
+   {"MDEC", 0, 0.0f},
+   {"SIO", 0, 0.0f},
+   {"Events", 0, 0.0f},
+   {"Other", 0, 0.0f}}};
 static u32 s_runahead_frames = 0;
 static u32 s_runahead_replay_frames = 0;
 
@@ -486,6 +565,10 @@ float System::GetGPUAverageTime()
 {
   return s_average_gpu_time;
 }
+const std::vector<System::GPUTimerScope>& System::GetGPUTimerScopes()
+{
+  return s_gpu_timer_scopes;
+}
 const System::FrameTimeHistory& System::GetFrameTimeHistory()
 {
   return s_frame_time_history;
@@ -494,6 +577,14 @@ u32 System::GetFrameTimeHistoryPos()
 {
   return s_frame_time_history_pos;
 }
+const System::FrameTimeHistory& System::GetPresentTimeHistory()
+{
+  return s_present_time_history;
+}
+u32 System::GetPresentTimeHistoryPos()
+{
+  return s_present_time_history_pos;
+}
 
 bool System::IsExeFileName(const std::string_view& path)
 {
@@ -1139,6 +1230,9 @@ bool System::LoadState(const char* filename)
   }
 #endif
 
+  // make sure any in-flight save of this file has hit the disk first
+  JoinSaveStateThread();
+
   Common::Timer load_timer;
 
   std::unique_ptr<ByteStream> stream = ByteStream::OpenFile(filename, BYTESTREAM_OPEN_READ | BYTESTREAM_OPEN_STREAMED);
@@ -1147,6 +1241,22 @@ bool System::LoadState(const char* filename)
 
   Log_InfoPrintf("Loading state from '%s'...", filename);
 
+  // delta states get patched against their base into a full in-memory state first
+  u32 file_magic;
+  if (!stream->Read2(&file_magic, sizeof(file_magic)) || !stream->SeekAbsolute(0))
+    return false;
+  if (file_magic == SAVE_STATE_DELTA_MAGIC)
+  {
+    // nothing has been touched yet if this fails, so no reset is needed
+    stream = ReconstructDeltaState(stream.get(), filename);
+    if (!stream)
+    {
+      Host::ReportFormattedErrorAsync("Load State Error",
+                                      TRANSLATE("System", "Failed to apply delta save state '%s'."), filename);
+      return false;
+    }
+  }
+
   {
     const std::string display_name(FileSystem::GetDisplayNameFromPath(filename));
     Host::AddIconOSDMessage(
@@ -1174,8 +1284,85 @@ bool System::LoadState(const char* filename)
   return true;
 }
 
+void System::JoinSaveStateThread()
+{
+  if (s_save_state_thread.joinable())
+    s_save_state_thread.join();
+}
+
+void System::SaveStateThreadEntry(std::string filename, std::unique_ptr<GrowableMemoryByteStream> state_buffer,
+                                  bool compress)
+{
+  Common::Timer save_timer;
+
+  std::unique_ptr<ByteStream> stream =
+    ByteStream::OpenFile(filename.c_str(), BYTESTREAM_OPEN_CREATE | BYTESTREAM_OPEN_WRITE | BYTESTREAM_OPEN_TRUNCATE |
+                                             BYTESTREAM_OPEN_ATOMIC_UPDATE | BYTESTREAM_OPEN_STREAMED |
+                                             BYTESTREAM_OPEN_SEQUENTIAL);
+  if (!stream)
+  {
+    Host::ReportFormattedErrorAsync(TRANSLATE("OSDMessage", "Save State"),
+                                    TRANSLATE("OSDMessage", "Saving state to '%s' failed."), filename.c_str());
+    return;
+  }
+
+  const u8* buffer = state_buffer->GetMemoryPointer();
+  const u32 buffer_size = static_cast<u32>(state_buffer->GetSize());
+
+  bool result;
+  if (!compress)
+  {
+    // Exact size is known up front, reserve it in one go. The compressed path doesn't know its
+    // final size, so it's left to grow normally rather than over-reserving.
+    stream->PreAllocate(buffer_size);
+    result = stream->Write2(buffer, buffer_size);
+  }
+  else
+  {
+    // The buffer was serialized uncompressed; everything up to the data section is copied
+    // verbatim, the data section is recompressed, and the header is patched afterwards.
+    SAVE_STATE_HEADER header;
+    std::memcpy(&header, buffer, sizeof(header));
+
+    result = stream->Write2(buffer, header.offset_to_data);
+    if (result)
+    {
+      std::unique_ptr<ByteStream> cstream(ByteStream::CreateZstdCompressStream(stream.get(), 0));
+      result = cstream->Write2(buffer + header.offset_to_data, header.data_uncompressed_size) && cstream->Commit();
+    }
+    if (result)
+    {
+      header.data_compression_type = SAVE_STATE_HEADER::COMPRESSION_TYPE_ZSTD;
+      header.data_compressed_size = static_cast<u32>(stream->GetPosition()) - header.offset_to_data;
+
+      const u64 end_position = stream->GetPosition();
+      result = stream->SeekAbsolute(0) && stream->Write2(&header, sizeof(header)) && stream->SeekAbsolute(end_position);
+    }
+  }
+
+  if (!result)
+  {
+    Host::ReportFormattedErrorAsync(TRANSLATE("OSDMessage", "Save State"),
+                                    TRANSLATE("OSDMessage", "Saving state to '%s' failed."), filename.c_str());
+    stream->Discard();
+  }
+  else
+  {
+    const std::string display_name(FileSystem::GetDisplayNameFromPath(filename));
+    Host::AddIconOSDMessage(
+      "save_state", ICON_FA_SAVE,
+      fmt::format(TRANSLATE_FS("OSDMessage", "State saved to '{}'."), Path::GetFileName(display_name)), 5.0f);
+    stream->Commit();
+  }
+
+  Log_VerbosePrintf("Compressing and writing state took %.2f msec", save_timer.GetTimeMilliseconds());
+}
+
 bool System::SaveState(const char* filename, bool backup_existing_save)
 {
+  // only one save in flight at a time, this also keeps writes to the same file ordered
+  JoinSaveStateThread();
+
   if (backup_existing_save && FileSystem::FileExists(filename))
   {
     const std::string backup_filename(Path::ReplaceExtension(filename, "bak"));
@@ -1185,35 +1372,182 @@ bool System::SaveState(const char* filename, bool backup_existing_save)
 
   Common::Timer save_timer;
 
+  Log_InfoPrintf("Saving state to '%s'...", filename);
+
+  // Serialize uncompressed on the emulation thread; compression and disk I/O happen on the
+  // background thread, so the only cost here is the snapshot itself.
+  const u32 screenshot_size = 256;
+  std::unique_ptr<GrowableMemoryByteStream> buffer =
+    std::make_unique<GrowableMemoryByteStream>(nullptr, MAX_SAVE_STATE_SIZE);
+  if (!SaveStateToStream(buffer.get(), screenshot_size, SAVE_STATE_HEADER::COMPRESSION_TYPE_NONE))
+  {
+    Host::ReportFormattedErrorAsync(TRANSLATE("OSDMessage", "Save State"),
+                                    TRANSLATE("OSDMessage", "Saving state to '%s' failed."), filename);
+    return false;
+  }
+
+  Log_VerbosePrintf("Serializing state took %.2f msec", save_timer.GetTimeMilliseconds());
+
+  s_save_state_thread = std::thread(&SaveStateThreadEntry, std::string(filename), std::move(buffer),
+                                    g_settings.compress_save_states);
+  return true;
+}
+
+bool System::SaveStateDelta(const char* filename, const char* base_filename)
+{
+  JoinSaveStateThread();
+
+  Common::Timer save_timer;
+
+  // read and decompress the base state's data section
+  SAVE_STATE_HEADER base_header;
+  std::unique_ptr<u8[]> base_data;
+  {
+    std::unique_ptr<ByteStream> base_stream =
+      ByteStream::OpenFile(base_filename, BYTESTREAM_OPEN_READ | BYTESTREAM_OPEN_STREAMED);
+    if (!base_stream || !base_stream->Read2(&base_header, sizeof(base_header)) ||
+        base_header.magic != SAVE_STATE_MAGIC || base_header.version != SAVE_STATE_VERSION ||
+        !base_stream->SeekAbsolute(base_header.offset_to_data) ||
+        !ReadStateDataSection(base_stream.get(), base_header, &base_data))
+    {
+      Log_ErrorPrintf("Failed to read base state '%s' for delta save", base_filename);
+      return false;
+    }
+  }
+
+  // serialize the current state uncompressed
+  std::unique_ptr<GrowableMemoryByteStream> buffer =
+    std::make_unique<GrowableMemoryByteStream>(nullptr, MAX_SAVE_STATE_SIZE);
+  if (!SaveStateToStream(buffer.get(), 256, SAVE_STATE_HEADER::COMPRESSION_TYPE_NONE))
+    return false;
+
+  SAVE_STATE_HEADER new_header;
+  std::memcpy(&new_header, buffer->GetMemoryPointer(), sizeof(new_header));
+  if (std::memcmp(new_header.serial, base_header.serial, sizeof(new_header.serial)) != 0)
+  {
+    Log_ErrorPrintf("Base state '%s' is for a different game, cannot delta against it", base_filename);
+    return false;
+  }
+
+  // xor the data section against the base - session-chained states turn into long runs of
+  // zeroes, which the zstd pass collapses
+  u8* data = buffer->GetMemoryPointer() + new_header.offset_to_data;
+  const u32 data_size = new_header.data_uncompressed_size;
+  const u32 xor_size = std::min(data_size, base_header.data_uncompressed_size);
+  for (u32 i = 0; i < xor_size; i++)
+    data[i] ^= base_data[i];
+
+  SAVE_STATE_DELTA_HEADER delta_header = {};
+  delta_header.magic = SAVE_STATE_DELTA_MAGIC;
+  delta_header.version = SAVE_STATE_VERSION;
+  std::memcpy(delta_header.serial, new_header.serial, sizeof(delta_header.serial));
+  StringUtil::Strlcpy(delta_header.base_filename, Path::GetFileName(base_filename),
+                      sizeof(delta_header.base_filename));
+  delta_header.base_data_hash = XXH64(base_data.get(), base_header.data_uncompressed_size, 0);
+  delta_header.base_data_uncompressed_size = base_header.data_uncompressed_size;
+  delta_header.prefix_size = new_header.offset_to_data;
+  delta_header.data_uncompressed_size = data_size;
+
   std::unique_ptr<ByteStream> stream =
     ByteStream::OpenFile(filename, BYTESTREAM_OPEN_CREATE | BYTESTREAM_OPEN_WRITE | BYTESTREAM_OPEN_TRUNCATE |
-                                     BYTESTREAM_OPEN_ATOMIC_UPDATE | BYTESTREAM_OPEN_STREAMED);
+                                     BYTESTREAM_OPEN_ATOMIC_UPDATE | BYTESTREAM_OPEN_STREAMED |
+                                     BYTESTREAM_OPEN_SEQUENTIAL);
   if (!stream)
     return false;
 
-  Log_InfoPrintf("Saving state to '%s'...", filename);
+  bool result = stream->Write2(&delta_header, sizeof(delta_header)) &&
+                stream->Write2(buffer->GetMemoryPointer(), delta_header.prefix_size);
+  if (result)
+  {
+    std::unique_ptr<ByteStream> cstream(ByteStream::CreateZstdCompressStream(stream.get(), 0));
+    result = cstream->Write2(data, data_size) && cstream->Commit();
+  }
+  if (result)
+  {
+    const u64 end_position = stream->GetPosition();
+    delta_header.data_compressed_size =
+      static_cast<u32>(end_position) - sizeof(delta_header) - delta_header.prefix_size;
+    result = stream->SeekAbsolute(0) && stream->Write2(&delta_header, sizeof(delta_header)) &&
+             stream->SeekAbsolute(end_position);
+  }
 
-  const u32 screenshot_size = 256;
-  const bool result = SaveStateToStream(stream.get(), screenshot_size,
-                                        g_settings.compress_save_states ? SAVE_STATE_HEADER::COMPRESSION_TYPE_ZSTD :
-                                                                          SAVE_STATE_HEADER::COMPRESSION_TYPE_NONE);
   if (!result)
   {
-    Host::ReportFormattedErrorAsync(TRANSLATE("OSDMessage", "Save State"),
-                                    TRANSLATE("OSDMessage", "Saving state to '%s' failed."), filename);
+    Log_ErrorPrintf("Failed to write delta state to '%s'", filename);
     stream->Discard();
+    return false;
   }
-  else
+
+  stream->Commit();
+  Log_VerbosePrintf("Saving delta state took %.2f msec (%u bytes vs %u uncompressed)",
+                    save_timer.GetTimeMilliseconds(), delta_header.data_compressed_size, data_size);
+  return true;
+}
+
+// Rebuilds a full in-memory state from a delta file by xoring its data section back against the
+// base state, which is looked up by filename in the delta's directory.
+std::unique_ptr<ByteStream> System::ReconstructDeltaState(ByteStream* stream, const char* filename)
+{
+  SAVE_STATE_DELTA_HEADER delta_header;
+  if (!stream->Read2(&delta_header, sizeof(delta_header)) || delta_header.magic != SAVE_STATE_DELTA_MAGIC)
+    return nullptr;
+
+  if (delta_header.version < SAVE_STATE_MINIMUM_VERSION || delta_header.version > SAVE_STATE_VERSION)
   {
-    const std::string display_name(FileSystem::GetDisplayNameFromPath(filename));
-    Host::AddIconOSDMessage(
-      "save_state", ICON_FA_SAVE,
-      fmt::format(TRANSLATE_FS("OSDMessage", "State saved to '{}'."), Path::GetFileName(display_name)), 5.0f);
-    stream->Commit();
+    Log_ErrorPrintf("Delta state version %u is out of range", delta_header.version);
+    return nullptr;
+  }
+
+  const std::string base_path(
+    Path::Combine(Path::GetDirectory(filename), delta_header.base_filename));
+  SAVE_STATE_HEADER base_header;
+  std::unique_ptr<u8[]> base_data;
+  {
+    std::unique_ptr<ByteStream> base_stream =
+      ByteStream::OpenFile(base_path.c_str(), BYTESTREAM_OPEN_READ | BYTESTREAM_OPEN_STREAMED);
+    if (!base_stream || !base_stream->Read2(&base_header, sizeof(base_header)) ||
+        base_header.magic != SAVE_STATE_MAGIC ||
+        base_header.data_uncompressed_size != delta_header.base_data_uncompressed_size ||
+        !base_stream->SeekAbsolute(base_header.offset_to_data) ||
+        !ReadStateDataSection(base_stream.get(), base_header, &base_data))
+    {
+      Log_ErrorPrintf("Failed to read base state '%s' for delta", base_path.c_str());
+      return nullptr;
+    }
+  }
+
+  if (XXH64(base_data.get(), base_header.data_uncompressed_size, 0) != delta_header.base_data_hash)
+  {
+    Log_ErrorPrintf("Base state '%s' does not match the state this delta was created against", base_path.c_str());
+    return nullptr;
+  }
+
+  std::unique_ptr<GrowableMemoryByteStream> full_state = std::make_unique<GrowableMemoryByteStream>(
+    nullptr, delta_header.prefix_size + delta_header.data_uncompressed_size);
+
+  // prefix (header/media filename/screenshot) is stored verbatim
+  std::unique_ptr<u8[]> prefix = std::make_unique<u8[]>(delta_header.prefix_size);
+  std::unique_ptr<u8[]> data = std::make_unique<u8[]>(delta_header.data_uncompressed_size);
+  if (!stream->Read2(prefix.get(), delta_header.prefix_size))
+    return nullptr;
+  {
+    std::unique_ptr<ByteStream> dstream(
+      ByteStream::CreateZstdDecompressStream(stream, delta_header.data_compressed_size));
+    if (!dstream->Read2(data.get(), delta_header.data_uncompressed_size))
+      return nullptr;
   }
 
-  Log_VerbosePrintf("Saving state took %.2f msec", save_timer.GetTimeMilliseconds());
-  return result;
+  const u32 xor_size = std::min(delta_header.data_uncompressed_size, delta_header.base_data_uncompressed_size);
+  for (u32 i = 0; i < xor_size; i++)
+    data[i] ^= base_data[i];
+
+  if (!full_state->Write2(prefix.get(), delta_header.prefix_size, nullptr) ||
+      !full_state->Write2(data.get(), delta_header.data_uncompressed_size, nullptr) || !full_state->SeekAbsolute(0))
+  {
+    return nullptr;
+  }
+
+  return full_state;
 }
 
 bool System::SaveResumeState()
@@ -1247,6 +1581,18 @@ bool System::BootSystem(SystemBootParameters parameters)
   s_region = g_settings.region;
   Host::OnSystemStarting();
 
+  // We're running on the CPU thread here, so this is the thread the sampling profiler watches.
+  ThreadSampler::SetSampledThread();
+  ApplyThreadQoSToCallingThread();
+  HitchDetector::Reset();
+
+  // Warm the game database on a worker thread while the CD image opens. Opening a large disc image is
+  // the long pole here, and UpdateRunningGame() below would otherwise load the database serially after
+  // it. EnsureLoaded() isn't internally synchronized, so the thread is joined before anything else
+  // touches the database.
+  Threading::Thread game_database_load_thread;
+  game_database_load_thread.Start([]() { GameDatabase::EnsureLoaded(); });
+
   // Load CD image up and detect region.
   Error error;
   std::unique_ptr<CDImage> disc;
@@ -1279,6 +1625,7 @@ bool System::BootSystem(SystemBootParameters parameters)
       {
         Host::ReportErrorAsync("Error", fmt::format("Failed to load CD image '{}': {}",
                                                     Path::GetFileName(parameters.filename), error.GetDescription()));
+        game_database_load_thread.Join();
         s_state = State::Shutdown;
         Host::OnSystemDestroyed();
         return false;
@@ -1312,6 +1659,8 @@ bool System::BootSystem(SystemBootParameters parameters)
 
   Log_InfoPrintf("Console Region: %s", Settings::GetConsoleRegionDisplayName(s_region));
 
+  game_database_load_thread.Join();
+
   // Switch subimage.
   if (disc && parameters.media_playlist_index != 0 && !disc->SwitchSubImage(parameters.media_playlist_index, &error))
   {
@@ -1452,6 +1801,8 @@ bool System::BootSystem(SystemBootParameters parameters)
 
   if (parameters.load_image_to_ram || g_settings.cdrom_load_image_to_ram)
     CDROM::PrecacheMedia();
+  else if (g_settings.cdrom_streaming_precache)
+    CDROM::StartStreamingMediaPrecache();
 
   if (parameters.fast_forward_to_first_frame)
     FastForwardToFirstFrame();
@@ -1504,6 +1855,8 @@ bool System::Initialize(bool force_software_renderer)
   s_average_gpu_time = 0.0f;
   s_accumulated_gpu_time = 0.0f;
   s_gpu_usage = 0.0f;
+  s_accumulated_gpu_timer_scopes.clear();
+  s_gpu_timer_scopes.clear();
   s_last_frame_number = 0;
   s_last_internal_frame_number = 0;
   s_last_global_tick_counter = 0;
@@ -1513,6 +1866,10 @@ bool System::Initialize(bool force_software_renderer)
   s_frame_timer.Reset();
   s_frame_time_history.fill(0.0f);
   s_frame_time_history_pos = 0;
+  s_present_time_history.fill(0.0f);
+  s_present_time_history_pos = 0;
+  s_last_present_time = 0;
+  s_present_duration_estimate_ms = 0.0f;
 
   TimingEvents::Initialize();
 
@@ -1612,6 +1969,15 @@ void System::DestroySystem()
   if (s_state == State::Shutdown)
     return;
 
+  JoinSaveStateThread();
+
+  InputMovie::Stop();
+
+  // The sampled thread is going away with the system, so the profiler can't keep running.
+  ThreadSampler::Stop();
+
+  PerformanceTuner::Shutdown();
+
   Host::ClearOSDMessages();
 
   PostProcessing::Shutdown();
@@ -1798,6 +2164,7 @@ void System::FrameDone()
       // counter-acts that.
       Host::PumpMessagesOnCPUThread();
       InputManager::PollSources();
+      InputMovie::ProcessFrame();
       g_gpu->RestoreDeviceContext();
 
       if (IsExecutionInterrupted())
@@ -1820,6 +2187,19 @@ void System::FrameDone()
   const Common::Timer::Value current_time = Common::Timer::GetCurrentValue();
   if (current_time < s_next_frame_time || s_display_all_frames || s_last_frame_skipped)
   {
+    // Pace the present against the throttle clock. When we finish emulating early, sleep off most
+    // of the remaining frame period before presenting, leaving the estimated CPU-side present cost,
+    // so frames are handed to the display on a regular cadence instead of whenever emulation
+    // happened to finish. Displaying all frames can present more than once per period, and host
+    // vsync throttling disables the throttler, so both keep presenting immediately.
+    if (s_throttler_enabled && !s_display_all_frames && current_time < s_next_frame_time)
+    {
+      const Common::Timer::Value present_estimate =
+        Common::Timer::ConvertMillisecondsToValue(s_present_duration_estimate_ms);
+      if ((current_time + present_estimate) < s_next_frame_time)
+        Common::Timer::SleepUntil(s_next_frame_time - present_estimate, false);
+    }
+
     s_last_frame_skipped = !PresentDisplay(true);
   }
   else if (current_time >= s_next_frame_time)
@@ -1836,6 +2216,7 @@ void System::FrameDone()
   {
     Host::PumpMessagesOnCPUThread();
     InputManager::PollSources();
+    InputMovie::ProcessFrame();
 
     if (IsExecutionInterrupted())
     {
@@ -1847,6 +2228,13 @@ void System::FrameDone()
 
   g_gpu->RestoreDeviceContext();
 
+#if ENABLE_FRAME_PROFILER
+  FrameProfiler::EndFrame();
+#endif
+
+  if (g_settings.hitch_detector_enable)
+    HitchDetector::EndFrame();
+
   // Update perf counters *after* throttling, we want to measure from start-of-frame
   // to start-of-frame, not end-of-frame to end-of-frame (will be noisy due to different
   // amounts of computation happening in each frame).
@@ -2020,6 +2408,21 @@ bool System::CreateGPU(GPURenderer renderer, bool is_switching)
 
 bool System::DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_display, bool is_memory_state)
 {
+  // cheap per-section accounting, so size/speed regressions can be attributed to a subsystem
+  u64 stats_last_pos = sw.GetPosition();
+  Common::Timer::Value stats_last_time = Common::Timer::GetCurrentValue();
+  u32 stats_section = 0;
+  const auto end_stats_section = [&stats_last_pos, &stats_last_time, &stats_section, &sw]() {
+    const u64 pos = sw.GetPosition();
+    const Common::Timer::Value time = Common::Timer::GetCurrentValue();
+    s_state_section_stats[stats_section].bytes = static_cast<u32>(pos - stats_last_pos);
+    s_state_section_stats[stats_section].time_ms =
+      static_cast<float>(Common::Timer::ConvertValueToMilliseconds(time - stats_last_time));
+    stats_section++;
+    stats_last_pos = pos;
+    stats_last_time = time;
+  };
+
   if (!sw.DoMarker("System"))
     return false;
 
@@ -2044,6 +2447,8 @@ bool System::DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_di
     }
   }
 
+  end_stats_section();
+
   if (!sw.DoMarker("CPU") || !CPU::DoState(sw))
     return false;
 
@@ -2060,40 +2465,64 @@ bool System::DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_di
   if (sw.IsReading() && g_settings.gpu_pgxp_enable && !is_memory_state)
     PGXP::Reset();
 
+  end_stats_section();
+
   if (!sw.DoMarker("Bus") || !Bus::DoState(sw))
     return false;
 
+  end_stats_section();
+
   if (!sw.DoMarker("DMA") || !DMA::DoState(sw))
     return false;
 
+  end_stats_section();
+
   if (!sw.DoMarker("InterruptController") || !InterruptController::DoState(sw))
     return false;
 
   g_gpu->RestoreDeviceContext();
+  end_stats_section();
+
   if (!sw.DoMarker("GPU") || !g_gpu->DoState(sw, host_texture, update_display))
     return false;
 
+  end_stats_section();
+
   if (!sw.DoMarker("CDROM") || !CDROM::DoState(sw))
     return false;
 
+  end_stats_section();
+
   if (!sw.DoMarker("Pad") || !Pad::DoState(sw, is_memory_state))
     return false;
 
+  end_stats_section();
+
   if (!sw.DoMarker("Timers") || !Timers::DoState(sw))
     return false;
 
+  end_stats_section();
+
   if (!sw.DoMarker("SPU") || !SPU::DoState(sw))
     return false;
 
+  end_stats_section();
+
   if (!sw.DoMarker("MDEC") || !MDEC::DoState(sw))
     return false;
 
+  end_stats_section();
+
   if (!sw.DoMarker("SIO") || !SIO::DoState(sw))
     return false;
 
+  end_stats_section();
+
   if (!sw.DoMarker("Events") || !TimingEvents::DoState(sw))
     return false;
 
+  end_stats_section();
+
   if (!sw.DoMarker("Overclock"))
     return false;
 
@@ -2144,9 +2573,30 @@ bool System::DoState(StateWrapper& sw, GPUTexture** host_texture, bool update_di
     }
   }
 
+  end_stats_section();
+
   return !sw.HasError();
 }
 
+const std::array<System::StateSectionStats, System::NUM_STATE_SECTIONS>& System::GetStateSerializationStats()
+{
+  return s_state_section_stats;
+}
+
+void System::LogStateSerializationStats()
+{
+  if (!IsValid())
+    return;
+
+  MemorySaveState mss;
+  if (!SaveMemoryState(&mss))
+    return;
+
+  Log_InfoPrintf("Memory state breakdown (%zu bytes total):", mss.state_size);
+  for (const StateSectionStats& stats : s_state_section_stats)
+    Log_InfoPrintf("  %-8s %8u bytes  %.3f ms", stats.name, stats.bytes, static_cast<double>(stats.time_ms));
+}
+
 bool System::LoadBIOS(const std::string& override_bios_path)
 {
   std::optional<BIOS::Image> bios_image(
@@ -2232,6 +2682,27 @@ std::string System::GetMediaPathFromSaveState(const char* path)
   return ret;
 }
 
+// Reads (and decompresses, if necessary) the data section described by the header into a flat
+// buffer. Assumes the stream is positioned at the start of the data section.
+bool System::ReadStateDataSection(ByteStream* state, const SAVE_STATE_HEADER& header, std::unique_ptr<u8[]>* data)
+{
+  *data = std::make_unique<u8[]>(header.data_uncompressed_size);
+  if (header.data_compression_type == SAVE_STATE_HEADER::COMPRESSION_TYPE_NONE)
+  {
+    return state->Read2(data->get(), header.data_uncompressed_size);
+  }
+  else if (header.data_compression_type == SAVE_STATE_HEADER::COMPRESSION_TYPE_ZSTD)
+  {
+    std::unique_ptr<ByteStream> dstream(ByteStream::CreateZstdDecompressStream(state, header.data_compressed_size));
+    return dstream->Read2(data->get(), header.data_uncompressed_size);
+  }
+  else
+  {
+    Host::ReportFormattedErrorAsync("Error", "Unknown save state compression type %u", header.data_compression_type);
+    return false;
+  }
+}
+
 bool System::LoadStateFromStream(ByteStream* state, bool update_display, bool ignore_media)
 {
   Assert(IsValid());
@@ -2332,6 +2803,8 @@ bool System::LoadStateFromStream(ByteStream* state, bool update_display, bool ig
       CDROM::InsertMedia(std::move(media), region);
       if (g_settings.cdrom_load_image_to_ram)
         CDROM::PrecacheMedia();
+      else if (g_settings.cdrom_streaming_precache)
+        CDROM::StartStreamingMediaPrecache();
     }
     else
     {
@@ -2358,24 +2831,17 @@ bool System::LoadStateFromStream(ByteStream* state, bool update_display, bool ig
   if (!state->SeekAbsolute(header.offset_to_data))
     return false;
 
-  if (header.data_compression_type == SAVE_STATE_HEADER::COMPRESSION_TYPE_NONE)
-  {
-    StateWrapper sw(state, StateWrapper::Mode::Read, header.version);
-    if (!DoState(sw, nullptr, update_display, false))
-      return false;
-  }
-  else if (header.data_compression_type == SAVE_STATE_HEADER::COMPRESSION_TYPE_ZSTD)
-  {
-    std::unique_ptr<ByteStream> dstream(ByteStream::CreateZstdDecompressStream(state, header.data_compressed_size));
-    StateWrapper sw(dstream.get(), StateWrapper::Mode::Read, header.version);
-    if (!DoState(sw, nullptr, update_display, false))
-      return false;
-  }
-  else
-  {
-    Host::ReportFormattedErrorAsync("Error", "Unknown save state compression type %u", header.data_compression_type);
+  // Pull the whole data section into a flat buffer with one read/decompress, and deserialize
+  // out of that. The screenshot is never touched on this path - the header offsets mean the
+  // resume-critical data is all we read - and the bulk decompress avoids paying a buffered
+  // stream call for every field.
+  std::unique_ptr<u8[]> data;
+  if (!ReadStateDataSection(state, header, &data))
+    return false;
+
+  StateWrapper sw(data.get(), header.data_uncompressed_size, StateWrapper::Mode::Read, header.version);
+  if (!DoState(sw, nullptr, update_display, false))
     return false;
-  }
 
   if (s_state == State::Starting)
     s_state = State::Running;
@@ -2545,6 +3011,10 @@ void System::UpdatePerformanceCounters()
             100.0f;
   s_last_global_tick_counter = global_tick_counter;
 
+  // Only learn from measurements where full speed was actually the target.
+  if (g_settings.auto_tune_performance && s_throttler_enabled && g_settings.emulation_speed == 1.0f)
+    PerformanceTuner::UpdateMetrics(s_speed);
+
   const Threading::Thread* sw_thread = g_gpu->GetSWThread();
   const u64 cpu_time = s_cpu_thread_handle ? s_cpu_thread_handle.GetCPUTime() : 0;
   const u64 sw_time = sw_thread ? sw_thread->GetCPUTime() : 0;
@@ -2564,6 +3034,14 @@ void System::UpdatePerformanceCounters()
   {
     s_average_gpu_time = s_accumulated_gpu_time / static_cast<float>(std::max(s_presents_since_last_update, 1u));
     s_gpu_usage = s_accumulated_gpu_time / (time * 10.0f);
+
+    s_gpu_timer_scopes = std::move(s_accumulated_gpu_timer_scopes);
+    s_accumulated_gpu_timer_scopes = {};
+    for (GPUTimerScope& scope : s_gpu_timer_scopes)
+      scope.time_ms /= static_cast<float>(std::max(s_presents_since_last_update, 1u));
+
+    if (g_settings.gpu_dynamic_resolution_scale && g_gpu)
+      g_gpu->UpdateDynamicResolutionScale();
   }
   s_accumulated_gpu_time = 0.0f;
   s_presents_since_last_update = 0;
@@ -2571,6 +3049,11 @@ void System::UpdatePerformanceCounters()
   Log_VerbosePrintf("FPS: %.2f VPS: %.2f CPU: %.2f GPU: %.2f Average: %.2fms Min: %.2fms Max: %.2f ms", s_fps, s_vps,
                     s_cpu_thread_usage, s_gpu_usage, s_average_frame_time, s_minimum_frame_time, s_maximum_frame_time);
 
+  // Incrementally flush the pipeline cache while running, so shutdown doesn't stall on one big
+  // synchronous write.
+  g_gpu_device->MaybeSavePipelineCache();
+  g_gpu_device->TrimTexturePool();
+
   Host::OnPerformanceCountersUpdated();
 }
 
@@ -2593,6 +3076,26 @@ void System::ResetPerformanceCounters()
   ResetThrottler();
 }
 
+void System::ApplyThreadQoSToCallingThread()
+{
+  const Threading::ThreadHandle handle = Threading::ThreadHandle::GetForCallingThread();
+
+  // Hybrid parts: keep the emulation threads off the efficiency cores. An empty mask restores the
+  // full processor set when the option is turned back off.
+  u64 affinity_mask = 0;
+  if (g_settings.pin_threads_to_performance_cores)
+  {
+    affinity_mask = Threading::GetPerformanceCoreMask();
+    if (affinity_mask == 0)
+      Log_DevPrintf("No performance core preference on this host, leaving affinity alone.");
+  }
+  if (!handle.SetAffinity(affinity_mask))
+    Log_WarningPrintf("Failed to set thread affinity mask to 0x%" PRIx64 ".", affinity_mask);
+
+  if (!handle.SetPriority(g_settings.emulation_thread_realtime_priority ? 2 : 0))
+    Log_WarningPrintf("Failed to set thread priority. Realtime scheduling may not be permitted.");
+}
+
 void System::UpdateSpeedLimiterState()
 {
   const float old_target_speed = s_target_speed;
@@ -3264,6 +3767,8 @@ bool System::InsertMedia(const char* path)
                  s_running_game_title.c_str());
   if (g_settings.cdrom_load_image_to_ram)
     CDROM::PrecacheMedia();
+  else if (g_settings.cdrom_streaming_precache)
+    CDROM::StartStreamingMediaPrecache();
 
   Host::AddFormattedOSDMessage(10.0f, TRANSLATE("OSDMessage", "Inserted disc '%s' (%s)."), s_running_game_title.c_str(),
                                s_running_game_serial.c_str());
@@ -3357,6 +3862,8 @@ void System::UpdateRunningGame(const char* path, CDImage* image, bool booting)
   UpdateDiscordPresence(false);
 #endif
 
+  PerformanceTuner::OnGameChanged(s_running_game_serial);
+
   Host::OnGameChanged(s_running_game_path, s_running_game_serial, s_running_game_title);
 }
 
@@ -3534,6 +4041,13 @@ void System::CheckForSettingsChanges(const Settings& old_settings)
     }
     if (g_settings.audio_stretch_mode != old_settings.audio_stretch_mode)
       SPU::GetOutputStream()->SetStretchMode(g_settings.audio_stretch_mode);
+
+    // Applies to the CPU thread here; the GPU backend thread picks the change up on restart.
+    if (g_settings.pin_threads_to_performance_cores != old_settings.pin_threads_to_performance_cores ||
+        g_settings.emulation_thread_realtime_priority != old_settings.emulation_thread_realtime_priority)
+    {
+      ApplyThreadQoSToCallingThread();
+    }
     if (g_settings.audio_buffer_ms != old_settings.audio_buffer_ms ||
         g_settings.audio_output_latency_ms != old_settings.audio_output_latency_ms ||
         g_settings.audio_stretch_mode != old_settings.audio_stretch_mode)
@@ -3560,6 +4074,7 @@ void System::CheckForSettingsChanges(const Settings& old_settings)
         (g_settings.cpu_recompiler_memory_exceptions != old_settings.cpu_recompiler_memory_exceptions ||
          g_settings.cpu_recompiler_block_linking != old_settings.cpu_recompiler_block_linking ||
          g_settings.cpu_recompiler_icache != old_settings.cpu_recompiler_icache ||
+         g_settings.cpu_recompiler_tiered_compilation != old_settings.cpu_recompiler_tiered_compilation ||
          g_settings.bios_tty_logging != old_settings.bios_tty_logging))
     {
       Host::AddOSDMessage(TRANSLATE_STR("OSDMessage", "Recompiler options changed, flushing all blocks."), 5.0f);
@@ -3577,6 +4092,7 @@ void System::CheckForSettingsChanges(const Settings& old_settings)
     SPU::GetOutputStream()->SetOutputVolume(GetAudioOutputVolume());
 
     if (g_settings.gpu_resolution_scale != old_settings.gpu_resolution_scale ||
+        g_settings.gpu_dynamic_resolution_scale != old_settings.gpu_dynamic_resolution_scale ||
         g_settings.gpu_multisamples != old_settings.gpu_multisamples ||
         g_settings.gpu_per_sample_shading != old_settings.gpu_per_sample_shading ||
         g_settings.gpu_use_thread != old_settings.gpu_use_thread ||
@@ -3585,6 +4101,7 @@ void System::CheckForSettingsChanges(const Settings& old_settings)
         g_settings.gpu_max_run_ahead != old_settings.gpu_max_run_ahead ||
         g_settings.gpu_true_color != old_settings.gpu_true_color ||
         g_settings.gpu_scaled_dithering != old_settings.gpu_scaled_dithering ||
+        g_settings.gpu_uber_shader != old_settings.gpu_uber_shader ||
         g_settings.gpu_texture_filter != old_settings.gpu_texture_filter ||
         g_settings.gpu_disable_interlacing != old_settings.gpu_disable_interlacing ||
         g_settings.gpu_force_ntsc_timings != old_settings.gpu_force_ntsc_timings ||
@@ -3757,8 +4274,14 @@ void System::CalculateRewindMemoryUsage(u32 num_saves, u64* ram_usage, u64* vram
 
 void System::ClearMemorySaveStates()
 {
-  s_rewind_states.clear();
+  StopRewindWorkerThread();
+  s_rewind_job_buffer.reset();
+  s_rewind_job_texture.reset();
+  s_rewind_snapshots.clear();
+  s_rewind_tip_state = {};
+  s_rewind_scratch_buffer.reset();
   s_runahead_states.clear();
+  s_runahead_free_states.clear();
 }
 
 void System::UpdateMemorySaveStateSettings()
@@ -3793,13 +4316,11 @@ void System::UpdateMemorySaveStateSettings()
     Log_InfoPrintf("Runahead is active with %u frames", s_runahead_frames);
 }
 
-bool System::LoadMemoryState(const MemorySaveState& mss)
+bool System::LoadMemoryState(const MemorySaveState& mss, bool update_display)
 {
-  mss.state_stream->SeekAbsolute(0);
-
-  StateWrapper sw(mss.state_stream.get(), StateWrapper::Mode::Read, SAVE_STATE_VERSION);
+  StateWrapper sw(mss.state_data.get(), mss.state_size, StateWrapper::Mode::Read, SAVE_STATE_VERSION);
   GPUTexture* host_texture = mss.vram_texture.get();
-  if (!DoState(sw, &host_texture, true, true))
+  if (!DoState(sw, &host_texture, update_display, true))
   {
     Host::ReportErrorAsync("Error", "Failed to load memory save state, resetting.");
     InternalReset();
@@ -3811,13 +4332,11 @@ bool System::LoadMemoryState(const MemorySaveState& mss)
 
 bool System::SaveMemoryState(MemorySaveState* mss)
 {
-  if (!mss->state_stream)
-    mss->state_stream = std::make_unique<GrowableMemoryByteStream>(nullptr, MAX_SAVE_STATE_SIZE);
-  else
-    mss->state_stream->SeekAbsolute(0);
+  if (!mss->state_data)
+    mss->state_data = std::make_unique<u8[]>(MAX_SAVE_STATE_SIZE);
 
   GPUTexture* host_texture = mss->vram_texture.release();
-  StateWrapper sw(mss->state_stream.get(), StateWrapper::Mode::Write, SAVE_STATE_VERSION);
+  StateWrapper sw(mss->state_data.get(), MAX_SAVE_STATE_SIZE, StateWrapper::Mode::Write, SAVE_STATE_VERSION);
   if (!DoState(sw, &host_texture, false, true))
   {
     Log_ErrorPrint("Failed to create rewind state.");
@@ -3826,6 +4345,7 @@ bool System::SaveMemoryState(MemorySaveState* mss)
   }
 
   mss->vram_texture.reset(host_texture);
+  mss->state_size = static_cast<size_t>(sw.GetPosition());
   return true;
 }
 
@@ -3835,48 +4355,218 @@ bool System::SaveRewindState()
   Common::Timer save_timer;
 #endif
 
-  // try to reuse the frontmost slot
+  // wait for the previous snapshot's diff to finish before touching the deque
+  StartRewindWorkerThread();
+  WaitForRewindWorker();
+
+  // try to reuse the frontmost slot's texture; its delta pages are simply dropped
   const u32 save_slots = g_settings.rewind_save_slots;
-  MemorySaveState mss;
-  while (s_rewind_states.size() >= save_slots)
+  std::unique_ptr<GPUTexture> recycled_texture;
+  while (s_rewind_snapshots.size() >= save_slots)
   {
-    mss = std::move(s_rewind_states.front());
-    s_rewind_states.pop_front();
+    recycled_texture = std::move(s_rewind_snapshots.front().vram_texture);
+    s_rewind_snapshots.pop_front();
   }
 
-  if (!SaveMemoryState(&mss))
+  if (!s_rewind_scratch_buffer)
+    s_rewind_scratch_buffer = std::make_unique<u8[]>(MAX_SAVE_STATE_SIZE);
+
+  GPUTexture* host_texture = recycled_texture.release();
+  StateWrapper sw(s_rewind_scratch_buffer.get(), MAX_SAVE_STATE_SIZE, StateWrapper::Mode::Write, SAVE_STATE_VERSION);
+  if (!DoState(sw, &host_texture, false, true))
+  {
+    Log_ErrorPrint("Failed to create rewind state.");
+    delete host_texture;
     return false;
+  }
 
-  s_rewind_states.push_back(std::move(mss));
+  // hand the diff against the tip to the worker, and keep the buffer it finished with for the
+  // next frame's serialize
+  {
+    std::unique_lock lock(s_rewind_worker_mutex);
+    s_rewind_job_buffer.swap(s_rewind_scratch_buffer);
+    s_rewind_job_state_size = static_cast<u32>(sw.GetPosition());
+    s_rewind_job_texture.reset(host_texture);
+    s_rewind_job_pending = true;
+    s_rewind_worker_cv.notify_all();
+  }
 
 #ifdef PROFILE_MEMORY_SAVE_STATES
-  Log_DevPrintf("Saved rewind state (%" PRIu64 " bytes, took %.4f ms)", s_rewind_states.back().state_stream->GetSize(),
-                save_timer.GetTimeMilliseconds());
+  Log_DevPrintf("Serializing rewind state took %.4f ms", save_timer.GetTimeMilliseconds());
 #endif
 
   return true;
 }
 
+// Runs on the rewind worker with the mutex held; diffs the handed-off state against the tip and
+// pushes the resulting snapshot.
+void System::CommitRewindJob()
+{
+  const u8* state_data = s_rewind_job_buffer.get();
+  const u32 state_size = s_rewind_job_state_size;
+  const u32 num_pages = (state_size + (REWIND_DELTA_PAGE_SIZE - 1)) / REWIND_DELTA_PAGE_SIZE;
+  const u32 padded_size = num_pages * REWIND_DELTA_PAGE_SIZE;
+
+  if (s_rewind_snapshots.empty())
+  {
+    s_rewind_tip_state.assign(state_data, state_data + state_size);
+    s_rewind_tip_state.resize(padded_size, 0);
+  }
+  else
+  {
+    // Diff against the current tip, recording the pages we overwrite as the previous snapshot's
+    // backwards delta. The tip is kept zero-padded to a page multiple, so tails compare clean
+    // even when the serialized size changes between snapshots.
+    if (s_rewind_tip_state.size() < padded_size)
+      s_rewind_tip_state.resize(padded_size, 0);
+
+    RewindSnapshot& prev = s_rewind_snapshots.back();
+    const u32 num_tip_pages = static_cast<u32>(s_rewind_tip_state.size()) / REWIND_DELTA_PAGE_SIZE;
+    for (u32 page = 0; page < num_tip_pages; page++)
+    {
+      u8* old_page = &s_rewind_tip_state[page * REWIND_DELTA_PAGE_SIZE];
+      const u32 page_offset = page * REWIND_DELTA_PAGE_SIZE;
+      const u32 new_page_size = (page_offset < state_size) ?
+                                  std::min<u32>(REWIND_DELTA_PAGE_SIZE, state_size - page_offset) :
+                                  0;
+
+      // pages past the end of the new state are dirty if they hold anything but padding
+      bool dirty;
+      if (new_page_size > 0)
+        dirty = (std::memcmp(old_page, state_data + page_offset, new_page_size) != 0);
+      else
+        dirty = std::any_of(old_page, old_page + REWIND_DELTA_PAGE_SIZE, [](u8 b) { return b != 0; });
+
+      if (!dirty)
+        continue;
+
+      prev.delta_page_numbers.push_back(page);
+      prev.delta_page_data.insert(prev.delta_page_data.end(), old_page, old_page + REWIND_DELTA_PAGE_SIZE);
+
+      if (new_page_size > 0)
+        std::memcpy(old_page, state_data + page_offset, new_page_size);
+      if (new_page_size < REWIND_DELTA_PAGE_SIZE)
+        std::memset(old_page + new_page_size, 0, REWIND_DELTA_PAGE_SIZE - new_page_size);
+    }
+  }
+
+  RewindSnapshot snapshot;
+  snapshot.vram_texture = std::move(s_rewind_job_texture);
+  snapshot.state_size = state_size;
+  s_rewind_snapshots.push_back(std::move(snapshot));
+
+#ifdef PROFILE_MEMORY_SAVE_STATES
+  Log_DevPrintf("Committed rewind state (%u bytes, %zu delta pages)", state_size,
+                (s_rewind_snapshots.size() > 1) ?
+                  s_rewind_snapshots[s_rewind_snapshots.size() - 2].delta_page_numbers.size() :
+                  size_t(0));
+#endif
+}
+
+void System::StartRewindWorkerThread()
+{
+  if (s_rewind_worker_thread.joinable())
+    return;
+
+  s_rewind_worker_shutdown = false;
+  s_rewind_job_pending = false;
+  s_rewind_worker_thread = std::thread(&RewindWorkerThread);
+}
+
+void System::StopRewindWorkerThread()
+{
+  if (!s_rewind_worker_thread.joinable())
+    return;
+
+  {
+    std::unique_lock lock(s_rewind_worker_mutex);
+    s_rewind_worker_cv.wait(lock, []() { return !s_rewind_job_pending; });
+    s_rewind_worker_shutdown = true;
+    s_rewind_worker_cv.notify_all();
+  }
+
+  s_rewind_worker_thread.join();
+}
+
+void System::WaitForRewindWorker()
+{
+  if (!s_rewind_worker_thread.joinable())
+    return;
+
+  std::unique_lock lock(s_rewind_worker_mutex);
+  s_rewind_worker_cv.wait(lock, []() { return !s_rewind_job_pending; });
+}
+
+void System::RewindWorkerThread()
+{
+  std::unique_lock lock(s_rewind_worker_mutex);
+  for (;;)
+  {
+    s_rewind_worker_cv.wait(lock, []() { return (s_rewind_worker_shutdown || s_rewind_job_pending); });
+    if (s_rewind_worker_shutdown)
+      break;
+
+    CommitRewindJob();
+    s_rewind_job_pending = false;
+    s_rewind_worker_cv.notify_all();
+  }
+}
+
+void System::PopRewindSnapshot()
+{
+  s_rewind_snapshots.pop_back();
+  if (s_rewind_snapshots.empty())
+  {
+    s_rewind_tip_state = {};
+    return;
+  }
+
+  // patch the tip image back into the previous snapshot, which becomes the new tip
+  RewindSnapshot& snapshot = s_rewind_snapshots.back();
+  const u32 padded_size = ((snapshot.state_size + (REWIND_DELTA_PAGE_SIZE - 1)) / REWIND_DELTA_PAGE_SIZE) *
+                          REWIND_DELTA_PAGE_SIZE;
+  if (s_rewind_tip_state.size() < padded_size)
+    s_rewind_tip_state.resize(padded_size, 0);
+
+  for (size_t i = 0; i < snapshot.delta_page_numbers.size(); i++)
+  {
+    std::memcpy(&s_rewind_tip_state[snapshot.delta_page_numbers[i] * REWIND_DELTA_PAGE_SIZE],
+                &snapshot.delta_page_data[i * REWIND_DELTA_PAGE_SIZE], REWIND_DELTA_PAGE_SIZE);
+  }
+
+  snapshot.delta_page_numbers = {};
+  snapshot.delta_page_data = {};
+}
+
 bool System::LoadRewindState(u32 skip_saves /*= 0*/, bool consume_state /*=true */)
 {
-  while (skip_saves > 0 && !s_rewind_states.empty())
+  WaitForRewindWorker();
+
+  while (skip_saves > 0 && !s_rewind_snapshots.empty())
   {
-    s_rewind_states.pop_back();
+    PopRewindSnapshot();
     skip_saves--;
   }
 
-  if (s_rewind_states.empty())
+  if (s_rewind_snapshots.empty())
     return false;
 
 #ifdef PROFILE_MEMORY_SAVE_STATES
   Common::Timer load_timer;
 #endif
 
-  if (!LoadMemoryState(s_rewind_states.back()))
+  RewindSnapshot& snapshot = s_rewind_snapshots.back();
+  StateWrapper sw(s_rewind_tip_state.data(), snapshot.state_size, StateWrapper::Mode::Read, SAVE_STATE_VERSION);
+  GPUTexture* host_texture = snapshot.vram_texture.get();
+  if (!DoState(sw, &host_texture, true, true))
+  {
+    Host::ReportErrorAsync("Error", "Failed to load memory save state, resetting.");
+    InternalReset();
     return false;
+  }
 
   if (consume_state)
-    s_rewind_states.pop_back();
+    PopRewindSnapshot();
 
 #ifdef PROFILE_MEMORY_SAVE_STATES
   Log_DevPrintf("Rewind load took %.4f ms", load_timer.GetTimeMilliseconds());
@@ -3937,13 +4627,18 @@ void System::DoRewind()
 
 void System::SaveRunaheadState()
 {
-  // try to reuse the frontmost slot
+  // try to reuse the frontmost slot, or a buffer left over from the last rollback
   MemorySaveState mss;
   while (s_runahead_states.size() >= s_runahead_frames)
   {
     mss = std::move(s_runahead_states.front());
     s_runahead_states.pop_front();
   }
+  if (!mss.state_data && !s_runahead_free_states.empty())
+  {
+    mss = std::move(s_runahead_free_states.front());
+    s_runahead_free_states.pop_front();
+  }
 
   if (!SaveMemoryState(&mss))
   {
@@ -3967,19 +4662,25 @@ bool System::DoRunahead()
     replay_timer.Reset();
 #endif
 
-    // we need to replay and catch up - load the state,
+    // we need to replay and catch up - load the state. don't bother updating the display,
+    // since the replay frames will overwrite it anyway
     s_runahead_replay_pending = false;
-    if (s_runahead_states.empty() || !LoadMemoryState(s_runahead_states.front()))
+    if (s_runahead_states.empty() || !LoadMemoryState(s_runahead_states.front(), false))
     {
       s_runahead_states.clear();
+      s_runahead_free_states.clear();
       return false;
     }
 
     // figure out how many frames we need to run to catch up
     s_runahead_replay_frames = static_cast<u32>(s_runahead_states.size());
 
-    // and throw away all the states, forcing us to catch up below
-    s_runahead_states.clear();
+    // the states are now stale, but the replay frames can recycle their buffers
+    while (!s_runahead_states.empty())
+    {
+      s_runahead_free_states.push_back(std::move(s_runahead_states.front()));
+      s_runahead_states.pop_front();
+    }
 
     // run the frames with no audio
     SPU::SetAudioOutputMuted(true);
@@ -4132,6 +4833,33 @@ bool System::IsDumpingAudio()
   return SPU::IsDumpingAudio();
 }
 
+bool System::StartRecordingInputMovie(const char* filename)
+{
+  if (!System::IsValid())
+    return false;
+
+  std::string auto_filename;
+  if (!filename)
+  {
+    const auto& serial = System::GetGameSerial();
+    if (serial.empty())
+    {
+      auto_filename = Path::Combine(EmuFolders::Dumps, fmt::format("movies" FS_OSPATH_SEPARATOR_STR "{}.dsmovie",
+                                                                   GetTimestampStringForFileName()));
+    }
+    else
+    {
+      auto_filename = Path::Combine(EmuFolders::Dumps, fmt::format("movies" FS_OSPATH_SEPARATOR_STR "{}_{}.dsmovie",
+                                                                   serial, GetTimestampStringForFileName()));
+    }
+
+    FileSystem::EnsureDirectoryExists(std::string(Path::GetDirectory(auto_filename)).c_str(), false);
+    filename = auto_filename.c_str();
+  }
+
+  return InputMovie::BeginRecording(filename);
+}
+
 bool System::StartDumpingAudio(const char* filename)
 {
   if (System::IsShutdown())
@@ -4666,6 +5394,10 @@ void System::HostDisplayResized()
 bool System::PresentDisplay(bool allow_skip_present)
 {
   const bool skip_present = allow_skip_present && g_gpu_device->ShouldSkipDisplayingFrame();
+  const Common::Timer::Value present_start = Common::Timer::GetCurrentValue();
+#if ENABLE_FRAME_PROFILER
+  const u64 profile_start = FrameProfiler::GetTimestamp();
+#endif
 
   Host::BeginPresentFrame();
 
@@ -4699,7 +5431,33 @@ bool System::PresentDisplay(bool allow_skip_present)
     {
       s_accumulated_gpu_time += g_gpu_device->GetAndResetAccumulatedGPUTime();
       s_presents_since_last_update++;
+
+      for (const GPUDevice::TimerScopeResult& scope : g_gpu_device->GetAndResetTimerScopes())
+      {
+        auto it = std::find_if(s_accumulated_gpu_timer_scopes.begin(), s_accumulated_gpu_timer_scopes.end(),
+                               [&scope](const GPUTimerScope& acc) { return (acc.name == scope.name); });
+        if (it != s_accumulated_gpu_timer_scopes.end())
+          it->time_ms += scope.time_ms;
+        else
+          s_accumulated_gpu_timer_scopes.push_back({scope.name, scope.time_ms});
+      }
     }
+
+    // Track the CPU-side cost of getting a frame out (estimate used to aim the pre-present sleep),
+    // and the present-to-present interval for the pacing display in the overlay.
+    const Common::Timer::Value present_end = Common::Timer::GetCurrentValue();
+    const float present_duration =
+      static_cast<float>(Common::Timer::ConvertValueToMilliseconds(present_end - present_start));
+    s_present_duration_estimate_ms = (s_present_duration_estimate_ms == 0.0f) ?
+                                       present_duration :
+                                       ((s_present_duration_estimate_ms * 0.9f) + (present_duration * 0.1f));
+    if (s_last_present_time != 0)
+    {
+      s_present_time_history[s_present_time_history_pos] =
+        static_cast<float>(Common::Timer::ConvertValueToMilliseconds(present_end - s_last_present_time));
+      s_present_time_history_pos = (s_present_time_history_pos + 1) % NUM_FRAME_TIME_SAMPLES;
+    }
+    s_last_present_time = present_end;
   }
   else
   {
@@ -4709,6 +5467,11 @@ bool System::PresentDisplay(bool allow_skip_present)
 
   ImGuiManager::NewFrame();
 
+#if ENABLE_FRAME_PROFILER
+  if (g_settings.debugging.show_frame_profiler)
+    FrameProfiler::AddTime(FrameProfiler::Category::Present, FrameProfiler::GetTimestamp() - profile_start);
+#endif
+
   return do_present;
 }
 
@@ -6,9 +6,11 @@
 #include "settings.h"
 #include "timing_event.h"
 #include "types.h"
+#include <array>
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 class ByteStream;
 class CDImage;
@@ -227,6 +229,34 @@ float GetGPUAverageTime();
 const FrameTimeHistory& GetFrameTimeHistory();
 u32 GetFrameTimeHistoryPos();
 
+/// Time between successive presents in milliseconds, i.e. the cadence the display actually sees.
+/// Same ring buffer layout as the frame time history.
+const FrameTimeHistory& GetPresentTimeHistory();
+u32 GetPresentTimeHistoryPos();
+
+/// Per-pass GPU times from the device's named timer scopes, averaged over the last performance
+/// counter update interval. Empty when GPU timing is disabled or the backend lacks support.
+struct GPUTimerScope
+{
+  const char* name;
+  float time_ms;
+};
+const std::vector<GPUTimerScope>& GetGPUTimerScopes();
+
+/// Per-subsystem byte/time breakdown of the most recent DoState() call, in serialization order.
+/// Only fully populated after a complete (non-failed) serialization.
+struct StateSectionStats
+{
+  const char* name;
+  u32 bytes;
+  float time_ms;
+};
+static constexpr u32 NUM_STATE_SECTIONS = 14;
+const std::array<StateSectionStats, NUM_STATE_SECTIONS>& GetStateSerializationStats();
+
+/// Serializes a throwaway memory state and logs the per-subsystem breakdown.
+void LogStateSerializationStats();
+
 /// Loads global settings (i.e. EmuConfig).
 void LoadSettings(bool display_osd_messages);
 void SetDefaultSettings(SettingsInterface& si);
@@ -244,16 +274,24 @@ void ResetSystem();
 /// Loads state from the specified filename.
 bool LoadState(const char* filename);
 bool SaveState(const char* filename, bool backup_existing_save);
+
+/// Saves a delta state containing only the differences against a previously-saved full state.
+/// The base must be for the same game and state version; LoadState() applies the patch
+/// transparently, looking the base up by filename in the delta's directory.
+bool SaveStateDelta(const char* filename, const char* base_filename);
 bool SaveResumeState();
 
 /// Memory save states - only for internal use.
 struct MemorySaveState
 {
+  // GPU-resident VRAM snapshot for the hardware renderers; saved/restored with device-side
+  // copies, so high-resolution VRAM never round-trips through CPU memory.
   std::unique_ptr<GPUTexture> vram_texture;
-  std::unique_ptr<GrowableMemoryByteStream> state_stream;
+  std::unique_ptr<u8[]> state_data;
+  size_t state_size = 0;
 };
 bool SaveMemoryState(MemorySaveState* mss);
-bool LoadMemoryState(const MemorySaveState& mss);
+bool LoadMemoryState(const MemorySaveState& mss, bool update_display = true);
 bool LoadStateFromStream(ByteStream* stream, bool update_display, bool ignore_media = false);
 bool SaveStateToStream(ByteStream* state, u32 screenshot_size = 256, u32 compression_method = 0,
                        bool ignore_media = false);
@@ -349,6 +387,10 @@ void CheckForSettingsChanges(const Settings& old_settings);
 /// Updates throttler.
 void UpdateSpeedLimiterState();
 
+/// Applies the configured core affinity and scheduling priority to the calling thread. Called on
+/// the emulation-critical threads (CPU and GPU backend) at startup and on settings changes.
+void ApplyThreadQoSToCallingThread();
+
 /// Toggles fast forward state.
 bool IsFastForwardEnabled();
 void SetFastForwardEnabled(bool enabled);
@@ -408,6 +450,10 @@ void UpdateVolume();
 bool IsDumpingAudio();
 
 /// Starts dumping audio to a file. If no file name is provided, one will be generated automatically.
+/// Starts recording an input movie. If no filename is provided, one will be generated automatically
+/// in the dumps directory. Use InputMovie::Stop() to finish recording.
+bool StartRecordingInputMovie(const char* filename = nullptr);
+
 bool StartDumpingAudio(const char* filename = nullptr);
 
 /// Stops dumping audio to file if it has been started.
@@ -2,11 +2,14 @@
 // SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
 
 #include "texture_replacements.h"
+#include "common/byte_stream.h"
 #include "common/file_system.h"
 #include "common/log.h"
 #include "common/path.h"
 #include "common/platform.h"
 #include "common/string_util.h"
+#include "common/thirdparty/thread_pool.h"
+#include "common/threading.h"
 #include "common/timer.h"
 #include "fmt/format.h"
 #include "host.h"
@@ -15,11 +18,49 @@
 #if defined(CPU_X86) || defined(CPU_X64)
 #include "xxh_x86dispatch.h"
 #endif
+#include <algorithm>
 #include <cinttypes>
+#include <future>
+#include <optional>
 Log_SetChannel(TextureReplacements);
 
 TextureReplacements g_texture_replacements;
 
+static constexpr u32 TEXTURE_LIST_CACHE_SIGNATURE = 0x43525854; // 'TXRC'
+static constexpr u32 TEXTURE_LIST_CACHE_VERSION = 1;
+
+static std::optional<u64> GetTextureDirectorySignature(const std::string& dir)
+{
+  FILESYSTEM_STAT_DATA sd;
+  if (!FileSystem::StatFile(dir.c_str(), &sd) || !(sd.Attributes & FILESYSTEM_FILE_ATTRIBUTE_DIRECTORY))
+    return std::nullopt;
+
+  XXH64_state_t* state = XXH64_createState();
+  XXH64_reset(state, TEXTURE_LIST_CACHE_SIGNATURE);
+
+  u64 mtime = static_cast<u64>(sd.ModificationTime);
+  XXH64_update(state, &mtime, sizeof(mtime));
+
+  // Adding, removing or renaming a file bumps the mtime of the directory that holds it, so only the
+  // directories need stat'ing, not the ten thousand files inside them.
+  FileSystem::FindResultsArray dirs;
+  FileSystem::FindFiles(dir.c_str(), "*", FILESYSTEM_FIND_FOLDERS | FILESYSTEM_FIND_HIDDEN_FILES |
+                                            FILESYSTEM_FIND_RECURSIVE, &dirs);
+  std::sort(dirs.begin(), dirs.end(), [](const FILESYSTEM_FIND_DATA& lhs, const FILESYSTEM_FIND_DATA& rhs) {
+    return (lhs.FileName < rhs.FileName);
+  });
+  for (const FILESYSTEM_FIND_DATA& fd : dirs)
+  {
+    XXH64_update(state, fd.FileName.data(), fd.FileName.length());
+    mtime = static_cast<u64>(fd.ModificationTime);
+    XXH64_update(state, &mtime, sizeof(mtime));
+  }
+
+  const u64 signature = XXH64_digest(state);
+  XXH64_freeState(state);
+  return signature;
+}
+
 static constexpr u32 VRAMRGBA5551ToRGBA8888(u16 color)
 {
   u8 r = Truncate8(color & 31);
@@ -71,6 +112,11 @@ void TextureReplacements::SetGameID(std::string game_id)
 
 const TextureReplacementTexture* TextureReplacements::GetVRAMWriteReplacement(u32 width, u32 height, const void* pixels)
 {
+  // Skip hashing the write when there's nothing loaded it could match. FMV-heavy games
+  // stream full frames through here, and hashing each of them only to miss adds up.
+  if (m_vram_write_replacements.empty())
+    return nullptr;
+
   const TextureReplacementHash hash = GetVRAMWriteHash(width, height, pixels);
 
   const auto it = m_vram_write_replacements.find(hash);
@@ -231,6 +277,20 @@ bool TextureReplacements::ParseReplacementFilename(const std::string& filename,
 
 void TextureReplacements::FindTextures(const std::string& dir)
 {
+  // Enumerating a large pack is mostly filename parsing and per-file metadata reads. The parsed
+  // list is cached together with a signature over the directory tree's modification times, so as
+  // long as nothing was added, removed or renamed, game start costs a few directory stats and one
+  // sequential file read.
+  const std::optional<u64> dir_signature = GetTextureDirectorySignature(dir);
+  const std::string cache_filename = GetListCacheFilename();
+  if (dir_signature.has_value() && !cache_filename.empty() &&
+      LoadTextureListFromCache(cache_filename, dir_signature.value()))
+  {
+    Log_InfoPrintf("Found %zu cached replacement VRAM writes for '%s'", m_vram_write_replacements.size(),
+                   m_game_id.c_str());
+    return;
+  }
+
   FileSystem::FindResultsArray files;
   FileSystem::FindFiles(dir.c_str(), "*", FILESYSTEM_FIND_FILES | FILESYSTEM_FIND_RECURSIVE, &files);
 
@@ -262,6 +322,87 @@ void TextureReplacements::FindTextures(const std::string& dir)
   }
 
   Log_InfoPrintf("Found %zu replacement VRAM writes for '%s'", m_vram_write_replacements.size(), m_game_id.c_str());
+
+  if (dir_signature.has_value() && !cache_filename.empty())
+    SaveTextureListToCache(cache_filename, dir_signature.value());
+}
+
+std::string TextureReplacements::GetListCacheFilename() const
+{
+  if (m_game_id.empty())
+    return {};
+
+  return Path::Combine(EmuFolders::Cache,
+                       fmt::format("texture_replacements_{}.cache", Path::SanitizeFileName(m_game_id)));
+}
+
+bool TextureReplacements::LoadTextureListFromCache(const std::string& filename, u64 directory_signature)
+{
+  std::unique_ptr<ByteStream> stream =
+    ByteStream::OpenFile(filename.c_str(), BYTESTREAM_OPEN_READ | BYTESTREAM_OPEN_STREAMED);
+  if (!stream)
+    return false;
+
+  u32 file_signature, file_version, count;
+  u64 cached_dir_signature;
+  if (!stream->ReadU32(&file_signature) || file_signature != TEXTURE_LIST_CACHE_SIGNATURE ||
+      !stream->ReadU32(&file_version) || file_version != TEXTURE_LIST_CACHE_VERSION ||
+      !stream->ReadU64(&cached_dir_signature) || cached_dir_signature != directory_signature ||
+      !stream->ReadU32(&count))
+  {
+    return false;
+  }
+
+  VRAMWriteReplacementMap new_map;
+  new_map.reserve(count);
+  for (u32 i = 0; i < count; i++)
+  {
+    TextureReplacementHash hash;
+    std::string entry_filename;
+    if (!stream->ReadU64(&hash.low) || !stream->ReadU64(&hash.high) || !stream->ReadSizePrefixedString(&entry_filename))
+    {
+      Log_WarningPrintf("Texture replacement list cache for '%s' is corrupted", m_game_id.c_str());
+      return false;
+    }
+
+    new_map.emplace(hash, std::move(entry_filename));
+  }
+
+  m_vram_write_replacements = std::move(new_map);
+  return true;
+}
+
+void TextureReplacements::SaveTextureListToCache(const std::string& filename, u64 directory_signature) const
+{
+  std::unique_ptr<ByteStream> stream = ByteStream::OpenFile(
+    filename.c_str(), BYTESTREAM_OPEN_CREATE | BYTESTREAM_OPEN_TRUNCATE | BYTESTREAM_OPEN_WRITE |
+                        BYTESTREAM_OPEN_ATOMIC_UPDATE);
+  if (!stream)
+  {
+    Log_WarningPrintf("Failed to open texture replacement list cache '%s' for writing", filename.c_str());
+    return;
+  }
+
+  bool result = stream->WriteU32(TEXTURE_LIST_CACHE_SIGNATURE) && stream->WriteU32(TEXTURE_LIST_CACHE_VERSION) &&
+                stream->WriteU64(directory_signature) &&
+                stream->WriteU32(static_cast<u32>(m_vram_write_replacements.size()));
+  for (const auto& it : m_vram_write_replacements)
+  {
+    if (!result)
+      break;
+
+    result = stream->WriteU64(it.first.low) && stream->WriteU64(it.first.high) &&
+             stream->WriteSizePrefixedString(it.second);
+  }
+
+  if (result)
+    result = stream->Commit();
+
+  if (!result)
+  {
+    Log_WarningPrintf("Failed to write texture replacement list cache '%s'", filename.c_str());
+    stream->Discard();
+  }
 }
 
 const TextureReplacementTexture* TextureReplacements::LoadTexture(const std::string& filename)
@@ -298,11 +439,38 @@ void TextureReplacements::PreloadTextures()
     last_update_time.Reset();                                                                                          \
   }
 
+  // Decode on the shared worker pool - image decompression dominates preload time for large
+  // packs, and each file is independent. The cache itself is only touched from this thread.
+  std::vector<std::pair<const std::string*, std::future<Common::RGBA8Image>>> pending_images;
+  pending_images.reserve(m_vram_write_replacements.size());
+
+  cb::ThreadPool& pool = Threading::GetSharedThreadPool();
   for (const auto& it : m_vram_write_replacements)
+  {
+    if (m_texture_cache.find(it.second) != m_texture_cache.end())
+    {
+      num_textures_loaded++;
+      continue;
+    }
+
+    pending_images.emplace_back(&it.second, pool.ScheduleAndGetFuture([filename = &it.second]() {
+      Common::RGBA8Image image;
+      if (!image.LoadFromFile(filename->c_str()))
+        Log_ErrorPrintf("Failed to load '%s'", filename->c_str());
+      return image;
+    }));
+  }
+
+  for (auto& [filename, future] : pending_images)
   {
     UPDATE_PROGRESS();
 
-    LoadTexture(it.second);
+    Common::RGBA8Image image = future.get();
+    if (image.IsValid())
+    {
+      Log_InfoPrintf("Loaded '%s': %ux%u", filename->c_str(), image.GetWidth(), image.GetHeight());
+      m_texture_cache.emplace(*filename, std::move(image));
+    }
     num_textures_loaded++;
   }
 
@@ -79,6 +79,10 @@ private:
 
   void FindTextures(const std::string& dir);
 
+  std::string GetListCacheFilename() const;
+  bool LoadTextureListFromCache(const std::string& filename, u64 directory_signature);
+  void SaveTextureListToCache(const std::string& filename, u64 directory_signature) const;
+
   const TextureReplacementTexture* LoadTexture(const std::string& filename);
   void PreloadTextures();
   void PurgeUnreferencedTexturesFromCache();
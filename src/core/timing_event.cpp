@@ -6,22 +6,55 @@
 #include "common/log.h"
 #include "cpu_core.h"
 #include "cpu_core_private.h"
+#include "frame_profiler.h"
+#include "settings.h"
 #include "system.h"
 #include "util/state_wrapper.h"
+#include <algorithm>
 Log_SetChannel(TimingEvents);
 
 namespace TimingEvents {
 
-static TimingEvent* s_active_events_head;
-static TimingEvent* s_active_events_tail;
+// Active events are stored in a calendar queue instead of a sorted list, so rescheduling an event
+// is a constant-time bucket insertion rather than an O(n) insertion walk. Each bucket covers
+// 2^BUCKET_SHIFT ticks, giving the wheel a full rotation of roughly one frame. Events scheduled
+// further out than a rotation share buckets with nearer events and are skipped over until the
+// wheel comes back around to them.
+enum : u32
+{
+  BUCKET_SHIFT = 13,
+  NUM_BUCKETS = 64,
+  BUCKET_INDEX_MASK = NUM_BUCKETS - 1,
+  BUCKET_SIZE = 1u << BUCKET_SHIFT,
+};
+
+static TimingEvent* s_event_buckets[NUM_BUCKETS];
 static TimingEvent* s_current_event = nullptr;
 static u32 s_active_event_count = 0;
-static u32 s_global_tick_counter = 0;
+
+// The tick counter is tracked as a 64-bit monotonic value internally, so event deadlines can be
+// stored as absolute times without having to worry about wraparound. The public counter is the
+// 32-bit distance from the last reset, which wraps the same way it always has.
+static u64 s_global_tick_counter = 0;
+static u64 s_tick_counter_base = 0;
+static u64 s_next_event_time = 0;
 static bool s_frame_done = false;
 
+ALWAYS_INLINE static u32 GetBucketIndex(u64 deadline)
+{
+  return static_cast<u32>(deadline >> BUCKET_SHIFT) & BUCKET_INDEX_MASK;
+}
+
+ALWAYS_INLINE static u64 AddTicks(u64 base, TickCount ticks)
+{
+  // Clamp instead of wrapping below zero, otherwise the deadline would end up in the far future.
+  const s64 result = static_cast<s64>(base) + ticks;
+  return (result < 0) ? 0 : static_cast<u64>(result);
+}
+
 u32 GetGlobalTickCounter()
 {
-  return s_global_tick_counter;
+  return static_cast<u32>(s_global_tick_counter - s_tick_counter_base);
 }
 
 void Initialize()
@@ -31,7 +64,9 @@ void Initialize()
 
 void Reset()
 {
-  s_global_tick_counter = 0;
+  // Event times are absolute, so instead of rewinding the clock (which would invalidate the
+  // deadline of every active event), rebase the value the public counter is reported against.
+  s_tick_counter_base = s_global_tick_counter;
 }
 
 void Shutdown()
@@ -52,195 +87,149 @@ std::unique_ptr<TimingEvent> CreateTimingEvent(std::string name, TickCount perio
 
 void UpdateCPUDowncount()
 {
-  CPU::g_state.downcount = CPU::HasPendingInterrupt() ? 0 : s_active_events_head->GetDowncount();
+  CPU::g_state.downcount =
+    CPU::HasPendingInterrupt() ? 0 : static_cast<TickCount>(s_next_event_time - s_global_tick_counter);
 }
 
-TimingEvent** GetHeadEventPtr()
+static void LinkEvent(TimingEvent* event)
 {
-  return &s_active_events_head;
+  // Late events get filed under the current time, so the forward scan always finds them first.
+  const u32 bucket = GetBucketIndex(std::max(event->m_deadline, s_global_tick_counter));
+  TimingEvent*& head = s_event_buckets[bucket];
+  event->m_bucket = bucket;
+  event->prev = nullptr;
+  event->next = head;
+  if (head)
+    head->prev = event;
+  head = event;
 }
 
-static void SortEvent(TimingEvent* event)
+static void UnlinkEvent(TimingEvent* event)
 {
-  const TickCount event_downcount = event->m_downcount;
+  if (event->next)
+    event->next->prev = event->prev;
+  if (event->prev)
+    event->prev->next = event->next;
+  else
+    s_event_buckets[event->m_bucket] = event->next;
 
-  if (event->prev && event->prev->m_downcount > event_downcount)
-  {
-    // move backwards
-    TimingEvent* current = event->prev;
-    while (current && current->m_downcount > event_downcount)
-      current = current->prev;
-
-    // unlink
-    if (event->prev)
-      event->prev->next = event->next;
-    else
-      s_active_events_head = event->next;
-    if (event->next)
-      event->next->prev = event->prev;
-    else
-      s_active_events_tail = event->prev;
+  event->prev = nullptr;
+  event->next = nullptr;
+}
 
-    // insert after current
-    if (current)
-    {
-      event->next = current->next;
-      if (current->next)
-        current->next->prev = event;
-      else
-        s_active_events_tail = event;
-
-      event->prev = current;
-      current->next = event;
-    }
-    else
+static TimingEvent* FindEarliestEvent()
+{
+  // Walk the wheel forwards from the current time. The first bucket containing an event which
+  // falls inside that bucket's current window holds the nearest deadline; events from later
+  // rotations only matter when an entire rotation is empty.
+  TimingEvent* earliest = nullptr;
+  u64 window_end = ((s_global_tick_counter >> BUCKET_SHIFT) + 1) << BUCKET_SHIFT;
+  u32 bucket = GetBucketIndex(s_global_tick_counter);
+  for (u32 i = 0; i < NUM_BUCKETS; i++)
+  {
+    bool found_in_window = false;
+    for (TimingEvent* event = s_event_buckets[bucket]; event; event = event->next)
     {
-      // insert at front
-      DebugAssert(s_active_events_head);
-      s_active_events_head->prev = event;
-      event->prev = nullptr;
-      event->next = s_active_events_head;
-      s_active_events_head = event;
-      UpdateCPUDowncount();
+      if (!earliest || event->m_deadline < earliest->m_deadline)
+        earliest = event;
+      found_in_window |= (event->m_deadline < window_end);
     }
-  }
-  else if (event->next && event_downcount > event->next->m_downcount)
-  {
-    // move forwards
-    TimingEvent* current = event->next;
-    while (current && event_downcount > current->m_downcount)
-      current = current->next;
-
-    // unlink
-    if (event->prev)
-      event->prev->next = event->next;
-    else
-      s_active_events_head = event->next;
-    if (event->next)
-      event->next->prev = event->prev;
-    else
-      s_active_events_tail = event->prev;
+    if (found_in_window)
+      break;
 
-    // insert before current
-    if (current)
-    {
-      event->next = current;
-      event->prev = current->prev;
+    bucket = (bucket + 1) & BUCKET_INDEX_MASK;
+    window_end += BUCKET_SIZE;
+  }
 
-      if (current->prev)
-        current->prev->next = event;
-      else
-        s_active_events_head = event;
+  return earliest;
+}
 
-      current->prev = event;
-    }
-    else
-    {
-      // insert at back
-      DebugAssert(s_active_events_tail);
-      s_active_events_tail->next = event;
-      event->next = nullptr;
-      event->prev = s_active_events_tail;
-      s_active_events_tail = event;
-    }
-  }
+static void UpdateNextEventTime()
+{
+  const TimingEvent* event = FindEarliestEvent();
+  if (event)
+    s_next_event_time = event->m_deadline;
 }
 
 static void AddActiveEvent(TimingEvent* event)
 {
   DebugAssert(!event->prev && !event->next);
   s_active_event_count++;
+  LinkEvent(event);
 
-  TimingEvent* current = nullptr;
-  TimingEvent* next = s_active_events_head;
-  while (next && event->m_downcount > next->m_downcount)
-  {
-    current = next;
-    next = next->next;
-  }
+  // Skip the next-event bookkeeping while events are running; RunEvents() rescans once the
+  // current batch completes.
+  if (s_current_event)
+    return;
 
-  if (!next)
-  {
-    // new tail
-    event->prev = s_active_events_tail;
-    if (s_active_events_tail)
-    {
-      s_active_events_tail->next = event;
-      s_active_events_tail = event;
-    }
-    else
-    {
-      // first event
-      s_active_events_tail = event;
-      s_active_events_head = event;
-      UpdateCPUDowncount();
-    }
-  }
-  else if (!current)
+  if (s_active_event_count == 1 || event->m_deadline < s_next_event_time)
   {
-    // new head
-    event->next = s_active_events_head;
-    s_active_events_head->prev = event;
-    s_active_events_head = event;
+    s_next_event_time = event->m_deadline;
     UpdateCPUDowncount();
   }
-  else
-  {
-    // inbetween current < event > next
-    event->prev = current;
-    event->next = next;
-    current->next = event;
-    next->prev = event;
-  }
 }
 
 static void RemoveActiveEvent(TimingEvent* event)
 {
   DebugAssert(s_active_event_count > 0);
+  UnlinkEvent(event);
+  s_active_event_count--;
 
-  if (event->next)
+  if (s_current_event)
+    return;
+
+  if (s_active_event_count > 0 && event->m_deadline <= s_next_event_time)
   {
-    event->next->prev = event->prev;
+    UpdateNextEventTime();
+    UpdateCPUDowncount();
   }
-  else
+}
+
+static void RepositionEvent(TimingEvent* event, u64 new_deadline)
+{
+  const u64 old_deadline = event->m_deadline;
+  event->m_deadline = new_deadline;
+  if (GetBucketIndex(std::max(new_deadline, s_global_tick_counter)) != event->m_bucket)
   {
-    s_active_events_tail = event->prev;
+    UnlinkEvent(event);
+    LinkEvent(event);
   }
 
-  if (event->prev)
+  if (s_current_event)
+    return;
+
+  if (new_deadline < s_next_event_time)
   {
-    event->prev->next = event->next;
+    s_next_event_time = new_deadline;
+    UpdateCPUDowncount();
   }
-  else
+  else if (old_deadline <= s_next_event_time && new_deadline > s_next_event_time)
   {
-    s_active_events_head = event->next;
-    if (s_active_events_head)
-      UpdateCPUDowncount();
+    // This may have been the nearest event, so we have to look for the new one.
+    UpdateNextEventTime();
+    UpdateCPUDowncount();
   }
-
-  event->prev = nullptr;
-  event->next = nullptr;
-
-  s_active_event_count--;
 }
 
-static void SortEvents()
+static void RebuildBuckets()
 {
   std::vector<TimingEvent*> events;
   events.reserve(s_active_event_count);
 
-  TimingEvent* next = s_active_events_head;
-  while (next)
+  for (u32 i = 0; i < NUM_BUCKETS; i++)
   {
-    TimingEvent* current = next;
-    events.push_back(current);
-    next = current->next;
-    current->prev = nullptr;
-    current->next = nullptr;
+    for (TimingEvent* event = s_event_buckets[i]; event;)
+    {
+      TimingEvent* next = event->next;
+      event->prev = nullptr;
+      event->next = nullptr;
+      events.push_back(event);
+      event = next;
+    }
+
+    s_event_buckets[i] = nullptr;
   }
 
-  s_active_events_head = nullptr;
-  s_active_events_tail = nullptr;
   s_active_event_count = 0;
 
   for (TimingEvent* event : events)
@@ -249,10 +238,13 @@ static void SortEvents()
 
 static TimingEvent* FindActiveEvent(const char* name)
 {
-  for (TimingEvent* event = s_active_events_head; event; event = event->next)
+  for (u32 i = 0; i < NUM_BUCKETS; i++)
   {
-    if (event->GetName().compare(name) == 0)
-      return event;
+    for (TimingEvent* event = s_event_buckets[i]; event; event = event->next)
+    {
+      if (event->GetName().compare(name) == 0)
+        return event;
+    }
   }
 
   return nullptr;
@@ -278,46 +270,51 @@ void RunEvents()
     if (CPU::HasPendingInterrupt())
       CPU::DispatchInterrupt();
 
-    TickCount pending_ticks = CPU::GetPendingTicks();
-    if (pending_ticks >= s_active_events_head->GetDowncount())
+    const TickCount pending_ticks = CPU::GetPendingTicks();
+    if (pending_ticks >= static_cast<TickCount>(s_next_event_time - s_global_tick_counter))
     {
       CPU::ResetPendingTicks();
+      const u64 target_time = AddTicks(s_global_tick_counter, pending_ticks);
 
-      do
+      TimingEvent* event;
+      while ((event = FindEarliestEvent()) && event->m_deadline <= target_time)
       {
-        const TickCount time = std::min(pending_ticks, s_active_events_head->GetDowncount());
-        s_global_tick_counter += static_cast<u32>(time);
-        pending_ticks -= time;
+        // Advance the clock to the event deadline. Late events don't move time backwards; the
+        // late ticks are reported to the callback instead.
+        s_global_tick_counter = std::max(s_global_tick_counter, event->m_deadline);
+        s_current_event = event;
+
+        const TickCount ticks_late = static_cast<TickCount>(s_global_tick_counter - event->m_deadline);
+        const TickCount ticks_to_execute = static_cast<TickCount>(s_global_tick_counter - event->m_last_run_time);
 
-        // Apply downcount to all events.
-        // This will result in a negative downcount for those events which are late.
-        for (TimingEvent* event = s_active_events_head; event; event = event->next)
+        // Factor late time into the time for the next invocation.
+        event->m_deadline = AddTicks(event->m_deadline, event->m_interval);
+        event->m_last_run_time = s_global_tick_counter;
+
+        // The cycles_late is only an indicator, it doesn't modify the cycles to execute.
+#if ENABLE_FRAME_PROFILER
+        if (g_settings.debugging.show_frame_profiler)
         {
-          event->m_downcount -= time;
-          event->m_time_since_last_run += time;
+          const u64 start_timestamp = FrameProfiler::GetTimestamp();
+          event->m_callback(event->m_callback_param, ticks_to_execute, ticks_late);
+          FrameProfiler::AddTime(static_cast<FrameProfiler::Category>(event->m_profiler_category),
+                                 FrameProfiler::GetTimestamp() - start_timestamp);
         }
-
-        // Now we can actually run the callbacks.
-        while (s_active_events_head->m_downcount <= 0)
+        else
         {
-          // move it to the end, since that'll likely be its new position
-          TimingEvent* event = s_active_events_head;
-          s_current_event = event;
-
-          // Factor late time into the time for the next invocation.
-          const TickCount ticks_late = -event->m_downcount;
-          const TickCount ticks_to_execute = event->m_time_since_last_run;
-          event->m_downcount += event->m_interval;
-          event->m_time_since_last_run = 0;
-
-          // The cycles_late is only an indicator, it doesn't modify the cycles to execute.
           event->m_callback(event->m_callback_param, ticks_to_execute, ticks_late);
-          if (event->m_active)
-            SortEvent(event);
         }
-      } while (pending_ticks > 0);
+#else
+        event->m_callback(event->m_callback_param, ticks_to_execute, ticks_late);
+#endif
+        if (event->m_active)
+          RepositionEvent(event, event->m_deadline);
+      }
 
+      s_global_tick_counter = target_time;
       s_current_event = nullptr;
+
+      UpdateNextEventTime();
     }
 
     if (s_frame_done)
@@ -332,10 +329,14 @@ void RunEvents()
 
 bool DoState(StateWrapper& sw)
 {
-  sw.Do(&s_global_tick_counter);
+  u32 global_tick_counter = GetGlobalTickCounter();
+  sw.Do(&global_tick_counter);
 
   if (sw.IsReading())
   {
+    // Rebase the monotonic clock so the public counter matches the loaded value.
+    s_tick_counter_base = s_global_tick_counter - global_tick_counter;
+
     // Load timestamps for the clock events.
     // Any oneshot events should be recreated by the load state method, so we can fix up their times here.
     u32 event_count = 0;
@@ -360,9 +361,9 @@ bool DoState(StateWrapper& sw)
         continue;
       }
 
-      // Using reschedule is safe here since we call sort afterwards.
-      event->m_downcount = downcount;
-      event->m_time_since_last_run = time_since_last_run;
+      // The saved times are relative to the tick counter at save time, so they apply unchanged.
+      event->m_deadline = AddTicks(s_global_tick_counter, downcount);
+      event->m_last_run_time = AddTicks(s_global_tick_counter, -time_since_last_run);
       event->m_period = period;
       event->m_interval = interval;
     }
@@ -374,20 +375,26 @@ bool DoState(StateWrapper& sw)
     }
 
     Log_DebugPrintf("Loaded %u events from save state.", event_count);
-    SortEvents();
+    RebuildBuckets();
   }
   else
   {
 
     sw.Do(&s_active_event_count);
 
-    for (TimingEvent* event = s_active_events_head; event; event = event->next)
+    for (u32 i = 0; i < NUM_BUCKETS; i++)
     {
-      sw.Do(&event->m_name);
-      sw.Do(&event->m_downcount);
-      sw.Do(&event->m_time_since_last_run);
-      sw.Do(&event->m_period);
-      sw.Do(&event->m_interval);
+      for (TimingEvent* event = s_event_buckets[i]; event; event = event->next)
+      {
+        sw.Do(&event->m_name);
+
+        TickCount downcount = static_cast<TickCount>(event->m_deadline - s_global_tick_counter);
+        TickCount time_since_last_run = static_cast<TickCount>(s_global_tick_counter - event->m_last_run_time);
+        sw.Do(&downcount);
+        sw.Do(&time_since_last_run);
+        sw.Do(&event->m_period);
+        sw.Do(&event->m_interval);
+      }
     }
 
     Log_DebugPrintf("Wrote %u events to save state.", s_active_event_count);
@@ -403,6 +410,7 @@ TimingEvent::TimingEvent(std::string name, TickCount period, TickCount interval,
   : m_callback(callback), m_callback_param(callback_param), m_downcount(interval), m_time_since_last_run(0),
     m_period(period), m_interval(interval), m_name(std::move(name))
 {
+  m_profiler_category = static_cast<u8>(FrameProfiler::GetCategoryForEventName(m_name));
 }
 
 TimingEvent::~TimingEvent()
@@ -411,14 +419,30 @@ TimingEvent::~TimingEvent()
     TimingEvents::RemoveActiveEvent(this);
 }
 
+TickCount TimingEvent::GetDowncount() const
+{
+  if (!m_active)
+    return m_downcount;
+
+  return static_cast<TickCount>(m_deadline - TimingEvents::s_global_tick_counter);
+}
+
 TickCount TimingEvent::GetTicksSinceLastExecution() const
 {
-  return CPU::GetPendingTicks() + m_time_since_last_run;
+  if (!m_active)
+    return CPU::GetPendingTicks() + m_time_since_last_run;
+
+  const u64 now = TimingEvents::AddTicks(TimingEvents::s_global_tick_counter, CPU::GetPendingTicks());
+  return static_cast<TickCount>(now - m_last_run_time);
 }
 
 TickCount TimingEvent::GetTicksUntilNextExecution() const
 {
-  return std::max(m_downcount - CPU::GetPendingTicks(), static_cast<TickCount>(0));
+  if (!m_active)
+    return std::max(m_downcount - CPU::GetPendingTicks(), static_cast<TickCount>(0));
+
+  const u64 now = TimingEvents::AddTicks(TimingEvents::s_global_tick_counter, CPU::GetPendingTicks());
+  return static_cast<TickCount>(std::max<s64>(static_cast<s64>(m_deadline - now), 0));
 }
 
 void TimingEvent::Delay(TickCount ticks)
@@ -429,36 +453,31 @@ void TimingEvent::Delay(TickCount ticks)
     return;
   }
 
-  m_downcount += ticks;
-
   DebugAssert(TimingEvents::s_current_event != this);
-  TimingEvents::SortEvent(this);
-  if (TimingEvents::s_active_events_head == this)
-    TimingEvents::UpdateCPUDowncount();
+  TimingEvents::RepositionEvent(this, TimingEvents::AddTicks(m_deadline, ticks));
 }
 
 void TimingEvent::Schedule(TickCount ticks)
 {
   const TickCount pending_ticks = CPU::GetPendingTicks();
-  m_downcount = pending_ticks + ticks;
+  const u64 new_deadline = TimingEvents::AddTicks(TimingEvents::s_global_tick_counter, pending_ticks + ticks);
 
   if (!m_active)
   {
     // Event is going active, so we want it to only execute ticks from the current timestamp.
-    m_time_since_last_run = -pending_ticks;
+    m_last_run_time = TimingEvents::AddTicks(TimingEvents::s_global_tick_counter, pending_ticks);
+    m_deadline = new_deadline;
     m_active = true;
     TimingEvents::AddActiveEvent(this);
   }
   else
   {
-    // Event is already active, so we leave the time since last run alone, and just modify the downcount.
-    // If this is a call from an IO handler for example, re-sort the event queue.
+    // Event is already active, so we leave the last run time alone, and just modify the deadline.
+    // If this is a call from an IO handler for example, re-bucket the event.
     if (TimingEvents::s_current_event != this)
-    {
-      TimingEvents::SortEvent(this);
-      if (TimingEvents::s_active_events_head == this)
-        TimingEvents::UpdateCPUDowncount();
-    }
+      TimingEvents::RepositionEvent(this, new_deadline);
+    else
+      m_deadline = new_deadline;
   }
 }
 
@@ -480,14 +499,12 @@ void TimingEvent::Reset()
   if (!m_active)
     return;
 
-  m_downcount = m_interval;
-  m_time_since_last_run = 0;
+  const u64 new_deadline = TimingEvents::AddTicks(TimingEvents::s_global_tick_counter, m_interval);
+  m_last_run_time = TimingEvents::s_global_tick_counter;
   if (TimingEvents::s_current_event != this)
-  {
-    TimingEvents::SortEvent(this);
-    if (TimingEvents::s_active_events_head == this)
-      TimingEvents::UpdateCPUDowncount();
-  }
+    TimingEvents::RepositionEvent(this, new_deadline);
+  else
+    m_deadline = new_deadline;
 }
 
 void TimingEvent::InvokeEarly(bool force /* = false */)
@@ -496,19 +513,19 @@ void TimingEvent::InvokeEarly(bool force /* = false */)
     return;
 
   const TickCount pending_ticks = CPU::GetPendingTicks();
-  const TickCount ticks_to_execute = m_time_since_last_run + pending_ticks;
+  const u64 now = TimingEvents::AddTicks(TimingEvents::s_global_tick_counter, pending_ticks);
+  const TickCount ticks_to_execute = static_cast<TickCount>(now - m_last_run_time);
   if ((!force && ticks_to_execute < m_period) || ticks_to_execute <= 0)
     return;
 
-  m_downcount = pending_ticks + m_interval;
-  m_time_since_last_run -= ticks_to_execute;
+  m_deadline = TimingEvents::AddTicks(now, m_interval);
+  m_last_run_time = now;
   m_callback(m_callback_param, ticks_to_execute, 0);
 
-  // Since we've changed the downcount, we need to re-sort the events.
+  // Since we've changed the deadline, we need to re-bucket the event.
   DebugAssert(TimingEvents::s_current_event != this);
-  TimingEvents::SortEvent(this);
-  if (TimingEvents::s_active_events_head == this)
-    TimingEvents::UpdateCPUDowncount();
+  if (m_active)
+    TimingEvents::RepositionEvent(this, m_deadline);
 }
 
 void TimingEvent::Activate()
@@ -518,8 +535,9 @@ void TimingEvent::Activate()
 
   // leave the downcount intact
   const TickCount pending_ticks = CPU::GetPendingTicks();
-  m_downcount += pending_ticks;
-  m_time_since_last_run -= pending_ticks;
+  const u64 now = TimingEvents::AddTicks(TimingEvents::s_global_tick_counter, pending_ticks);
+  m_deadline = TimingEvents::AddTicks(now, m_downcount);
+  m_last_run_time = TimingEvents::AddTicks(now, -m_time_since_last_run);
 
   m_active = true;
   TimingEvents::AddActiveEvent(this);
@@ -531,8 +549,9 @@ void TimingEvent::Deactivate()
     return;
 
   const TickCount pending_ticks = CPU::GetPendingTicks();
-  m_downcount -= pending_ticks;
-  m_time_since_last_run += pending_ticks;
+  const u64 now = TimingEvents::AddTicks(TimingEvents::s_global_tick_counter, pending_ticks);
+  m_downcount = static_cast<TickCount>(m_deadline - now);
+  m_time_since_last_run = static_cast<TickCount>(now - m_last_run_time);
 
   m_active = false;
   TimingEvents::RemoveActiveEvent(this);
@@ -27,7 +27,9 @@ public:
   // Returns the number of ticks between each event.
   ALWAYS_INLINE TickCount GetPeriod() const { return m_period; }
   ALWAYS_INLINE TickCount GetInterval() const { return m_interval; }
-  ALWAYS_INLINE TickCount GetDowncount() const { return m_downcount; }
+
+  // Returns the number of ticks until the event fires, relative to the last event run.
+  TickCount GetDowncount() const;
 
   // Includes pending time.
   TickCount GetTicksSinceLastExecution() const;
@@ -63,18 +65,30 @@ public:
   void SetInterval(TickCount interval) { m_interval = interval; }
   void SetPeriod(TickCount period) { m_period = period; }
 
+  // Links within the calendar queue bucket the event currently lives in.
   TimingEvent* prev = nullptr;
   TimingEvent* next = nullptr;
 
   TimingEventCallback m_callback;
   void* m_callback_param;
 
+  // Absolute tick of the next and most recent invocation. Only valid while the event is active.
+  u64 m_deadline = 0;
+  u64 m_last_run_time = 0;
+
+  // Downcount and time since the last run, relative to the time of deactivation. Only valid while
+  // the event is inactive; active events track absolute times above.
   TickCount m_downcount;
   TickCount m_time_since_last_run;
+
   TickCount m_period;
   TickCount m_interval;
+  u32 m_bucket = 0;
   bool m_active = false;
 
+  // Frame profiler category, resolved once from the name at construction.
+  u8 m_profiler_category = 0;
+
   std::string m_name;
 };
 
@@ -99,6 +113,4 @@ void RunEvents();
 
 void UpdateCPUDowncount();
 
-TimingEvent** GetHeadEventPtr();
-
 } // namespace TimingEvents
\ No newline at end of file
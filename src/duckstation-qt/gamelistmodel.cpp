@@ -5,12 +5,16 @@
 #include "common/file_system.h"
 #include "common/path.h"
 #include "common/string_util.h"
+#include "core/settings.h"
 #include "core/system.h"
 #include "qthost.h"
 #include "qtutils.h"
 #include <QtConcurrent/QtConcurrent>
+#include <QtCore/QCryptographicHash>
 #include <QtCore/QDate>
 #include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
 #include <QtCore/QFuture>
 #include <QtCore/QFutureWatcher>
 #include <QtGui/QGuiApplication>
@@ -25,6 +29,7 @@ static constexpr int COVER_ART_WIDTH = 512;
 static constexpr int COVER_ART_HEIGHT = 512;
 static constexpr int COVER_ART_SPACING = 32;
 static constexpr int MIN_COVER_CACHE_SIZE = 256;
+static constexpr size_t COVER_CACHE_MEMORY_BUDGET = 256 * 1024 * 1024;
 
 static int DPRScale(int size, float dpr)
 {
@@ -117,6 +122,7 @@ const char* GameListModel::getColumnName(Column col)
 GameListModel::GameListModel(QObject* parent /* = nullptr */)
   : QAbstractTableModel(parent), m_cover_pixmap_cache(MIN_COVER_CACHE_SIZE)
 {
+  m_known_row_count = static_cast<int>(GameList::GetEntryCount());
   loadCommonImages();
   setCoverScale(1.0f);
   setColumnDisplayNames();
@@ -128,6 +134,7 @@ void GameListModel::setCoverScale(float scale)
   if (m_cover_scale == scale)
     return;
 
+  clearPendingCoverLoads();
   m_cover_pixmap_cache.Clear();
   m_cover_scale = scale;
   m_loading_pixmap = QPixmap(getCoverArtWidth(), getCoverArtHeight());
@@ -136,10 +143,19 @@ void GameListModel::setCoverScale(float scale)
 
 void GameListModel::refreshCovers()
 {
+  clearPendingCoverLoads();
   m_cover_pixmap_cache.Clear();
   refresh();
 }
 
+void GameListModel::clearPendingCoverLoads()
+{
+  // Decode tasks already in flight pop from this queue, so clearing it turns them into no-ops; the covers get
+  // re-queued with the new parameters the next time the view asks for them.
+  std::unique_lock lock(m_cover_load_queue_mutex);
+  m_cover_load_queue.clear();
+}
+
 void GameListModel::updateCacheSize(int width, int height)
 {
   // This is a bit conversative, since it doesn't consider padding, but better to be over than under.
@@ -147,7 +163,14 @@ void GameListModel::updateCacheSize(int width, int height)
   const int cover_height = getCoverArtHeight();
   const int num_columns = ((width + (cover_width - 1)) / cover_width);
   const int num_rows = ((height + (cover_height - 1)) / cover_height);
-  m_cover_pixmap_cache.SetMaxCapacity(static_cast<int>(std::max(num_columns * num_rows, MIN_COVER_CACHE_SIZE)));
+
+  // Keep a few screens worth around for scrolling, but no more than the memory budget allows.
+  const float dpr = qApp->devicePixelRatio();
+  const size_t bytes_per_cover =
+    static_cast<size_t>(DPRScale(cover_width, dpr)) * static_cast<size_t>(DPRScale(cover_height, dpr)) * 4;
+  const int budget_capacity = static_cast<int>(std::max<size_t>(COVER_CACHE_MEMORY_BUDGET / bytes_per_cover, 1));
+  m_cover_pixmap_cache.SetMaxCapacity(
+    static_cast<int>(std::min(std::max(num_columns * num_rows * 3, MIN_COVER_CACHE_SIZE), budget_capacity)));
 }
 
 void GameListModel::reloadCommonImages()
@@ -156,20 +179,79 @@ void GameListModel::reloadCommonImages()
   refresh();
 }
 
+QString GameListModel::getCoverThumbnailPath(const std::string& cover_path, float dpr) const
+{
+  const QFileInfo cover_info(QString::fromStdString(cover_path));
+  const QString key = QStringLiteral("%1|%2|%3x%4|%5")
+                        .arg(cover_info.absoluteFilePath())
+                        .arg(cover_info.lastModified().toSecsSinceEpoch())
+                        .arg(getCoverArtWidth())
+                        .arg(getCoverArtHeight())
+                        .arg(dpr);
+  const QByteArray key_hash = QCryptographicHash::hash(key.toUtf8(), QCryptographicHash::Sha1).toHex();
+  return QStringLiteral("%1/covers/%2.png")
+    .arg(QString::fromStdString(EmuFolders::Cache))
+    .arg(QString::fromLatin1(key_hash));
+}
+
 void GameListModel::loadOrGenerateCover(const GameList::Entry* ge)
 {
-  QFuture<QPixmap> future =
-    QtConcurrent::run([this, path = ge->path, title = ge->title, serial = ge->serial]() -> QPixmap {
+  // The task doesn't decode the cover it was queued with, but the most recently requested one. data() only gets
+  // called for visible rows, so when the pool is backed up, the covers still on screen are decoded before the
+  // ones that have been scrolled past.
+  {
+    std::unique_lock lock(m_cover_load_queue_mutex);
+    m_cover_load_queue.push_back(ge->path);
+  }
+
+  QFuture<std::pair<std::string, QPixmap>> future =
+    QtConcurrent::run([this]() -> std::pair<std::string, QPixmap> {
+      std::string path;
+      {
+        std::unique_lock lock(m_cover_load_queue_mutex);
+        if (m_cover_load_queue.empty())
+          return {};
+
+        path = std::move(m_cover_load_queue.back());
+        m_cover_load_queue.pop_back();
+      }
+
+      std::string title;
+      std::string serial;
+      {
+        const auto lock = GameList::GetLock();
+        const GameList::Entry* entry = GameList::GetEntryForPath(path.c_str());
+        if (!entry)
+          return {};
+
+        title = entry->title;
+        serial = entry->serial;
+      }
+
       QPixmap image;
       const std::string cover_path(GameList::GetCoverImagePath(path, serial, title));
       if (!cover_path.empty())
       {
         const float dpr = qApp->devicePixelRatio();
-        image = QPixmap(QString::fromStdString(cover_path));
+
+        // Pre-scaled thumbnails are cached on disk, keyed on the source image's mtime and the target size, so
+        // later browses skip the full-size decode and rescale entirely.
+        const QString thumbnail_path = getCoverThumbnailPath(cover_path, dpr);
+        image = QPixmap(thumbnail_path);
         if (!image.isNull())
         {
           image.setDevicePixelRatio(dpr);
-          resizeAndPadPixmap(&image, getCoverArtWidth(), getCoverArtHeight(), dpr);
+        }
+        else
+        {
+          image = QPixmap(QString::fromStdString(cover_path));
+          if (!image.isNull())
+          {
+            image.setDevicePixelRatio(dpr);
+            resizeAndPadPixmap(&image, getCoverArtWidth(), getCoverArtHeight(), dpr);
+            if (QDir().mkpath(QFileInfo(thumbnail_path).absolutePath()))
+              image.save(thumbnail_path, "PNG");
+          }
         }
       }
 
@@ -177,13 +259,16 @@ void GameListModel::loadOrGenerateCover(const GameList::Entry* ge)
         image =
           createPlaceholderImage(m_placeholder_pixmap, getCoverArtWidth(), getCoverArtHeight(), m_cover_scale, title);
 
-      return image;
+      return {std::move(path), std::move(image)};
     });
 
   // Context must be 'this' so we run on the UI thread.
-  future.then(this, [this, path = ge->path](QPixmap pm) {
-    m_cover_pixmap_cache.Insert(std::move(path), std::move(pm));
-    invalidateCoverForPath(path);
+  future.then(this, [this](std::pair<std::string, QPixmap> result) {
+    if (result.first.empty())
+      return;
+
+    m_cover_pixmap_cache.Insert(result.first, std::move(result.second));
+    invalidateCoverForPath(result.first);
   });
 }
 
@@ -231,7 +316,7 @@ int GameListModel::rowCount(const QModelIndex& parent) const
   if (parent.isValid())
     return 0;
 
-  return static_cast<int>(GameList::GetEntryCount());
+  return m_known_row_count;
 }
 
 int GameListModel::columnCount(const QModelIndex& parent) const
@@ -434,9 +519,30 @@ QVariant GameListModel::headerData(int section, Qt::Orientation orientation, int
 void GameListModel::refresh()
 {
   beginResetModel();
+  m_known_row_count = static_cast<int>(GameList::GetEntryCount());
   endResetModel();
 }
 
+void GameListModel::ingestNewRows()
+{
+  // The scan thread only appends entries, so anything past the last known count can be inserted as
+  // one batch without resetting the views (and losing the selection/scroll position every tick).
+  const int new_row_count = static_cast<int>(GameList::GetEntryCount());
+  if (new_row_count == m_known_row_count)
+    return;
+
+  if (new_row_count < m_known_row_count)
+  {
+    // a new scan swapped the list out from under us, start over
+    refresh();
+    return;
+  }
+
+  beginInsertRows(QModelIndex(), m_known_row_count, new_row_count - 1);
+  m_known_row_count = new_row_count;
+  endInsertRows();
+}
+
 bool GameListModel::titlesLessThan(int left_row, int right_row) const
 {
   if (left_row < 0 || left_row >= static_cast<int>(GameList::GetEntryCount()) || right_row < 0 ||
@@ -14,6 +14,8 @@
 #include <QtGui/QPixmap>
 #include <algorithm>
 #include <array>
+#include <deque>
+#include <mutex>
 #include <optional>
 
 class GameListModel final : public QAbstractTableModel
@@ -56,6 +58,7 @@ public:
   ALWAYS_INLINE const QString& getColumnDisplayName(int column) { return m_column_display_names[column]; }
 
   void refresh();
+  void ingestNewRows();
 
   bool titlesLessThan(int left_row, int right_row) const;
 
@@ -78,10 +81,16 @@ private:
   void setColumnDisplayNames();
   void loadOrGenerateCover(const GameList::Entry* ge);
   void invalidateCoverForPath(const std::string& path);
+  QString getCoverThumbnailPath(const std::string& cover_path, float dpr) const;
+  void clearPendingCoverLoads();
 
   float m_cover_scale = 0.0f;
   bool m_show_titles_for_covers = false;
 
+  // Number of rows the views have been told about. The game list grows while a scan is running, so
+  // this lags GameList::GetEntryCount() until the next ingestNewRows()/refresh().
+  int m_known_row_count = 0;
+
   std::array<QString, Column_Count> m_column_display_names;
   std::array<QPixmap, static_cast<int>(GameList::EntryType::Count)> m_type_pixmaps;
   std::array<QPixmap, static_cast<int>(DiscRegion::Count)> m_region_pixmaps;
@@ -91,4 +100,8 @@ private:
   QPixmap m_loading_pixmap;
 
   mutable LRUCache<std::string, QPixmap> m_cover_pixmap_cache;
+
+  // Pending cover loads, popped newest-first by the decode tasks so visible covers win over scrolled-past ones.
+  mutable std::deque<std::string> m_cover_load_queue;
+  mutable std::mutex m_cover_load_queue_mutex;
 };
\ No newline at end of file
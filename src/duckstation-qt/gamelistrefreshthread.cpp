@@ -11,6 +11,10 @@
 
 #include <QtWidgets/QMessageBox>
 
+// Interval between progress emissions to the UI thread. Scans report progress per file, and emitting
+// a queued event (and model update) for each one floods the UI event loop.
+static constexpr float UI_UPDATE_INTERVAL = 1.0f / 60.0f;
+
 AsyncRefreshProgressCallback::AsyncRefreshProgressCallback(GameListRefreshThread* parent) : m_parent(parent) {}
 
 void AsyncRefreshProgressCallback::Cancel()
@@ -88,6 +92,12 @@ void AsyncRefreshProgressCallback::ModalInformation(const char* message)
 
 void AsyncRefreshProgressCallback::fireUpdate()
 {
+  // Coalesce updates on the scan side. Skipped updates aren't lost - the next one that goes through
+  // carries the latest values, and the final state is always delivered by refreshComplete().
+  if (m_last_update_time.GetTimeSeconds() < UI_UPDATE_INTERVAL)
+    return;
+
+  m_last_update_time.Reset();
   m_parent->refreshProgress(m_status_text, m_last_value, m_last_range);
 }
 
@@ -243,7 +243,7 @@ void GameListWidget::onRefreshProgress(const QString& status, int current, int t
   if (m_ui.stack->currentIndex() == 2)
     m_ui.stack->setCurrentIndex(Host::GetBaseBoolSettingValue("UI", "GameListGridView", false) ? 1 : 0);
 
-  m_model->refresh();
+  m_model->ingestNewRows();
   emit refreshProgress(status, current, total);
 }
 
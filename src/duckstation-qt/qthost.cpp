@@ -53,10 +53,13 @@
 #include <QtWidgets/QMessageBox>
 #include <algorithm>
 #include <cmath>
+#include <condition_variable>
 #include <csignal>
 #include <cstdio>
 #include <cstdlib>
+#include <deque>
 #include <memory>
+#include <mutex>
 
 Log_SetChannel(QtHost);
 
@@ -104,6 +107,16 @@ static bool s_start_fullscreen_ui = false;
 static bool s_start_fullscreen_ui_fullscreen = false;
 static bool s_run_setup_wizard = false;
 
+// Functions waiting to run on the emulation thread. Submissions append under the lock and post at
+// most one queued wakeup for the whole burst; the emulation thread drains everything pending in a
+// single slot invocation the next time it pumps its event loop. This keeps a settings-apply storm
+// of dozens of calls down to one cross-thread signal instead of one per function.
+static std::mutex s_cpu_thread_events_mutex;
+static std::condition_variable s_cpu_thread_event_done;
+static std::deque<std::pair<std::function<void()>, bool>> s_cpu_thread_events;
+static u32 s_blocking_cpu_events_pending = 0;
+static bool s_cpu_thread_event_posted = false;
+
 EmuThread* g_emu_thread;
 GDBServer* g_gdb_server;
 
@@ -984,18 +997,49 @@ void EmuThread::clearInputBindStateFromSource(InputBindingKey key)
   InputManager::ClearBindStateFromSource(key);
 }
 
-void EmuThread::runOnEmuThread(std::function<void()> callback)
+void EmuThread::processCpuThreadEvents()
 {
-  callback();
+  std::unique_lock lock(s_cpu_thread_events_mutex);
+
+  // Clear the posted flag up front, so a function queued while we're draining gets a fresh wakeup
+  // instead of being missed. The worst case is one redundant empty invocation.
+  s_cpu_thread_event_posted = false;
+
+  while (!s_cpu_thread_events.empty())
+  {
+    auto event = std::move(s_cpu_thread_events.front());
+    s_cpu_thread_events.pop_front();
+    lock.unlock();
+    event.first();
+    lock.lock();
+
+    if (event.second)
+    {
+      s_blocking_cpu_events_pending--;
+      if (s_blocking_cpu_events_pending == 0)
+        s_cpu_thread_event_done.notify_all();
+    }
+  }
 }
 
 void Host::RunOnCPUThread(std::function<void()> function, bool block /* = false */)
 {
-  const bool self = g_emu_thread->isOnThread();
+  // Calls from the emulation thread itself are still deferred to the event loop rather than run
+  // inline, to preserve the ordering/re-entrancy behaviour of the old queued invocation. Blocking
+  // on our own queue would deadlock, so it's ignored in that case, as before.
+  const bool wait = (block && !g_emu_thread->isOnThread());
+
+  std::unique_lock lock(s_cpu_thread_events_mutex);
+  s_cpu_thread_events.emplace_back(std::move(function), wait);
+  s_blocking_cpu_events_pending += static_cast<u32>(wait);
+  if (!s_cpu_thread_event_posted)
+  {
+    s_cpu_thread_event_posted = true;
+    QMetaObject::invokeMethod(g_emu_thread, "processCpuThreadEvents", Qt::QueuedConnection);
+  }
 
-  QMetaObject::invokeMethod(g_emu_thread, "runOnEmuThread",
-                            (block && !self) ? Qt::BlockingQueuedConnection : Qt::QueuedConnection,
-                            Q_ARG(std::function<void()>, std::move(function)));
+  if (wait)
+    s_cpu_thread_event_done.wait(lock, []() { return s_blocking_cpu_events_pending == 0; });
 }
 
 void QtHost::RunOnUIThread(const std::function<void()>& func, bool block /*= false*/)
@@ -199,7 +199,7 @@ private Q_SLOTS:
   void onDisplayWindowKeyEvent(int key, bool pressed);
   void onDisplayWindowTextEntered(const QString& text);
   void doBackgroundControllerPoll();
-  void runOnEmuThread(std::function<void()> callback);
+  void processCpuThreadEvents();
 
 protected:
   void run() override;
@@ -2,10 +2,14 @@
 // SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
 
 #include "core/achievements.h"
+#include "core/bus.h"
 #include "core/game_list.h"
 #include "core/gpu.h"
+#include "core/gpu_sw.h"
 #include "core/host.h"
+#include "core/input_movie.h"
 #include "core/system.h"
+#include "core/timing_event.h"
 
 #include "scmversion/scmversion.h"
 
@@ -21,9 +25,16 @@
 #include "common/memory_settings_interface.h"
 #include "common/path.h"
 #include "common/string_util.h"
+#include "common/threading.h"
+#include "common/timer.h"
 
+#include <algorithm>
+#include <atomic>
 #include <csignal>
 #include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
 
 Log_SetChannel(RegTestHost);
 
@@ -36,6 +47,10 @@ static void InitializeEarlyConsole();
 static void HookSignals();
 static bool SetFolders();
 static std::string GetFrameDumpFilename(u32 frame);
+static bool RunGPUCommandReplay(const char* path, u32 num_iterations);
+static void BenchmarkFrame();
+static void WriteBenchmarkResults();
+static bool RunBatch(int argc, char* argv[]);
 } // namespace RegTestHost
 
 static std::unique_ptr<MemorySettingsInterface> s_base_settings_interface;
@@ -44,6 +59,38 @@ static u32 s_frames_to_run = 60 * 60;
 static u32 s_frame_dump_interval = 0;
 static std::string s_dump_base_directory;
 static std::string s_dump_game_directory;
+static std::string s_gpu_command_dump_file;
+static std::string s_gpu_command_replay_file;
+static std::string s_mmio_stats_dump_file;
+
+static std::string s_record_movie_file;
+static std::string s_play_movie_file;
+
+static std::string s_benchmark_output_file;
+static u32 s_benchmark_warmup_frames = 300;
+static u32 s_benchmark_warmup_remaining = 0;
+static std::vector<float> s_benchmark_frame_times;
+static Common::Timer::Value s_benchmark_last_frame_time = 0;
+static Common::Timer::Value s_benchmark_start_time = 0;
+static u32 s_benchmark_start_internal_frame = 0;
+static u32 s_benchmark_last_ticks = 0;
+static u64 s_benchmark_total_ticks = 0;
+static u64 s_benchmark_start_cpu_time = 0;
+static u64 s_benchmark_start_sw_time = 0;
+static Threading::ThreadHandle s_benchmark_cpu_thread;
+
+struct BenchmarkGPUScope
+{
+  const char* name;
+  double total_ms;
+  u32 samples;
+};
+static std::vector<BenchmarkGPUScope> s_benchmark_gpu_scopes;
+
+static std::string s_batch_path;
+static u32 s_batch_workers = 0;
+static std::string s_batch_results_file;
+static std::string s_batch_junit_file;
 
 bool RegTestHost::SetFolders()
 {
@@ -227,7 +274,25 @@ void Host::OnSystemResumed()
 
 void Host::OnPerformanceCountersUpdated()
 {
-  //
+  // Accumulate per-pass GPU times for the benchmark results. The counters report each scope's
+  // average time per present over the update interval, so track a mean of those means.
+  if (s_benchmark_output_file.empty() || s_benchmark_start_time == 0)
+    return;
+
+  for (const System::GPUTimerScope& scope : System::GetGPUTimerScopes())
+  {
+    auto it = std::find_if(s_benchmark_gpu_scopes.begin(), s_benchmark_gpu_scopes.end(),
+                           [&scope](const BenchmarkGPUScope& bscope) { return (bscope.name == scope.name); });
+    if (it != s_benchmark_gpu_scopes.end())
+    {
+      it->total_ms += static_cast<double>(scope.time_ms);
+      it->samples++;
+    }
+    else
+    {
+      s_benchmark_gpu_scopes.push_back({scope.name, static_cast<double>(scope.time_ms), 1u});
+    }
+  }
 }
 
 void Host::OnGameChanged(const std::string& disc_path, const std::string& game_serial, const std::string& game_name)
@@ -252,9 +317,19 @@ void Host::OnGameChanged(const std::string& disc_path, const std::string& game_s
 
 void Host::PumpMessagesOnCPUThread()
 {
+  if (!s_benchmark_output_file.empty())
+    RegTestHost::BenchmarkFrame();
+
   s_frames_to_run--;
   if (s_frames_to_run == 0)
+  {
+    // Results have to be gathered before shutdown, the GPU thread handle dies with the system.
+    if (!s_benchmark_output_file.empty())
+      RegTestHost::WriteBenchmarkResults();
+
+    System::LogStateSerializationStats();
     System::ShutdownSystem(false);
+  }
 }
 
 void Host::RunOnCPUThread(std::function<void()> function, bool block /* = false */)
@@ -418,6 +493,24 @@ void RegTestHost::PrintCommandLineHelp(const char* progname)
   std::fprintf(stderr, "  -frames: Sets the number of frames to execute.\n");
   std::fprintf(stderr, "  -log <level>: Sets the log level. Defaults to verbose.\n");
   std::fprintf(stderr, "  -renderer <renderer>: Sets the graphics renderer. Default to software.\n");
+  std::fprintf(stderr, "  -dumpgpucommands <file>: Captures the software backend command stream to a file.\n");
+  std::fprintf(stderr, "  -replaygpucommands <file>: Replays a captured command stream standalone, without\n"
+                       "    booting a game. -frames sets the number of iterations.\n");
+  std::fprintf(stderr, "  -dumpmmiostats <file>: Writes per-region MMIO access/cycle counters to a CSV file.\n");
+  std::fprintf(stderr, "  -recordmovie <file>: Records the initial state and per-frame inputs to a movie file.\n");
+  std::fprintf(stderr, "  -playmovie <file>: Loads the state from a movie file and replays its recorded inputs,\n"
+                       "    giving an identical workload across runs. Combine with -benchmark for A/B comparisons.\n");
+  std::fprintf(stderr, "  -benchmark <file>: Runs uncapped, measures per-frame wall time after a warmup period,\n"
+                       "    and writes JSON statistics (mean/median/p95/p99) to the given file. -frames sets\n"
+                       "    the measured frame count, warmup frames run on top of it.\n");
+  std::fprintf(stderr, "  -benchmarkwarmup <frames>: Sets the number of unmeasured warmup frames (default 300).\n");
+  std::fprintf(stderr, "  -batch <path>: Runs every game found in the given directory (recursively), or listed in\n"
+                       "    the given text file (one path per line), in parallel child processes. All other\n"
+                       "    parameters are passed through to the children, so -frames caps each instance.\n");
+  std::fprintf(stderr, "  -parallel <n>: Sets the worker process count for -batch. Defaults to half the\n"
+                       "    logical core count, since each instance runs multiple threads.\n");
+  std::fprintf(stderr, "  -batchresults <file>: Writes consolidated per-game results as JSON.\n");
+  std::fprintf(stderr, "  -junit <file>: Writes consolidated per-game results as JUnit XML.\n");
   std::fprintf(stderr, "  --: Signals that no more arguments will follow and the remaining\n"
                        "    parameters make up the filename. Use when the filename contains\n"
                        "    spaces or starts with a dash.\n");
@@ -498,6 +591,117 @@ bool RegTestHost::ParseCommandLineParameters(int argc, char* argv[], std::option
         s_base_settings_interface->SetStringValue("Logging", "LogLevel", Settings::GetLogLevelName(level.value()));
         continue;
       }
+      else if (CHECK_ARG_PARAM("-dumpgpucommands"))
+      {
+        s_gpu_command_dump_file = argv[++i];
+        if (s_gpu_command_dump_file.empty())
+        {
+          Log_ErrorPrintf("Invalid GPU command dump file specified.");
+          return false;
+        }
+
+        continue;
+      }
+      else if (CHECK_ARG_PARAM("-replaygpucommands"))
+      {
+        s_gpu_command_replay_file = argv[++i];
+        if (s_gpu_command_replay_file.empty())
+        {
+          Log_ErrorPrintf("Invalid GPU command replay file specified.");
+          return false;
+        }
+
+        continue;
+      }
+      else if (CHECK_ARG_PARAM("-dumpmmiostats"))
+      {
+        s_mmio_stats_dump_file = argv[++i];
+        if (s_mmio_stats_dump_file.empty())
+        {
+          Log_ErrorPrintf("Invalid MMIO stats dump file specified.");
+          return false;
+        }
+
+        continue;
+      }
+      else if (CHECK_ARG_PARAM("-recordmovie"))
+      {
+        s_record_movie_file = argv[++i];
+        if (s_record_movie_file.empty())
+        {
+          Log_ErrorPrintf("Invalid movie file specified.");
+          return false;
+        }
+
+        continue;
+      }
+      else if (CHECK_ARG_PARAM("-playmovie"))
+      {
+        s_play_movie_file = argv[++i];
+        if (s_play_movie_file.empty())
+        {
+          Log_ErrorPrintf("Invalid movie file specified.");
+          return false;
+        }
+
+        continue;
+      }
+      else if (CHECK_ARG_PARAM("-benchmark"))
+      {
+        s_benchmark_output_file = argv[++i];
+        if (s_benchmark_output_file.empty())
+        {
+          Log_ErrorPrintf("Invalid benchmark output file specified.");
+          return false;
+        }
+
+        // Turns on GPU timing, so hardware renderer benchmarks report per-pass GPU times.
+        s_base_settings_interface->SetBoolValue("Display", "ShowGPU", true);
+        continue;
+      }
+      else if (CHECK_ARG_PARAM("-benchmarkwarmup"))
+      {
+        s_benchmark_warmup_frames = StringUtil::FromChars<u32>(argv[++i]).value_or(0);
+        if (s_benchmark_warmup_frames == 0)
+        {
+          Log_ErrorPrintf("Invalid benchmark warmup frame count specified: %s", argv[i]);
+          return false;
+        }
+
+        continue;
+      }
+      else if (CHECK_ARG_PARAM("-batch"))
+      {
+        s_batch_path = argv[++i];
+        if (s_batch_path.empty())
+        {
+          Log_ErrorPrintf("Invalid batch path specified.");
+          return false;
+        }
+
+        continue;
+      }
+      else if (CHECK_ARG_PARAM("-parallel"))
+      {
+        s_batch_workers = StringUtil::FromChars<u32>(argv[++i]).value_or(0);
+        if (s_batch_workers == 0)
+        {
+          Log_ErrorPrintf("Invalid worker count specified: %s", argv[i]);
+          return false;
+        }
+
+        continue;
+      }
+      else if (CHECK_ARG_PARAM("-batchresults"))
+      {
+        s_batch_results_file = argv[++i];
+        continue;
+      }
+      else if (CHECK_ARG_PARAM("-junit"))
+      {
+        s_batch_junit_file = argv[++i];
+        continue;
+      }
       else if (CHECK_ARG_PARAM("-renderer"))
       {
         std::optional<GPURenderer> renderer = Settings::ParseRendererName(argv[++i]);
@@ -538,6 +742,369 @@ std::string RegTestHost::GetFrameDumpFilename(u32 frame)
   return Path::Combine(s_dump_game_directory, fmt::format("frame_{:05d}.png", frame));
 }
 
+void RegTestHost::BenchmarkFrame()
+{
+  const Common::Timer::Value now = Common::Timer::GetCurrentValue();
+  const u32 ticks = TimingEvents::GetGlobalTickCounter();
+
+  if (s_benchmark_warmup_remaining > 0)
+  {
+    s_benchmark_warmup_remaining--;
+    if (s_benchmark_warmup_remaining > 0)
+      return;
+
+    // Warmup done - caches primed, recompiler warm. Count everything from here.
+    s_benchmark_start_time = now;
+    s_benchmark_last_frame_time = now;
+    s_benchmark_start_internal_frame = System::GetInternalFrameNumber();
+    s_benchmark_last_ticks = ticks;
+    s_benchmark_total_ticks = 0;
+    s_benchmark_cpu_thread = Threading::ThreadHandle::GetForCallingThread();
+    s_benchmark_start_cpu_time = s_benchmark_cpu_thread.GetCPUTime();
+    s_benchmark_gpu_scopes.clear();
+    const Threading::Thread* sw_thread = g_gpu->GetSWThread();
+    s_benchmark_start_sw_time = sw_thread ? sw_thread->GetCPUTime() : 0;
+    Log_InfoPrintf("Benchmark warmup complete, measuring %u frames.", s_frames_to_run - 1);
+    return;
+  }
+
+  s_benchmark_frame_times.push_back(
+    static_cast<float>(Common::Timer::ConvertValueToMilliseconds(now - s_benchmark_last_frame_time)));
+  s_benchmark_last_frame_time = now;
+
+  // Accumulate tick deltas per frame, the global counter is 32 bits and wraps every couple of
+  // minutes of emulated time.
+  s_benchmark_total_ticks += static_cast<u32>(ticks - s_benchmark_last_ticks);
+  s_benchmark_last_ticks = ticks;
+}
+
+void RegTestHost::WriteBenchmarkResults()
+{
+  if (s_benchmark_frame_times.empty())
+  {
+    Log_ErrorPrint("No frames were measured, not writing benchmark results.");
+    return;
+  }
+
+  std::vector<float> sorted_times(s_benchmark_frame_times);
+  std::sort(sorted_times.begin(), sorted_times.end());
+  const auto percentile = [&sorted_times](double q) {
+    return sorted_times[std::min(sorted_times.size() - 1,
+                                 static_cast<size_t>(q * static_cast<double>(sorted_times.size())))];
+  };
+
+  double mean = 0.0;
+  for (const float time : sorted_times)
+    mean += static_cast<double>(time);
+  mean /= static_cast<double>(sorted_times.size());
+
+  const double wall_time =
+    Common::Timer::ConvertValueToSeconds(s_benchmark_last_frame_time - s_benchmark_start_time);
+  const double thread_ticks_per_second = static_cast<double>(Threading::GetThreadTicksPerSecond());
+  const double cpu_thread_time =
+    static_cast<double>(s_benchmark_cpu_thread.GetCPUTime() - s_benchmark_start_cpu_time) / thread_ticks_per_second;
+  const Threading::Thread* sw_thread = g_gpu->GetSWThread();
+  const double sw_thread_time =
+    sw_thread ? (static_cast<double>(sw_thread->GetCPUTime() - s_benchmark_start_sw_time) / thread_ticks_per_second) :
+                0.0;
+  const u32 internal_frames = System::GetInternalFrameNumber() - s_benchmark_start_internal_frame;
+
+  const auto escape = [](const std::string& str) {
+    std::string ret;
+    ret.reserve(str.length());
+    for (const char ch : str)
+    {
+      if (ch == '"' || ch == '\\')
+        ret.push_back('\\');
+      ret.push_back(ch);
+    }
+    return ret;
+  };
+
+  std::string gpu_pass_json;
+  for (const BenchmarkGPUScope& scope : s_benchmark_gpu_scopes)
+  {
+    gpu_pass_json += fmt::format("{}\"{}\": {:.4f}", gpu_pass_json.empty() ? "" : ", ", escape(scope.name),
+                                 scope.total_ms / static_cast<double>(scope.samples));
+  }
+
+  const std::string json = fmt::format(
+    "{{\n"
+    "  \"game_serial\": \"{}\",\n"
+    "  \"game_title\": \"{}\",\n"
+    "  \"renderer\": \"{}\",\n"
+    "  \"warmup_frames\": {},\n"
+    "  \"measured_frames\": {},\n"
+    "  \"wall_time_seconds\": {:.3f},\n"
+    "  \"vps\": {:.2f},\n"
+    "  \"internal_fps\": {:.2f},\n"
+    "  \"emulated_ticks\": {},\n"
+    "  \"cpu_thread_seconds\": {:.3f},\n"
+    "  \"gpu_thread_seconds\": {:.3f},\n"
+    "  \"gpu_pass_ms\": {{{}}},\n"
+    "  \"frame_time_ms\": {{\n"
+    "    \"mean\": {:.4f},\n"
+    "    \"median\": {:.4f},\n"
+    "    \"p95\": {:.4f},\n"
+    "    \"p99\": {:.4f},\n"
+    "    \"min\": {:.4f},\n"
+    "    \"max\": {:.4f}\n"
+    "  }}\n"
+    "}}\n",
+    escape(System::GetGameSerial()), escape(System::GetGameTitle()),
+    Settings::GetRendererName(g_settings.gpu_renderer), s_benchmark_warmup_frames, sorted_times.size(), wall_time,
+    static_cast<double>(sorted_times.size()) / wall_time, static_cast<double>(internal_frames) / wall_time,
+    s_benchmark_total_ticks, cpu_thread_time, sw_thread_time, gpu_pass_json, mean, percentile(0.5), percentile(0.95),
+    percentile(0.99), sorted_times.front(), sorted_times.back());
+
+  if (!FileSystem::WriteStringToFile(s_benchmark_output_file.c_str(), json))
+  {
+    Log_ErrorPrintf("Failed to write benchmark results to '%s'.", s_benchmark_output_file.c_str());
+    return;
+  }
+
+  Log_InfoPrintf("Benchmark: %zu frames in %.2fs (%.2f VPS), mean %.3fms median %.3fms p95 %.3fms p99 %.3fms.",
+                 sorted_times.size(), wall_time, static_cast<double>(sorted_times.size()) / wall_time, mean,
+                 static_cast<double>(percentile(0.5)), static_cast<double>(percentile(0.95)),
+                 static_cast<double>(percentile(0.99)));
+  Log_InfoPrintf("Benchmark results written to '%s'.", s_benchmark_output_file.c_str());
+}
+
+bool RegTestHost::RunGPUCommandReplay(const char* path, u32 num_iterations)
+{
+  // Feed the capture straight into a standalone software backend on this thread, so the numbers aren't
+  // polluted by the rest of the emulated machine.
+  g_settings.gpu_use_thread = false;
+
+  GPU_SW_Backend backend;
+  if (!backend.Initialize(false))
+  {
+    Log_ErrorPrint("Failed to initialize GPU backend.");
+    return false;
+  }
+
+  backend.Reset(true);
+
+  const bool result = backend.RunCommandDump(path, num_iterations);
+  backend.Shutdown();
+  return result;
+}
+
+namespace {
+struct BatchResult
+{
+  std::string path;
+  std::string log_file;
+  int exit_code = -1;
+  double seconds = 0.0;
+};
+} // namespace
+
+static std::string QuoteCommandLineArgument(const std::string_view& arg)
+{
+  return fmt::format("\"{}\"", arg);
+}
+
+bool RegTestHost::RunBatch(int argc, char* argv[])
+{
+  // Enumerate the games, either recursively from a directory or from a list file.
+  std::vector<std::string> games;
+  if (FileSystem::DirectoryExists(s_batch_path.c_str()))
+  {
+    FileSystem::FindResultsArray files;
+    FileSystem::FindFiles(s_batch_path.c_str(), "*", FILESYSTEM_FIND_RECURSIVE | FILESYSTEM_FIND_FILES, &files);
+    for (FILESYSTEM_FIND_DATA& fd : files)
+    {
+      if (GameList::IsScannableFilename(fd.FileName))
+        games.push_back(std::move(fd.FileName));
+    }
+  }
+  else
+  {
+    const std::optional<std::string> contents = FileSystem::ReadFileToString(s_batch_path.c_str());
+    if (!contents.has_value())
+    {
+      Log_ErrorPrintf("Failed to read batch list file '%s'.", s_batch_path.c_str());
+      return false;
+    }
+
+    for (std::string_view line : StringUtil::SplitString(contents.value(), '\n', true))
+    {
+      line = StringUtil::StripWhitespace(line);
+      if (line.empty() || line[0] == '#')
+        continue;
+
+      games.emplace_back(line);
+    }
+  }
+
+  if (games.empty())
+  {
+    Log_ErrorPrintf("No games found in '%s'.", s_batch_path.c_str());
+    return false;
+  }
+
+  std::sort(games.begin(), games.end());
+
+  // Each child runs at least a CPU and a software renderer thread, so by default only hand out
+  // half the logical cores to keep the host from thrashing.
+  u32 workers = s_batch_workers;
+  if (workers == 0)
+    workers = std::max<u32>(std::thread::hardware_concurrency() / 2, 1);
+  workers = std::min(workers, static_cast<u32>(games.size()));
+
+  // Per-game logs go next to the results file, or the working directory without one.
+  const std::string log_directory =
+    Path::Combine(s_batch_results_file.empty() ? std::string_view(".") : Path::GetDirectory(s_batch_results_file),
+                  "regtest-logs");
+  if (!FileSystem::EnsureDirectoryExists(log_directory.c_str(), true))
+  {
+    Log_ErrorPrintf("Failed to create log directory '%s'.", log_directory.c_str());
+    return false;
+  }
+
+  // Pass our own parameters through to the children, minus the orchestrator ones.
+  std::string base_command = QuoteCommandLineArgument(argv[0]);
+  for (int i = 1; i < argc; i++)
+  {
+    if (!std::strcmp(argv[i], "-batch") || !std::strcmp(argv[i], "-parallel") ||
+        !std::strcmp(argv[i], "-batchresults") || !std::strcmp(argv[i], "-junit"))
+    {
+      i++;
+      continue;
+    }
+
+    base_command += ' ';
+    base_command += QuoteCommandLineArgument(argv[i]);
+  }
+
+  Log_InfoPrintf("Running %zu games with %u workers...", games.size(), workers);
+
+  std::vector<BatchResult> results(games.size());
+  std::atomic<u32> next_game{0};
+  std::atomic<u32> failures{0};
+
+  const auto worker_proc = [&]() {
+    for (;;)
+    {
+      const u32 index = next_game.fetch_add(1);
+      if (index >= static_cast<u32>(games.size()))
+        break;
+
+      BatchResult& result = results[index];
+      result.path = games[index];
+      result.log_file = Path::Combine(
+        log_directory, fmt::format("{}.log", Path::SanitizeFileName(Path::GetFileTitle(result.path))));
+
+      const std::string command = fmt::format("{} -- {} > {} 2>&1", base_command,
+                                              QuoteCommandLineArgument(result.path),
+                                              QuoteCommandLineArgument(result.log_file));
+
+      Common::Timer timer;
+      result.exit_code = std::system(command.c_str());
+      result.seconds = timer.GetTimeSeconds();
+
+      if (result.exit_code != 0)
+        failures.fetch_add(1);
+
+      Log_InfoPrintf("[%u/%zu] %s: %s in %.1f seconds", index + 1, games.size(),
+                     Path::GetFileName(result.path).data(), (result.exit_code == 0) ? "passed" : "FAILED",
+                     result.seconds);
+    }
+  };
+
+  std::vector<std::thread> worker_threads;
+  worker_threads.reserve(workers);
+  for (u32 i = 0; i < workers; i++)
+    worker_threads.emplace_back(worker_proc);
+  for (std::thread& thread : worker_threads)
+    thread.join();
+
+  Log_InfoPrintf("Batch complete: %zu games, %u failures.", games.size(), failures.load());
+
+  const auto escape_json = [](const std::string& str) {
+    std::string ret;
+    ret.reserve(str.length());
+    for (const char ch : str)
+    {
+      if (ch == '"' || ch == '\\')
+        ret += '\\';
+      ret += ch;
+    }
+    return ret;
+  };
+
+  if (!s_batch_results_file.empty())
+  {
+    std::string json = "[\n";
+    for (size_t i = 0; i < results.size(); i++)
+    {
+      const BatchResult& result = results[i];
+      json += fmt::format("  {{\"path\": \"{}\", \"log\": \"{}\", \"exit_code\": {}, \"seconds\": {:.2f}, "
+                          "\"passed\": {}}}{}\n",
+                          escape_json(result.path), escape_json(result.log_file), result.exit_code, result.seconds,
+                          (result.exit_code == 0) ? "true" : "false", (i + 1 < results.size()) ? "," : "");
+    }
+    json += "]\n";
+
+    if (!FileSystem::WriteStringToFile(s_batch_results_file.c_str(), json))
+      Log_ErrorPrintf("Failed to write results to '%s'.", s_batch_results_file.c_str());
+  }
+
+  if (!s_batch_junit_file.empty())
+  {
+    const auto escape_xml = [](const std::string& str) {
+      std::string ret;
+      ret.reserve(str.length());
+      for (const char ch : str)
+      {
+        switch (ch)
+        {
+          case '&':
+            ret += "&amp;";
+            break;
+          case '<':
+            ret += "&lt;";
+            break;
+          case '>':
+            ret += "&gt;";
+            break;
+          case '"':
+            ret += "&quot;";
+            break;
+          default:
+            ret += ch;
+            break;
+        }
+      }
+      return ret;
+    };
+
+    std::string xml = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+    xml += fmt::format("<testsuite name=\"duckstation-regtest\" tests=\"{}\" failures=\"{}\">\n", results.size(),
+                       failures.load());
+    for (const BatchResult& result : results)
+    {
+      xml += fmt::format("  <testcase name=\"{}\" time=\"{:.2f}\"", escape_xml(result.path), result.seconds);
+      if (result.exit_code == 0)
+      {
+        xml += " />\n";
+      }
+      else
+      {
+        xml += fmt::format(">\n    <failure message=\"Exited with code {}\">See {}</failure>\n  </testcase>\n",
+                           result.exit_code, escape_xml(result.log_file));
+      }
+    }
+    xml += "</testsuite>\n";
+
+    if (!FileSystem::WriteStringToFile(s_batch_junit_file.c_str(), xml))
+      Log_ErrorPrintf("Failed to write JUnit results to '%s'.", s_batch_junit_file.c_str());
+  }
+
+  return (failures.load() == 0);
+}
+
 int main(int argc, char* argv[])
 {
   RegTestHost::InitializeEarlyConsole();
@@ -549,6 +1116,12 @@ int main(int argc, char* argv[])
   if (!RegTestHost::ParseCommandLineParameters(argc, argv, autoboot))
     return EXIT_FAILURE;
 
+  if (!s_gpu_command_replay_file.empty())
+    return RegTestHost::RunGPUCommandReplay(s_gpu_command_replay_file.c_str(), s_frames_to_run) ? 0 : EXIT_FAILURE;
+
+  if (!s_batch_path.empty())
+    return RegTestHost::RunBatch(argc, argv) ? 0 : EXIT_FAILURE;
+
   if (!autoboot || autoboot->filename.empty())
   {
     Log_ErrorPrintf("No boot path specified.");
@@ -565,6 +1138,46 @@ int main(int argc, char* argv[])
     goto cleanup;
   }
 
+  if (!s_gpu_command_dump_file.empty())
+  {
+    if (g_gpu && !g_gpu->IsHardwareRenderer())
+      static_cast<GPU_SW*>(g_gpu.get())->GetBackend().StartCommandDump(s_gpu_command_dump_file.c_str());
+    else
+      Log_ErrorPrint("GPU command dumping requires the software renderer.");
+  }
+
+  if (!s_play_movie_file.empty())
+  {
+    if (!InputMovie::BeginPlayback(s_play_movie_file))
+    {
+      Log_ErrorPrintf("Failed to start movie playback from '%s'.", s_play_movie_file.c_str());
+      goto cleanup;
+    }
+  }
+  else if (!s_record_movie_file.empty())
+  {
+    if (!System::StartRecordingInputMovie(s_record_movie_file.c_str()))
+    {
+      Log_ErrorPrintf("Failed to start movie recording to '%s'.", s_record_movie_file.c_str());
+      goto cleanup;
+    }
+  }
+
+  // MMIO stats are only collected while the profiler is enabled.
+  if (!s_mmio_stats_dump_file.empty())
+    g_settings.debugging.show_bus_profiler = true;
+
+  if (!s_benchmark_output_file.empty())
+  {
+    // Warmup frames run on top of the measured count. At least one is needed to seed the
+    // per-frame timer.
+    s_benchmark_warmup_remaining = std::max(s_benchmark_warmup_frames, 1u);
+    s_frames_to_run += s_benchmark_warmup_remaining;
+    s_benchmark_frame_times.reserve(s_frames_to_run);
+    Log_InfoPrintf("Benchmarking %u frames after %u warmup frames.", s_frames_to_run - s_benchmark_warmup_remaining,
+                   s_benchmark_warmup_remaining);
+  }
+
   if (s_frame_dump_interval > 0)
   {
     if (s_dump_base_directory.empty())
@@ -579,6 +1192,14 @@ int main(int argc, char* argv[])
   Log_InfoPrintf("Running for %d frames...", s_frames_to_run);
   System::Execute();
 
+  if (!s_mmio_stats_dump_file.empty())
+  {
+    if (Bus::DumpMMIOProfilerStats(s_mmio_stats_dump_file.c_str()))
+      Log_InfoPrintf("Dumped MMIO stats to '%s'.", s_mmio_stats_dump_file.c_str());
+    else
+      Log_ErrorPrintf("Failed to dump MMIO stats to '%s'.", s_mmio_stats_dump_file.c_str());
+  }
+
   Log_InfoPrintf("Exiting with success.");
   result = 0;
 
@@ -9,6 +9,8 @@
 #include "common/minizip_helpers.h"
 #include "common/string_util.h"
 
+#include <zlib.h>
+
 #include <algorithm>
 #include <cstdio>
 #include <cstring>
@@ -97,6 +99,8 @@ bool Updater::ParseZip()
 
     FileToUpdate entry;
     entry.original_zip_filename = zip_filename_buffer;
+    entry.uncompressed_size = static_cast<u64>(file_info.uncompressed_size);
+    entry.zip_crc = static_cast<u32>(file_info.crc);
 
     // replace forward slashes with backslashes
     size_t len = std::strlen(zip_filename_buffer);
@@ -197,13 +201,51 @@ bool Updater::PrepareStagingDirectory()
   return true;
 }
 
+bool Updater::IsFileUnchanged(const FileToUpdate& ftu) const
+{
+  const std::string installed_file = StringUtil::StdStringFromFormat(
+    "%s" FS_OSPATH_SEPARATOR_STR "%s", m_destination_directory.c_str(), ftu.destination_filename.c_str());
+  std::FILE* fp = FileSystem::OpenCFile(installed_file.c_str(), "rb");
+  if (!fp)
+    return false;
+
+  const s64 file_size = FileSystem::FSize64(fp);
+  if (file_size < 0 || static_cast<u64>(file_size) != ftu.uncompressed_size)
+  {
+    std::fclose(fp);
+    return false;
+  }
+
+  static constexpr u32 CHUNK_SIZE = 4096;
+  u8 buffer[CHUNK_SIZE];
+  uLong crc = crc32(0, Z_NULL, 0);
+  size_t bytes_read;
+  while ((bytes_read = std::fread(buffer, 1, CHUNK_SIZE, fp)) > 0)
+    crc = crc32(crc, buffer, static_cast<uInt>(bytes_read));
+
+  const bool read_ok = (std::ferror(fp) == 0);
+  std::fclose(fp);
+  return (read_ok && static_cast<u32>(crc) == ftu.zip_crc);
+}
+
 bool Updater::StageUpdate()
 {
   m_progress->SetProgressRange(static_cast<u32>(m_update_paths.size()));
   m_progress->SetProgressValue(0);
 
-  for (const FileToUpdate& ftu : m_update_paths)
+  for (FileToUpdate& ftu : m_update_paths)
   {
+    // Delta staging: files whose installed copy already matches the zip entry don't need to be
+    // extracted or replaced. Most files are unchanged between consecutive builds, so this is
+    // where the bulk of the update time goes away.
+    if (IsFileUnchanged(ftu))
+    {
+      m_progress->DisplayFormattedInformation("Skipping unchanged file '%s'", ftu.destination_filename.c_str());
+      ftu.unchanged = true;
+      m_progress->IncrementProgressValue();
+      continue;
+    }
+
     m_progress->SetFormattedStatusText("Extracting '%s'...", ftu.original_zip_filename.c_str());
 
     if (unzLocateFile(m_zf, ftu.original_zip_filename.c_str(), 0) != UNZ_OK)
@@ -286,6 +328,9 @@ bool Updater::CommitUpdate()
   // move files to target
   for (const FileToUpdate& ftu : m_update_paths)
   {
+    if (ftu.unchanged)
+      continue;
+
     const std::string staging_file_name = StringUtil::StdStringFromFormat(
       "%s" FS_OSPATH_SEPARATOR_STR "%s", m_staging_directory.c_str(), ftu.destination_filename.c_str());
     const std::string dest_file_name = StringUtil::StdStringFromFormat(
@@ -28,10 +28,19 @@ private:
   {
     std::string original_zip_filename;
     std::string destination_filename;
+    u64 uncompressed_size = 0;
+    u32 zip_crc = 0;
+
+    // Set during staging when the installed copy already matches the zip entry.
+    bool unchanged = false;
   };
 
   bool ParseZip();
 
+  /// Returns true if the currently-installed copy of the file matches the zip entry's size and
+  /// CRC32, in which case extracting and replacing it can be skipped entirely.
+  bool IsFileUnchanged(const FileToUpdate& ftu) const;
+
   std::string m_destination_directory;
   std::string m_staging_directory;
 
@@ -38,6 +38,7 @@ AudioStream::AudioStream(u32 sample_rate, u32 channels, u32 buffer_ms, AudioStre
 
 AudioStream::~AudioStream()
 {
+  StretchDestroy();
   DestroyBuffer();
 }
 
@@ -48,6 +49,14 @@ std::unique_ptr<AudioStream> AudioStream::CreateNullStream(u32 sample_rate, u32
   return stream;
 }
 
+std::unique_ptr<AudioStream> AudioStream::CreateNullSinkStream(u32 sample_rate, u32 channels)
+{
+  // no BaseInitialize() - frames are discarded in EndWrite(), so there is no buffer to allocate.
+  std::unique_ptr<AudioStream> stream(new AudioStream(sample_rate, channels, 0, AudioStretchMode::Off));
+  stream->m_null_sink = true;
+  return stream;
+}
+
 u32 AudioStream::GetAlignedBufferSize(u32 size)
 {
   static_assert(Common::IsPow2(CHUNK_SIZE));
@@ -93,6 +102,9 @@ std::optional<AudioStretchMode> AudioStream::ParseStretchMode(const char* name)
 
 u32 AudioStream::GetBufferedFramesRelaxed() const
 {
+  if (m_buffer_size == 0)
+    return 0;
+
   const u32 rpos = m_rpos.load(std::memory_order_relaxed);
   const u32 wpos = m_wpos.load(std::memory_order_relaxed);
   return (wpos + m_buffer_size - rpos) % m_buffer_size;
@@ -100,6 +112,8 @@ u32 AudioStream::GetBufferedFramesRelaxed() const
 
 void AudioStream::ReadFrames(s16* bData, u32 nFrames)
 {
+  m_wakeup_count.fetch_add(1, std::memory_order_relaxed);
+
   const u32 available_frames = GetBufferedFramesRelaxed();
   u32 frames_to_read = nFrames;
   u32 silence_frames = 0;
@@ -123,6 +137,7 @@ void AudioStream::ReadFrames(s16* bData, u32 nFrames)
 
   if (available_frames < frames_to_read)
   {
+    m_underrun_count.fetch_add(1, std::memory_order_relaxed);
     silence_frames = frames_to_read - available_frames;
     frames_to_read = available_frames;
     m_filling = true;
@@ -265,6 +280,7 @@ void AudioStream::EmptyBuffer()
 {
   if (m_stretch_mode != AudioStretchMode::Off)
   {
+    std::unique_lock lock(m_soundtouch_mutex);
     m_soundtouch->clear();
     if (m_stretch_mode == AudioStretchMode::TimeStretch)
       m_soundtouch->setTempo(m_nominal_rate);
@@ -277,7 +293,10 @@ void AudioStream::SetNominalRate(float tempo)
 {
   m_nominal_rate = tempo;
   if (m_stretch_mode == AudioStretchMode::Resample)
+  {
+    std::unique_lock lock(m_soundtouch_mutex);
     m_soundtouch->setRate(tempo);
+  }
 }
 
 void AudioStream::UpdateTargetTempo(float tempo)
@@ -289,6 +308,7 @@ void AudioStream::UpdateTargetTempo(float tempo)
   if (tempo)
     tempo *= tempo;
 
+  std::unique_lock lock(m_soundtouch_mutex);
   m_average_position = AVERAGING_WINDOW;
   m_average_available = AVERAGING_WINDOW;
   std::fill_n(m_average_fullness.data(), AVERAGING_WINDOW, tempo);
@@ -296,12 +316,13 @@ void AudioStream::UpdateTargetTempo(float tempo)
   m_stretch_reset = 0;
   m_stretch_inactive = false;
   m_stretch_ok_count = 0;
-  m_dynamic_target_usage = static_cast<float>(m_target_buffer_size) * m_nominal_rate;
+  m_dynamic_target_usage = static_cast<float>(m_adaptive_target_size) * m_nominal_rate;
 }
 
 void AudioStream::SetStretchMode(AudioStretchMode mode)
 {
-  if (m_stretch_mode == mode)
+  // pointless stretching data which is thrown away
+  if (m_null_sink || m_stretch_mode == mode)
     return;
 
   // can't resize the buffers while paused
@@ -345,6 +366,15 @@ void AudioStream::WriteFrames(const SampleType* frames, u32 num_frames)
 
 void AudioStream::EndWrite(u32 num_frames)
 {
+  if (m_null_sink)
+  {
+    // frames are "consumed" the moment they are written, the producer is never throttled. counted
+    // before the mute check below so the clock doesn't depend on the volume.
+    m_null_sink_frame_position += num_frames;
+    m_staging_buffer_pos = 0;
+    return;
+  }
+
   // don't bother committing anything when muted
   if (m_volume == 0)
     return;
@@ -356,8 +386,10 @@ void AudioStream::EndWrite(u32 num_frames)
 
   m_staging_buffer_pos = 0;
 
-  if (m_stretch_mode != AudioStretchMode::Off)
-    StretchWrite();
+  if (m_stretch_mode == AudioStretchMode::TimeStretch)
+    StretchEnqueue();
+  else if (m_stretch_mode != AudioStretchMode::Off)
+    StretchWriteChunk(m_staging_buffer.data());
   else
     InternalWriteFrames(m_staging_buffer.data(), CHUNK_SIZE);
 }
@@ -530,31 +562,110 @@ void AudioStream::StretchAllocate()
   m_average_position = 0;
   m_average_available = 0;
 
+  m_adaptive_target_size = m_target_buffer_size;
+  m_adaptive_stable_chunks = 0;
+  m_adaptive_underrun = false;
+
   m_staging_buffer_pos = 0;
+
+  if (m_stretch_mode == AudioStretchMode::TimeStretch)
+  {
+    // SoundTouch runs on its own worker, the emulation thread only deposits raw chunks.
+    m_stretch_queue = std::make_unique<s32[]>(static_cast<size_t>(STRETCH_QUEUE_CHUNKS) * CHUNK_SIZE);
+    m_stretch_queue_rpos.store(0, std::memory_order_release);
+    m_stretch_queue_wpos.store(0, std::memory_order_release);
+    m_stretch_thread_shutdown = false;
+    m_stretch_thread = std::thread(&AudioStream::StretchWorkerThread, this);
+  }
 }
 
 void AudioStream::StretchDestroy()
 {
+  if (m_stretch_thread.joinable())
+  {
+    {
+      std::unique_lock lock(m_stretch_queue_mutex);
+      m_stretch_thread_shutdown = true;
+      m_stretch_queue_cv.notify_one();
+    }
+    m_stretch_thread.join();
+  }
+
+  m_stretch_queue.reset();
   m_soundtouch.reset();
 }
 
-void AudioStream::StretchWrite()
+void AudioStream::StretchWriteChunk(const s32* chunk)
 {
-  S16ChunkToFloat(m_staging_buffer.data(), m_float_buffer.data());
+  S16ChunkToFloat(chunk, m_float_buffer.data());
 
   m_soundtouch->putSamples(m_float_buffer.data(), CHUNK_SIZE);
 
   int tempProgress;
   while (tempProgress = m_soundtouch->receiveSamples((float*)m_float_buffer.data(), CHUNK_SIZE), tempProgress != 0)
   {
-    FloatChunkToS16(m_staging_buffer.data(), m_float_buffer.data(), tempProgress);
-    InternalWriteFrames(m_staging_buffer.data(), tempProgress);
+    FloatChunkToS16(m_stretch_out_buffer.data(), m_float_buffer.data(), tempProgress);
+    InternalWriteFrames(m_stretch_out_buffer.data(), tempProgress);
   }
 
   if (m_stretch_mode == AudioStretchMode::TimeStretch)
     UpdateStretchTempo();
 }
 
+void AudioStream::StretchEnqueue()
+{
+  const u32 wpos = m_stretch_queue_wpos.load(std::memory_order_relaxed);
+  const u32 rpos = m_stretch_queue_rpos.load(std::memory_order_acquire);
+  const u32 next_wpos = (wpos + 1) % STRETCH_QUEUE_CHUNKS;
+  if (next_wpos == rpos)
+  {
+    // Worker can't keep up. Drop the chunk; the tempo controller absorbs the gap the same way it
+    // does a buffer overrun.
+    Log_DebugPrintf("Stretch queue full, chunk dropped");
+    return;
+  }
+
+  std::memcpy(&m_stretch_queue[static_cast<size_t>(wpos) * CHUNK_SIZE], m_staging_buffer.data(),
+              sizeof(s32) * CHUNK_SIZE);
+  m_stretch_queue_wpos.store(next_wpos, std::memory_order_release);
+
+  // empty -> non-empty transition, the worker may be sleeping
+  if (wpos == rpos)
+  {
+    std::unique_lock lock(m_stretch_queue_mutex);
+    m_stretch_queue_cv.notify_one();
+  }
+}
+
+void AudioStream::StretchWorkerThread()
+{
+  for (;;)
+  {
+    {
+      std::unique_lock lock(m_stretch_queue_mutex);
+      m_stretch_queue_cv.wait(lock, [this]() {
+        return (m_stretch_thread_shutdown || m_stretch_queue_rpos.load(std::memory_order_relaxed) !=
+                                               m_stretch_queue_wpos.load(std::memory_order_relaxed));
+      });
+
+      if (m_stretch_thread_shutdown)
+        break;
+    }
+
+    u32 rpos = m_stretch_queue_rpos.load(std::memory_order_relaxed);
+    while (rpos != m_stretch_queue_wpos.load(std::memory_order_acquire))
+    {
+      {
+        std::unique_lock lock(m_soundtouch_mutex);
+        StretchWriteChunk(&m_stretch_queue[static_cast<size_t>(rpos) * CHUNK_SIZE]);
+      }
+
+      rpos = (rpos + 1) % STRETCH_QUEUE_CHUNKS;
+      m_stretch_queue_rpos.store(rpos, std::memory_order_release);
+    }
+  }
+}
+
 float AudioStream::AddAndGetAverageTempo(float val)
 {
   if (m_stretch_reset >= STRETCH_RESET_THRESHOLD)
@@ -587,7 +698,9 @@ void AudioStream::UpdateStretchTempo()
   static constexpr u32 INACTIVE_MIN_OK_COUNT = 50;
   static constexpr u32 COMPENSATION_DIVIDER = 100;
 
-  float base_target_usage = static_cast<float>(m_target_buffer_size) * m_nominal_rate;
+  UpdateAdaptiveLatency();
+
+  float base_target_usage = static_cast<float>(m_adaptive_target_size) * m_nominal_rate;
 
   // state vars
   if (m_stretch_reset >= STRETCH_RESET_THRESHOLD)
@@ -669,16 +782,49 @@ void AudioStream::UpdateStretchTempo()
     m_stretch_reset = 0;
 }
 
+void AudioStream::UpdateAdaptiveLatency()
+{
+  if (m_adaptive_underrun)
+  {
+    // Cadence hiccup - go back to the configured latency and start over.
+    if (m_adaptive_target_size != m_target_buffer_size)
+      Log_VerbosePrintf("Adaptive latency: reset to %u frames after underrun", m_target_buffer_size);
+
+    m_adaptive_target_size = m_target_buffer_size;
+    m_adaptive_stable_chunks = 0;
+    m_adaptive_underrun = false;
+    return;
+  }
+
+  // Only count chunks where the stretcher is coasting at 1:1, i.e. the callback cadence is stable.
+  const u32 min_target = GetAlignedBufferSize(m_target_buffer_size / 2);
+  if (!m_stretch_inactive || m_adaptive_target_size <= min_target)
+  {
+    m_adaptive_stable_chunks = 0;
+    return;
+  }
+
+  if (++m_adaptive_stable_chunks >= ADAPTIVE_LATENCY_STABLE_CHUNKS)
+  {
+    m_adaptive_stable_chunks = 0;
+    m_adaptive_target_size = std::max(min_target, m_adaptive_target_size - CHUNK_SIZE);
+    Log_VerbosePrintf("Adaptive latency: target lowered to %u frames (%u ms)", m_adaptive_target_size,
+                      GetMSForBufferSize(m_sample_rate, m_adaptive_target_size));
+  }
+}
+
 void AudioStream::StretchUnderrun()
 {
   // Didn't produce enough frames in time.
   m_stretch_reset++;
+  m_adaptive_underrun = true;
 }
 
 void AudioStream::StretchOverrun()
 {
   // Produced more frames than can fit in the buffer.
   m_stretch_reset++;
+  m_adaptive_underrun = true;
 
   // Drop two packets to give the time stretcher a bit more time to slow things down.
   const u32 discard = CHUNK_SIZE * 2;
@@ -5,9 +5,12 @@
 #include "common/types.h"
 #include <array>
 #include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <thread>
 #include <vector>
 
 #ifdef _MSC_VER
@@ -56,9 +59,18 @@ public:
   ALWAYS_INLINE u32 GetOutputVolume() const { return m_volume; }
   ALWAYS_INLINE float GetNominalTempo() const { return m_nominal_rate; }
   ALWAYS_INLINE bool IsPaused() const { return m_paused; }
+  ALWAYS_INLINE bool IsNullSink() const { return m_null_sink; }
+
+  /// Total frames pushed into a null sink. Consumption is accounted at write time, so this is a
+  /// deterministic clock for headless runs, independent of any audio callback cadence.
+  ALWAYS_INLINE u64 GetNullSinkFramePosition() const { return m_null_sink_frame_position; }
 
   u32 GetBufferedFramesRelaxed() const;
 
+  /// Audio thread callback statistics, for the performance overlay.
+  ALWAYS_INLINE u32 GetWakeupCount() const { return m_wakeup_count.load(std::memory_order_relaxed); }
+  ALWAYS_INLINE u32 GetUnderrunCount() const { return m_underrun_count.load(std::memory_order_relaxed); }
+
   /// Temporarily pauses the stream, preventing it from requesting data.
   virtual void SetPaused(bool paused);
 
@@ -79,6 +91,10 @@ public:
 
   static std::unique_ptr<AudioStream> CreateNullStream(u32 sample_rate, u32 channels, u32 buffer_ms);
 
+  /// Creates a stream which discards everything written to it, without allocating the ring buffer
+  /// or the stretcher. Use for headless/batch runs where output is never consumed.
+  static std::unique_ptr<AudioStream> CreateNullSinkStream(u32 sample_rate, u32 channels);
+
 #ifdef WITH_CUBEB
   static std::unique_ptr<AudioStream> CreateCubebAudioStream(u32 sample_rate, u32 channels, u32 buffer_ms,
                                                              u32 latency_ms, AudioStretchMode stretch);
@@ -105,6 +121,7 @@ protected:
   bool m_stretch_inactive = false;
   bool m_filling = false;
   bool m_paused = false;
+  bool m_null_sink = false;
 
 private:
   enum : u32
@@ -113,6 +130,12 @@ private:
     AVERAGING_WINDOW = 50,
     STRETCH_RESET_THRESHOLD = 5,
     TARGET_IPS = 691,
+
+    // ~3 seconds of stable cadence before each step down towards half the configured target.
+    ADAPTIVE_LATENCY_STABLE_CHUNKS = 2048,
+
+    // Raw chunks queued to the stretch worker, ~90ms. Must be a power of two of chunks.
+    STRETCH_QUEUE_CHUNKS = 64,
   };
 
   void AllocateBuffer();
@@ -122,24 +145,39 @@ private:
 
   void StretchAllocate();
   void StretchDestroy();
-  void StretchWrite();
+  void StretchWriteChunk(const s32* chunk);
+  void StretchEnqueue();
+  void StretchWorkerThread();
   void StretchUnderrun();
   void StretchOverrun();
 
   float AddAndGetAverageTempo(float val);
   void UpdateStretchTempo();
+  void UpdateAdaptiveLatency();
 
   u32 m_buffer_size = 0;
   std::unique_ptr<s32[]> m_buffer;
 
+  u64 m_null_sink_frame_position = 0;
+
   std::atomic<u32> m_rpos{0};
   std::atomic<u32> m_wpos{0};
 
+  // incremented on the audio thread, read by the overlay
+  std::atomic<u32> m_wakeup_count{0};
+  std::atomic<u32> m_underrun_count{0};
+
   std::unique_ptr<soundtouch::SoundTouch> m_soundtouch;
 
   u32 m_target_buffer_size = 0;
   u32 m_stretch_reset = STRETCH_RESET_THRESHOLD;
 
+  // Effective target latency. Walks down from m_target_buffer_size while the callback cadence is
+  // stable, and snaps back to it on any underrun/overrun.
+  u32 m_adaptive_target_size = 0;
+  u32 m_adaptive_stable_chunks = 0;
+  bool m_adaptive_underrun = false;
+
   u32 m_stretch_ok_count = 0;
   float m_nominal_rate = 1.0f;
   float m_dynamic_target_usage = 0.0f;
@@ -150,9 +188,24 @@ private:
 
   std::array<float, AVERAGING_BUFFER_SIZE> m_average_fullness = {};
 
-  // temporary staging buffer, used for timestretching
+  // Stretch worker for TimeStretch mode; the emulation thread deposits raw chunks into the
+  // lock-free ring and SoundTouch runs on the worker. m_soundtouch_mutex serializes control
+  // operations (tempo/clear/teardown) against chunk processing.
+  std::unique_ptr<s32[]> m_stretch_queue;
+  std::atomic<u32> m_stretch_queue_rpos{0};
+  std::atomic<u32> m_stretch_queue_wpos{0};
+  std::thread m_stretch_thread;
+  std::mutex m_stretch_queue_mutex;
+  std::condition_variable m_stretch_queue_cv;
+  std::mutex m_soundtouch_mutex;
+  bool m_stretch_thread_shutdown = false;
+
+  // temporary staging buffer, written by the emulation thread
   alignas(16) std::array<s32, CHUNK_SIZE> m_staging_buffer;
 
+  // output scratch for the stretch path, so it doesn't stomp on the staging buffer
+  alignas(16) std::array<s32, CHUNK_SIZE> m_stretch_out_buffer;
+
   // float buffer, soundtouch only accepts float samples as input
   alignas(16) std::array<float, CHUNK_SIZE * MAX_CHANNELS> m_float_buffer;
 };
@@ -219,36 +219,45 @@ bool CDImage::Seek(u32 track_number, LBA lba)
 
 u32 CDImage::Read(ReadMode read_mode, u32 sector_count, void* buffer)
 {
+  // Raw reads need no deinterleaving, pass the caller's buffer straight through to the vectored read.
+  if (read_mode == ReadMode::RawSector)
+    return ReadRawSectors(buffer, sector_count);
+
+  // Otherwise read in chunks, so multi-sector extent reads still hit the vectored path in the image
+  // backend instead of one dispatch per sector.
+  static constexpr u32 CHUNK_SECTORS = 8;
+  u8 chunk[CHUNK_SECTORS * RAW_SECTOR_SIZE];
+
   u8* buffer_ptr = static_cast<u8*>(buffer);
   u32 sectors_read = 0;
-  for (; sectors_read < sector_count; sectors_read++)
+  while (sectors_read < sector_count)
   {
-    // get raw sector
-    u8 raw_sector[RAW_SECTOR_SIZE];
-    if (!ReadRawSector(raw_sector, nullptr))
-      break;
-
-    switch (read_mode)
+    const u32 this_count = std::min(sector_count - sectors_read, CHUNK_SECTORS);
+    const u32 this_read = ReadRawSectors(chunk, this_count);
+    const u8* chunk_ptr = chunk;
+    for (u32 i = 0; i < this_read; i++, chunk_ptr += RAW_SECTOR_SIZE)
     {
-      case ReadMode::DataOnly:
-        std::memcpy(buffer_ptr, raw_sector + 24, DATA_SECTOR_SIZE);
-        buffer_ptr += DATA_SECTOR_SIZE;
-        break;
-
-      case ReadMode::RawNoSync:
-        std::memcpy(buffer_ptr, raw_sector + SECTOR_SYNC_SIZE, RAW_SECTOR_SIZE - SECTOR_SYNC_SIZE);
-        buffer_ptr += RAW_SECTOR_SIZE - SECTOR_SYNC_SIZE;
-        break;
-
-      case ReadMode::RawSector:
-        std::memcpy(buffer_ptr, raw_sector, RAW_SECTOR_SIZE);
-        buffer_ptr += RAW_SECTOR_SIZE;
-        break;
-
-      default:
-        UnreachableCode();
-        break;
+      switch (read_mode)
+      {
+        case ReadMode::DataOnly:
+          std::memcpy(buffer_ptr, chunk_ptr + 24, DATA_SECTOR_SIZE);
+          buffer_ptr += DATA_SECTOR_SIZE;
+          break;
+
+        case ReadMode::RawNoSync:
+          std::memcpy(buffer_ptr, chunk_ptr + SECTOR_SYNC_SIZE, RAW_SECTOR_SIZE - SECTOR_SYNC_SIZE);
+          buffer_ptr += RAW_SECTOR_SIZE - SECTOR_SYNC_SIZE;
+          break;
+
+        default:
+          UnreachableCode();
+          break;
+      }
     }
+
+    sectors_read += this_read;
+    if (this_read != this_count)
+      break;
   }
 
   return sectors_read;
@@ -302,8 +311,72 @@ bool CDImage::ReadRawSector(void* buffer, SubChannelQ* subq)
   return true;
 }
 
+u32 CDImage::ReadRawSectors(void* buffer, u32 sector_count)
+{
+  u8* buffer_ptr = static_cast<u8*>(buffer);
+  u32 sectors_read = 0;
+  while (sectors_read < sector_count)
+  {
+    if (m_position_in_index == m_current_index->length)
+    {
+      if (!Seek(m_position_on_disc))
+        break;
+    }
+
+    // Read as much as possible from the current index without crossing into the next one.
+    const u32 this_count = std::min(sector_count - sectors_read, m_current_index->length - m_position_in_index);
+    u32 this_read;
+    if (m_current_index->file_sector_size > 0)
+    {
+      this_read = ReadSectorsFromIndex(buffer_ptr, *m_current_index, m_position_in_index, this_count);
+      if (this_read == 0)
+      {
+        Log_ErrorPrintf("Read of LBA %u failed", m_position_on_disc);
+        Seek(m_position_on_disc);
+        break;
+      }
+    }
+    else
+    {
+      // Lead-out area, or an implicit pregap. Return the same filler as ReadRawSector().
+      const u8 fill_value = (m_current_index->track_number == LEAD_OUT_TRACK_NUMBER) ? u8(0xAA) : u8(0);
+      std::fill(buffer_ptr, buffer_ptr + (static_cast<size_t>(this_count) * RAW_SECTOR_SIZE), fill_value);
+      this_read = this_count;
+    }
+
+    m_position_on_disc += this_read;
+    m_position_in_index += this_read;
+    m_position_in_track += this_read;
+    buffer_ptr += static_cast<size_t>(this_read) * RAW_SECTOR_SIZE;
+    sectors_read += this_read;
+    if (this_read != this_count)
+      break;
+  }
+
+  return sectors_read;
+}
+
+u32 CDImage::ReadSectorsFromIndex(void* buffer, const Index& index, LBA lba_in_index, u32 sector_count)
+{
+  u8* buffer_ptr = static_cast<u8*>(buffer);
+  for (u32 i = 0; i < sector_count; i++, buffer_ptr += RAW_SECTOR_SIZE)
+  {
+    if (!ReadSectorFromIndex(buffer_ptr, index, lba_in_index + i))
+      return i;
+  }
+
+  return sector_count;
+}
+
 bool CDImage::ReadSubChannelQ(SubChannelQ* subq, const Index& index, LBA lba_in_index)
 {
+  const LBA lba = index.start_lba_on_disc + lba_in_index;
+  if (lba < static_cast<LBA>(m_subq_table.size()))
+  {
+    *subq = m_subq_table[lba];
+    return true;
+  }
+
   GenerateSubChannelQ(subq, index, lba_in_index);
   return true;
 }
@@ -369,6 +442,7 @@ void CDImage::ClearTOC()
   m_position_in_index = 0;
   m_position_in_track = 0;
   m_position_on_disc = 0;
+  m_subq_table.clear();
 }
 
 void CDImage::CopyTOC(const CDImage* image)
@@ -396,6 +470,7 @@ void CDImage::CopyTOC(const CDImage* image)
   m_position_in_index = 0;
   m_position_in_track = 0;
   m_position_on_disc = 0;
+  PrecomputeSubChannelQ();
 }
 
 const CDImage::Index* CDImage::GetIndexForDiscPosition(LBA pos)
@@ -478,6 +553,27 @@ void CDImage::AddLeadOutIndex()
   index.index_number = 0;
   index.control.bits = last_index.control.bits;
   m_indices.push_back(index);
+
+  // every backend adds the lead-out last, so the TOC is complete at this point
+  PrecomputeSubChannelQ();
+}
+
+void CDImage::PrecomputeSubChannelQ()
+{
+  if (m_indices.empty())
+  {
+    m_subq_table.clear();
+    return;
+  }
+
+  const Index& last_index = m_indices.back();
+  m_subq_table.resize(last_index.start_lba_on_disc + last_index.length);
+
+  for (const Index& index : m_indices)
+  {
+    for (u32 offset = 0; offset < index.length; offset++)
+      GenerateSubChannelQ(&m_subq_table[index.start_lba_on_disc + offset], index, offset);
+  }
 }
 
 u16 CDImage::SubChannelQ::ComputeCRC(const Data& data)
@@ -239,6 +239,8 @@ public:
   static std::unique_ptr<CDImage> OpenDeviceImage(const char* filename, Error* error);
   static std::unique_ptr<CDImage>
   CreateMemoryImage(CDImage* image, ProgressCallback* progress = ProgressCallback::NullProgressCallback);
+  static std::unique_ptr<CDImage>
+  CreateCompressedMemoryImage(CDImage* image, ProgressCallback* progress = ProgressCallback::NullProgressCallback);
   static std::unique_ptr<CDImage> OverlayPPFPatch(const char* filename, std::unique_ptr<CDImage> parent_image,
                                                   ProgressCallback* progress = ProgressCallback::NullProgressCallback);
 
@@ -285,6 +287,11 @@ public:
   // Read a single raw sector, and subchannel from the current LBA.
   bool ReadRawSector(void* buffer, SubChannelQ* subq);
 
+  // Reads multiple raw sectors from the current LBA, without subchannel data. Returns the number
+  // of sectors read, advancing the position past them. Avoids the per-sector index lookup and
+  // dispatch overhead of calling ReadRawSector() in a loop.
+  u32 ReadRawSectors(void* buffer, u32 sector_count);
+
   // Reads sub-channel Q for the specified index+LBA.
   virtual bool ReadSubChannelQ(SubChannelQ* subq, const Index& index, LBA lba_in_index);
 
@@ -294,6 +301,10 @@ public:
   // Reads a single sector from an index.
   virtual bool ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_in_index) = 0;
 
+  // Reads a run of contiguous sectors from an index, returning the number read. The default
+  // implementation loops ReadSectorFromIndex(); backends override it to batch the work.
+  virtual u32 ReadSectorsFromIndex(void* buffer, const Index& index, LBA lba_in_index, u32 sector_count);
+
   // Retrieve image metadata.
   virtual std::string GetMetadata(const std::string_view& type) const;
 
@@ -332,11 +343,16 @@ protected:
   /// Synthesis of lead-out data.
   void AddLeadOutIndex();
 
+  /// Precomputes the generated sub-channel Q stream for the whole disc, including the lead-out,
+  /// so per-sector reads become an indexed load instead of position math and a CRC.
+  void PrecomputeSubChannelQ();
+
   std::string m_filename;
   u32 m_lba_count = 0;
 
   std::vector<Track> m_tracks;
   std::vector<Index> m_indices;
+  std::vector<SubChannelQ> m_subq_table;
 
 private:
   // Position on disc.
@@ -7,6 +7,15 @@
 #include "common/file_system.h"
 #include "common/log.h"
 #include <cerrno>
+#include <cstring>
+
+#ifdef _WIN32
+#include "common/windows_headers.h"
+#include <io.h>
+#else
+#include <sys/mman.h>
+#endif
+
 Log_SetChannel(CDImageBin);
 
 class CDImageBin : public CDImage
@@ -22,11 +31,23 @@ public:
 
 protected:
   bool ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_in_index) override;
+  u32 ReadSectorsFromIndex(void* buffer, const Index& index, LBA lba_in_index, u32 sector_count) override;
 
 private:
+  bool MapFile();
+  void UnmapFile();
+
   std::FILE* m_fp = nullptr;
   u64 m_file_position = 0;
 
+  // Read-only mapping of the image, shared with the OS page cache. Reads fall back to stdio if
+  // mapping the file fails (e.g. it is larger than the address space on 32-bit hosts).
+  const u8* m_mmap_base = nullptr;
+  u64 m_mmap_size = 0;
+#ifdef _WIN32
+  void* m_mmap_handle = nullptr;
+#endif
+
   CDSubChannelReplacement m_sbi;
 };
 
@@ -34,10 +55,61 @@ CDImageBin::CDImageBin() = default;
 
 CDImageBin::~CDImageBin()
 {
+  UnmapFile();
+
   if (m_fp)
     std::fclose(m_fp);
 }
 
+bool CDImageBin::MapFile()
+{
+  if (m_mmap_size == 0)
+    return false;
+
+#ifdef _WIN32
+  const HANDLE file = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(m_fp)));
+  if (file == INVALID_HANDLE_VALUE)
+    return false;
+
+  m_mmap_handle = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!m_mmap_handle)
+    return false;
+
+  m_mmap_base = static_cast<const u8*>(MapViewOfFile(m_mmap_handle, FILE_MAP_READ, 0, 0, 0));
+  if (!m_mmap_base)
+  {
+    CloseHandle(m_mmap_handle);
+    m_mmap_handle = nullptr;
+    return false;
+  }
+#else
+  void* base = mmap(nullptr, static_cast<size_t>(m_mmap_size), PROT_READ, MAP_SHARED, fileno(m_fp), 0);
+  if (base == MAP_FAILED)
+    return false;
+
+  m_mmap_base = static_cast<const u8*>(base);
+#endif
+
+  return true;
+}
+
+void CDImageBin::UnmapFile()
+{
+  if (!m_mmap_base)
+    return;
+
+#ifdef _WIN32
+  UnmapViewOfFile(const_cast<u8*>(m_mmap_base));
+  CloseHandle(m_mmap_handle);
+  m_mmap_handle = nullptr;
+#else
+  munmap(const_cast<u8*>(m_mmap_base), static_cast<size_t>(m_mmap_size));
+#endif
+
+  m_mmap_base = nullptr;
+  m_mmap_size = 0;
+}
+
 bool CDImageBin::Open(const char* filename, Error* error)
 {
   m_filename = filename;
@@ -50,6 +122,8 @@ bool CDImageBin::Open(const char* filename, Error* error)
     return false;
   }
 
+  FileSystem::HintSequentialAccess(m_fp);
+
   const u32 track_sector_size = RAW_SECTOR_SIZE;
 
   // determine the length from the file
@@ -59,6 +133,12 @@ bool CDImageBin::Open(const char* filename, Error* error)
 
   m_lba_count = file_size / track_sector_size;
 
+  m_mmap_size = ZeroExtend64(file_size);
+  if (MapFile())
+    Log_DevPrintf("Mapped '%s' (%u bytes), reads will come from the shared page cache", filename, file_size);
+  else
+    m_mmap_size = 0;
+
   SubChannelQ::Control control = {};
   TrackMode mode = TrackMode::Mode2Raw;
   control.data = mode != TrackMode::Audio;
@@ -118,6 +198,15 @@ bool CDImageBin::HasNonStandardSubchannel() const
 bool CDImageBin::ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_in_index)
 {
   const u64 file_position = index.file_offset + (static_cast<u64>(lba_in_index) * index.file_sector_size);
+  if (m_mmap_base)
+  {
+    if ((file_position + index.file_sector_size) > m_mmap_size)
+      return false;
+
+    std::memcpy(buffer, m_mmap_base + file_position, index.file_sector_size);
+    return true;
+  }
+
   if (m_file_position != file_position)
   {
     if (std::fseek(m_fp, static_cast<long>(file_position), SEEK_SET) != 0)
@@ -136,6 +225,37 @@ bool CDImageBin::ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_i
   return true;
 }
 
+u32 CDImageBin::ReadSectorsFromIndex(void* buffer, const Index& index, LBA lba_in_index, u32 sector_count)
+{
+  // Sectors are stored back-to-back at RAW_SECTOR_SIZE, so the whole run can be serviced with a
+  // single copy or read.
+  const u64 file_position = index.file_offset + (static_cast<u64>(lba_in_index) * index.file_sector_size);
+  const u64 read_size = static_cast<u64>(sector_count) * index.file_sector_size;
+  if (m_mmap_base)
+  {
+    if ((file_position + read_size) > m_mmap_size)
+      return CDImage::ReadSectorsFromIndex(buffer, index, lba_in_index, sector_count);
+
+    std::memcpy(buffer, m_mmap_base + file_position, static_cast<size_t>(read_size));
+    return sector_count;
+  }
+
+  if (m_file_position != file_position)
+  {
+    if (std::fseek(m_fp, static_cast<long>(file_position), SEEK_SET) != 0)
+      return 0;
+
+    m_file_position = file_position;
+  }
+
+  const u32 sectors_read = static_cast<u32>(std::fread(buffer, index.file_sector_size, sector_count, m_fp));
+  m_file_position += static_cast<u64>(sectors_read) * index.file_sector_size;
+  if (sectors_read != sector_count)
+    std::fseek(m_fp, static_cast<long>(m_file_position), SEEK_SET);
+
+  return sectors_read;
+}
+
 std::unique_ptr<CDImage> CDImage::OpenBinImage(const char* filename, Error* error)
 {
   std::unique_ptr<CDImageBin> image = std::make_unique<CDImageBin>();
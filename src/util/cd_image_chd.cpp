@@ -13,20 +13,26 @@
 #include "common/error.h"
 #include "common/file_system.h"
 #include "common/log.h"
+#include "common/lru_cache.h"
 #include "common/path.h"
 #include "common/platform.h"
 #include "common/string_util.h"
+#include "common/thirdparty/thread_pool.h"
 
 #include "fmt/format.h"
 #include "libchdr/chd.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cerrno>
 #include <cstdio>
 #include <cstring>
 #include <limits>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <vector>
 
 Log_SetChannel(CDImageCHD);
 
@@ -68,26 +74,46 @@ public:
 
 protected:
   bool ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_in_index) override;
+  u32 ReadSectorsFromIndex(void* buffer, const Index& index, LBA lba_in_index, u32 sector_count) override;
 
 private:
   enum : u32
   {
     CHD_CD_SECTOR_DATA_SIZE = 2352 + 96,
     CHD_CD_TRACK_ALIGNMENT = 4,
-    MAX_PARENTS = 32 // Surely someone wouldn't be insane enough to go beyond this...
+    MAX_PARENTS = 32, // Surely someone wouldn't be insane enough to go beyond this...
+    MAX_CACHED_HUNKS = 32,
+    PREFETCH_HUNK_COUNT = 2
   };
 
   chd_file* OpenCHD(const char* filename, FileSystem::ManagedCFilePtr fp, Error* error, u32 recursion_level);
-  bool ReadHunk(u32 hunk_index);
+
+  /// Copies one sector out of the given hunk, decompressing and caching it on a miss.
+  bool ReadHunkSector(u32 hunk_index, u32 hunk_offset, void* buffer, bool swap_audio);
+
+  /// Copies a run of sectors out of the given hunk under a single cache lookup.
+  bool ReadHunkSectors(u32 hunk_index, u32 first_sector, u32 sector_count, void* buffer, bool swap_audio);
+
+  /// Serializes chd_read() between the reader and the prefetch worker.
+  bool DecompressHunk(u32 hunk_index, std::vector<u8>* data);
+
+  void QueuePrefetch(u32 next_hunk_index);
+  void PrefetchHunks(u32 start_hunk_index);
 
   chd_file* m_chd = nullptr;
   u32 m_hunk_size = 0;
+  u32 m_hunk_count = 0;
   u32 m_sectors_per_hunk = 0;
-
-  std::vector<u8> m_hunk_buffer;
-  u32 m_current_hunk_index = static_cast<u32>(-1);
   bool m_precached = false;
 
+  // Decompressed hunks, least-recently-used first out. The prefetch worker inserts into the cache from its
+  // own thread, so both lookups and insertions take m_cache_mutex.
+  LRUCache<u32, std::vector<u8>> m_hunk_cache{MAX_CACHED_HUNKS};
+  std::mutex m_cache_mutex;
+  std::mutex m_chd_mutex;
+  std::unique_ptr<cb::ThreadPool> m_prefetch_pool;
+  std::atomic_bool m_prefetch_busy{false};
+
   CDSubChannelReplacement m_sbi;
 };
 } // namespace
@@ -96,6 +122,9 @@ CDImageCHD::CDImageCHD() = default;
 
 CDImageCHD::~CDImageCHD()
 {
+  // Drain the prefetch worker before tearing down the file it reads from.
+  m_prefetch_pool.reset();
+
   if (m_chd)
     chd_close(m_chd);
 }
@@ -213,7 +242,8 @@ bool CDImageCHD::Open(const char* filename, Error* error)
   }
 
   m_sectors_per_hunk = m_hunk_size / CHD_CD_SECTOR_DATA_SIZE;
-  m_hunk_buffer.resize(m_hunk_size);
+  m_hunk_count = header->totalhunks;
+  m_prefetch_pool = std::make_unique<cb::ThreadPool>(1);
   m_filename = filename;
 
   u32 disc_lba = 0;
@@ -391,8 +421,11 @@ CDImage::PrecacheResult CDImageCHD::Precache(ProgressCallback* progress)
     static_cast<ProgressCallback*>(param)->SetProgressValue(std::min<u32>(percent, 100));
   };
 
-  if (chd_precache_progress(m_chd, callback, progress) != CHDERR_NONE)
-    return CDImage::PrecacheResult::ReadError;
+  {
+    std::unique_lock<std::mutex> lock(m_chd_mutex);
+    if (chd_precache_progress(m_chd, callback, progress) != CHDERR_NONE)
+      return CDImage::PrecacheResult::ReadError;
+  }
 
   m_precached = true;
   return CDImage::PrecacheResult::Success;
@@ -450,34 +483,155 @@ bool CDImageCHD::ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_i
   const u32 hunk_offset = static_cast<u32>((disc_frame % m_sectors_per_hunk) * CHD_CD_SECTOR_DATA_SIZE);
   DebugAssert((m_hunk_size - hunk_offset) >= CHD_CD_SECTOR_DATA_SIZE);
 
-  if (m_current_hunk_index != hunk_index && !ReadHunk(hunk_index))
+  // Audio data is in big-endian, so we have to swap it for little endian hosts...
+  if (!ReadHunkSector(hunk_index, hunk_offset, buffer, index.mode == TrackMode::Audio))
     return false;
 
-  // Audio data is in big-endian, so we have to swap it for little endian hosts...
-  if (index.mode == TrackMode::Audio)
-    CopyAndSwap(buffer, &m_hunk_buffer[hunk_offset], RAW_SECTOR_SIZE);
+  QueuePrefetch(hunk_index + 1);
+  return true;
+}
+
+u32 CDImageCHD::ReadSectorsFromIndex(void* buffer, const Index& index, LBA lba_in_index, u32 sector_count)
+{
+  u8* buffer_ptr = static_cast<u8*>(buffer);
+  u32 sectors_read = 0;
+  while (sectors_read < sector_count)
+  {
+    const u32 disc_frame = static_cast<LBA>(index.file_offset) + lba_in_index + sectors_read;
+    const u32 hunk_index = static_cast<u32>(disc_frame / m_sectors_per_hunk);
+    const u32 sector_in_hunk = static_cast<u32>(disc_frame % m_sectors_per_hunk);
+    const u32 this_count = std::min(sector_count - sectors_read, m_sectors_per_hunk - sector_in_hunk);
+    if (!ReadHunkSectors(hunk_index, sector_in_hunk, this_count, buffer_ptr, index.mode == TrackMode::Audio))
+      break;
+
+    QueuePrefetch(hunk_index + 1);
+    buffer_ptr += static_cast<size_t>(this_count) * RAW_SECTOR_SIZE;
+    sectors_read += this_count;
+  }
+
+  return sectors_read;
+}
+
+bool CDImageCHD::ReadHunkSector(u32 hunk_index, u32 hunk_offset, void* buffer, bool swap_audio)
+{
+  {
+    std::unique_lock<std::mutex> lock(m_cache_mutex);
+    if (const std::vector<u8>* data = m_hunk_cache.Lookup(hunk_index))
+    {
+      if (swap_audio)
+        CopyAndSwap(buffer, &(*data)[hunk_offset], RAW_SECTOR_SIZE);
+      else
+        std::memcpy(buffer, &(*data)[hunk_offset], RAW_SECTOR_SIZE);
+
+      return true;
+    }
+  }
+
+  std::vector<u8> data(m_hunk_size);
+  if (!DecompressHunk(hunk_index, &data))
+    return false;
+
+  // Copy the sector out under the lock; the prefetch worker can evict the entry once it's released.
+  std::unique_lock<std::mutex> lock(m_cache_mutex);
+  const std::vector<u8>* stored = m_hunk_cache.Insert(hunk_index, std::move(data));
+  if (swap_audio)
+    CopyAndSwap(buffer, &(*stored)[hunk_offset], RAW_SECTOR_SIZE);
   else
-    std::memcpy(buffer, &m_hunk_buffer[hunk_offset], RAW_SECTOR_SIZE);
+    std::memcpy(buffer, &(*stored)[hunk_offset], RAW_SECTOR_SIZE);
 
   return true;
 }
 
-bool CDImageCHD::ReadHunk(u32 hunk_index)
+bool CDImageCHD::ReadHunkSectors(u32 hunk_index, u32 first_sector, u32 sector_count, void* buffer, bool swap_audio)
 {
-  const chd_error err = chd_read(m_chd, hunk_index, m_hunk_buffer.data());
+  DebugAssert((first_sector + sector_count) <= m_sectors_per_hunk);
+
+  const auto copy_sectors = [&](const std::vector<u8>& data) {
+    u8* buffer_ptr = static_cast<u8*>(buffer);
+    u32 hunk_offset = first_sector * CHD_CD_SECTOR_DATA_SIZE;
+    for (u32 i = 0; i < sector_count; i++, hunk_offset += CHD_CD_SECTOR_DATA_SIZE, buffer_ptr += RAW_SECTOR_SIZE)
+    {
+      if (swap_audio)
+        CopyAndSwap(buffer_ptr, &data[hunk_offset], RAW_SECTOR_SIZE);
+      else
+        std::memcpy(buffer_ptr, &data[hunk_offset], RAW_SECTOR_SIZE);
+    }
+  };
+
+  {
+    std::unique_lock<std::mutex> lock(m_cache_mutex);
+    if (const std::vector<u8>* data = m_hunk_cache.Lookup(hunk_index))
+    {
+      copy_sectors(*data);
+      return true;
+    }
+  }
+
+  std::vector<u8> data(m_hunk_size);
+  if (!DecompressHunk(hunk_index, &data))
+    return false;
+
+  std::unique_lock<std::mutex> lock(m_cache_mutex);
+  copy_sectors(*m_hunk_cache.Insert(hunk_index, std::move(data)));
+  return true;
+}
+
+bool CDImageCHD::DecompressHunk(u32 hunk_index, std::vector<u8>* data)
+{
+  std::unique_lock<std::mutex> lock(m_chd_mutex);
+  const chd_error err = chd_read(m_chd, hunk_index, data->data());
   if (err != CHDERR_NONE)
   {
     Log_ErrorPrintf("chd_read(%u) failed: %s", hunk_index, chd_error_string(err));
-
-    // data might have been partially written
-    m_current_hunk_index = static_cast<u32>(-1);
     return false;
   }
 
-  m_current_hunk_index = hunk_index;
   return true;
 }
 
+void CDImageCHD::QueuePrefetch(u32 next_hunk_index)
+{
+  if (!m_prefetch_pool || next_hunk_index >= m_hunk_count)
+    return;
+
+  {
+    std::unique_lock<std::mutex> lock(m_cache_mutex);
+    if (m_hunk_cache.Lookup(next_hunk_index))
+      return;
+  }
+
+  // Leave the current prefetch alone if it's still running; the reader will queue another one when it
+  // crosses into the next hunk anyway.
+  bool expected = false;
+  if (!m_prefetch_busy.compare_exchange_strong(expected, true))
+    return;
+
+  m_prefetch_pool->Schedule([this, next_hunk_index]() {
+    PrefetchHunks(next_hunk_index);
+    m_prefetch_busy.store(false);
+  });
+}
+
+void CDImageCHD::PrefetchHunks(u32 start_hunk_index)
+{
+  const u32 end_hunk_index = std::min(start_hunk_index + PREFETCH_HUNK_COUNT, m_hunk_count);
+  for (u32 hunk_index = start_hunk_index; hunk_index < end_hunk_index; hunk_index++)
+  {
+    {
+      std::unique_lock<std::mutex> lock(m_cache_mutex);
+      if (m_hunk_cache.Lookup(hunk_index))
+        continue;
+    }
+
+    std::vector<u8> data(m_hunk_size);
+    if (!DecompressHunk(hunk_index, &data))
+      return;
+
+    std::unique_lock<std::mutex> lock(m_cache_mutex);
+    m_hunk_cache.Insert(hunk_index, std::move(data));
+  }
+}
+
 std::unique_ptr<CDImage> CDImage::OpenCHDImage(const char* filename, Error* error)
 {
   std::unique_ptr<CDImageCHD> image = std::make_unique<CDImageCHD>();
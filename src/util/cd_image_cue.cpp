@@ -33,13 +33,15 @@ public:
 
 protected:
   bool ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_in_index) override;
+  u32 ReadSectorsFromIndex(void* buffer, const Index& index, LBA lba_in_index, u32 sector_count) override;
 
 private:
+  // Handles carry no seek state, all reads are positional. This keeps multi-bin images from
+  // re-seeking when data and audio track reads interleave, and stays safe if reads ever overlap.
   struct TrackFile
   {
     std::string filename;
     std::FILE* file;
-    u64 file_position;
   };
 
   std::vector<TrackFile> m_files;
@@ -124,7 +126,8 @@ bool CDImageCueSheet::OpenAndParse(const char* filename, Error* error)
         return false;
       }
 
-      m_files.push_back(TrackFile{std::move(track_filename), track_fp, 0});
+      FileSystem::HintSequentialAccess(track_fp);
+      m_files.push_back(TrackFile{std::move(track_filename), track_fp});
     }
 
     // data type determines the sector size
@@ -142,9 +145,7 @@ bool CDImageCueSheet::OpenAndParse(const char* filename, Error* error)
     LBA track_length;
     if (!track->length.has_value())
     {
-      FileSystem::FSeek64(m_files[track_file_index].file, 0, SEEK_END);
-      u64 file_size = static_cast<u64>(FileSystem::FTell64(m_files[track_file_index].file));
-      FileSystem::FSeek64(m_files[track_file_index].file, 0, SEEK_SET);
+      u64 file_size = static_cast<u64>(std::max<s64>(FileSystem::FSize64(m_files[track_file_index].file), 0));
 
       file_size /= track_sector_size;
       if (track_start >= file_size)
@@ -312,24 +313,26 @@ bool CDImageCueSheet::ReadSectorFromIndex(void* buffer, const Index& index, LBA
 {
   DebugAssert(index.file_index < m_files.size());
 
-  TrackFile& tf = m_files[index.file_index];
+  const TrackFile& tf = m_files[index.file_index];
   const u64 file_position = index.file_offset + (static_cast<u64>(lba_in_index) * index.file_sector_size);
-  if (tf.file_position != file_position)
-  {
-    if (std::fseek(tf.file, static_cast<long>(file_position), SEEK_SET) != 0)
-      return false;
+  return (FileSystem::ReadFileAtOffset(tf.file, buffer, index.file_sector_size, file_position) ==
+          static_cast<s64>(index.file_sector_size));
+}
 
-    tf.file_position = file_position;
-  }
+u32 CDImageCueSheet::ReadSectorsFromIndex(void* buffer, const Index& index, LBA lba_in_index, u32 sector_count)
+{
+  DebugAssert(index.file_index < m_files.size());
 
-  if (std::fread(buffer, index.file_sector_size, 1, tf.file) != 1)
-  {
-    std::fseek(tf.file, static_cast<long>(tf.file_position), SEEK_SET);
-    return false;
-  }
+  // Raw sectors are stored back-to-back, so the whole run is a single positional read. Other
+  // sector sizes have to land at raw-sector stride in the output, take the per-sector path.
+  if (index.file_sector_size != RAW_SECTOR_SIZE)
+    return CDImage::ReadSectorsFromIndex(buffer, index, lba_in_index, sector_count);
 
-  tf.file_position += index.file_sector_size;
-  return true;
+  const TrackFile& tf = m_files[index.file_index];
+  const u64 file_position = index.file_offset + (static_cast<u64>(lba_in_index) * index.file_sector_size);
+  const u64 read_size = static_cast<u64>(sector_count) * index.file_sector_size;
+  const s64 bytes_read = FileSystem::ReadFileAtOffset(tf.file, buffer, read_size, file_position);
+  return (bytes_read < 0) ? 0 : static_cast<u32>(static_cast<u64>(bytes_read) / index.file_sector_size);
 }
 
 std::unique_ptr<CDImage> CDImage::OpenCueSheetImage(const char* filename, Error* error)
@@ -7,6 +7,7 @@
 #include "common/error.h"
 #include "common/file_system.h"
 #include "common/log.h"
+#include "common/lru_cache.h"
 #include <array>
 #include <cerrno>
 #include <map>
@@ -173,6 +174,11 @@ protected:
   bool ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_in_index) override;
 
 private:
+  enum : u32
+  {
+    MAX_CACHED_SECTORS = 128 // ~300KB of rebuilt sectors
+  };
+
   bool ReadChunks(u32 disc_offset, u32 size);
 
   std::FILE* m_fp = nullptr;
@@ -213,6 +219,9 @@ private:
   std::vector<u8> m_chunk_buffer;
   u32 m_chunk_start = 0;
 
+  // Rebuilt sectors keyed by disc offset, so backwards seeks don't re-read and re-generate ECC.
+  LRUCache<u32, std::vector<u8>> m_sector_cache{MAX_CACHED_SECTORS};
+
   CDSubChannelReplacement m_sbi;
 };
 
@@ -237,6 +246,8 @@ bool CDImageEcm::Open(const char* filename, Error* error)
     return false;
   }
 
+  FileSystem::HintSequentialAccess(m_fp);
+
   s64 file_size;
   if (FileSystem::FSeek64(m_fp, 0, SEEK_END) != 0 || (file_size = FileSystem::FTell64(m_fp)) <= 0 ||
       FileSystem::FSeek64(m_fp, 0, SEEK_SET) != 0)
@@ -524,8 +535,20 @@ bool CDImageEcm::ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_i
 
   if (file_start < m_chunk_start || file_end > (m_chunk_start + m_chunk_buffer.size()))
   {
+    // check the rebuilt-sector cache before re-reading and re-generating ECC
+    const std::vector<u8>* cached_sector = m_sector_cache.Lookup(file_start);
+    if (cached_sector)
+    {
+      std::memcpy(buffer, cached_sector->data(), RAW_SECTOR_SIZE);
+      return true;
+    }
+
     if (!ReadChunks(file_start, RAW_SECTOR_SIZE))
       return false;
+
+    const size_t cache_offset = static_cast<size_t>(file_start - m_chunk_start);
+    m_sector_cache.Insert(file_start, std::vector<u8>(m_chunk_buffer.begin() + cache_offset,
+                                                      m_chunk_buffer.begin() + cache_offset + RAW_SECTOR_SIZE));
   }
 
   DebugAssert(file_start >= m_chunk_start && file_end <= (m_chunk_start + m_chunk_buffer.size()));
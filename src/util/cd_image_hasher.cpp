@@ -5,6 +5,10 @@
 #include "cd_image.h"
 #include "common/md5_digest.h"
 #include "common/string_util.h"
+#include "common/thirdparty/thread_pool.h"
+#include "common/threading.h"
+#include <algorithm>
+#include <future>
 
 namespace CDImageHasher {
 
@@ -12,8 +16,6 @@ static bool ReadIndex(CDImage* image, u8 track, u8 index, MD5Digest* digest, Pro
 {
   const CDImage::LBA index_start = image->GetTrackIndexPosition(track, index);
   const u32 index_length = image->GetTrackIndexLength(track, index);
-  const u32 update_interval = std::max<u32>(index_length / 100u, 1u);
-
   progress_callback->SetFormattedStatusText("Computing hash for track %u/index %u...", track, index);
   progress_callback->SetProgressRange(index_length);
 
@@ -24,19 +26,22 @@ static bool ReadIndex(CDImage* image, u8 track, u8 index, MD5Digest* digest, Pro
     return false;
   }
 
-  std::array<u8, CDImage::RAW_SECTOR_SIZE> sector;
-  for (u32 lba = 0; lba < index_length; lba++)
+  // Read in bulk, the per-sector dispatch overhead adds up over a whole track.
+  static constexpr u32 BATCH_SECTOR_COUNT = 32;
+  std::vector<u8> sectors(BATCH_SECTOR_COUNT * CDImage::RAW_SECTOR_SIZE);
+  for (u32 lba = 0; lba < index_length;)
   {
-    if ((lba % update_interval) == 0)
-      progress_callback->SetProgressValue(lba);
+    progress_callback->SetProgressValue(lba);
 
-    if (!image->ReadRawSector(sector.data(), nullptr))
+    const u32 batch_size = std::min(BATCH_SECTOR_COUNT, index_length - lba);
+    if (image->ReadRawSectors(sectors.data(), batch_size) != batch_size)
     {
       progress_callback->DisplayFormattedModalError("Failed to read sector %u from image", image->GetPositionOnDisc());
       return false;
     }
 
-    digest->Update(sector.data(), static_cast<u32>(sector.size()));
+    digest->Update(sectors.data(), batch_size * CDImage::RAW_SECTOR_SIZE);
+    lba += batch_size;
   }
 
   progress_callback->SetProgressValue(index_length);
@@ -131,4 +136,79 @@ bool GetTrackHash(CDImage* image, u8 track, Hash* out_hash,
   return true;
 }
 
+bool GetTrackHashes(CDImage* image, std::vector<Hash>* out_hashes,
+                    ProgressCallback* progress_callback /*= ProgressCallback::NullProgressCallback*/)
+{
+  const u32 track_count = image->GetTrackCount();
+  out_hashes->clear();
+  out_hashes->resize(track_count);
+
+  progress_callback->SetProgressRange(track_count);
+  progress_callback->SetProgressValue(0);
+
+  // Each worker opens its own handle to the image, so tracks can be hashed concurrently without
+  // touching the caller's handle. Physical devices can't be opened multiple times, and images
+  // which came from memory have no filename to reopen.
+  const u32 num_threads = (track_count > 1 && !CDImage::IsDeviceName(image->GetFileName().c_str())) ?
+                            std::min(track_count, cb::ThreadPool::GetNumLogicalCores()) :
+                            1u;
+  if (num_threads > 1)
+  {
+    const std::string filename(image->GetFileName());
+    std::vector<std::future<bool>> results;
+    results.reserve(track_count);
+
+    {
+      // Tracks hash on the shared pool rather than spinning up a transient worker set of our own.
+      cb::ThreadPool& pool = Threading::GetSharedThreadPool();
+      for (u32 track = 1; track <= track_count; track++)
+      {
+        results.push_back(pool.ScheduleAndGetFuture([&filename, out_hashes, track]() {
+          std::unique_ptr<CDImage> thread_image = CDImage::Open(filename.c_str(), false, nullptr);
+          if (!thread_image)
+            return false;
+
+          MD5Digest digest;
+          if (!ReadTrack(thread_image.get(), static_cast<u8>(track), &digest,
+                         ProgressCallback::NullProgressCallback))
+          {
+            return false;
+          }
+
+          digest.Final((*out_hashes)[track - 1].data());
+          return true;
+        }));
+      }
+
+      bool okay = true;
+      for (u32 track = 1; track <= track_count; track++)
+      {
+        okay &= results[track - 1].get();
+        progress_callback->SetProgressValue(track);
+      }
+      if (okay)
+        return true;
+    }
+
+    // reopening the image failed (e.g. the file went away), fall back to the caller's handle
+    progress_callback->SetProgressValue(0);
+  }
+
+  for (u32 track = 1; track <= track_count; track++)
+  {
+    progress_callback->SetProgressValue(track - 1);
+    progress_callback->PushState();
+    if (!GetTrackHash(image, static_cast<u8>(track), &(*out_hashes)[track - 1], progress_callback))
+    {
+      progress_callback->PopState();
+      return false;
+    }
+
+    progress_callback->PopState();
+  }
+
+  progress_callback->SetProgressValue(track_count);
+  return true;
+}
+
 } // namespace CDImageHasher
\ No newline at end of file
@@ -6,9 +6,12 @@
 #include "common/assert.h"
 #include "common/file_system.h"
 #include "common/log.h"
+#include "common/lru_cache.h"
 #include "common/path.h"
+#include "zstd.h"
 #include <algorithm>
 #include <cerrno>
+#include <vector>
 Log_SetChannel(CDImageMemory);
 
 class CDImageMemory : public CDImage
@@ -151,6 +154,205 @@ bool CDImageMemory::ReadSectorFromIndex(void* buffer, const Index& index, LBA lb
   return true;
 }
 
+// Same as CDImageMemory, but stores the sectors zstd-compressed in fixed-size chunks, with a small
+// MRU window of decompressed chunks. Trades a cheap decompress on window misses for holding the
+// whole image in a fraction of the RAM, which matters on low-memory devices.
+class CDImageCompressedMemory : public CDImage
+{
+public:
+  CDImageCompressedMemory();
+  ~CDImageCompressedMemory() override;
+
+  bool CopyImage(CDImage* image, ProgressCallback* progress);
+
+  bool ReadSubChannelQ(SubChannelQ* subq, const Index& index, LBA lba_in_index) override;
+  bool HasNonStandardSubchannel() const override;
+
+  bool IsPrecached() const override;
+
+protected:
+  bool ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_in_index) override;
+
+private:
+  enum : u32
+  {
+    CHUNK_SECTOR_COUNT = 64, // ~147KB decompressed per chunk
+    MAX_CACHED_CHUNKS = 8
+  };
+
+  struct CompressedChunk
+  {
+    u64 data_offset;
+    u32 data_size;
+  };
+
+  const std::vector<u8>* DecompressChunk(u32 chunk_index);
+
+  std::vector<u8> m_compressed_data;
+  std::vector<CompressedChunk> m_chunks;
+  u32 m_memory_sectors = 0;
+
+  // Decompressed chunks, least-recently-used first out. Only ever touched from the reader thread.
+  LRUCache<u32, std::vector<u8>> m_chunk_cache{MAX_CACHED_CHUNKS};
+
+  CDSubChannelReplacement m_sbi;
+};
+
+CDImageCompressedMemory::CDImageCompressedMemory() = default;
+
+CDImageCompressedMemory::~CDImageCompressedMemory() = default;
+
+bool CDImageCompressedMemory::CopyImage(CDImage* image, ProgressCallback* progress)
+{
+  // figure out the total number of sectors (not including blank pregaps)
+  m_memory_sectors = 0;
+  for (u32 i = 0; i < image->GetIndexCount(); i++)
+  {
+    const Index& index = image->GetIndex(i);
+    if (index.file_sector_size > 0)
+      m_memory_sectors += image->GetIndex(i).length;
+  }
+
+  progress->SetStatusText("Preloading CD image to RAM (compressed)...");
+  progress->SetProgressRange(m_memory_sectors);
+  progress->SetProgressValue(0);
+
+  m_chunks.reserve((m_memory_sectors + (CHUNK_SECTOR_COUNT - 1)) / CHUNK_SECTOR_COUNT);
+
+  std::vector<u8> staging(static_cast<size_t>(CHUNK_SECTOR_COUNT) * RAW_SECTOR_SIZE);
+  std::vector<u8> compress_buffer(ZSTD_compressBound(staging.size()));
+  u32 staging_sectors = 0;
+
+  const auto flush_chunk = [this, &staging, &compress_buffer, &staging_sectors]() {
+    if (staging_sectors == 0)
+      return true;
+
+    const size_t result = ZSTD_compress(compress_buffer.data(), compress_buffer.size(), staging.data(),
+                                        static_cast<size_t>(staging_sectors) * RAW_SECTOR_SIZE, 1);
+    if (ZSTD_isError(result))
+    {
+      Log_ErrorPrintf("ZSTD_compress() failed: %s", ZSTD_getErrorName(result));
+      return false;
+    }
+
+    m_chunks.push_back(CompressedChunk{m_compressed_data.size(), static_cast<u32>(result)});
+    m_compressed_data.insert(m_compressed_data.end(), compress_buffer.begin(), compress_buffer.begin() + result);
+    staging_sectors = 0;
+    return true;
+  };
+
+  u32 sectors_read = 0;
+  for (u32 i = 0; i < image->GetIndexCount(); i++)
+  {
+    const Index& index = image->GetIndex(i);
+    if (index.file_sector_size == 0)
+      continue;
+
+    for (u32 lba = 0; lba < index.length; lba++)
+    {
+      if (!image->ReadSectorFromIndex(&staging[static_cast<size_t>(staging_sectors) * RAW_SECTOR_SIZE], index, lba))
+      {
+        Log_ErrorPrintf("Failed to read LBA %u in index %u", lba, i);
+        return false;
+      }
+
+      if (++staging_sectors == CHUNK_SECTOR_COUNT && !flush_chunk())
+        return false;
+
+      progress->SetProgressValue(sectors_read);
+      sectors_read++;
+    }
+  }
+  if (!flush_chunk())
+    return false;
+
+  m_compressed_data.shrink_to_fit();
+
+  const u64 uncompressed_size = static_cast<u64>(m_memory_sectors) * RAW_SECTOR_SIZE;
+  Log_InfoPrintf("Compressed %u sectors from %.2f MB to %.2f MB", m_memory_sectors,
+                 static_cast<double>(uncompressed_size) / 1048576.0,
+                 static_cast<double>(m_compressed_data.size()) / 1048576.0);
+
+  for (u32 i = 1; i <= image->GetTrackCount(); i++)
+    m_tracks.push_back(image->GetTrack(i));
+
+  u32 current_offset = 0;
+  for (u32 i = 0; i < image->GetIndexCount(); i++)
+  {
+    Index new_index = image->GetIndex(i);
+    new_index.file_index = 0;
+    if (new_index.file_sector_size > 0)
+    {
+      new_index.file_offset = current_offset;
+      current_offset += new_index.length;
+    }
+    m_indices.push_back(new_index);
+  }
+
+  Assert(current_offset == m_memory_sectors);
+  m_filename = image->GetFileName();
+  m_lba_count = image->GetLBACount();
+
+  m_sbi.LoadSBI(Path::ReplaceExtension(m_filename, "sbi").c_str());
+
+  return Seek(1, Position{0, 0, 0});
+}
+
+bool CDImageCompressedMemory::ReadSubChannelQ(SubChannelQ* subq, const Index& index, LBA lba_in_index)
+{
+  if (m_sbi.GetReplacementSubChannelQ(index.start_lba_on_disc + lba_in_index, subq))
+    return true;
+
+  return CDImage::ReadSubChannelQ(subq, index, lba_in_index);
+}
+
+bool CDImageCompressedMemory::HasNonStandardSubchannel() const
+{
+  return (m_sbi.GetReplacementSectorCount() > 0);
+}
+
+bool CDImageCompressedMemory::IsPrecached() const
+{
+  return true;
+}
+
+const std::vector<u8>* CDImageCompressedMemory::DecompressChunk(u32 chunk_index)
+{
+  const CompressedChunk& chunk = m_chunks[chunk_index];
+  const u32 first_sector = chunk_index * CHUNK_SECTOR_COUNT;
+  const u32 num_sectors = std::min<u32>(CHUNK_SECTOR_COUNT, m_memory_sectors - first_sector);
+
+  std::vector<u8> data(static_cast<size_t>(num_sectors) * RAW_SECTOR_SIZE);
+  const size_t result =
+    ZSTD_decompress(data.data(), data.size(), &m_compressed_data[chunk.data_offset], chunk.data_size);
+  if (ZSTD_isError(result) || result != data.size())
+  {
+    Log_ErrorPrintf("Failed to decompress chunk %u: %s", chunk_index,
+                    ZSTD_isError(result) ? ZSTD_getErrorName(result) : "Size mismatch");
+    return nullptr;
+  }
+
+  return m_chunk_cache.Insert(chunk_index, std::move(data));
+}
+
+bool CDImageCompressedMemory::ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_in_index)
+{
+  DebugAssert(index.file_index == 0);
+
+  const u64 sector_number = index.file_offset + lba_in_index;
+  if (sector_number >= m_memory_sectors)
+    return false;
+
+  const u32 chunk_index = static_cast<u32>(sector_number / CHUNK_SECTOR_COUNT);
+  const std::vector<u8>* chunk = m_chunk_cache.Lookup(chunk_index);
+  if (!chunk && !(chunk = DecompressChunk(chunk_index)))
+    return false;
+
+  const size_t chunk_offset = static_cast<size_t>(sector_number % CHUNK_SECTOR_COUNT) * RAW_SECTOR_SIZE;
+  std::memcpy(buffer, &(*chunk)[chunk_offset], RAW_SECTOR_SIZE);
+  return true;
+}
+
 std::unique_ptr<CDImage>
 CDImage::CreateMemoryImage(CDImage* image, ProgressCallback* progress /* = ProgressCallback::NullProgressCallback */)
 {
@@ -160,3 +362,13 @@ CDImage::CreateMemoryImage(CDImage* image, ProgressCallback* progress /* = Progr
 
   return memory_image;
 }
+
+std::unique_ptr<CDImage> CDImage::CreateCompressedMemoryImage(
+  CDImage* image, ProgressCallback* progress /* = ProgressCallback::NullProgressCallback */)
+{
+  std::unique_ptr<CDImageCompressedMemory> memory_image = std::make_unique<CDImageCompressedMemory>();
+  if (!memory_image->CopyImage(image, progress))
+    return {};
+
+  return memory_image;
+}
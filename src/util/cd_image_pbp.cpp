@@ -7,6 +7,7 @@
 #include "common/error.h"
 #include "common/file_system.h"
 #include "common/log.h"
+#include "common/lru_cache.h"
 #include "common/path.h"
 #include "common/string_util.h"
 #include "pbp_types.h"
@@ -43,6 +44,11 @@ protected:
   bool ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_in_index) override;
 
 private:
+  enum : u32
+  {
+    MAX_CACHED_BLOCKS = 32 // ~1.2MB of decompressed blocks
+  };
+
   struct BlockInfo
   {
     u32 offset; // Absolute offset from start of file
@@ -89,6 +95,7 @@ private:
   u32 m_current_block = static_cast<u32>(-1);
   std::array<u8, DECOMPRESSED_BLOCK_SIZE> m_decompressed_block;
   std::vector<u8> m_compressed_block;
+  LRUCache<u32, std::vector<u8>> m_block_cache{MAX_CACHED_BLOCKS};
 
   z_stream m_inflate_stream;
 
@@ -337,6 +344,8 @@ bool CDImagePBP::Open(const char* filename, Error* error)
     return false;
   }
 
+  FileSystem::HintSequentialAccess(m_file);
+
   m_filename = filename;
 
   // Read in PBP header
@@ -442,6 +451,7 @@ bool CDImagePBP::OpenDisc(u32 index, Error* error)
   }
 
   m_current_block = static_cast<u32>(-1);
+  m_block_cache.Clear();
   m_blockinfo_table.fill({});
   m_toc.fill({});
   m_decompressed_block.fill(0x00);
@@ -764,10 +774,25 @@ bool CDImagePBP::ReadSectorFromIndex(void* buffer, const Index& index, LBA lba_i
     return false;
   }
 
-  if (m_current_block != requested_block && !DecompressBlock(bi))
+  if (m_current_block != requested_block)
   {
-    Log_ErrorPrintf("Failed to decompress block %u", requested_block);
-    return false;
+    // serve backwards seeks from recently-decompressed blocks
+    const std::vector<u8>* cached_block = m_block_cache.Lookup(requested_block);
+    if (cached_block)
+    {
+      std::memcpy(buffer, &(*cached_block)[offset_in_block], RAW_SECTOR_SIZE);
+      return true;
+    }
+
+    if (!DecompressBlock(bi))
+    {
+      Log_ErrorPrintf("Failed to decompress block %u", requested_block);
+      return false;
+    }
+
+    m_current_block = requested_block;
+    m_block_cache.Insert(requested_block,
+                         std::vector<u8>(m_decompressed_block.begin(), m_decompressed_block.end()));
   }
 
   std::memcpy(buffer, &m_decompressed_block[offset_in_block], RAW_SECTOR_SIZE);
@@ -109,6 +109,10 @@ bool CDSubChannelReplacement::GetReplacementSubChannelQ(u8 minute_bcd, u8 second
 
 bool CDSubChannelReplacement::GetReplacementSubChannelQ(u32 lba, CDImage::SubChannelQ* subq) const
 {
+  // most images have no replacement data at all, skip hashing the LBA in that case
+  if (m_replacement_subq.empty())
+    return false;
+
   const auto iter = m_replacement_subq.find(lba);
   if (iter == m_replacement_subq.cend())
     return false;
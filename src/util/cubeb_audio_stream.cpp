@@ -15,6 +15,8 @@
 #include "cubeb/cubeb.h"
 #include "fmt/format.h"
 
+#include <algorithm>
+
 #ifdef _WIN32
 #include "common/windows_headers.h"
 #include <objbase.h>
@@ -128,6 +130,17 @@ bool CubebAudioStream::Initialize(u32 latency_ms)
     }
   }
 
+  if (g_settings.audio_batch_periods)
+  {
+    // Request one period covering two of the configured latency, and keep another period's worth
+    // queued on our side, trading latency for far fewer audio thread wakeups.
+    latency_frames = GetAlignedBufferSize(latency_frames * 2);
+    const u32 period_ms = GetMSForBufferSize(m_sample_rate, latency_frames);
+    m_buffer_ms = std::max(m_buffer_ms, period_ms * 2);
+    Log_DevPrintf("(Cubeb) Batching periods: %u frames (%u ms) per wakeup, buffer %u ms.", latency_frames, period_ms,
+                  m_buffer_ms);
+  }
+
   cubeb_devid selected_device = nullptr;
   const std::string& selected_device_name = g_settings.audio_output_device;
   cubeb_device_collection devices;
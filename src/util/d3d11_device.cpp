@@ -178,6 +178,10 @@ void D3D11Device::SetFeatures()
   m_features.gpu_timing = true;
   m_features.shader_cache = true;
   m_features.pipeline_cache = false;
+  m_features.parallel_pipeline_compilation = false;
+
+  // D3DCompile() is free-threaded, and ID3D11Device creation methods are thread-safe.
+  m_features.parallel_shader_compilation = true;
 }
 
 bool D3D11Device::CreateSwapChain()
@@ -224,6 +228,11 @@ bool D3D11Device::CreateSwapChain()
   if (m_using_allow_tearing)
     swap_chain_desc.Flags |= DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;
 
+  // Frame-latency waitable objects are only supported on windowed flip-model swap chains.
+  const bool use_latency_waitable = (m_using_flip_model_swap_chain && !m_is_exclusive_fullscreen);
+  if (use_latency_waitable)
+    swap_chain_desc.Flags |= DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+
   HRESULT hr = S_OK;
 
   if (m_is_exclusive_fullscreen)
@@ -283,6 +292,17 @@ bool D3D11Device::CreateSwapChain()
     Log_WarningPrintf("MakeWindowAssociation() to disable ALT+ENTER failed");
   }
 
+  if (use_latency_waitable && m_using_flip_model_swap_chain)
+  {
+    // Limiting the latency to one frame and blocking on the waitable object in BeginPresent()
+    // stops DXGI from buffering a second frame ahead of the display.
+    ComPtr<IDXGISwapChain2> swap_chain2;
+    if (SUCCEEDED(m_swap_chain.As(&swap_chain2)) && SUCCEEDED(swap_chain2->SetMaximumFrameLatency(1)))
+      m_frame_latency_waitable_object = swap_chain2->GetFrameLatencyWaitableObject();
+    if (!m_frame_latency_waitable_object)
+      Log_WarningPrintf("Failed to acquire frame latency waitable object.");
+  }
+
   if (!CreateSwapChainRTV())
   {
     DestroySwapChain();
@@ -349,6 +369,12 @@ void D3D11Device::DestroySwapChain()
 
   m_swap_chain_rtv.Reset();
 
+  if (m_frame_latency_waitable_object != NULL)
+  {
+    CloseHandle(m_frame_latency_waitable_object);
+    m_frame_latency_waitable_object = NULL;
+  }
+
   // switch out of fullscreen before destroying
   BOOL is_fullscreen;
   if (SUCCEEDED(m_swap_chain->GetFullscreenState(&is_fullscreen, nullptr)) && is_fullscreen)
@@ -394,8 +420,10 @@ void D3D11Device::ResizeWindow(s32 new_window_width, s32 new_window_height, floa
 
   m_swap_chain_rtv.Reset();
 
-  HRESULT hr = m_swap_chain->ResizeBuffers(0, 0, 0, DXGI_FORMAT_UNKNOWN,
-                                           m_using_allow_tearing ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING : 0);
+  HRESULT hr = m_swap_chain->ResizeBuffers(
+    0, 0, 0, DXGI_FORMAT_UNKNOWN,
+    (m_using_allow_tearing ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING : 0u) |
+      ((m_frame_latency_waitable_object != NULL) ? DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT : 0u));
   if (FAILED(hr))
     Log_ErrorPrintf("ResizeBuffers() failed: 0x%08X", hr);
 
@@ -599,6 +627,11 @@ bool D3D11Device::BeginPresent(bool skip_present)
     return false;
   }
 
+  // Block until the presentation queue has room for this frame, so the CPU doesn't run more than
+  // a frame ahead of the display.
+  if (m_frame_latency_waitable_object != NULL)
+    WaitForSingleObjectEx(m_frame_latency_waitable_object, 1000, TRUE);
+
   // When using vsync, the time here seems to include the time for the buffer to become available.
   // This blows our our GPU usage number considerably, so read the timestamp before the final blit
   // in this configuration. It does reduce accuracy a little, but better than seeing 100% all of
@@ -172,6 +172,10 @@ private:
   bool m_allow_tearing_supported = false;
   bool m_using_flip_model_swap_chain = true;
   bool m_using_allow_tearing = false;
+
+  // Waitable object for frame-latency throttling, NULL when unsupported (blit model/exclusive
+  // fullscreen). BeginPresent() blocks on this until the present queue has room.
+  HANDLE m_frame_latency_waitable_object = NULL;
   bool m_is_exclusive_fullscreen = false;
 
   D3D11StreamBuffer m_vertex_buffer;
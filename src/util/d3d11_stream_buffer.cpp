@@ -75,7 +75,7 @@ void D3D11StreamBuffer::Destroy()
 D3D11StreamBuffer::MappingResult D3D11StreamBuffer::Map(ID3D11DeviceContext1* context, u32 alignment, u32 min_size)
 {
   m_position = Common::AlignUp(m_position, alignment);
-  if ((m_position + min_size) >= m_size || !m_use_map_no_overwrite)
+  if ((m_position + min_size) > m_size || !m_use_map_no_overwrite)
   {
     // wrap around
     m_position = 0;
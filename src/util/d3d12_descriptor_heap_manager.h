@@ -84,6 +84,7 @@ public:
 
   ALWAYS_INLINE ID3D12DescriptorHeap* GetDescriptorHeap() const { return m_descriptor_heap.Get(); }
   ALWAYS_INLINE u32 GetDescriptorIncrementSize() const { return m_descriptor_increment_size; }
+  ALWAYS_INLINE u32 GetNumDescriptors() const { return m_num_descriptors; }
 
   bool Create(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type, u32 num_descriptors);
   void Destroy();
@@ -101,12 +102,15 @@ private:
   D3D12_GPU_DESCRIPTOR_HANDLE m_heap_base_gpu = {};
 };
 
-template<u32 NumSamplers>
-class D3D12GroupedSamplerAllocator : private D3D12DescriptorAllocator
+// Ring allocator with a cache of already-built descriptor groups, so stable source descriptor
+// sets (e.g. the VRAM/palette/display textures, or repeated sampler configs) are copied into the
+// shader-visible heap once per reset instead of once per draw group.
+template<u32 GroupSize>
+class D3D12GroupedDescriptorAllocator : private D3D12DescriptorAllocator
 {
   struct Key
   {
-    u32 idx[NumSamplers];
+    u32 idx[GroupSize];
 
     ALWAYS_INLINE bool operator==(const Key& rhs) const { return (std::memcmp(idx, rhs.idx, sizeof(idx)) == 0); }
     ALWAYS_INLINE bool operator!=(const Key& rhs) const { return (std::memcmp(idx, rhs.idx, sizeof(idx)) != 0); }
@@ -124,13 +128,15 @@ class D3D12GroupedSamplerAllocator : private D3D12DescriptorAllocator
   };
 
 public:
-  D3D12GroupedSamplerAllocator();
-  ~D3D12GroupedSamplerAllocator();
+  D3D12GroupedDescriptorAllocator();
+  ~D3D12GroupedDescriptorAllocator();
 
+  using D3D12DescriptorAllocator::Allocate;
   using D3D12DescriptorAllocator::GetDescriptorHeap;
   using D3D12DescriptorAllocator::GetDescriptorIncrementSize;
+  using D3D12DescriptorAllocator::GetNumDescriptors;
 
-  bool Create(ID3D12Device* device, u32 num_descriptors);
+  bool Create(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type, u32 num_descriptors);
   void Destroy();
 
   bool LookupSingle(ID3D12Device* device, D3D12DescriptorHandle* gpu_handle, const D3D12DescriptorHandle& cpu_handle);
@@ -144,46 +150,50 @@ public:
 
 private:
   std::unordered_map<Key, D3D12DescriptorHandle, KeyHash> m_groups;
+  D3D12_DESCRIPTOR_HEAP_TYPE m_heap_type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
 };
 
-template<u32 NumSamplers>
-D3D12GroupedSamplerAllocator<NumSamplers>::D3D12GroupedSamplerAllocator() = default;
+template<u32 GroupSize>
+D3D12GroupedDescriptorAllocator<GroupSize>::D3D12GroupedDescriptorAllocator() = default;
 
-template<u32 NumSamplers>
-D3D12GroupedSamplerAllocator<NumSamplers>::~D3D12GroupedSamplerAllocator() = default;
+template<u32 GroupSize>
+D3D12GroupedDescriptorAllocator<GroupSize>::~D3D12GroupedDescriptorAllocator() = default;
 
-template<u32 NumSamplers>
-bool D3D12GroupedSamplerAllocator<NumSamplers>::Create(ID3D12Device* device, u32 num_descriptors)
+template<u32 GroupSize>
+bool D3D12GroupedDescriptorAllocator<GroupSize>::Create(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type,
+                                                        u32 num_descriptors)
 {
-  return D3D12DescriptorAllocator::Create(device, D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER, num_descriptors);
+  m_heap_type = type;
+  return D3D12DescriptorAllocator::Create(device, type, num_descriptors);
 }
 
-template<u32 NumSamplers>
-void D3D12GroupedSamplerAllocator<NumSamplers>::Destroy()
+template<u32 GroupSize>
+void D3D12GroupedDescriptorAllocator<GroupSize>::Destroy()
 {
+  m_groups.clear();
   D3D12DescriptorAllocator::Destroy();
 }
 
-template<u32 NumSamplers>
-void D3D12GroupedSamplerAllocator<NumSamplers>::Reset()
+template<u32 GroupSize>
+void D3D12GroupedDescriptorAllocator<GroupSize>::Reset()
 {
   m_groups.clear();
   D3D12DescriptorAllocator::Reset();
 }
 
-template<u32 NumSamplers>
-void D3D12GroupedSamplerAllocator<NumSamplers>::InvalidateCache()
+template<u32 GroupSize>
+void D3D12GroupedDescriptorAllocator<GroupSize>::InvalidateCache()
 {
   m_groups.clear();
 }
 
-template<u32 NumSamplers>
-bool D3D12GroupedSamplerAllocator<NumSamplers>::LookupSingle(ID3D12Device* device, D3D12DescriptorHandle* gpu_handle,
-                                                             const D3D12DescriptorHandle& cpu_handle)
+template<u32 GroupSize>
+bool D3D12GroupedDescriptorAllocator<GroupSize>::LookupSingle(ID3D12Device* device, D3D12DescriptorHandle* gpu_handle,
+                                                              const D3D12DescriptorHandle& cpu_handle)
 {
   Key key;
   key.idx[0] = cpu_handle.index;
-  for (u32 i = 1; i < NumSamplers; i++)
+  for (u32 i = 1; i < GroupSize; i++)
     key.idx[i] = 0;
 
   auto it = m_groups.find(key);
@@ -196,17 +206,17 @@ bool D3D12GroupedSamplerAllocator<NumSamplers>::LookupSingle(ID3D12Device* devic
   if (!Allocate(1, gpu_handle))
     return false;
 
-  device->CopyDescriptorsSimple(1, *gpu_handle, cpu_handle, D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER);
+  device->CopyDescriptorsSimple(1, *gpu_handle, cpu_handle, m_heap_type);
   m_groups.emplace(key, *gpu_handle);
   return true;
 }
 
-template<u32 NumSamplers>
-bool D3D12GroupedSamplerAllocator<NumSamplers>::LookupGroup(ID3D12Device* device, D3D12DescriptorHandle* gpu_handle,
-                                                            const D3D12DescriptorHandle* cpu_handles)
+template<u32 GroupSize>
+bool D3D12GroupedDescriptorAllocator<GroupSize>::LookupGroup(ID3D12Device* device, D3D12DescriptorHandle* gpu_handle,
+                                                             const D3D12DescriptorHandle* cpu_handles)
 {
   Key key;
-  for (u32 i = 0; i < NumSamplers; i++)
+  for (u32 i = 0; i < GroupSize; i++)
     key.idx[i] = cpu_handles[i].index;
 
   auto it = m_groups.find(key);
@@ -216,29 +226,28 @@ bool D3D12GroupedSamplerAllocator<NumSamplers>::LookupGroup(ID3D12Device* device
     return true;
   }
 
-  if (!Allocate(NumSamplers, gpu_handle))
+  if (!Allocate(GroupSize, gpu_handle))
     return false;
 
   D3D12_CPU_DESCRIPTOR_HANDLE dst_handle = *gpu_handle;
-  UINT dst_size = NumSamplers;
-  D3D12_CPU_DESCRIPTOR_HANDLE src_handles[NumSamplers];
-  UINT src_sizes[NumSamplers];
-  for (u32 i = 0; i < NumSamplers; i++)
+  UINT dst_size = GroupSize;
+  D3D12_CPU_DESCRIPTOR_HANDLE src_handles[GroupSize];
+  UINT src_sizes[GroupSize];
+  for (u32 i = 0; i < GroupSize; i++)
   {
     src_handles[i] = cpu_handles[i];
     src_sizes[i] = 1;
   }
-  device->CopyDescriptors(1, &dst_handle, &dst_size, NumSamplers, src_handles, src_sizes,
-                          D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER);
+  device->CopyDescriptors(1, &dst_handle, &dst_size, GroupSize, src_handles, src_sizes, m_heap_type);
 
   m_groups.emplace(key, *gpu_handle);
   return true;
 }
 
-template<u32 NumSamplers>
-bool D3D12GroupedSamplerAllocator<NumSamplers>::ShouldReset() const
+template<u32 GroupSize>
+bool D3D12GroupedDescriptorAllocator<GroupSize>::ShouldReset() const
 {
-  // We only reset the sampler heap if more than half of the descriptors are used.
-  // This saves descriptor copying when there isn't a large number of sampler configs per frame.
-  return m_groups.size() >= (D3D12_MAX_SHADER_VISIBLE_SAMPLER_HEAP_SIZE / 2);
+  // We only reset the heap if more than half of the descriptors are used.
+  // This saves descriptor copying when there isn't a large number of configs per frame.
+  return m_groups.size() >= (GetNumDescriptors() / 2);
 }
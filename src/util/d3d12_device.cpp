@@ -360,7 +360,7 @@ bool D3D12Device::CreateCommandLists()
       return false;
     }
 
-    if (!res.sampler_allocator.Create(m_device.Get(), MAX_SAMPLERS_PER_FRAME))
+    if (!res.sampler_allocator.Create(m_device.Get(), D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER, MAX_SAMPLERS_PER_FRAME))
     {
       Log_ErrorPrintf("Failed to create per frame sampler allocator");
       return false;
@@ -694,6 +694,12 @@ void D3D12Device::DeferResourceDestruction(ComPtr<D3D12MA::Allocation> allocatio
     GetCurrentFenceValue(), std::pair<D3D12MA::Allocation*, ID3D12Object*>(allocation.Detach(), resource.Detach()));
 }
 
+void D3D12Device::InvalidateDescriptorGroups()
+{
+  for (CommandList& res : m_command_lists)
+    res.descriptor_allocator.InvalidateCache();
+}
+
 void D3D12Device::DeferDescriptorDestruction(D3D12DescriptorHeapManager& heap, D3D12DescriptorHandle* descriptor)
 {
   DebugAssert(descriptor->index != D3D12DescriptorHandle::INVALID_INDEX);
@@ -704,16 +710,23 @@ void D3D12Device::DeferDescriptorDestruction(D3D12DescriptorHeapManager& heap, D
 
 void D3D12Device::DestroyDeferredObjects(u64 fence_value)
 {
+  bool srv_descriptors_freed = false;
   while (!m_cleanup_descriptors.empty())
   {
     auto& it = m_cleanup_descriptors.front();
     if (it.first > fence_value)
       break;
 
+    srv_descriptors_freed |= (it.second.first == &m_descriptor_heap_manager);
     it.second.first->Free(it.second.second.index);
     m_cleanup_descriptors.pop_front();
   }
 
+  // A freed SRV slot can be handed to a new resource while later command lists are still being
+  // recorded, so any descriptor groups built from it can no longer be trusted.
+  if (srv_descriptors_freed)
+    InvalidateDescriptorGroups();
+
   while (!m_cleanup_resources.empty())
   {
     auto& it = m_cleanup_resources.front();
@@ -811,6 +824,11 @@ bool D3D12Device::CreateSwapChain()
   if (m_using_allow_tearing)
     swap_chain_desc.Flags |= DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;
 
+  // Frame-latency waitable objects are only supported on windowed swap chains.
+  const bool use_latency_waitable = !m_is_exclusive_fullscreen;
+  if (use_latency_waitable)
+    swap_chain_desc.Flags |= DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+
   HRESULT hr = S_OK;
 
   if (m_is_exclusive_fullscreen)
@@ -848,6 +866,17 @@ bool D3D12Device::CreateSwapChain()
   if (FAILED(hr))
     Log_WarningPrint("MakeWindowAssociation() to disable ALT+ENTER failed");
 
+  if (use_latency_waitable && !m_is_exclusive_fullscreen)
+  {
+    // Limiting the latency to one frame and blocking on the waitable object in BeginPresent()
+    // stops DXGI from buffering a second frame ahead of the display.
+    ComPtr<IDXGISwapChain2> swap_chain2;
+    if (SUCCEEDED(m_swap_chain.As(&swap_chain2)) && SUCCEEDED(swap_chain2->SetMaximumFrameLatency(1)))
+      m_frame_latency_waitable_object = swap_chain2->GetFrameLatencyWaitableObject();
+    if (!m_frame_latency_waitable_object)
+      Log_WarningPrint("Failed to acquire frame latency waitable object.");
+  }
+
   if (!CreateSwapChainRTV())
   {
     DestroySwapChain();
@@ -941,6 +970,12 @@ void D3D12Device::DestroySwapChain()
 
   DestroySwapChainRTVs();
 
+  if (m_frame_latency_waitable_object != NULL)
+  {
+    CloseHandle(m_frame_latency_waitable_object);
+    m_frame_latency_waitable_object = NULL;
+  }
+
   // switch out of fullscreen before destroying
   BOOL is_fullscreen;
   if (SUCCEEDED(m_swap_chain->GetFullscreenState(&is_fullscreen, nullptr)) && is_fullscreen)
@@ -1003,8 +1038,10 @@ void D3D12Device::ResizeWindow(s32 new_window_width, s32 new_window_height, floa
 
   DestroySwapChainRTVs();
 
-  HRESULT hr = m_swap_chain->ResizeBuffers(0, 0, 0, DXGI_FORMAT_UNKNOWN,
-                                           m_using_allow_tearing ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING : 0);
+  HRESULT hr = m_swap_chain->ResizeBuffers(
+    0, 0, 0, DXGI_FORMAT_UNKNOWN,
+    (m_using_allow_tearing ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING : 0u) |
+      ((m_frame_latency_waitable_object != NULL) ? DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT : 0u));
   if (FAILED(hr))
     Log_ErrorPrintf("ResizeBuffers() failed: 0x%08X", hr);
 
@@ -1086,6 +1123,11 @@ bool D3D12Device::BeginPresent(bool frame_skip)
     return false;
   }
 
+  // Block until the presentation queue has room for this frame, so the CPU doesn't run more than
+  // a frame ahead of the display.
+  if (m_frame_latency_waitable_object != NULL)
+    WaitForSingleObjectEx(m_frame_latency_waitable_object, 1000, TRUE);
+
   BeginSwapChainRenderPass();
   return true;
 }
@@ -1197,6 +1239,8 @@ void D3D12Device::SetFeatures()
   m_features.gpu_timing = true;
   m_features.shader_cache = true;
   m_features.pipeline_cache = true;
+  m_features.parallel_pipeline_compilation = true;
+  m_features.parallel_shader_compilation = true;
 
   BOOL allow_tearing_supported = false;
   HRESULT hr = m_dxgi_factory->CheckFeatureSupport(DXGI_FEATURE_PRESENT_ALLOW_TEARING, &allow_tearing_supported,
@@ -1563,12 +1607,17 @@ void D3D12Device::BeginRenderPass()
 
   ID3D12GraphicsCommandList4* cmdlist = GetCommandList();
 
+  // The attachment and texture transitions get coalesced into a single ResourceBarrier() call,
+  // instead of serializing one barrier per resource.
+  std::array<D3D12_RESOURCE_BARRIER, MAX_TEXTURE_SAMPLERS + 2> barriers;
+  u32 num_barriers = 0;
+
   if (m_current_framebuffer) [[likely]]
   {
     D3D12Texture* rt = static_cast<D3D12Texture*>(m_current_framebuffer->GetRT());
     if (rt)
     {
-      rt->TransitionToState(cmdlist, D3D12_RESOURCE_STATE_RENDER_TARGET);
+      rt->AppendStateTransition(D3D12_RESOURCE_STATE_RENDER_TARGET, barriers.data(), &num_barriers);
       rt->SetUseFenceValue(GetCurrentFenceValue());
       rt_desc_p = &rt_desc;
       rt_desc.cpuDescriptor = rt->GetWriteDescriptor();
@@ -1607,7 +1656,7 @@ void D3D12Device::BeginRenderPass()
     D3D12Texture* ds = static_cast<D3D12Texture*>(m_current_framebuffer->GetDS());
     if (ds)
     {
-      ds->TransitionToState(cmdlist, D3D12_RESOURCE_STATE_DEPTH_WRITE);
+      ds->AppendStateTransition(D3D12_RESOURCE_STATE_DEPTH_WRITE, barriers.data(), &num_barriers);
       ds->SetUseFenceValue(GetCurrentFenceValue());
       ds_desc_p = &ds_desc;
       ds_desc.cpuDescriptor = ds->GetWriteDescriptor();
@@ -1659,9 +1708,13 @@ void D3D12Device::BeginRenderPass()
   for (u32 i = 0; i < num_textures; i++)
   {
     if (m_current_textures[i])
-      m_current_textures[i]->TransitionToState(cmdlist, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+      m_current_textures[i]->AppendStateTransition(D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, barriers.data(),
+                                                   &num_barriers);
   }
 
+  if (num_barriers > 0)
+    cmdlist->ResourceBarrier(num_barriers, barriers.data());
+
   DebugAssert(rt_desc_p || ds_desc_p);
   cmdlist->BeginRenderPass(rt_desc_p ? 1 : 0, rt_desc_p, ds_desc_p, D3D12_RENDER_PASS_FLAG_NONE);
 
@@ -1680,17 +1733,25 @@ void D3D12Device::BeginSwapChainRenderPass()
   ID3D12GraphicsCommandList4* const cmdlist = GetCommandList();
   const auto& swap_chain_buf = m_swap_chain_buffers[m_current_swap_chain_buffer];
 
-  D3D12Texture::TransitionSubresourceToState(cmdlist, swap_chain_buf.first.Get(), 0, D3D12_RESOURCE_STATE_COMMON,
-                                             D3D12_RESOURCE_STATE_RENDER_TARGET);
+  // Coalesce the swap chain transition with any texture transitions into one ResourceBarrier().
+  std::array<D3D12_RESOURCE_BARRIER, MAX_TEXTURE_SAMPLERS + 1> barriers;
+  u32 num_barriers = 0;
+  barriers[num_barriers++] = {
+    D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+    D3D12_RESOURCE_BARRIER_FLAG_NONE,
+    {{swap_chain_buf.first.Get(), 0, D3D12_RESOURCE_STATE_COMMON, D3D12_RESOURCE_STATE_RENDER_TARGET}}};
 
   // All textures should be in shader read only optimal already, but just in case..
   const u32 num_textures = GetActiveTexturesForLayout(m_current_pipeline_layout);
   for (u32 i = 0; i < num_textures; i++)
   {
     if (m_current_textures[i])
-      m_current_textures[i]->TransitionToState(cmdlist, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+      m_current_textures[i]->AppendStateTransition(D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, barriers.data(),
+                                                   &num_barriers);
   }
 
+  cmdlist->ResourceBarrier(num_barriers, barriers.data());
+
   const D3D12_RENDER_PASS_RENDER_TARGET_DESC rt_desc = {
     swap_chain_buf.second,
     {D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_CLEAR, {s_present_clear_color}},
@@ -2005,28 +2066,26 @@ bool D3D12Device::UpdateParametersForLayout(u32 dirty)
   constexpr u32 num_textures = GetActiveTexturesForLayout(layout);
   if (dirty & DIRTY_FLAG_TEXTURES && num_textures > 0)
   {
-    D3D12DescriptorAllocator& allocator = m_command_lists[m_current_command_list].descriptor_allocator;
+    // Stable texture sets (the common GPU_HW case) hit the group cache and reuse the table built
+    // earlier in this command list, so no descriptors get copied.
+    auto& allocator = m_command_lists[m_current_command_list].descriptor_allocator;
     D3D12DescriptorHandle gpu_handle;
-    if (!allocator.Allocate(num_textures, &gpu_handle))
-      return false;
-
     if constexpr (num_textures == 1)
     {
-      m_device->CopyDescriptorsSimple(
-        1, gpu_handle, m_current_textures[0] ? m_current_textures[0]->GetSRVDescriptor() : m_null_srv_descriptor,
-        D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+      if (!allocator.LookupSingle(m_device.Get(), &gpu_handle,
+                                  m_current_textures[0] ? m_current_textures[0]->GetSRVDescriptor() :
+                                                          m_null_srv_descriptor))
+      {
+        return false;
+      }
     }
     else
     {
-      D3D12_CPU_DESCRIPTOR_HANDLE src_handles[MAX_TEXTURE_SAMPLERS];
-      UINT src_sizes[MAX_TEXTURE_SAMPLERS];
-      for (u32 i = 0; i < num_textures; i++)
-      {
+      D3D12DescriptorHandle src_handles[MAX_TEXTURE_SAMPLERS];
+      for (u32 i = 0; i < MAX_TEXTURE_SAMPLERS; i++)
         src_handles[i] = m_current_textures[i] ? m_current_textures[i]->GetSRVDescriptor() : m_null_srv_descriptor;
-        src_sizes[i] = 1;
-      }
-      m_device->CopyDescriptors(1, &gpu_handle.cpu_handle, &num_textures, num_textures, src_handles, src_sizes,
-                                D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+      if (!allocator.LookupGroup(m_device.Get(), &gpu_handle, src_handles))
+        return false;
     }
 
     cmdlist->SetGraphicsRootDescriptorTable(0, gpu_handle);
@@ -2052,14 +2111,15 @@ bool D3D12Device::UpdateParametersForLayout(u32 dirty)
 
   if (dirty & DIRTY_FLAG_TEXTURES && layout == GPUPipeline::Layout::SingleTextureBufferAndPushConstants)
   {
-    D3D12DescriptorAllocator& allocator = m_command_lists[m_current_command_list].descriptor_allocator;
+    auto& allocator = m_command_lists[m_current_command_list].descriptor_allocator;
     D3D12DescriptorHandle gpu_handle;
-    if (!allocator.Allocate(1, &gpu_handle))
+    if (!allocator.LookupSingle(m_device.Get(), &gpu_handle,
+                                m_current_texture_buffer ? m_current_texture_buffer->GetDescriptor() :
+                                                           m_null_srv_descriptor))
+    {
       return false;
+    }
 
-    m_device->CopyDescriptorsSimple(
-      1, gpu_handle, m_current_texture_buffer ? m_current_texture_buffer->GetDescriptor() : m_null_srv_descriptor,
-      D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
     cmdlist->SetGraphicsRootDescriptorTable(0, gpu_handle);
   }
 
@@ -203,8 +203,8 @@ private:
     // [0] - Init (upload) command buffer, [1] - draw command buffer
     std::array<ComPtr<ID3D12CommandAllocator>, 2> command_allocators;
     std::array<ComPtr<ID3D12GraphicsCommandList4>, 2> command_lists;
-    D3D12DescriptorAllocator descriptor_allocator;
-    D3D12GroupedSamplerAllocator<MAX_TEXTURE_SAMPLERS> sampler_allocator;
+    D3D12GroupedDescriptorAllocator<MAX_TEXTURE_SAMPLERS> descriptor_allocator;
+    D3D12GroupedDescriptorAllocator<MAX_TEXTURE_SAMPLERS> sampler_allocator;
     u64 fence_counter = 0;
     bool init_list_used = false;
     bool needs_fence_wait = false;
@@ -235,6 +235,7 @@ private:
   D3D12DescriptorHandle GetSampler(const GPUSampler::Config& config);
   void DestroySamplers();
   void DestroyDeferredObjects(u64 fence_value);
+  void InvalidateDescriptorGroups();
 
   void RenderBlankFrame();
   void MoveToNextCommandList();
@@ -291,6 +292,10 @@ private:
   u32 m_current_swap_chain_buffer = 0;
   bool m_allow_tearing_supported = false;
   bool m_using_allow_tearing = false;
+
+  // Waitable object for frame-latency throttling, NULL when unsupported (exclusive fullscreen).
+  // BeginPresent() blocks on this until the present queue has room.
+  HANDLE m_frame_latency_waitable_object = NULL;
   bool m_is_exclusive_fullscreen = false;
 
   D3D12DescriptorHeapManager m_descriptor_heap_manager;
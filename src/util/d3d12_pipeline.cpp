@@ -239,6 +239,8 @@ std::unique_ptr<GPUPipeline> D3D12Device::CreatePipeline(const GPUPipeline::Grap
         hr = m_pipeline_library->StorePipeline(name.c_str(), pipeline.Get());
         if (FAILED(hr))
           Log_ErrorPrintf("StorePipeline() failed with HRESULT %08X", hr);
+        else
+          MarkPipelineCacheDirty();
       }
     }
   }
@@ -3,19 +3,26 @@
 
 #pragma once
 
+#include "gpu_stream_buffer_ring.h"
+
 #include "common/types.h"
 #include "common/windows_headers.h"
 
 #include <d3d12.h>
-#include <deque>
-#include <utility>
 #include <wrl/client.h>
 
 namespace D3D12MA {
 class Allocation;
 }
 
-class D3D12StreamBuffer
+struct D3D12StreamBufferFenceSource
+{
+  static u64 GetCurrentFenceValue();
+  static u64 GetCompletedFenceValue();
+  static void WaitForFenceValue(u64 value);
+};
+
+class D3D12StreamBuffer : public GPUStreamBufferRing<D3D12StreamBufferFenceSource>
 {
 public:
   D3D12StreamBuffer();
@@ -30,31 +37,12 @@ public:
   ALWAYS_INLINE void* GetCurrentHostPointer() const { return m_host_pointer + m_current_offset; }
   ALWAYS_INLINE D3D12_GPU_VIRTUAL_ADDRESS GetCurrentGPUPointer() const { return m_gpu_pointer + m_current_offset; }
   ALWAYS_INLINE u32 GetSize() const { return m_size; }
-  ALWAYS_INLINE u32 GetCurrentOffset() const { return m_current_offset; }
-  ALWAYS_INLINE u32 GetCurrentSpace() const { return m_current_space; }
-
-  bool ReserveMemory(u32 num_bytes, u32 alignment);
-  void CommitMemory(u32 final_num_bytes);
 
   void Destroy(bool defer = true);
 
 private:
-  void UpdateCurrentFencePosition();
-  void UpdateGPUPosition();
-
-  // Waits for as many fences as needed to allocate num_bytes bytes from the buffer.
-  bool WaitForClearSpace(u32 num_bytes);
-
-  u32 m_size = 0;
-  u32 m_current_offset = 0;
-  u32 m_current_space = 0;
-  u32 m_current_gpu_position = 0;
-
   Microsoft::WRL::ComPtr<ID3D12Resource> m_buffer;
   Microsoft::WRL::ComPtr<D3D12MA::Allocation> m_allocation;
   D3D12_GPU_VIRTUAL_ADDRESS m_gpu_pointer = {};
   u8* m_host_pointer = nullptr;
-
-  // List of fences and the corresponding positions in the buffer
-  std::deque<std::pair<u64, u32>> m_tracked_fences;
 };
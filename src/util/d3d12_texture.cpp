@@ -619,6 +619,21 @@ void D3D12Texture::TransitionToState(ID3D12GraphicsCommandList* cmdlist, D3D12_R
   cmdlist->ResourceBarrier(1, &barrier);
 }
 
+void D3D12Texture::AppendStateTransition(D3D12_RESOURCE_STATES state, D3D12_RESOURCE_BARRIER* barriers,
+                                         u32* num_barriers)
+{
+  if (m_resource_state == state)
+    return;
+
+  const D3D12_RESOURCE_STATES prev_state = m_resource_state;
+  m_resource_state = state;
+
+  barriers[(*num_barriers)++] = {
+    D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+    D3D12_RESOURCE_BARRIER_FLAG_NONE,
+    {{m_resource.Get(), D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES, prev_state, state}}};
+}
+
 void D3D12Texture::TransitionSubresourceToState(ID3D12GraphicsCommandList* cmdlist, u32 layer, u32 level,
                                                 D3D12_RESOURCE_STATES before_state,
                                                 D3D12_RESOURCE_STATES after_state) const
@@ -53,6 +53,11 @@ public:
   u32 CalculateSubresource(u32 layer, u32 level) const;
 
   void TransitionToState(ID3D12GraphicsCommandList* cmdlist, D3D12_RESOURCE_STATES state);
+
+  // Appends the transition to a barrier batch instead of issuing it immediately. The tracked
+  // state is updated straight away, so the caller must flush the batch with a single
+  // ResourceBarrier() call before any dependent commands.
+  void AppendStateTransition(D3D12_RESOURCE_STATES state, D3D12_RESOURCE_BARRIER* barriers, u32* num_barriers);
   void TransitionSubresourceToState(ID3D12GraphicsCommandList* cmdlist, u32 layer, u32 level,
                                     D3D12_RESOURCE_STATES before_state, D3D12_RESOURCE_STATES after_state) const;
   void TransitionSubresourceToState(ID3D12GraphicsCommandList* cmdlist, u32 subresource,
@@ -11,11 +11,16 @@
 #include "common/log.h"
 #include "common/path.h"
 #include "common/string_util.h"
+#include "common/thirdparty/thread_pool.h"
+#include "common/threading.h"
 #include "common/timer.h"
 
 #include "fmt/format.h"
 #include "imgui.h"
 
+#include <cstring>
+#include <utility>
+
 Log_SetChannel(GPUDevice);
 
 #ifdef _WIN32
@@ -35,7 +40,12 @@ Log_SetChannel(GPUDevice);
 
 std::unique_ptr<GPUDevice> g_gpu_device;
 
+// Minimum time between incremental background saves of the pipeline cache.
+static constexpr float PIPELINE_CACHE_SAVE_INTERVAL_SECONDS = 60.0f;
+
 static std::string s_pipeline_cache_path;
+static Common::Timer s_pipeline_cache_save_timer;
+static bool s_pipeline_cache_dirty = false;
 
 GPUFramebuffer::GPUFramebuffer(GPUTexture* rt, GPUTexture* ds, u32 width, u32 height)
   : m_rt(rt), m_ds(ds), m_width(width), m_height(height)
@@ -237,6 +247,7 @@ bool GPUDevice::Create(const std::string_view& adapter, const std::string_view&
 
 void GPUDevice::Destroy()
 {
+  PurgeTexturePool();
   if (HasSurface())
     DestroySurface();
   DestroyResources();
@@ -261,15 +272,17 @@ void GPUDevice::OpenShaderCache(const std::string_view& base_path, u32 version)
       if (!m_shader_cache.Create())
         Log_ErrorPrintf("Failed to create new shader cache.");
 
-      // Squish the pipeline cache too, it's going to be stale.
+      // Squish the pipeline caches too, they're all going to be stale.
       if (m_features.pipeline_cache)
       {
-        const std::string pc_filename =
-          Path::Combine(base_path, TinyString::FromFmt("{}.bin", GetShaderCacheBaseName("pipelines")));
-        if (FileSystem::FileExists(pc_filename.c_str()))
+        FileSystem::FindResultsArray pc_files;
+        FileSystem::FindFiles(std::string(base_path).c_str(),
+                              TinyString::FromFmt("{}*.bin", GetShaderCacheBaseName("pipelines")),
+                              FILESYSTEM_FIND_FILES, &pc_files);
+        for (const FILESYSTEM_FIND_DATA& fd : pc_files)
         {
-          Log_InfoPrintf("Removing old pipeline cache '%s'", pc_filename.c_str());
-          FileSystem::DeleteFile(pc_filename.c_str());
+          Log_InfoPrintf("Removing old pipeline cache '%s'", fd.FileName.c_str());
+          FileSystem::DeleteFile(fd.FileName.c_str());
         }
       }
     }
@@ -281,14 +294,23 @@ void GPUDevice::OpenShaderCache(const std::string_view& base_path, u32 version)
   }
 
   s_pipeline_cache_path = {};
+  s_pipeline_cache_dirty = false;
   if (m_features.pipeline_cache && !base_path.empty())
   {
     const std::string basename = GetShaderCacheBaseName("pipelines");
-    const std::string filename = Path::Combine(base_path, TinyString::FromFmt("{}.bin", basename));
+    const std::string driver_id = GetPipelineCacheDriverId();
+    std::string filename =
+      Path::Combine(base_path, driver_id.empty() ? TinyString::FromFmt("{}.bin", basename) :
+                                                   TinyString::FromFmt("{}_{}.bin", basename, driver_id));
     if (ReadPipelineCache(filename))
+    {
       s_pipeline_cache_path = std::move(filename);
+      s_pipeline_cache_save_timer.Reset();
+    }
     else
+    {
       Log_WarningPrintf("Failed to read pipeline cache.");
+    }
   }
 }
 
@@ -298,24 +320,63 @@ void GPUDevice::CloseShaderCache()
 
   if (!s_pipeline_cache_path.empty())
   {
-    DynamicHeapArray<u8> data;
-    if (GetPipelineCacheData(&data))
-    {
-      // Save disk writes if it hasn't changed, think of the poor SSDs.
-      FILESYSTEM_STAT_DATA sd;
-      if (!FileSystem::StatFile(s_pipeline_cache_path.c_str(), &sd) || sd.Size != static_cast<s64>(data.size()))
-      {
-        Log_InfoPrintf("Writing %zu bytes to '%s'", data.size(), s_pipeline_cache_path.c_str());
-        if (!FileSystem::WriteBinaryFile(s_pipeline_cache_path.c_str(), data.data(), data.size()))
-          Log_ErrorPrintf("Failed to write pipeline cache to '%s'", s_pipeline_cache_path.c_str());
-      }
-      else
-      {
-        Log_InfoPrintf("Skipping updating pipeline cache '%s' due to no changes.", s_pipeline_cache_path.c_str());
-      }
-    }
+    if (s_pipeline_cache_dirty)
+      SavePipelineCache(false);
+    else
+      Log_InfoPrintf("Skipping updating pipeline cache '%s' due to no changes.", s_pipeline_cache_path.c_str());
 
     s_pipeline_cache_path = {};
+    s_pipeline_cache_dirty = false;
+  }
+}
+
+void GPUDevice::MarkPipelineCacheDirty()
+{
+  s_pipeline_cache_dirty = true;
+}
+
+void GPUDevice::MaybeSavePipelineCache()
+{
+  if (s_pipeline_cache_path.empty() || !s_pipeline_cache_dirty ||
+      s_pipeline_cache_save_timer.GetTimeSeconds() < PIPELINE_CACHE_SAVE_INTERVAL_SECONDS)
+  {
+    return;
+  }
+
+  SavePipelineCache(true);
+}
+
+void GPUDevice::SavePipelineCache(bool background)
+{
+  DynamicHeapArray<u8> data;
+  if (!GetPipelineCacheData(&data))
+    return;
+
+  s_pipeline_cache_dirty = false;
+  s_pipeline_cache_save_timer.Reset();
+
+  // Save disk writes if it hasn't changed, think of the poor SSDs.
+  FILESYSTEM_STAT_DATA sd;
+  if (FileSystem::StatFile(s_pipeline_cache_path.c_str(), &sd) && sd.Size == static_cast<s64>(data.size()))
+  {
+    Log_InfoPrintf("Skipping updating pipeline cache '%s' due to no changes.", s_pipeline_cache_path.c_str());
+    return;
+  }
+
+  Log_InfoPrintf("Writing %zu bytes to '%s'", data.size(), s_pipeline_cache_path.c_str());
+  if (background)
+  {
+    // Serialization already happened above, only the disk write moves to the pool. std::function
+    // needs a copyable callable, so the data rides along in a shared_ptr.
+    std::shared_ptr<DynamicHeapArray<u8>> shared_data = std::make_shared<DynamicHeapArray<u8>>(std::move(data));
+    Threading::GetSharedThreadPool().Schedule([path = s_pipeline_cache_path, shared_data]() {
+      if (!FileSystem::WriteBinaryFile(path.c_str(), shared_data->data(), shared_data->size()))
+        Log_ErrorPrintf("Failed to write pipeline cache to '%s'", path.c_str());
+    });
+  }
+  else if (!FileSystem::WriteBinaryFile(s_pipeline_cache_path.c_str(), data.data(), data.size()))
+  {
+    Log_ErrorPrintf("Failed to write pipeline cache to '%s'", s_pipeline_cache_path.c_str());
   }
 }
 
@@ -373,6 +434,68 @@ bool GPUDevice::GetPipelineCacheData(DynamicHeapArray<u8>* data)
   return false;
 }
 
+std::string GPUDevice::GetPipelineCacheDriverId()
+{
+  return {};
+}
+
+std::unique_ptr<GPUTexture> GPUDevice::FetchTexture(u32 width, u32 height, u32 layers, u32 levels, u32 samples,
+                                                    GPUTexture::Type type, GPUTexture::Format format, const void* data,
+                                                    u32 data_stride, bool dynamic)
+{
+  // Dynamic textures have backend-specific creation flags, so they always go to the driver.
+  if (!dynamic)
+  {
+    for (auto it = m_texture_pool.begin(); it != m_texture_pool.end(); ++it)
+    {
+      const GPUTexture* const tex = it->texture.get();
+      if (tex->GetWidth() == width && tex->GetHeight() == height && tex->GetLayers() == layers &&
+          tex->GetLevels() == levels && tex->GetSamples() == samples && tex->GetType() == type &&
+          tex->GetFormat() == format)
+      {
+        std::unique_ptr<GPUTexture> ret = std::move(it->texture);
+        m_texture_pool.erase(it);
+        if (data && !ret->Update(0, 0, width, height, data, data_stride))
+        {
+          Log_ErrorPrintf("Failed to upload %ux%u data to pooled texture", width, height);
+          return {};
+        }
+
+        return ret;
+      }
+    }
+  }
+
+  return CreateTexture(width, height, layers, levels, samples, type, format, data, data_stride, dynamic);
+}
+
+void GPUDevice::RecycleTexture(std::unique_ptr<GPUTexture> texture)
+{
+  if (!texture)
+    return;
+
+  if (m_texture_pool.size() >= MAX_TEXTURE_POOL_SIZE)
+    m_texture_pool.pop_front();
+
+  m_texture_pool.push_back({std::move(texture), 0});
+}
+
+void GPUDevice::PurgeTexturePool()
+{
+  m_texture_pool.clear();
+}
+
+void GPUDevice::TrimTexturePool()
+{
+  for (auto it = m_texture_pool.begin(); it != m_texture_pool.end();)
+  {
+    if (++it->age > POOL_PURGE_DELAY)
+      it = m_texture_pool.erase(it);
+    else
+      ++it;
+  }
+}
+
 bool GPUDevice::AcquireWindow(bool recreate_window)
 {
   std::optional<WindowInfo> wi = Host::AcquireRenderWindow(recreate_window);
@@ -559,16 +682,26 @@ std::unique_ptr<GPUShader> GPUDevice::CreateShader(GPUShaderStage stage, const s
     return shader;
   }
 
+  // The cache index and blob file are shared between all shaders, and compilation can happen on
+  // multiple threads when the backend reports parallel_shader_compilation, so access to it has to
+  // be serialized. The compile itself runs unlocked.
   const GPUShaderCache::CacheIndexKey key = m_shader_cache.GetCacheKey(stage, source, entry_point);
   DynamicHeapArray<u8> binary;
-  if (m_shader_cache.Lookup(key, &binary))
+
   {
-    shader = CreateShaderFromBinary(stage, binary);
-    if (shader)
-      return shader;
+    std::unique_lock lock(m_shader_cache_mutex);
+    if (m_shader_cache.Lookup(key, &binary))
+    {
+      lock.unlock();
 
-    Log_ErrorPrintf("Failed to create shader from binary (driver changed?). Clearing cache.");
-    m_shader_cache.Clear();
+      shader = CreateShaderFromBinary(stage, binary);
+      if (shader)
+        return shader;
+
+      Log_ErrorPrintf("Failed to create shader from binary (driver changed?). Clearing cache.");
+      lock.lock();
+      m_shader_cache.Clear();
+    }
   }
 
   shader = CreateShaderFromSource(stage, source, entry_point, &binary);
@@ -578,6 +711,7 @@ std::unique_ptr<GPUShader> GPUDevice::CreateShader(GPUShaderStage stage, const s
   // Don't insert empty shaders into the cache...
   if (!binary.empty())
   {
+    std::unique_lock lock(m_shader_cache_mutex);
     if (!m_shader_cache.Insert(key, binary.data(), static_cast<u32>(binary.size())))
       m_shader_cache.Close();
   }
@@ -743,6 +877,34 @@ float GPUDevice::GetAndResetAccumulatedGPUTime()
   return 0.0f;
 }
 
+void GPUDevice::BeginTimerScope(const char* name)
+{
+}
+
+void GPUDevice::EndTimerScope()
+{
+}
+
+void GPUDevice::AccumulateTimerScope(const char* name, float time_ms)
+{
+  for (TimerScopeResult& res : m_timer_scope_results)
+  {
+    // Names are string literals, so pointer equality is the common case.
+    if (res.name == name || std::strcmp(res.name, name) == 0)
+    {
+      res.time_ms += time_ms;
+      return;
+    }
+  }
+
+  m_timer_scope_results.push_back({name, time_ms});
+}
+
+std::vector<GPUDevice::TimerScopeResult> GPUDevice::GetAndResetTimerScopes()
+{
+  return std::exchange(m_timer_scope_results, {});
+}
+
 std::unique_ptr<GPUDevice> GPUDevice::CreateDeviceForAPI(RenderAPI api)
 {
   switch (api)
@@ -12,7 +12,9 @@
 #include "common/rectangle.h"
 #include "common/types.h"
 
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <span>
 #include <string>
@@ -450,6 +452,8 @@ public:
     bool gpu_timing : 1;
     bool shader_cache : 1;
     bool pipeline_cache : 1;
+    bool parallel_pipeline_compilation : 1;
+    bool parallel_shader_compilation : 1;
   };
 
   struct AdapterAndModeList
@@ -545,6 +549,21 @@ public:
   virtual std::unique_ptr<GPUTextureBuffer> CreateTextureBuffer(GPUTextureBuffer::Format format,
                                                                 u32 size_in_elements) = 0;
 
+  /// Texture pooling. FetchTexture() returns a matching texture from the pool when one is
+  /// available, only going to the driver on a miss, and RecycleTexture() returns one to the pool
+  /// instead of freeing it. The object stays alive across recycling, so in-flight GPU references
+  /// remain valid without any fence tracking. Intended for targets that get recreated wholesale on
+  /// resolution/setting changes; pooled textures that go unused are freed by TrimTexturePool().
+  std::unique_ptr<GPUTexture> FetchTexture(u32 width, u32 height, u32 layers, u32 levels, u32 samples,
+                                           GPUTexture::Type type, GPUTexture::Format format, const void* data = nullptr,
+                                           u32 data_stride = 0, bool dynamic = false);
+  void RecycleTexture(std::unique_ptr<GPUTexture> texture);
+  void PurgeTexturePool();
+
+  /// Ages the texture pool, freeing textures that have not been reused recently. Called
+  /// periodically, roughly once a second.
+  void TrimTexturePool();
+
   virtual bool DownloadTexture(GPUTexture* texture, u32 x, u32 y, u32 width, u32 height, void* out_data,
                                u32 out_data_stride) = 0;
   virtual void CopyTextureRegion(GPUTexture* dst, u32 dst_x, u32 dst_y, u32 dst_layer, u32 dst_level, GPUTexture* src,
@@ -625,6 +644,27 @@ public:
   /// Returns the amount of GPU time utilized since the last time this method was called.
   virtual float GetAndResetAccumulatedGPUTime();
 
+  struct TimerScopeResult
+  {
+    const char* name;
+    float time_ms;
+  };
+
+  /// Named GPU timer scopes, used to attribute frame time to individual passes. name must be a
+  /// string literal. Scopes cannot nest, and are no-ops when GPU timing is disabled or the
+  /// backend lacks timestamp support.
+  virtual void BeginTimerScope(const char* name);
+  virtual void EndTimerScope();
+
+  /// Returns the per-scope GPU times accumulated since the last call. Scopes resolve once their
+  /// command buffer completes, i.e. a couple of frames after they were recorded.
+  std::vector<TimerScopeResult> GetAndResetTimerScopes();
+
+  /// Saves the pipeline cache if new pipelines have been compiled since the last save. The disk
+  /// write happens on the shared thread pool, so the synchronous save at shutdown usually has
+  /// nothing left to flush.
+  void MaybeSavePipelineCache();
+
 protected:
   virtual bool CreateDevice(const std::string_view& adapter, bool threaded_presentation) = 0;
   virtual void DestroyDevice() = 0;
@@ -633,6 +673,16 @@ protected:
   virtual bool ReadPipelineCache(const std::string& filename);
   virtual bool GetPipelineCacheData(DynamicHeapArray<u8>* data);
 
+  /// Returns a string identifying the driver build the pipeline cache is tied to, used to
+  /// partition the cache on disk. A driver update then starts a fresh cache file instead of
+  /// invalidating the old one, which remains usable if the update is rolled back. Empty when the
+  /// backend's cache format is not driver-specific.
+  virtual std::string GetPipelineCacheDriverId();
+
+  /// Flags the on-disk pipeline cache as outdated. Backends call this when compiling a pipeline
+  /// that feeds the cache.
+  void MarkPipelineCacheDirty();
+
   virtual std::unique_ptr<GPUShader> CreateShaderFromBinary(GPUShaderStage stage, std::span<const u8> data) = 0;
   virtual std::unique_ptr<GPUShader> CreateShaderFromSource(GPUShaderStage stage, const std::string_view& source,
                                                             const char* entry_point,
@@ -640,6 +690,10 @@ protected:
 
   bool AcquireWindow(bool recreate_window);
 
+  /// Called by backends when a timer scope's queries have resolved. Times for matching names are
+  /// merged, so a scope recorded multiple times per frame reports its total.
+  void AccumulateTimerScope(const char* name, float time_ms);
+
   Features m_features = {};
   u32 m_max_texture_size = 0;
   u32 m_max_multisamples = 0;
@@ -647,10 +701,13 @@ protected:
   WindowInfo m_window_info;
 
   GPUShaderCache m_shader_cache;
+  std::mutex m_shader_cache_mutex;
 
   std::unique_ptr<GPUSampler> m_nearest_sampler;
   std::unique_ptr<GPUSampler> m_linear_sampler;
 
+  std::vector<TimerScopeResult> m_timer_scope_results;
+
   bool m_gpu_timing_enabled = false;
   bool m_vsync_enabled = false;
   bool m_debug_device = false;
@@ -658,6 +715,20 @@ protected:
 private:
   void OpenShaderCache(const std::string_view& base_path, u32 version);
   void CloseShaderCache();
+  void SavePipelineCache(bool background);
+
+  // Upper bound on pooled textures, and the number of TrimTexturePool() calls a texture can sit
+  // unused in the pool before it is freed.
+  static constexpr u32 MAX_TEXTURE_POOL_SIZE = 128;
+  static constexpr u32 POOL_PURGE_DELAY = 30;
+
+  struct TexturePoolEntry
+  {
+    std::unique_ptr<GPUTexture> texture;
+    u32 age;
+  };
+
+  std::deque<TexturePoolEntry> m_texture_pool;
   bool CreateResources();
   void DestroyResources();
 
@@ -7,13 +7,16 @@
 #include "common/file_system.h"
 #include "common/heap_array.h"
 #include "common/log.h"
-#include "common/md5_digest.h"
 
 #include "fmt/format.h"
 
+#include "xxhash.h"
+
 #include "zstd.h"
 #include "zstd_errors.h"
 
+#include <ctime>
+
 Log_SetChannel(GPUShaderCache);
 
 #pragma pack(push, 1)
@@ -28,9 +31,25 @@ struct CacheIndexEntry
   u32 file_offset;
   u32 compressed_size;
   u32 uncompressed_size;
+  u64 last_used_time;
 };
 #pragma pack(pop)
 
+// Mixed into the version field on disk, so layout changes to CacheIndexEntry invalidate old files
+// cleanly instead of misparsing them. Bump when the entry struct changes.
+static constexpr u32 INDEX_VERSION_TAG = 0x53433200; // 'SC2\0'
+
+// Entries that haven't been looked up for this long get dropped at open; combined with blob
+// compaction this stops long-lived caches from growing forever as settings change.
+static constexpr u64 PRUNE_AGE_SECONDS = 90ULL * 24 * 60 * 60;
+
+// Timestamps are refreshed at day granularity so a cache that's only being read doesn't need its
+// index rewritten on every shutdown.
+static constexpr u64 TIMESTAMP_REFRESH_SECONDS = 24 * 60 * 60;
+
+// Dead blob bytes (from pruned or superseded entries) tolerated before the files are rewritten.
+static constexpr u32 COMPACT_MIN_WASTE_BYTES = 16 * 1024 * 1024;
+
 GPUShaderCache::GPUShaderCache() = default;
 
 GPUShaderCache::~GPUShaderCache()
@@ -64,6 +83,10 @@ bool GPUShaderCache::Open(const std::string_view& base_filename, u32 version)
   if (base_filename.empty())
     return true;
 
+  // Probe for a pre-built read-only pack regardless of whether the writable cache opens, so a
+  // fresh Create() still gets its benefit.
+  ReadPack(fmt::format("{}.pack.idx", m_base_filename), fmt::format("{}.pack.bin", m_base_filename));
+
   const std::string index_filename = fmt::format("{}.idx", m_base_filename);
   const std::string blob_filename = fmt::format("{}.bin", m_base_filename);
   return ReadExisting(index_filename, blob_filename);
@@ -80,6 +103,12 @@ void GPUShaderCache::Close()
 {
   if (m_index_file)
   {
+    // Refreshed timestamps only live in memory until this point. The in-memory index always has
+    // exactly the same record set as the file, so an in-place rewrite is size-exact.
+    if (m_index_dirty && !RewriteIndexFile())
+      Log_ErrorPrintf("Failed to update index file for '%s'", m_base_filename.c_str());
+    m_index_dirty = false;
+
     std::fclose(m_index_file);
     m_index_file = nullptr;
   }
@@ -88,6 +117,14 @@ void GPUShaderCache::Close()
     std::fclose(m_blob_file);
     m_blob_file = nullptr;
   }
+  m_blob_file_map.Close();
+  if (m_pack_blob_file)
+  {
+    std::fclose(m_pack_blob_file);
+    m_pack_blob_file = nullptr;
+  }
+  m_pack_blob_file_map.Close();
+  m_pack_index.clear();
 }
 
 void GPUShaderCache::Clear()
@@ -102,6 +139,9 @@ void GPUShaderCache::Clear()
   const std::string index_filename = fmt::format("{}.idx", m_base_filename);
   const std::string blob_filename = fmt::format("{}.bin", m_base_filename);
   CreateNew(index_filename, blob_filename);
+
+  // Only the writable cache gets blown away, the read-only pack is still valid.
+  ReadPack(fmt::format("{}.pack.idx", m_base_filename), fmt::format("{}.pack.bin", m_base_filename));
 }
 
 bool GPUShaderCache::CreateNew(const std::string& index_filename, const std::string& blob_filename)
@@ -124,7 +164,8 @@ bool GPUShaderCache::CreateNew(const std::string& index_filename, const std::str
     return false;
   }
 
-  if (std::fwrite(&m_version, sizeof(m_version), 1, m_index_file) != 1)
+  const u32 tagged_version = m_version ^ INDEX_VERSION_TAG;
+  if (std::fwrite(&tagged_version, sizeof(tagged_version), 1, m_index_file) != 1)
   {
     Log_ErrorPrintf("Failed to write version to index file '%s'", index_filename.c_str());
     std::fclose(m_index_file);
@@ -163,7 +204,8 @@ bool GPUShaderCache::ReadExisting(const std::string& index_filename, const std::
   }
 
   u32 file_version = 0;
-  if (std::fread(&file_version, sizeof(file_version), 1, m_index_file) != 1 || file_version != m_version)
+  if (std::fread(&file_version, sizeof(file_version), 1, m_index_file) != 1 ||
+      file_version != (m_version ^ INDEX_VERSION_TAG))
   {
     Log_ErrorPrintf("Bad file/data version in '%s'", index_filename.c_str());
     std::fclose(m_index_file);
@@ -203,45 +245,214 @@ bool GPUShaderCache::ReadExisting(const std::string& index_filename, const std::
 
     const CacheIndexKey key{entry.shader_type,      entry.source_length,   entry.source_hash_low,
                             entry.source_hash_high, entry.entry_point_low, entry.entry_point_high};
-    const CacheIndexData data{entry.file_offset, entry.compressed_size, entry.uncompressed_size};
-    m_index.emplace(key, data);
+    const CacheIndexData data{entry.file_offset, entry.compressed_size, entry.uncompressed_size,
+                              entry.last_used_time};
+    m_index[key] = data;
   }
 
   // ensure we don't write before seeking
   std::fseek(m_index_file, 0, SEEK_END);
 
   Log_DevPrintf("Read %zu entries from '%s'", m_index.size(), index_filename.c_str());
+
+  // Drop entries that haven't been touched in months - they're usually permutations from settings
+  // the user no longer runs with - and rewrite the files once the dead bytes are worth reclaiming.
+  const u64 now = static_cast<u64>(std::time(nullptr));
+  u64 live_bytes = 0;
+  bool pruned = false;
+  for (auto iter = m_index.begin(); iter != m_index.end();)
+  {
+    if (now >= iter->second.last_used_time && (now - iter->second.last_used_time) >= PRUNE_AGE_SECONDS)
+    {
+      iter = m_index.erase(iter);
+      pruned = true;
+    }
+    else
+    {
+      live_bytes += iter->second.compressed_size;
+      ++iter;
+    }
+  }
+
+  const u64 dead_bytes = (live_bytes < blob_file_size) ? (blob_file_size - live_bytes) : 0;
+  if (pruned || dead_bytes >= COMPACT_MIN_WASTE_BYTES)
+  {
+    if (!CompactFiles(index_filename, blob_filename))
+    {
+      Log_ErrorPrintf("Failed to compact shader cache '%s'", m_base_filename.c_str());
+      Close();
+      return false;
+    }
+  }
+
+  // Map the blob read-only so instances sharing a cache directory share the pages. Best-effort, a
+  // failed mapping just means reads go through the stream.
+  m_blob_file_map.Open(blob_filename.c_str());
+
   return true;
 }
 
-GPUShaderCache::CacheIndexKey GPUShaderCache::GetCacheKey(GPUShaderStage stage, const std::string_view& shader_code,
-                                                          const std::string_view& entry_point)
+bool GPUShaderCache::RewriteIndexFile()
+{
+  if (std::fseek(m_index_file, 0, SEEK_SET) != 0)
+    return false;
+
+  const u32 tagged_version = m_version ^ INDEX_VERSION_TAG;
+  if (std::fwrite(&tagged_version, sizeof(tagged_version), 1, m_index_file) != 1)
+    return false;
+
+  for (const auto& [key, data] : m_index)
+  {
+    CacheIndexEntry entry = {};
+    entry.shader_type = key.shader_type;
+    entry.source_length = key.source_length;
+    entry.source_hash_low = key.source_hash_low;
+    entry.source_hash_high = key.source_hash_high;
+    entry.entry_point_low = key.entry_point_low;
+    entry.entry_point_high = key.entry_point_high;
+    entry.file_offset = data.file_offset;
+    entry.compressed_size = data.compressed_size;
+    entry.uncompressed_size = data.uncompressed_size;
+    entry.last_used_time = data.last_used_time;
+
+    if (std::fwrite(&entry, sizeof(entry), 1, m_index_file) != 1)
+      return false;
+  }
+
+  return (std::fflush(m_index_file) == 0);
+}
+
+bool GPUShaderCache::CompactFiles(const std::string& index_filename, const std::string& blob_filename)
+{
+  Log_InfoPrintf("Compacting shader cache '%s' (%zu live entries)", m_base_filename.c_str(), m_index.size());
+
+  // The offsets are about to change, so any existing mapping of the old blob layout has to go.
+  m_blob_file_map.Close();
+
+  // Copy the live blobs into a fresh file in index order, then swap it in. If anything goes wrong
+  // before the rename, the old files are untouched.
+  const std::string temp_blob_filename = blob_filename + ".tmp";
+  std::FILE* new_blob_file = FileSystem::OpenCFile(temp_blob_filename.c_str(), "w+b");
+  if (!new_blob_file)
+    return false;
+
+  DynamicHeapArray<u8> copy_buffer;
+  for (auto& [key, data] : m_index)
+  {
+    if (copy_buffer.size() < data.compressed_size)
+      copy_buffer.resize(data.compressed_size);
+
+    if (std::fseek(m_blob_file, data.file_offset, SEEK_SET) != 0 ||
+        std::fread(copy_buffer.data(), data.compressed_size, 1, m_blob_file) != 1)
+    {
+      std::fclose(new_blob_file);
+      FileSystem::DeleteFile(temp_blob_filename.c_str());
+      return false;
+    }
+
+    const u32 new_offset = static_cast<u32>(std::ftell(new_blob_file));
+    if (std::fwrite(copy_buffer.data(), data.compressed_size, 1, new_blob_file) != 1)
+    {
+      std::fclose(new_blob_file);
+      FileSystem::DeleteFile(temp_blob_filename.c_str());
+      return false;
+    }
+
+    data.file_offset = new_offset;
+  }
+
+  const bool flush_ok = (std::fflush(new_blob_file) == 0);
+  std::fclose(new_blob_file);
+  std::fclose(m_blob_file);
+  m_blob_file = nullptr;
+
+  if (!flush_ok || !FileSystem::RenamePath(temp_blob_filename.c_str(), blob_filename.c_str()) ||
+      !(m_blob_file = FileSystem::OpenCFile(blob_filename.c_str(), "a+b")))
+  {
+    FileSystem::DeleteFile(temp_blob_filename.c_str());
+    return false;
+  }
+
+  // The offsets all changed, so the index gets rewritten wholesale. Entries may have been pruned,
+  // so truncate via a fresh handle rather than rewriting in place.
+  std::fclose(m_index_file);
+  if (!(m_index_file = FileSystem::OpenCFile(index_filename.c_str(), "w+b")) || !RewriteIndexFile())
+    return false;
+
+  m_index_dirty = false;
+  return true;
+}
+
+void GPUShaderCache::ReadPack(const std::string& index_filename, const std::string& blob_filename)
 {
-  union
+  // A broken or mismatched pack is never fatal, we just run without it.
+  auto index_file = FileSystem::OpenManagedCFile(index_filename.c_str(), "rb");
+  if (!index_file)
+    return;
+
+  u32 file_version = 0;
+  if (std::fread(&file_version, sizeof(file_version), 1, index_file.get()) != 1 ||
+      file_version != (m_version ^ INDEX_VERSION_TAG))
   {
-    struct
+    Log_WarningPrintf("Ignoring cache pack '%s' with mismatched version", index_filename.c_str());
+    return;
+  }
+
+  auto blob_file = FileSystem::OpenManagedCFile(blob_filename.c_str(), "rb");
+  if (!blob_file)
+  {
+    Log_WarningPrintf("Cache pack blob file '%s' is missing", blob_filename.c_str());
+    return;
+  }
+
+  std::fseek(blob_file.get(), 0, SEEK_END);
+  const u32 blob_file_size = static_cast<u32>(std::ftell(blob_file.get()));
+
+  for (;;)
+  {
+    CacheIndexEntry entry;
+    if (std::fread(&entry, sizeof(entry), 1, index_file.get()) != 1 ||
+        (entry.file_offset + entry.compressed_size) > blob_file_size)
     {
-      u64 hash_low;
-      u64 hash_high;
-    };
-    u8 hash[16];
-  } h;
+      if (std::feof(index_file.get()))
+        break;
 
+      Log_WarningPrintf("Failed to read entry from '%s', corrupt file? Ignoring pack.", index_filename.c_str());
+      m_pack_index.clear();
+      return;
+    }
+
+    const CacheIndexKey key{entry.shader_type,      entry.source_length,   entry.source_hash_low,
+                            entry.source_hash_high, entry.entry_point_low, entry.entry_point_high};
+    const CacheIndexData data{entry.file_offset, entry.compressed_size, entry.uncompressed_size,
+                              entry.last_used_time};
+    m_pack_index.emplace(key, data);
+  }
+
+  m_pack_blob_file = blob_file.release();
+
+  // The pack never changes, so the mapping can serve every entry.
+  m_pack_blob_file_map.Open(blob_filename.c_str());
+
+  Log_DevPrintf("Read %zu entries from cache pack '%s'", m_pack_index.size(), index_filename.c_str());
+}
+
+GPUShaderCache::CacheIndexKey GPUShaderCache::GetCacheKey(GPUShaderStage stage, const std::string_view& shader_code,
+                                                          const std::string_view& entry_point)
+{
+  // The key doesn't need to be cryptographic, only collision-resistant, and every shader source
+  // gets hashed at startup, so use XXH3 rather than MD5.
   CacheIndexKey key = {};
   key.shader_type = static_cast<u32>(stage);
-
-  MD5Digest digest;
-  digest.Update(shader_code.data(), static_cast<u32>(shader_code.length()));
-  digest.Final(h.hash);
-  key.source_hash_low = h.hash_low;
-  key.source_hash_high = h.hash_high;
   key.source_length = static_cast<u32>(shader_code.length());
 
-  digest.Reset();
-  digest.Update(entry_point.data(), static_cast<u32>(entry_point.length()));
-  digest.Final(h.hash);
-  key.entry_point_low = h.hash_low;
-  key.entry_point_high = h.hash_high;
+  XXH128_hash_t hash = XXH3_128bits(shader_code.data(), shader_code.length());
+  key.source_hash_low = hash.low64;
+  key.source_hash_high = hash.high64;
+
+  hash = XXH3_128bits(entry_point.data(), entry_point.length());
+  key.entry_point_low = hash.low64;
+  key.entry_point_high = hash.high64;
 
   return key;
 }
@@ -249,23 +460,55 @@ GPUShaderCache::CacheIndexKey GPUShaderCache::GetCacheKey(GPUShaderStage stage,
 bool GPUShaderCache::Lookup(const CacheIndexKey& key, ShaderBinary* binary)
 {
   auto iter = m_index.find(key);
-  if (iter == m_index.end())
-    return false;
+  if (iter != m_index.end())
+  {
+    const u64 now = static_cast<u64>(std::time(nullptr));
+    if (now >= (iter->second.last_used_time + TIMESTAMP_REFRESH_SECONDS))
+    {
+      iter->second.last_used_time = now;
+      m_index_dirty = true;
+    }
+
+    return ReadBlob(iter->second, m_blob_file_map, m_blob_file, key.shader_type, binary);
+  }
 
-  binary->resize(iter->second.uncompressed_size);
+  // Fall back to the read-only pack. Hits stay there, re-inserting them into the writable cache
+  // would just duplicate the data on disk.
+  iter = m_pack_index.find(key);
+  if (iter != m_pack_index.end())
+    return ReadBlob(iter->second, m_pack_blob_file_map, m_pack_blob_file, key.shader_type, binary);
 
-  DynamicHeapArray<u8> compressed_data(iter->second.compressed_size);
+  return false;
+}
 
-  if (std::fseek(m_blob_file, iter->second.file_offset, SEEK_SET) != 0 ||
-      std::fread(compressed_data.data(), iter->second.compressed_size, 1, m_blob_file) != 1)
+bool GPUShaderCache::ReadBlob(const CacheIndexData& data, const FileSystem::MemoryMappedFile& blob_map,
+                              std::FILE* blob_file, u32 shader_type, ShaderBinary* binary)
+{
+  binary->resize(data.uncompressed_size);
+
+  // Decompress straight out of the shared mapping when the entry is within it; entries appended
+  // after the file was mapped go through the stream.
+  const u8* compressed_ptr;
+  DynamicHeapArray<u8> compressed_data;
+  if (blob_map.IsOpen() && (static_cast<u64>(data.file_offset) + data.compressed_size) <= blob_map.GetSize())
   {
-    Log_ErrorPrintf("Read %u byte %s shader from file failed", iter->second.compressed_size,
-                    GPUShader::GetStageName(static_cast<GPUShaderStage>(key.shader_type)));
-    return false;
+    compressed_ptr = blob_map.GetData() + data.file_offset;
+  }
+  else
+  {
+    compressed_data.resize(data.compressed_size);
+    if (std::fseek(blob_file, data.file_offset, SEEK_SET) != 0 ||
+        std::fread(compressed_data.data(), data.compressed_size, 1, blob_file) != 1)
+    {
+      Log_ErrorPrintf("Read %u byte %s shader from file failed", data.compressed_size,
+                      GPUShader::GetStageName(static_cast<GPUShaderStage>(shader_type)));
+      return false;
+    }
+
+    compressed_ptr = compressed_data.data();
   }
 
-  const size_t decompress_result =
-    ZSTD_decompress(binary->data(), binary->size(), compressed_data.data(), compressed_data.size());
+  const size_t decompress_result = ZSTD_decompress(binary->data(), binary->size(), compressed_ptr, data.compressed_size);
   if (ZSTD_isError(decompress_result))
   {
     Log_ErrorPrintf("Failed to decompress shader: %s", ZSTD_getErrorName(decompress_result));
@@ -292,6 +535,7 @@ bool GPUShaderCache::Insert(const CacheIndexKey& key, const void* data, u32 data
   idata.file_offset = static_cast<u32>(std::ftell(m_blob_file));
   idata.compressed_size = static_cast<u32>(compress_result);
   idata.uncompressed_size = data_size;
+  idata.last_used_time = static_cast<u64>(std::time(nullptr));
 
   CacheIndexEntry entry = {};
   entry.shader_type = static_cast<u32>(key.shader_type);
@@ -303,6 +547,7 @@ bool GPUShaderCache::Insert(const CacheIndexKey& key, const void* data, u32 data
   entry.file_offset = idata.file_offset;
   entry.compressed_size = idata.compressed_size;
   entry.uncompressed_size = idata.uncompressed_size;
+  entry.last_used_time = idata.last_used_time;
 
   if (std::fwrite(compress_buffer.data(), compress_result, 1, m_blob_file) != 1 || std::fflush(m_blob_file) != 0 ||
       std::fwrite(&entry, sizeof(entry), 1, m_index_file) != 1 || std::fflush(m_index_file) != 0)
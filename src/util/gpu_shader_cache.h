@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "common/file_system.h"
 #include "common/hash_combine.h"
 #include "common/heap_array.h"
 #include "common/types.h"
@@ -63,12 +64,18 @@ private:
     u32 file_offset;
     u32 compressed_size;
     u32 uncompressed_size;
+    u64 last_used_time;
   };
 
   using CacheIndex = std::unordered_map<CacheIndexKey, CacheIndexData, CacheIndexEntryHash>;
 
   bool CreateNew(const std::string& index_filename, const std::string& blob_filename);
   bool ReadExisting(const std::string& index_filename, const std::string& blob_filename);
+  void ReadPack(const std::string& index_filename, const std::string& blob_filename);
+  bool ReadBlob(const CacheIndexData& data, const FileSystem::MemoryMappedFile& blob_map, std::FILE* blob_file,
+                u32 shader_type, ShaderBinary* binary);
+  bool CompactFiles(const std::string& index_filename, const std::string& blob_filename);
+  bool RewriteIndexFile();
 
   CacheIndex m_index;
 
@@ -77,4 +84,16 @@ private:
 
   std::FILE* m_index_file = nullptr;
   std::FILE* m_blob_file = nullptr;
+  bool m_index_dirty = false;
+
+  // Read-only shared mapping of the blob file, so instances sharing a cache directory share the
+  // pages. Covers the file as it was at open; entries appended later are read through the stream.
+  FileSystem::MemoryMappedFile m_blob_file_map;
+
+  // Optional read-only cache pack ({base}.pack.idx/{base}.pack.bin, same format), consulted on miss.
+  // Used to pre-seed the cache with shaders built elsewhere; hits are served directly, never copied
+  // into the writable cache.
+  CacheIndex m_pack_index;
+  std::FILE* m_pack_blob_file = nullptr;
+  FileSystem::MemoryMappedFile m_pack_blob_file_map;
 };
@@ -14,8 +14,15 @@
 Log_SetChannel(Host);
 
 namespace Host {
-static std::pair<const char*, u32> LookupTranslationString(const std::string_view& context,
-                                                           const std::string_view& msg);
+struct TranslationStringResult
+{
+  const char* str;
+  u32 offset;
+  u32 length;
+  u32 generation;
+};
+
+static TranslationStringResult LookupTranslationString(const std::string_view& context, const std::string_view& msg);
 
 static constexpr u32 TRANSLATION_STRING_CACHE_SIZE = 4 * 1024 * 1024;
 using TranslationStringMap = UnorderedStringMap<std::pair<u32, u32>>;
@@ -24,22 +31,29 @@ static std::shared_mutex s_translation_string_mutex;
 static TranslationStringContextMap s_translation_string_map;
 static std::vector<char> s_translation_string_cache;
 static u32 s_translation_string_cache_pos;
+
+// Bumped whenever previously-returned offsets become invalid (language change, cache wrap), so
+// call-site caches know to re-resolve. Starts at 1 so a zero-initialized cache never matches.
+static std::atomic<u32> s_translation_string_generation{1};
 } // namespace Host
 
-std::pair<const char*, u32> Host::LookupTranslationString(const std::string_view& context, const std::string_view& msg)
+Host::TranslationStringResult Host::LookupTranslationString(const std::string_view& context,
+                                                            const std::string_view& msg)
 {
   // TODO: TranslatableString, compile-time hashing.
 
   TranslationStringContextMap::iterator ctx_it;
   TranslationStringMap::iterator msg_it;
-  std::pair<const char*, u32> ret;
+  TranslationStringResult ret;
   s32 len;
 
   // Shouldn't happen, but just in case someone tries to translate an empty string.
   if (msg.empty()) [[unlikely]]
   {
-    ret.first = &s_translation_string_cache[0];
-    ret.second = 0;
+    ret.str = &s_translation_string_cache[0];
+    ret.offset = 0;
+    ret.length = 0;
+    ret.generation = s_translation_string_generation.load(std::memory_order_relaxed);
     return ret;
   }
 
@@ -53,8 +67,10 @@ std::pair<const char*, u32> Host::LookupTranslationString(const std::string_view
   if (msg_it == ctx_it->second.end()) [[unlikely]]
     goto add_string;
 
-  ret.first = &s_translation_string_cache[msg_it->second.first];
-  ret.second = msg_it->second.second;
+  ret.str = &s_translation_string_cache[msg_it->second.first];
+  ret.offset = msg_it->second.first;
+  ret.length = msg_it->second.second;
+  ret.generation = s_translation_string_generation.load(std::memory_order_relaxed);
   s_translation_string_mutex.unlock_shared();
   return ret;
 
@@ -76,6 +92,7 @@ add_string:
   {
     Log_ErrorPrint("WARNING: Clearing translation string cache, it might need to be larger.");
     s_translation_string_cache_pos = 0;
+    s_translation_string_generation.fetch_add(1, std::memory_order_release);
     if ((len =
            Internal::GetTranslatedStringImpl(context, msg, &s_translation_string_cache[s_translation_string_cache_pos],
                                              TRANSLATION_STRING_CACHE_SIZE - 1 - s_translation_string_cache_pos)) < 0)
@@ -97,21 +114,53 @@ add_string:
   ctx_it->second.emplace(msg, std::pair<u32, u32>(insert_pos, static_cast<u32>(len)));
   s_translation_string_cache_pos = insert_pos + static_cast<u32>(len) + 1;
 
-  ret.first = &s_translation_string_cache[insert_pos];
-  ret.second = static_cast<u32>(len);
+  ret.str = &s_translation_string_cache[insert_pos];
+  ret.offset = insert_pos;
+  ret.length = static_cast<u32>(len);
+  ret.generation = s_translation_string_generation.load(std::memory_order_relaxed);
   s_translation_string_mutex.unlock();
   return ret;
 }
 
 const char* Host::TranslateToCString(const std::string_view& context, const std::string_view& msg)
 {
-  return LookupTranslationString(context, msg).first;
+  return LookupTranslationString(context, msg).str;
 }
 
 std::string_view Host::TranslateToStringView(const std::string_view& context, const std::string_view& msg)
 {
-  const auto mp = LookupTranslationString(context, msg);
-  return std::string_view(mp.first, mp.second);
+  const TranslationStringResult res = LookupTranslationString(context, msg);
+  return std::string_view(res.str, res.length);
+}
+
+const char* Host::TranslateToCStringCached(CachedTranslationString& cache, const std::string_view& context,
+                                           const std::string_view& msg)
+{
+  // Strings in the cache are null-terminated, so the view doubles as a C string.
+  return TranslateToStringViewCached(cache, context, msg).data();
+}
+
+std::string_view Host::TranslateToStringViewCached(CachedTranslationString& cache, const std::string_view& context,
+                                                   const std::string_view& msg)
+{
+  // Packed as {generation:16, length:16, offset:32} into the string cache. Like the uncached
+  // variants, the returned string is only guaranteed to be valid until the next language change.
+  const u64 cached = cache.load(std::memory_order_acquire);
+  const u32 generation = s_translation_string_generation.load(std::memory_order_acquire);
+  if (static_cast<u32>(cached >> 48) == (generation & 0xFFFFu)) [[likely]]
+  {
+    return std::string_view(&s_translation_string_cache[static_cast<u32>(cached & 0xFFFFFFFFu)],
+                            static_cast<u32>(cached >> 32) & 0xFFFFu);
+  }
+
+  const TranslationStringResult res = LookupTranslationString(context, msg);
+  if (res.length <= 0xFFFFu) [[likely]]
+  {
+    cache.store((static_cast<u64>(res.generation & 0xFFFFu) << 48) | (static_cast<u64>(res.length) << 32) | res.offset,
+                std::memory_order_release);
+  }
+
+  return std::string_view(res.str, res.length);
 }
 
 std::string Host::TranslateToString(const std::string_view& context, const std::string_view& msg)
@@ -124,6 +173,7 @@ void Host::ClearTranslationCache()
   s_translation_string_mutex.lock();
   s_translation_string_map.clear();
   s_translation_string_cache_pos = 0;
+  s_translation_string_generation.fetch_add(1, std::memory_order_release);
   s_translation_string_mutex.unlock();
 }
 
@@ -5,6 +5,7 @@
 
 #include "common/types.h"
 
+#include <atomic>
 #include <ctime>
 #include <optional>
 #include <string>
@@ -49,6 +50,18 @@ std::string_view TranslateToStringView(const std::string_view& context, const st
 /// Returns a localized version of the specified string within the specified context.
 std::string TranslateToString(const std::string_view& context, const std::string_view& msg);
 
+/// Call-site cache for a translated string. The cached variants below store the first lookup's result
+/// here and return it with a single atomic load afterwards, so call sites which translate the same
+/// literal repeatedly (e.g. rebuilding the fullscreen UI menus every frame) skip the hash lookup.
+/// Zero-initialization is a valid empty cache; entries invalidate automatically on language change.
+using CachedTranslationString = std::atomic<u64>;
+
+/// Cached versions of TranslateToCString()/TranslateToStringView(), see CachedTranslationString.
+const char* TranslateToCStringCached(CachedTranslationString& cache, const std::string_view& context,
+                                     const std::string_view& msg);
+std::string_view TranslateToStringViewCached(CachedTranslationString& cache, const std::string_view& context,
+                                             const std::string_view& msg);
+
 /// Clears the translation cache. All previously used strings should be considered invalid.
 void ClearTranslationCache();
 
@@ -65,5 +78,17 @@ s32 GetTranslatedStringImpl(const std::string_view& context, const std::string_v
 #define TRANSLATE_STR(context, msg) Host::TranslateToString(context, msg)
 #define TRANSLATE_FS(context, msg) fmt::runtime(Host::TranslateToStringView(context, msg))
 
+// Cached variants, for call sites which translate the same literal over and over.
+#define TRANSLATE_CACHED(context, msg)                                                                                 \
+  ([]() {                                                                                                              \
+    static Host::CachedTranslationString cache;                                                                        \
+    return Host::TranslateToCStringCached(cache, context, msg);                                                        \
+  })()
+#define TRANSLATE_CACHED_SV(context, msg)                                                                              \
+  ([]() {                                                                                                              \
+    static Host::CachedTranslationString cache;                                                                        \
+    return Host::TranslateToStringViewCached(cache, context, msg);                                                     \
+  })()
+
 // Does not translate the string at runtime, but allows the UI to in its own way.
 #define TRANSLATE_NOOP(context, msg) msg
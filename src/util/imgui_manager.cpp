@@ -22,6 +22,7 @@
 #include <atomic>
 #include <chrono>
 #include <cmath>
+#include <cstring>
 #include <deque>
 #include <mutex>
 #include <unordered_map>
@@ -59,7 +60,11 @@ static float s_global_prescale = 1.0f; // before window scale
 static float s_global_scale = 1.0f;
 
 static std::string s_font_path;
-static const ImWchar* s_font_range = nullptr;
+
+// Owned copy of the caller's glyph ranges. Keeping our own copy means a language change that
+// resolves to the same glyph set can be detected and skipped, the CJK sets are large enough that
+// re-rasterizing them for nothing is a visible stall.
+static std::vector<ImWchar> s_font_range;
 
 static ImFont* s_standard_font;
 static ImFont* s_fixed_font;
@@ -97,14 +102,29 @@ static std::array<ImGuiManager::SoftwareCursor, InputManager::MAX_SOFTWARE_CURSO
 
 void ImGuiManager::SetFontPath(std::string path)
 {
+  if (s_font_path == path)
+    return;
+
   s_font_path = std::move(path);
   s_standard_font_data = {};
 }
 
 void ImGuiManager::SetFontRange(const u16* range)
 {
-  s_font_range = range;
-  s_standard_font_data = {};
+  std::vector<ImWchar> new_range;
+  if (range)
+  {
+    const u16* ptr = range;
+    while (*ptr != 0)
+      new_range.push_back(*(ptr++));
+    new_range.push_back(0);
+  }
+
+  // Unchanged glyph set means the existing atlas is still valid, don't throw it away.
+  if (s_font_range == new_range)
+    return;
+
+  s_font_range = std::move(new_range);
 }
 
 void ImGuiManager::SetGlobalScale(float global_scale)
@@ -491,7 +511,7 @@ ImFont* ImGuiManager::AddTextFont(float size)
   cfg.FontDataOwnedByAtlas = false;
   return ImGui::GetIO().Fonts->AddFontFromMemoryTTF(s_standard_font_data.data(),
                                                     static_cast<int>(s_standard_font_data.size()), size, &cfg,
-                                                    s_font_range ? s_font_range : default_ranges);
+                                                    s_font_range.empty() ? default_ranges : s_font_range.data());
 }
 
 ImFont* ImGuiManager::AddFixedFont(float size)
@@ -629,7 +649,14 @@ void Host::AddFormattedOSDMessage(float duration, const char* format, ...)
 
 void Host::AddIconOSDMessage(std::string key, const char* icon, std::string message, float duration /* = 2.0f */)
 {
-  return AddKeyedOSDMessage(std::move(key), fmt::format("{}  {}", icon, message), duration);
+  // Build the prefixed message in a single exact-size allocation, rather than growing
+  // fmt's transient buffer and copying the result out of it.
+  std::string full_message;
+  full_message.reserve(std::strlen(icon) + 2 + message.length());
+  full_message.append(icon);
+  full_message.append("  ");
+  full_message.append(message);
+  return AddKeyedOSDMessage(std::move(key), std::move(full_message), duration);
 }
 
 void Host::AddKeyedFormattedOSDMessage(std::string key, float duration, const char* format, ...)
@@ -61,9 +61,59 @@ bool INISettingsInterface::Load()
   if (fp)
     err = m_ini.LoadFile(fp.get());
 
+  InvalidateLookupIndex();
+  if (err == SI_OK)
+    BuildLookupIndex();
+
   return (err == SI_OK);
 }
 
+void INISettingsInterface::BuildLookupIndex()
+{
+  std::list<CSimpleIniA::Entry> sections;
+  m_ini.GetAllSections(sections);
+
+  std::list<CSimpleIniA::Entry> keys;
+  for (const CSimpleIniA::Entry& section : sections)
+  {
+    keys.clear();
+    if (!m_ini.GetAllKeys(section.pItem, keys))
+      continue;
+
+    UnorderedStringMap<const char*>& section_map = m_lookup_index[section.pItem];
+    section_map.reserve(keys.size());
+    for (const CSimpleIniA::Entry& key : keys)
+    {
+      const char* value = m_ini.GetValue(section.pItem, key.pItem);
+      if (value)
+        section_map.emplace(key.pItem, value);
+    }
+  }
+
+  m_lookup_index_valid = true;
+}
+
+void INISettingsInterface::InvalidateLookupIndex()
+{
+  m_lookup_index.clear();
+  m_lookup_index_valid = false;
+}
+
+const char* INISettingsInterface::LookupValue(const char* section, const char* key) const
+{
+  // After a modification the index is stale, so reads go back to the ini until the next Load(). Writes only
+  // happen from the settings UI, the hot read paths (startup, game settings layers) load once and never write.
+  if (!m_lookup_index_valid)
+    return m_ini.GetValue(section, key);
+
+  const auto section_iter = m_lookup_index.find(section);
+  if (section_iter == m_lookup_index.end())
+    return nullptr;
+
+  const auto key_iter = section_iter->second.find(key);
+  return (key_iter != section_iter->second.end()) ? key_iter->second : nullptr;
+}
+
 bool INISettingsInterface::Save()
 {
   if (m_filename.empty())
@@ -103,12 +153,13 @@ bool INISettingsInterface::Save()
 
 void INISettingsInterface::Clear()
 {
+  InvalidateLookupIndex();
   m_ini.Reset();
 }
 
 bool INISettingsInterface::GetIntValue(const char* section, const char* key, s32* value) const
 {
-  const char* str_value = m_ini.GetValue(section, key);
+  const char* str_value = LookupValue(section, key);
   if (!str_value)
     return false;
 
@@ -122,7 +173,7 @@ bool INISettingsInterface::GetIntValue(const char* section, const char* key, s32
 
 bool INISettingsInterface::GetUIntValue(const char* section, const char* key, u32* value) const
 {
-  const char* str_value = m_ini.GetValue(section, key);
+  const char* str_value = LookupValue(section, key);
   if (!str_value)
     return false;
 
@@ -136,7 +187,7 @@ bool INISettingsInterface::GetUIntValue(const char* section, const char* key, u3
 
 bool INISettingsInterface::GetFloatValue(const char* section, const char* key, float* value) const
 {
-  const char* str_value = m_ini.GetValue(section, key);
+  const char* str_value = LookupValue(section, key);
   if (!str_value)
     return false;
 
@@ -150,7 +201,7 @@ bool INISettingsInterface::GetFloatValue(const char* section, const char* key, f
 
 bool INISettingsInterface::GetDoubleValue(const char* section, const char* key, double* value) const
 {
-  const char* str_value = m_ini.GetValue(section, key);
+  const char* str_value = LookupValue(section, key);
   if (!str_value)
     return false;
 
@@ -164,7 +215,7 @@ bool INISettingsInterface::GetDoubleValue(const char* section, const char* key,
 
 bool INISettingsInterface::GetBoolValue(const char* section, const char* key, bool* value) const
 {
-  const char* str_value = m_ini.GetValue(section, key);
+  const char* str_value = LookupValue(section, key);
   if (!str_value)
     return false;
 
@@ -178,7 +229,7 @@ bool INISettingsInterface::GetBoolValue(const char* section, const char* key, bo
 
 bool INISettingsInterface::GetStringValue(const char* section, const char* key, std::string* value) const
 {
-  const char* str_value = m_ini.GetValue(section, key);
+  const char* str_value = LookupValue(section, key);
   if (!str_value)
     return false;
 
@@ -189,53 +240,61 @@ bool INISettingsInterface::GetStringValue(const char* section, const char* key,
 void INISettingsInterface::SetIntValue(const char* section, const char* key, s32 value)
 {
   m_dirty = true;
+  InvalidateLookupIndex();
   m_ini.SetValue(section, key, StringUtil::ToChars(value).c_str(), nullptr, true);
 }
 
 void INISettingsInterface::SetUIntValue(const char* section, const char* key, u32 value)
 {
   m_dirty = true;
+  InvalidateLookupIndex();
   m_ini.SetValue(section, key, StringUtil::ToChars(value).c_str(), nullptr, true);
 }
 
 void INISettingsInterface::SetFloatValue(const char* section, const char* key, float value)
 {
   m_dirty = true;
+  InvalidateLookupIndex();
   m_ini.SetValue(section, key, StringUtil::ToChars(value).c_str(), nullptr, true);
 }
 
 void INISettingsInterface::SetDoubleValue(const char* section, const char* key, double value)
 {
   m_dirty = true;
+  InvalidateLookupIndex();
   m_ini.SetValue(section, key, StringUtil::ToChars(value).c_str(), nullptr, true);
 }
 
 void INISettingsInterface::SetBoolValue(const char* section, const char* key, bool value)
 {
   m_dirty = true;
+  InvalidateLookupIndex();
   m_ini.SetBoolValue(section, key, value, nullptr, true);
 }
 
 void INISettingsInterface::SetStringValue(const char* section, const char* key, const char* value)
 {
   m_dirty = true;
+  InvalidateLookupIndex();
   m_ini.SetValue(section, key, value, nullptr, true);
 }
 
 bool INISettingsInterface::ContainsValue(const char* section, const char* key) const
 {
-  return (m_ini.GetValue(section, key, nullptr) != nullptr);
+  return (LookupValue(section, key) != nullptr);
 }
 
 void INISettingsInterface::DeleteValue(const char* section, const char* key)
 {
   m_dirty = true;
+  InvalidateLookupIndex();
   m_ini.Delete(section, key);
 }
 
 void INISettingsInterface::ClearSection(const char* section)
 {
   m_dirty = true;
+  InvalidateLookupIndex();
   m_ini.Delete(section, nullptr);
   m_ini.SetValue(section, nullptr, nullptr);
 }
@@ -256,6 +315,7 @@ std::vector<std::string> INISettingsInterface::GetStringList(const char* section
 void INISettingsInterface::SetStringList(const char* section, const char* key, const std::vector<std::string>& items)
 {
   m_dirty = true;
+  InvalidateLookupIndex();
   m_ini.Delete(section, key);
 
   for (const std::string& sv : items)
@@ -265,6 +325,7 @@ void INISettingsInterface::SetStringList(const char* section, const char* key, c
 bool INISettingsInterface::RemoveFromStringList(const char* section, const char* key, const char* item)
 {
   m_dirty = true;
+  InvalidateLookupIndex();
   return m_ini.DeleteValue(section, key, item, true);
 }
 
@@ -279,6 +340,7 @@ bool INISettingsInterface::AddToStringList(const char* section, const char* key,
   }
 
   m_dirty = true;
+  InvalidateLookupIndex();
   m_ini.SetValue(section, key, item, nullptr, false);
   return true;
 }
@@ -315,6 +377,7 @@ std::vector<std::pair<std::string, std::string>> INISettingsInterface::GetKeyVal
 void INISettingsInterface::SetKeyValueList(const char* section,
                                            const std::vector<std::pair<std::string, std::string>>& items)
 {
+  InvalidateLookupIndex();
   m_ini.Delete(section, nullptr);
   for (const std::pair<std::string, std::string>& item : items)
     m_ini.SetValue(section, item.first.c_str(), item.second.c_str(), nullptr, false);
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
 
 #pragma once
+#include "common/heterogeneous_containers.h"
 #include "common/settings_interface.h"
 
 // being a pain here...
@@ -57,7 +58,17 @@ public:
   using SettingsInterface::GetUIntValue;
 
 private:
+  void BuildLookupIndex();
+  void InvalidateLookupIndex();
+  const char* LookupValue(const char* section, const char* key) const;
+
   std::string m_filename;
   CSimpleIniA m_ini;
   bool m_dirty = false;
+
+  // Hashed section/key index compiled from the parsed ini, so the hundreds of reads during Settings::Load are
+  // O(1) lookups instead of list walks. Modifications invalidate it (reads fall back to the ini until the next
+  // Load()); the values point into the ini's string storage, which is stable while the index is valid.
+  UnorderedStringMap<UnorderedStringMap<const char*>> m_lookup_index;
+  bool m_lookup_index_valid = false;
 };
@@ -16,6 +16,7 @@
 
 #include "fmt/core.h"
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <memory>
@@ -105,6 +106,8 @@ static void AddBindings(const std::vector<std::string>& bindings, const InputEve
 
 static bool IsAxisHandler(const InputEventHandler& handler);
 
+static void CompileBindingDispatchTable();
+
 static void AddHotkeyBindings(SettingsInterface& si);
 static void AddPadBindings(SettingsInterface& si, const std::string& section, u32 pad,
                            const Controller::ControllerInfo* cinfo);
@@ -134,10 +137,25 @@ static BindingMap s_binding_map;
 static VibrationBindingArray s_pad_vibration_array;
 static std::mutex s_binding_map_write_lock;
 
+// Flat dispatch table compiled from the binding map, sorted by masked key bits. Event dispatch
+// binary-searches contiguous pairs instead of walking hash-map nodes, which matters when
+// high-polling-rate devices deliver event storms. Rebuilt whenever bindings are reloaded; the
+// raw pointers are owned by the shared_ptrs in the map.
+static std::vector<std::pair<u64, InputBinding*>> s_binding_dispatch_table;
+
+struct BindingDispatchKeyCompare
+{
+  bool operator()(const std::pair<u64, InputBinding*>& lhs, u64 rhs) const { return (lhs.first < rhs); }
+  bool operator()(u64 lhs, const std::pair<u64, InputBinding*>& rhs) const { return (lhs < rhs.first); }
+};
+
 // Hooks/intercepting (for setting bindings)
 static std::mutex m_event_intercept_mutex;
 static InputInterceptHook::Callback m_event_intercept_callback;
 
+// Mirrors whether a callback is installed, so the common no-hook path doesn't take the mutex.
+static std::atomic_bool m_event_intercept_active{false};
+
 // Input sources. Keyboard/mouse don't exist here.
 static std::array<std::unique_ptr<InputSource>, static_cast<u32>(InputSourceType::Count)> s_input_sources;
 
@@ -806,15 +824,16 @@ bool InputManager::InvokeEvents(InputBindingKey key, float value, GenericInputBi
 
   // find all the bindings associated with this key
   const InputBindingKey masked_key = key.MaskDirection();
-  const auto range = s_binding_map.equal_range(masked_key);
-  if (range.first == s_binding_map.end())
+  const auto range = std::equal_range(s_binding_dispatch_table.begin(), s_binding_dispatch_table.end(),
+                                      masked_key.bits, BindingDispatchKeyCompare());
+  if (range.first == range.second)
     return false;
 
   // Now we can actually fire/activate bindings.
   u32 min_num_keys = 0;
   for (auto it = range.first; it != range.second; ++it)
   {
-    InputBinding* binding = it->second.get();
+    InputBinding* binding = it->second;
     // find the key which matches us
     for (u32 i = 0; i < binding->num_keys; i++)
     {
@@ -875,10 +894,11 @@ bool InputManager::InvokeEvents(InputBindingKey key, float value, GenericInputBi
           // they could still activate and take precedence over us, so we leave them alone.
           for (u32 j = 0; j < binding->num_keys; j++)
           {
-            const auto range2 = s_binding_map.equal_range(binding->keys[j].MaskDirection());
+            const auto range2 = std::equal_range(s_binding_dispatch_table.begin(), s_binding_dispatch_table.end(),
+                                                 binding->keys[j].MaskDirection().bits, BindingDispatchKeyCompare());
             for (auto it2 = range2.first; it2 != range2.second; ++it2)
             {
-              InputBinding* other_binding = it2->second.get();
+              InputBinding* other_binding = it2->second;
               if (other_binding == binding || IsAxisHandler(other_binding->handler) ||
                   other_binding->num_keys >= binding->num_keys)
               {
@@ -1510,6 +1530,7 @@ void InputManager::SetHook(InputInterceptHook::Callback callback)
   std::unique_lock<std::mutex> lock(m_event_intercept_mutex);
   DebugAssert(!m_event_intercept_callback);
   m_event_intercept_callback = std::move(callback);
+  m_event_intercept_active.store(true, std::memory_order_release);
 }
 
 void InputManager::RemoveHook()
@@ -1517,6 +1538,7 @@ void InputManager::RemoveHook()
   std::unique_lock<std::mutex> lock(m_event_intercept_mutex);
   if (m_event_intercept_callback)
     m_event_intercept_callback = {};
+  m_event_intercept_active.store(false, std::memory_order_release);
 }
 
 bool InputManager::HasHook()
@@ -1527,13 +1549,20 @@ bool InputManager::HasHook()
 
 bool InputManager::DoEventHook(InputBindingKey key, float value)
 {
+  // Hooks are only installed while rebinding in the UI, so the common case skips the lock.
+  if (!m_event_intercept_active.load(std::memory_order_acquire))
+    return false;
+
   std::unique_lock<std::mutex> lock(m_event_intercept_mutex);
   if (!m_event_intercept_callback)
     return false;
 
   const InputInterceptHook::CallbackResult action = m_event_intercept_callback(key, value);
   if (action >= InputInterceptHook::CallbackResult::RemoveHookAndStopProcessingEvent)
+  {
     m_event_intercept_callback = {};
+    m_event_intercept_active.store(false, std::memory_order_release);
+  }
 
   return (action == InputInterceptHook::CallbackResult::RemoveHookAndStopProcessingEvent ||
           action == InputInterceptHook::CallbackResult::StopProcessingEvent);
@@ -1578,6 +1607,19 @@ void InputManager::ReloadBindings(SettingsInterface& si, SettingsInterface& bind
                                        default_scale),
                       1.0f);
   }
+
+  CompileBindingDispatchTable();
+}
+
+void InputManager::CompileBindingDispatchTable()
+{
+  s_binding_dispatch_table.clear();
+  s_binding_dispatch_table.reserve(s_binding_map.size());
+  for (const auto& [key, binding] : s_binding_map)
+    s_binding_dispatch_table.emplace_back(key.bits, binding.get());
+
+  std::sort(s_binding_dispatch_table.begin(), s_binding_dispatch_table.end(),
+            [](const auto& lhs, const auto& rhs) { return (lhs.first < rhs.first); });
 }
 
 bool InputManager::MigrateBindings(SettingsInterface& si)
@@ -95,7 +95,16 @@ static_assert(sizeof(InputBindingKey) == sizeof(u64), "Input binding key is 64 b
 /// Hashability for InputBindingKey
 struct InputBindingKeyHash
 {
-  std::size_t operator()(const InputBindingKey& k) const { return std::hash<u64>{}(k.bits); }
+  std::size_t operator()(const InputBindingKey& k) const
+  {
+    // std::hash on integers is the identity on some standard libraries, which makes bucket
+    // occupancy depend directly on the bitfield layout above. Run the packed bits through a
+    // finalizer so keys spread over the whole table regardless of which fields vary.
+    u64 h = k.bits;
+    h = (h ^ (h >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+    h = (h ^ (h >> 27)) * UINT64_C(0x94d049bb133111eb);
+    return static_cast<std::size_t>(h ^ (h >> 31));
+  }
 };
 
 /// Callback type for a binary event. Usually used for hotkeys.
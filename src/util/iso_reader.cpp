@@ -7,18 +7,6 @@
 #include <cctype>
 Log_SetChannel(ISOReader);
 
-static bool FilenamesEqual(const char* a, const char* b, u32 length)
-{
-  u32 pos = 0;
-  for (; pos < length && *a != '\0' && *b != '\0'; pos++)
-  {
-    if (std::tolower(*(a++)) != std::tolower(*(b++)))
-      return false;
-  }
-
-  return true;
-}
-
 ISOReader::ISOReader() = default;
 
 ISOReader::~ISOReader() = default;
@@ -30,6 +18,9 @@ bool ISOReader::Open(CDImage* image, u32 track_number)
   if (!ReadPVD())
     return false;
 
+  if (!BuildFileIndex())
+    return false;
+
   return true;
 }
 
@@ -61,58 +52,64 @@ bool ISOReader::ReadPVD()
   return false;
 }
 
-std::optional<ISOReader::ISODirectoryEntry> ISOReader::LocateFile(const char* path)
+std::string ISOReader::NormalizePath(const char* path)
 {
-  u8 sector_buffer[SECTOR_SIZE];
+  // strip any leading slashes
+  while (*path == '/' || *path == '\\')
+    path++;
 
-  const ISODirectoryEntry* root_de = reinterpret_cast<const ISODirectoryEntry*>(m_pvd.root_directory_entry);
-  if (*path == '\0' || std::strcmp(path, "/") == 0)
+  std::string ret;
+  for (; *path != '\0'; path++)
   {
-    // locating the root directory
-    return *root_de;
+    const char ch = *path;
+    ret.push_back((ch == '\\') ? '/' : static_cast<char>(std::toupper(static_cast<unsigned char>(ch))));
   }
 
-  // start at the root directory
-  return LocateFile(path, sector_buffer, root_de->location_le, root_de->length_le);
+  while (!ret.empty() && ret.back() == '/')
+    ret.pop_back();
+
+  return ret;
 }
 
-std::optional<ISOReader::ISODirectoryEntry> ISOReader::LocateFile(const char* path, u8* sector_buffer,
-                                                                  u32 directory_record_lba, u32 directory_record_size)
+bool ISOReader::BuildFileIndex()
 {
-  if (directory_record_size == 0)
+  m_index.clear();
+
+  const ISODirectoryEntry* root_de = reinterpret_cast<const ISODirectoryEntry*>(m_pvd.root_directory_entry);
+  if (root_de->length_le == 0)
   {
-    Log_ErrorPrintf("Directory entry record size 0 while looking for '%s'", path);
-    return std::nullopt;
+    Log_ErrorPrint("Root directory record has size 0");
+    return false;
   }
 
-  // strip any leading slashes
-  const char* path_component_start = path;
-  while (*path_component_start == '/' || *path_component_start == '\\')
-    path_component_start++;
+  IndexDirectory(std::string(), root_de->location_le, root_de->length_le, 0);
+  return true;
+}
 
-  u32 path_component_length = 0;
-  const char* path_component_end = path_component_start;
-  while (*path_component_end != '\0' && *path_component_end != '/' && *path_component_end != '\\')
+void ISOReader::IndexDirectory(const std::string& base_path, u32 directory_record_lba, u32 directory_record_size,
+                               u32 depth)
+{
+  if (depth >= MAX_DIRECTORY_DEPTH)
   {
-    path_component_length++;
-    path_component_end++;
+    Log_ErrorPrintf("Exceeded maximum directory depth at '%s', possibly a loop", base_path.c_str());
+    return;
   }
 
-  // start reading directory entries
+  // read the whole directory extent in one go
   const u32 num_sectors = (directory_record_size + (SECTOR_SIZE - 1)) / SECTOR_SIZE;
-  if (!m_image->Seek(m_track_number, directory_record_lba))
+  std::vector<u8> dir_data(static_cast<size_t>(num_sectors) * SECTOR_SIZE);
+  if (!m_image->Seek(m_track_number, directory_record_lba) ||
+      m_image->Read(CDImage::ReadMode::DataOnly, num_sectors, dir_data.data()) != num_sectors)
   {
-    Log_ErrorPrintf("Seek to LBA %u failed", directory_record_lba);
-    return std::nullopt;
+    Log_ErrorPrintf("Failed to read %u sectors at LBA %u for '%s'", num_sectors, directory_record_lba,
+                    base_path.c_str());
+    return;
   }
 
+  // directory entries don't cross sector boundaries, so parse each sector individually
   for (u32 i = 0; i < num_sectors; i++)
   {
-    if (m_image->Read(CDImage::ReadMode::DataOnly, 1, sector_buffer) != 1)
-    {
-      Log_ErrorPrintf("Failed to read LBA %u", directory_record_lba + i);
-      return std::nullopt;
-    }
+    const u8* sector_buffer = &dir_data[static_cast<size_t>(i) * SECTOR_SIZE];
 
     u32 sector_offset = 0;
     while ((sector_offset + sizeof(ISODirectoryEntry)) < SECTOR_SIZE)
@@ -132,63 +129,62 @@ std::optional<ISOReader::ISODirectoryEntry> ISOReader::LocateFile(const char* pa
       if (de->filename_length == 1 && (*de_filename == '\x0' || *de_filename == '\x1'))
         continue;
 
-      // check filename length
-      if (de->filename_length < path_component_length)
-        continue;
-
+      std::string filename(de_filename, de->filename_length);
       if (de->flags & ISODirectoryEntryFlag_Directory)
       {
-        // directories don't have the version? so check the length instead
-        if (de->filename_length != path_component_length ||
-            !FilenamesEqual(de_filename, path_component_start, path_component_length))
-        {
-          continue;
-        }
+        std::string full_path = base_path.empty() ? std::move(filename) : (base_path + "/" + filename);
+        if (de->length_le > 0)
+          IndexDirectory(full_path, de->location_le, de->length_le, depth + 1);
+
+        std::string key = NormalizePath(full_path.c_str());
+        m_index.emplace(std::move(key), IndexedFile{*de, std::move(full_path)});
       }
       else
       {
-        // compare filename
-        if (!FilenamesEqual(de_filename, path_component_start, path_component_length) ||
-            de_filename[path_component_length] != ';')
+        // strip off terminator/file version
+        const std::string::size_type pos = filename.rfind(';');
+        if (pos == std::string::npos)
         {
+          Log_ErrorPrintf("Invalid filename '%s'", filename.c_str());
           continue;
         }
-      }
+        filename.erase(pos);
+        if (filename.empty())
+          continue;
 
-      // found it. is this the file we're looking for?
-      if (*path_component_end == '\0')
-        return *de;
+        std::string full_path = base_path.empty() ? std::move(filename) : (base_path + "/" + filename);
+        std::string key = NormalizePath(full_path.c_str());
+        m_index.emplace(std::move(key), IndexedFile{*de, std::move(full_path)});
+      }
+    }
+  }
+}
 
-      // if it is a directory, recurse into it
-      if (de->flags & ISODirectoryEntryFlag_Directory)
-        return LocateFile(path_component_end, sector_buffer, de->location_le, de->length_le);
+std::optional<ISOReader::ISODirectoryEntry> ISOReader::LocateFile(const char* path)
+{
+  const std::string key = NormalizePath(path);
+  if (key.empty())
+  {
+    // locating the root directory
+    return *reinterpret_cast<const ISODirectoryEntry*>(m_pvd.root_directory_entry);
+  }
 
-      // we're looking for a directory but got a file
-      Log_ErrorPrintf("Looking for directory but got file");
-      return std::nullopt;
-    }
+  const auto it = m_index.find(key);
+  if (it == m_index.end())
+  {
+    Log_DevPrintf("'%s' not found in index", path);
+    return std::nullopt;
   }
 
-  std::string temp(path_component_start, path_component_length);
-  Log_ErrorPrintf("Path component '%s' not found", temp.c_str());
-  return std::nullopt;
+  return it->second.entry;
 }
 
 std::vector<std::string> ISOReader::GetFilesInDirectory(const char* path)
 {
-  std::string base_path = path;
-  u32 directory_record_lba;
-  u32 directory_record_length;
-  if (base_path.empty())
+  std::string prefix = NormalizePath(path);
+  if (!prefix.empty())
   {
-    // root directory
-    const ISODirectoryEntry* root_de = reinterpret_cast<const ISODirectoryEntry*>(m_pvd.root_directory_entry);
-    directory_record_lba = root_de->location_le;
-    directory_record_length = root_de->length_le;
-  }
-  else
-  {
-    auto directory_de = LocateFile(base_path.c_str());
+    auto directory_de = LocateFile(path);
     if (!directory_de)
     {
       Log_ErrorPrintf("Directory entry not found for '%s'", path);
@@ -201,62 +197,23 @@ std::vector<std::string> ISOReader::GetFilesInDirectory(const char* path)
       return {};
     }
 
-    directory_record_lba = directory_de->location_le;
-    directory_record_length = directory_de->length_le;
-
-    if (base_path[base_path.size() - 1] != '/')
-      base_path += '/';
-  }
-
-  // start reading directory entries
-  const u32 num_sectors = (directory_record_length + (SECTOR_SIZE - 1)) / SECTOR_SIZE;
-  if (!m_image->Seek(m_track_number, directory_record_lba))
-  {
-    Log_ErrorPrintf("Seek to LBA %u failed", directory_record_lba);
-    return {};
+    prefix += '/';
   }
 
   std::vector<std::string> files;
-  u8 sector_buffer[SECTOR_SIZE];
-  for (u32 i = 0; i < num_sectors; i++)
+  for (const auto& [key, file] : m_index)
   {
-    if (m_image->Read(CDImage::ReadMode::DataOnly, 1, sector_buffer) != 1)
+    // skip entries outside this directory, or in subdirectories of it
+    if (key.length() <= prefix.length() || key.compare(0, prefix.length(), prefix) != 0 ||
+        key.find('/', prefix.length()) != std::string::npos)
     {
-      Log_ErrorPrintf("Failed to read LBA %u", directory_record_lba + i);
-      break;
+      continue;
     }
 
-    u32 sector_offset = 0;
-    while ((sector_offset + sizeof(ISODirectoryEntry)) < SECTOR_SIZE)
-    {
-      const ISODirectoryEntry* de = reinterpret_cast<const ISODirectoryEntry*>(&sector_buffer[sector_offset]);
-      const char* de_filename =
-        reinterpret_cast<const char*>(&sector_buffer[sector_offset + sizeof(ISODirectoryEntry)]);
-      if ((sector_offset + de->entry_length) > SECTOR_SIZE || de->filename_length > de->entry_length ||
-          de->entry_length < sizeof(ISODirectoryEntry))
-      {
-        break;
-      }
-
-      sector_offset += de->entry_length;
-
-      // skip current/parent directory
-      if (de->filename_length == 1 && (*de_filename == '\x0' || *de_filename == '\x1'))
-        continue;
-
-      // strip off terminator/file version
-      std::string filename(de_filename, de->filename_length);
-      std::string::size_type pos = filename.rfind(';');
-      if (pos == std::string::npos)
-      {
-        Log_ErrorPrintf("Invalid filename '%s'", filename.c_str());
-        continue;
-      }
-      filename.erase(pos);
+    if (file.entry.flags & ISODirectoryEntryFlag_Directory)
+      continue;
 
-      if (!filename.empty())
-        files.push_back(base_path + filename);
-    }
+    files.push_back(file.path);
   }
 
   return files;
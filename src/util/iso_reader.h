@@ -3,6 +3,7 @@
 
 #pragma once
 #include "common/types.h"
+#include <map>
 #include <memory>
 #include <optional>
 #include <string>
@@ -146,14 +147,35 @@ public:
   bool FileExists(const char* path);
 
 private:
+  enum : u32
+  {
+    MAX_DIRECTORY_DEPTH = 16
+  };
+
+  struct IndexedFile
+  {
+    ISODirectoryEntry entry;
+
+    // Full path with on-disc casing, version suffix stripped.
+    std::string path;
+  };
+
   bool ReadPVD();
 
+  // Walks the directory records once and caches every entry's extent, so repeated lookups (SYSTEM.CNF,
+  // then the executable it names) don't re-read directory sectors from the image.
+  bool BuildFileIndex();
+  void IndexDirectory(const std::string& base_path, u32 directory_record_lba, u32 directory_record_size, u32 depth);
+
+  static std::string NormalizePath(const char* path);
+
   std::optional<ISODirectoryEntry> LocateFile(const char* path);
-  std::optional<ISODirectoryEntry> LocateFile(const char* path, u8* sector_buffer, u32 directory_record_lba,
-                                              u32 directory_record_size);
 
   CDImage* m_image;
   u32 m_track_number;
 
   ISOPrimaryVolumeDescriptor m_pvd = {};
+
+  // Keyed on case-normalized full path.
+  std::map<std::string, IndexedFile> m_index;
 };
\ No newline at end of file
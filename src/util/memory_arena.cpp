@@ -121,11 +121,13 @@ static std::string GetFileMappingName()
   return ret;
 }
 
-bool MemoryArena::Create(size_t size, bool writable, bool executable)
+bool MemoryArena::Create(size_t size, bool writable, bool executable, bool huge_pages /*= false*/)
 {
   if (IsValid())
     Destroy();
 
+  m_huge_pages = huge_pages;
+
   const std::string file_mapping_name(GetFileMappingName());
 
 #if defined(_WIN32)
@@ -262,6 +264,13 @@ void* MemoryArena::CreateViewPtr(size_t offset, size_t size, bool writable, bool
   base_pointer = mmap(fixed_address, size, prot, flags, m_shmem_fd, static_cast<off_t>(offset));
   if (base_pointer == reinterpret_cast<void*>(-1))
     return nullptr;
+
+#if defined(__linux__) || defined(__ANDROID__)
+  // Advise transparent hugepages for this view. Only takes effect when the kernel has
+  // shmem_enabled set to advise/always; otherwise the view just stays on 4K pages.
+  if (m_huge_pages)
+    madvise(base_pointer, size, MADV_HUGEPAGE);
+#endif
 #else
   return nullptr;
 #endif
@@ -45,7 +45,10 @@ public:
   ALWAYS_INLINE bool IsExecutable() const { return m_executable; }
 
   bool IsValid() const;
-  bool Create(size_t size, bool writable, bool executable);
+
+  /// huge_pages requests 2MB page backing for all views of this arena, where the platform
+  /// supports it. Best-effort: silently falls back to normal pages.
+  bool Create(size_t size, bool writable, bool executable, bool huge_pages = false);
   void Destroy();
 
   std::optional<View> CreateView(size_t offset, size_t size, bool writable, bool executable,
@@ -73,5 +76,6 @@ private:
   size_t m_size = 0;
   bool m_writable = false;
   bool m_executable = false;
+  bool m_huge_pages = false;
 };
 } // namespace Common
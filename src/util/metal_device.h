@@ -366,6 +366,10 @@ private:
   id<MTLCommandBuffer> m_render_cmdbuf = nil;
   id<MTLRenderCommandEncoder> m_render_encoder = nil;
 
+  // Textures are created without automatic hazard tracking, so encoders are ordered explicitly:
+  // every encoder waits on this fence before its first command, and updates it when it ends.
+  id<MTLFence> m_encoder_fence = nil;
+
   MetalFramebuffer* m_current_framebuffer = nullptr;
 
   MetalPipeline* m_current_pipeline = nullptr;
@@ -166,6 +166,13 @@ bool MetalDevice::CreateDevice(const std::string_view& adapter, bool threaded_pr
     m_queue = [queue retain];
     Log_InfoPrintf("Metal Device: %s", [[m_device name] UTF8String]);
 
+    m_encoder_fence = [m_device newFence];
+    if (m_encoder_fence == nil)
+    {
+      Log_ErrorPrint("Failed to create encoder fence.");
+      return false;
+    }
+
     SetFeatures();
 
     if (m_window_info.type != WindowInfo::Type::Surfaceless && !CreateLayer())
@@ -214,6 +221,8 @@ void MetalDevice::SetFeatures()
   m_features.partial_msaa_resolve = true;
   m_features.shader_cache = true;
   m_features.pipeline_cache = false;
+  m_features.parallel_pipeline_compilation = false;
+  m_features.parallel_shader_compilation = false;
 }
 
 void MetalDevice::DestroyDevice()
@@ -243,6 +252,11 @@ void MetalDevice::DestroyDevice()
     [it.second release];
   m_cleanup_objects.clear();
 
+  if (m_encoder_fence != nil)
+  {
+    [m_encoder_fence release];
+    m_encoder_fence = nil;
+  }
   if (m_queue != nil)
   {
     [m_queue release];
@@ -1071,6 +1085,12 @@ std::unique_ptr<GPUTexture> MetalDevice::CreateTexture(u32 width, u32 height, u3
     desc.pixelFormat = pixel_format;
     desc.mipmapLevelCount = levels;
 
+    // Textures are only ever read/written on the GPU (uploads and downloads go through staging
+    // buffers), so keep them out of managed memory, and skip Metal's automatic hazard tracking.
+    // Encoders touching them are ordered explicitly through m_encoder_fence instead.
+    desc.storageMode = MTLStorageModePrivate;
+    desc.hazardTrackingMode = MTLHazardTrackingModeUntracked;
+
     switch (type)
     {
       case GPUTexture::Type::Texture:
@@ -1536,6 +1556,8 @@ void MetalDevice::CommitClear(MetalTexture* tex)
       }
 
       id<MTLRenderCommandEncoder> encoder = [m_render_cmdbuf renderCommandEncoderWithDescriptor:desc];
+      [encoder waitForFence:m_encoder_fence beforeStages:MTLRenderStageVertex];
+      [encoder updateFence:m_encoder_fence afterStages:MTLRenderStageFragment];
       [encoder endEncoding];
     }
   }
@@ -1846,6 +1868,7 @@ void MetalDevice::BeginRenderPass()
   // Inline writes :(
   if (m_inline_upload_encoder != nil)
   {
+    [m_inline_upload_encoder updateFence:m_encoder_fence];
     [m_inline_upload_encoder endEncoding];
     [m_inline_upload_encoder release];
     m_inline_upload_encoder = nil;
@@ -1871,6 +1894,7 @@ void MetalDevice::BeginRenderPass()
     }
 
     m_render_encoder = [[m_render_cmdbuf renderCommandEncoderWithDescriptor:desc] retain];
+    [m_render_encoder waitForFence:m_encoder_fence beforeStages:MTLRenderStageVertex];
     SetInitialEncoderState();
   }
 }
@@ -1878,6 +1902,7 @@ void MetalDevice::BeginRenderPass()
 void MetalDevice::EndRenderPass()
 {
   DebugAssert(InRenderPass() && !IsInlineUploading());
+  [m_render_encoder updateFence:m_encoder_fence afterStages:MTLRenderStageFragment];
   [m_render_encoder endEncoding];
   [m_render_encoder release];
   m_render_encoder = nil;
@@ -1886,6 +1911,7 @@ void MetalDevice::EndRenderPass()
 void MetalDevice::EndInlineUploading()
 {
   DebugAssert(IsInlineUploading() && !InRenderPass());
+  [m_inline_upload_encoder updateFence:m_encoder_fence];
   [m_inline_upload_encoder endEncoding];
   [m_inline_upload_encoder release];
   m_inline_upload_encoder = nil;
@@ -1981,6 +2007,7 @@ id<MTLBlitCommandEncoder> MetalDevice::GetBlitEncoder(bool is_inline)
         m_upload_cmdbuf = [[m_queue commandBufferWithUnretainedReferences] retain];
         m_upload_encoder = [[m_upload_cmdbuf blitCommandEncoder] retain];
         [m_upload_encoder setLabel:@"Upload Encoder"];
+        [m_upload_encoder waitForFence:m_encoder_fence];
       }
       return m_upload_encoder;
     }
@@ -1992,6 +2019,7 @@ id<MTLBlitCommandEncoder> MetalDevice::GetBlitEncoder(bool is_inline)
     if (InRenderPass())
       EndRenderPass();
     m_inline_upload_encoder = [[m_render_cmdbuf blitCommandEncoder] retain];
+    [m_inline_upload_encoder waitForFence:m_encoder_fence];
     return m_inline_upload_encoder;
   }
 }
@@ -2017,6 +2045,7 @@ bool MetalDevice::BeginPresent(bool skip_present)
     m_layer_pass_desc.colorAttachments[0].texture = layer_texture;
     m_layer_pass_desc.colorAttachments[0].loadAction = MTLLoadActionClear;
     m_render_encoder = [[m_render_cmdbuf renderCommandEncoderWithDescriptor:m_layer_pass_desc] retain];
+    [m_render_encoder waitForFence:m_encoder_fence beforeStages:MTLRenderStageVertex];
     m_current_pipeline = nullptr;
     m_current_depth_state = nil;
     SetInitialEncoderState();
@@ -2061,6 +2090,7 @@ void MetalDevice::SubmitCommandBuffer(bool wait_for_completion)
 {
   if (m_upload_cmdbuf != nil)
   {
+    [m_upload_encoder updateFence:m_encoder_fence];
     [m_upload_encoder endEncoding];
     [m_upload_encoder release];
     m_upload_encoder = nil;
@@ -468,6 +468,10 @@ bool OpenGLDevice::CheckFeatures(bool* buggy_pbo)
 
   m_features.shader_cache = false;
 
+  // GL object creation is tied to the context's thread.
+  m_features.parallel_pipeline_compilation = false;
+  m_features.parallel_shader_compilation = false;
+
   m_features.pipeline_cache = m_gl_context->IsGLES() || GLAD_GL_ARB_get_program_binary;
   if (m_features.pipeline_cache)
   {
@@ -633,24 +633,33 @@ GPUTexture* PostProcessing::GetDummyTexture()
 
 bool PostProcessing::CheckTargets(GPUTexture::Format target_format, u32 target_width, u32 target_height)
 {
-  if (s_target_format == target_format && s_target_width == target_width && s_target_height == target_height)
+  // The ping-pong buffer is only needed when there are at least two stages; a single-stage chain
+  // draws straight from the input texture to the final target.
+  const bool need_output_texture = (s_stages.size() >= 2);
+  if (s_target_format == target_format && s_target_width == target_width && s_target_height == target_height &&
+      (!need_output_texture || s_output_texture))
+  {
     return true;
+  }
 
   // In case any allocs fail.
   DestroyTextures();
 
-  if (!(s_input_texture = g_gpu_device->CreateTexture(target_width, target_height, 1, 1, 1,
-                                                      GPUTexture::Type::RenderTarget, target_format)) ||
+  if (!(s_input_texture = g_gpu_device->FetchTexture(target_width, target_height, 1, 1, 1,
+                                                     GPUTexture::Type::RenderTarget, target_format)) ||
       !(s_input_framebuffer = g_gpu_device->CreateFramebuffer(s_input_texture.get())))
   {
     return false;
   }
 
-  if (!(s_output_texture = g_gpu_device->CreateTexture(target_width, target_height, 1, 1, 1,
-                                                       GPUTexture::Type::RenderTarget, target_format)) ||
-      !(s_output_framebuffer = g_gpu_device->CreateFramebuffer(s_output_texture.get())))
+  if (need_output_texture)
   {
-    return false;
+    if (!(s_output_texture = g_gpu_device->FetchTexture(target_width, target_height, 1, 1, 1,
+                                                        GPUTexture::Type::RenderTarget, target_format)) ||
+        !(s_output_framebuffer = g_gpu_device->CreateFramebuffer(s_output_texture.get())))
+    {
+      return false;
+    }
   }
 
   for (auto& shader : s_stages)
@@ -680,10 +689,10 @@ void PostProcessing::DestroyTextures()
   s_target_height = 0;
 
   s_output_framebuffer.reset();
-  s_output_texture.reset();
+  g_gpu_device->RecycleTexture(std::move(s_output_texture));
 
   s_input_framebuffer.reset();
-  s_input_texture.reset();
+  g_gpu_device->RecycleTexture(std::move(s_input_texture));
 }
 
 bool PostProcessing::Apply(GPUFramebuffer* final_target, s32 final_left, s32 final_top, s32 final_width,
@@ -261,8 +261,8 @@ bool PostProcessing::ReShadeFXShader::LoadFromFile(std::string name, const char*
   m_name = std::move(name);
 
   reshadefx::module temp_module;
-  if (!CreateModule(only_config ? DEFAULT_BUFFER_WIDTH : g_gpu_device->GetWindowWidth(),
-                    only_config ? DEFAULT_BUFFER_HEIGHT : g_gpu_device->GetWindowHeight(), &temp_module, error))
+  if (!GetOrCreateModule(only_config ? DEFAULT_BUFFER_WIDTH : g_gpu_device->GetWindowWidth(),
+                         only_config ? DEFAULT_BUFFER_HEIGHT : g_gpu_device->GetWindowHeight(), &temp_module, error))
     return false;
 
   if (!CreateOptions(temp_module, error))
@@ -371,6 +371,31 @@ bool PostProcessing::ReShadeFXShader::CreateModule(s32 buffer_width, s32 buffer_
   return true;
 }
 
+bool PostProcessing::ReShadeFXShader::GetOrCreateModule(s32 buffer_width, s32 buffer_height, reshadefx::module* mod,
+                                                        Error* error)
+{
+  // Preprocessing/parsing the effect is what costs the 1-2 seconds on chains like the CRT packs,
+  // and the result only depends on the buffer size. CreatePasses() moves strings out of the
+  // module, so the cached copy has to stay intact and gets copied out.
+  static constexpr size_t MAX_CACHED_MODULES = 4;
+
+  const u64 key = (ZeroExtend64(static_cast<u32>(buffer_width)) << 32) | ZeroExtend64(static_cast<u32>(buffer_height));
+  const auto it = m_module_cache.find(key);
+  if (it != m_module_cache.end())
+  {
+    *mod = it->second;
+    return true;
+  }
+
+  if (!CreateModule(buffer_width, buffer_height, mod, error))
+    return false;
+
+  if (m_module_cache.size() >= MAX_CACHED_MODULES)
+    m_module_cache.clear();
+  m_module_cache.emplace(key, *mod);
+  return true;
+}
+
 static std::string_view GetStringAnnotationValue(const std::vector<reshadefx::annotation>& annotations,
                                                  const std::string_view& annotation_name,
                                                  const std::string_view& default_value)
@@ -998,7 +1023,7 @@ bool PostProcessing::ReShadeFXShader::CompilePipeline(GPUTexture::Format format,
 
   Error error;
   reshadefx::module mod;
-  if (!CreateModule(width, height, &mod, &error))
+  if (!GetOrCreateModule(width, height, &mod, &error))
   {
     Log_ErrorPrintf("Failed to create module for '%s': %s", m_name.c_str(), error.GetDescription().c_str());
     return false;
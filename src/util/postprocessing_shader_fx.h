@@ -7,6 +7,8 @@
 
 #include "common/timer.h"
 
+#include <map>
+
 // reshadefx
 #include "effect_module.hpp"
 
@@ -70,6 +72,7 @@ private:
   };
 
   bool CreateModule(s32 buffer_width, s32 buffer_height, reshadefx::module* mod, Error* error);
+  bool GetOrCreateModule(s32 buffer_width, s32 buffer_height, reshadefx::module* mod, Error* error);
   bool CreateOptions(const reshadefx::module& mod, Error* error);
   bool GetSourceOption(const reshadefx::uniform_info& ui, SourceOptionType* si, Error* error);
   bool CreatePasses(GPUTexture::Format backbuffer_format, reshadefx::module& mod, Error* error);
@@ -115,6 +118,10 @@ private:
   u32 m_uniforms_size = 0;
   bool m_valid = false;
 
+  // Compiled modules depend on the buffer size (BUFFER_WIDTH/HEIGHT are baked in as preprocessor
+  // macros), so the last few are kept around to skip the parse when bouncing between resolutions.
+  std::map<u64, reshadefx::module> m_module_cache;
+
   Common::Timer m_frame_timer;
   u32 m_frame_count = 0;
 };
@@ -170,8 +170,19 @@ bool PostProcessing::GLSLShader::Apply(GPUTexture* input, GPUFramebuffer* final_
   }
   else
   {
-    g_gpu_device->SetFramebuffer(final_target);
-    g_gpu_device->ClearRenderTarget(final_target->GetRT(), 0); // TODO: Could use an invalidate here too.
+    // When the draw covers the whole target there's no point loading or clearing the old
+    // contents, since every pixel gets written. Partial draws still need the black borders.
+    if (final_left == 0 && final_top == 0 && static_cast<u32>(final_width) == final_target->GetWidth() &&
+        static_cast<u32>(final_height) == final_target->GetHeight())
+    {
+      g_gpu_device->InvalidateRenderTarget(final_target->GetRT());
+      g_gpu_device->SetFramebuffer(final_target);
+    }
+    else
+    {
+      g_gpu_device->SetFramebuffer(final_target);
+      g_gpu_device->ClearRenderTarget(final_target->GetRT(), 0);
+    }
   }
 
   g_gpu_device->SetPipeline(m_pipeline.get());
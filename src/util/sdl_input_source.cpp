@@ -245,13 +245,20 @@ void SDLInputSource::ShutdownSubsystem()
 
 void SDLInputSource::PollEvents()
 {
+  // SDL_PollEvent() re-pumps the event loop (which re-polls every joystick) on each call when the
+  // queue runs dry. Pump once per poll and drain the queue in batches instead.
+  SDL_PumpEvents();
+
+  SDL_Event events[32];
   for (;;)
   {
-    SDL_Event ev;
-    if (SDL_PollEvent(&ev))
-      ProcessSDLEvent(&ev);
-    else
+    const int count =
+      SDL_PeepEvents(events, static_cast<int>(std::size(events)), SDL_GETEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT);
+    if (count <= 0)
       break;
+
+    for (int i = 0; i < count; i++)
+      ProcessSDLEvent(&events[i]);
   }
 }
 
@@ -16,6 +16,7 @@
 
 #include <cstring>
 #include <memory>
+#include <mutex>
 Log_SetChannel(SPIRVCompiler);
 
 // glslang includes
@@ -38,18 +39,15 @@ static unsigned s_next_bad_shader_id = 1;
 std::optional<SPIRVCompiler::SPIRVCodeVector>
 SPIRVCompiler::CompileShaderToSPV(EShLanguage stage, const char* stage_filename, std::string_view source, u32 options)
 {
-  static bool glslang_initialized = false;
-  if (!glslang_initialized)
-  {
+  // Process-wide initialization happens exactly once; compiles can arrive concurrently from the
+  // pipeline compilation worker threads, everything past this point is per-thread state.
+  static std::once_flag glslang_initialized;
+  std::call_once(glslang_initialized, []() {
     if (!glslang::InitializeProcess())
-    {
       Panic("Failed to initialize glslang shader compiler");
-      return std::nullopt;
-    }
 
     std::atexit(&glslang::FinalizeProcess);
-    glslang_initialized = true;
-  }
+  });
 
   std::unique_ptr<glslang::TShader> shader = std::make_unique<glslang::TShader>(stage);
   std::unique_ptr<glslang::TProgram> program;
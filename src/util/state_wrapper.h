@@ -24,6 +24,12 @@ public:
   };
 
   StateWrapper(ByteStream* stream, Mode mode, u32 version);
+
+  /// Raw-buffer mode. Fields are copied to/from the caller's flat buffer with inline
+  /// bounds-checked memcpys instead of a virtual stream call per field, which matters for the
+  /// memory save states that rewind/runahead create every frame.
+  StateWrapper(void* buffer, size_t buffer_size, Mode mode, u32 version);
+
   StateWrapper(const StateWrapper&) = delete;
   ~StateWrapper();
 
@@ -35,19 +41,22 @@ public:
   void SetMode(Mode mode) { m_mode = mode; }
   u32 GetVersion() const { return m_version; }
 
+  /// Returns the current offset, in either mode.
+  u64 GetPosition() const { return m_buffer ? m_buffer_pos : m_stream->GetPosition(); }
+
   /// Overload for integral or floating-point types. Writes bytes as-is.
   template<typename T, std::enable_if_t<std::is_integral_v<T> || std::is_floating_point_v<T>, int> = 0>
   void Do(T* value_ptr)
   {
     if (m_mode == Mode::Read)
     {
-      if (m_error || (m_error |= !m_stream->Read2(value_ptr, sizeof(T))) == true)
+      if (m_error || (m_error |= !ReadData(value_ptr, sizeof(T))) == true)
         *value_ptr = static_cast<T>(0);
     }
     else
     {
       if (!m_error)
-        m_error |= !m_stream->Write2(value_ptr, sizeof(T));
+        m_error |= !WriteData(value_ptr, sizeof(T));
     }
   }
 
@@ -59,7 +68,7 @@ public:
     if (m_mode == Mode::Read)
     {
       TType temp;
-      if (m_error || (m_error |= !m_stream->Read2(&temp, sizeof(TType))) == true)
+      if (m_error || (m_error |= !ReadData(&temp, sizeof(TType))) == true)
         temp = static_cast<TType>(0);
 
       *value_ptr = static_cast<T>(temp);
@@ -69,7 +78,7 @@ public:
       TType temp;
       std::memcpy(&temp, value_ptr, sizeof(TType));
       if (!m_error)
-        m_error |= !m_stream->Write2(&temp, sizeof(TType));
+        m_error |= !WriteData(&temp, sizeof(TType));
     }
   }
 
@@ -79,13 +88,13 @@ public:
   {
     if (m_mode == Mode::Read)
     {
-      if (m_error || (m_error |= !m_stream->Read2(value_ptr, sizeof(T))) == true)
+      if (m_error || (m_error |= !ReadData(value_ptr, sizeof(T))) == true)
         std::memset(value_ptr, 0, sizeof(*value_ptr));
     }
     else
     {
       if (!m_error)
-        m_error |= !m_stream->Write2(value_ptr, sizeof(T));
+        m_error |= !WriteData(value_ptr, sizeof(T));
     }
   }
 
@@ -200,12 +209,57 @@ public:
       return;
     }
 
-    if (!m_error)
+    if (m_error)
+      return;
+
+    if (m_buffer)
+    {
+      if ((m_buffer_size - m_buffer_pos) < count)
+        m_error = true;
+      else
+        m_buffer_pos += count;
+    }
+    else
+    {
       m_error = !m_stream->SeekRelative(static_cast<s64>(count));
+    }
   }
 
 private:
+  ALWAYS_INLINE bool ReadData(void* data, size_t size)
+  {
+    if (m_buffer)
+    {
+      if ((m_buffer_size - m_buffer_pos) < size)
+        return false;
+
+      std::memcpy(data, m_buffer + m_buffer_pos, size);
+      m_buffer_pos += size;
+      return true;
+    }
+
+    return m_stream->Read2(data, static_cast<u32>(size));
+  }
+
+  ALWAYS_INLINE bool WriteData(const void* data, size_t size)
+  {
+    if (m_buffer)
+    {
+      if ((m_buffer_size - m_buffer_pos) < size)
+        return false;
+
+      std::memcpy(m_buffer + m_buffer_pos, data, size);
+      m_buffer_pos += size;
+      return true;
+    }
+
+    return m_stream->Write2(data, static_cast<u32>(size));
+  }
+
   ByteStream* m_stream;
+  u8* m_buffer = nullptr;
+  size_t m_buffer_size = 0;
+  size_t m_buffer_pos = 0;
   Mode m_mode;
   u32 m_version;
   bool m_error = false;
@@ -0,0 +1,275 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#include "thread_sampler.h"
+
+#include "common/file_system.h"
+#include "common/log.h"
+#include "common/threading.h"
+#include "common/timer.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cinttypes>
+#include <cstdint>
+
+#if defined(_WIN32)
+#include "common/windows_headers.h"
+#elif defined(__linux__)
+#include <csignal>
+#include <pthread.h>
+#include <ucontext.h>
+#endif
+
+Log_SetChannel(ThreadSampler);
+
+namespace ThreadSampler {
+
+static constexpr u32 MAX_CODE_RANGES = 8;
+
+// Ranges are fixed-capacity and updated with atomics because attribution happens in a
+// signal handler on Linux, where taking locks or allocating is off the table.
+struct CodeRange
+{
+  std::atomic<uintptr_t> start{0};
+  std::atomic<uintptr_t> end{0};
+  const char* name = nullptr;
+};
+
+static void AttributeSample(uintptr_t pc);
+static void SamplerThreadEntry(u32 sample_rate_hz);
+
+static CodeRange s_code_ranges[MAX_CODE_RANGES];
+static std::atomic<u64> s_range_samples[MAX_CODE_RANGES];
+static std::atomic<u64> s_total_samples{0};
+static std::atomic<u64> s_host_samples{0};
+
+static Threading::Thread s_sampler_thread;
+static std::atomic_bool s_sampler_thread_running{false};
+
+#if defined(_WIN32)
+static HANDLE s_sampled_thread = nullptr;
+#elif defined(__linux__)
+static pthread_t s_sampled_thread = {};
+static bool s_have_sampled_thread = false;
+static struct sigaction s_old_sigprof_action = {};
+#endif
+
+void RegisterCodeRange(const char* name, const void* base, size_t size)
+{
+  for (CodeRange& range : s_code_ranges)
+  {
+    if (range.start.load(std::memory_order_relaxed) != 0)
+      continue;
+
+    range.name = name;
+    range.end.store(reinterpret_cast<uintptr_t>(base) + size, std::memory_order_relaxed);
+
+    // The start address doubles as the slot-occupied flag, so it has to be published last.
+    range.start.store(reinterpret_cast<uintptr_t>(base), std::memory_order_release);
+    return;
+  }
+
+  Log_ErrorPrintf("Out of code range slots, samples in '%s' will be attributed to host code", name);
+}
+
+void UnregisterCodeRange(const void* base)
+{
+  for (CodeRange& range : s_code_ranges)
+  {
+    if (range.start.load(std::memory_order_relaxed) == reinterpret_cast<uintptr_t>(base))
+    {
+      range.start.store(0, std::memory_order_release);
+      return;
+    }
+  }
+}
+
+void AttributeSample(uintptr_t pc)
+{
+  s_total_samples.fetch_add(1, std::memory_order_relaxed);
+
+  for (u32 i = 0; i < MAX_CODE_RANGES; i++)
+  {
+    const uintptr_t start = s_code_ranges[i].start.load(std::memory_order_acquire);
+    if (start == 0 || pc < start || pc >= s_code_ranges[i].end.load(std::memory_order_relaxed))
+      continue;
+
+    s_range_samples[i].fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  s_host_samples.fetch_add(1, std::memory_order_relaxed);
+}
+
+#if defined(__linux__)
+
+static void SampleSignalHandler(int signum, siginfo_t* info, void* ctx)
+{
+  const ucontext_t* uc = static_cast<const ucontext_t*>(ctx);
+#if defined(__x86_64__)
+  AttributeSample(static_cast<uintptr_t>(uc->uc_mcontext.gregs[REG_RIP]));
+#elif defined(__aarch64__)
+  AttributeSample(static_cast<uintptr_t>(uc->uc_mcontext.pc));
+#elif defined(__arm__)
+  AttributeSample(static_cast<uintptr_t>(uc->uc_mcontext.arm_pc));
+#endif
+}
+
+#endif
+
+void SetSampledThread()
+{
+#if defined(_WIN32)
+  if (s_sampled_thread)
+    CloseHandle(s_sampled_thread);
+  DuplicateHandle(GetCurrentProcess(), GetCurrentThread(), GetCurrentProcess(), &s_sampled_thread,
+                  THREAD_GET_CONTEXT | THREAD_SUSPEND_RESUME, FALSE, 0);
+#elif defined(__linux__)
+  s_sampled_thread = pthread_self();
+  s_have_sampled_thread = true;
+#endif
+}
+
+bool Start(u32 sample_rate_hz)
+{
+  if (s_sampler_thread_running.load(std::memory_order_acquire))
+    return true;
+
+#if defined(_WIN32)
+  if (!s_sampled_thread)
+  {
+    Log_ErrorPrint("No thread registered for sampling");
+    return false;
+  }
+#elif defined(__linux__)
+  if (!s_have_sampled_thread)
+  {
+    Log_ErrorPrint("No thread registered for sampling");
+    return false;
+  }
+
+  struct sigaction sa = {};
+  sa.sa_sigaction = SampleSignalHandler;
+  sa.sa_flags = SA_SIGINFO | SA_RESTART;
+  if (sigaction(SIGPROF, &sa, &s_old_sigprof_action) != 0)
+  {
+    Log_ErrorPrint("sigaction(SIGPROF) failed");
+    return false;
+  }
+#else
+  Log_ErrorPrint("Sampling profiler is not supported on this platform");
+  return false;
+#endif
+
+#if defined(_WIN32) || defined(__linux__)
+  s_total_samples.store(0, std::memory_order_relaxed);
+  s_host_samples.store(0, std::memory_order_relaxed);
+  for (std::atomic<u64>& counter : s_range_samples)
+    counter.store(0, std::memory_order_relaxed);
+
+  s_sampler_thread_running.store(true, std::memory_order_release);
+  s_sampler_thread.Start([sample_rate_hz]() { SamplerThreadEntry(sample_rate_hz); });
+  Log_InfoPrintf("Sampling profiler started at %u Hz", sample_rate_hz);
+  return true;
+#endif
+}
+
+void Stop()
+{
+  if (!s_sampler_thread_running.load(std::memory_order_acquire))
+    return;
+
+  s_sampler_thread_running.store(false, std::memory_order_release);
+  s_sampler_thread.Join();
+
+#if defined(__linux__)
+  sigaction(SIGPROF, &s_old_sigprof_action, nullptr);
+#endif
+
+  Log_InfoPrintf("Sampling profiler stopped after %" PRIu64 " samples",
+                 s_total_samples.load(std::memory_order_relaxed));
+}
+
+bool IsActive()
+{
+  return s_sampler_thread_running.load(std::memory_order_acquire);
+}
+
+void SamplerThreadEntry(u32 sample_rate_hz)
+{
+  Threading::SetNameOfCurrentThread("Thread Sampler");
+
+  const u64 interval_ns = 1000000000ULL / std::max<u32>(sample_rate_hz, 1);
+  while (s_sampler_thread_running.load(std::memory_order_acquire))
+  {
+    Common::Timer::NanoSleep(interval_ns);
+
+#if defined(_WIN32)
+    // Suspend-and-inspect. The thread is only stopped for the register read, and we never
+    // touch any locks while it's suspended.
+    if (SuspendThread(s_sampled_thread) == static_cast<DWORD>(-1))
+      continue;
+
+    CONTEXT ctx = {};
+    ctx.ContextFlags = CONTEXT_CONTROL;
+    uintptr_t pc = 0;
+    if (GetThreadContext(s_sampled_thread, &ctx))
+    {
+#if defined(CPU_X64)
+      pc = static_cast<uintptr_t>(ctx.Rip);
+#elif defined(CPU_AARCH64)
+      pc = static_cast<uintptr_t>(ctx.Pc);
+#else
+      pc = static_cast<uintptr_t>(ctx.Eip);
+#endif
+    }
+
+    ResumeThread(s_sampled_thread);
+    if (pc != 0)
+      AttributeSample(pc);
+#elif defined(__linux__)
+    // The signal handler reads the program counter out of the interrupted context and
+    // attributes it in place.
+    if (pthread_kill(s_sampled_thread, SIGPROF) != 0)
+      break;
+#endif
+  }
+}
+
+Stats GetStats()
+{
+  Stats stats;
+  stats.total_samples = s_total_samples.load(std::memory_order_relaxed);
+  stats.host_samples = s_host_samples.load(std::memory_order_relaxed);
+  for (u32 i = 0; i < MAX_CODE_RANGES; i++)
+  {
+    if (s_code_ranges[i].start.load(std::memory_order_acquire) == 0)
+      continue;
+
+    stats.ranges.push_back({s_code_ranges[i].name, s_range_samples[i].load(std::memory_order_relaxed)});
+  }
+
+  return stats;
+}
+
+bool WriteSummaryToFile(const char* filename)
+{
+  const Stats stats = GetStats();
+  if (stats.total_samples == 0)
+    return false;
+
+  const double to_percent = 100.0 / static_cast<double>(stats.total_samples);
+  std::string summary = fmt::format("{} samples\n", stats.total_samples);
+  for (const RangeStats& range : stats.ranges)
+    summary += fmt::format("{}: {} ({:.1f}%)\n", range.name, range.samples,
+                           static_cast<double>(range.samples) * to_percent);
+  summary += fmt::format("Host code: {} ({:.1f}%)\n", stats.host_samples,
+                         static_cast<double>(stats.host_samples) * to_percent);
+
+  return FileSystem::WriteStringToFile(filename, summary);
+}
+
+} // namespace ThreadSampler
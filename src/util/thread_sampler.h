@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: 2019-2023 Connor McLaughlin <stenzek@gmail.com>
+// SPDX-License-Identifier: (GPL-3.0 OR CC-BY-NC-ND-4.0)
+
+#pragma once
+
+#include "common/types.h"
+
+#include <vector>
+
+// Lightweight built-in sampling profiler, for setups where an external profiler can't be
+// attached. A timer thread periodically captures the sampled thread's program counter and
+// attributes it to registered host code ranges (e.g. the recompiler's code buffer); anything
+// outside a registered range is counted as statically-compiled host code.
+// Only implemented on Windows and Linux, Start() fails elsewhere.
+namespace ThreadSampler {
+
+struct RangeStats
+{
+  const char* name;
+  u64 samples;
+};
+
+struct Stats
+{
+  u64 total_samples;
+  u64 host_samples; ///< samples which fell outside every registered range
+  std::vector<RangeStats> ranges;
+};
+
+/// Registers/unregisters a named host code range for sample attribution.
+/// The name must be a string literal, since it is read from the sampling context.
+void RegisterCodeRange(const char* name, const void* base, size_t size);
+void UnregisterCodeRange(const void* base);
+
+/// Makes the calling thread the thread whose program counter gets sampled.
+/// Must be called before Start(), and not while sampling is active.
+void SetSampledThread();
+
+/// Starts/stops the sampler thread. Counters are reset on each start.
+bool Start(u32 sample_rate_hz);
+void Stop();
+bool IsActive();
+
+/// Returns a snapshot of the counters. Safe to call while sampling is active.
+Stats GetStats();
+
+/// Writes a human-readable summary of the current counters to the given file.
+bool WriteSummaryToFile(const char* filename);
+
+} // namespace ThreadSampler
@@ -264,6 +264,10 @@ void Vulkan::GraphicsPipelineBuilder::Clear()
   m_line_rasterization_state = {};
   m_line_rasterization_state.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_LINE_STATE_CREATE_INFO_EXT;
 
+  m_rendering = {};
+  m_rendering.sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR;
+  m_rendering_color_format = VK_FORMAT_UNDEFINED;
+
   // set defaults
   SetNoCullRasterizationState();
   SetNoDepthTestState();
@@ -562,6 +566,19 @@ void Vulkan::GraphicsPipelineBuilder::SetRenderPass(VkRenderPass render_pass, u3
   m_ci.subpass = subpass;
 }
 
+void Vulkan::GraphicsPipelineBuilder::SetDynamicRendering(VkFormat color_format, VkFormat depth_format)
+{
+  AddPointerToChain(&m_ci, &m_rendering);
+
+  if (color_format != VK_FORMAT_UNDEFINED)
+  {
+    m_rendering_color_format = color_format;
+    m_rendering.colorAttachmentCount = 1;
+    m_rendering.pColorAttachmentFormats = &m_rendering_color_format;
+  }
+  m_rendering.depthAttachmentFormat = depth_format;
+}
+
 void Vulkan::GraphicsPipelineBuilder::SetProvokingVertex(VkProvokingVertexModeEXT mode)
 {
   AddPointerToChain(&m_rasterization_state, &m_provoking_vertex);
@@ -138,6 +138,10 @@ public:
   void SetPipelineLayout(VkPipelineLayout layout);
   void SetRenderPass(VkRenderPass render_pass, u32 subpass);
 
+  // Leaves renderPass at VK_NULL_HANDLE and supplies the attachment formats via
+  // VkPipelineRenderingCreateInfoKHR, for use with VK_KHR_dynamic_rendering.
+  void SetDynamicRendering(VkFormat color_format, VkFormat depth_format);
+
   void SetProvokingVertex(VkProvokingVertexModeEXT mode);
 
 private:
@@ -167,6 +171,9 @@ private:
 
   VkPipelineRasterizationProvokingVertexStateCreateInfoEXT m_provoking_vertex;
   VkPipelineRasterizationLineStateCreateInfoEXT m_line_rasterization_state;
+
+  VkPipelineRenderingCreateInfoKHR m_rendering;
+  VkFormat m_rendering_color_format;
 };
 
 class ComputePipelineBuilder
@@ -18,6 +18,7 @@
 #include "common/path.h"
 #include "common/scoped_guard.h"
 #include "common/string.h"
+#include "common/string_util.h"
 
 #include "fmt/format.h"
 
@@ -343,6 +344,7 @@ bool VulkanDevice::SelectDeviceExtensions(ExtensionList* extension_list, bool en
   m_optional_extensions.vk_ext_attachment_feedback_loop_layout =
     SupportsExtension(VK_EXT_ATTACHMENT_FEEDBACK_LOOP_LAYOUT_EXTENSION_NAME, false);
   m_optional_extensions.vk_khr_driver_properties = SupportsExtension(VK_KHR_DRIVER_PROPERTIES_EXTENSION_NAME, false);
+  m_optional_extensions.vk_khr_dynamic_rendering = SupportsExtension(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME, false);
   m_optional_extensions.vk_khr_push_descriptor = SupportsExtension(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME, false);
 
 #ifdef _WIN32
@@ -489,11 +491,15 @@ bool VulkanDevice::CreateDevice(VkSurfaceKHR surface, bool enable_validation_lay
     VK_FALSE};
   VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT attachment_feedback_loop_feature = {
     VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ATTACHMENT_FEEDBACK_LOOP_LAYOUT_FEATURES_EXT, nullptr, VK_TRUE};
+  VkPhysicalDeviceDynamicRenderingFeaturesKHR dynamic_rendering_feature = {
+    VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR, nullptr, VK_TRUE};
 
   if (m_optional_extensions.vk_ext_rasterization_order_attachment_access)
     Vulkan::AddPointerToChain(&device_info, &rasterization_order_access_feature);
   if (m_optional_extensions.vk_ext_attachment_feedback_loop_layout)
     Vulkan::AddPointerToChain(&device_info, &attachment_feedback_loop_feature);
+  if (m_optional_extensions.vk_khr_dynamic_rendering)
+    Vulkan::AddPointerToChain(&device_info, &dynamic_rendering_feature);
 
   VkResult res = vkCreateDevice(m_physical_device, &device_info, nullptr, &m_device);
   if (res != VK_SUCCESS)
@@ -533,12 +539,16 @@ void VulkanDevice::ProcessDeviceExtensions()
     VK_FALSE};
   VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT attachment_feedback_loop_feature = {
     VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ATTACHMENT_FEEDBACK_LOOP_LAYOUT_FEATURES_EXT, nullptr, VK_FALSE};
+  VkPhysicalDeviceDynamicRenderingFeaturesKHR dynamic_rendering_feature = {
+    VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR, nullptr, VK_FALSE};
 
   // add in optional feature structs
   if (m_optional_extensions.vk_ext_rasterization_order_attachment_access)
     Vulkan::AddPointerToChain(&features2, &rasterization_order_access_feature);
   if (m_optional_extensions.vk_ext_attachment_feedback_loop_layout)
     Vulkan::AddPointerToChain(&features2, &attachment_feedback_loop_feature);
+  if (m_optional_extensions.vk_khr_dynamic_rendering)
+    Vulkan::AddPointerToChain(&features2, &dynamic_rendering_feature);
 
   // query
   vkGetPhysicalDeviceFeatures2(m_physical_device, &features2);
@@ -548,6 +558,7 @@ void VulkanDevice::ProcessDeviceExtensions()
     (rasterization_order_access_feature.rasterizationOrderColorAttachmentAccess == VK_TRUE);
   m_optional_extensions.vk_ext_attachment_feedback_loop_layout &=
     (attachment_feedback_loop_feature.attachmentFeedbackLoopLayout == VK_TRUE);
+  m_optional_extensions.vk_khr_dynamic_rendering &= (dynamic_rendering_feature.dynamicRendering == VK_TRUE);
 
   VkPhysicalDeviceProperties2 properties2 = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2, nullptr, {}};
   VkPhysicalDevicePushDescriptorPropertiesKHR push_descriptor_properties = {
@@ -572,6 +583,8 @@ void VulkanDevice::ProcessDeviceExtensions()
                  m_optional_extensions.vk_ext_rasterization_order_attachment_access ? "supported" : "NOT supported");
   Log_InfoPrintf("VK_EXT_attachment_feedback_loop_layout is %s",
                  m_optional_extensions.vk_ext_attachment_feedback_loop_layout ? "supported" : "NOT supported");
+  Log_InfoPrintf("VK_KHR_dynamic_rendering is %s",
+                 m_optional_extensions.vk_khr_dynamic_rendering ? "supported" : "NOT supported");
   Log_InfoPrintf("VK_KHR_push_descriptor is %s",
                  m_optional_extensions.vk_khr_push_descriptor ? "supported" : "NOT supported");
 }
@@ -768,6 +781,20 @@ bool VulkanDevice::CreatePersistentDescriptorPool()
       m_features.gpu_timing = false;
       return false;
     }
+
+    const VkQueryPoolCreateInfo scope_query_create_info = {VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+                                                           nullptr,
+                                                           0,
+                                                           VK_QUERY_TYPE_TIMESTAMP,
+                                                           NUM_COMMAND_BUFFERS * MAX_TIMER_SCOPES * 2,
+                                                           0};
+    res = vkCreateQueryPool(m_device, &scope_query_create_info, nullptr, &m_scope_timestamp_query_pool);
+    if (res != VK_SUCCESS)
+    {
+      LOG_VULKAN_ERROR(res, "vkCreateQueryPool failed: ");
+      m_features.gpu_timing = false;
+      return false;
+    }
   }
 
   return true;
@@ -775,6 +802,9 @@ bool VulkanDevice::CreatePersistentDescriptorPool()
 
 void VulkanDevice::DestroyPersistentDescriptorPool()
 {
+  if (m_scope_timestamp_query_pool != VK_NULL_HANDLE)
+    vkDestroyQueryPool(m_device, m_scope_timestamp_query_pool, nullptr);
+
   if (m_timestamp_query_pool != VK_NULL_HANDLE)
     vkDestroyQueryPool(m_device, m_timestamp_query_pool, nullptr);
 
@@ -927,6 +957,30 @@ bool VulkanDevice::SetGPUTimingEnabled(bool enabled)
   return (enabled == m_gpu_timing_enabled);
 }
 
+void VulkanDevice::BeginTimerScope(const char* name)
+{
+  CommandBuffer& resources = m_frame_resources[m_current_frame];
+  if (!m_gpu_timing_enabled || m_timer_scope_open || resources.num_timer_scopes == MAX_TIMER_SCOPES)
+    return;
+
+  resources.timer_scope_names[resources.num_timer_scopes] = name;
+  vkCmdWriteTimestamp(m_current_command_buffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, m_scope_timestamp_query_pool,
+                      m_current_frame * (MAX_TIMER_SCOPES * 2) + resources.num_timer_scopes * 2);
+  m_timer_scope_open = true;
+}
+
+void VulkanDevice::EndTimerScope()
+{
+  if (!m_timer_scope_open)
+    return;
+
+  CommandBuffer& resources = m_frame_resources[m_current_frame];
+  vkCmdWriteTimestamp(m_current_command_buffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, m_scope_timestamp_query_pool,
+                      m_current_frame * (MAX_TIMER_SCOPES * 2) + resources.num_timer_scopes * 2 + 1);
+  resources.num_timer_scopes++;
+  m_timer_scope_open = false;
+}
+
 void VulkanDevice::WaitForCommandBufferCompletion(u32 index)
 {
   // Wait for this command buffer to be completed.
@@ -971,6 +1025,28 @@ void VulkanDevice::WaitForCommandBufferCompletion(u32 index)
       }
     }
 
+    if (resources.num_timer_scopes > 0)
+    {
+      std::array<u64, MAX_TIMER_SCOPES * 2> scope_timestamps;
+      res = vkGetQueryPoolResults(m_device, m_scope_timestamp_query_pool, cleanup_index * (MAX_TIMER_SCOPES * 2),
+                                  resources.num_timer_scopes * 2, sizeof(u64) * resources.num_timer_scopes * 2,
+                                  scope_timestamps.data(), sizeof(u64), VK_QUERY_RESULT_64_BIT);
+      if (res == VK_SUCCESS)
+      {
+        for (u32 i = 0; i < resources.num_timer_scopes; i++)
+        {
+          const double ns_diff = (scope_timestamps[i * 2 + 1] - scope_timestamps[i * 2]) *
+                                 static_cast<double>(m_device_properties.limits.timestampPeriod);
+          AccumulateTimerScope(resources.timer_scope_names[i], static_cast<float>(ns_diff / 1000000.0));
+        }
+      }
+      else
+      {
+        LOG_VULKAN_ERROR(res, "vkGetQueryPoolResults failed: ");
+      }
+      resources.num_timer_scopes = 0;
+    }
+
     cleanup_index = (cleanup_index + 1) % NUM_COMMAND_BUFFERS;
   }
 
@@ -1005,6 +1081,10 @@ void VulkanDevice::SubmitCommandBuffer(VulkanSwapChain* present_swap_chain /* =
     }
   }
 
+  // Close any scope left open so the end timestamp lands in the same command buffer as the start.
+  if (m_timer_scope_open)
+    EndTimerScope();
+
   if (m_gpu_timing_enabled && resources.timestamp_written)
   {
     vkCmdWriteTimestamp(m_current_command_buffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, m_timestamp_query_pool,
@@ -1206,6 +1286,8 @@ void VulkanDevice::BeginCommandBuffer(u32 index)
     vkCmdResetQueryPool(resources.command_buffers[1], m_timestamp_query_pool, index * 2, 2);
     vkCmdWriteTimestamp(resources.command_buffers[1], VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, m_timestamp_query_pool,
                         index * 2);
+    vkCmdResetQueryPool(resources.command_buffers[1], m_scope_timestamp_query_pool, index * (MAX_TIMER_SCOPES * 2),
+                        MAX_TIMER_SCOPES * 2);
   }
 
   resources.fence_counter = m_next_fence_counter++;
@@ -1842,6 +1924,13 @@ void VulkanDevice::FillPipelineCacheHeader(VK_PIPELINE_CACHE_HEADER* header)
   std::memcpy(header->uuid, m_device_properties.pipelineCacheUUID, VK_UUID_SIZE);
 }
 
+std::string VulkanDevice::GetPipelineCacheDriverId()
+{
+  // The pipeline cache UUID changes with every driver build, so keying the filename on it gives
+  // each driver version its own cache instead of one that a driver update invalidates.
+  return StringUtil::EncodeHex(m_device_properties.pipelineCacheUUID, VK_UUID_SIZE);
+}
+
 bool VulkanDevice::ReadPipelineCache(const std::string& filename)
 {
   std::optional<std::vector<u8>> data;
@@ -2092,7 +2181,12 @@ void VulkanDevice::EndPresent()
   VulkanTexture::TransitionSubresourcesToLayout(cmdbuf, m_swap_chain->GetCurrentImage(), GPUTexture::Type::RenderTarget,
                                                 0, 1, 0, 1, VulkanTexture::Layout::ColorAttachment,
                                                 VulkanTexture::Layout::PresentSrc);
-  SubmitCommandBuffer(m_swap_chain.get(), !m_swap_chain->IsPresentModeSynchronizing());
+
+  // Queue synchronizing presents to the worker thread as well, otherwise a FIFO vkQueuePresentKHR() blocks
+  // the calling thread until a swap chain slot frees up. BeginPresent() waits for the queued present before
+  // acquiring the next image, so at most one present is in flight and pacing is unchanged - the wait just
+  // overlaps with the next frame's emulation instead of stalling it.
+  SubmitCommandBuffer(m_swap_chain.get(), true);
   MoveToNextCommandBuffer();
   InvalidateCachedState();
 }
@@ -2225,6 +2319,12 @@ bool VulkanDevice::CheckFeatures()
   m_features.shader_cache = true;
   m_features.pipeline_cache = true;
 
+  // vkCreateGraphicsPipelines() is safe to call concurrently, and the pipeline cache is internally synchronized.
+  m_features.parallel_pipeline_compilation = true;
+
+  // glslang only needs one-time process initialization, and vkCreateShaderModule() is free-threaded.
+  m_features.parallel_shader_compilation = true;
+
   return true;
 }
 
@@ -2661,7 +2761,7 @@ void VulkanDevice::RenderBlankFrame()
   VulkanTexture::TransitionSubresourcesToLayout(cmdbuf, image, GPUTexture::Type::RenderTarget, 0, 1, 0, 1,
                                                 VulkanTexture::Layout::TransferDst, VulkanTexture::Layout::PresentSrc);
 
-  SubmitCommandBuffer(m_swap_chain.get(), !m_swap_chain->IsPresentModeSynchronizing());
+  SubmitCommandBuffer(m_swap_chain.get(), true);
   MoveToNextCommandBuffer();
 
   InvalidateCachedState();
@@ -2682,10 +2782,25 @@ void VulkanDevice::BeginRenderPass()
 {
   DebugAssert(!InRenderPass());
 
+  // With VK_KHR_dynamic_rendering the attachments are described inline instead of going through
+  // cached render pass/framebuffer objects, so target switches don't hit the pass object cache.
+  // The load/store op selection below is shared between both paths.
+  const bool dynamic_rendering = m_optional_extensions.vk_khr_dynamic_rendering;
   VkRenderPassBeginInfo bi = {
     VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO, nullptr, VK_NULL_HANDLE, VK_NULL_HANDLE, {}, 0u, nullptr};
+  VkRenderingInfoKHR ri = {VK_STRUCTURE_TYPE_RENDERING_INFO_KHR, nullptr, 0u, {}, 1u, 0u, 0u, nullptr, nullptr,
+                           nullptr};
+  VkRenderingAttachmentInfoKHR color_attachment = {VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR};
+  VkRenderingAttachmentInfoKHR depth_attachment = {VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR};
   std::array<VkClearValue, 2> clear_values;
 
+  // The attachment and texture transitions get coalesced into a single pipeline barrier, instead
+  // of serializing one barrier per image.
+  std::array<VkImageMemoryBarrier, MAX_TEXTURE_SAMPLERS + 2> barriers;
+  u32 num_barriers = 0;
+  VkPipelineStageFlags barrier_src_stage_mask = 0;
+  VkPipelineStageFlags barrier_dst_stage_mask = 0;
+
   if (m_current_framebuffer) [[likely]]
   {
     VkFormat rt_format = VK_FORMAT_UNDEFINED;
@@ -2734,7 +2849,8 @@ void VulkanDevice::BeginRenderPass()
           break;
       }
 
-      rt->TransitionToLayout(VulkanTexture::Layout::ColorAttachment);
+      rt->AppendLayoutTransition(VulkanTexture::Layout::ColorAttachment, barriers.data(), &num_barriers,
+                                 &barrier_src_stage_mask, &barrier_dst_stage_mask);
       rt->SetUseFenceCounter(GetCurrentFenceCounter());
     }
 
@@ -2776,34 +2892,89 @@ void VulkanDevice::BeginRenderPass()
           break;
       }
 
-      ds->TransitionToLayout(VulkanTexture::Layout::DepthStencilAttachment);
+      ds->AppendLayoutTransition(VulkanTexture::Layout::DepthStencilAttachment, barriers.data(), &num_barriers,
+                                 &barrier_src_stage_mask, &barrier_dst_stage_mask);
       ds->SetUseFenceCounter(GetCurrentFenceCounter());
     }
 
-    bi.framebuffer = m_current_framebuffer->GetFramebuffer();
-    bi.renderPass = m_current_render_pass =
-      GetRenderPass(rt_format, ds_format, samples, rt_load_op, rt_store_op, ds_load_op, ds_store_op);
-    bi.renderArea.extent = {m_current_framebuffer->GetWidth(), m_current_framebuffer->GetHeight()};
+    if (dynamic_rendering)
+    {
+      if (rt)
+      {
+        color_attachment.imageView = rt->GetView();
+        color_attachment.imageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        color_attachment.loadOp = rt_load_op;
+        color_attachment.storeOp = rt_store_op;
+        if (rt_load_op == VK_ATTACHMENT_LOAD_OP_CLEAR)
+          color_attachment.clearValue = clear_values[0];
+        ri.colorAttachmentCount = 1;
+        ri.pColorAttachments = &color_attachment;
+      }
+      if (ds)
+      {
+        depth_attachment.imageView = ds->GetView();
+        depth_attachment.imageLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+        depth_attachment.loadOp = ds_load_op;
+        depth_attachment.storeOp = ds_store_op;
+        if (ds_load_op == VK_ATTACHMENT_LOAD_OP_CLEAR)
+          depth_attachment.clearValue = clear_values[rt ? 1 : 0];
+        ri.pDepthAttachment = &depth_attachment;
+      }
+      ri.renderArea.extent = {m_current_framebuffer->GetWidth(), m_current_framebuffer->GetHeight()};
+    }
+    else
+    {
+      bi.framebuffer = m_current_framebuffer->GetFramebuffer();
+      bi.renderPass = m_current_render_pass =
+        GetRenderPass(rt_format, ds_format, samples, rt_load_op, rt_store_op, ds_load_op, ds_store_op);
+      bi.renderArea.extent = {m_current_framebuffer->GetWidth(), m_current_framebuffer->GetHeight()};
+    }
   }
   else
   {
     // Re-rendering to swap chain.
-    bi.framebuffer = m_swap_chain->GetCurrentFramebuffer();
-    bi.renderPass = m_current_render_pass =
-      GetRenderPass(m_swap_chain->GetImageFormat(), VK_FORMAT_UNDEFINED, VK_SAMPLE_COUNT_1_BIT,
-                    VK_ATTACHMENT_LOAD_OP_LOAD, VK_ATTACHMENT_STORE_OP_STORE);
-    bi.renderArea.extent = {m_swap_chain->GetWidth(), m_swap_chain->GetHeight()};
+    if (dynamic_rendering)
+    {
+      color_attachment.imageView = m_swap_chain->GetCurrentImageView();
+      color_attachment.imageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+      color_attachment.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+      color_attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+      ri.colorAttachmentCount = 1;
+      ri.pColorAttachments = &color_attachment;
+      ri.renderArea.extent = {m_swap_chain->GetWidth(), m_swap_chain->GetHeight()};
+    }
+    else
+    {
+      bi.framebuffer = m_swap_chain->GetCurrentFramebuffer();
+      bi.renderPass = m_current_render_pass =
+        GetRenderPass(m_swap_chain->GetImageFormat(), VK_FORMAT_UNDEFINED, VK_SAMPLE_COUNT_1_BIT,
+                      VK_ATTACHMENT_LOAD_OP_LOAD, VK_ATTACHMENT_STORE_OP_STORE);
+      bi.renderArea.extent = {m_swap_chain->GetWidth(), m_swap_chain->GetHeight()};
+    }
   }
 
-  DebugAssert(m_current_render_pass);
+  DebugAssert(dynamic_rendering || m_current_render_pass);
 
   // All textures should be in shader read only optimal already, but just in case..
   const u32 num_textures = GetActiveTexturesForLayout(m_current_pipeline_layout);
   for (u32 i = 0; i < num_textures; i++)
-    m_current_textures[i]->TransitionToLayout(VulkanTexture::Layout::ShaderReadOnly);
+  {
+    m_current_textures[i]->AppendLayoutTransition(VulkanTexture::Layout::ShaderReadOnly, barriers.data(), &num_barriers,
+                                                  &barrier_src_stage_mask, &barrier_dst_stage_mask);
+  }
+
+  if (num_barriers > 0)
+  {
+    vkCmdPipelineBarrier(GetCurrentCommandBuffer(), barrier_src_stage_mask, barrier_dst_stage_mask, 0, 0, nullptr, 0,
+                         nullptr, num_barriers, barriers.data());
+  }
 
   // TODO: Stats
-  vkCmdBeginRenderPass(GetCurrentCommandBuffer(), &bi, VK_SUBPASS_CONTENTS_INLINE);
+  if (dynamic_rendering)
+    vkCmdBeginRenderingKHR(GetCurrentCommandBuffer(), &ri);
+  else
+    vkCmdBeginRenderPass(GetCurrentCommandBuffer(), &bi, VK_SUBPASS_CONTENTS_INLINE);
+  m_in_render_pass = true;
 
   // If this is a new command buffer, bind the pipeline and such.
   if (m_dirty_flags & DIRTY_FLAG_INITIAL)
@@ -2817,30 +2988,70 @@ void VulkanDevice::BeginSwapChainRenderPass()
   const VkCommandBuffer cmdbuf = GetCurrentCommandBuffer();
   const VkImage swap_chain_image = m_swap_chain->GetCurrentImage();
 
-  // Swap chain images start in undefined
-  VulkanTexture::TransitionSubresourcesToLayout(cmdbuf, swap_chain_image, GPUTexture::Type::RenderTarget, 0, 1, 0, 1,
-                                                VulkanTexture::Layout::Undefined,
-                                                VulkanTexture::Layout::ColorAttachment);
+  // Swap chain images start in undefined. Coalesce the transition with any texture transitions
+  // into a single pipeline barrier.
+  std::array<VkImageMemoryBarrier, MAX_TEXTURE_SAMPLERS + 1> barriers;
+  u32 num_barriers = 0;
+  VkPipelineStageFlags barrier_src_stage_mask = 0;
+  VkPipelineStageFlags barrier_dst_stage_mask = 0;
+  VulkanTexture::FillTransitionBarrier(&barriers[num_barriers++], &barrier_src_stage_mask, &barrier_dst_stage_mask,
+                                       swap_chain_image, GPUTexture::Type::RenderTarget, 0, 1, 0, 1,
+                                       VulkanTexture::Layout::Undefined, VulkanTexture::Layout::ColorAttachment);
 
   // All textures should be in shader read only optimal already, but just in case..
   const u32 num_textures = GetActiveTexturesForLayout(m_current_pipeline_layout);
   for (u32 i = 0; i < num_textures; i++)
-    m_current_textures[i]->TransitionToLayout(VulkanTexture::Layout::ShaderReadOnly);
-
-  const VkRenderPass render_pass =
-    GetRenderPass(m_swap_chain->GetImageFormat(), VK_FORMAT_UNDEFINED, VK_SAMPLE_COUNT_1_BIT,
-                  VK_ATTACHMENT_LOAD_OP_CLEAR, VK_ATTACHMENT_STORE_OP_STORE);
-  DebugAssert(render_pass);
-
-  const VkRenderPassBeginInfo rp = {VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
-                                    nullptr,
-                                    render_pass,
-                                    m_swap_chain->GetCurrentFramebuffer(),
-                                    {{0, 0}, {m_swap_chain->GetWidth(), m_swap_chain->GetHeight()}},
-                                    1u,
-                                    &s_present_clear_color};
-  vkCmdBeginRenderPass(GetCurrentCommandBuffer(), &rp, VK_SUBPASS_CONTENTS_INLINE);
-  m_current_render_pass = render_pass;
+  {
+    m_current_textures[i]->AppendLayoutTransition(VulkanTexture::Layout::ShaderReadOnly, barriers.data(), &num_barriers,
+                                                  &barrier_src_stage_mask, &barrier_dst_stage_mask);
+  }
+
+  vkCmdPipelineBarrier(cmdbuf, barrier_src_stage_mask, barrier_dst_stage_mask, 0, 0, nullptr, 0, nullptr, num_barriers,
+                       barriers.data());
+
+  if (m_optional_extensions.vk_khr_dynamic_rendering)
+  {
+    const VkRenderingAttachmentInfoKHR color_attachment = {VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR,
+                                                           nullptr,
+                                                           m_swap_chain->GetCurrentImageView(),
+                                                           VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                                                           VK_RESOLVE_MODE_NONE,
+                                                           VK_NULL_HANDLE,
+                                                           VK_IMAGE_LAYOUT_UNDEFINED,
+                                                           VK_ATTACHMENT_LOAD_OP_CLEAR,
+                                                           VK_ATTACHMENT_STORE_OP_STORE,
+                                                           s_present_clear_color};
+    const VkRenderingInfoKHR ri = {VK_STRUCTURE_TYPE_RENDERING_INFO_KHR,
+                                   nullptr,
+                                   0u,
+                                   {{0, 0}, {m_swap_chain->GetWidth(), m_swap_chain->GetHeight()}},
+                                   1u,
+                                   0u,
+                                   1u,
+                                   &color_attachment,
+                                   nullptr,
+                                   nullptr};
+    vkCmdBeginRenderingKHR(cmdbuf, &ri);
+  }
+  else
+  {
+    const VkRenderPass render_pass =
+      GetRenderPass(m_swap_chain->GetImageFormat(), VK_FORMAT_UNDEFINED, VK_SAMPLE_COUNT_1_BIT,
+                    VK_ATTACHMENT_LOAD_OP_CLEAR, VK_ATTACHMENT_STORE_OP_STORE);
+    DebugAssert(render_pass);
+
+    const VkRenderPassBeginInfo rp = {VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
+                                      nullptr,
+                                      render_pass,
+                                      m_swap_chain->GetCurrentFramebuffer(),
+                                      {{0, 0}, {m_swap_chain->GetWidth(), m_swap_chain->GetHeight()}},
+                                      1u,
+                                      &s_present_clear_color};
+    vkCmdBeginRenderPass(cmdbuf, &rp, VK_SUBPASS_CONTENTS_INLINE);
+    m_current_render_pass = render_pass;
+  }
+
+  m_in_render_pass = true;
   m_current_framebuffer = nullptr;
 
   // Clear pipeline, it's likely incompatible.
@@ -2849,17 +3060,21 @@ void VulkanDevice::BeginSwapChainRenderPass()
 
 bool VulkanDevice::InRenderPass()
 {
-  return m_current_render_pass != VK_NULL_HANDLE;
+  return m_in_render_pass;
 }
 
 void VulkanDevice::EndRenderPass()
 {
-  DebugAssert(m_current_render_pass != VK_NULL_HANDLE);
+  DebugAssert(m_in_render_pass);
 
   // TODO: stats
+  m_in_render_pass = false;
   m_current_render_pass = VK_NULL_HANDLE;
 
-  vkCmdEndRenderPass(GetCurrentCommandBuffer());
+  if (m_optional_extensions.vk_khr_dynamic_rendering)
+    vkCmdEndRenderingKHR(GetCurrentCommandBuffer());
+  else
+    vkCmdEndRenderPass(GetCurrentCommandBuffer());
 }
 
 void VulkanDevice::UnbindFramebuffer(VulkanFramebuffer* fb)
@@ -2925,6 +3140,7 @@ void VulkanDevice::InvalidateCachedState()
 {
   m_dirty_flags = ALL_DIRTY_STATE;
   m_current_render_pass = VK_NULL_HANDLE;
+  m_in_render_pass = false;
   m_current_framebuffer = nullptr;
   m_current_pipeline = nullptr;
 }
@@ -3084,6 +3300,11 @@ bool VulkanDevice::UpdateDescriptorSetsForLayout(bool new_layout, bool new_dynam
       ds[num_ds++] = m_ubo_descriptor_set;
       new_dynamic_offsets = true;
     }
+    else
+    {
+      // UBO set stays bound, only the texture set is being replaced.
+      first_ds++;
+    }
   }
 
   if constexpr (layout == GPUPipeline::Layout::SingleTextureAndUBO ||
@@ -36,6 +36,7 @@ public:
   enum : u32
   {
     NUM_COMMAND_BUFFERS = 3,
+    MAX_TIMER_SCOPES = 16,
   };
 
   struct OptionalExtensions
@@ -45,6 +46,7 @@ public:
     bool vk_ext_attachment_feedback_loop_layout : 1;
     bool vk_ext_full_screen_exclusive : 1;
     bool vk_khr_driver_properties : 1;
+    bool vk_khr_dynamic_rendering : 1;
     bool vk_khr_push_descriptor : 1;
   };
 
@@ -117,6 +119,8 @@ public:
 
   bool SetGPUTimingEnabled(bool enabled) override;
   float GetAndResetAccumulatedGPUTime() override;
+  void BeginTimerScope(const char* name) override;
+  void EndTimerScope() override;
 
   void SetVSync(bool enabled) override;
 
@@ -225,6 +229,7 @@ protected:
 
   bool ReadPipelineCache(const std::string& filename) override;
   bool GetPipelineCacheData(DynamicHeapArray<u8>* data) override;
+  std::string GetPipelineCacheDriverId() override;
 
 private:
   enum DIRTY_FLAG : u32
@@ -269,6 +274,11 @@ private:
     bool init_buffer_used = false;
     bool needs_fence_wait = false;
     bool timestamp_written = false;
+
+    // Named timer scopes recorded in this command buffer, resolved on fence completion. Names are
+    // string literals, so they stay valid across the frames the queries take to resolve.
+    std::array<const char*, MAX_TIMER_SCOPES> timer_scope_names = {};
+    u32 num_timer_scopes = 0;
   };
 
   using CleanupObjectFunction = void (*)(VulkanDevice& dev, void* obj);
@@ -374,7 +384,9 @@ private:
   u32 m_present_queue_family_index = 0;
 
   VkQueryPool m_timestamp_query_pool = VK_NULL_HANDLE;
+  VkQueryPool m_scope_timestamp_query_pool = VK_NULL_HANDLE;
   float m_accumulated_gpu_time = 0.0f;
+  bool m_timer_scope_open = false;
 
   std::array<CommandBuffer, NUM_COMMAND_BUFFERS> m_frame_resources;
   std::deque<std::pair<u64, std::function<void()>>> m_cleanup_objects; // [fence_counter, callback]
@@ -438,7 +450,11 @@ private:
   u32 m_dirty_flags = ALL_DIRTY_STATE;
 
   VulkanFramebuffer* m_current_framebuffer = nullptr;
+
+  // Render pass object for the active pass with the legacy path, VK_NULL_HANDLE when the pass was
+  // started with VK_KHR_dynamic_rendering. m_in_render_pass covers both.
   VkRenderPass m_current_render_pass = VK_NULL_HANDLE;
+  bool m_in_render_pass = false;
 
   VulkanPipeline* m_current_pipeline = nullptr;
   GPUPipeline::Layout m_current_pipeline_layout = GPUPipeline::Layout::SingleTextureAndPushConstants;
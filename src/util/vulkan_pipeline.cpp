@@ -199,15 +199,28 @@ std::unique_ptr<GPUPipeline> VulkanDevice::CreatePipeline(const GPUPipeline::Gra
 
   gpb.SetPipelineLayout(m_pipeline_layouts[static_cast<u8>(config.layout)]);
 
-  const VkRenderPass render_pass = GetRenderPass(TEXTURE_FORMAT_MAPPING[static_cast<u8>(config.color_format)],
-                                                 TEXTURE_FORMAT_MAPPING[static_cast<u8>(config.depth_format)],
-                                                 static_cast<VkSampleCountFlagBits>(config.samples));
-  DebugAssert(render_pass);
-  gpb.SetRenderPass(render_pass, 0);
+  if (m_optional_extensions.vk_khr_dynamic_rendering)
+  {
+    gpb.SetDynamicRendering(TEXTURE_FORMAT_MAPPING[static_cast<u8>(config.color_format)],
+                            TEXTURE_FORMAT_MAPPING[static_cast<u8>(config.depth_format)]);
+  }
+  else
+  {
+    const VkRenderPass render_pass = GetRenderPass(TEXTURE_FORMAT_MAPPING[static_cast<u8>(config.color_format)],
+                                                   TEXTURE_FORMAT_MAPPING[static_cast<u8>(config.depth_format)],
+                                                   static_cast<VkSampleCountFlagBits>(config.samples));
+    DebugAssert(render_pass);
+    gpb.SetRenderPass(render_pass, 0);
+  }
 
   const VkPipeline pipeline = gpb.Create(m_device, m_pipeline_cache, false);
   if (!pipeline)
     return {};
 
+  // Can't tell whether this was a cache hit, but an unchanged cache serializes to the same size
+  // and gets skipped at save time.
+  if (m_pipeline_cache != VK_NULL_HANDLE)
+    MarkPipelineCacheDirty();
+
   return std::unique_ptr<GPUPipeline>(new VulkanPipeline(pipeline, config.layout));
 }
@@ -486,10 +486,16 @@ bool VulkanSwapChain::CreateSwapChain()
   res = vkGetSwapchainImagesKHR(dev.GetVulkanDevice(), m_swap_chain, &image_count, images.data());
   Assert(res == VK_SUCCESS);
 
-  VkRenderPass render_pass =
-    dev.GetRenderPass(m_format, VK_FORMAT_UNDEFINED, VK_SAMPLE_COUNT_1_BIT, VK_ATTACHMENT_LOAD_OP_CLEAR);
-  if (render_pass == VK_NULL_HANDLE)
-    return false;
+  // No framebuffer objects are needed when the device renders to the swap chain with dynamic
+  // rendering, the image views are passed directly at begin time.
+  const bool dynamic_rendering = dev.GetOptionalExtensions().vk_khr_dynamic_rendering;
+  VkRenderPass render_pass = VK_NULL_HANDLE;
+  if (!dynamic_rendering)
+  {
+    render_pass = dev.GetRenderPass(m_format, VK_FORMAT_UNDEFINED, VK_SAMPLE_COUNT_1_BIT, VK_ATTACHMENT_LOAD_OP_CLEAR);
+    if (render_pass == VK_NULL_HANDLE)
+      return false;
+  }
 
   Vulkan::FramebufferBuilder fbb;
   m_images.reserve(image_count);
@@ -516,13 +522,16 @@ bool VulkanSwapChain::CreateSwapChain()
       return false;
     }
 
-    fbb.AddAttachment(image.view);
-    fbb.SetRenderPass(render_pass);
-    fbb.SetSize(size.width, size.height, 1);
-    if ((image.framebuffer = fbb.Create(dev.GetVulkanDevice())) == VK_NULL_HANDLE)
+    if (!dynamic_rendering)
     {
-      vkDestroyImageView(dev.GetVulkanDevice(), image.view, nullptr);
-      return false;
+      fbb.AddAttachment(image.view);
+      fbb.SetRenderPass(render_pass);
+      fbb.SetSize(size.width, size.height, 1);
+      if ((image.framebuffer = fbb.Create(dev.GetVulkanDevice())) == VK_NULL_HANDLE)
+      {
+        vkDestroyImageView(dev.GetVulkanDevice(), image.view, nullptr);
+        return false;
+      }
     }
 
     m_images.push_back(image);
@@ -491,6 +491,30 @@ void VulkanTexture::TransitionSubresourcesToLayout(VkCommandBuffer command_buffe
 void VulkanTexture::TransitionSubresourcesToLayout(VkCommandBuffer command_buffer, VkImage image, Type type,
                                                    u32 start_layer, u32 num_layers, u32 start_level, u32 num_levels,
                                                    Layout old_layout, Layout new_layout)
+{
+  VkImageMemoryBarrier barrier;
+  VkPipelineStageFlags src_stage_mask = 0;
+  VkPipelineStageFlags dst_stage_mask = 0;
+  FillTransitionBarrier(&barrier, &src_stage_mask, &dst_stage_mask, image, type, start_layer, num_layers, start_level,
+                        num_levels, old_layout, new_layout);
+  vkCmdPipelineBarrier(command_buffer, src_stage_mask, dst_stage_mask, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+}
+
+void VulkanTexture::AppendLayoutTransition(Layout new_layout, VkImageMemoryBarrier* barriers, u32* num_barriers,
+                                           VkPipelineStageFlags* src_stage_mask, VkPipelineStageFlags* dst_stage_mask)
+{
+  if (m_layout == new_layout)
+    return;
+
+  FillTransitionBarrier(&barriers[(*num_barriers)++], src_stage_mask, dst_stage_mask, m_image, m_type, 0, m_layers, 0,
+                        m_levels, m_layout, new_layout);
+  m_layout = new_layout;
+}
+
+void VulkanTexture::FillTransitionBarrier(VkImageMemoryBarrier* out_barrier, VkPipelineStageFlags* src_stage_mask,
+                                          VkPipelineStageFlags* dst_stage_mask, VkImage image, Type type,
+                                          u32 start_layer, u32 num_layers, u32 start_level, u32 num_levels,
+                                          Layout old_layout, Layout new_layout)
 {
   VkImageAspectFlags aspect;
   if (type == Type::DepthStencil)
@@ -503,16 +527,17 @@ void VulkanTexture::TransitionSubresourcesToLayout(VkCommandBuffer command_buffe
     aspect = VK_IMAGE_ASPECT_COLOR_BIT;
   }
 
-  VkImageMemoryBarrier barrier = {VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
-                                  nullptr,
-                                  0,
-                                  0,
-                                  GetVkImageLayout(old_layout),
-                                  GetVkImageLayout(new_layout),
-                                  VK_QUEUE_FAMILY_IGNORED,
-                                  VK_QUEUE_FAMILY_IGNORED,
-                                  image,
-                                  {aspect, start_level, num_levels, start_layer, num_layers}};
+  VkImageMemoryBarrier& barrier = *out_barrier;
+  barrier = {VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+             nullptr,
+             0,
+             0,
+             GetVkImageLayout(old_layout),
+             GetVkImageLayout(new_layout),
+             VK_QUEUE_FAMILY_IGNORED,
+             VK_QUEUE_FAMILY_IGNORED,
+             image,
+             {aspect, start_level, num_levels, start_layer, num_layers}};
 
   // srcStageMask -> Stages that must complete before the barrier
   // dstStageMask -> Stages that must wait for after the barrier before beginning
@@ -677,7 +702,9 @@ void VulkanTexture::TransitionSubresourcesToLayout(VkCommandBuffer command_buffe
       dstStageMask = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
       break;
   }
-  vkCmdPipelineBarrier(command_buffer, srcStageMask, dstStageMask, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+  *src_stage_mask |= srcStageMask;
+  *dst_stage_mask |= dstStageMask;
 }
 
 VkDescriptorSet VulkanTexture::GetDescriptorSetWithSampler(VkSampler sampler)
@@ -775,8 +802,8 @@ bool VulkanDevice::DownloadTexture(GPUTexture* texture, u32 x, u32 y, u32 width,
     0,                                       // VkDeviceSize       offset
     size                                     // VkDeviceSize       size
   };
-  vkCmdPipelineBarrier(cmdbuf, VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr, 1, &buffer_info,
-                       0, nullptr);
+  vkCmdPipelineBarrier(cmdbuf, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr, 1,
+                       &buffer_info, 0, nullptr);
 
   if (old_layout != VulkanTexture::Layout::TransferSrc)
     T->TransitionSubresourcesToLayout(cmdbuf, 0, 1, 0, 1, VulkanTexture::Layout::TransferSrc, old_layout);
@@ -965,12 +992,14 @@ VulkanFramebuffer::VulkanFramebuffer(GPUTexture* rt, GPUTexture* ds, u32 width,
 
 VulkanFramebuffer::~VulkanFramebuffer()
 {
-  VulkanDevice::GetInstance().DeferFramebufferDestruction(m_framebuffer);
+  if (m_framebuffer != VK_NULL_HANDLE)
+    VulkanDevice::GetInstance().DeferFramebufferDestruction(m_framebuffer);
 }
 
 void VulkanFramebuffer::SetDebugName(const std::string_view& name)
 {
-  Vulkan::SetObjectName(VulkanDevice::GetInstance().GetVulkanDevice(), m_framebuffer, name);
+  if (m_framebuffer != VK_NULL_HANDLE)
+    Vulkan::SetObjectName(VulkanDevice::GetInstance().GetVulkanDevice(), m_framebuffer, name);
 }
 
 std::unique_ptr<GPUFramebuffer> VulkanDevice::CreateFramebuffer(GPUTexture* rt_or_ds, GPUTexture* ds /*= nullptr*/)
@@ -982,6 +1011,11 @@ std::unique_ptr<GPUFramebuffer> VulkanDevice::CreateFramebuffer(GPUTexture* rt_o
   const u32 width = RT ? RT->GetWidth() : DS->GetWidth();
   const u32 height = RT ? RT->GetHeight() : DS->GetHeight();
 
+  // With dynamic rendering the attachments are passed at begin time, so we only need the object to
+  // carry the targets and dimensions around, not an actual VkFramebuffer.
+  if (m_optional_extensions.vk_khr_dynamic_rendering)
+    return std::unique_ptr<GPUFramebuffer>(new VulkanFramebuffer(RT, DS, width, height, VK_NULL_HANDLE));
+
   const VkRenderPass render_pass =
     GetRenderPass(RT ? RT->GetVkFormat() : VK_FORMAT_UNDEFINED, DS ? DS->GetVkFormat() : VK_FORMAT_UNDEFINED,
                   static_cast<VkSampleCountFlagBits>(RT ? RT->GetSamples() : DS->GetSamples()),
@@ -73,6 +73,19 @@ public:
                                              u32 num_layers, u32 start_level, u32 num_levels, Layout old_layout,
                                              Layout new_layout);
 
+  // Fills out the barrier for a subresource transition and ORs the required stage masks into
+  // src/dst_stage_mask, for callers batching several transitions into one vkCmdPipelineBarrier().
+  static void FillTransitionBarrier(VkImageMemoryBarrier* barrier, VkPipelineStageFlags* src_stage_mask,
+                                    VkPipelineStageFlags* dst_stage_mask, VkImage image, Type type, u32 start_layer,
+                                    u32 num_layers, u32 start_level, u32 num_levels, Layout old_layout,
+                                    Layout new_layout);
+
+  // Appends this texture's transition to a barrier batch instead of issuing it immediately. The
+  // tracked layout is updated straight away, so the caller must submit the batch before any
+  // dependent commands.
+  void AppendLayoutTransition(Layout new_layout, VkImageMemoryBarrier* barriers, u32* num_barriers,
+                              VkPipelineStageFlags* src_stage_mask, VkPipelineStageFlags* dst_stage_mask);
+
   // Call when the texture is bound to the pipeline, or read from in a copy.
   ALWAYS_INLINE void SetUseFenceCounter(u64 counter) { m_use_fence_counter = counter; }
 
@@ -65,6 +65,7 @@ bool WAVWriter::Open(const char* filename, u32 sample_rate, u32 num_channels)
     return false;
   }
 
+  StartFlushThread();
   return true;
 }
 
@@ -73,6 +74,8 @@ void WAVWriter::Close()
   if (!IsOpen())
     return;
 
+  StopFlushThread();
+
   if (std::fseek(m_file, 0, SEEK_SET) != 0 || !WriteHeader())
     Log_ErrorPrintf("Failed to re-write header on file, file may be unplayable");
 
@@ -85,12 +88,61 @@ void WAVWriter::Close()
 
 void WAVWriter::WriteFrames(const s16* samples, u32 num_frames)
 {
-  const u32 num_frames_written =
-    static_cast<u32>(std::fwrite(samples, sizeof(s16) * m_num_channels, num_frames, m_file));
-  if (num_frames_written != num_frames)
-    Log_ErrorPrintf("Only wrote %u of %u frames to output file", num_frames_written, num_frames);
+  const u32 num_samples = num_frames * m_num_channels;
+
+  std::unique_lock lock(m_buffer_mutex);
+  m_pending_buffer.insert(m_pending_buffer.end(), samples, samples + num_samples);
+  m_num_frames += num_frames;
+  if (m_pending_buffer.size() >= (FLUSH_THRESHOLD_FRAMES * m_num_channels))
+    m_buffer_cv.notify_one();
+}
+
+void WAVWriter::StartFlushThread()
+{
+  m_flush_thread_shutdown = false;
+  m_flush_thread = std::thread(&WAVWriter::FlushThread, this);
+}
 
-  m_num_frames += num_frames_written;
+void WAVWriter::StopFlushThread()
+{
+  {
+    std::unique_lock lock(m_buffer_mutex);
+    m_flush_thread_shutdown = true;
+    m_buffer_cv.notify_one();
+  }
+
+  m_flush_thread.join();
+}
+
+void WAVWriter::FlushThread()
+{
+  std::unique_lock lock(m_buffer_mutex);
+  for (;;)
+  {
+    m_buffer_cv.wait(lock, [this]() {
+      return (m_flush_thread_shutdown || m_pending_buffer.size() >= (FLUSH_THRESHOLD_FRAMES * m_num_channels));
+    });
+
+    const bool shutdown = m_flush_thread_shutdown;
+    m_pending_buffer.swap(m_flush_buffer);
+
+    // the fwrite happens with the lock dropped, so the producer can keep appending
+    lock.unlock();
+    if (!m_flush_buffer.empty())
+    {
+      if (std::fwrite(m_flush_buffer.data(), sizeof(SampleType), m_flush_buffer.size(), m_file) !=
+          m_flush_buffer.size())
+      {
+        Log_ErrorPrintf("Failed to write %zu samples to output file", m_flush_buffer.size());
+      }
+
+      m_flush_buffer.clear();
+    }
+    lock.lock();
+
+    if (shutdown)
+      break;
+  }
 }
 
 bool WAVWriter::WriteHeader()
@@ -3,7 +3,11 @@
 
 #pragma once
 #include "common/types.h"
+#include <condition_variable>
 #include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace Common {
 
@@ -26,12 +30,30 @@ public:
 private:
   using SampleType = s16;
 
+  enum : u32
+  {
+    // Flush to disk in roughly quarter-second batches.
+    FLUSH_THRESHOLD_FRAMES = 11025,
+  };
+
   bool WriteHeader();
+  void StartFlushThread();
+  void StopFlushThread();
+  void FlushThread();
 
   std::FILE* m_file = nullptr;
   u32 m_sample_rate = 0;
   u32 m_num_channels = 0;
   u32 m_num_frames = 0;
+
+  // Double-buffered asynchronous writes; the caller appends to the pending buffer, and the flush
+  // thread swaps it out and performs the fwrite(), so a disk stall never blocks the producer.
+  std::vector<SampleType> m_pending_buffer;
+  std::vector<SampleType> m_flush_buffer;
+  std::mutex m_buffer_mutex;
+  std::condition_variable m_buffer_cv;
+  std::thread m_flush_thread;
+  bool m_flush_thread_shutdown = false;
 };
 
-} // namespace Common
\ No newline at end of file
+} // namespace Common